@@ -8,6 +8,15 @@ import presto.psrfits as pfits
 import presto.psr_utils as pu
 import presto.simple_roots as sr
 
+# Allowable DM stepsizes
+# fmt: off
+allow_dDMs = [0.01, 0.02, 0.03, 0.05, 0.1, 0.2, 0.3, 0.5, 1.0,
+              2.0, 3.0, 5.0, 10.0, 20.0, 30.0, 50.0, 100.0, 200.0, 300.0]
+# Allowable numbers of DMs per call when optimizing the plan
+allow_dmspercalls = [1, 2, 4, 6, 8, 12, 16, 24, 32, 48, 64, 96,
+                     128, 192, 256, 384, 512, 768, 1024]
+# fmt: on
+
 
 class observation(object):
     def __init__(self, dt, f_ctr, BW, numchan, cDM):
@@ -32,6 +41,7 @@ class dedisp_method(object):
         numsub=0,
         numprocs=1,
         smearfact=2.0,
+        dmspercall=0,
     ):
         self.obs = obs
         self.downsamp = downsamp
@@ -40,7 +50,13 @@ class dedisp_method(object):
         self.numsub = numsub
         self.BW_smearing = BW_smear(dDM, self.obs.BW, self.obs.f_ctr)
         self.numprepsub = 0
-        if numsub:  # Calculate the maximum subband smearing we can handle
+        if numsub and dmspercall:  # Use the requested number of DMs per call
+            self.DMs_per_prepsub = dmspercall
+            self.dsubDM = dmspercall * dDM
+            self.sub_smearing = subband_smear(
+                self.dsubDM, numsub, self.obs.BW, self.obs.f_ctr
+            )
+        elif numsub:  # Calculate the maximum subband smearing we can handle
             DMs_per_prepsub = 2
             while 1:
                 next_dsubDM = (DMs_per_prepsub + 2) * dDM
@@ -150,6 +166,38 @@ class dedisp_method(object):
             0.001 * other_smear / self.obs.chanwidth * 0.0001205 * self.obs.f_ctr**3.0
         )
 
+    def predict_time(self, costs, T, numprocs=1):
+        """
+        Return the wall time (s) predicted from the ddbench per-element
+        'costs' (see read_costs()) to de-disperse the DMs of this method
+        for an observation of 'T' sec with prepsubband (or mpiprepsubband
+        if numprocs > 1), and to FFT each of the resulting time series.
+        """
+        Nraw = T / self.obs.dt
+        Nout = Nraw / self.downsamp
+        if self.numsub:
+            numsub = self.numsub
+            numcalls = self.numprepsub
+            DMs_per_call = self.DMs_per_prepsub
+        else:  # A single call de-dispersing all the channels
+            numsub = self.obs.numchan
+            numcalls = 1
+            DMs_per_call = self.numDMs
+        # Each call reads and subbands all the raw data...
+        call_time = (
+            Nraw * self.obs.numchan * (costs["cost_rawread"] + costs["cost_subband"])
+        )
+        if self.downsamp > 1:
+            call_time += Nraw * numsub * costs["cost_downsamp"]
+        # ...and then de-disperses the subbands and writes each DM
+        call_time += (
+            DMs_per_call * Nout * (numsub * costs["cost_dedisp"] + costs["cost_write"])
+        )
+        search_time = self.numDMs * costs["cost_fft"] * Nout * np.log2(Nout)
+        # With mpiprepsubband the raw data are read once per run and
+        # each of the numprocs CPUs does the work of one call
+        return (numcalls * call_time + search_time) / numprocs
+
     def plot(self, work_fract):
         DMspan = self.DMs[-1] - self.DMs[0]
         loDM = self.DMs[0] + DMspan * 0.02
@@ -350,12 +398,6 @@ def dm_steps(
         not None, use it to determine possible downsampling values.
         And if device is not None, use it as the PGPLOT device for plotting.
     """
-    # Allowable DM stepsizes
-    # fmt: off
-    allow_dDMs = [0.01, 0.02, 0.03, 0.05, 0.1, 0.2, 0.3, 0.5, 1.0,
-                2.0, 3.0, 5.0, 10.0, 20.0, 30.0, 50.0, 100.0, 200.0, 300.0]
-    # fmt: on
-
     # Allowable number of downsampling factors
     allow_downsamps = choose_downsamps(blocklen)
 
@@ -585,6 +627,138 @@ def dm_steps(
     return methods
 
 
+def read_costs(costfile):
+    """
+    read_costs(costfile):
+        Return a dictionary of the 'key = value' lines (as floats) in
+        the output of ddbench in 'costfile'.
+    """
+    costs = {}
+    with open(costfile) as f:
+        for line in f:
+            line = line.split("#")[0]
+            if "=" in line:
+                key, val = line.split("=")
+                costs[key.strip()] = float(val)
+    return costs
+
+
+def run_ddbench(costfile, numchan, blocklen, numsub=0, rawfiles=[]):
+    """
+    run_ddbench(costfile, numchan, blocklen, numsub=0, rawfiles=[]):
+        Run ddbench to measure the de-dispersion costs on this machine
+        (using the raw data files in 'rawfiles', if any) and write them
+        to 'costfile'.
+    """
+    import subprocess
+    import sys
+
+    if not numsub:  # The per-element costs depend little on numsub
+        numsub = max([n for n in range(1, 65) if numchan % n == 0])
+    downsamp = 2 if blocklen % 2 == 0 else 1
+    cmd = [
+        "ddbench",
+        "-numchan", str(numchan),
+        "-nsub", str(numsub),
+        "-blocklen", str(blocklen),
+        "-downsamp", str(downsamp),
+        "-o", costfile,
+    ] + list(rawfiles)
+    print("Measuring the de-dispersion costs with '%s'" % " ".join(cmd))
+    try:
+        subprocess.check_call(cmd)
+    except (OSError, subprocess.CalledProcessError):
+        print("Error:  Unable to run ddbench to make '%s'" % costfile)
+        sys.exit(1)
+
+
+def optimize_plan(
+    methods, obs, costs, T, numsub=0, numprocs=1, slack=0.1, ok_smearing=0.0,
+    blocklen=1024,
+):
+    """
+    optimize_plan(methods, obs, costs, T, numsub=0, numprocs=1, slack=0.1,
+                  ok_smearing=0.0, blocklen=1024):
+        Return a plan covering the DMs of the de-dispersion plan 'methods'
+        (from dm_steps()) that minimizes the wall time predicted using the
+        ddbench 'costs' for an observation of 'T' sec.  For each of the
+        original methods, the number of subbands (unless 'numsub' is
+        given), the downsampling factor, the DM step, and the number of
+        DMs per call are chosen so that the total smearing never exceeds
+        (1 + 'slack') times that of the original plan (or 'ok_smearing').
+    """
+    if numsub:
+        numsubs = [numsub]
+    else:
+        numsubs = [n for n in range(min(16, obs.numchan), obs.numchan + 1)
+                   if obs.numchan % n == 0]
+    allow_downsamps = choose_downsamps(blocklen)
+    newmethods = []
+    loDM = methods[0].loDM
+    for method in methods:
+        if loDM >= method.hiDM:
+            continue
+        DMs = np.linspace(loDM, method.hiDM, 50)
+        max_smear = (1.0 + slack) * np.maximum(method.total_smear(DMs), ok_smearing)
+        best, best_time = None, np.inf
+        for downsamp in allow_downsamps:
+            if 1000.0 * obs.dt * downsamp > max_smear.min():
+                break
+            for dDM in allow_dDMs:
+                if BW_smear(dDM, obs.BW, obs.f_ctr) > max_smear.min():
+                    break
+                maxnumDMs = int(np.ceil((method.hiDM - loDM) / dDM))
+                dmspercalls = [0] + [n for n in allow_dmspercalls if n <= maxnumDMs]
+                for nsub in numsubs:
+                    for dmspercall in dmspercalls:
+                        # A huge smearfact keeps the method out to method.hiDM
+                        trial = dedisp_method(
+                            obs, downsamp, loDM, method.hiDM, dDM,
+                            numsub=nsub, numprocs=numprocs, smearfact=1e30,
+                            dmspercall=dmspercall,
+                        )
+                        if np.any(trial.total_smear(DMs) > max_smear):
+                            continue
+                        trial_time = trial.predict_time(costs, T, numprocs)
+                        if trial_time < best_time:
+                            best, best_time = trial, trial_time
+        if best is None:  # Keep the original parameters
+            best = dedisp_method(
+                obs, method.downsamp, loDM, method.hiDM, method.dDM,
+                numsub=method.numsub, numprocs=numprocs, smearfact=1e30,
+            )
+        newmethods.append(best)
+        loDM = best.hiDM
+    return newmethods
+
+
+def write_plan(planfile, methods, basename, rawfiles, numprocs=1):
+    """
+    write_plan(planfile, methods, basename, rawfiles, numprocs=1):
+        Write the prepsubband (or mpiprepsubband if numprocs > 1)
+        command lines that carry out the plan 'methods' to 'planfile'.
+    """
+    with open(planfile, "w") as f:
+        for m in methods:
+            nsub = m.numsub if m.numsub else m.obs.numchan
+            # With mpiprepsubband, each run does the work of numprocs calls
+            if m.numsub:
+                numruns = m.numprepsub // numprocs
+                dmsperrun = m.DMs_per_prepsub * numprocs
+            else:
+                numruns, dmsperrun = 1, m.numDMs
+            if numprocs > 1:
+                prog = "mpirun -np %d mpiprepsubband" % (numprocs + 1)
+            else:
+                prog = "prepsubband"
+            for ii in range(numruns):
+                f.write(
+                    "%s -nsub %d -lodm %.2f -dmstep %.2f -numdms %d -downsamp %d -o %s %s\n"
+                    % (prog, nsub, m.loDM + ii * dmsperrun * m.dDM, m.dDM,
+                       dmsperrun, m.downsamp, basename, rawfiles)
+                )
+
+
 dedisp_template1 = """
 from builtins import zip
 from builtins import range
@@ -602,7 +776,7 @@ outsubs = False
 dedisp_template2 = """
 
 # Loop over the DDplan plans
-for dDM, dsubDM, dmspercall, downsamp, subcall, startDM in zip(dDMs, dsubDMs, dmspercalls, downsamps, subcalls, startDMs):
+for nsub, dDM, dsubDM, dmspercall, downsamp, subcall, startDM in zip(nsubs, dDMs, dsubDMs, dmspercalls, downsamps, subcalls, startDMs):
     # Loop over the number of calls
     for ii in range(subcall):
         subDM = startDM + (ii+0.5)*dsubDM
@@ -642,11 +816,22 @@ def usage():
   [-p #procs, --procs=nprocs]     : # CPUs dedispersing for mpiprepsubband (default = 1)
   [-r resolution, --res=res]      : Acceptable time resolution (ms)
   [-w, --write]                   : Write a dedisp.py file for the plan
+  [-O, --optimize]                : Optimize the plan for the predicted run time
+  [--costs=costfile]              : ddbench costs to use (default = ddbench_costs.txt)
+                                    (ddbench is run to make it if it does not exist)
+  [--slack=slack]                 : Fractional extra smearing allowed when optimizing
+                                    (default = 0.1)
+  [-T obslen, --obslen=obslen]    : Observation length (s)  (default = from the
+                                    raw data file or 1000 s)
+  [--plan=planfile]               : Write the prepsubband commands for the plan
 
   The program generates a good plan for de-dispersing raw data.  It
   trades a small amount of sensitivity in order to save computation costs.
   It will determine the observation parameters from the raw data file
-  if it exists.
+  if it exists.  With -O, the plan is re-optimized to minimize the
+  de-dispersion and FFT time predicted from the per-element costs
+  measured on this machine by ddbench, while keeping the smearing within
+  (1 + slack) times that of the standard plan.
 
 """)
 
@@ -659,7 +844,7 @@ if __name__ == "__main__":
     try:
         opts, args = getopt.getopt(
             sys.argv[1:],
-            "hwo:l:d:f:b:n:k:c:t:s:p:r:",
+            "hwOo:l:d:f:b:n:k:c:t:s:p:r:T:",
             [
                 "help",
                 "write",
@@ -675,6 +860,11 @@ if __name__ == "__main__":
                 "subbands=",
                 "procs=",
                 "res=",
+                "optimize",
+                "costs=",
+                "slack=",
+                "obslen=",
+                "plan=",
             ],
         )
 
@@ -698,6 +888,11 @@ if __name__ == "__main__":
     device = "/xwin"
     write_dedisp = False
     blocklen = 1024
+    optimize = False
+    costfile = "ddbench_costs.txt"
+    slack = 0.1
+    T = 0.0
+    planfile = None
 
     if len(args):
         fname, ext = os.path.splitext(args[0])
@@ -709,6 +904,11 @@ if __name__ == "__main__":
                 BW = np.fabs(hdr["foff"]) * numchan
                 fctr = hdr["fch1"] + 0.5 * hdr["foff"] * numchan - 0.5 * hdr["foff"]
                 blocklen = 2400  # from $PRESTO/src/sigproc_fb.c (spectra_per_subint)
+                T = (
+                    (os.path.getsize(args[0]) - hdr_size)
+                    // (numchan * hdr["nbits"] // 8)
+                    * dt
+                )
                 print(
                     """
 Using:
@@ -731,6 +931,7 @@ from '%s'
                 fctr = pf.header["OBSFREQ"]
                 BW = numchan * np.fabs(pf.specinfo.df)
                 blocklen = pf.specinfo.spectra_per_subint
+                T = pf.specinfo.T
                 print(
                     """
 Using:
@@ -793,11 +994,21 @@ from '%s'
             numprocs = int(a)
         if o in ("-r", "--res"):
             ok_smearing = float(a)
+        if o in ("-O", "--optimize"):
+            optimize = True
+        if o == "--costs":
+            costfile = a
+        if o == "--slack":
+            slack = float(a)
+        if o in ("-T", "--obslen"):
+            T = float(a)
+        if o == "--plan":
+            planfile = a
 
     # The following is an instance of an "observation" class
     obs = observation(dt, fctr, BW, numchan, cDM)
 
-    if write_dedisp:  # Always use subbands if writing a dedisp routine
+    if write_dedisp and not optimize:  # Always use subbands if writing a dedisp routine
         if numsubbands == 0:
             divs = [20, 16, 15, 12, 10, 9, 8, 7, 6, 5, 4, 3]
             for div in divs[::-1]:
@@ -814,7 +1025,42 @@ from '%s'
         loDM, hiDM, obs, cDM, numsubbands, numprocs, ok_smearing, blocklen, device
     )
 
+    if optimize:
+        if not os.path.exists(costfile):
+            run_ddbench(costfile, numchan, blocklen, numsubbands, args[:1])
+        costs = read_costs(costfile)
+        if T == 0.0:
+            T = 1000.0
+        old_time = sum([m.predict_time(costs, T, numprocs) for m in methods])
+        methods = optimize_plan(
+            methods, obs, costs, T, numsubbands, numprocs, slack, ok_smearing, blocklen
+        )
+        new_time = sum([m.predict_time(costs, T, numprocs) for m in methods])
+        print(
+            "\nPredicted run times for T = %g s using the costs in '%s':" % (T, costfile)
+        )
+        print("  Original plan  : %10.1f s" % old_time)
+        print(
+            "  Optimized plan : %10.1f s  (%.2fx faster)"
+            % (new_time, old_time / new_time)
+        )
+        print(
+            "\n  Low DM    High DM     dDM  DownSamp  dsubDM   #DMs  DMs/call  calls    nsub    Time(s)"
+        )
+        for m in methods:
+            print(m, "%6d  %9.1f" % (m.numsub, m.predict_time(costs, T, numprocs)))
+        print("\n")
+
+    if planfile is not None:
+        if len(args):
+            basename, ext = os.path.splitext(args[0])
+            write_plan(planfile, methods, basename, args[0], numprocs)
+        else:
+            write_plan(planfile, methods, "rawdata", "rawdata.fil", numprocs)
+        print("Wrote the de-dispersion commands to '%s'" % planfile)
+
     if write_dedisp:
+        nsubs = [m.numsub for m in methods]
         dDMs = [m.dDM for m in methods]
         dsubDMs = [m.dsubDM for m in methods]
         startDMs = [m.loDM for m in methods]
@@ -824,9 +1070,13 @@ from '%s'
         basename, ext = os.path.splitext(args[0])
         with open("dedisp_%s.py" % basename, "w") as f:
             f.write(dedisp_template1)
-            f.write("nsub = %d\n\n" % numsubbands)
             f.write("basename = %s\n" % repr(basename))
             f.write("rawfiles = %s\n\n" % repr(args[0]))
+            f.write(
+                """# number of subbands
+nsubs       = %s\n"""
+                % repr(nsubs)
+            )
             f.write(
                 """# dDM steps from DDplan.py
 dDMs        = %s\n"""
@@ -8,6 +8,7 @@ import glob, os, os.path, shutil, socket, tarfile, stat
 import numpy, sys, time
 from presto import presto
 from presto import sifting
+from presto.pipeline import Pipeline, pycall
 import astropy.io.fits as pyfits
 
 institution = "NRAO" 
@@ -45,6 +46,9 @@ sifting.short_period    = 0.0005 # Shortest period candidates to consider (s)
 sifting.long_period     = 15.0   # Longest period candidates to consider (s)
 sifting.harm_pow_cutoff = 8.0    # Power required in at least one harmonic
 foldnsubs               = 128    # Number of subbands to use when folding
+# Resources for running the processing steps concurrently
+max_cpus              = 0    # CPUs to use (0 = all of them, 1 = serial)
+max_mem_GB            = 0.0  # GB of memory to use (0 = all of it)
 #-------------------------------------------------------------------
 
 def find_masked_fraction(obs):
@@ -60,19 +64,47 @@ def find_masked_fraction(obs):
     # If there is a problem reading the file, return 100%
     return 100.0
 
-def timed_execute(cmd, run_cmd=1):
+def move_files(pattern, dest):
     """
-    timed_execute(cmd):
-        Execute the command 'cmd' after logging the command
-            to STDOUT.  Return the wall-clock amount of time
-            the command took to execute.
+    move_files(pattern, dest):
+        Move (or rename) any files matching the glob 'pattern' to
+            'dest', ignoring any problems.
     """
-    sys.stdout.write("\n'"+cmd+"'\n")
-    sys.stdout.flush()
-    start = time.time()
-    if run_cmd:  os.system(cmd)
-    end = time.time()
-    return end - start
+    for filenm in glob.glob(pattern):
+        try:
+            shutil.move(filenm, dest)
+        except: pass
+
+def finish_accelsearch(basenm, zmax, workdir):
+    """
+    finish_accelsearch(basenm, zmax, workdir):
+        Remove the .txtcand file from an accelsearch run and move
+            the candidate files (including the .cols file) to 'workdir'.
+    """
+    try:
+        os.remove(basenm+"_ACCEL_%d.txtcand"%zmax)
+    except: pass
+    try:  # This prevents errors if there are no cand files to copy
+        shutil.move(basenm+"_ACCEL_%d.cand"%zmax, workdir)
+        shutil.move(basenm+"_ACCEL_%d"%zmax, workdir)
+    except: pass
+    try:  # Only written when accelsearch makes columnar output
+        shutil.move(basenm+"_ACCEL_%d.cols"%zmax, workdir)
+    except: pass
+
+def finish_dm(basenm, workdir):
+    """
+    finish_dm(basenm, workdir):
+        Move the .inf file for a DM to 'workdir' and remove its
+            .dat and .fft files.
+    """
+    try:
+        shutil.move(basenm+".inf", workdir)
+    except: pass
+    for suffix in [".dat", ".fft"]:
+        try:
+            os.remove(basenm+suffix)
+        except: pass
 
 def get_folding_command(cand, obs, ddplans, maskfile):
     """
@@ -170,11 +202,25 @@ class obs_info(object):
         self.sifting_time = 0.0
         self.folding_time = 0.0
         self.total_time = 0.0
+        self.concurrency = 1.0
         # Inialize some candidate counters
         self.num_sifted_cands = 0
         self.num_folded_cands = 0
         self.num_single_cands = 0
         
+    def set_timers(self, pipe):
+        # Get the time spent in each step from the processing pipeline
+        self.rfifind_time = pipe.stage_time("rfifind")
+        self.downsample_time = pipe.stage_time("downsample")
+        self.dedispersing_time = pipe.stage_time("dedispersing")
+        self.FFT_time = pipe.stage_time("FFT")
+        self.lo_accelsearch_time = pipe.stage_time("lo_accelsearch")
+        self.hi_accelsearch_time = pipe.stage_time("hi_accelsearch")
+        self.singlepulse_time = pipe.stage_time("singlepulse")
+        self.folding_time = pipe.stage_time("folding")
+        self.concurrency = sum(pipe.stage_times.values()) / pipe.walltime \
+                           if pipe.walltime else 1.0
+
     def write_report(self, filenm):
         report_file = open(filenm, "w")
         report_file.write("---------------------------------------------------------\n")
@@ -184,6 +230,8 @@ class obs_info(object):
                           (self.total_time, self.total_time/3600.0))
         report_file.write("Fraction of data masked:  %.2f%%\n"%\
                           (self.masked_fraction*100.0))
+        report_file.write("Average number of concurrent tasks:  %.2f\n"%\
+                          self.concurrency)
         report_file.write("---------------------------------------------------------\n")
         report_file.write("          rfifind time = %7.1f sec (%5.2f%%)\n"%\
                           (self.rfifind_time, self.rfifind_time/self.total_time*100.0))
@@ -303,109 +351,112 @@ def main(fits_filenm, workdir, ddplans):
     rfifindout=job.basefilenm+"_rfifind.out"
     rfifindmask=job.basefilenm+"_rfifind.mask"
 
+    # All of the processing steps are tasks in a pipeline, so that
+    # independent steps (e.g. different DMs) can run concurrently
+    pipe = Pipeline(ncpus=max_cpus, mem=max_mem_GB)
+
+    rfifind_deps = []
     if not os.path.exists(rfifindout) or not os.path.exists(rfifindmask):
         # rfifind the filterbank file
         cmd = "rfifind -time %.17g -o %s %s > %s_rfifind.out"%\
               (rfifind_chunk_time, job.basefilenm,
                job.fits_filenm, job.basefilenm)
-        job.rfifind_time += timed_execute(cmd)
+        rfifind_deps = [pipe.add("rfifind", cmd, stage="rfifind", io=0.5)]
     maskfilenm = job.basefilenm + "_rfifind.mask"
-    # Find the fraction that was suggested to be masked
-    # Note:  Should we stop processing if the fraction is
-    #        above some large value?  Maybe 30%?
-    job.masked_fraction = find_masked_fraction(job)
     
     # Iterate over the stages of the overall de-dispersion plan
     dmstrs = []
+    passdirs = []
+    sp_tasks = []
     
     for ddplan in ddplans:
         # Make a downsampled filterbank file
         if ddplan.downsamp > 1:
             cmd = "psrfits_subband -dstime %d -nsub %d -o %s_DS%d %s"%\
                   (ddplan.downsamp, job.nchans, job.dsbasefilenm, ddplan.downsamp, job.dsbasefilenm )
-            job.downsample_time += timed_execute(cmd)
+            ds_deps = [pipe.add("downsample_DS%d"%ddplan.downsamp, cmd,
+                                stage="downsample", io=0.5)]
             fits_filenm = job.dsbasefilenm + "_DS%d%s"%\
                           (ddplan.downsamp,job.fits_filenm[job.fits_filenm.rfind("_"):])
         else:
+            ds_deps = []
             fits_filenm = job.fits_filenm
 
         # Iterate over the individual passes through the .fil file
         for passnum in range(ddplan.numpasses):
             subbasenm = "%s_DM%s"%(job.basefilenm, ddplan.subdmlist[passnum])
+            # Each pass gets its own directory for the single-pulse search
+            passdir = os.path.join(tmpdir, "DM%s"%ddplan.subdmlist[passnum])
+            try:
+                os.makedirs(passdir)
+            except: pass
+            passdirs.append(passdir)
 
             # Now de-disperse 
             cmd = "prepsubband -mask %s -lodm %.2f -dmstep %.2f -nsub %d -numdms %d -numout %d -o %s/%s %s"%\
                   (maskfilenm, ddplan.lodm+passnum*ddplan.sub_dmstep,
                    ddplan.dmstep, ddplan.numsub,
                    ddplan.dmsperpass, job.N/ddplan.downsamp,
-                   tmpdir, job.basefilenm, fits_filenm)
-            job.dedispersing_time += timed_execute(cmd)
+                   passdir, job.basefilenm, fits_filenm)
+            dedisp = pipe.add("prepsubband_"+subbasenm, cmd, deps=rfifind_deps+ds_deps,
+                              stage="dedispersing", io=0.5)
             
             # Do the single-pulse search
             cmd = "single_pulse_search.py -p -m %f -t %f %s/*.dat"%\
-                (singlepulse_maxwidth, singlepulse_threshold, tmpdir)
-            job.singlepulse_time += timed_execute(cmd)
-            spfiles = glob.glob("%s/*.singlepulse"%tmpdir)
-            for spfile in spfiles:
-                try:
-                    shutil.move(spfile, workdir)
-                except: pass
+                (singlepulse_maxwidth, singlepulse_threshold, passdir)
+            sp = pipe.add("singlepulse_"+subbasenm, cmd, deps=[dedisp],
+                          stage="singlepulse", priority=1)
+            sp = pipe.add("move_singlepulse_"+subbasenm,
+                          pycall(move_files, "%s/*.singlepulse"%passdir, workdir),
+                          deps=[sp], stage="singlepulse", priority=1)
+            sp_tasks.append(sp)
 
             # Iterate over all the new DMs
             for dmstr in ddplan.dmlist[passnum]:
                 dmstrs.append(dmstr)
-                basenm = os.path.join(tmpdir, job.basefilenm+"_DM"+dmstr)
+                basenm = os.path.join(passdir, job.basefilenm+"_DM"+dmstr)
                 datnm = basenm+".dat"
                 fftnm = basenm+".fft"
                 infnm = basenm+".inf"
+                dmnm = job.basefilenm+"_DM"+dmstr
 
                 # FFT, zap, and de-redden
                 cmd = "realfft %s"%datnm
-                job.FFT_time += timed_execute(cmd)
+                fft = pipe.add("realfft_"+dmnm, cmd, deps=[dedisp],
+                               stage="FFT", io=0.25, priority=2)
                 cmd = "zapbirds -zap -zapfile %s -baryv %.6g %s"%\
                       (default_zaplist, job.baryv, fftnm)
-                job.FFT_time += timed_execute(cmd)
+                fft = pipe.add("zapbirds_"+dmnm, cmd, deps=[fft],
+                               stage="FFT", priority=2)
                 cmd = "rednoise %s"%fftnm
-                job.FFT_time += timed_execute(cmd)
-                try:
-                    os.rename(basenm+"_red.fft", fftnm)
-                except: pass
+                fft = pipe.add("rednoise_"+dmnm, cmd, deps=[fft],
+                               stage="FFT", priority=2)
+                fft = pipe.add("rename_"+dmnm,
+                               pycall(move_files, basenm+"_red.fft", fftnm),
+                               deps=[fft], stage="FFT", priority=2)
                 
                 # Do the low-acceleration search
                 cmd = "accelsearch -numharm %d -sigma %f -zmax %d -flo %f %s"%\
                       (lo_accel_numharm, lo_accel_sigma, lo_accel_zmax, lo_accel_flo, fftnm)
-                job.lo_accelsearch_time += timed_execute(cmd)
-                try:
-                    os.remove(basenm+"_ACCEL_%d.txtcand"%lo_accel_zmax)
-                except: pass
-                try:  # This prevents errors if there are no cand files to copy
-                    shutil.move(basenm+"_ACCEL_%d.cand"%lo_accel_zmax, workdir)
-                    shutil.move(basenm+"_ACCEL_%d"%lo_accel_zmax, workdir)
-                except: pass
+                lo = pipe.add("lo_accelsearch_"+dmnm, cmd, deps=[fft],
+                              stage="lo_accelsearch", priority=3)
+                lo = pipe.add("lo_accelsearch_files_"+dmnm,
+                              pycall(finish_accelsearch, basenm, lo_accel_zmax, workdir),
+                              deps=[lo], stage="lo_accelsearch", priority=3)
         
                 # Do the high-acceleration search
                 cmd = "accelsearch -numharm %d -sigma %f -zmax %d -flo %f %s"%\
                       (hi_accel_numharm, hi_accel_sigma, hi_accel_zmax, hi_accel_flo, fftnm)
-                job.hi_accelsearch_time += timed_execute(cmd)
-                try:
-                    os.remove(basenm+"_ACCEL_%d.txtcand"%hi_accel_zmax)
-                except: pass
-                try:  # This prevents errors if there are no cand files to copy
-                    shutil.move(basenm+"_ACCEL_%d.cand"%hi_accel_zmax, workdir)
-                    shutil.move(basenm+"_ACCEL_%d"%hi_accel_zmax, workdir)
-                except: pass
-
-                # Move the .inf files
-                try:
-                    shutil.move(infnm, workdir)
-                except: pass
-                # Remove the .dat and .fft files
-                try:
-                    os.remove(datnm)
-                except: pass
-                try:
-                    os.remove(fftnm)
-                except: pass
+                hi = pipe.add("hi_accelsearch_"+dmnm, cmd, deps=[fft],
+                              stage="hi_accelsearch", priority=3)
+                hi = pipe.add("hi_accelsearch_files_"+dmnm,
+                              pycall(finish_accelsearch, basenm, hi_accel_zmax, workdir),
+                              deps=[hi], stage="hi_accelsearch", priority=3)
+
+                # Move the .inf files and remove the .dat and .fft files
+                # (once the single-pulse search is done with them too)
+                pipe.add("cleanup_"+dmnm, pycall(finish_dm, basenm, workdir),
+                         deps=[sp, lo, hi], stage="cleanup", priority=4)
 
     # Make the single-pulse plots
     basedmb = job.basefilenm+"_DM"
@@ -422,14 +473,25 @@ def main(fits_filenm, workdir, ddplans):
                basedmb+"1[0-9][0-9][0-9].[0-9][0-9]"+basedme]
     dmrangestrs = ["0-30", "20-110", "100-310", "300-1000+"]
     psname = job.basefilenm+"_singlepulse.ps"
+    # These all write psname, so they are done one at a time
+    plot_deps = sp_tasks
     for dmglob, dmrangestr in zip(dmglobs, dmrangestrs):
         cmd = 'single_pulse_search.py -t %f -g "%s"' % \
               (singlepulse_plot_SNR, dmglob)
-        job.singlepulse_time += timed_execute(cmd)
-        try:
-            os.rename(psname,
-                      job.basefilenm+"_DMs%s_singlepulse.ps"%dmrangestr)
-        except: pass
+        plot = pipe.add("singlepulse_plot_"+dmrangestr, cmd, deps=plot_deps,
+                        stage="singlepulse")
+        plot = pipe.add("singlepulse_plot_rename_"+dmrangestr,
+                        pycall(move_files, psname,
+                               job.basefilenm+"_DMs%s_singlepulse.ps"%dmrangestr),
+                        deps=[plot], stage="singlepulse")
+        plot_deps = [plot]
+
+    pipe.run()
+
+    # Find the fraction that was suggested to be masked
+    # Note:  Should we stop processing if the fraction is
+    #        above some large value?  Maybe 30%?
+    job.masked_fraction = find_masked_fraction(job)
 
     # Sift through the candidates to choose the best to fold
     
@@ -474,15 +536,21 @@ def main(fits_filenm, workdir, ddplans):
         if cands_folded == max_lo_cands_to_fold:
             break
         elif cand.sigma > to_prepfold_sigma:
-            job.folding_time += timed_execute(get_folding_command(cand, job, ddplans, maskfilenm))
+            pipe.add("fold_lo_%d"%cands_folded,
+                     get_folding_command(cand, job, ddplans, maskfilenm),
+                     stage="folding")
             cands_folded += 1
     cands_folded = 0
     for cand in hi_accel_cands:
         if cands_folded == max_hi_cands_to_fold:
             break
         elif cand.sigma > to_prepfold_sigma:
-            job.folding_time += timed_execute(get_folding_command(cand, job, ddplans, maskfilenm))
+            pipe.add("fold_hi_%d"%cands_folded,
+                     get_folding_command(cand, job, ddplans, maskfilenm),
+                     stage="folding")
             cands_folded += 1
+    pipe.run()
+    job.set_timers(pipe)
     # Remove the bestprof files
     bpfiles = glob.glob("*.pfd.bestprof")
     for bpfile in bpfiles:
@@ -531,6 +599,10 @@ def main(fits_filenm, workdir, ddplans):
         os.remove(fitsfile)
 
     # Remove the tmp directory (in a tmpfs mount)
+    for passdir in passdirs:
+        try:
+            os.rmdir(passdir)
+        except: pass
     try:
         os.rmdir(tmpdir)
     except: pass
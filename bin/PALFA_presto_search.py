@@ -10,6 +10,7 @@ from presto import psr_utils
 from presto import presto
 from presto import sifting
 from presto import sigproc
+from presto.pipeline import Pipeline, pycall
 
 # Calling convention:
 #
@@ -51,6 +52,9 @@ hi_accel_sigma        = 3.0  # threshold gaussian significance
 hi_accel_zmax         = 50   # bins
 hi_accel_flo          = 1.0  # Hz
 low_T_to_search       = 20.0 # sec
+# Resources for running the processing steps concurrently
+max_cpus              = 0    # CPUs to use (0 = all of them, 1 = serial)
+max_mem_GB            = 0.0  # GB of memory to use (0 = all of it)
 
 # Sifting specific parameters (don't touch without good reason!)
 sifting.sigma_threshold = to_prepfold_sigma-1.0  # incoherent power threshold (sigma)
@@ -131,19 +135,24 @@ def find_closest_subbands(obs, subdms, DM):
     subdm = subdms[numpy.fabs(subdms - DM).argmin()]
     return "subbands/%s_DM%.2f.sub[0-6]*"%(obs.basefilenm, subdm)
 
-def timed_execute(cmd): 
+def rename_file(oldfilenm, newfilenm):
     """
-    timed_execute(cmd):
-        Execute the command 'cmd' after logging the command
-            to STDOUT.  Return the wall-clock amount of time
-            the command took to execute.
+    rename_file(oldfilenm, newfilenm):
+        Rename a file, ignoring any problems.
     """
-    sys.stdout.write("\n'"+cmd+"'\n")
-    sys.stdout.flush()
-    start = time.time()
-    os.system(cmd)
-    end = time.time()
-    return end - start
+    try:
+        os.rename(oldfilenm, newfilenm)
+    except: pass
+
+def remove_files(*filenms):
+    """
+    remove_files(*filenms):
+        Remove files, ignoring any problems.
+    """
+    for filenm in filenms:
+        try:
+            os.remove(filenm)
+        except: pass
 
 def get_folding_command(cand, obs, ddplans):
     """
@@ -261,11 +270,26 @@ class obs_info(object):
         self.sifting_time = 0.0
         self.folding_time = 0.0
         self.total_time = 0.0
+        self.concurrency = 1.0
         # Inialize some candidate counters
         self.num_sifted_cands = 0
         self.num_folded_cands = 0
         self.num_single_cands = 0
 
+    def set_timers(self, pipe):
+        # Get the time spent in each step from the processing pipeline
+        self.rfifind_time = pipe.stage_time("rfifind")
+        self.downsample_time = pipe.stage_time("downsample")
+        self.subbanding_time = pipe.stage_time("subbanding")
+        self.dedispersing_time = pipe.stage_time("dedispersing")
+        self.FFT_time = pipe.stage_time("FFT")
+        self.lo_accelsearch_time = pipe.stage_time("lo_accelsearch")
+        self.hi_accelsearch_time = pipe.stage_time("hi_accelsearch")
+        self.singlepulse_time = pipe.stage_time("singlepulse")
+        self.folding_time = pipe.stage_time("folding")
+        self.concurrency = sum(pipe.stage_times.values()) / pipe.walltime \
+                           if pipe.walltime else 1.0
+
     def write_report(self, filenm):
         report_file = open(filenm, "w")
         report_file.write("---------------------------------------------------------\n")
@@ -275,6 +299,8 @@ class obs_info(object):
                           (self.total_time, self.total_time/3600.0))
         report_file.write("Fraction of data masked:  %.2f%%\n"%\
                           (self.masked_fraction*100.0))
+        report_file.write("Average number of concurrent tasks:  %.2f\n"%\
+                          self.concurrency)
         report_file.write("---------------------------------------------------------\n")
         report_file.write("          rfifind time = %7.1f sec (%5.2f%%)\n"%\
                           (self.rfifind_time, self.rfifind_time/self.total_time*100.0))
@@ -378,26 +404,29 @@ def main(fil_filenm, workdir):
     print("\nBeginning PALFA search of '%s'"%job.fil_filenm)
     print("UTC time is:  %s"%(time.asctime(time.gmtime())))
 
+    # All of the processing steps are tasks in a pipeline, so that
+    # independent steps (e.g. different DMs) can run concurrently
+    pipe = Pipeline(ncpus=max_cpus, mem=max_mem_GB)
+
     # rfifind the filterbank file
     cmd = "rfifind -time %.17g -o %s %s > %s_rfifind.out"%\
           (rfifind_chunk_time, job.basefilenm,
            job.fil_filenm, job.basefilenm)
-    job.rfifind_time += timed_execute(cmd)
+    rfifind = pipe.add("rfifind", cmd, stage="rfifind", io=0.5)
     maskfilenm = job.basefilenm + "_rfifind.mask"
-    # Find the fraction that was suggested to be masked
-    # Note:  Should we stop processing if the fraction is
-    #        above some large value?  Maybe 30%?
-    job.masked_fraction = find_masked_fraction(job)
     
     # Iterate over the stages of the overall de-dispersion plan
     dmstrs = []
+    sp_tasks = []
     for ddplan in ddplans:
 
         # Make a downsampled filterbank file if we are not using subbands
+        ds_deps = []
         if not use_subbands:
             if ddplan.downsamp > 1:
                 cmd = "downsample_filterbank.py %d %s"%(ddplan.downsamp, job.fil_filenm)
-                job.downsample_time += timed_execute(cmd)
+                ds_deps = [pipe.add("downsample_DS%d"%ddplan.downsamp, cmd,
+                                    stage="downsample", io=0.5)]
                 fil_filenm = job.fil_filenm[:job.fil_filenm.find(".fil")] + \
                              "_DS%d.fil"%ddplan.downsamp
             else:
@@ -413,21 +442,24 @@ def main(fil_filenm, workdir):
                       (ddplan.subdmlist[passnum], ddplan.sub_downsamp,
                        ddplan.numsub, maskfilenm, job.basefilenm,
                        job.fil_filenm, subbasenm)
-                job.subbanding_time += timed_execute(cmd)
+                subband = pipe.add("subband_"+subbasenm, cmd, deps=[rfifind],
+                                   stage="subbanding", io=0.5)
             
                 # Now de-disperse using the subbands
                 cmd = "prepsubband -lodm %.2f -dmstep %.2f -numdms %d -downsamp %d -numout %d -o %s subbands/%s.sub[0-9]* > %s.prepout"%\
                       (ddplan.lodm+passnum*ddplan.sub_dmstep, ddplan.dmstep,
                        ddplan.dmsperpass, ddplan.dd_downsamp, job.N/ddplan.downsamp,
                        job.basefilenm, subbasenm, subbasenm)
-                job.dedispersing_time += timed_execute(cmd)
+                dedisp = pipe.add("prepsubband_"+subbasenm, cmd, deps=[subband],
+                                  stage="dedispersing", io=0.25, priority=1)
 
             else:  # Not using subbands
                 cmd = "prepsubband -mask %s -lodm %.2f -dmstep %.2f -numdms %d -numout %d -o %s %s"%\
                       (maskfilenm, ddplan.lodm+passnum*ddplan.sub_dmstep, ddplan.dmstep,
                        ddplan.dmsperpass, job.N/ddplan.downsamp,
                        job.basefilenm, fil_filenm)
-                job.dedispersing_time += timed_execute(cmd)
+                dedisp = pipe.add("prepsubband_"+subbasenm, cmd, deps=[rfifind]+ds_deps,
+                                  stage="dedispersing", io=0.5)
             
             # Iterate over all the new DMs
             for dmstr in ddplan.dmlist[passnum]:
@@ -440,41 +472,46 @@ def main(fil_filenm, workdir):
                 # Do the single-pulse search
                 cmd = "single_pulse_search.py -p -m %f -t %f %s"%\
                       (singlepulse_maxwidth, singlepulse_threshold, datnm)
-                job.singlepulse_time += timed_execute(cmd)
+                sp = pipe.add("singlepulse_"+basenm, cmd, deps=[dedisp],
+                              stage="singlepulse", priority=2)
+                sp_tasks.append(sp)
 
                 # FFT, zap, and de-redden
                 cmd = "realfft %s"%datnm
-                job.FFT_time += timed_execute(cmd)
+                fft = pipe.add("realfft_"+basenm, cmd, deps=[dedisp],
+                               stage="FFT", io=0.25, priority=2)
                 cmd = "zapbirds -zap -zapfile %s -baryv %.6g %s"%\
                       (default_zaplist, job.baryv, fftnm)
-                job.FFT_time += timed_execute(cmd)
+                fft = pipe.add("zapbirds_"+basenm, cmd, deps=[fft],
+                               stage="FFT", priority=2)
                 cmd = "rednoise %s"%fftnm
-                job.FFT_time += timed_execute(cmd)
-                try:
-                    os.rename(basenm+"_red.fft", fftnm)
-                except: pass
+                fft = pipe.add("rednoise_"+basenm, cmd, deps=[fft],
+                               stage="FFT", priority=2)
+                fft = pipe.add("rename_"+basenm,
+                               pycall(rename_file, basenm+"_red.fft", fftnm),
+                               deps=[fft], stage="FFT", priority=2)
                 
                 # Do the low-acceleration search
                 cmd = "accelsearch -locpow -harmpolish -numharm %d -sigma %f -zmax %d -flo %f %s"%\
                       (lo_accel_numharm, lo_accel_sigma, lo_accel_zmax, lo_accel_flo, fftnm)
-                job.lo_accelsearch_time += timed_execute(cmd)
-                try:
-                    os.remove(basenm+"_ACCEL_%d.txtcand"%lo_accel_zmax)
-                except: pass
+                lo = pipe.add("lo_accelsearch_"+basenm, cmd, deps=[fft],
+                              stage="lo_accelsearch", priority=3)
+                lo = pipe.add("lo_txtcand_"+basenm,
+                              pycall(remove_files, basenm+"_ACCEL_%d.txtcand"%lo_accel_zmax),
+                              deps=[lo], stage="lo_accelsearch", priority=3)
         
                 # Do the high-acceleration search
                 cmd = "accelsearch -locpow -harmpolish -numharm %d -sigma %f -zmax %d -flo %f %s"%\
                       (hi_accel_numharm, hi_accel_sigma, hi_accel_zmax, hi_accel_flo, fftnm)
-                job.hi_accelsearch_time += timed_execute(cmd)
-                try:
-                    os.remove(basenm+"_ACCEL_%d.txtcand"%hi_accel_zmax)
-                except: pass
+                hi = pipe.add("hi_accelsearch_"+basenm, cmd, deps=[fft],
+                              stage="hi_accelsearch", priority=3)
+                hi = pipe.add("hi_txtcand_"+basenm,
+                              pycall(remove_files, basenm+"_ACCEL_%d.txtcand"%hi_accel_zmax),
+                              deps=[hi], stage="hi_accelsearch", priority=3)
 
                 # Remove the .dat and .fft files
-                try:
-                    os.remove(datnm)
-                    os.remove(fftnm)
-                except: pass
+                pipe.add("cleanup_"+basenm, pycall(remove_files, datnm, fftnm),
+                         deps=[sp, lo, hi], stage="cleanup", priority=4)
 
     # Make the single-pulse plots
     basedmb = job.basefilenm+"_DM"
@@ -490,14 +527,25 @@ def main(fil_filenm, workdir):
                basedmb+"1[0-9][0-9][0-9].[0-9][0-9]"+basedme]
     dmrangestrs = ["0-110", "100-310", "300-1000+"]
     psname = job.basefilenm+"_singlepulse.ps"
+    # These all write psname, so they are done one at a time
+    plot_deps = sp_tasks
     for dmglob, dmrangestr in zip(dmglobs, dmrangestrs):
         cmd = 'single_pulse_search.py -t %f -g "%s"' % \
               (singlepulse_plot_SNR, dmglob)
-        job.singlepulse_time += timed_execute(cmd)
-        try:
-            os.rename(psname,
-                      job.basefilenm+"_DMs%s_singlepulse.ps"%dmrangestr)
-        except: pass
+        plot = pipe.add("singlepulse_plot_"+dmrangestr, cmd, deps=plot_deps,
+                        stage="singlepulse")
+        plot = pipe.add("singlepulse_plot_rename_"+dmrangestr,
+                        pycall(rename_file, psname,
+                               job.basefilenm+"_DMs%s_singlepulse.ps"%dmrangestr),
+                        deps=[plot], stage="singlepulse")
+        plot_deps = [plot]
+
+    pipe.run()
+
+    # Find the fraction that was suggested to be masked
+    # Note:  Should we stop processing if the fraction is
+    #        above some large value?  Maybe 30%?
+    job.masked_fraction = find_masked_fraction(job)
 
     # Sift through the candidates to choose the best to fold
     
@@ -538,8 +586,11 @@ def main(fil_filenm, workdir):
         if cands_folded == max_cands_to_fold:
             break
         if cand.sigma > to_prepfold_sigma:
-            job.folding_time += timed_execute(get_folding_command(cand, job, ddplans))
+            pipe.add("fold_%d"%cands_folded,
+                     get_folding_command(cand, job, ddplans), stage="folding")
             cands_folded += 1
+    pipe.run()
+    job.set_timers(pipe)
 
     # Now step through the .ps files and convert them to .png and gzip them
 
@@ -0,0 +1,158 @@
+#!/usr/bin/env python
+import sys
+import os
+import re
+import glob
+import argparse
+import numpy as np
+from presto import sifting
+
+accel_re = re.compile(r"ACCEL_\d+(_JERK_\d+)?$")
+
+
+def beam_names(beamdirs):
+    "Unique names for the beams (from their directory names)"
+    names = [os.path.basename(os.path.normpath(d)) for d in beamdirs]
+    if len(set(names)) < len(names):
+        names = ["beam%d" % ii for ii in range(len(beamdirs))]
+    return names
+
+
+def read_singlepulse(filenm):
+    "Return the lines and the event DMs, sigmas and times from a .singlepulse file"
+    lines, vals = [], []
+    with open(filenm) as f:
+        for line in f:
+            if line.startswith("#") or not line.strip():
+                continue
+            lines.append(line)
+            vals.append([float(x) for x in line.split()[:3]])
+    vals = np.asarray(vals).reshape(-1, 3)
+    return lines, vals[:, 0], vals[:, 1], vals[:, 2]
+
+
+def sift_singlepulse(beamdirs, outdirs, nbeams, timetol,
+                     dmtol=2.0, zerodm=5.0, sigmin=6.0):
+    """Remove the single pulse events that have a coincident event in
+    at least 'nbeams'-1 of the other beams.  An event in another beam is
+    coincident if it is within 'timetol' sec, its DM is within 'dmtol'
+    of this event's DM (or both DMs are below 'zerodm', where terrestrial
+    signals peak), and its sigma is at least 'sigmin'.
+    """
+    spfiles = [sorted(glob.glob(os.path.join(d, "*.singlepulse"))) for d in beamdirs]
+    if not any(spfiles):
+        return
+    events = [[read_singlepulse(f) for f in files] for files in spfiles]
+    # The strong enough events of each beam, sorted by time
+    others = []
+    for beamevents in events:
+        dms = np.concatenate([ev[1] for ev in beamevents] + [np.zeros(0)])
+        sigmas = np.concatenate([ev[2] for ev in beamevents] + [np.zeros(0)])
+        times = np.concatenate([ev[3] for ev in beamevents] + [np.zeros(0)])
+        strong = sigmas >= sigmin
+        order = np.argsort(times[strong], kind="stable")
+        others.append((times[strong][order], dms[strong][order]))
+    for ibeam, (files, beamevents) in enumerate(zip(spfiles, events)):
+        numin = numout = 0
+        for filenm, (lines, dms, sigmas, times) in zip(files, beamevents):
+            numbeams = np.ones(len(times), dtype=int)
+            for jbeam, (otimes, odms) in enumerate(others):
+                if jbeam == ibeam or not len(otimes):
+                    continue
+                lo = np.searchsorted(otimes, times - timetol, side="left")
+                hi = np.searchsorted(otimes, times + timetol, side="right")
+                for ii in np.nonzero(hi > lo)[0]:
+                    near = odms[lo[ii]:hi[ii]]
+                    if np.any((np.fabs(near - dms[ii]) <= dmtol) |
+                              ((near < zerodm) & (dms[ii] < zerodm))):
+                        numbeams[ii] += 1
+            good = numbeams < nbeams
+            with open(os.path.join(outdirs[ibeam], os.path.basename(filenm)), "w") as f:
+                f.write("# DM      Sigma      Time (s)     Sample    Downfact\n")
+                for line, isgood in zip(lines, good):
+                    if isgood:
+                        f.write(line)
+            numin += len(lines)
+            numout += good.sum()
+        print("  %s:  kept %d of %d single pulse events" %
+              (outdirs[ibeam], numout, numin))
+
+
+def sift_accel(beamdirs, outdirs, names, nbeams, r_err):
+    """Remove the periodicity candidates that are seen in at least
+    'nbeams' of the beams and write a candlist for each beam.
+    """
+    candfiles = [sorted(f for f in glob.glob(os.path.join(d, "*ACCEL_*"))
+                        if accel_re.search(f)) for d in beamdirs]
+    if not any(candfiles):
+        return
+    candlists = [sifting.read_candidates(files, track=True) if files else
+                 sifting.Candlist(trackbad=True, trackdupes=True)
+                 for files in candfiles]
+    numremoved = sifting.remove_multibeam_candidates(candlists, nbeams, r_err=r_err)
+    for candlist, outdir, name, num in zip(candlists, outdirs, names, numremoved):
+        print("\n%s:  removed %d multibeam candidates" % (name, num))
+        if len(candlist.cands):
+            candlist.remove_duplicate_candidates()
+        candlist.to_file(os.path.join(outdir, "%s.candlist" % name))
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(
+        description="Remove the single pulse events and periodicity candidates "
+        "that are seen in many of the simultaneously recorded beams of a "
+        "multibeam observation (i.e. terrestrial RFI).",
+        epilog="""Each beam's directory holds its *.singlepulse files (from
+single_pulse_search.py) and/or its ACCEL files (from accelsearch).  The
+filtered files are written to <outdir>/<beam>/.  See also 'beamcoinc', which
+masks or zaps the coincident RFI in the data before searching.""",
+    )
+    parser.add_argument("beamdirs", nargs="+", help="The directory for each beam")
+    parser.add_argument(
+        "-n", "--nbeams", type=int, default=None,
+        help="Number of beams a signal must be seen in to be RFI "
+        "(default is more than half of the beams)",
+    )
+    parser.add_argument(
+        "-t", "--timetol", type=float, default=0.01,
+        help="Time (s) that coincident single pulses may differ by (default=0.01)",
+    )
+    parser.add_argument(
+        "-d", "--dmtol", type=float, default=2.0,
+        help="DM (pc/cm^3) that coincident single pulses may differ by (default=2)",
+    )
+    parser.add_argument(
+        "-z", "--zerodm", type=float, default=5.0,
+        help="Single pulses with DMs below this in both beams are always "
+        "coincident (default=5)",
+    )
+    parser.add_argument(
+        "-s", "--sigma", type=float, default=6.0,
+        help="Minimum sigma of a single pulse in another beam to count as "
+        "coincident (default=6)",
+    )
+    parser.add_argument(
+        "-r", "--r_err", type=float, default=sifting.r_err,
+        help="Fourier bins that coincident candidates may differ by (default=%g)"
+        % sifting.r_err,
+    )
+    parser.add_argument(
+        "-o", "--outdir", type=str, default="multibeam",
+        help="Output directory (default='multibeam')",
+    )
+    args = parser.parse_args()
+
+    numbeams = len(args.beamdirs)
+    nbeams = numbeams // 2 + 1 if args.nbeams is None else args.nbeams
+    if numbeams < 2 or nbeams < 2 or nbeams > numbeams:
+        sys.stderr.write("\nError:  need 2 <= nbeams (%d) <= number of beams (%d)\n\n"
+                         % (nbeams, numbeams))
+        sys.exit(1)
+    names = beam_names(args.beamdirs)
+    outdirs = [os.path.join(args.outdir, name) for name in names]
+    for outdir in outdirs:
+        os.makedirs(outdir, exist_ok=True)
+    print("Rejecting signals seen in %d or more of %d beams" % (nbeams, numbeams))
+    sift_singlepulse(args.beamdirs, outdirs, nbeams, args.timetol,
+                     args.dmtol, args.zerodm, args.sigma)
+    sift_accel(args.beamdirs, outdirs, names, nbeams, args.r_err)
@@ -0,0 +1,47 @@
+#!/usr/bin/env python
+import sys
+import json
+import argparse
+from presto.pipeline import Pipeline, PipelineError
+
+# Run a DAG of commands described in a JSON file.  The file is a list
+# of tasks (in the order their output should be printed) like:
+#
+# [{"name": "fft10", "cmd": "realfft DM10.00.dat", "stage": "FFT", "io": 0.5},
+#  {"name": "acc10", "cmd": "accelsearch -zmax 50 DM10.00.fft",
+#   "deps": ["fft10"], "stage": "accelsearch", "priority": 1, "retries": 1}]
+#
+# with optional "cpus", "mem" (GB), "io" (0-1), "priority", "retries",
+# "stage", and "fatal" keys (see presto.pipeline.Task).  Tasks can only
+# depend on tasks that come before them in the list.
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(
+        description="Run PRESTO commands concurrently within a node's resources")
+    parser.add_argument("taskfile", type=str,
+                        help="JSON file with the list of tasks")
+    parser.add_argument("--ncpus", type=int, default=0,
+                        help="Number of CPUs to use (default is all of them)")
+    parser.add_argument("--mem", type=float, default=0.0,
+                        help="GB of memory to use (default is all of it)")
+    parser.add_argument("--io", type=float, default=1.0,
+                        help="Disk bandwidth units to use (default 1)")
+    parser.add_argument("--serial", default=False, action="store_true",
+                        help="Run the tasks one at a time (like --ncpus 1)")
+    args = parser.parse_args()
+
+    with open(args.taskfile) as f:
+        tasklist = json.load(f)
+    pipe = Pipeline(ncpus=1 if args.serial else args.ncpus,
+                    mem=args.mem, io=args.io)
+    for task in tasklist:
+        task = dict(task)
+        name, cmd = task.pop("name"), task.pop("cmd")
+        pipe.add(name, cmd, deps=task.pop("deps", []), **task)
+    try:
+        pipe.run()
+    except PipelineError as e:
+        sys.stderr.write("Error:  %s\n" % e)
+    print("")
+    pipe.write_timings()
+    sys.exit(1 if pipe.failed else 0)
@@ -1,6 +1,7 @@
 #include <glib.h>
 #include "presto.h"
 #include "accelsearch_cmd.h"
+#include "accelcols.h"
 
 // ACCEL_USELEN must be less than 65536 since we
 // use unsigned short ints to index our arrays...
@@ -29,6 +30,10 @@
 #define ACCEL_DW 20
 /* Reciprocal of ACCEL_DW */
 #define ACCEL_RDW 0.05
+/* Stepsize in Fourier F-dot of the coarse pass of a hierarchical search */
+#define HIER_DZ  (2 * ACCEL_DZ)
+/* Stepsize in Fourier F-dot-dot of the coarse pass of a hierarchical search */
+#define HIER_DW  (2 * ACCEL_DW)
 /* Closest candidates we will accept as independent */
 #define ACCEL_CLOSEST_R 15.0
 /* Padding for .dat file reading so that we don't SEGFAULT */
@@ -43,11 +48,13 @@ typedef struct accelobs{
     int corr_uselen;     /* Number of good data points we will get from high-harm correlations */
     int fftlen;          /* Length of short FFTs to us in search */
     int numharmstages;   /* Number of stages of harmonic summing */
+    int allharm;         /* Sum every number of harmonics (1, 2, 3, ...), not just powers-of-two */
     int numz;            /* Number of f-dots searched */
     int numw;            /* Number of f-dot-dots searched */
     int numbetween;      /* Highest fourier freq resolution (2=interbin) */
     int numzap;          /* Number of birdies to zap */
     int dat_input;       /* The input file is a short time series */
+    int topo2bary;       /* Also write barycentric versions of the candidates */
     int mmap_file;       /* The file number if using MMAP */
     int inmem;           /* True if we want to keep the full f-fdot plane in RAM */
     int norm_type;       /* 0 = old-style block median, 1 = local-means power norm */
@@ -63,6 +70,7 @@ typedef struct accelobs{
     double whi;          /* Maximum fourier f-dot-dot to search */
     double dw;           /* Stepsize in fourier f-dot-dot */
     double baryv;        /* Average barycentric velocity during observation */
+    double baryderivs[4];/* Doppler derivs (see doppler_derivs()) if topo2bary */
     float nph;            /* Freq 0 level if requested, 0 otherwise */
     float sigma;          /* Cutoff sigma to choose a candidate */
     float *powcut;        /* Cutoff powers to choose a cand (per harmsummed) */
@@ -78,6 +86,13 @@ typedef struct accelobs{
     char *accelnm;       /* The filename of the final candidates in text */
     char *workfilenm;    /* The filename of the working candidates in text */
     int use_harmonic_polishing; /* Should we force harmonics to be related */
+    int numseg;          /* Number of segments for a semi-coherent search (1 = coherent) */
+    long long seglen;    /* Number of data points in each segment */
+    fcomplex **segffts;  /* The de-reddened FFTs of each of the segments */
+    float hierfrac;      /* Coarse pass cutoff (fraction of powcut) if hierarchical, else 0 */
+    double winlen;       /* Length (s) of the shortest windows of a windowed search (0 = none) */
+    int numwinlens;      /* Number of window lengths (each twice the previous) */
+    float *tseries;      /* The time series (for a windowed search) */
 } accelobs;
 
 typedef struct accelcand{
@@ -131,8 +146,14 @@ typedef struct ffdotpows{
 
 /* accel_utils.c */
 
+int stage_numharm(accelobs *obs, int stage);
+int numharm_stage(accelobs *obs, int numharm);
+int new_subharmonic(int numharm, int harmnum);
+void init_kernel(int z, int w, int numbetween, int fftlen, kernel *kern);
+kernel **gen_kernmatrix(int numz, int numw);
 subharminfo **create_subharminfos(accelobs *obs);
 void free_subharminfos(accelobs *obs, subharminfo **shis);
+void calc_accel_powcuts(accelobs *obs, double trialsfact);
 void create_accelobs(accelobs *obs, infodata *idata, 
 		     Cmdline *cmd, int usemmap);
 GSList *sort_accelcands(GSList *list);
@@ -142,9 +163,14 @@ void optimize_accelcand(accelcand *cand, accelobs *obs);
 void output_fundamentals(fourierprops *props, GSList *list, 
 			 accelobs *obs, infodata *idata);
 void output_harmonics(GSList *list, accelobs *obs, infodata *idata);
+void output_bary_cands(fourierprops *props, GSList *list,
+                       accelobs *obs, infodata *idata);
+void output_accelcols(fourierprops *props, GSList *list,
+                      accelobs *obs, infodata *idata);
 void free_accelcand(gpointer data, gpointer user_data);
 void print_accelcand(gpointer data, gpointer user_data);
 fcomplex *get_fourier_amplitudes(long long lobin, int numbins, accelobs *obs);
+fcomplex *get_normalized_amplitudes(long long lobin, int numdata, accelobs *obs);
 ffdotpows *subharm_fderivs_vol(int numharm, int harmnum, 
 			       double fullrlo, double fullrhi, 
 			       subharminfo *shi, accelobs *obs);
@@ -162,4 +188,38 @@ void add_ffdotpows(ffdotpows *fundamental, ffdotpows *subharmonic,
                    int numharm, int harmnum);
 GSList *search_ffdotpows(ffdotpows *ffdot, int numharm, 
                          accelobs *obs, GSList *cands);
+GSList *insert_new_accelcand(GSList *list, float power, float sigma,
+                             int numharm, double rr, double zz, double ww,
+                             int *added);
 void free_accelobs(accelobs *obs);
+
+/* accel_stackslide.c */
+
+void prep_stackslide_segments(float *data, long long numdata, accelobs *obs);
+long long stackslide_numindep(accelobs *obs);
+GSList *stackslide_search(accelobs *obs, GSList *cands);
+void free_stackslide_segments(accelobs *obs);
+
+/* accel_windows.c */
+
+void prep_accel_windows(float *data, long long numdata, accelobs *obs);
+int accel_windows_search(accelobs *obs, infodata *idata, Cmdline *cmd);
+void free_accel_windows(accelobs *obs);
+
+/* accel_hier.c */
+
+subharminfo **create_coarse_subharminfos(accelobs *obs, subharminfo **shis);
+ffdotpows *coarse_fderivs_vol(int numharm, int harmnum,
+                              double fullrlo, double fullrhi,
+                              subharminfo *shi, subharminfo *cshi,
+                              accelobs *obs);
+char *hier_coarse_search(accelobs *obs, subharminfo **shis, int *numrefine);
+
+/* accel_search.c */
+
+void zap_accel_birdies(accelobs *obs, Cmdline *cmd);
+int same_subharminfos(accelobs *obs1, accelobs *obs2);
+GSList *search_accelobs(accelobs *obs, subharminfo **subharminfs,
+                        Cmdline *cmd, GSList *cands);
+int output_accelobs_cands(GSList **cands, accelobs *obs,
+                          infodata *idata, Cmdline *cmd);
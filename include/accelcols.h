@@ -0,0 +1,108 @@
+#ifndef ACCELCOLS_DEFINED
+
+/* Columnar binary candidate files ("ACCEL_<zmax>[_JERK_<wmax>].cols")   */
+/*                                                                       */
+/* accelsearch writes one of these next to its text ACCEL file.  It      */
+/* holds the same information as the text file, but as binary columns   */
+/* that can be memory-mapped and used in place (from C with              */
+/* read_accelcols() or Python with presto.accelcols), which is much      */
+/* faster than parsing the text files when sifting large searches.       */
+/*                                                                       */
+/* Layout (native byte order, which is given by 'byteorder'):            */
+/*                                                                       */
+/*   accelcols_header            128 bytes                               */
+/*   accelcol_desc[numcols]      40 bytes each                           */
+/*   column data                 each column starts on an 8-byte         */
+/*                               boundary at accelcol_desc.offset        */
+/*                                                                       */
+/* Columns are found by name, so readers should ignore columns they do   */
+/* not know about.  New columns can be added without changing the        */
+/* version, which only changes if the existing layout does.              */
+/*                                                                       */
+/* Candidate columns (length numcands):                                  */
+/*   sigma, power, cpow    float   Sigma, summed and coherent power      */
+/*   numharm               int     Number of harmonics summed            */
+/*   r, z, w               double  Fourier freq, f-dot, f-dot-dot (bins) */
+/*   rerr, zerr, werr      float   Their errors                          */
+/*   period, perr          double  Period and error (s)                  */
+/*   freq, freqerr         double  Frequency and error (Hz)              */
+/*   fdot, fdoterr         double  Freq derivative and error (Hz/s)      */
+/*   accel, accelerr       double  Line-of-sight acceleration (m/s^2)    */
+/*   harmstart             int64   Index of the first harmonic           */
+/*                                                                       */
+/* Harmonic columns (length numharms, harmonics of candidate 'i' are     */
+/* at harmstart[i] to harmstart[i] + numharm[i] - 1):                    */
+/*   h_pow, h_powerr       float   Normalized power and error            */
+/*   h_rawpow              float   Raw power                             */
+/*   h_sigma               float   Sigma of the single harmonic          */
+/*   h_r, h_z, h_w         double  Optimized r, z, and w (bins)          */
+/*   h_rerr, h_zerr,       float   Their errors                          */
+/*     h_werr                                                            */
+/*   h_phs, h_phserr       float   Phase and error (rad)                 */
+/*   h_cen, h_cenerr       float   Centroid and error                    */
+/*   h_pur, h_purerr       float   Purity and error                      */
+/*   h_locpow              float   Local power level                     */
+
+#define ACCELCOLS_MAGIC    "PRESTOAC"
+#define ACCELCOLS_VERSION  1
+#define ACCELCOLS_BYTEORDER 0x01020304
+
+typedef enum {
+    ACCELCOL_INT32 = 1, ACCELCOL_INT64, ACCELCOL_FLOAT32, ACCELCOL_FLOAT64
+} accelcol_type;
+
+typedef struct ACCELCOLS_HEADER {
+    char magic[8];       /* ACCELCOLS_MAGIC (not NULL terminated)       */
+    int version;         /* ACCELCOLS_VERSION                           */
+    int byteorder;       /* ACCELCOLS_BYTEORDER as written              */
+    long long numcands;  /* Number of candidates                        */
+    long long numharms;  /* Total number of harmonics of all candidates */
+    double T;            /* Duration of the searched data (s)           */
+    double dt;           /* Sample time of the time series (s)          */
+    double N;            /* Number of points in the time series         */
+    double dm;           /* Dispersion measure of the time series       */
+    int numcols;         /* Number of column descriptors                */
+    int zmax;            /* Max Fourier f-dot searched (bins)           */
+    int wmax;            /* Max Fourier f-dot-dot searched (bins)       */
+    int numharm;         /* Max number of harmonics summed              */
+    int reserved[12];    /* Zeros                                       */
+} accelcols_header;
+
+typedef struct ACCELCOL_DESC {
+    char name[16];       /* NULL terminated column name                 */
+    int type;            /* An accelcol_type                            */
+    int reserved;        /* Zero                                        */
+    long long length;    /* Number of values                            */
+    long long offset;    /* Byte offset of the values in the file       */
+} accelcol_desc;
+
+typedef struct ACCELCOLS {
+    accelcols_header *hdr;      /* Points into the mapped file          */
+    accelcol_desc *cols;        /* Points into the mapped file          */
+    void *map;                  /* The mapped file                      */
+    size_t maplen;              /* Length of the mapping                */
+} accelcols;
+
+#define ACCELCOLS_DEFINED
+#endif
+
+/* In accelcols.c */
+
+void write_accelcols(char *filenm, accelcols_header * hdr,
+                     accelcol_desc * cols, void **data);
+/* Write a columnar candidate file.  'hdr' must have everything but */
+/* the magic, version, and byteorder set.  'cols' has the names,     */
+/* types, and lengths of the hdr->numcols columns (the offsets are   */
+/* computed) and 'data' has pointers to the values of each column.   */
+
+void read_accelcols(char *filenm, accelcols * ac);
+/* Memory-map the columnar candidate file 'filenm' into 'ac'. */
+
+void *accelcols_column(accelcols * ac, char *name, accelcol_type type,
+                       long long *length);
+/* Return a pointer to the values of column 'name' (which must be of */
+/* 'type') of the mapped file 'ac', and its length in 'length'.      */
+/* Return NULL if there is no such column.                           */
+
+void free_accelcols(accelcols * ac);
+/* Unmap a file mapped with read_accelcols(). */
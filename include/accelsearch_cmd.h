@@ -17,10 +17,12 @@ typedef struct s_Cmdline {
   char lobinP;
   int lobin;
   int lobinC;
-  /***** -numharm: The number of harmonics to sum (power-of-two) */
+  /***** -numharm: The number of harmonics to sum (power-of-two unless -allharm) */
   char numharmP;
   int numharm;
   int numharmC;
+  /***** -allharm: Sum every number of harmonics from 1 to numharm, not just powers-of-two */
+  char allharmP;
   /***** -zmax: The max (+ and -) Fourier freq deriv to search */
   char zmaxP;
   int zmax;
@@ -29,6 +31,18 @@ typedef struct s_Cmdline {
   char wmaxP;
   int wmax;
   int wmaxC;
+  /***** -numseg: Number of segments for a semi-coherent (StackSlide) search of a .[s]dat file */
+  char numsegP;
+  int numseg;
+  int numsegC;
+  /***** -winlen: Length (s) of the shortest time windows (overlapping by half) for a windowed search of a .[s]dat file */
+  char winlenP;
+  double winlen;
+  int winlenC;
+  /***** -numwinlens: Number of window lengths for -winlen (each twice as long as the previous) */
+  char numwinlensP;
+  int numwinlens;
+  int numwinlensC;
   /***** -sigma: Cutoff sigma for choosing candidates */
   char sigmaP;
   float sigma;
@@ -51,6 +65,12 @@ typedef struct s_Cmdline {
   int fhiC;
   /***** -inmem: Compute full f-fdot plane in memory.  Very fast, but only for short time series. */
   char inmemP;
+  /***** -hier: Do a coarse-to-fine (hierarchical) search that only searches near coarse candidates at full resolution */
+  char hierP;
+  /***** -hierfrac: Coarse candidate cutoff for -hier (fraction of the signal power of the full cutoff).  Smaller is more sensitive but slower */
+  char hierfracP;
+  float hierfrac;
+  int hierfracC;
   /***** -photon: Data is poissonian so use freq 0 as power normalization */
   char photonP;
   /***** -median: Use block-median power normalization (default) */
@@ -65,6 +85,8 @@ typedef struct s_Cmdline {
   char baryvP;
   double baryv;
   int baryvC;
+  /***** -topo2bary: Also write barycentric versions of the candidates from a topocentric search */
+  char topo2baryP;
   /***** -otheropt: Use the alternative optimization (for testing/debugging) */
   char otheroptP;
   /***** -noharmpolish: Do not use 'harmpolish' by default */
@@ -5,7 +5,7 @@
 
 typedef enum {
     SIGPROCFB, PSRFITS, SCAMP, BPP, WAPP, SPIGOT, \
-    SUBBAND, DAT, SDAT, EVENTS, UNSET
+    SUBBAND, DAT, SDAT, EVENTS, BASEBAND, SHMRING, UNSET
 } psrdatatype;
 
 
@@ -69,6 +69,8 @@ struct spectra_info {
     int use_poln;           // The number of the specific polarization to use 0-num_polns-1
     int flip_bytes;         // Hack to flip the order of the bits in a byte of data
     int num_ignorechans;    // Number of channels to explicitly ignore (set to zero)
+    int tscrunch;           // Number of spectra to sum as the raw data are read
+    int fscrunch;           // Number of channels to sum as the raw data are read
     float zero_offset;      // A DC zero-offset value to apply to all the data
     float clip_sigma;       // Clipping value in standard deviations to use
     long double *start_MJD; // Array of long double MJDs for the file starts
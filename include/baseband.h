@@ -0,0 +1,35 @@
+#include "backend_common.h"
+
+/* Complex baseband voltages in DADA format.  The data are coherently */
+/* dedispersed (within each output channel), channelized, and         */
+/* detected as they are read, so that they look like normal           */
+/* filterbank data to the rest of PRESTO.                             */
+
+typedef struct DADAHDR {
+  char source[80];       /* SOURCE: Source name */
+  char telescope[80];    /* TELESCOPE: Telescope name */
+  char instrument[80];   /* INSTRUMENT: Backend name */
+  char ra_str[40];       /* RA: J2000 Right Ascension (HH:MM:SS.SSSS) */
+  char dec_str[40];      /* DEC: J2000 Declination (DD:MM:SS.SSSS) */
+  char utc_start[40];    /* UTC_START: Start time (YYYY-MM-DD-HH:MM:SS) */
+  char order[8];         /* ORDER: Order of the samples (only TFP) */
+  double freq;           /* FREQ: Center frequency of the band (MHz) */
+  double bw;             /* BW: Bandwidth (MHz, < 0 if the band is inverted) */
+  double tsamp;          /* TSAMP: Sample time (us) */
+  double mjd_start;      /* MJD_START: Start MJD (if no UTC_START) */
+  double dm;             /* DM: Dispersion measure to coherently remove */
+  long long obs_offset;  /* OBS_OFFSET: Bytes since the start of the obs */
+  long long file_size;   /* FILE_SIZE: Bytes of data in the file */
+  long long picoseconds; /* PICOSECONDS: Added to UTC_START */
+  int hdr_size;          /* HDR_SIZE: Bytes in the ASCII header */
+  int nchan;             /* NCHAN: Number of (coarse) channels */
+  int npol;              /* NPOL: Number of polarizations */
+  int nbit;              /* NBIT: Bits per real or imaginary value */
+  int ndim;              /* NDIM: 2 for complex samples */
+} dadahdr;
+
+/* baseband.c */
+int read_dada_header(dadahdr * hdr, FILE * inputfile);
+void read_baseband_files(struct spectra_info *s);
+long long offset_to_baseband_spectra(long long specnum, struct spectra_info *s);
+int get_baseband_rawblock(float *fdata, struct spectra_info *s, int *padding);
@@ -0,0 +1,71 @@
+#ifndef __beamcoinc_cmd__
+#define __beamcoinc_cmd__
+/*****
+  command line parser interface -- generated by clig
+  (http://wsd.iitb.fhg.de/~geg/clighome/)
+
+  The command line parser `clig':
+  (C) 1995-2004 Harald Kirsch (clig@geggus.net)
+*****/
+
+typedef struct s_Cmdline {
+  /***** -ncpus: Number of processors to use with OpenMP */
+  char ncpusP;
+  int ncpus;
+  int ncpusC;
+  /***** -nbeams: The number of beams a signal must be seen in to be RFI (default is more than half of the beams) */
+  char nbeamsP;
+  int nbeams;
+  int nbeamsC;
+  /***** -mbsig: The +/-sigma cutoff for a signal in a single beam to count towards a coincidence */
+  char mbsigmaP;
+  float mbsigma;
+  int mbsigmaC;
+  /***** -timesig: The +/-sigma cutoff to reject time-domain chunks in each beam by itself (as in rfifind) */
+  char timesigmaP;
+  float timesigma;
+  int timesigmaC;
+  /***** -freqsig: The +/-sigma cutoff to reject freq-domain chunks in each beam by itself (as in rfifind) */
+  char freqsigmaP;
+  float freqsigma;
+  int freqsigmaC;
+  /***** -chanfrac: The fraction of bad channels that will mask a full interval */
+  char chantrigfracP;
+  float chantrigfrac;
+  int chantrigfracC;
+  /***** -intfrac: The fraction of bad intervals that will mask a full channel */
+  char inttrigfracP;
+  float inttrigfrac;
+  int inttrigfracC;
+  /***** -time: Seconds to integrate for stats and FFT calcs of '.dat' files */
+  char timeP;
+  double time;
+  int timeC;
+  /***** -normlen: Number of Fourier bins in each block of the '.fft' files normalized by its median power */
+  char normlenP;
+  int normlen;
+  int normlenC;
+  /***** -binerr: Number of Fourier bins that coincident signals in the '.fft' files may differ by */
+  char binerrP;
+  int binerr;
+  int binerrC;
+  /***** -o: Suffix added to each beam's root name for its output files */
+  char suffixP;
+  char* suffix;
+  int suffixC;
+  /***** uninterpreted command line parameters */
+  int argc;
+  /*@null*/char **argv;
+  /***** the whole command line concatenated */
+  char *full_cmd_line;
+} Cmdline;
+
+
+extern char *Program;
+extern void usage(void);
+extern /*@shared*/Cmdline *parseCmdline(int argc, char **argv);
+
+extern void showOptionValues(void);
+
+#endif
+
@@ -9,6 +9,25 @@
 #include <stdlib.h>
 #include <unistd.h>
 #include <errno.h>
+#include "presto_error.h"
+
+/* The chk*() routines call presto_error() if something goes wrong */
+/* (see presto_error.h).  The try_*() versions return the status   */
+/* (PRESTO_OK if successful) instead.                              */
+
+presto_status try_fopen(char *path, const char *mode, FILE **file);
+/* Open a file, returning it in 'file'.  Check errno on failure.  */
+
+presto_status try_fread(void *data, size_t type, size_t number, FILE *stream,
+                        size_t *numread);
+/* Read from a file, placing the number of items read in 'numread'. */
+/* A short read without an I/O error returns PRESTO_ERR_EOF.        */
+
+presto_status try_fwrite(void *data, size_t type, size_t number, FILE *stream);
+/* Write 'number' items to a file.  */
+
+presto_status try_fileseek(FILE *stream, off_t offset, size_t size, int whence);
+/* Seek in a file (offset in blocks of 'size').  */
 
 FILE *chkfopen(char *path, const char *mode);
 /* Preform a file open with error checking.  */
@@ -1,4 +1,4 @@
-/* Number of entries in PSR database */
+/* Initial number of entries in PSR database (it grows as needed) */
 #define NP  5000
 #define NBP 600
 
@@ -55,6 +55,7 @@ typedef struct PSRPARAMS {
 
 int read_database(void);
 /* Reads the full pulsar database into the static array psrdata */
+/* (or the psrcat text dump named by $PSRCAT_FILE, if set).       */
 
 void get_psrparams(psrparams *psr, char *psrname);
 /* Read a full pulsar database entry for pulsar psrname. */
@@ -0,0 +1,71 @@
+#ifndef __ddbench_cmd__
+#define __ddbench_cmd__
+/*****
+  command line parser interface -- generated by clig
+  (http://wsd.iitb.fhg.de/~geg/clighome/)
+
+  The command line parser `clig':
+  (C) 1995-2004 Harald Kirsch (clig@geggus.net)
+*****/
+
+typedef struct s_Cmdline {
+  /***** -ncpus: Number of processors to use with OpenMP */
+  char ncpusP;
+  int ncpus;
+  int ncpusC;
+  /***** -numchan: Number of channels in the (synthetic) raw data */
+  char numchanP;
+  int numchan;
+  int numchanC;
+  /***** -nsub: Number of subbands to time */
+  char nsubP;
+  int nsub;
+  int nsubC;
+  /***** -blocklen: Spectra per subint (block) of raw data */
+  char blocklenP;
+  int blocklen;
+  int blocklenC;
+  /***** -downsamp: Subband downsampling factor to time */
+  char downsampP;
+  int downsamp;
+  int downsampC;
+  /***** -numdms: Number of DMs to de-disperse for the de-dispersion timing */
+  char numdmsP;
+  int numdms;
+  int numdmsC;
+  /***** -fftlen: Length of the real FFTs to time */
+  char fftlenP;
+  int fftlen;
+  int fftlenC;
+  /***** -clip: Time-domain sigma to use for clipping when subbanding (0.0 = no clipping, 6.0 = default */
+  char clipP;
+  float clip;
+  int clipC;
+  /***** -seconds: Approximate time (s) to spend timing each kernel */
+  char secondsP;
+  double seconds;
+  int secondsC;
+  /***** -o: Write the costs to this file (default is stdout) */
+  char outfileP;
+  char* outfile;
+  int outfileC;
+  /***** -filterbank: Raw data in SIGPROC filterbank format */
+  char filterbankP;
+  /***** -psrfits: Raw data in PSRFITS format */
+  char psrfitsP;
+  /***** uninterpreted command line parameters */
+  int argc;
+  /*@null*/char **argv;
+  /***** the whole command line concatenated */
+  char *full_cmd_line;
+} Cmdline;
+
+
+extern char *Program;
+extern void usage(void);
+extern /*@shared*/Cmdline *parseCmdline(int argc, char **argv);
+
+extern void showOptionValues(void);
+
+#endif
+
@@ -0,0 +1,60 @@
+#ifndef FFACAND_DEFINED
+typedef struct FFACAND {
+    double period;     /* Folding period (s)                          */
+    double dt;         /* Sample time of the folded data (s)          */
+    float snr;         /* Boxcar S/N of the folded profile            */
+    float sigma;       /* Gaussian significance including trials      */
+    float phase;       /* Phase [0-1] of the start of the boxcar      */
+    int width;         /* Best boxcar width (profile bins)            */
+    int numbins;       /* Number of bins in the folded profile        */
+} ffacand;
+#define FFACAND_DEFINED
+#endif
+
+/* In ffa.c */
+
+void ffa_transform(float *data, int numrows, int numbins, float *result);
+/* Compute the Fast Folding Algorithm transform of 'data', which is  */
+/* 'numrows' consecutive pulse periods of 'numbins' bins each.  Row  */
+/* 's' of 'result' (also numrows x numbins) is the sum of all the    */
+/* rows after row 'k' has been shifted by k * s / (numrows - 1)      */
+/* bins, i.e. the profile folded at a period of numbins + s /        */
+/* (numrows - 1) bins.  'numrows' does not need to be a power-of-2.  */
+
+long ffa_downsample(float *indata, long numin, double factor, float *outdata);
+/* Sum 'indata' into bins that are 'factor' (which may be fractional, */
+/* but must be >= 1) input samples long.  Partial samples are split   */
+/* linearly between output bins.  Returns the number of output bins.  */
+
+void ffa_detrend(float *data, long numdata, long blocklen);
+/* Remove a running median from 'data' (using the medians of blocks */
+/* of 'blocklen' points, linearly interpolated between the blocks)  */
+/* and then normalize the data to unit standard deviation.          */
+
+float ffa_boxcar_snr(float *prof, int numbins, int *widths, int numwidths,
+                     double stdev, int *bestwidth, int *bestbin);
+/* Return the highest boxcar S/N of the (cyclic) profile 'prof' for  */
+/* each of the 'numwidths' boxcar 'widths'.  Each profile bin has a  */
+/* noise standard deviation of 'stdev'.  The width and starting bin  */
+/* of the best boxcar are returned in 'bestwidth' and 'bestbin'.     */
+
+int *ffa_widths(int maxwidth, int *numwidths);
+/* Return a vector of roughly logarithmically spaced boxcar widths */
+/* (1, 2, 3, 4, 6, 9, ...) up to 'maxwidth' bins.                  */
+
+ffacand *ffa_search(float *data, long numdata, double dt,
+                    double pmin, double pmax, int bmin, int bmax,
+                    double maxduty, float snrmin, int *numcands);
+/* Search the detrended and normalized time series 'data' (see     */
+/* ffa_detrend()) with a sample time of 'dt' for periodic signals  */
+/* with periods between 'pmin' and 'pmax' seconds.  The data are   */
+/* downsampled by octaves so that the profiles always have between */
+/* 'bmin' and 'bmax' bins, and boxcars up to 'maxduty' of a period */
+/* are checked.  The FFAs of the different profile lengths are     */
+/* done in parallel.  The detections with S/N >= 'snrmin' are      */
+/* clustered into candidates which are returned (sorted by S/N)    */
+/* and their number placed in 'numcands'.                          */
+
+double ffa_sigma(double snr, double numtrials);
+/* Return the Gaussian significance of a boxcar S/N of 'snr' */
+/* after correcting for 'numtrials' independent trials.      */
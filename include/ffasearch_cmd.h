@@ -0,0 +1,63 @@
+#ifndef __ffasearch_cmd__
+#define __ffasearch_cmd__
+/*****
+  command line parser interface -- generated by clig
+  (http://wsd.iitb.fhg.de/~geg/clighome/)
+
+  The command line parser `clig':
+  (C) 1995-2004 Harald Kirsch (clig@geggus.net)
+*****/
+
+typedef struct s_Cmdline {
+  /***** -ncpus: Number of processors to use with OpenMP */
+  char ncpusP;
+  int ncpus;
+  int ncpusC;
+  /***** -pmin: Shortest period to search (s) */
+  char pminP;
+  double pmin;
+  int pminC;
+  /***** -pmax: Longest period to search (s) */
+  char pmaxP;
+  double pmax;
+  int pmaxC;
+  /***** -bmin: Minimum number of bins in the folded profiles */
+  char bminP;
+  int bmin;
+  int bminC;
+  /***** -bmax: Maximum number of bins in the folded profiles (the data are downsampled by bmax/bmin per octave) */
+  char bmaxP;
+  int bmax;
+  int bmaxC;
+  /***** -maxduty: Widest boxcar to test as a fraction of the period */
+  char maxdutyP;
+  double maxduty;
+  int maxdutyC;
+  /***** -rmed: Width (s) of the running median used to remove red noise (default is 4 * pmax) */
+  char rmedP;
+  double rmed;
+  int rmedC;
+  /***** -snr: Minimum boxcar S/N of the candidates to keep */
+  char snrP;
+  float snr;
+  int snrC;
+  /***** -numcands: Maximum number of candidates to return */
+  char numcandsP;
+  int numcands;
+  int numcandsC;
+  /***** uninterpreted command line parameters */
+  int argc;
+  /*@null*/char **argv;
+  /***** the whole command line concatenated */
+  char *full_cmd_line;
+} Cmdline;
+
+
+extern char *Program;
+extern void usage(void);
+extern /*@shared*/Cmdline *parseCmdline(int argc, char **argv);
+
+extern void showOptionValues(void);
+
+#endif
+
@@ -0,0 +1,75 @@
+#ifndef __get_toas_cmd__
+#define __get_toas_cmd__
+/*****
+  command line parser interface -- generated by clig
+  (http://wsd.iitb.fhg.de/~geg/clighome/)
+
+  The command line parser `clig':
+  (C) 1995-2004 Harald Kirsch (clig@geggus.net)
+*****/
+
+typedef struct s_Cmdline {
+  /***** -ncpus: Number of processors to use with OpenMP */
+  char ncpusP;
+  int ncpus;
+  int ncpusC;
+  /***** -n: Divide each fold into this many parts in time */
+  char numtoasP;
+  int numtoas;
+  int numtoasC;
+  /***** -s: Divide each fold into this many subbands */
+  char numsubP;
+  int numsub;
+  int numsubC;
+  /***** -dm: Re-combine the subbands at this DM (0.0 uses the fold DM) */
+  char dmP;
+  double dm;
+  int dmC;
+  /***** -t: The template .bestprof (or single column ASCII) profile to use */
+  char templateP;
+  char* template;
+  int templateC;
+  /***** -g: Use a Gaussian template of this FWHM (in phase) if no template is given */
+  char gaussianP;
+  double gaussian;
+  int gaussianC;
+  /***** -killsubs: Comma separated string (no spaces!) of subbands to explicitly remove from analysis (i.e. zero out).  Ranges are specified by min:max[:step] */
+  char killsubsstrP;
+  char* killsubsstr;
+  int killsubsstrC;
+  /***** -killparts: Comma separated string (no spaces!) of intervals to explicitly remove from analysis (i.e. zero-out).  Ranges are specified by min:max[:step] */
+  char killpartsstrP;
+  char* killpartsstr;
+  int killpartsstrC;
+  /***** -o: Add this offset in seconds to all of the TOAs */
+  char offsetP;
+  double offset;
+  int offsetC;
+  /***** -events: The folded data were events instead of samples or bins */
+  char eventsP;
+  /***** -norotate: Do not rotate the template for FFTFIT */
+  char norotateP;
+  /***** -center: Rotate the template so that its maximum is in bin 0 (implies -norotate) */
+  char centerP;
+  /***** -tempo2: Write Tempo2 format TOAs */
+  char tempo2P;
+  /***** -phase: Include the FFTFIT phase and error in the TOA flags (implies -tempo2) */
+  char phaseP;
+  /***** -fftfit: Print all of the FFTFIT outputs and errors to STDERR */
+  char fftfitoutsP;
+  /***** uninterpreted command line parameters */
+  int argc;
+  /*@null*/char **argv;
+  /***** the whole command line concatenated */
+  char *full_cmd_line;
+} Cmdline;
+
+
+extern char *Program;
+extern void usage(void);
+extern /*@shared*/Cmdline *parseCmdline(int argc, char **argv);
+
+extern void showOptionValues(void);
+
+#endif
+
@@ -0,0 +1,37 @@
+#ifndef LSCAND_DEFINED
+/* The most harmonics that are summed in a Lomb-Scargle search */
+#define LS_MAXHARM 32
+
+typedef struct LSCAND {
+    double freq;       /* Fundamental frequency (Hz)                  */
+    float power;       /* Summed normalized power of the harmonics    */
+    float sigma;       /* Gaussian significance including trials      */
+    int numharm;       /* Number of harmonics summed                  */
+    float harmpows[LS_MAXHARM]; /* Normalized powers of the harmonics */
+} lscand;
+#define LSCAND_DEFINED
+#endif
+
+/* In lombscargle.c */
+
+float *ls_periodogram(double *times, float *data, long numpts,
+                      double df, long klo, long numf);
+/* Return the normalized Lomb-Scargle periodogram of the unevenly     */
+/* sampled 'data' (taken at 'times' seconds) for the 'numf'           */
+/* frequencies (klo + i) * df.  If 'data' is NULL, 'times' is a list  */
+/* of events and the Rayleigh powers are returned instead.  Noise     */
+/* powers are exponentially distributed with a mean of 1 (just like   */
+/* PRESTO's normalized Fourier powers).  The sums are computed with   */
+/* FFTs after the Press & Rybicki (1989, ApJ, 338, 277) extirpolation */
+/* of the data onto a uniform grid, and chunks of frequencies are     */
+/* done in parallel.                                                  */
+
+lscand *ls_search(float *powers, long klo, long numf, long numfund,
+                  double df, double ofac, int numharm, float sigma,
+                  int *numcands);
+/* Search the periodogram 'powers' (at the frequencies (klo + i) *  */
+/* df for i < numf, oversampled by 'ofac') for signals with their   */
+/* fundamentals in the first 'numfund' bins.  Sums of 1, 2, 4, ...  */
+/* 'numharm' harmonics are checked.  The local maxima with sigma >= */
+/* 'sigma' are clustered into candidates which are returned (sorted */
+/* by sigma) and their number placed in 'numcands'.                 */
@@ -0,0 +1,65 @@
+#ifndef __lssearch_cmd__
+#define __lssearch_cmd__
+/*****
+  command line parser interface -- generated by clig
+  (http://wsd.iitb.fhg.de/~geg/clighome/)
+
+  The command line parser `clig':
+  (C) 1995-2004 Harald Kirsch (clig@geggus.net)
+*****/
+
+typedef struct s_Cmdline {
+  /***** -ncpus: Number of processors to use with OpenMP */
+  char ncpusP;
+  int ncpus;
+  int ncpusC;
+  /***** -flo: The lowest frequency (Hz) to search */
+  char floP;
+  double flo;
+  int floC;
+  /***** -fhi: The highest frequency (Hz) to search (default is the Nyquist frequency of the '.inf' sample time) */
+  char fhiP;
+  double fhi;
+  int fhiC;
+  /***** -ofac: Oversampling factor of the frequencies (1/T is the independent spacing) */
+  char ofacP;
+  double ofac;
+  int ofacC;
+  /***** -numharm: The number of harmonics to sum (power-of-two) */
+  char numharmP;
+  int numharm;
+  int numharmC;
+  /***** -sigma: Cutoff sigma for choosing candidates */
+  char sigmaP;
+  float sigma;
+  int sigmaC;
+  /***** -numcands: Maximum number of candidates to return */
+  char numcandsP;
+  int numcands;
+  int numcandsC;
+  /***** -noonoff: Use all of the samples of the '.dat' files (i.e. ignore the on/off pairs in the '.inf' files) */
+  char noonoffP;
+  /***** -events: The input is an event file (with a '.inf' file of the same root) rather than '.dat' files */
+  char eventsP;
+  /***** -days: Events are in days since the EPOCH in the '.inf' file (default is seconds) */
+  char daysP;
+  /***** -mjds: Events are in MJDs */
+  char mjdsP;
+  /***** -double: Events are in binary double precision (default is ASCII) */
+  char doubleP;
+  /***** uninterpreted command line parameters */
+  int argc;
+  /*@null*/char **argv;
+  /***** the whole command line concatenated */
+  char *full_cmd_line;
+} Cmdline;
+
+
+extern char *Program;
+extern void usage(void);
+extern /*@shared*/Cmdline *parseCmdline(int argc, char **argv);
+
+extern void showOptionValues(void);
+
+#endif
+
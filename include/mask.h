@@ -70,3 +70,78 @@ int determine_padvals(char *maskfilenm, mask * obsmask, float *padvals);
 // *.stats file if it is available.  The pre-allocated vector (of
 // length numchan) is in padvals.  Return a '1' if the routine used
 // the stats file, return 0 if the padding was set to aeros.
+
+#ifndef RFISTATS_DEFINED
+typedef struct RFISTATS {
+  int numchan;             /* Number of channels                     */
+  int numint;              /* Number of intervals                    */
+  int ptsperint;           /* Points per interval                    */
+  int lobin;               /* Lowest Fourier bin searched            */
+  int numbetween;          /* Fourier interpolation factor           */
+  float *datapow;          /* Max powers (numint x numchan)          */
+  float *dataavg;          /* Averages (numint x numchan)            */
+  float *datastd;          /* Std devs (numint x numchan)            */
+  float dataavg_med;       /* Median of all of the averages          */
+  float dataavg_std;       /* Std dev of all of the averages         */
+  float datastd_med;       /* Median of all of the std devs          */
+  float datastd_std;       /* Std dev of all of the std devs         */
+  float *avg_int_med;      /* Median average for each interval       */
+  float *std_int_med;      /* Median std dev for each interval       */
+  float *avg_chan_med;     /* Median average for each channel        */
+  float *std_chan_med;     /* Median std dev for each channel        */
+  unsigned char *padmask;  /* PADDING bits from the bytemask or NULL */
+  void *filemap;           /* The mmap()ed '.stats' file or NULL     */
+  size_t filelen;          /* Length of the mmap()ed file            */
+} rfistats;
+#define RFISTATS_DEFINED
+#endif
+
+/* In rfistats.c */
+
+void read_rfistats(char *statsfilenm, rfistats *stats);
+/* mmap() an rfifind '.stats' file and calculate the statistics  */
+/* needed to make masks.  If the matching '.bytemask' file       */
+/* exists, its PADDING bits are kept in stats->padmask.           */
+
+void free_rfistats(rfistats *stats);
+/* Free the contents of an rfistats structure */
+
+void calc_rfistats(rfistats *stats);
+/* Calculate the global, per-interval, and per-channel medians  */
+/* and standard deviations of the averages and std devs in the  */
+/* same way as rfifind.  The vectors for the per-interval and   */
+/* per-channel medians are allocated here.                      */
+
+void flag_rfistats(rfistats *stats, float timesigma, float freqsigma,
+                   unsigned char *bytemask);
+/* Set the BAD_POW, BAD_AVG, and BAD_STD bits in 'bytemask'    */
+/* (numint x numchan) using the rfifind thresholds.  Points     */
+/* that are already marked as PADDING are not flagged.          */
+
+int trim_rfi_ints(unsigned char *bytemask, int numchan, int numint,
+                  float chantrigfrac, int *userints, int numuserints);
+/* If the number of bad channels in an interval is greater than */
+/* chantrigfrac*numchan then reject the whole interval.  The     */
+/* rejected intervals are added to 'userints' (which must have   */
+/* room for numint values) and the new number of them returned.  */
+
+int trim_rfi_chans(unsigned char *bytemask, int numchan, int numint,
+                   float inttrigfrac, int *userchan, int numuserchan);
+/* If the number of bad intervals in a channel is greater than  */
+/* inttrigfrac*numint then reject the whole channel.  The        */
+/* rejected channels are added to 'userchan' (which must have    */
+/* room for numchan values) and the new number of them returned. */
+
+void sweep_rfistats(rfistats *stats, int numconfigs, float *timesigmas,
+                    float *freqsigmas, float *chantrigfracs,
+                    float *inttrigfracs, float *maskfracs,
+                    int *numzapchans, int *numzapints);
+/* Make the rfifind mask for each of 'numconfigs' sets of        */
+/* thresholds.  The fraction of the (non-padded) data that is    */
+/* masked, and the numbers of fully zapped channels and          */
+/* intervals are returned for each set.  The configurations      */
+/* are processed in parallel.                                    */
+
+void median_filter(float *data, float *result, int numdata, int medlen);
+/* Running median of length 'medlen' (which must be odd) of 'data' */
+/* with zero padding at the ends (like scipy.signal.medfilt()).    */
@@ -32,6 +32,17 @@ typedef struct orbitparams {
 #define ORBITPARAMS_TYPE 1
 #endif
 
+#ifndef BINDELAYS_TYPE
+typedef struct BINDELAYS {
+    orbitparams orb;  /* Orbit used to make the grid                 */
+    double to;	      /* Time of the first grid point (s)            */
+    double dt;	      /* Spacing of the grid points (s)              */
+    long numpts;      /* Number of points in the grid                */
+    double *delays;   /* Orbital (Roemer) delays at the grid pts (s) */
+} bindelays;
+#define BINDELAYS_TYPE 1
+#endif
+
 /* Function declarations */
 
 /*
@@ -97,3 +108,31 @@ void E_to_phib_BT(double *E, long numpoints, orbitparams *orb);
 /* This model is NOT currently in use.            */
 
 
+void keplers_eqn_grid(double *E, long numpts, double to, double dt, \
+		      orbitparams *orb, double Eacc);
+/* Solve Kepler's Equation for the eccentric anomalys (*E) at the     */
+/* 'numpts' evenly spaced times t = to + ii * dt (sec since the start */
+/* of the data, so orb->t is added to get the time since periapsis).  */
+/* All the points are iterated together with Newton-Raphson (using    */
+/* Danby's starting values) so the loops vectorize.                   */
+
+double cubic_interp_grid(double *y, long numpts, double x);
+/* Return the 4-point (cubic) Lagrange interpolation of the evenly  */
+/* tabulated vector *y at the fractional index 'x'.  Points outside */
+/* of the table are extrapolated from the nearest 4 points.         */
+
+bindelays *get_bindelays(orbitparams *orb, double to, double dt, long numpts);
+/* Return the orbital (Roemer) delays of a binary pulsar on the grid */
+/* of times t = to + ii * dt (sec since the start of the data).  The */
+/* grids are cached using the orbital parameters and times as keys,  */
+/* so repeated calls (from many threads or subbands, or during       */
+/* searches over orbital trials) are essentially free.  The result   */
+/* belongs to the cache and stays valid until 4 other grids have     */
+/* been requested or free_bindelays_cache() is called.               */
+
+double bindelay(bindelays *bd, double t);
+/* Return the cubic-interpolated orbital delay (s) at time 't' (sec */
+/* since the start of the data) using a grid from get_bindelays().  */
+
+void free_bindelays_cache(void);
+/* Free all of the delay grids remembered by get_bindelays() */
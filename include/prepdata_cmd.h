@@ -21,6 +21,10 @@ typedef struct s_Cmdline {
   char filterbankP;
   /***** -psrfits: Raw data in PSRFITS format */
   char psrfitsP;
+  /***** -baseband: Raw complex baseband data in DADA format */
+  char basebandP;
+  /***** -shmring: Raw SIGPROC filterbank data from a shared-memory ring */
+  char shmringP;
   /***** -noweights: Do not apply PSRFITS weights */
   char noweightsP;
   /***** -noscales: Do not apply PSRFITS scales */
@@ -43,6 +47,14 @@ typedef struct s_Cmdline {
   char invertP;
   /***** -zerodm: Subtract the mean of all channels from each sample (i.e. remove zero DM) */
   char zerodmP;
+  /***** -tscrunch: Number of neighboring spectra to sum (in time) as the raw data are read */
+  char tscrunchP;
+  int tscrunch;
+  int tscrunchC;
+  /***** -fscrunch: Number of neighboring channels to sum (in frequency) as the raw data are read */
+  char fscrunchP;
+  int fscrunch;
+  int fscrunchC;
   /***** -nobary: Do not barycenter the data */
   char nobaryP;
   /***** -shorts: Use short ints for the output data instead of floats */
@@ -67,6 +79,22 @@ typedef struct s_Cmdline {
   char dmP;
   double dm;
   int dmC;
+  /***** -dmstep: The stepsize in DM for -numdms (cm^-3 pc) */
+  char dmstepP;
+  double dmstep;
+  int dmstepC;
+  /***** -numdms: The number of DMs (starting at -dm) to de-disperse in a single pass of the raw data */
+  char numdmsP;
+  int numdms;
+  int numdmsC;
+  /***** -dmlist: Comma separated list (no spaces!) of DMs (or a file containing them) to de-disperse in a single pass of the raw data */
+  char dmlistP;
+  char* dmlist;
+  int dmlistC;
+  /***** -dmprec: The number of decimals in the precision of the DM in the filenames when de-dispersing several DMs */
+  char dmprecP;
+  int dmprec;
+  int dmprecC;
   /***** -mask: File containing masking information to use */
   char maskfileP;
   char* maskfile;
@@ -21,6 +21,10 @@ typedef struct s_Cmdline {
   char filterbankP;
   /***** -psrfits: Raw data in PSRFITS format */
   char psrfitsP;
+  /***** -baseband: Raw complex baseband data in DADA format */
+  char basebandP;
+  /***** -shmring: Raw SIGPROC filterbank data from a shared-memory ring */
+  char shmringP;
   /***** -noweights: Do not apply PSRFITS weights */
   char noweightsP;
   /***** -noscales: Do not apply PSRFITS scales */
@@ -37,6 +41,14 @@ typedef struct s_Cmdline {
   char invertP;
   /***** -zerodm: Subtract the mean of all channels from each sample (i.e. remove zero DM) */
   char zerodmP;
+  /***** -tscrunch: Number of neighboring spectra to sum (in time) as the raw data are read */
+  char tscrunchP;
+  int tscrunch;
+  int tscrunchC;
+  /***** -fscrunch: Number of neighboring channels to sum (in frequency) as the raw data are read */
+  char fscrunchP;
+  int fscrunch;
+  int fscrunchC;
   /***** -absphase: Use the absolute phase associated with polycos */
   char absphaseP;
   /***** -barypolycos: Force the use of polycos for barycentered events */
@@ -203,6 +215,8 @@ typedef struct s_Cmdline {
   char accelfileP;
   char* accelfile;
   int accelfileC;
+  /***** -accelbary: The -accelfile candidates are barycentric (e.g. '_BARY.cand' files from 'accelsearch -topo2bary') */
+  char accelbaryP;
   /***** -bin: Fold a binary pulsar.  Must include all of the following parameters */
   char binaryP;
   /***** -pb: The orbital period (s) */
@@ -21,6 +21,10 @@ typedef struct s_Cmdline {
   char filterbankP;
   /***** -psrfits: Raw data in PSRFITS format */
   char psrfitsP;
+  /***** -baseband: Raw complex baseband data in DADA format */
+  char basebandP;
+  /***** -shmring: Raw SIGPROC filterbank data from a shared-memory ring */
+  char shmringP;
   /***** -noweights: Do not apply PSRFITS weights */
   char noweightsP;
   /***** -noscales: Do not apply PSRFITS scales */
@@ -49,6 +53,14 @@ typedef struct s_Cmdline {
   char invertP;
   /***** -zerodm: Subtract the mean of all channels from each sample (i.e. remove zero DM) */
   char zerodmP;
+  /***** -tscrunch: Number of neighboring spectra to sum (in time) as the raw data are read */
+  char tscrunchP;
+  int tscrunch;
+  int tscrunchC;
+  /***** -fscrunch: Number of neighboring channels to sum (in frequency) as the raw data are read */
+  char fscrunchP;
+  int fscrunch;
+  int fscrunchC;
   /***** -runavg: Running mean subtraction from the input data */
   char runavgP;
   /***** -sub: Write subbands instead of de-dispersed data */
@@ -274,6 +274,16 @@ typedef struct bird{
   double hibin;
 } bird;
 
+typedef struct FFTFITRESULT {
+  double shift;       /* Shift (bins) to align template with profile */
+  double eshift;      /* Uncertainty in shift (999.0 if fit failed)  */
+  double snr;         /* Signal-to-noise ratio of the profile        */
+  double esnr;        /* Uncertainty in snr                          */
+  double b;           /* Template scale factor                       */
+  double errb;        /* Uncertainty in b                            */
+  int ngood;          /* Number of significant template harmonics    */
+} fftfitresult;
+
 /*****  Function Prototypes    *****/
 
 /* From swapendian.c: */
@@ -764,9 +774,37 @@ void hpselect(unsigned long m, unsigned long n, \
 
 /* In median.c */
 
+float select_kth(float arr[], int n, int k);
+/* Return the 'k'th smallest (starting from 0) of the 'n' values  */
+/* in 'arr'.  Note:  It messes up the order!                      */
+
 float median(float arr[], int n);
 /* Finds the median (but messes up the array order) */
 
+float median_nocopy(float arr[], int n);
+/* Find the median of 'arr' (the same value as median()) without   */
+/* re-ordering it.  Instead of a copy of the full array, only the  */
+/* values between a pair that bracket the median (chosen from a    */
+/* sample of the values) are copied and a quickselect done on them. */
+
+float hist_median(float arr[], int n, float *maxerr);
+/* Return an approximate median of 'arr' from a histogram of its  */
+/* values (without copying or re-ordering them).  The true median */
+/* is within 'maxerr' of the returned value.                      */
+
+typedef struct RUNMED runmed;
+/* A running (sliding window) median */
+
+runmed *runmed_alloc(int winlen);
+/* Allocate a running median of the last 'winlen' values */
+
+void runmed_free(runmed * rm);
+
+float runmed_update(runmed * rm, float val);
+/* Add 'val' to the running median (replacing the oldest value */
+/* once there are 'winlen' of them) and return the median of   */
+/* the values (the same value as median() would return).       */
+
 int comp_psr_to_cand(fourierprops * cand, infodata * idata, char *output, \
 		     int full);
 /* Compares a pulsar candidate defined by its properties found in   */
@@ -774,6 +812,12 @@ int comp_psr_to_cand(fourierprops * cand, infodata * idata, char *output, \
 /*   database.  It returns a string (verbose if full==1) describing */
 /*   the results of the search in *output.                          */
 
+int comp_psr_to_cand_scan(fourierprops * cand, infodata * idata, \
+		          char *output, int full);
+/* The same as comp_psr_to_cand(), but checking every pulsar in */
+/*   the database instead of using the index.  This is slow and */
+/*   is meant for checking the index.                           */
+
 int comp_bin_to_cand(binaryprops * cand, infodata * idata, \
 		     char *output, int full);
 /* Compares a binary PSR candidate defined by its props found in    */
@@ -1240,6 +1284,9 @@ double foldfile(FILE *datafile, double dt, double tlo,
 /*            1 = Use *delays but no *onoffpairs                      */
 /*            2 = No *delays but use *onoffpairs                      */
 /*            3 = Use *delays and use *onoffpairs                     */
+/*            Adding 4 means that the delays are tabulated at evenly  */
+/*            spaced times (i.e. from get_bindelays()) and will be    */
+/*            cubic-interpolated without searching 'delaytimes'.      */
 /*    'delays' is an array of time delays.                            */
 /*    'delaytimes' are the times where 'delays' were calculated.      */
 /*    'numdelays' is how many points are in 'delays' and 'delaytimes' */
@@ -1314,6 +1361,9 @@ double fold(float *data, int numdata, double dt, double tlo,
 /*            1 = Use *delays but no *onoffpairs                      */
 /*            2 = No *delays but use *onoffpairs                      */
 /*            3 = Use *delays and use *onoffpairs                     */
+/*            Adding 4 means that the delays are tabulated at evenly  */
+/*            spaced times (i.e. from get_bindelays()) and will be    */
+/*            cubic-interpolated without searching 'delaytimes'.      */
 /*    'delays' is an array of time delays.                            */
 /*    'delaytimes' are the times where 'delays' were calculated.      */
 /*    'numdelays' is how many points are in 'delays' and 'delaytimes' */
@@ -1351,6 +1401,35 @@ void initialize_foldstats(foldstats *stats);
 /* Zeroize all of the components of stats */
 
 
+/* In fftfit.c */
+
+void fftfit_cprof(float *y, int nmax, float *amp, float *pha);
+/* Compute the FFT of the profile 'y' of length 'nmax' (a power-of-   */
+/* two) and return the amplitudes and phases of harmonics 1 to nh     */
+/* (where nh = nmax/2) in 'amp' and 'pha' (which must have room for   */
+/* nh values).  amp[0] is the fundamental.                            */
+
+void fftfit_harmonics(float *p, float *theta, float *s, float *phi,
+                      int nmax, fftfitresult * result);
+/* The core of FFTFIT.  Fit the harmonic amplitudes 'p' and phases  */
+/* 'theta' of a profile of length 'nmax' (i.e. as returned by       */
+/* fftfit_cprof()) to those of a template ('s' and 'phi').          */
+
+void fftfit(float *prof, float *s, float *phi, int nmax, fftfitresult * result);
+/* Determine the shift (in bins) required to align the template     */
+/* (described by its harmonic amplitudes 's' and phases 'phi' as    */
+/* returned by fftfit_cprof()) with the profile 'prof' of length    */
+/* 'nmax' (a power-of-two) using Taylor's FFTFIT algorithm.  The    */
+/* shift, the signal-to-noise, the template scaling 'b' and their   */
+/* errors are returned in 'result'.  A failed fit returns           */
+/* shift = 0.0 and eshift = 999.0.  This routine is thread-safe.    */
+
+void fft_rotate(double *data, long numbins, double bins_to_left);
+/* Rotate the vector 'data' of length 'numbins' (any length) by  */
+/* 'bins_to_left' (which can be fractional) places to the left   */
+/* using the Fourier shift theorem.                              */
+
+
 double doppler(double freq_observed, double voverc);
   /* This routine returns the frequency emitted by a pulsar */
   /* (in MHz) given that we observe the pulsar at frequency */
@@ -1378,6 +1457,28 @@ void barycenter(double *topotimes, double *barytimes, \
   /* is the full name of an ephemeris supported by TEMPO,     */
   /* examples include DE200, DE421, or DE436.                 */
 
+void doppler_derivs(double *topotimes, double *voverc, long N, double T,
+                    double *derivs);
+  /* Fit the Doppler factor B = d(t_bary)/d(t_topo) = 1/(1+voverc)  */
+  /* of the observatory motion during an observation of length 'T'  */
+  /* (s) with a cubic.  'topotimes' (MJD) and 'voverc' are 'N'      */
+  /* (>= 4) values from barycenter() spanning the observation, with */
+  /* topotimes[0] at its start.  Return B, dB/dt, and d^2B/dt^2 at  */
+  /* the topocentric middle of the observation in derivs[0-2], and  */
+  /* the barycentric time (s) from its start to its middle in       */
+  /* derivs[3].                                                     */
+
+void topo2bary_rzw(double *derivs, double T, double rt, double zt, double wt,
+                   double *rb, double *zb, double *wb);
+  /* Convert the topocentric Fourier frequency 'rt', f-dot 'zt', and  */
+  /* f-dot-dot 'wt' of a candidate (the averages over an observation  */
+  /* of length 'T' s, as from accelsearch) into barycentric ones,     */
+  /* including the f-dot and f-dot-dot that the changing Doppler      */
+  /* shift induces.  'derivs' are from doppler_derivs().  The results */
+  /* describe the barycentric spin starting at the barycentric time   */
+  /* of the start of the observation, in units of the same 'T', so    */
+  /* they can be used like the topocentric values (e.g. by prepfold). */
+
 fftcand *search_fft(fcomplex *fft, int numfft, int lobin, int hibin, 
 		    int numharmsum, int numbetween, 
 		    presto_interptype interptype,
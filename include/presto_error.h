@@ -0,0 +1,87 @@
+#ifndef PRESTO_ERRCTX_DEFINED
+#include <setjmp.h>
+
+/* Error handling for libpresto.                                    */
+/*                                                                  */
+/* By default, a fatal error in a library routine prints a message  */
+/* and exits the program (as PRESTO always has).  A long-running    */
+/* program that wants to survive errors (a worker processing many   */
+/* files, or the Python wrappers) can instead trap them in the      */
+/* current thread:                                                  */
+/*                                                                  */
+/*     presto_errctx ctx;                                           */
+/*                                                                  */
+/*     presto_begin_try(&ctx);                                      */
+/*     if (PRESTO_TRY(ctx)) {                                       */
+/*         ...calls to libpresto...                                 */
+/*         presto_end_try(&ctx);                                    */
+/*     } else {                                                     */
+/*         printf("Failed (%d):  %s\n", presto_last_status(),       */
+/*                presto_last_error());                             */
+/*     }                                                            */
+/*                                                                  */
+/* When an error occurs inside the PRESTO_TRY() block, control      */
+/* returns to the 'else' branch with the context already removed.   */
+/* PRESTO_TRY() is a setjmp(), so any local variables of the        */
+/* calling function that are changed inside the block and used in   */
+/* the 'else' branch (or after it) must be declared 'volatile'.     */
+/* For the same reason, get the error from presto_last_status() and */
+/* presto_last_error() rather than from the context.  Memory        */
+/* allocated by the routines that failed is not freed, and errors   */
+/* in OpenMP worker threads still exit the program.  PRESTO_TRY()   */
+/* blocks can be nested.                                            */
+
+typedef enum {
+    PRESTO_OK = 0,
+    PRESTO_ERR_NOMEM,           /* Memory allocation failed                */
+    PRESTO_ERR_IO,              /* Open, read, write or seek failed        */
+    PRESTO_ERR_EOF,             /* File or header ended prematurely        */
+    PRESTO_ERR_FORMAT,          /* Bad or inconsistent file or header data */
+    PRESTO_ERR_VALUE            /* Bad argument or out of range value      */
+} presto_status;
+
+typedef struct PRESTO_ERRCTX {
+    jmp_buf env;                /* Where to return after an error       */
+    struct PRESTO_ERRCTX *prev; /* The enclosing context (or NULL)      */
+    presto_status status;       /* The status of the error              */
+    char msg[512];              /* The error message                    */
+} presto_errctx;
+
+/* setjmp() may only be used as (part of) a whole controlling */
+/* expression, so presto_begin_try() must be its own statement */
+#define PRESTO_TRY(ctx) (setjmp((ctx).env) == 0)
+
+void presto_begin_try(presto_errctx * ctx);
+/* Make 'ctx' the current error context of this thread.  Call it */
+/* just before the PRESTO_TRY() of that context.                 */
+
+void presto_end_try(presto_errctx * ctx);
+/* Remove 'ctx' (which must be the current context) after the */
+/* PRESTO_TRY() block finished without an error.              */
+
+int presto_trapping_errors(void);
+/* Return 1 if errors in this thread are being trapped by a */
+/* PRESTO_TRY() block, 0 if they exit the program.          */
+
+void presto_error(presto_status status, const char *fmt, ...)
+    __attribute__ ((format(printf, 2, 3), noreturn));
+/* Signal a fatal error with a printf-style message.  If an error */
+/* context is active, the status and message are stored in it and */
+/* control returns to its PRESTO_TRY().  Otherwise the message is */
+/* printed and the program exits.                                 */
+
+void presto_perror(presto_status status, const char *fmt, ...)
+    __attribute__ ((format(printf, 2, 3), noreturn));
+/* Like presto_error(), but append the system error (errno). */
+
+presto_status presto_last_status(void);
+/* Return the status of the last error trapped in this thread. */
+
+const char *presto_last_error(void);
+/* Return the message of the last error trapped in this thread. */
+
+const char *presto_status_string(presto_status status);
+/* Return a short description of 'status'. */
+
+#define PRESTO_ERRCTX_DEFINED
+#endif
@@ -0,0 +1,74 @@
+#include "sigproc_fb.h"
+
+/* A POSIX shared-memory ring buffer of filterbank data for real-time  */
+/* processing.  A single writer puts blocks ("slots") of spectra into  */
+/* a ring with 'numslots' slots, while any number of readers (e.g.     */
+/* rfifind and several prepsubbands) follow along independently.      */
+/* There are no locks:  each slot carries the number of the block it  */
+/* holds, so a reader that falls more than 'numslots' blocks behind    */
+/* the writer notices that its data were overwritten (an overflow)     */
+/* and replaces them with padding.  Readers wait (by polling) for the  */
+/* writer when they catch up to it.                                    */
+/*                                                                     */
+/* The shared-memory object is a header, followed by the slots.  Each  */
+/* slot is a shmringslot followed by 'spectra_per_slot' spectra in     */
+/* SIGPROC filterbank byte order (padded to a multiple of 8 bytes).    */
+/* Ring names end with '.shmring' and are also visible as              */
+/* '/dev/shm/<name>' on Linux.                                         */
+
+#define SHMRING_MAGIC    0x474e4952 /* "RING" */
+#define SHMRING_VERSION  2
+
+typedef struct SHMRINGHDR {
+    int magic;                /* SHMRING_MAGIC */
+    int version;              /* SHMRING_VERSION */
+    long long hdr_size;       /* Bytes before the first slot */
+    long long slot_size;      /* Bytes in each slot (including its shmringslot) */
+    int numslots;             /* Number of slots in the ring */
+    int spectra_per_slot;     /* Number of spectra in a full slot */
+    int bytes_per_spectra;    /* Number of bytes in each spectra */
+    int pad;                  /* (for alignment) */
+    sigprocfb fb;             /* The observation.  fb.N is the planned number of spectra */
+    long long write_seq;      /* Number of slots completely written (atomic) */
+    long long write_spec;     /* Number of spectra in those slots (writer only) */
+    int done;                 /* The writer has finished (atomic) */
+    int numreaders;           /* Number of readers that attached (informational) */
+} shmringhdr;
+
+typedef struct SHMRINGSLOT {
+    long long seq;            /* Block number in the slot, -1 while being written (atomic) */
+    int numspectra;           /* Number of valid spectra in the slot */
+    int pad;                  /* (for alignment) */
+    long long startspec;      /* Spectra number of the first spectra in the slot */
+} shmringslot;
+
+typedef struct SHMRING {
+    char name[256];           /* The POSIX shared-memory name ("/xxx.shmring") */
+    shmringhdr *hdr;          /* The mapped header */
+    unsigned char *slots;     /* The start of the slots */
+    size_t size;              /* Total mapped bytes */
+    int writer;               /* Did we create the ring? */
+} shmring;
+
+/* Return values of shmring_read_slot() */
+#define SHMRING_OK        0   /* Got the block */
+#define SHMRING_OVERFLOW  1   /* The block was overwritten before we read it */
+#define SHMRING_END       2   /* The writer finished (or stopped) before writing it */
+
+/* shmring.c */
+void shmring_name(char *outname, char *inname);
+shmring *shmring_create(char *name, sigprocfb * fb, int numslots, int spectra_per_slot);
+shmring *shmring_attach(char *name);
+void shmring_write_slot(shmring * ring, unsigned char *data, int numspectra);
+void shmring_finish(shmring * ring);
+int shmring_read_slot(shmring * ring, long long blocknum, unsigned char *data,
+                      int *numspectra, double timeout);
+long long shmring_lost_spectra(shmring * ring, long long blocknum,
+                               long long startspec, long long *nextblock);
+void shmring_close(shmring * ring);
+
+/* shmring_fb.c */
+void read_shmring_files(struct spectra_info *s);
+long long offset_to_shmring_spectra(long long specnum, struct spectra_info *s);
+int get_shmring_rawblock(float *fdata, struct spectra_info *s, int *padding);
+void close_shmring_files(struct spectra_info *s);
@@ -31,6 +31,7 @@ void get_telescope_name(int telescope_id, struct spectra_info *s);
 void get_backend_name(int machine_id, struct spectra_info *s);
 void write_filterbank_header(sigprocfb *fb, FILE *outfile);
 int read_filterbank_header(sigprocfb *fb, FILE *inputfile);
+void set_filterbank_spectra_info(sigprocfb *fb, struct spectra_info *s);
 void read_filterbank_files(struct spectra_info *s);
 long long offset_to_filterbank_spectra(long long specnum, struct spectra_info *s);
 int get_filterbank_rawblock(float *fdata, struct spectra_info *s, int *padding);
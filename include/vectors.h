@@ -2,6 +2,7 @@
 #include <stdlib.h>
 #include "fftw3.h"
 #include "rawtype.h"
+#include "presto_error.h"
 
 #ifdef USEDMALLOC
 #include "dmalloc.h"
@@ -20,6 +21,18 @@ double *gen_dvect(long length);
 fcomplex *gen_cvect(long length);
 /* Generate a floating complex number vector */
 
+/* The gen_*() routines call presto_error() if the allocation fails. */
+/* The following return PRESTO_ERR_NOMEM (and *v = NULL) instead.    */
+
+presto_status try_gen_fvect(long length, float **v);
+/* Generate a floating point vector */
+
+presto_status try_gen_dvect(long length, double **v);
+/* Generate a double precision vector */
+
+presto_status try_gen_cvect(long length, fcomplex **v);
+/* Generate a floating complex number vector */
+
 short *gen_svect(long length);
 /* Generate an short integer vector */
 
@@ -59,6 +72,33 @@ float ***gen_f3Darr(long nhgts, long nrows, long ncols);
 fcomplex ***gen_c3Darr(long nhgts, long nrows, long ncols);
 /* Generate a floating complex 3D array */
 
+/* Large vectors (like the in-memory f-fdot plane) are allocated    */
+/* with mmap() on 2MB boundaries using huge pages: explicit ones     */
+/* (MAP_HUGETLB) if 'hugepages' > 1 and they are available, else     */
+/* transparent huge pages (madvise()) if 'hugepages' > 0.  If        */
+/* 'interleave' is set, the pages are interleaved over the NUMA      */
+/* nodes.  Otherwise they are first touched in parallel using an     */
+/* OpenMP static schedule, placing them on the NUMA nodes of the     */
+/* threads that use them in similarly scheduled loops.  The default  */
+/* policy comes from the PRESTO_HUGEPAGES (default 1) and            */
+/* PRESTO_NUMA_INTERLEAVE (default 0) environment variables.  The    */
+/* vectors are zeroed and must be freed with vect_free().  Vectors   */
+/* smaller than BIGVECT_MINBYTES are normal gen_bvect()s.            */
+#define HUGEPAGESIZE     (2L << 20)
+#define BIGVECT_MINBYTES (8L << 20)
+
+void set_bigvect_policy(int hugepages, int interleave);
+/* Set the huge page and NUMA policy for the large vectors */
+
+void *gen_bigvect(size_t nbytes);
+/* Generate a large vector of 'nbytes' bytes */
+
+float *gen_big_fvect(long length);
+/* Generate a large floating point vector */
+
+fcomplex *gen_big_cvect(long length);
+/* Generate a large floating complex number vector */
+
 void vect_free(void *vect);
 /* Free a generated vector */ 
 
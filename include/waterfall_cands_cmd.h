@@ -0,0 +1,77 @@
+#ifndef __waterfall_cands_cmd__
+#define __waterfall_cands_cmd__
+/*****
+  command line parser interface -- generated by clig
+  (http://wsd.iitb.fhg.de/~geg/clighome/)
+
+  The command line parser `clig':
+  (C) 1995-2004 Harald Kirsch (clig@geggus.net)
+*****/
+
+typedef struct s_Cmdline {
+  /***** -ncpus: Number of processors to use with OpenMP */
+  char ncpusP;
+  int ncpus;
+  int ncpusC;
+  /***** -o: Root of the output file names (default is the root of the first raw data file) */
+  char outfileP;
+  char* outfile;
+  int outfileC;
+  /***** -cands: Single pulse candidates (DM, Sigma, Time, Sample, Downfact per line as in a '.singlepulse' file) */
+  char candfileP;
+  char* candfile;
+  int candfileC;
+  /***** -filterbank: Raw data in SIGPROC filterbank format */
+  char filterbankP;
+  /***** -psrfits: Raw data in PSRFITS format */
+  char psrfitsP;
+  /***** -noweights: Do not apply PSRFITS weights */
+  char noweightsP;
+  /***** -noscales: Do not apply PSRFITS scales */
+  char noscalesP;
+  /***** -nooffsets: Do not apply PSRFITS offsets */
+  char nooffsetsP;
+  /***** -invert: For rawdata, flip (or invert) the band */
+  char invertP;
+  /***** -mask: File containing masking information to use */
+  char maskfileP;
+  char* maskfile;
+  int maskfileC;
+  /***** -nsub: The number of sub-bands to use (default chooses 32, 64, or 96/128 based on the candidate sigma) */
+  char nsubP;
+  int nsub;
+  int nsubC;
+  /***** -loc: Fraction of the window length where the pulse is located */
+  char locP;
+  double loc;
+  int locC;
+  /***** -binratio: Number of pulse widths in the de-dispersed window */
+  char binratioP;
+  int binratio;
+  int binratioC;
+  /***** -scaleindep: Scale each subband independently (default scales using the global std dev) */
+  char scaleindepP;
+  /***** -minsigma: Only use candidates with at least this sigma */
+  char minsigmaP;
+  double minsigma;
+  int minsigmaC;
+  /***** -numcands: Maximum number of candidates to process (highest sigma first) */
+  char numcandsP;
+  int numcands;
+  int numcandsC;
+  /***** uninterpreted command line parameters */
+  int argc;
+  /*@null*/char **argv;
+  /***** the whole command line concatenated */
+  char *full_cmd_line;
+} Cmdline;
+
+
+extern char *Program;
+extern void usage(void);
+extern /*@shared*/Cmdline *parseCmdline(int argc, char **argv);
+
+extern void showOptionValues(void);
+
+#endif
+
@@ -0,0 +1,92 @@
+"""
+Read the columnar binary candidate files ('<ACCEL file>.cols') that
+accelsearch writes next to its text ACCEL files.  See
+include/accelcols.h for the format.
+
+The columns are numpy arrays that use the memory-mapped file in
+place, so even very large files can be "read" almost instantly:
+
+    from presto.accelcols import accelcols
+    ac = accelcols("J1234_DM10.00_ACCEL_200.cols")
+    good = ac['sigma'] > 6.0
+    print(ac['freq'][good], ac.harmonics(0, 'h_pow'))
+"""
+from builtins import object
+import mmap
+import numpy as np
+
+ACCELCOLS_MAGIC = b"PRESTOAC"
+ACCELCOLS_VERSION = 1
+ACCELCOLS_BYTEORDER = 0x01020304
+
+header_fields = [('magic', 'S8'), ('version', 'i4'), ('byteorder', 'i4'),
+                 ('numcands', 'i8'), ('numharms', 'i8'), ('T', 'f8'),
+                 ('dt', 'f8'), ('N', 'f8'), ('dm', 'f8'), ('numcols', 'i4'),
+                 ('zmax', 'i4'), ('wmax', 'i4'), ('numharm', 'i4'),
+                 ('reserved', 'i4', (12,))]
+desc_fields = [('name', 'S16'), ('type', 'i4'), ('reserved', 'i4'),
+               ('length', 'i8'), ('offset', 'i8')]
+# accelcol_type values
+column_types = {1: 'i4', 2: 'i8', 3: 'f4', 4: 'f8'}
+
+
+def _dtype(fields, endian):
+    return np.dtype([(f[0], endian + f[1]) + f[2:] if f[1][0] != 'S' else f
+                     for f in fields])
+
+
+class accelcols(object):
+    """The header values and the columns of an accelsearch '.cols' file.
+
+        Header values are attributes (numcands, numharms, T, dt, N,
+        dm, zmax, wmax, numharm) and columns are accessed by name,
+        e.g. ac['sigma'] or ac['h_pow'].
+    """
+    def __init__(self, filenm):
+        self.filenm = filenm
+        with open(filenm, 'rb') as infile:
+            self.map = mmap.mmap(infile.fileno(), 0, access=mmap.ACCESS_READ)
+        if self.map[:8] != ACCELCOLS_MAGIC:
+            raise ValueError("'%s' is not a columnar candidate file" % filenm)
+        # Handle files written on machines with the other byte order
+        for endian in ('<', '>'):
+            hdr_dtype = _dtype(header_fields, endian)
+            hdr = np.frombuffer(self.map, dtype=hdr_dtype, count=1)[0]
+            if hdr['byteorder'] == ACCELCOLS_BYTEORDER:
+                break
+        else:
+            raise ValueError("Can't determine the byte order of '%s'" % filenm)
+        if hdr['version'] != ACCELCOLS_VERSION:
+            raise ValueError("'%s' is version %d, not %d" %
+                             (filenm, hdr['version'], ACCELCOLS_VERSION))
+        for key in ('numcands', 'numharms', 'T', 'dt', 'N', 'dm',
+                    'zmax', 'wmax', 'numharm'):
+            setattr(self, key, hdr[key].item())
+        descs = np.frombuffer(self.map, dtype=_dtype(desc_fields, endian),
+                              count=hdr['numcols'], offset=hdr_dtype.itemsize)
+        self.columns = {}
+        for desc in descs:
+            coltype = column_types.get(int(desc['type']))
+            if coltype is None:  # Skip columns we don't understand
+                continue
+            name = desc['name'].decode()
+            self.columns[name] = np.frombuffer(self.map,
+                                               dtype=endian + coltype,
+                                               count=int(desc['length']),
+                                               offset=int(desc['offset']))
+
+    def __getitem__(self, name):
+        return self.columns[name]
+
+    def __contains__(self, name):
+        return name in self.columns
+
+    def keys(self):
+        return list(self.columns.keys())
+
+    def harmonics(self, icand, name):
+        """Return the values of the harmonic column 'name' (e.g. 'h_pow')
+            for candidate number 'icand' (0-offset).
+        """
+        start = self['harmstart'][icand]
+        return self[name][start:start + self['numharm'][icand]]
@@ -0,0 +1,308 @@
+#!/usr/bin/env python
+"""
+A small resource-aware scheduler for running PRESTO tools concurrently.
+
+A Pipeline is a DAG of Tasks.  Each Task is either a shell command
+(run just like os.system() would) or a Python callable, along with
+the CPUs, memory (GB), and fraction of the disk I/O bandwidth that it
+needs.  Pipeline.run() starts every task whose dependencies are done
+as soon as it fits in the node's budget, highest priority first.
+
+Since the tools write to different files, the results are identical
+to running the same commands one after the other (which is what
+ncpus=1 does).  The output of the tasks is also printed in the order
+that they were added, no matter when they finish, so that logs can be
+compared with those from serial runs.
+
+Example:
+    pipe = Pipeline(ncpus=8)
+    fft = pipe.add("fft_DM10", "realfft DM10.dat", stage="FFT", io=0.5)
+    pipe.add("accel_DM10", "accelsearch -zmax 50 DM10.fft",
+             deps=[fft], stage="accelsearch", priority=1)
+    pipe.run()
+    print(pipe.stage_times["FFT"])
+"""
+from __future__ import print_function
+from builtins import object
+import os, sys, time, subprocess, threading
+try:
+    import queue
+except ImportError:
+    import Queue as queue
+
+
+class PipelineError(Exception):
+    pass
+
+
+def node_memory():
+    """
+    node_memory():
+        Return the physical memory of this machine in GB (or 0.0
+            if it can't be determined).
+    """
+    try:
+        return os.sysconf('SC_PAGE_SIZE') * os.sysconf('SC_PHYS_PAGES') / 2.0**30
+    except (ValueError, OSError, AttributeError):
+        return 0.0
+
+
+def pycall(func, *args, **kwargs):
+    """
+    pycall(func, *args, **kwargs):
+        Return a callable (for a Task) that calls func(*args, **kwargs)
+            and is logged as such.
+    """
+    def call():
+        return func(*args, **kwargs)
+    call.description = "%s(%s)" % (func.__name__, ", ".join(
+        [repr(a) for a in args] + ["%s=%r" % kv for kv in sorted(kwargs.items())]))
+    return call
+
+
+class Task(object):
+    """
+    Task(name, cmd, deps=(), cpus=1, mem=0.0, io=0.0, priority=0,
+         retries=0, stage=None, fatal=False):
+        A single step of a Pipeline.  'cmd' is either a shell command
+            string or a Python callable (called with no arguments,
+            where a return value of False or a raised exception is a
+            failure).  'deps' is a list of Tasks (or task names) that
+            must finish first.  'cpus', 'mem' (GB), and 'io' (the
+            fraction of the disk bandwidth, 0-1) are the resources the
+            task needs.  Ready tasks with larger 'priority' start
+            first.  A failed task is re-run up to 'retries' times.  If
+            it still fails, the pipeline stops if 'fatal' (and the
+            tasks that haven't started are marked as done and
+            'skipped'), otherwise a warning is printed and the tasks
+            that depend on it still run (just as they would in a
+            serial os.system() driver).
+            The run time of the task is added to stage_times[stage].
+    """
+    def __init__(self, name, cmd, deps=(), cpus=1, mem=0.0, io=0.0,
+                 priority=0, retries=0, stage=None, fatal=False):
+        self.name = name
+        self.cmd = cmd
+        self.deps = list(deps)
+        self.cpus = cpus
+        self.mem = mem
+        self.io = io
+        self.priority = priority
+        self.retries = retries
+        self.stage = stage if stage is not None else name
+        self.fatal = fatal
+        self.index = 0          # Order it was added to the pipeline
+        self.status = None      # Exit status of the last attempt
+        self.attempts = 0
+        self.time = 0.0         # Total wall-clock time of all attempts
+        self.output = ""        # Captured stdout/stderr
+        self.done = False
+        self.skipped = False    # Never run since a fatal task failed
+
+    def __repr__(self):
+        return "Task(%r)" % self.name
+
+    def describe(self):
+        if callable(self.cmd):
+            if hasattr(self.cmd, "description"):
+                return self.cmd.description
+            return getattr(self.cmd, "__name__", repr(self.cmd)) + "()"
+        return self.cmd
+
+    def execute(self):
+        """
+        execute():
+            Run the task once.  Return its exit status (0 is success).
+        """
+        start = time.time()
+        if callable(self.cmd):
+            try:
+                ok = self.cmd()
+                status = 1 if ok is False else 0
+            except Exception as e:
+                self.output += "%s: %s\n" % (type(e).__name__, e)
+                status = 1
+        else:
+            proc = subprocess.Popen(self.cmd, shell=True, stdout=subprocess.PIPE,
+                                    stderr=subprocess.STDOUT)
+            out = proc.communicate()[0]
+            self.output += out.decode('utf-8', 'replace')
+            status = proc.returncode
+        self.time += time.time() - start
+        self.attempts += 1
+        self.status = status
+        return status
+
+
+class Pipeline(object):
+    """
+    Pipeline(ncpus=None, mem=None, io=1.0, verbose=True):
+        A set of Tasks to run concurrently within a budget of 'ncpus'
+            CPUs (default is all of them), 'mem' GB of memory (default
+            is all of the node's memory), and 'io' units of disk
+            bandwidth.  A task that needs more than the whole budget
+            is run when nothing else is running.  Tasks can be added
+            after (or between) calls to run().
+    """
+    def __init__(self, ncpus=None, mem=None, io=1.0, verbose=True):
+        self.ncpus = ncpus if ncpus else (os.cpu_count() or 1)
+        self.mem = mem if mem else node_memory()
+        self.io = io
+        self.verbose = verbose
+        self.tasks = []
+        self.bynames = {}
+        self.stage_times = {}
+        self.failed = []
+        self.skipped = []
+        self.walltime = 0.0
+        self._numprinted = 0
+
+    def add(self, name, cmd, deps=(), **kwargs):
+        """
+        add(name, cmd, deps=(), **kwargs):
+            Add a Task (see Task for the keyword arguments) and
+                return it.  'name' must be unique, and any tasks named
+                in 'deps' must already have been added.
+        """
+        if name in self.bynames:
+            raise PipelineError("duplicate task name '%s'" % name)
+        for dep in deps:
+            if not isinstance(dep, Task) and dep not in self.bynames:
+                raise PipelineError("'%s' depends on unknown task '%s'" % (name, dep))
+        deps = [self.bynames[d] if not isinstance(d, Task) else d for d in deps]
+        task = Task(name, cmd, deps, **kwargs)
+        task.index = len(self.tasks)
+        self.tasks.append(task)
+        self.bynames[name] = task
+        return task
+
+    def _fits(self, task, used):
+        # Something always has to be able to run
+        if not used[3]:
+            return True
+        return (used[0] + task.cpus <= self.ncpus and
+                (not self.mem or used[1] + task.mem <= self.mem) and
+                used[2] + task.io <= self.io + 1e-9)
+
+    def _print_finished(self):
+        # Print the outputs in the order that the tasks were added
+        while (self._numprinted < len(self.tasks) and
+               self.tasks[self._numprinted].done):
+            task = self.tasks[self._numprinted]
+            if self.verbose:
+                sys.stdout.write("\n'" + task.describe() + "'\n")
+                sys.stdout.write(task.output)
+                if task.status:
+                    sys.stdout.write("Warning:  '%s' failed with status %d after %d attempt(s)\n" %
+                                     (task.name, task.status, task.attempts))
+                sys.stdout.flush()
+            task.output = ""
+            self._numprinted += 1
+
+    def run(self):
+        """
+        run():
+            Run all of the tasks that haven't been run yet and wait
+                for them to finish.  Return the stage_times dict.  If
+                a 'fatal' task fails, the running tasks are allowed to
+                finish, the rest are marked as skipped, all of the
+                output is printed, and PipelineError is raised.
+        """
+        start = time.time()
+        pending = [t for t in self.tasks if not t.done]
+        names = set(t.name for t in pending)
+        for task in pending:
+            for dep in task.deps:
+                if not dep.done and dep.name not in names:
+                    raise PipelineError("'%s' depends on unknown task '%s'" %
+                                        (task.name, dep.name))
+        self._check_cycles(pending)
+        finished = queue.Queue()
+        used = [0, 0.0, 0.0, 0]  # CPUs, memory, I/O, number of tasks
+        running = 0
+        abort = None
+
+        def worker(task):
+            while task.execute() and task.attempts <= task.retries:
+                task.output += "Retrying '%s' (attempt %d failed with status %d)\n" % \
+                    (task.name, task.attempts, task.status)
+            finished.put(task)
+
+        while pending or running:
+            if abort is None:
+                ready = [t for t in pending if all(d.done for d in t.deps)]
+                ready.sort(key=lambda t: (-t.priority, t.index))
+                for task in ready:
+                    if self._fits(task, used):
+                        pending.remove(task)
+                        used[0] += task.cpus
+                        used[1] += task.mem
+                        used[2] += task.io
+                        used[3] += 1
+                        running += 1
+                        th = threading.Thread(target=worker, args=(task,))
+                        th.daemon = True
+                        th.start()
+            if not running:
+                break
+            task = finished.get()
+            running -= 1
+            used[0] -= task.cpus
+            used[1] -= task.mem
+            used[2] -= task.io
+            used[3] -= 1
+            task.done = True
+            self.stage_times[task.stage] = self.stage_times.get(task.stage, 0.0) + task.time
+            if task.status:
+                self.failed.append(task)
+                if task.fatal and abort is None:
+                    abort = task
+            self._print_finished()
+        self.walltime += time.time() - start
+        if abort is not None:
+            for task in pending:
+                task.done = True
+                task.skipped = True
+                task.output += "Warning:  skipped '%s' since '%s' failed\n" % \
+                    (task.name, abort.name)
+                self.skipped.append(task)
+            self._print_finished()
+            raise PipelineError("task '%s' failed with status %d" %
+                                (abort.name, abort.status))
+        return self.stage_times
+
+    def _check_cycles(self, tasks):
+        state = {}
+        for task in tasks:
+            if task.name in state:
+                continue
+            stack = [(task, iter(task.deps))]
+            state[task.name] = 1
+            while stack:
+                node, deps = stack[-1]
+                for dep in deps:
+                    if state.get(dep.name) == 1:
+                        raise PipelineError("dependency cycle through '%s'" % dep.name)
+                    if dep.name not in state and not dep.done:
+                        state[dep.name] = 1
+                        stack.append((dep, iter(dep.deps)))
+                        break
+                else:
+                    state[node.name] = 2
+                    stack.pop()
+
+    def stage_time(self, stage):
+        return self.stage_times.get(stage, 0.0)
+
+    def write_timings(self, outfile=sys.stdout):
+        """
+        write_timings(outfile=sys.stdout):
+            Write a summary of the time spent in each stage.
+        """
+        tot = sum(self.stage_times.values())
+        outfile.write("Wall time %.1f s for %.1f s of tasks (%.2fx concurrency)\n" %
+                      (self.walltime, tot, tot / self.walltime if self.walltime else 0.0))
+        for stage in sorted(self.stage_times, key=lambda s: -self.stage_times[s]):
+            outfile.write("  %20s time = %8.1f sec (%5.2f%%)\n" %
+                          (stage, self.stage_times[stage],
+                           self.stage_times[stage] / tot * 100.0 if tot else 0.0))
@@ -2,7 +2,6 @@ from builtins import zip
 from builtins import range
 from builtins import object
 import numpy as np
-from scipy.signal import medfilt
 from presto import infodata
 from presto.Pgplot import *
 
@@ -127,8 +126,14 @@ class rfifind(object):
         return self.bandpass_avg
 
     def get_median_bandpass(self, medlen=21, plot=False):
-        self.median_bandpass_avg = medfilt(self.bandpass_avg, medlen)
-        self.median_bandpass_std = medfilt(self.bandpass_std, medlen)
+        # The running median (like scipy.signal.medfilt()) from libpresto
+        from presto.presto.prestoswig import median_filter
+        self.median_bandpass_avg = np.zeros(self.nchan, dtype=np.float32)
+        self.median_bandpass_std = np.zeros(self.nchan, dtype=np.float32)
+        median_filter(np.ascontiguousarray(self.bandpass_avg, dtype=np.float32),
+                      self.median_bandpass_avg, medlen)
+        median_filter(np.ascontiguousarray(self.bandpass_std, dtype=np.float32),
+                      self.median_bandpass_std, medlen)
         if plot:
             plotxy(self.median_bandpass_avg, self.freqs,
                    labx="Frequency (MHz)")
@@ -320,6 +325,30 @@ class rfifind(object):
                 outfile.write("%5d     0\n" % (c))
         outfile.close()
 
+    def sweep_thresholds(self, timesigmas, freqsigmas,
+                         chantrigfracs=0.3, inttrigfracs=0.3):
+        """
+        sweep_thresholds(timesigmas, freqsigmas, chantrigfracs=0.3,
+                         inttrigfracs=0.3):
+            Determine how much of the data rfifind would mask for
+            each set of thresholds (the arguments are broadcast
+            against each other) without re-running rfifind.  The
+            compiled routines in libpresto make all of the masks
+            from a single read of the .stats file.  Returns the
+            masked fractions and the numbers of fully zapped
+            channels and intervals for each set of thresholds.
+        """
+        from presto.presto.prestoswig import rfifind_sweep
+        ts, fs, cs, ins = [np.ascontiguousarray(x, dtype=np.float32).ravel()
+                           for x in np.broadcast_arrays(timesigmas, freqsigmas,
+                                                        chantrigfracs, inttrigfracs)]
+        maskfracs = np.zeros(len(ts), dtype=np.float32)
+        numzapchans = np.zeros(len(ts), dtype=np.float32)
+        numzapints = np.zeros(len(ts), dtype=np.float32)
+        rfifind_sweep(self.basename+".stats", ts, fs, cs, ins,
+                      maskfracs, numzapchans, numzapints)
+        return maskfracs, numzapchans.astype(np.int32), numzapints.astype(np.int32)
+
 if __name__=="__main__":
     import sys
     a = rfifind(sys.argv[1])
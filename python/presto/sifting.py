@@ -8,6 +8,7 @@ import matplotlib.pyplot as plt
 import os.path
 import glob
 from presto import infodata
+from presto.accelcols import accelcols
 from presto.presto import candidate_sigma
 
 # Note: the following are global variables that can
@@ -104,6 +105,56 @@ def write_candlist(candlist, *args, **kwargs):
     candlist.to_file(*args, **kwargs)
 
 
+def remove_multibeam_candidates(candlists, nbeams, r_err=None):
+    """Remove candidates that are seen (at the same frequency) in
+        the candidate lists of at least 'nbeams' of the simultaneously
+        recorded beams of a multibeam observation.  Such signals are
+        almost always terrestrial RFI.  The candlists are modified
+        **in-place** and the rejects are moved to the 'multibeam'
+        bad-lists.
+
+        Inputs:
+            candlists: A list of Candlists, one per beam.
+            nbeams: The number of beams (including its own) that a
+                candidate must be seen in to be rejected.
+            r_err: How close (in Fourier bins) candidates in different
+                beams must be to be considered the same signal.
+                (Default: Globally defined "r_err")
+
+        Output:
+            numremoved: The number of candidates removed from each beam.
+    """
+    if r_err is None:
+        r_err = globals()['r_err']
+    # Find all of the coincidences before removing anything
+    freqs = [np.sort([c.f for c in candlist.cands]) for candlist in candlists]
+    badcands = []
+    for ibeam, candlist in enumerate(candlists):
+        bad = []
+        for ii, cand in enumerate(candlist.cands):
+            f_err = r_err/cand.T
+            numbeams = 1
+            for jbeam, beamfreqs in enumerate(freqs):
+                if jbeam == ibeam or not len(beamfreqs):
+                    continue
+                # The closest candidate frequency in the other beam
+                jj = np.searchsorted(beamfreqs, cand.f)
+                closest = beamfreqs[max(jj-1, 0):jj+1]
+                if np.fabs(closest - cand.f).min() < f_err:
+                    numbeams += 1
+            if numbeams >= nbeams:
+                cand.note = "Candidate is seen in %d of %d beams" % \
+                            (numbeams, len(candlists))
+                bad.append(ii)
+        badcands.append(bad)
+    numremoved = []
+    for candlist, bad in zip(candlists, badcands):
+        for ii in reversed(bad):
+            candlist.mark_as_bad(ii, 'multibeam')
+        numremoved.append(len(bad))
+    return numremoved
+
+
 def sigma_to_size(sigmas):
     """Given a numpy array of sigma values, return an array
         of same size with sizes of markers to plot.
@@ -197,7 +248,8 @@ class Candlist(object):
                          'harmpowcutoff': [], \
                          'rogueharmpow': [], \
                          'harmonic': [], \
-                         'dmproblem': []}
+                         'dmproblem': [], \
+                         'multibeam': []}
         self.duplicates = []
 
     def __iter__(self):
@@ -314,17 +366,17 @@ class Candlist(object):
                      self.badlists['shortperiod'], self.badlists['threshold'], \
                      self.badlists['harmpowcutoff'], self.badlists['rogueharmpow'], \
                      self.badlists['harmonic'], self.badlists['dmproblem'], \
-                     self.cands, self.duplicates]
+                     self.badlists['multibeam'], self.cands, self.duplicates]
         labels = ['Known birdires', 'Long period', 'Short period', \
                     'Threshold', 'Harm power cutoff', 'Rogue harm power', \
-                    'Harmonic cand', 'DM problem', 'Good cands', 'Hits']
+                    'Harmonic cand', 'DM problem', 'Multibeam', 'Good cands', 'Hits']
         colours = ['#FF0000', '#800000', '#008000', '#00FF00', \
-                    '#00FFFF', '#0000FF', '#FF00FF', '#800080', 'r', 'k']
-        markers = ['o', 'o', 'o', 'o', 'o', 'o', 'o', 'o', 'x', 's']
-        zorders = [-2, -2, -2, -2, -2, -2, -2, -2, 0, 0]
-        sizes = [50, 50, 50, 50, 50, 50, 50, 50, 100, 10]
-        fixedsizes = [0, 0, 0, 0, 0, 0, 0, 0, 1, 1]
-        lws = [1,1,1,1,1,1,1,1,2,1]
+                    '#00FFFF', '#0000FF', '#FF00FF', '#800080', '#808000', 'r', 'k']
+        markers = ['o', 'o', 'o', 'o', 'o', 'o', 'o', 'o', 'o', 'x', 's']
+        zorders = [-2, -2, -2, -2, -2, -2, -2, -2, -2, 0, 0]
+        sizes = [50, 50, 50, 50, 50, 50, 50, 50, 50, 100, 10]
+        fixedsizes = [0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1]
+        lws = [1,1,1,1,1,1,1,1,1,2,1]
         handles = []
         for cands, colour, marker, zorder, size, fixedsize, lw in \
                 zip(candlists, colours, markers, zorders, sizes, fixedsizes, lws):
@@ -416,14 +468,14 @@ class Candlist(object):
         candlists.append(self.cands)
         labels.append('Good cands')
         colours = ['#FF0000', '#800000', '#008000', '#00FF00', \
-                    '#00FFFF', '#0000FF', '#FF00FF', '#800080', 'r']
-        markers = ['o', 'o', 'o', 'o', 'o', 'o', 'o', 'o', 'o']
-        zorders = [-2, -2, -2, -2, -2, -2, -2, -2, 0]
-        sizes = [10, 10, 10, 10, 10, 10, 10, 10, 50]
-        fixedsizes = [1, 1, 1, 1, 1, 1, 1, 1, 0]
-        lws = [1,1,1,1,1,1,1,1,1,1]
-        ecs = ['none', 'none', 'none', 'none', 'none', 'none', 'none', 'none', 'k']
-        alphas = [1,1,1,1,1,1,1,1,0.7]
+                    '#00FFFF', '#0000FF', '#FF00FF', '#800080', '#808000', 'r']
+        markers = ['o', 'o', 'o', 'o', 'o', 'o', 'o', 'o', 'o', 'o']
+        zorders = [-2, -2, -2, -2, -2, -2, -2, -2, -2, 0]
+        sizes = [10, 10, 10, 10, 10, 10, 10, 10, 10, 50]
+        fixedsizes = [1, 1, 1, 1, 1, 1, 1, 1, 1, 0]
+        lws = [1,1,1,1,1,1,1,1,1,1,1]
+        ecs = ['none', 'none', 'none', 'none', 'none', 'none', 'none', 'none', 'none', 'k']
+        alphas = [1,1,1,1,1,1,1,1,1,0.7]
         handles = []
         for cands, colour, marker, zorder, size, fixedsize, lw, alpha, ec in \
                 zip(candlists, colours, markers, zorders, sizes, fixedsizes, lws, alphas, ecs):
@@ -977,6 +1029,8 @@ class Candlist(object):
               len(self.badlists['harmonic']))
         summaryfile.write("      # Candidates with DM problems: %d\n" % \
               len(self.badlists['dmproblem']))
+        summaryfile.write("      # Multibeam RFI rejects:       %d\n" % \
+              len(self.badlists['multibeam']))
         if summaryfilenm not in [None, sys.stdout, sys.stderr]:
             summaryfile.close()
   
@@ -1176,8 +1230,132 @@ def candlist_from_candfile(filename, trackbad=False, trackdupes=False):
     return Candlist(cands, trackbad=trackbad, trackdupes=trackdupes)
 
 
+def candlist_from_colsfile(filename, trackbad=False, trackdupes=False):
+    """Read the candidates from the columnar binary file that accelsearch
+        writes next to its text ACCEL file ('<ACCEL file>.cols') and
+        return them as a Candlist.  This gives the same candidates as
+        candlist_from_candfile() on the text file, but much faster.
+    """
+    ac = accelcols(filename)
+    # The candidates are named after the text ACCEL file
+    textname = filename[:-5] if filename.endswith(".cols") else filename
+    DMmatch = DM_re.search(filename)
+    DMstr = DMmatch.groups()[0] if DMmatch is not None else "%.2f" % ac.dm
+    tobs = ac.N * ac.dt
+    numharm = ac['numharm']
+    harmstart = ac['harmstart']
+    sigma, power, cpow = ac['sigma'], ac['power'], ac['cpow']
+    r, z = ac['r'], ac['z']
+    harm_pows = ac['h_pow'].astype(np.float64)
+    harm_amps = (np.sqrt(harm_pows) *
+                 np.exp(ac['h_phs'] * 1.0j)).astype(np.complex64)
+
+    cands = []
+    for ii in range(ac.numcands):
+        cand = Candidate(ii + 1, float(sigma[ii]), int(numharm[ii]),
+                         float(power[ii]), float(cpow[ii]), float(r[ii]),
+                         float(z[ii]), DMstr, textname, tobs)
+        lo = harmstart[ii]
+        cand.harm_pows = harm_pows[lo:lo + cand.numharm]
+        cand.harm_amps = harm_amps[lo:lo + cand.numharm]
+        # Compute the S/N and the "optimized" power and sigma
+        # (calculated assuming _1_ trial!) as for the text files
+        cand.harms_to_snr()
+        cand.ipow_det = np.sum(cand.harm_pows)
+        cand.sigma = candidate_sigma(cand.ipow_det, cand.numharm, 1)
+        # List candidate as a hit of itself
+        cand.hits = [(cand.DM, cand.snr, cand.sigma)]
+        cands.append(cand)
+    return Candlist(cands, trackbad=trackbad, trackdupes=trackdupes)
+
+
+def candlist_from_ffafile(filename, trackbad=False, trackdupes=False):
+    """Read the candidates from an ffasearch '_FFA' text file and
+        return them as a Candlist.  Each FFA candidate is treated as
+        a single-harmonic candidate with a power of (S/N)**2 / 2.
+    """
+    candfile = open(filename, 'r')
+    cands = []
+    numsamp, dt, DMstr = 0, 0.0, None
+    for line in candfile:
+        if line.startswith("# Number of bins in the time series"):
+            numsamp = int(line.split()[-1])
+        elif line.startswith("# Width of each time series bin (sec)"):
+            dt = float(line.split()[-1])
+        elif line.startswith("# Dispersion measure (cm-3 pc)"):
+            DMstr = "%.2f" % float(line.split()[-1])
+        elif line.startswith("#") or not line.strip():
+            continue
+        else:
+            tobs = numsamp * dt
+            split_line = line.split()
+            candnum = int(split_line[0])
+            sigma = float(split_line[1])
+            snr = float(split_line[2])
+            bin = float(split_line[5])
+            pow = 0.5 * snr * snr
+            DMmatch = DM_re.search(filename)
+            if DMmatch is not None:
+                DMstr = DMmatch.groups()[0]
+            cand = Candidate(candnum, sigma, 1, pow, pow, bin, 0.0,
+                             DMstr, filename, tobs)
+            cand.harm_pows = np.array([pow])
+            cand.snr = snr
+            cand.hits = [(cand.DM, cand.snr, cand.sigma)]
+            cands.append(cand)
+    candfile.close()
+    return Candlist(cands, trackbad=trackbad, trackdupes=trackdupes)
+
+
+def candlist_from_lsfile(filename, trackbad=False, trackdupes=False):
+    """Read the candidates from an lssearch '_LS' text file and
+        return them as a Candlist.  The normalized Lomb-Scargle
+        powers of the harmonics are listed after the candidates.
+    """
+    candfile = open(filename, 'r')
+    cands = []
+    harm_pows = {}
+    numsamp, dt, DMstr, inharms = 0, 0.0, None, False
+    for line in candfile:
+        if line.startswith("# Number of bins in the time series"):
+            numsamp = int(line.split()[-1])
+        elif line.startswith("# Width of each time series bin (sec)"):
+            dt = float(line.split()[-1])
+        elif line.startswith("# Dispersion measure (cm-3 pc)"):
+            DMstr = "%.2f" % float(line.split()[-1])
+        elif line.startswith("# Harmonic powers"):
+            inharms = True
+        elif line.startswith("#") or not line.strip():
+            continue
+        elif inharms:
+            split_line = line.split()
+            harm_pows.setdefault(int(split_line[0]), []).append(float(split_line[2]))
+        else:
+            tobs = numsamp * dt
+            split_line = line.split()
+            candnum = int(split_line[0])
+            sigma = float(split_line[1])
+            pow = float(split_line[2])
+            numharm = int(split_line[3])
+            bin = float(split_line[6])
+            DMmatch = DM_re.search(filename)
+            if DMmatch is not None:
+                DMstr = DMmatch.groups()[0]
+            cands.append(Candidate(candnum, sigma, numharm, pow, pow, bin, 0.0,
+                                   DMstr, filename, tobs))
+    candfile.close()
+    for cand in cands:
+        cand.harm_pows = np.array(harm_pows.get(cand.candnum, [cand.ipow_det]))
+        cand.harms_to_snr()
+        cand.hits = [(cand.DM, cand.snr, cand.sigma)]
+    return Candlist(cands, trackbad=trackbad, trackdupes=trackdupes)
+
+
 def read_candidates(filenms, prelim_reject=True, track=False):
-    """Read in accelsearch candidates from the test ACCEL files.
+    """Read in accelsearch (or ffasearch or lssearch) candidates from
+        the text ACCEL (or _FFA or _LS) files.  If there is a columnar
+        binary version of an ACCEL file ('<ACCEL file>.cols'), it is
+        read instead.
         Return a Candlist object of Candidate instances.
 
         Inputs:
@@ -1193,7 +1371,16 @@ def read_candidates(filenms, prelim_reject=True, track=False):
     if filenms:
         print("\nReading candidates from %d files...." % len(filenms))
         for ii, filenm in enumerate(filenms):
-            curr_candlist = candlist_from_candfile(filenm, trackbad=track, trackdupes=track)
+            if filenm.endswith(".cols"):
+                curr_candlist = candlist_from_colsfile(filenm, trackbad=track, trackdupes=track)
+            elif "_FFA" in filenm:
+                curr_candlist = candlist_from_ffafile(filenm, trackbad=track, trackdupes=track)
+            elif filenm.endswith("_LS"):
+                curr_candlist = candlist_from_lsfile(filenm, trackbad=track, trackdupes=track)
+            elif os.path.exists(filenm + ".cols"):
+                curr_candlist = candlist_from_colsfile(filenm + ".cols", trackbad=track, trackdupes=track)
+            else:
+                curr_candlist = candlist_from_candfile(filenm, trackbad=track, trackdupes=track)
             if prelim_reject:
                 curr_candlist.default_rejection()
             candlist.extend(curr_candlist)
@@ -3224,6 +3224,8 @@ static swig_module_info swig_module = {swig_types, 24, 0, 0, 0, 0};
 
 
 #include "presto.h"
+#include "mask.h"
+#include "presto_error.h"
 #include "errno.h"
 
 // A few function declarations from some functions not in headers
@@ -3984,6 +3986,21 @@ SWIG_From_long_SS_long  (long long value)
 
 
 
+static PyObject *presto_status_exception(presto_status status)
+{
+    switch (status) {
+    case PRESTO_ERR_NOMEM:
+        return PyExc_MemoryError;
+    case PRESTO_ERR_IO:
+        return PyExc_IOError;
+    case PRESTO_ERR_EOF:
+        return PyExc_EOFError;
+    default:
+        return PyExc_ValueError;
+    }
+}
+
+
 SWIGINTERN int
 SWIG_AsVal_int (PyObject * obj, int *val)
 {
@@ -4501,6 +4518,47 @@ SWIG_AsVal_unsigned_SS_long (PyObject *obj, unsigned long *val)
                           f0, fdot, fdotdot, standard);
     }
 
+
+    void wrap_rfifind_sweep(char *statsfilenm,
+                            float *timesigmas, long N1,
+                            float *freqsigmas, long N2,
+                            float *chantrigfracs, long N3,
+                            float *inttrigfracs, long N4,
+                            float *maskfracs, long N5,
+                            float *numzapchans, long N6,
+                            float *numzapints, long N7){
+        int ii, *zapchans, *zapints;
+        rfistats stats;
+
+        if (N2 != N1 || N3 != N1 || N4 != N1 ||
+            N5 != N1 || N6 != N1 || N7 != N1) {
+            errno = EINVAL;
+            return;
+        }
+        read_rfistats(statsfilenm, &stats);
+        zapchans = gen_ivect(N1);
+        zapints = gen_ivect(N1);
+        sweep_rfistats(&stats, N1, timesigmas, freqsigmas, chantrigfracs,
+                       inttrigfracs, maskfracs, zapchans, zapints);
+        for (ii = 0; ii < N1; ii++) {
+            numzapchans[ii] = zapchans[ii];
+            numzapints[ii] = zapints[ii];
+        }
+        vect_free(zapchans);
+        vect_free(zapints);
+        free_rfistats(&stats);
+    }
+
+
+    void wrap_median_filter(float *data, long N1,
+                            float *result, long N2, int medlen){
+        if (N2 != N1 || medlen < 1 || !(medlen & 1)) {
+            errno = EINVAL;
+            return;
+        }
+        median_filter(data, result, N1, medlen);
+    }
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -4526,7 +4584,18 @@ SWIGINTERN PyObject *_wrap_fcomplex_r_set(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "fcomplex_r_set" "', argument " "2"" of type '" "float""'");
   } 
   arg2 = (float)(val2);
-  if (arg1) (arg1)->r = arg2;
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      if (arg1) (arg1)->r = arg2;
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
@@ -4550,7 +4619,18 @@ SWIGINTERN PyObject *_wrap_fcomplex_r_get(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "fcomplex_r_get" "', argument " "1"" of type '" "struct FCOMPLEX *""'"); 
   }
   arg1 = (struct FCOMPLEX *)(argp1);
-  result = (float) ((arg1)->r);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      result = (float) ((arg1)->r);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_From_float((float)(result));
   return resultobj;
 fail:
@@ -4580,7 +4660,18 @@ SWIGINTERN PyObject *_wrap_fcomplex_i_set(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "fcomplex_i_set" "', argument " "2"" of type '" "float""'");
   } 
   arg2 = (float)(val2);
-  if (arg1) (arg1)->i = arg2;
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      if (arg1) (arg1)->i = arg2;
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
@@ -4604,7 +4695,18 @@ SWIGINTERN PyObject *_wrap_fcomplex_i_get(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "fcomplex_i_get" "', argument " "1"" of type '" "struct FCOMPLEX *""'"); 
   }
   arg1 = (struct FCOMPLEX *)(argp1);
-  result = (float) ((arg1)->i);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      result = (float) ((arg1)->i);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_From_float((float)(result));
   return resultobj;
 fail:
@@ -4619,8 +4721,17 @@ SWIGINTERN PyObject *_wrap_new_fcomplex(PyObject *self, PyObject *args) {
   (void)self;
   if (!SWIG_Python_UnpackTuple(args, "new_fcomplex", 0, 0, 0)) SWIG_fail;
   {
-    errno = 0;
-    result = (struct FCOMPLEX *)calloc(1, sizeof(struct FCOMPLEX));
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      errno = 0;
+      result = (struct FCOMPLEX *)calloc(1, sizeof(struct FCOMPLEX));
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
     
     if (errno != 0)
     {
@@ -4629,6 +4740,9 @@ SWIGINTERN PyObject *_wrap_new_fcomplex(PyObject *self, PyObject *args) {
       case ENOMEM:
         PyErr_Format(PyExc_MemoryError, "Failed malloc()");
         break;
+      case EINVAL:
+        PyErr_Format(PyExc_ValueError, "Invalid argument(s)");
+        break;
       default:
         PyErr_Format(PyExc_Exception, "Unknown exception");
       }
@@ -4658,8 +4772,17 @@ SWIGINTERN PyObject *_wrap_delete_fcomplex(PyObject *self, PyObject *args) {
   }
   arg1 = (struct FCOMPLEX *)(argp1);
   {
-    errno = 0;
-    free((char *) arg1);
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      errno = 0;
+      free((char *) arg1);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
     
     if (errno != 0)
     {
@@ -4668,6 +4791,9 @@ SWIGINTERN PyObject *_wrap_delete_fcomplex(PyObject *self, PyObject *args) {
       case ENOMEM:
         PyErr_Format(PyExc_MemoryError, "Failed malloc()");
         break;
+      case EINVAL:
+        PyErr_Format(PyExc_ValueError, "Invalid argument(s)");
+        break;
       default:
         PyErr_Format(PyExc_Exception, "Unknown exception");
       }
@@ -4697,7 +4823,18 @@ SWIGINTERN PyObject *_wrap_read_wisdom(PyObject *self, PyObject *args) {
   
   (void)self;
   if (!SWIG_Python_UnpackTuple(args, "read_wisdom", 0, 0, 0)) SWIG_fail;
-  read_wisdom();
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      read_wisdom();
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
@@ -4721,7 +4858,18 @@ SWIGINTERN PyObject *_wrap_good_factor(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(ecode1), "in method '" "good_factor" "', argument " "1"" of type '" "long long""'");
   } 
   arg1 = (long long)(val1);
-  result = (long long)good_factor(arg1);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      result = (long long)good_factor(arg1);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_From_long_SS_long((long long)(result));
   return resultobj;
 fail:
@@ -4755,7 +4903,18 @@ SWIGINTERN PyObject *_wrap_fftwcall(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "fftwcall" "', argument " "3"" of type '" "int""'");
   } 
   arg3 = (int)(val3);
-  fftwcall(arg1,arg2,arg3);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      fftwcall(arg1,arg2,arg3);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
@@ -4789,7 +4948,18 @@ SWIGINTERN PyObject *_wrap_tablesixstepfft(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "tablesixstepfft" "', argument " "3"" of type '" "int""'");
   } 
   arg3 = (int)(val3);
-  tablesixstepfft(arg1,arg2,arg3);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      tablesixstepfft(arg1,arg2,arg3);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
@@ -4823,7 +4993,18 @@ SWIGINTERN PyObject *_wrap_realfft(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(ecode3), "in method '" "realfft" "', argument " "3"" of type '" "int""'");
   } 
   arg3 = (int)(val3);
-  realfft(arg1,arg2,arg3);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      realfft(arg1,arg2,arg3);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
@@ -4853,7 +5034,18 @@ SWIGINTERN PyObject *_wrap_infodata_ra_s_set(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "infodata_ra_s_set" "', argument " "2"" of type '" "double""'");
   } 
   arg2 = (double)(val2);
-  if (arg1) (arg1)->ra_s = arg2;
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      if (arg1) (arg1)->ra_s = arg2;
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
@@ -4877,7 +5069,18 @@ SWIGINTERN PyObject *_wrap_infodata_ra_s_get(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "infodata_ra_s_get" "', argument " "1"" of type '" "struct INFODATA *""'"); 
   }
   arg1 = (struct INFODATA *)(argp1);
-  result = (double) ((arg1)->ra_s);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      result = (double) ((arg1)->ra_s);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_From_double((double)(result));
   return resultobj;
 fail:
@@ -4907,7 +5110,18 @@ SWIGINTERN PyObject *_wrap_infodata_dec_s_set(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "infodata_dec_s_set" "', argument " "2"" of type '" "double""'");
   } 
   arg2 = (double)(val2);
-  if (arg1) (arg1)->dec_s = arg2;
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      if (arg1) (arg1)->dec_s = arg2;
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
@@ -4931,7 +5145,18 @@ SWIGINTERN PyObject *_wrap_infodata_dec_s_get(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "infodata_dec_s_get" "', argument " "1"" of type '" "struct INFODATA *""'"); 
   }
   arg1 = (struct INFODATA *)(argp1);
-  result = (double) ((arg1)->dec_s);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      result = (double) ((arg1)->dec_s);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_From_double((double)(result));
   return resultobj;
 fail:
@@ -4961,7 +5186,18 @@ SWIGINTERN PyObject *_wrap_infodata_N_set(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "infodata_N_set" "', argument " "2"" of type '" "double""'");
   } 
   arg2 = (double)(val2);
-  if (arg1) (arg1)->N = arg2;
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      if (arg1) (arg1)->N = arg2;
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
@@ -4985,7 +5221,18 @@ SWIGINTERN PyObject *_wrap_infodata_N_get(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "infodata_N_get" "', argument " "1"" of type '" "struct INFODATA *""'"); 
   }
   arg1 = (struct INFODATA *)(argp1);
-  result = (double) ((arg1)->N);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      result = (double) ((arg1)->N);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_From_double((double)(result));
   return resultobj;
 fail:
@@ -5015,7 +5262,18 @@ SWIGINTERN PyObject *_wrap_infodata_dt_set(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "infodata_dt_set" "', argument " "2"" of type '" "double""'");
   } 
   arg2 = (double)(val2);
-  if (arg1) (arg1)->dt = arg2;
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      if (arg1) (arg1)->dt = arg2;
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
@@ -5039,7 +5297,18 @@ SWIGINTERN PyObject *_wrap_infodata_dt_get(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "infodata_dt_get" "', argument " "1"" of type '" "struct INFODATA *""'"); 
   }
   arg1 = (struct INFODATA *)(argp1);
-  result = (double) ((arg1)->dt);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      result = (double) ((arg1)->dt);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_From_double((double)(result));
   return resultobj;
 fail:
@@ -5069,7 +5338,18 @@ SWIGINTERN PyObject *_wrap_infodata_fov_set(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "infodata_fov_set" "', argument " "2"" of type '" "double""'");
   } 
   arg2 = (double)(val2);
-  if (arg1) (arg1)->fov = arg2;
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      if (arg1) (arg1)->fov = arg2;
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
@@ -5093,7 +5373,18 @@ SWIGINTERN PyObject *_wrap_infodata_fov_get(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "infodata_fov_get" "', argument " "1"" of type '" "struct INFODATA *""'"); 
   }
   arg1 = (struct INFODATA *)(argp1);
-  result = (double) ((arg1)->fov);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      result = (double) ((arg1)->fov);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_From_double((double)(result));
   return resultobj;
 fail:
@@ -5123,7 +5414,18 @@ SWIGINTERN PyObject *_wrap_infodata_mjd_f_set(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "infodata_mjd_f_set" "', argument " "2"" of type '" "double""'");
   } 
   arg2 = (double)(val2);
-  if (arg1) (arg1)->mjd_f = arg2;
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      if (arg1) (arg1)->mjd_f = arg2;
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
@@ -5147,7 +5449,18 @@ SWIGINTERN PyObject *_wrap_infodata_mjd_f_get(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "infodata_mjd_f_get" "', argument " "1"" of type '" "struct INFODATA *""'"); 
   }
   arg1 = (struct INFODATA *)(argp1);
-  result = (double) ((arg1)->mjd_f);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      result = (double) ((arg1)->mjd_f);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_From_double((double)(result));
   return resultobj;
 fail:
@@ -5177,7 +5490,18 @@ SWIGINTERN PyObject *_wrap_infodata_dm_set(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "infodata_dm_set" "', argument " "2"" of type '" "double""'");
   } 
   arg2 = (double)(val2);
-  if (arg1) (arg1)->dm = arg2;
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      if (arg1) (arg1)->dm = arg2;
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
@@ -5201,7 +5525,18 @@ SWIGINTERN PyObject *_wrap_infodata_dm_get(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "infodata_dm_get" "', argument " "1"" of type '" "struct INFODATA *""'"); 
   }
   arg1 = (struct INFODATA *)(argp1);
-  result = (double) ((arg1)->dm);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      result = (double) ((arg1)->dm);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_From_double((double)(result));
   return resultobj;
 fail:
@@ -5231,7 +5566,18 @@ SWIGINTERN PyObject *_wrap_infodata_freq_set(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "infodata_freq_set" "', argument " "2"" of type '" "double""'");
   } 
   arg2 = (double)(val2);
-  if (arg1) (arg1)->freq = arg2;
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      if (arg1) (arg1)->freq = arg2;
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
@@ -5255,7 +5601,18 @@ SWIGINTERN PyObject *_wrap_infodata_freq_get(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "infodata_freq_get" "', argument " "1"" of type '" "struct INFODATA *""'"); 
   }
   arg1 = (struct INFODATA *)(argp1);
-  result = (double) ((arg1)->freq);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      result = (double) ((arg1)->freq);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_From_double((double)(result));
   return resultobj;
 fail:
@@ -5285,7 +5642,18 @@ SWIGINTERN PyObject *_wrap_infodata_freqband_set(PyObject *self, PyObject *args)
     SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "infodata_freqband_set" "', argument " "2"" of type '" "double""'");
   } 
   arg2 = (double)(val2);
-  if (arg1) (arg1)->freqband = arg2;
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      if (arg1) (arg1)->freqband = arg2;
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
@@ -5309,7 +5677,18 @@ SWIGINTERN PyObject *_wrap_infodata_freqband_get(PyObject *self, PyObject *args)
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "infodata_freqband_get" "', argument " "1"" of type '" "struct INFODATA *""'"); 
   }
   arg1 = (struct INFODATA *)(argp1);
-  result = (double) ((arg1)->freqband);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      result = (double) ((arg1)->freqband);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_From_double((double)(result));
   return resultobj;
 fail:
@@ -5339,7 +5718,18 @@ SWIGINTERN PyObject *_wrap_infodata_chan_wid_set(PyObject *self, PyObject *args)
     SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "infodata_chan_wid_set" "', argument " "2"" of type '" "double""'");
   } 
   arg2 = (double)(val2);
-  if (arg1) (arg1)->chan_wid = arg2;
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      if (arg1) (arg1)->chan_wid = arg2;
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
@@ -5363,7 +5753,18 @@ SWIGINTERN PyObject *_wrap_infodata_chan_wid_get(PyObject *self, PyObject *args)
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "infodata_chan_wid_get" "', argument " "1"" of type '" "struct INFODATA *""'"); 
   }
   arg1 = (struct INFODATA *)(argp1);
-  result = (double) ((arg1)->chan_wid);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      result = (double) ((arg1)->chan_wid);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_From_double((double)(result));
   return resultobj;
 fail:
@@ -5393,7 +5794,18 @@ SWIGINTERN PyObject *_wrap_infodata_wavelen_set(PyObject *self, PyObject *args)
     SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "infodata_wavelen_set" "', argument " "2"" of type '" "double""'");
   } 
   arg2 = (double)(val2);
-  if (arg1) (arg1)->wavelen = arg2;
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      if (arg1) (arg1)->wavelen = arg2;
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
@@ -5417,7 +5829,18 @@ SWIGINTERN PyObject *_wrap_infodata_wavelen_get(PyObject *self, PyObject *args)
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "infodata_wavelen_get" "', argument " "1"" of type '" "struct INFODATA *""'"); 
   }
   arg1 = (struct INFODATA *)(argp1);
-  result = (double) ((arg1)->wavelen);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      result = (double) ((arg1)->wavelen);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_From_double((double)(result));
   return resultobj;
 fail:
@@ -5447,7 +5870,18 @@ SWIGINTERN PyObject *_wrap_infodata_waveband_set(PyObject *self, PyObject *args)
     SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "infodata_waveband_set" "', argument " "2"" of type '" "double""'");
   } 
   arg2 = (double)(val2);
-  if (arg1) (arg1)->waveband = arg2;
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      if (arg1) (arg1)->waveband = arg2;
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
@@ -5471,7 +5905,18 @@ SWIGINTERN PyObject *_wrap_infodata_waveband_get(PyObject *self, PyObject *args)
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "infodata_waveband_get" "', argument " "1"" of type '" "struct INFODATA *""'"); 
   }
   arg1 = (struct INFODATA *)(argp1);
-  result = (double) ((arg1)->waveband);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      result = (double) ((arg1)->waveband);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_From_double((double)(result));
   return resultobj;
 fail:
@@ -5501,7 +5946,18 @@ SWIGINTERN PyObject *_wrap_infodata_energy_set(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "infodata_energy_set" "', argument " "2"" of type '" "double""'");
   } 
   arg2 = (double)(val2);
-  if (arg1) (arg1)->energy = arg2;
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      if (arg1) (arg1)->energy = arg2;
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
@@ -5525,7 +5981,18 @@ SWIGINTERN PyObject *_wrap_infodata_energy_get(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "infodata_energy_get" "', argument " "1"" of type '" "struct INFODATA *""'"); 
   }
   arg1 = (struct INFODATA *)(argp1);
-  result = (double) ((arg1)->energy);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      result = (double) ((arg1)->energy);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_From_double((double)(result));
   return resultobj;
 fail:
@@ -5555,7 +6022,18 @@ SWIGINTERN PyObject *_wrap_infodata_energyband_set(PyObject *self, PyObject *arg
     SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "infodata_energyband_set" "', argument " "2"" of type '" "double""'");
   } 
   arg2 = (double)(val2);
-  if (arg1) (arg1)->energyband = arg2;
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      if (arg1) (arg1)->energyband = arg2;
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
@@ -5579,7 +6057,18 @@ SWIGINTERN PyObject *_wrap_infodata_energyband_get(PyObject *self, PyObject *arg
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "infodata_energyband_get" "', argument " "1"" of type '" "struct INFODATA *""'"); 
   }
   arg1 = (struct INFODATA *)(argp1);
-  result = (double) ((arg1)->energyband);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      result = (double) ((arg1)->energyband);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_From_double((double)(result));
   return resultobj;
 fail:
@@ -5609,7 +6098,18 @@ SWIGINTERN PyObject *_wrap_infodata_num_chan_set(PyObject *self, PyObject *args)
     SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "infodata_num_chan_set" "', argument " "2"" of type '" "int""'");
   } 
   arg2 = (int)(val2);
-  if (arg1) (arg1)->num_chan = arg2;
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      if (arg1) (arg1)->num_chan = arg2;
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
@@ -5633,7 +6133,18 @@ SWIGINTERN PyObject *_wrap_infodata_num_chan_get(PyObject *self, PyObject *args)
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "infodata_num_chan_get" "', argument " "1"" of type '" "struct INFODATA *""'"); 
   }
   arg1 = (struct INFODATA *)(argp1);
-  result = (int) ((arg1)->num_chan);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      result = (int) ((arg1)->num_chan);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_From_int((int)(result));
   return resultobj;
 fail:
@@ -5663,7 +6174,18 @@ SWIGINTERN PyObject *_wrap_infodata_mjd_i_set(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "infodata_mjd_i_set" "', argument " "2"" of type '" "int""'");
   } 
   arg2 = (int)(val2);
-  if (arg1) (arg1)->mjd_i = arg2;
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      if (arg1) (arg1)->mjd_i = arg2;
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
@@ -5687,7 +6209,18 @@ SWIGINTERN PyObject *_wrap_infodata_mjd_i_get(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "infodata_mjd_i_get" "', argument " "1"" of type '" "struct INFODATA *""'"); 
   }
   arg1 = (struct INFODATA *)(argp1);
-  result = (int) ((arg1)->mjd_i);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      result = (int) ((arg1)->mjd_i);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_From_int((int)(result));
   return resultobj;
 fail:
@@ -5717,7 +6250,18 @@ SWIGINTERN PyObject *_wrap_infodata_ra_h_set(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "infodata_ra_h_set" "', argument " "2"" of type '" "int""'");
   } 
   arg2 = (int)(val2);
-  if (arg1) (arg1)->ra_h = arg2;
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      if (arg1) (arg1)->ra_h = arg2;
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
@@ -5741,7 +6285,18 @@ SWIGINTERN PyObject *_wrap_infodata_ra_h_get(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "infodata_ra_h_get" "', argument " "1"" of type '" "struct INFODATA *""'"); 
   }
   arg1 = (struct INFODATA *)(argp1);
-  result = (int) ((arg1)->ra_h);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      result = (int) ((arg1)->ra_h);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_From_int((int)(result));
   return resultobj;
 fail:
@@ -5771,7 +6326,18 @@ SWIGINTERN PyObject *_wrap_infodata_ra_m_set(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "infodata_ra_m_set" "', argument " "2"" of type '" "int""'");
   } 
   arg2 = (int)(val2);
-  if (arg1) (arg1)->ra_m = arg2;
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      if (arg1) (arg1)->ra_m = arg2;
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
@@ -5795,7 +6361,18 @@ SWIGINTERN PyObject *_wrap_infodata_ra_m_get(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "infodata_ra_m_get" "', argument " "1"" of type '" "struct INFODATA *""'"); 
   }
   arg1 = (struct INFODATA *)(argp1);
-  result = (int) ((arg1)->ra_m);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      result = (int) ((arg1)->ra_m);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_From_int((int)(result));
   return resultobj;
 fail:
@@ -5825,7 +6402,18 @@ SWIGINTERN PyObject *_wrap_infodata_dec_d_set(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "infodata_dec_d_set" "', argument " "2"" of type '" "int""'");
   } 
   arg2 = (int)(val2);
-  if (arg1) (arg1)->dec_d = arg2;
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      if (arg1) (arg1)->dec_d = arg2;
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
@@ -5849,11 +6437,22 @@ SWIGINTERN PyObject *_wrap_infodata_dec_d_get(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "infodata_dec_d_get" "', argument " "1"" of type '" "struct INFODATA *""'"); 
   }
   arg1 = (struct INFODATA *)(argp1);
-  result = (int) ((arg1)->dec_d);
-  resultobj = SWIG_From_int((int)(result));
-  return resultobj;
-fail:
-  return NULL;
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      result = (int) ((arg1)->dec_d);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
+  resultobj = SWIG_From_int((int)(result));
+  return resultobj;
+fail:
+  return NULL;
 }
 
 
@@ -5879,7 +6478,18 @@ SWIGINTERN PyObject *_wrap_infodata_dec_m_set(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "infodata_dec_m_set" "', argument " "2"" of type '" "int""'");
   } 
   arg2 = (int)(val2);
-  if (arg1) (arg1)->dec_m = arg2;
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      if (arg1) (arg1)->dec_m = arg2;
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
@@ -5903,7 +6513,18 @@ SWIGINTERN PyObject *_wrap_infodata_dec_m_get(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "infodata_dec_m_get" "', argument " "1"" of type '" "struct INFODATA *""'"); 
   }
   arg1 = (struct INFODATA *)(argp1);
-  result = (int) ((arg1)->dec_m);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      result = (int) ((arg1)->dec_m);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_From_int((int)(result));
   return resultobj;
 fail:
@@ -5933,7 +6554,18 @@ SWIGINTERN PyObject *_wrap_infodata_bary_set(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "infodata_bary_set" "', argument " "2"" of type '" "int""'");
   } 
   arg2 = (int)(val2);
-  if (arg1) (arg1)->bary = arg2;
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      if (arg1) (arg1)->bary = arg2;
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
@@ -5957,7 +6589,18 @@ SWIGINTERN PyObject *_wrap_infodata_bary_get(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "infodata_bary_get" "', argument " "1"" of type '" "struct INFODATA *""'"); 
   }
   arg1 = (struct INFODATA *)(argp1);
-  result = (int) ((arg1)->bary);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      result = (int) ((arg1)->bary);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_From_int((int)(result));
   return resultobj;
 fail:
@@ -5987,7 +6630,18 @@ SWIGINTERN PyObject *_wrap_infodata_numonoff_set(PyObject *self, PyObject *args)
     SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "infodata_numonoff_set" "', argument " "2"" of type '" "int""'");
   } 
   arg2 = (int)(val2);
-  if (arg1) (arg1)->numonoff = arg2;
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      if (arg1) (arg1)->numonoff = arg2;
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
@@ -6011,7 +6665,18 @@ SWIGINTERN PyObject *_wrap_infodata_numonoff_get(PyObject *self, PyObject *args)
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "infodata_numonoff_get" "', argument " "1"" of type '" "struct INFODATA *""'"); 
   }
   arg1 = (struct INFODATA *)(argp1);
-  result = (int) ((arg1)->numonoff);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      result = (int) ((arg1)->numonoff);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_From_int((int)(result));
   return resultobj;
 fail:
@@ -6042,7 +6707,18 @@ SWIGINTERN PyObject *_wrap_infodata_notes_set(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "infodata_notes_set" "', argument " "2"" of type '" "char *""'");
   }
   arg2 = (char *)(buf2);
-  INFODATA_notes_set(arg1,arg2);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      INFODATA_notes_set(arg1,arg2);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_Py_Void();
   if (alloc2 == SWIG_NEWOBJ) free((char*)buf2);
   return resultobj;
@@ -6068,7 +6744,18 @@ SWIGINTERN PyObject *_wrap_infodata_notes_get(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "infodata_notes_get" "', argument " "1"" of type '" "struct INFODATA *""'"); 
   }
   arg1 = (struct INFODATA *)(argp1);
-  result = (char *)INFODATA_notes_get(arg1);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      result = (char *)INFODATA_notes_get(arg1);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_FromCharPtr((const char *)result);
   return resultobj;
 fail:
@@ -6099,7 +6786,18 @@ SWIGINTERN PyObject *_wrap_infodata_name_set(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "infodata_name_set" "', argument " "2"" of type '" "char *""'");
   }
   arg2 = (char *)(buf2);
-  INFODATA_name_set(arg1,arg2);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      INFODATA_name_set(arg1,arg2);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_Py_Void();
   if (alloc2 == SWIG_NEWOBJ) free((char*)buf2);
   return resultobj;
@@ -6125,7 +6823,18 @@ SWIGINTERN PyObject *_wrap_infodata_name_get(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "infodata_name_get" "', argument " "1"" of type '" "struct INFODATA *""'"); 
   }
   arg1 = (struct INFODATA *)(argp1);
-  result = (char *)INFODATA_name_get(arg1);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      result = (char *)INFODATA_name_get(arg1);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_FromCharPtr((const char *)result);
   return resultobj;
 fail:
@@ -6156,7 +6865,18 @@ SWIGINTERN PyObject *_wrap_infodata_object_set(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "infodata_object_set" "', argument " "2"" of type '" "char *""'");
   }
   arg2 = (char *)(buf2);
-  INFODATA_object_set(arg1,arg2);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      INFODATA_object_set(arg1,arg2);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_Py_Void();
   if (alloc2 == SWIG_NEWOBJ) free((char*)buf2);
   return resultobj;
@@ -6182,7 +6902,18 @@ SWIGINTERN PyObject *_wrap_infodata_object_get(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "infodata_object_get" "', argument " "1"" of type '" "struct INFODATA *""'"); 
   }
   arg1 = (struct INFODATA *)(argp1);
-  result = (char *)INFODATA_object_get(arg1);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      result = (char *)INFODATA_object_get(arg1);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_FromCharPtr((const char *)result);
   return resultobj;
 fail:
@@ -6213,7 +6944,18 @@ SWIGINTERN PyObject *_wrap_infodata_instrument_set(PyObject *self, PyObject *arg
     SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "infodata_instrument_set" "', argument " "2"" of type '" "char *""'");
   }
   arg2 = (char *)(buf2);
-  INFODATA_instrument_set(arg1,arg2);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      INFODATA_instrument_set(arg1,arg2);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_Py_Void();
   if (alloc2 == SWIG_NEWOBJ) free((char*)buf2);
   return resultobj;
@@ -6239,7 +6981,18 @@ SWIGINTERN PyObject *_wrap_infodata_instrument_get(PyObject *self, PyObject *arg
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "infodata_instrument_get" "', argument " "1"" of type '" "struct INFODATA *""'"); 
   }
   arg1 = (struct INFODATA *)(argp1);
-  result = (char *)INFODATA_instrument_get(arg1);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      result = (char *)INFODATA_instrument_get(arg1);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_FromCharPtr((const char *)result);
   return resultobj;
 fail:
@@ -6270,7 +7023,18 @@ SWIGINTERN PyObject *_wrap_infodata_observer_set(PyObject *self, PyObject *args)
     SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "infodata_observer_set" "', argument " "2"" of type '" "char *""'");
   }
   arg2 = (char *)(buf2);
-  INFODATA_observer_set(arg1,arg2);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      INFODATA_observer_set(arg1,arg2);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_Py_Void();
   if (alloc2 == SWIG_NEWOBJ) free((char*)buf2);
   return resultobj;
@@ -6296,7 +7060,18 @@ SWIGINTERN PyObject *_wrap_infodata_observer_get(PyObject *self, PyObject *args)
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "infodata_observer_get" "', argument " "1"" of type '" "struct INFODATA *""'"); 
   }
   arg1 = (struct INFODATA *)(argp1);
-  result = (char *)INFODATA_observer_get(arg1);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      result = (char *)INFODATA_observer_get(arg1);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_FromCharPtr((const char *)result);
   return resultobj;
 fail:
@@ -6327,7 +7102,18 @@ SWIGINTERN PyObject *_wrap_infodata_analyzer_set(PyObject *self, PyObject *args)
     SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "infodata_analyzer_set" "', argument " "2"" of type '" "char *""'");
   }
   arg2 = (char *)(buf2);
-  INFODATA_analyzer_set(arg1,arg2);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      INFODATA_analyzer_set(arg1,arg2);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_Py_Void();
   if (alloc2 == SWIG_NEWOBJ) free((char*)buf2);
   return resultobj;
@@ -6353,7 +7139,18 @@ SWIGINTERN PyObject *_wrap_infodata_analyzer_get(PyObject *self, PyObject *args)
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "infodata_analyzer_get" "', argument " "1"" of type '" "struct INFODATA *""'"); 
   }
   arg1 = (struct INFODATA *)(argp1);
-  result = (char *)INFODATA_analyzer_get(arg1);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      result = (char *)INFODATA_analyzer_get(arg1);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_FromCharPtr((const char *)result);
   return resultobj;
 fail:
@@ -6384,7 +7181,18 @@ SWIGINTERN PyObject *_wrap_infodata_telescope_set(PyObject *self, PyObject *args
     SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "infodata_telescope_set" "', argument " "2"" of type '" "char *""'");
   }
   arg2 = (char *)(buf2);
-  INFODATA_telescope_set(arg1,arg2);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      INFODATA_telescope_set(arg1,arg2);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_Py_Void();
   if (alloc2 == SWIG_NEWOBJ) free((char*)buf2);
   return resultobj;
@@ -6410,7 +7218,18 @@ SWIGINTERN PyObject *_wrap_infodata_telescope_get(PyObject *self, PyObject *args
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "infodata_telescope_get" "', argument " "1"" of type '" "struct INFODATA *""'"); 
   }
   arg1 = (struct INFODATA *)(argp1);
-  result = (char *)INFODATA_telescope_get(arg1);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      result = (char *)INFODATA_telescope_get(arg1);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_FromCharPtr((const char *)result);
   return resultobj;
 fail:
@@ -6441,7 +7260,18 @@ SWIGINTERN PyObject *_wrap_infodata_band_set(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "infodata_band_set" "', argument " "2"" of type '" "char *""'");
   }
   arg2 = (char *)(buf2);
-  INFODATA_band_set(arg1,arg2);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      INFODATA_band_set(arg1,arg2);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_Py_Void();
   if (alloc2 == SWIG_NEWOBJ) free((char*)buf2);
   return resultobj;
@@ -6467,7 +7297,18 @@ SWIGINTERN PyObject *_wrap_infodata_band_get(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "infodata_band_get" "', argument " "1"" of type '" "struct INFODATA *""'"); 
   }
   arg1 = (struct INFODATA *)(argp1);
-  result = (char *)INFODATA_band_get(arg1);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      result = (char *)INFODATA_band_get(arg1);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_FromCharPtr((const char *)result);
   return resultobj;
 fail:
@@ -6498,7 +7339,18 @@ SWIGINTERN PyObject *_wrap_infodata_filt_set(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "infodata_filt_set" "', argument " "2"" of type '" "char *""'");
   }
   arg2 = (char *)(buf2);
-  INFODATA_filt_set(arg1,arg2);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      INFODATA_filt_set(arg1,arg2);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_Py_Void();
   if (alloc2 == SWIG_NEWOBJ) free((char*)buf2);
   return resultobj;
@@ -6524,7 +7376,18 @@ SWIGINTERN PyObject *_wrap_infodata_filt_get(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "infodata_filt_get" "', argument " "1"" of type '" "struct INFODATA *""'"); 
   }
   arg1 = (struct INFODATA *)(argp1);
-  result = (char *)INFODATA_filt_get(arg1);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      result = (char *)INFODATA_filt_get(arg1);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_FromCharPtr((const char *)result);
   return resultobj;
 fail:
@@ -6539,8 +7402,17 @@ SWIGINTERN PyObject *_wrap_new_infodata(PyObject *self, PyObject *args) {
   (void)self;
   if (!SWIG_Python_UnpackTuple(args, "new_infodata", 0, 0, 0)) SWIG_fail;
   {
-    errno = 0;
-    result = (struct INFODATA *)calloc(1, sizeof(struct INFODATA));
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      errno = 0;
+      result = (struct INFODATA *)calloc(1, sizeof(struct INFODATA));
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
     
     if (errno != 0)
     {
@@ -6549,6 +7421,9 @@ SWIGINTERN PyObject *_wrap_new_infodata(PyObject *self, PyObject *args) {
       case ENOMEM:
         PyErr_Format(PyExc_MemoryError, "Failed malloc()");
         break;
+      case EINVAL:
+        PyErr_Format(PyExc_ValueError, "Invalid argument(s)");
+        break;
       default:
         PyErr_Format(PyExc_Exception, "Unknown exception");
       }
@@ -6578,8 +7453,17 @@ SWIGINTERN PyObject *_wrap_delete_infodata(PyObject *self, PyObject *args) {
   }
   arg1 = (struct INFODATA *)(argp1);
   {
-    errno = 0;
-    free((char *) arg1);
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      errno = 0;
+      free((char *) arg1);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
     
     if (errno != 0)
     {
@@ -6588,6 +7472,9 @@ SWIGINTERN PyObject *_wrap_delete_infodata(PyObject *self, PyObject *args) {
       case ENOMEM:
         PyErr_Format(PyExc_MemoryError, "Failed malloc()");
         break;
+      case EINVAL:
+        PyErr_Format(PyExc_ValueError, "Invalid argument(s)");
+        break;
       default:
         PyErr_Format(PyExc_Exception, "Unknown exception");
       }
@@ -6635,7 +7522,18 @@ SWIGINTERN PyObject *_wrap_readinf(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "readinf" "', argument " "2"" of type '" "char *""'");
   }
   arg2 = (char *)(buf2);
-  readinf(arg1,arg2);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      readinf(arg1,arg2);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_Py_Void();
   if (alloc2 == SWIG_NEWOBJ) free((char*)buf2);
   return resultobj;
@@ -6660,7 +7558,18 @@ SWIGINTERN PyObject *_wrap_writeinf(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "writeinf" "', argument " "1"" of type '" "infodata *""'"); 
   }
   arg1 = (infodata *)(argp1);
-  writeinf(arg1);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      writeinf(arg1);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
@@ -6690,7 +7599,18 @@ SWIGINTERN PyObject *_wrap_orbitparams_p_set(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "orbitparams_p_set" "', argument " "2"" of type '" "double""'");
   } 
   arg2 = (double)(val2);
-  if (arg1) (arg1)->p = arg2;
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      if (arg1) (arg1)->p = arg2;
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
@@ -6714,7 +7634,18 @@ SWIGINTERN PyObject *_wrap_orbitparams_p_get(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "orbitparams_p_get" "', argument " "1"" of type '" "struct orbitparams *""'"); 
   }
   arg1 = (struct orbitparams *)(argp1);
-  result = (double) ((arg1)->p);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      result = (double) ((arg1)->p);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_From_double((double)(result));
   return resultobj;
 fail:
@@ -6744,7 +7675,18 @@ SWIGINTERN PyObject *_wrap_orbitparams_e_set(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "orbitparams_e_set" "', argument " "2"" of type '" "double""'");
   } 
   arg2 = (double)(val2);
-  if (arg1) (arg1)->e = arg2;
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      if (arg1) (arg1)->e = arg2;
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
@@ -6768,7 +7710,18 @@ SWIGINTERN PyObject *_wrap_orbitparams_e_get(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "orbitparams_e_get" "', argument " "1"" of type '" "struct orbitparams *""'"); 
   }
   arg1 = (struct orbitparams *)(argp1);
-  result = (double) ((arg1)->e);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      result = (double) ((arg1)->e);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_From_double((double)(result));
   return resultobj;
 fail:
@@ -6798,7 +7751,18 @@ SWIGINTERN PyObject *_wrap_orbitparams_x_set(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "orbitparams_x_set" "', argument " "2"" of type '" "double""'");
   } 
   arg2 = (double)(val2);
-  if (arg1) (arg1)->x = arg2;
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      if (arg1) (arg1)->x = arg2;
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
@@ -6822,7 +7786,18 @@ SWIGINTERN PyObject *_wrap_orbitparams_x_get(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "orbitparams_x_get" "', argument " "1"" of type '" "struct orbitparams *""'"); 
   }
   arg1 = (struct orbitparams *)(argp1);
-  result = (double) ((arg1)->x);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      result = (double) ((arg1)->x);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_From_double((double)(result));
   return resultobj;
 fail:
@@ -6852,7 +7827,18 @@ SWIGINTERN PyObject *_wrap_orbitparams_w_set(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "orbitparams_w_set" "', argument " "2"" of type '" "double""'");
   } 
   arg2 = (double)(val2);
-  if (arg1) (arg1)->w = arg2;
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      if (arg1) (arg1)->w = arg2;
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
@@ -6876,7 +7862,18 @@ SWIGINTERN PyObject *_wrap_orbitparams_w_get(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "orbitparams_w_get" "', argument " "1"" of type '" "struct orbitparams *""'"); 
   }
   arg1 = (struct orbitparams *)(argp1);
-  result = (double) ((arg1)->w);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      result = (double) ((arg1)->w);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_From_double((double)(result));
   return resultobj;
 fail:
@@ -6906,7 +7903,18 @@ SWIGINTERN PyObject *_wrap_orbitparams_t_set(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "orbitparams_t_set" "', argument " "2"" of type '" "double""'");
   } 
   arg2 = (double)(val2);
-  if (arg1) (arg1)->t = arg2;
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      if (arg1) (arg1)->t = arg2;
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
@@ -6930,7 +7938,18 @@ SWIGINTERN PyObject *_wrap_orbitparams_t_get(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "orbitparams_t_get" "', argument " "1"" of type '" "struct orbitparams *""'"); 
   }
   arg1 = (struct orbitparams *)(argp1);
-  result = (double) ((arg1)->t);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      result = (double) ((arg1)->t);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_From_double((double)(result));
   return resultobj;
 fail:
@@ -6960,7 +7979,18 @@ SWIGINTERN PyObject *_wrap_orbitparams_pd_set(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "orbitparams_pd_set" "', argument " "2"" of type '" "double""'");
   } 
   arg2 = (double)(val2);
-  if (arg1) (arg1)->pd = arg2;
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      if (arg1) (arg1)->pd = arg2;
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
@@ -6984,7 +8014,18 @@ SWIGINTERN PyObject *_wrap_orbitparams_pd_get(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "orbitparams_pd_get" "', argument " "1"" of type '" "struct orbitparams *""'"); 
   }
   arg1 = (struct orbitparams *)(argp1);
-  result = (double) ((arg1)->pd);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      result = (double) ((arg1)->pd);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_From_double((double)(result));
   return resultobj;
 fail:
@@ -7014,7 +8055,18 @@ SWIGINTERN PyObject *_wrap_orbitparams_wd_set(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "orbitparams_wd_set" "', argument " "2"" of type '" "double""'");
   } 
   arg2 = (double)(val2);
-  if (arg1) (arg1)->wd = arg2;
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      if (arg1) (arg1)->wd = arg2;
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
@@ -7038,7 +8090,18 @@ SWIGINTERN PyObject *_wrap_orbitparams_wd_get(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "orbitparams_wd_get" "', argument " "1"" of type '" "struct orbitparams *""'"); 
   }
   arg1 = (struct orbitparams *)(argp1);
-  result = (double) ((arg1)->wd);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      result = (double) ((arg1)->wd);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_From_double((double)(result));
   return resultobj;
 fail:
@@ -7053,8 +8116,17 @@ SWIGINTERN PyObject *_wrap_new_orbitparams(PyObject *self, PyObject *args) {
   (void)self;
   if (!SWIG_Python_UnpackTuple(args, "new_orbitparams", 0, 0, 0)) SWIG_fail;
   {
-    errno = 0;
-    result = (struct orbitparams *)calloc(1, sizeof(struct orbitparams));
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      errno = 0;
+      result = (struct orbitparams *)calloc(1, sizeof(struct orbitparams));
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
     
     if (errno != 0)
     {
@@ -7063,6 +8135,9 @@ SWIGINTERN PyObject *_wrap_new_orbitparams(PyObject *self, PyObject *args) {
       case ENOMEM:
         PyErr_Format(PyExc_MemoryError, "Failed malloc()");
         break;
+      case EINVAL:
+        PyErr_Format(PyExc_ValueError, "Invalid argument(s)");
+        break;
       default:
         PyErr_Format(PyExc_Exception, "Unknown exception");
       }
@@ -7092,8 +8167,17 @@ SWIGINTERN PyObject *_wrap_delete_orbitparams(PyObject *self, PyObject *args) {
   }
   arg1 = (struct orbitparams *)(argp1);
   {
-    errno = 0;
-    free((char *) arg1);
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      errno = 0;
+      free((char *) arg1);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
     
     if (errno != 0)
     {
@@ -7102,6 +8186,9 @@ SWIGINTERN PyObject *_wrap_delete_orbitparams(PyObject *self, PyObject *args) {
       case ENOMEM:
         PyErr_Format(PyExc_MemoryError, "Failed malloc()");
         break;
+      case EINVAL:
+        PyErr_Format(PyExc_ValueError, "Invalid argument(s)");
+        break;
       default:
         PyErr_Format(PyExc_Exception, "Unknown exception");
       }
@@ -7149,7 +8236,18 @@ SWIGINTERN PyObject *_wrap_psrparams_jname_set(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "psrparams_jname_set" "', argument " "2"" of type '" "char *""'");
   }
   arg2 = (char *)(buf2);
-  PSRPARAMS_jname_set(arg1,arg2);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      PSRPARAMS_jname_set(arg1,arg2);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_Py_Void();
   if (alloc2 == SWIG_NEWOBJ) free((char*)buf2);
   return resultobj;
@@ -7175,7 +8273,18 @@ SWIGINTERN PyObject *_wrap_psrparams_jname_get(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "psrparams_jname_get" "', argument " "1"" of type '" "struct PSRPARAMS *""'"); 
   }
   arg1 = (struct PSRPARAMS *)(argp1);
-  result = (char *)PSRPARAMS_jname_get(arg1);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      result = (char *)PSRPARAMS_jname_get(arg1);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_FromCharPtr((const char *)result);
   return resultobj;
 fail:
@@ -7206,7 +8315,18 @@ SWIGINTERN PyObject *_wrap_psrparams_bname_set(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "psrparams_bname_set" "', argument " "2"" of type '" "char *""'");
   }
   arg2 = (char *)(buf2);
-  PSRPARAMS_bname_set(arg1,arg2);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      PSRPARAMS_bname_set(arg1,arg2);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_Py_Void();
   if (alloc2 == SWIG_NEWOBJ) free((char*)buf2);
   return resultobj;
@@ -7232,7 +8352,18 @@ SWIGINTERN PyObject *_wrap_psrparams_bname_get(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "psrparams_bname_get" "', argument " "1"" of type '" "struct PSRPARAMS *""'"); 
   }
   arg1 = (struct PSRPARAMS *)(argp1);
-  result = (char *)PSRPARAMS_bname_get(arg1);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      result = (char *)PSRPARAMS_bname_get(arg1);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_FromCharPtr((const char *)result);
   return resultobj;
 fail:
@@ -7263,7 +8394,18 @@ SWIGINTERN PyObject *_wrap_psrparams_alias_set(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "psrparams_alias_set" "', argument " "2"" of type '" "char *""'");
   }
   arg2 = (char *)(buf2);
-  PSRPARAMS_alias_set(arg1,arg2);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      PSRPARAMS_alias_set(arg1,arg2);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_Py_Void();
   if (alloc2 == SWIG_NEWOBJ) free((char*)buf2);
   return resultobj;
@@ -7289,7 +8431,18 @@ SWIGINTERN PyObject *_wrap_psrparams_alias_get(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "psrparams_alias_get" "', argument " "1"" of type '" "struct PSRPARAMS *""'"); 
   }
   arg1 = (struct PSRPARAMS *)(argp1);
-  result = (char *)PSRPARAMS_alias_get(arg1);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      result = (char *)PSRPARAMS_alias_get(arg1);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_FromCharPtr((const char *)result);
   return resultobj;
 fail:
@@ -7319,7 +8472,18 @@ SWIGINTERN PyObject *_wrap_psrparams_ra2000_set(PyObject *self, PyObject *args)
     SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "psrparams_ra2000_set" "', argument " "2"" of type '" "double""'");
   } 
   arg2 = (double)(val2);
-  if (arg1) (arg1)->ra2000 = arg2;
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      if (arg1) (arg1)->ra2000 = arg2;
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
@@ -7343,7 +8507,18 @@ SWIGINTERN PyObject *_wrap_psrparams_ra2000_get(PyObject *self, PyObject *args)
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "psrparams_ra2000_get" "', argument " "1"" of type '" "struct PSRPARAMS *""'"); 
   }
   arg1 = (struct PSRPARAMS *)(argp1);
-  result = (double) ((arg1)->ra2000);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      result = (double) ((arg1)->ra2000);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_From_double((double)(result));
   return resultobj;
 fail:
@@ -7373,7 +8548,18 @@ SWIGINTERN PyObject *_wrap_psrparams_dec2000_set(PyObject *self, PyObject *args)
     SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "psrparams_dec2000_set" "', argument " "2"" of type '" "double""'");
   } 
   arg2 = (double)(val2);
-  if (arg1) (arg1)->dec2000 = arg2;
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      if (arg1) (arg1)->dec2000 = arg2;
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
@@ -7397,7 +8583,18 @@ SWIGINTERN PyObject *_wrap_psrparams_dec2000_get(PyObject *self, PyObject *args)
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "psrparams_dec2000_get" "', argument " "1"" of type '" "struct PSRPARAMS *""'"); 
   }
   arg1 = (struct PSRPARAMS *)(argp1);
-  result = (double) ((arg1)->dec2000);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      result = (double) ((arg1)->dec2000);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_From_double((double)(result));
   return resultobj;
 fail:
@@ -7427,7 +8624,18 @@ SWIGINTERN PyObject *_wrap_psrparams_dm_set(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "psrparams_dm_set" "', argument " "2"" of type '" "double""'");
   } 
   arg2 = (double)(val2);
-  if (arg1) (arg1)->dm = arg2;
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      if (arg1) (arg1)->dm = arg2;
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
@@ -7451,7 +8659,18 @@ SWIGINTERN PyObject *_wrap_psrparams_dm_get(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "psrparams_dm_get" "', argument " "1"" of type '" "struct PSRPARAMS *""'"); 
   }
   arg1 = (struct PSRPARAMS *)(argp1);
-  result = (double) ((arg1)->dm);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      result = (double) ((arg1)->dm);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_From_double((double)(result));
   return resultobj;
 fail:
@@ -7481,7 +8700,18 @@ SWIGINTERN PyObject *_wrap_psrparams_timepoch_set(PyObject *self, PyObject *args
     SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "psrparams_timepoch_set" "', argument " "2"" of type '" "double""'");
   } 
   arg2 = (double)(val2);
-  if (arg1) (arg1)->timepoch = arg2;
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      if (arg1) (arg1)->timepoch = arg2;
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
@@ -7505,7 +8735,18 @@ SWIGINTERN PyObject *_wrap_psrparams_timepoch_get(PyObject *self, PyObject *args
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "psrparams_timepoch_get" "', argument " "1"" of type '" "struct PSRPARAMS *""'"); 
   }
   arg1 = (struct PSRPARAMS *)(argp1);
-  result = (double) ((arg1)->timepoch);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      result = (double) ((arg1)->timepoch);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_From_double((double)(result));
   return resultobj;
 fail:
@@ -7535,7 +8776,18 @@ SWIGINTERN PyObject *_wrap_psrparams_p_set(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "psrparams_p_set" "', argument " "2"" of type '" "double""'");
   } 
   arg2 = (double)(val2);
-  if (arg1) (arg1)->p = arg2;
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      if (arg1) (arg1)->p = arg2;
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
@@ -7559,7 +8811,18 @@ SWIGINTERN PyObject *_wrap_psrparams_p_get(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "psrparams_p_get" "', argument " "1"" of type '" "struct PSRPARAMS *""'"); 
   }
   arg1 = (struct PSRPARAMS *)(argp1);
-  result = (double) ((arg1)->p);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      result = (double) ((arg1)->p);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_From_double((double)(result));
   return resultobj;
 fail:
@@ -7589,7 +8852,18 @@ SWIGINTERN PyObject *_wrap_psrparams_pd_set(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "psrparams_pd_set" "', argument " "2"" of type '" "double""'");
   } 
   arg2 = (double)(val2);
-  if (arg1) (arg1)->pd = arg2;
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      if (arg1) (arg1)->pd = arg2;
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
@@ -7613,7 +8887,18 @@ SWIGINTERN PyObject *_wrap_psrparams_pd_get(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "psrparams_pd_get" "', argument " "1"" of type '" "struct PSRPARAMS *""'"); 
   }
   arg1 = (struct PSRPARAMS *)(argp1);
-  result = (double) ((arg1)->pd);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      result = (double) ((arg1)->pd);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_From_double((double)(result));
   return resultobj;
 fail:
@@ -7643,7 +8928,18 @@ SWIGINTERN PyObject *_wrap_psrparams_pdd_set(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "psrparams_pdd_set" "', argument " "2"" of type '" "double""'");
   } 
   arg2 = (double)(val2);
-  if (arg1) (arg1)->pdd = arg2;
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      if (arg1) (arg1)->pdd = arg2;
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
@@ -7667,7 +8963,18 @@ SWIGINTERN PyObject *_wrap_psrparams_pdd_get(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "psrparams_pdd_get" "', argument " "1"" of type '" "struct PSRPARAMS *""'"); 
   }
   arg1 = (struct PSRPARAMS *)(argp1);
-  result = (double) ((arg1)->pdd);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      result = (double) ((arg1)->pdd);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_From_double((double)(result));
   return resultobj;
 fail:
@@ -7697,7 +9004,18 @@ SWIGINTERN PyObject *_wrap_psrparams_f_set(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "psrparams_f_set" "', argument " "2"" of type '" "double""'");
   } 
   arg2 = (double)(val2);
-  if (arg1) (arg1)->f = arg2;
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      if (arg1) (arg1)->f = arg2;
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
@@ -7721,7 +9039,18 @@ SWIGINTERN PyObject *_wrap_psrparams_f_get(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "psrparams_f_get" "', argument " "1"" of type '" "struct PSRPARAMS *""'"); 
   }
   arg1 = (struct PSRPARAMS *)(argp1);
-  result = (double) ((arg1)->f);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      result = (double) ((arg1)->f);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_From_double((double)(result));
   return resultobj;
 fail:
@@ -7751,7 +9080,18 @@ SWIGINTERN PyObject *_wrap_psrparams_fd_set(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "psrparams_fd_set" "', argument " "2"" of type '" "double""'");
   } 
   arg2 = (double)(val2);
-  if (arg1) (arg1)->fd = arg2;
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      if (arg1) (arg1)->fd = arg2;
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
@@ -7775,7 +9115,18 @@ SWIGINTERN PyObject *_wrap_psrparams_fd_get(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "psrparams_fd_get" "', argument " "1"" of type '" "struct PSRPARAMS *""'"); 
   }
   arg1 = (struct PSRPARAMS *)(argp1);
-  result = (double) ((arg1)->fd);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      result = (double) ((arg1)->fd);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_From_double((double)(result));
   return resultobj;
 fail:
@@ -7805,7 +9156,18 @@ SWIGINTERN PyObject *_wrap_psrparams_fdd_set(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "psrparams_fdd_set" "', argument " "2"" of type '" "double""'");
   } 
   arg2 = (double)(val2);
-  if (arg1) (arg1)->fdd = arg2;
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      if (arg1) (arg1)->fdd = arg2;
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
@@ -7829,7 +9191,18 @@ SWIGINTERN PyObject *_wrap_psrparams_fdd_get(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "psrparams_fdd_get" "', argument " "1"" of type '" "struct PSRPARAMS *""'"); 
   }
   arg1 = (struct PSRPARAMS *)(argp1);
-  result = (double) ((arg1)->fdd);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      result = (double) ((arg1)->fdd);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_From_double((double)(result));
   return resultobj;
 fail:
@@ -7859,7 +9232,18 @@ SWIGINTERN PyObject *_wrap_psrparams_orb_set(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "psrparams_orb_set" "', argument " "2"" of type '" "orbitparams *""'"); 
   }
   arg2 = (orbitparams *)(argp2);
-  if (arg1) (arg1)->orb = *arg2;
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      if (arg1) (arg1)->orb = *arg2;
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
@@ -7882,8 +9266,19 @@ SWIGINTERN PyObject *_wrap_psrparams_orb_get(PyObject *self, PyObject *args) {
   if (!SWIG_IsOK(res1)) {
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "psrparams_orb_get" "', argument " "1"" of type '" "struct PSRPARAMS *""'"); 
   }
-  arg1 = (struct PSRPARAMS *)(argp1);
-  result = (orbitparams *)& ((arg1)->orb);
+  arg1 = (struct PSRPARAMS *)(argp1);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      result = (orbitparams *)& ((arg1)->orb);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_NewPointerObj(SWIG_as_voidptr(result), SWIGTYPE_p_orbitparams, 0 |  0 );
   return resultobj;
 fail:
@@ -7898,8 +9293,17 @@ SWIGINTERN PyObject *_wrap_new_psrparams(PyObject *self, PyObject *args) {
   (void)self;
   if (!SWIG_Python_UnpackTuple(args, "new_psrparams", 0, 0, 0)) SWIG_fail;
   {
-    errno = 0;
-    result = (struct PSRPARAMS *)calloc(1, sizeof(struct PSRPARAMS));
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      errno = 0;
+      result = (struct PSRPARAMS *)calloc(1, sizeof(struct PSRPARAMS));
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
     
     if (errno != 0)
     {
@@ -7908,6 +9312,9 @@ SWIGINTERN PyObject *_wrap_new_psrparams(PyObject *self, PyObject *args) {
       case ENOMEM:
         PyErr_Format(PyExc_MemoryError, "Failed malloc()");
         break;
+      case EINVAL:
+        PyErr_Format(PyExc_ValueError, "Invalid argument(s)");
+        break;
       default:
         PyErr_Format(PyExc_Exception, "Unknown exception");
       }
@@ -7937,8 +9344,17 @@ SWIGINTERN PyObject *_wrap_delete_psrparams(PyObject *self, PyObject *args) {
   }
   arg1 = (struct PSRPARAMS *)(argp1);
   {
-    errno = 0;
-    free((char *) arg1);
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      errno = 0;
+      free((char *) arg1);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
     
     if (errno != 0)
     {
@@ -7947,6 +9363,9 @@ SWIGINTERN PyObject *_wrap_delete_psrparams(PyObject *self, PyObject *args) {
       case ENOMEM:
         PyErr_Format(PyExc_MemoryError, "Failed malloc()");
         break;
+      case EINVAL:
+        PyErr_Format(PyExc_ValueError, "Invalid argument(s)");
+        break;
       default:
         PyErr_Format(PyExc_Exception, "Unknown exception");
       }
@@ -8003,7 +9422,18 @@ SWIGINTERN PyObject *_wrap_get_psr_at_epoch(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(res3), "in method '" "get_psr_at_epoch" "', argument " "3"" of type '" "psrparams *""'"); 
   }
   arg3 = (psrparams *)(argp3);
-  result = (int)get_psr_at_epoch(arg1,arg2,arg3);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      result = (int)get_psr_at_epoch(arg1,arg2,arg3);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_From_int((int)(result));
   if (alloc1 == SWIG_NEWOBJ) free((char*)buf1);
   return resultobj;
@@ -8045,7 +9475,18 @@ SWIGINTERN PyObject *_wrap_get_psr_from_parfile(PyObject *self, PyObject *args)
     SWIG_exception_fail(SWIG_ArgError(res3), "in method '" "get_psr_from_parfile" "', argument " "3"" of type '" "psrparams *""'"); 
   }
   arg3 = (psrparams *)(argp3);
-  result = (int)get_psr_from_parfile(arg1,arg2,arg3);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      result = (int)get_psr_from_parfile(arg1,arg2,arg3);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_From_int((int)(result));
   if (alloc1 == SWIG_NEWOBJ) free((char*)buf1);
   return resultobj;
@@ -8078,7 +9519,18 @@ SWIGINTERN PyObject *_wrap_mjd_to_datestr(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "mjd_to_datestr" "', argument " "2"" of type '" "char *""'");
   }
   arg2 = (char *)(buf2);
-  mjd_to_datestr(arg1,arg2);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      mjd_to_datestr(arg1,arg2);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_Py_Void();
   if (alloc2 == SWIG_NEWOBJ) free((char*)buf2);
   return resultobj;
@@ -8112,7 +9564,18 @@ SWIGINTERN PyObject *_wrap_fresnl(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(ecode1), "in method '" "fresnl" "', argument " "1"" of type '" "double""'");
   } 
   arg1 = (double)(val1);
-  result = (int)fresnl(arg1,arg2,arg3);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      result = (int)fresnl(arg1,arg2,arg3);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_From_int((int)(result));
   if (SWIG_IsTmpObj(res2)) {
     resultobj = SWIG_Python_AppendOutput(resultobj, SWIG_From_double((*arg2)));
@@ -8154,7 +9617,18 @@ SWIGINTERN PyObject *_wrap_rderivs_pow_set(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "rderivs_pow_set" "', argument " "2"" of type '" "double""'");
   } 
   arg2 = (double)(val2);
-  if (arg1) (arg1)->pow = arg2;
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      if (arg1) (arg1)->pow = arg2;
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
@@ -8178,7 +9652,18 @@ SWIGINTERN PyObject *_wrap_rderivs_pow_get(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "rderivs_pow_get" "', argument " "1"" of type '" "struct RDERIVS *""'"); 
   }
   arg1 = (struct RDERIVS *)(argp1);
-  result = (double) ((arg1)->pow);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      result = (double) ((arg1)->pow);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_From_double((double)(result));
   return resultobj;
 fail:
@@ -8208,7 +9693,18 @@ SWIGINTERN PyObject *_wrap_rderivs_phs_set(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "rderivs_phs_set" "', argument " "2"" of type '" "double""'");
   } 
   arg2 = (double)(val2);
-  if (arg1) (arg1)->phs = arg2;
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      if (arg1) (arg1)->phs = arg2;
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
@@ -8232,7 +9728,18 @@ SWIGINTERN PyObject *_wrap_rderivs_phs_get(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "rderivs_phs_get" "', argument " "1"" of type '" "struct RDERIVS *""'"); 
   }
   arg1 = (struct RDERIVS *)(argp1);
-  result = (double) ((arg1)->phs);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      result = (double) ((arg1)->phs);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_From_double((double)(result));
   return resultobj;
 fail:
@@ -8262,7 +9769,18 @@ SWIGINTERN PyObject *_wrap_rderivs_dpow_set(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "rderivs_dpow_set" "', argument " "2"" of type '" "double""'");
   } 
   arg2 = (double)(val2);
-  if (arg1) (arg1)->dpow = arg2;
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      if (arg1) (arg1)->dpow = arg2;
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
@@ -8286,7 +9804,18 @@ SWIGINTERN PyObject *_wrap_rderivs_dpow_get(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "rderivs_dpow_get" "', argument " "1"" of type '" "struct RDERIVS *""'"); 
   }
   arg1 = (struct RDERIVS *)(argp1);
-  result = (double) ((arg1)->dpow);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      result = (double) ((arg1)->dpow);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_From_double((double)(result));
   return resultobj;
 fail:
@@ -8316,7 +9845,18 @@ SWIGINTERN PyObject *_wrap_rderivs_dphs_set(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "rderivs_dphs_set" "', argument " "2"" of type '" "double""'");
   } 
   arg2 = (double)(val2);
-  if (arg1) (arg1)->dphs = arg2;
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      if (arg1) (arg1)->dphs = arg2;
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
@@ -8340,7 +9880,18 @@ SWIGINTERN PyObject *_wrap_rderivs_dphs_get(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "rderivs_dphs_get" "', argument " "1"" of type '" "struct RDERIVS *""'"); 
   }
   arg1 = (struct RDERIVS *)(argp1);
-  result = (double) ((arg1)->dphs);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      result = (double) ((arg1)->dphs);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_From_double((double)(result));
   return resultobj;
 fail:
@@ -8370,7 +9921,18 @@ SWIGINTERN PyObject *_wrap_rderivs_d2pow_set(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "rderivs_d2pow_set" "', argument " "2"" of type '" "double""'");
   } 
   arg2 = (double)(val2);
-  if (arg1) (arg1)->d2pow = arg2;
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      if (arg1) (arg1)->d2pow = arg2;
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
@@ -8394,7 +9956,18 @@ SWIGINTERN PyObject *_wrap_rderivs_d2pow_get(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "rderivs_d2pow_get" "', argument " "1"" of type '" "struct RDERIVS *""'"); 
   }
   arg1 = (struct RDERIVS *)(argp1);
-  result = (double) ((arg1)->d2pow);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      result = (double) ((arg1)->d2pow);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_From_double((double)(result));
   return resultobj;
 fail:
@@ -8424,7 +9997,18 @@ SWIGINTERN PyObject *_wrap_rderivs_d2phs_set(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "rderivs_d2phs_set" "', argument " "2"" of type '" "double""'");
   } 
   arg2 = (double)(val2);
-  if (arg1) (arg1)->d2phs = arg2;
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      if (arg1) (arg1)->d2phs = arg2;
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
@@ -8448,7 +10032,18 @@ SWIGINTERN PyObject *_wrap_rderivs_d2phs_get(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "rderivs_d2phs_get" "', argument " "1"" of type '" "struct RDERIVS *""'"); 
   }
   arg1 = (struct RDERIVS *)(argp1);
-  result = (double) ((arg1)->d2phs);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      result = (double) ((arg1)->d2phs);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_From_double((double)(result));
   return resultobj;
 fail:
@@ -8478,7 +10073,18 @@ SWIGINTERN PyObject *_wrap_rderivs_locpow_set(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "rderivs_locpow_set" "', argument " "2"" of type '" "double""'");
   } 
   arg2 = (double)(val2);
-  if (arg1) (arg1)->locpow = arg2;
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      if (arg1) (arg1)->locpow = arg2;
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
@@ -8502,7 +10108,18 @@ SWIGINTERN PyObject *_wrap_rderivs_locpow_get(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "rderivs_locpow_get" "', argument " "1"" of type '" "struct RDERIVS *""'"); 
   }
   arg1 = (struct RDERIVS *)(argp1);
-  result = (double) ((arg1)->locpow);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      result = (double) ((arg1)->locpow);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_From_double((double)(result));
   return resultobj;
 fail:
@@ -8517,8 +10134,17 @@ SWIGINTERN PyObject *_wrap_new_rderivs(PyObject *self, PyObject *args) {
   (void)self;
   if (!SWIG_Python_UnpackTuple(args, "new_rderivs", 0, 0, 0)) SWIG_fail;
   {
-    errno = 0;
-    result = (struct RDERIVS *)calloc(1, sizeof(struct RDERIVS));
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      errno = 0;
+      result = (struct RDERIVS *)calloc(1, sizeof(struct RDERIVS));
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
     
     if (errno != 0)
     {
@@ -8527,6 +10153,9 @@ SWIGINTERN PyObject *_wrap_new_rderivs(PyObject *self, PyObject *args) {
       case ENOMEM:
         PyErr_Format(PyExc_MemoryError, "Failed malloc()");
         break;
+      case EINVAL:
+        PyErr_Format(PyExc_ValueError, "Invalid argument(s)");
+        break;
       default:
         PyErr_Format(PyExc_Exception, "Unknown exception");
       }
@@ -8556,8 +10185,17 @@ SWIGINTERN PyObject *_wrap_delete_rderivs(PyObject *self, PyObject *args) {
   }
   arg1 = (struct RDERIVS *)(argp1);
   {
-    errno = 0;
-    free((char *) arg1);
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      errno = 0;
+      free((char *) arg1);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
     
     if (errno != 0)
     {
@@ -8566,6 +10204,9 @@ SWIGINTERN PyObject *_wrap_delete_rderivs(PyObject *self, PyObject *args) {
       case ENOMEM:
         PyErr_Format(PyExc_MemoryError, "Failed malloc()");
         break;
+      case EINVAL:
+        PyErr_Format(PyExc_ValueError, "Invalid argument(s)");
+        break;
       default:
         PyErr_Format(PyExc_Exception, "Unknown exception");
       }
@@ -8612,7 +10253,18 @@ SWIGINTERN PyObject *_wrap_fourierprops_r_set(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "fourierprops_r_set" "', argument " "2"" of type '" "double""'");
   } 
   arg2 = (double)(val2);
-  if (arg1) (arg1)->r = arg2;
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      if (arg1) (arg1)->r = arg2;
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
@@ -8636,7 +10288,18 @@ SWIGINTERN PyObject *_wrap_fourierprops_r_get(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "fourierprops_r_get" "', argument " "1"" of type '" "struct FOURIERPROPS *""'"); 
   }
   arg1 = (struct FOURIERPROPS *)(argp1);
-  result = (double) ((arg1)->r);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      result = (double) ((arg1)->r);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_From_double((double)(result));
   return resultobj;
 fail:
@@ -8666,7 +10329,18 @@ SWIGINTERN PyObject *_wrap_fourierprops_rerr_set(PyObject *self, PyObject *args)
     SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "fourierprops_rerr_set" "', argument " "2"" of type '" "float""'");
   } 
   arg2 = (float)(val2);
-  if (arg1) (arg1)->rerr = arg2;
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      if (arg1) (arg1)->rerr = arg2;
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
@@ -8690,7 +10364,18 @@ SWIGINTERN PyObject *_wrap_fourierprops_rerr_get(PyObject *self, PyObject *args)
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "fourierprops_rerr_get" "', argument " "1"" of type '" "struct FOURIERPROPS *""'"); 
   }
   arg1 = (struct FOURIERPROPS *)(argp1);
-  result = (float) ((arg1)->rerr);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      result = (float) ((arg1)->rerr);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_From_float((float)(result));
   return resultobj;
 fail:
@@ -8720,7 +10405,18 @@ SWIGINTERN PyObject *_wrap_fourierprops_z_set(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "fourierprops_z_set" "', argument " "2"" of type '" "double""'");
   } 
   arg2 = (double)(val2);
-  if (arg1) (arg1)->z = arg2;
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      if (arg1) (arg1)->z = arg2;
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
@@ -8744,7 +10440,18 @@ SWIGINTERN PyObject *_wrap_fourierprops_z_get(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "fourierprops_z_get" "', argument " "1"" of type '" "struct FOURIERPROPS *""'"); 
   }
   arg1 = (struct FOURIERPROPS *)(argp1);
-  result = (double) ((arg1)->z);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      result = (double) ((arg1)->z);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_From_double((double)(result));
   return resultobj;
 fail:
@@ -8774,7 +10481,18 @@ SWIGINTERN PyObject *_wrap_fourierprops_zerr_set(PyObject *self, PyObject *args)
     SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "fourierprops_zerr_set" "', argument " "2"" of type '" "float""'");
   } 
   arg2 = (float)(val2);
-  if (arg1) (arg1)->zerr = arg2;
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      if (arg1) (arg1)->zerr = arg2;
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
@@ -8798,7 +10516,18 @@ SWIGINTERN PyObject *_wrap_fourierprops_zerr_get(PyObject *self, PyObject *args)
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "fourierprops_zerr_get" "', argument " "1"" of type '" "struct FOURIERPROPS *""'"); 
   }
   arg1 = (struct FOURIERPROPS *)(argp1);
-  result = (float) ((arg1)->zerr);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      result = (float) ((arg1)->zerr);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_From_float((float)(result));
   return resultobj;
 fail:
@@ -8828,7 +10557,18 @@ SWIGINTERN PyObject *_wrap_fourierprops_w_set(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "fourierprops_w_set" "', argument " "2"" of type '" "double""'");
   } 
   arg2 = (double)(val2);
-  if (arg1) (arg1)->w = arg2;
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      if (arg1) (arg1)->w = arg2;
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
@@ -8852,7 +10592,18 @@ SWIGINTERN PyObject *_wrap_fourierprops_w_get(PyObject *self, PyObject *args) {
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "fourierprops_w_get" "', argument " "1"" of type '" "struct FOURIERPROPS *""'"); 
   }
   arg1 = (struct FOURIERPROPS *)(argp1);
-  result = (double) ((arg1)->w);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      result = (double) ((arg1)->w);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_From_double((double)(result));
   return resultobj;
 fail:
@@ -8882,7 +10633,18 @@ SWIGINTERN PyObject *_wrap_fourierprops_werr_set(PyObject *self, PyObject *args)
     SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "fourierprops_werr_set" "', argument " "2"" of type '" "float""'");
   } 
   arg2 = (float)(val2);
-  if (arg1) (arg1)->werr = arg2;
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      if (arg1) (arg1)->werr = arg2;
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
@@ -8906,7 +10668,18 @@ SWIGINTERN PyObject *_wrap_fourierprops_werr_get(PyObject *self, PyObject *args)
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "fourierprops_werr_get" "', argument " "1"" of type '" "struct FOURIERPROPS *""'"); 
   }
   arg1 = (struct FOURIERPROPS *)(argp1);
-  result = (float) ((arg1)->werr);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      result = (float) ((arg1)->werr);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_From_float((float)(result));
   return resultobj;
 fail:
@@ -8936,7 +10709,18 @@ SWIGINTERN PyObject *_wrap_fourierprops_pow_set(PyObject *self, PyObject *args)
     SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "fourierprops_pow_set" "', argument " "2"" of type '" "float""'");
   } 
   arg2 = (float)(val2);
-  if (arg1) (arg1)->pow = arg2;
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      if (arg1) (arg1)->pow = arg2;
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
@@ -8960,7 +10744,18 @@ SWIGINTERN PyObject *_wrap_fourierprops_pow_get(PyObject *self, PyObject *args)
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "fourierprops_pow_get" "', argument " "1"" of type '" "struct FOURIERPROPS *""'"); 
   }
   arg1 = (struct FOURIERPROPS *)(argp1);
-  result = (float) ((arg1)->pow);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      result = (float) ((arg1)->pow);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_From_float((float)(result));
   return resultobj;
 fail:
@@ -8990,7 +10785,18 @@ SWIGINTERN PyObject *_wrap_fourierprops_powerr_set(PyObject *self, PyObject *arg
     SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "fourierprops_powerr_set" "', argument " "2"" of type '" "float""'");
   } 
   arg2 = (float)(val2);
-  if (arg1) (arg1)->powerr = arg2;
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      if (arg1) (arg1)->powerr = arg2;
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
@@ -9014,7 +10820,18 @@ SWIGINTERN PyObject *_wrap_fourierprops_powerr_get(PyObject *self, PyObject *arg
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "fourierprops_powerr_get" "', argument " "1"" of type '" "struct FOURIERPROPS *""'"); 
   }
   arg1 = (struct FOURIERPROPS *)(argp1);
-  result = (float) ((arg1)->powerr);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      result = (float) ((arg1)->powerr);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_From_float((float)(result));
   return resultobj;
 fail:
@@ -9044,7 +10861,18 @@ SWIGINTERN PyObject *_wrap_fourierprops_sig_set(PyObject *self, PyObject *args)
     SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "fourierprops_sig_set" "', argument " "2"" of type '" "float""'");
   } 
   arg2 = (float)(val2);
-  if (arg1) (arg1)->sig = arg2;
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      if (arg1) (arg1)->sig = arg2;
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
@@ -9068,7 +10896,18 @@ SWIGINTERN PyObject *_wrap_fourierprops_sig_get(PyObject *self, PyObject *args)
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "fourierprops_sig_get" "', argument " "1"" of type '" "struct FOURIERPROPS *""'"); 
   }
   arg1 = (struct FOURIERPROPS *)(argp1);
-  result = (float) ((arg1)->sig);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      result = (float) ((arg1)->sig);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_From_float((float)(result));
   return resultobj;
 fail:
@@ -9098,7 +10937,18 @@ SWIGINTERN PyObject *_wrap_fourierprops_rawpow_set(PyObject *self, PyObject *arg
     SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "fourierprops_rawpow_set" "', argument " "2"" of type '" "float""'");
   } 
   arg2 = (float)(val2);
-  if (arg1) (arg1)->rawpow = arg2;
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      if (arg1) (arg1)->rawpow = arg2;
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
@@ -9122,7 +10972,18 @@ SWIGINTERN PyObject *_wrap_fourierprops_rawpow_get(PyObject *self, PyObject *arg
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "fourierprops_rawpow_get" "', argument " "1"" of type '" "struct FOURIERPROPS *""'"); 
   }
   arg1 = (struct FOURIERPROPS *)(argp1);
-  result = (float) ((arg1)->rawpow);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      result = (float) ((arg1)->rawpow);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_From_float((float)(result));
   return resultobj;
 fail:
@@ -9152,7 +11013,18 @@ SWIGINTERN PyObject *_wrap_fourierprops_phs_set(PyObject *self, PyObject *args)
     SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "fourierprops_phs_set" "', argument " "2"" of type '" "float""'");
   } 
   arg2 = (float)(val2);
-  if (arg1) (arg1)->phs = arg2;
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      if (arg1) (arg1)->phs = arg2;
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
@@ -9176,7 +11048,18 @@ SWIGINTERN PyObject *_wrap_fourierprops_phs_get(PyObject *self, PyObject *args)
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "fourierprops_phs_get" "', argument " "1"" of type '" "struct FOURIERPROPS *""'"); 
   }
   arg1 = (struct FOURIERPROPS *)(argp1);
-  result = (float) ((arg1)->phs);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      result = (float) ((arg1)->phs);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_From_float((float)(result));
   return resultobj;
 fail:
@@ -9206,7 +11089,18 @@ SWIGINTERN PyObject *_wrap_fourierprops_phserr_set(PyObject *self, PyObject *arg
     SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "fourierprops_phserr_set" "', argument " "2"" of type '" "float""'");
   } 
   arg2 = (float)(val2);
-  if (arg1) (arg1)->phserr = arg2;
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      if (arg1) (arg1)->phserr = arg2;
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
@@ -9230,7 +11124,18 @@ SWIGINTERN PyObject *_wrap_fourierprops_phserr_get(PyObject *self, PyObject *arg
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "fourierprops_phserr_get" "', argument " "1"" of type '" "struct FOURIERPROPS *""'"); 
   }
   arg1 = (struct FOURIERPROPS *)(argp1);
-  result = (float) ((arg1)->phserr);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      result = (float) ((arg1)->phserr);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_From_float((float)(result));
   return resultobj;
 fail:
@@ -9260,7 +11165,18 @@ SWIGINTERN PyObject *_wrap_fourierprops_cen_set(PyObject *self, PyObject *args)
     SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "fourierprops_cen_set" "', argument " "2"" of type '" "float""'");
   } 
   arg2 = (float)(val2);
-  if (arg1) (arg1)->cen = arg2;
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      if (arg1) (arg1)->cen = arg2;
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
@@ -9284,7 +11200,18 @@ SWIGINTERN PyObject *_wrap_fourierprops_cen_get(PyObject *self, PyObject *args)
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "fourierprops_cen_get" "', argument " "1"" of type '" "struct FOURIERPROPS *""'"); 
   }
   arg1 = (struct FOURIERPROPS *)(argp1);
-  result = (float) ((arg1)->cen);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      result = (float) ((arg1)->cen);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_From_float((float)(result));
   return resultobj;
 fail:
@@ -9314,7 +11241,18 @@ SWIGINTERN PyObject *_wrap_fourierprops_cenerr_set(PyObject *self, PyObject *arg
     SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "fourierprops_cenerr_set" "', argument " "2"" of type '" "float""'");
   } 
   arg2 = (float)(val2);
-  if (arg1) (arg1)->cenerr = arg2;
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      if (arg1) (arg1)->cenerr = arg2;
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
@@ -9338,7 +11276,18 @@ SWIGINTERN PyObject *_wrap_fourierprops_cenerr_get(PyObject *self, PyObject *arg
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "fourierprops_cenerr_get" "', argument " "1"" of type '" "struct FOURIERPROPS *""'"); 
   }
   arg1 = (struct FOURIERPROPS *)(argp1);
-  result = (float) ((arg1)->cenerr);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      result = (float) ((arg1)->cenerr);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_From_float((float)(result));
   return resultobj;
 fail:
@@ -9368,7 +11317,18 @@ SWIGINTERN PyObject *_wrap_fourierprops_pur_set(PyObject *self, PyObject *args)
     SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "fourierprops_pur_set" "', argument " "2"" of type '" "float""'");
   } 
   arg2 = (float)(val2);
-  if (arg1) (arg1)->pur = arg2;
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      if (arg1) (arg1)->pur = arg2;
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
@@ -9391,8 +11351,19 @@ SWIGINTERN PyObject *_wrap_fourierprops_pur_get(PyObject *self, PyObject *args)
   if (!SWIG_IsOK(res1)) {
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "fourierprops_pur_get" "', argument " "1"" of type '" "struct FOURIERPROPS *""'"); 
   }
-  arg1 = (struct FOURIERPROPS *)(argp1);
-  result = (float) ((arg1)->pur);
+  arg1 = (struct FOURIERPROPS *)(argp1);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      result = (float) ((arg1)->pur);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_From_float((float)(result));
   return resultobj;
 fail:
@@ -9422,7 +11393,18 @@ SWIGINTERN PyObject *_wrap_fourierprops_purerr_set(PyObject *self, PyObject *arg
     SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "fourierprops_purerr_set" "', argument " "2"" of type '" "float""'");
   } 
   arg2 = (float)(val2);
-  if (arg1) (arg1)->purerr = arg2;
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      if (arg1) (arg1)->purerr = arg2;
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
@@ -9446,7 +11428,18 @@ SWIGINTERN PyObject *_wrap_fourierprops_purerr_get(PyObject *self, PyObject *arg
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "fourierprops_purerr_get" "', argument " "1"" of type '" "struct FOURIERPROPS *""'"); 
   }
   arg1 = (struct FOURIERPROPS *)(argp1);
-  result = (float) ((arg1)->purerr);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      result = (float) ((arg1)->purerr);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_From_float((float)(result));
   return resultobj;
 fail:
@@ -9476,7 +11469,18 @@ SWIGINTERN PyObject *_wrap_fourierprops_locpow_set(PyObject *self, PyObject *arg
     SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "fourierprops_locpow_set" "', argument " "2"" of type '" "float""'");
   } 
   arg2 = (float)(val2);
-  if (arg1) (arg1)->locpow = arg2;
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      if (arg1) (arg1)->locpow = arg2;
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
@@ -9500,7 +11504,18 @@ SWIGINTERN PyObject *_wrap_fourierprops_locpow_get(PyObject *self, PyObject *arg
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "fourierprops_locpow_get" "', argument " "1"" of type '" "struct FOURIERPROPS *""'"); 
   }
   arg1 = (struct FOURIERPROPS *)(argp1);
-  result = (float) ((arg1)->locpow);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      result = (float) ((arg1)->locpow);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_From_float((float)(result));
   return resultobj;
 fail:
@@ -9515,8 +11530,17 @@ SWIGINTERN PyObject *_wrap_new_fourierprops(PyObject *self, PyObject *args) {
   (void)self;
   if (!SWIG_Python_UnpackTuple(args, "new_fourierprops", 0, 0, 0)) SWIG_fail;
   {
-    errno = 0;
-    result = (struct FOURIERPROPS *)calloc(1, sizeof(struct FOURIERPROPS));
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      errno = 0;
+      result = (struct FOURIERPROPS *)calloc(1, sizeof(struct FOURIERPROPS));
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
     
     if (errno != 0)
     {
@@ -9525,6 +11549,9 @@ SWIGINTERN PyObject *_wrap_new_fourierprops(PyObject *self, PyObject *args) {
       case ENOMEM:
         PyErr_Format(PyExc_MemoryError, "Failed malloc()");
         break;
+      case EINVAL:
+        PyErr_Format(PyExc_ValueError, "Invalid argument(s)");
+        break;
       default:
         PyErr_Format(PyExc_Exception, "Unknown exception");
       }
@@ -9554,8 +11581,17 @@ SWIGINTERN PyObject *_wrap_delete_fourierprops(PyObject *self, PyObject *args) {
   }
   arg1 = (struct FOURIERPROPS *)(argp1);
   {
-    errno = 0;
-    free((char *) arg1);
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      errno = 0;
+      free((char *) arg1);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
     
     if (errno != 0)
     {
@@ -9564,6 +11600,9 @@ SWIGINTERN PyObject *_wrap_delete_fourierprops(PyObject *self, PyObject *args) {
       case ENOMEM:
         PyErr_Format(PyExc_MemoryError, "Failed malloc()");
         break;
+      case EINVAL:
+        PyErr_Format(PyExc_ValueError, "Invalid argument(s)");
+        break;
       default:
         PyErr_Format(PyExc_Exception, "Unknown exception");
       }
@@ -9610,7 +11649,18 @@ SWIGINTERN PyObject *_wrap_foldstats_numdata_set(PyObject *self, PyObject *args)
     SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "foldstats_numdata_set" "', argument " "2"" of type '" "double""'");
   } 
   arg2 = (double)(val2);
-  if (arg1) (arg1)->numdata = arg2;
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      if (arg1) (arg1)->numdata = arg2;
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
@@ -9634,7 +11684,18 @@ SWIGINTERN PyObject *_wrap_foldstats_numdata_get(PyObject *self, PyObject *args)
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "foldstats_numdata_get" "', argument " "1"" of type '" "struct foldstats *""'"); 
   }
   arg1 = (struct foldstats *)(argp1);
-  result = (double) ((arg1)->numdata);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      result = (double) ((arg1)->numdata);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_From_double((double)(result));
   return resultobj;
 fail:
@@ -9664,7 +11725,18 @@ SWIGINTERN PyObject *_wrap_foldstats_data_avg_set(PyObject *self, PyObject *args
     SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "foldstats_data_avg_set" "', argument " "2"" of type '" "double""'");
   } 
   arg2 = (double)(val2);
-  if (arg1) (arg1)->data_avg = arg2;
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      if (arg1) (arg1)->data_avg = arg2;
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
@@ -9688,7 +11760,18 @@ SWIGINTERN PyObject *_wrap_foldstats_data_avg_get(PyObject *self, PyObject *args
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "foldstats_data_avg_get" "', argument " "1"" of type '" "struct foldstats *""'"); 
   }
   arg1 = (struct foldstats *)(argp1);
-  result = (double) ((arg1)->data_avg);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      result = (double) ((arg1)->data_avg);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_From_double((double)(result));
   return resultobj;
 fail:
@@ -9718,7 +11801,18 @@ SWIGINTERN PyObject *_wrap_foldstats_data_var_set(PyObject *self, PyObject *args
     SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "foldstats_data_var_set" "', argument " "2"" of type '" "double""'");
   } 
   arg2 = (double)(val2);
-  if (arg1) (arg1)->data_var = arg2;
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      if (arg1) (arg1)->data_var = arg2;
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
@@ -9742,7 +11836,18 @@ SWIGINTERN PyObject *_wrap_foldstats_data_var_get(PyObject *self, PyObject *args
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "foldstats_data_var_get" "', argument " "1"" of type '" "struct foldstats *""'"); 
   }
   arg1 = (struct foldstats *)(argp1);
-  result = (double) ((arg1)->data_var);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      result = (double) ((arg1)->data_var);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_From_double((double)(result));
   return resultobj;
 fail:
@@ -9772,7 +11877,18 @@ SWIGINTERN PyObject *_wrap_foldstats_numprof_set(PyObject *self, PyObject *args)
     SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "foldstats_numprof_set" "', argument " "2"" of type '" "double""'");
   } 
   arg2 = (double)(val2);
-  if (arg1) (arg1)->numprof = arg2;
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      if (arg1) (arg1)->numprof = arg2;
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
@@ -9796,7 +11912,18 @@ SWIGINTERN PyObject *_wrap_foldstats_numprof_get(PyObject *self, PyObject *args)
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "foldstats_numprof_get" "', argument " "1"" of type '" "struct foldstats *""'"); 
   }
   arg1 = (struct foldstats *)(argp1);
-  result = (double) ((arg1)->numprof);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      result = (double) ((arg1)->numprof);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_From_double((double)(result));
   return resultobj;
 fail:
@@ -9826,7 +11953,18 @@ SWIGINTERN PyObject *_wrap_foldstats_prof_avg_set(PyObject *self, PyObject *args
     SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "foldstats_prof_avg_set" "', argument " "2"" of type '" "double""'");
   } 
   arg2 = (double)(val2);
-  if (arg1) (arg1)->prof_avg = arg2;
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      if (arg1) (arg1)->prof_avg = arg2;
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
@@ -9850,7 +11988,18 @@ SWIGINTERN PyObject *_wrap_foldstats_prof_avg_get(PyObject *self, PyObject *args
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "foldstats_prof_avg_get" "', argument " "1"" of type '" "struct foldstats *""'"); 
   }
   arg1 = (struct foldstats *)(argp1);
-  result = (double) ((arg1)->prof_avg);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      result = (double) ((arg1)->prof_avg);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_From_double((double)(result));
   return resultobj;
 fail:
@@ -9880,7 +12029,18 @@ SWIGINTERN PyObject *_wrap_foldstats_prof_var_set(PyObject *self, PyObject *args
     SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "foldstats_prof_var_set" "', argument " "2"" of type '" "double""'");
   } 
   arg2 = (double)(val2);
-  if (arg1) (arg1)->prof_var = arg2;
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      if (arg1) (arg1)->prof_var = arg2;
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
@@ -9904,7 +12064,18 @@ SWIGINTERN PyObject *_wrap_foldstats_prof_var_get(PyObject *self, PyObject *args
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "foldstats_prof_var_get" "', argument " "1"" of type '" "struct foldstats *""'"); 
   }
   arg1 = (struct foldstats *)(argp1);
-  result = (double) ((arg1)->prof_var);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      result = (double) ((arg1)->prof_var);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_From_double((double)(result));
   return resultobj;
 fail:
@@ -9934,7 +12105,18 @@ SWIGINTERN PyObject *_wrap_foldstats_redchi_set(PyObject *self, PyObject *args)
     SWIG_exception_fail(SWIG_ArgError(ecode2), "in method '" "foldstats_redchi_set" "', argument " "2"" of type '" "double""'");
   } 
   arg2 = (double)(val2);
-  if (arg1) (arg1)->redchi = arg2;
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      if (arg1) (arg1)->redchi = arg2;
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_Py_Void();
   return resultobj;
 fail:
@@ -9958,7 +12140,18 @@ SWIGINTERN PyObject *_wrap_foldstats_redchi_get(PyObject *self, PyObject *args)
     SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "foldstats_redchi_get" "', argument " "1"" of type '" "struct foldstats *""'"); 
   }
   arg1 = (struct foldstats *)(argp1);
-  result = (double) ((arg1)->redchi);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      result = (double) ((arg1)->redchi);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+  }
   resultobj = SWIG_From_double((double)(result));
   return resultobj;
 fail:
@@ -9973,8 +12166,17 @@ SWIGINTERN PyObject *_wrap_new_foldstats(PyObject *self, PyObject *args) {
   (void)self;
   if (!SWIG_Python_UnpackTuple(args, "new_foldstats", 0, 0, 0)) SWIG_fail;
   {
-    errno = 0;
-    result = (struct foldstats *)calloc(1, sizeof(struct foldstats));
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      errno = 0;
+      result = (struct foldstats *)calloc(1, sizeof(struct foldstats));
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
     
     if (errno != 0)
     {
@@ -9983,6 +12185,9 @@ SWIGINTERN PyObject *_wrap_new_foldstats(PyObject *self, PyObject *args) {
       case ENOMEM:
         PyErr_Format(PyExc_MemoryError, "Failed malloc()");
         break;
+      case EINVAL:
+        PyErr_Format(PyExc_ValueError, "Invalid argument(s)");
+        break;
       default:
         PyErr_Format(PyExc_Exception, "Unknown exception");
       }
@@ -10012,8 +12217,17 @@ SWIGINTERN PyObject *_wrap_delete_foldstats(PyObject *self, PyObject *args) {
   }
   arg1 = (struct foldstats *)(argp1);
   {
-    errno = 0;
-    free((char *) arg1);
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      errno = 0;
+      free((char *) arg1);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
     
     if (errno != 0)
     {
@@ -10022,6 +12236,9 @@ SWIGINTERN PyObject *_wrap_delete_foldstats(PyObject *self, PyObject *args) {
       case ENOMEM:
         PyErr_Format(PyExc_MemoryError, "Failed malloc()");
         break;
+      case EINVAL:
+        PyErr_Format(PyExc_ValueError, "Invalid argument(s)");
+        break;
       default:
         PyErr_Format(PyExc_Exception, "Unknown exception");
       }
@@ -10070,8 +12287,17 @@ SWIGINTERN PyObject *_wrap_gen_fvect(PyObject *self, PyObject *args) {
   } 
   arg1 = (long)(val1);
   {
-    errno = 0;
-    wrap_gen_fvect(arg1,arg2,arg3);
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      errno = 0;
+      wrap_gen_fvect(arg1,arg2,arg3);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
     
     if (errno != 0)
     {
@@ -10080,6 +12306,9 @@ SWIGINTERN PyObject *_wrap_gen_fvect(PyObject *self, PyObject *args) {
       case ENOMEM:
         PyErr_Format(PyExc_MemoryError, "Failed malloc()");
         break;
+      case EINVAL:
+        PyErr_Format(PyExc_ValueError, "Invalid argument(s)");
+        break;
       default:
         PyErr_Format(PyExc_Exception, "Unknown exception");
       }
@@ -10140,8 +12369,17 @@ SWIGINTERN PyObject *_wrap_gen_cvect(PyObject *self, PyObject *args) {
   } 
   arg1 = (long)(val1);
   {
-    errno = 0;
-    wrap_gen_cvect(arg1,arg2,arg3);
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      errno = 0;
+      wrap_gen_cvect(arg1,arg2,arg3);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
     
     if (errno != 0)
     {
@@ -10150,6 +12388,9 @@ SWIGINTERN PyObject *_wrap_gen_cvect(PyObject *self, PyObject *args) {
       case ENOMEM:
         PyErr_Format(PyExc_MemoryError, "Failed malloc()");
         break;
+      case EINVAL:
+        PyErr_Format(PyExc_ValueError, "Invalid argument(s)");
+        break;
       default:
         PyErr_Format(PyExc_Exception, "Unknown exception");
       }
@@ -10214,8 +12455,17 @@ SWIGINTERN PyObject *_wrap_power_arr(PyObject *self, PyObject *args) {
     for (i1=0; i1 < array_numdims(array1); ++i1) arg2 *= array_size(array1,i1);
   }
   {
-    errno = 0;
-    wrap_power_arr(arg1,arg2,arg3,arg4);
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      errno = 0;
+      wrap_power_arr(arg1,arg2,arg3,arg4);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
     
     if (errno != 0)
     {
@@ -10224,6 +12474,9 @@ SWIGINTERN PyObject *_wrap_power_arr(PyObject *self, PyObject *args) {
       case ENOMEM:
         PyErr_Format(PyExc_MemoryError, "Failed malloc()");
         break;
+      case EINVAL:
+        PyErr_Format(PyExc_ValueError, "Invalid argument(s)");
+        break;
       default:
         PyErr_Format(PyExc_Exception, "Unknown exception");
       }
@@ -10288,8 +12541,17 @@ SWIGINTERN PyObject *_wrap_phase_arr(PyObject *self, PyObject *args) {
     for (i1=0; i1 < array_numdims(array1); ++i1) arg2 *= array_size(array1,i1);
   }
   {
-    errno = 0;
-    wrap_phase_arr(arg1,arg2,arg3,arg4);
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      errno = 0;
+      wrap_phase_arr(arg1,arg2,arg3,arg4);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
     
     if (errno != 0)
     {
@@ -10298,6 +12560,9 @@ SWIGINTERN PyObject *_wrap_phase_arr(PyObject *self, PyObject *args) {
       case ENOMEM:
         PyErr_Format(PyExc_MemoryError, "Failed malloc()");
         break;
+      case EINVAL:
+        PyErr_Format(PyExc_ValueError, "Invalid argument(s)");
+        break;
       default:
         PyErr_Format(PyExc_Exception, "Unknown exception");
       }
@@ -10361,8 +12626,17 @@ SWIGINTERN PyObject *_wrap_frotate(PyObject *self, PyObject *args) {
   } 
   arg3 = (float)(val3);
   {
-    errno = 0;
-    frotate(arg1,arg2,arg3);
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      errno = 0;
+      frotate(arg1,arg2,arg3);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
     
     if (errno != 0)
     {
@@ -10371,6 +12645,9 @@ SWIGINTERN PyObject *_wrap_frotate(PyObject *self, PyObject *args) {
       case ENOMEM:
         PyErr_Format(PyExc_MemoryError, "Failed malloc()");
         break;
+      case EINVAL:
+        PyErr_Format(PyExc_ValueError, "Invalid argument(s)");
+        break;
       default:
         PyErr_Format(PyExc_Exception, "Unknown exception");
       }
@@ -10411,8 +12688,17 @@ SWIGINTERN PyObject *_wrap_drotate(PyObject *self, PyObject *args) {
   } 
   arg3 = (double)(val3);
   {
-    errno = 0;
-    drotate(arg1,arg2,arg3);
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      errno = 0;
+      drotate(arg1,arg2,arg3);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
     
     if (errno != 0)
     {
@@ -10421,6 +12707,9 @@ SWIGINTERN PyObject *_wrap_drotate(PyObject *self, PyObject *args) {
       case ENOMEM:
         PyErr_Format(PyExc_MemoryError, "Failed malloc()");
         break;
+      case EINVAL:
+        PyErr_Format(PyExc_ValueError, "Invalid argument(s)");
+        break;
       default:
         PyErr_Format(PyExc_Exception, "Unknown exception");
       }
@@ -10474,8 +12763,17 @@ SWIGINTERN PyObject *_wrap_keplers_eqn(PyObject *self, PyObject *args) {
   } 
   arg4 = (double)(val4);
   {
-    errno = 0;
-    result = (double)keplers_eqn(arg1,arg2,arg3,arg4);
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      errno = 0;
+      result = (double)keplers_eqn(arg1,arg2,arg3,arg4);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
     
     if (errno != 0)
     {
@@ -10484,6 +12782,9 @@ SWIGINTERN PyObject *_wrap_keplers_eqn(PyObject *self, PyObject *args) {
       case ENOMEM:
         PyErr_Format(PyExc_MemoryError, "Failed malloc()");
         break;
+      case EINVAL:
+        PyErr_Format(PyExc_ValueError, "Invalid argument(s)");
+        break;
       default:
         PyErr_Format(PyExc_Exception, "Unknown exception");
       }
@@ -10524,8 +12825,17 @@ SWIGINTERN PyObject *_wrap_E_to_phib(PyObject *self, PyObject *args) {
   }
   arg3 = (orbitparams *)(argp3);
   {
-    errno = 0;
-    E_to_phib(arg1,arg2,arg3);
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      errno = 0;
+      E_to_phib(arg1,arg2,arg3);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
     
     if (errno != 0)
     {
@@ -10534,6 +12844,9 @@ SWIGINTERN PyObject *_wrap_E_to_phib(PyObject *self, PyObject *args) {
       case ENOMEM:
         PyErr_Format(PyExc_MemoryError, "Failed malloc()");
         break;
+      case EINVAL:
+        PyErr_Format(PyExc_ValueError, "Invalid argument(s)");
+        break;
       default:
         PyErr_Format(PyExc_Exception, "Unknown exception");
       }
@@ -10574,8 +12887,17 @@ SWIGINTERN PyObject *_wrap_E_to_v(PyObject *self, PyObject *args) {
   }
   arg3 = (orbitparams *)(argp3);
   {
-    errno = 0;
-    E_to_v(arg1,arg2,arg3);
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      errno = 0;
+      E_to_v(arg1,arg2,arg3);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
     
     if (errno != 0)
     {
@@ -10584,6 +12906,9 @@ SWIGINTERN PyObject *_wrap_E_to_v(PyObject *self, PyObject *args) {
       case ENOMEM:
         PyErr_Format(PyExc_MemoryError, "Failed malloc()");
         break;
+      case EINVAL:
+        PyErr_Format(PyExc_ValueError, "Invalid argument(s)");
+        break;
       default:
         PyErr_Format(PyExc_Exception, "Unknown exception");
       }
@@ -10632,8 +12957,17 @@ SWIGINTERN PyObject *_wrap_E_to_p(PyObject *self, PyObject *args) {
   }
   arg4 = (orbitparams *)(argp4);
   {
-    errno = 0;
-    E_to_p(arg1,arg2,arg3,arg4);
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      errno = 0;
+      E_to_p(arg1,arg2,arg3,arg4);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
     
     if (errno != 0)
     {
@@ -10642,6 +12976,9 @@ SWIGINTERN PyObject *_wrap_E_to_p(PyObject *self, PyObject *args) {
       case ENOMEM:
         PyErr_Format(PyExc_MemoryError, "Failed malloc()");
         break;
+      case EINVAL:
+        PyErr_Format(PyExc_ValueError, "Invalid argument(s)");
+        break;
       default:
         PyErr_Format(PyExc_Exception, "Unknown exception");
       }
@@ -10698,8 +13035,17 @@ SWIGINTERN PyObject *_wrap_E_to_z(PyObject *self, PyObject *args) {
   }
   arg5 = (orbitparams *)(argp5);
   {
-    errno = 0;
-    E_to_z(arg1,arg2,arg3,arg4,arg5);
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      errno = 0;
+      E_to_z(arg1,arg2,arg3,arg4,arg5);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
     
     if (errno != 0)
     {
@@ -10708,6 +13054,9 @@ SWIGINTERN PyObject *_wrap_E_to_z(PyObject *self, PyObject *args) {
       case ENOMEM:
         PyErr_Format(PyExc_MemoryError, "Failed malloc()");
         break;
+      case EINVAL:
+        PyErr_Format(PyExc_ValueError, "Invalid argument(s)");
+        break;
       default:
         PyErr_Format(PyExc_Exception, "Unknown exception");
       }
@@ -10748,8 +13097,17 @@ SWIGINTERN PyObject *_wrap_E_to_phib_BT(PyObject *self, PyObject *args) {
   }
   arg3 = (orbitparams *)(argp3);
   {
-    errno = 0;
-    E_to_phib_BT(arg1,arg2,arg3);
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      errno = 0;
+      E_to_phib_BT(arg1,arg2,arg3);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
     
     if (errno != 0)
     {
@@ -10758,6 +13116,9 @@ SWIGINTERN PyObject *_wrap_E_to_phib_BT(PyObject *self, PyObject *args) {
       case ENOMEM:
         PyErr_Format(PyExc_MemoryError, "Failed malloc()");
         break;
+      case EINVAL:
+        PyErr_Format(PyExc_ValueError, "Invalid argument(s)");
+        break;
       default:
         PyErr_Format(PyExc_Exception, "Unknown exception");
       }
@@ -10818,8 +13179,17 @@ SWIGINTERN PyObject *_wrap_dorbint(PyObject *self, PyObject *args) {
   }
   arg6 = (orbitparams *)(argp6);
   {
-    errno = 0;
-    wrap_dorbint(arg1,arg2,arg3,arg4,arg5,arg6);
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      errno = 0;
+      wrap_dorbint(arg1,arg2,arg3,arg4,arg5,arg6);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
     
     if (errno != 0)
     {
@@ -10828,6 +13198,9 @@ SWIGINTERN PyObject *_wrap_dorbint(PyObject *self, PyObject *args) {
       case ENOMEM:
         PyErr_Format(PyExc_MemoryError, "Failed malloc()");
         break;
+      case EINVAL:
+        PyErr_Format(PyExc_ValueError, "Invalid argument(s)");
+        break;
       default:
         PyErr_Format(PyExc_Exception, "Unknown exception");
       }
@@ -10895,8 +13268,17 @@ SWIGINTERN PyObject *_wrap_binary_velocity(PyObject *self, PyObject *args) {
   }
   arg2 = (orbitparams *)(argp2);
   {
-    errno = 0;
-    binary_velocity(arg1,arg2,arg3,arg4);
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      errno = 0;
+      binary_velocity(arg1,arg2,arg3,arg4);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
     
     if (errno != 0)
     {
@@ -10905,6 +13287,9 @@ SWIGINTERN PyObject *_wrap_binary_velocity(PyObject *self, PyObject *args) {
       case ENOMEM:
         PyErr_Format(PyExc_MemoryError, "Failed malloc()");
         break;
+      case EINVAL:
+        PyErr_Format(PyExc_ValueError, "Invalid argument(s)");
+        break;
       default:
         PyErr_Format(PyExc_Exception, "Unknown exception");
       }
@@ -10947,8 +13332,17 @@ SWIGINTERN PyObject *_wrap_r_resp_halfwidth(PyObject *self, PyObject *args) {
   } 
   arg1 = (presto_interp_acc)(val1);
   {
-    errno = 0;
-    result = (int)r_resp_halfwidth(arg1);
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      errno = 0;
+      result = (int)r_resp_halfwidth(arg1);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
     
     if (errno != 0)
     {
@@ -10957,6 +13351,9 @@ SWIGINTERN PyObject *_wrap_r_resp_halfwidth(PyObject *self, PyObject *args) {
       case ENOMEM:
         PyErr_Format(PyExc_MemoryError, "Failed malloc()");
         break;
+      case EINVAL:
+        PyErr_Format(PyExc_ValueError, "Invalid argument(s)");
+        break;
       default:
         PyErr_Format(PyExc_Exception, "Unknown exception");
       }
@@ -10994,8 +13391,17 @@ SWIGINTERN PyObject *_wrap_z_resp_halfwidth(PyObject *self, PyObject *args) {
   } 
   arg2 = (presto_interp_acc)(val2);
   {
-    errno = 0;
-    result = (int)z_resp_halfwidth(arg1,arg2);
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      errno = 0;
+      result = (int)z_resp_halfwidth(arg1,arg2);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
     
     if (errno != 0)
     {
@@ -11004,6 +13410,9 @@ SWIGINTERN PyObject *_wrap_z_resp_halfwidth(PyObject *self, PyObject *args) {
       case ENOMEM:
         PyErr_Format(PyExc_MemoryError, "Failed malloc()");
         break;
+      case EINVAL:
+        PyErr_Format(PyExc_ValueError, "Invalid argument(s)");
+        break;
       default:
         PyErr_Format(PyExc_Exception, "Unknown exception");
       }
@@ -11049,8 +13458,17 @@ SWIGINTERN PyObject *_wrap_w_resp_halfwidth(PyObject *self, PyObject *args) {
   } 
   arg3 = (presto_interp_acc)(val3);
   {
-    errno = 0;
-    result = (int)w_resp_halfwidth(arg1,arg2,arg3);
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      errno = 0;
+      result = (int)w_resp_halfwidth(arg1,arg2,arg3);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
     
     if (errno != 0)
     {
@@ -11059,6 +13477,9 @@ SWIGINTERN PyObject *_wrap_w_resp_halfwidth(PyObject *self, PyObject *args) {
       case ENOMEM:
         PyErr_Format(PyExc_MemoryError, "Failed malloc()");
         break;
+      case EINVAL:
+        PyErr_Format(PyExc_ValueError, "Invalid argument(s)");
+        break;
       default:
         PyErr_Format(PyExc_Exception, "Unknown exception");
       }
@@ -11104,8 +13525,17 @@ SWIGINTERN PyObject *_wrap_bin_resp_halfwidth(PyObject *self, PyObject *args) {
   }
   arg3 = (orbitparams *)(argp3);
   {
-    errno = 0;
-    result = (int)bin_resp_halfwidth(arg1,arg2,arg3);
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      errno = 0;
+      result = (int)bin_resp_halfwidth(arg1,arg2,arg3);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
     
     if (errno != 0)
     {
@@ -11114,6 +13544,9 @@ SWIGINTERN PyObject *_wrap_bin_resp_halfwidth(PyObject *self, PyObject *args) {
       case ENOMEM:
         PyErr_Format(PyExc_MemoryError, "Failed malloc()");
         break;
+      case EINVAL:
+        PyErr_Format(PyExc_ValueError, "Invalid argument(s)");
+        break;
       default:
         PyErr_Format(PyExc_Exception, "Unknown exception");
       }
@@ -11166,8 +13599,17 @@ SWIGINTERN PyObject *_wrap_gen_r_response(PyObject *self, PyObject *args) {
   } 
   arg3 = (int)(val3);
   {
-    errno = 0;
-    wrap_gen_r_response(arg1,arg2,arg3,arg4,arg5);
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      errno = 0;
+      wrap_gen_r_response(arg1,arg2,arg3,arg4,arg5);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
     
     if (errno != 0)
     {
@@ -11176,6 +13618,9 @@ SWIGINTERN PyObject *_wrap_gen_r_response(PyObject *self, PyObject *args) {
       case ENOMEM:
         PyErr_Format(PyExc_MemoryError, "Failed malloc()");
         break;
+      case EINVAL:
+        PyErr_Format(PyExc_ValueError, "Invalid argument(s)");
+        break;
       default:
         PyErr_Format(PyExc_Exception, "Unknown exception");
       }
@@ -11259,8 +13704,17 @@ SWIGINTERN PyObject *_wrap_gen_z_response(PyObject *self, PyObject *args) {
   } 
   arg4 = (double)(val4);
   {
-    errno = 0;
-    wrap_gen_z_response(arg1,arg2,arg3,arg4,arg5,arg6);
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      errno = 0;
+      wrap_gen_z_response(arg1,arg2,arg3,arg4,arg5,arg6);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
     
     if (errno != 0)
     {
@@ -11269,6 +13723,9 @@ SWIGINTERN PyObject *_wrap_gen_z_response(PyObject *self, PyObject *args) {
       case ENOMEM:
         PyErr_Format(PyExc_MemoryError, "Failed malloc()");
         break;
+      case EINVAL:
+        PyErr_Format(PyExc_ValueError, "Invalid argument(s)");
+        break;
       default:
         PyErr_Format(PyExc_Exception, "Unknown exception");
       }
@@ -11360,8 +13817,17 @@ SWIGINTERN PyObject *_wrap_gen_w_response(PyObject *self, PyObject *args) {
   } 
   arg5 = (double)(val5);
   {
-    errno = 0;
-    wrap_gen_w_response(arg1,arg2,arg3,arg4,arg5,arg6,arg7);
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      errno = 0;
+      wrap_gen_w_response(arg1,arg2,arg3,arg4,arg5,arg6,arg7);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
     
     if (errno != 0)
     {
@@ -11370,6 +13836,9 @@ SWIGINTERN PyObject *_wrap_gen_w_response(PyObject *self, PyObject *args) {
       case ENOMEM:
         PyErr_Format(PyExc_MemoryError, "Failed malloc()");
         break;
+      case EINVAL:
+        PyErr_Format(PyExc_ValueError, "Invalid argument(s)");
+        break;
       default:
         PyErr_Format(PyExc_Exception, "Unknown exception");
       }
@@ -11461,8 +13930,17 @@ SWIGINTERN PyObject *_wrap_gen_w_response2(PyObject *self, PyObject *args) {
   } 
   arg5 = (double)(val5);
   {
-    errno = 0;
-    wrap_gen_w_response2(arg1,arg2,arg3,arg4,arg5,arg6,arg7);
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      errno = 0;
+      wrap_gen_w_response2(arg1,arg2,arg3,arg4,arg5,arg6,arg7);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
     
     if (errno != 0)
     {
@@ -11471,6 +13949,9 @@ SWIGINTERN PyObject *_wrap_gen_w_response2(PyObject *self, PyObject *args) {
       case ENOMEM:
         PyErr_Format(PyExc_MemoryError, "Failed malloc()");
         break;
+      case EINVAL:
+        PyErr_Format(PyExc_ValueError, "Invalid argument(s)");
+        break;
       default:
         PyErr_Format(PyExc_Exception, "Unknown exception");
       }
@@ -11570,8 +14051,17 @@ SWIGINTERN PyObject *_wrap_gen_bin_response(PyObject *self, PyObject *args) {
   }
   arg6 = (orbitparams *)(argp6);
   {
-    errno = 0;
-    wrap_gen_bin_response(arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8);
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      errno = 0;
+      wrap_gen_bin_response(arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
     
     if (errno != 0)
     {
@@ -11580,6 +14070,9 @@ SWIGINTERN PyObject *_wrap_gen_bin_response(PyObject *self, PyObject *args) {
       case ENOMEM:
         PyErr_Format(PyExc_MemoryError, "Failed malloc()");
         break;
+      case EINVAL:
+        PyErr_Format(PyExc_ValueError, "Invalid argument(s)");
+        break;
       default:
         PyErr_Format(PyExc_Exception, "Unknown exception");
       }
@@ -11648,8 +14141,17 @@ SWIGINTERN PyObject *_wrap_get_localpower(PyObject *self, PyObject *args) {
   } 
   arg3 = (double)(val3);
   {
-    errno = 0;
-    result = (float)get_localpower(arg1,arg2,arg3);
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      errno = 0;
+      result = (float)get_localpower(arg1,arg2,arg3);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
     
     if (errno != 0)
     {
@@ -11658,6 +14160,9 @@ SWIGINTERN PyObject *_wrap_get_localpower(PyObject *self, PyObject *args) {
       case ENOMEM:
         PyErr_Format(PyExc_MemoryError, "Failed malloc()");
         break;
+      case EINVAL:
+        PyErr_Format(PyExc_ValueError, "Invalid argument(s)");
+        break;
       default:
         PyErr_Format(PyExc_Exception, "Unknown exception");
       }
@@ -11731,8 +14236,17 @@ SWIGINTERN PyObject *_wrap_get_localpower3d(PyObject *self, PyObject *args) {
   } 
   arg5 = (double)(val5);
   {
-    errno = 0;
-    result = (float)get_localpower3d(arg1,arg2,arg3,arg4,arg5);
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      errno = 0;
+      result = (float)get_localpower3d(arg1,arg2,arg3,arg4,arg5);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
     
     if (errno != 0)
     {
@@ -11741,6 +14255,9 @@ SWIGINTERN PyObject *_wrap_get_localpower3d(PyObject *self, PyObject *args) {
       case ENOMEM:
         PyErr_Format(PyExc_MemoryError, "Failed malloc()");
         break;
+      case EINVAL:
+        PyErr_Format(PyExc_ValueError, "Invalid argument(s)");
+        break;
       default:
         PyErr_Format(PyExc_Exception, "Unknown exception");
       }
@@ -11829,8 +14346,17 @@ SWIGINTERN PyObject *_wrap_get_derivs3d(PyObject *self, PyObject *args) {
   }
   arg7 = (rderivs *)(argp7);
   {
-    errno = 0;
-    get_derivs3d(arg1,arg2,arg3,arg4,arg5,arg6,arg7);
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      errno = 0;
+      get_derivs3d(arg1,arg2,arg3,arg4,arg5,arg6,arg7);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
     
     if (errno != 0)
     {
@@ -11839,6 +14365,9 @@ SWIGINTERN PyObject *_wrap_get_derivs3d(PyObject *self, PyObject *args) {
       case ENOMEM:
         PyErr_Format(PyExc_MemoryError, "Failed malloc()");
         break;
+      case EINVAL:
+        PyErr_Format(PyExc_ValueError, "Invalid argument(s)");
+        break;
       default:
         PyErr_Format(PyExc_Exception, "Unknown exception");
       }
@@ -11917,8 +14446,17 @@ SWIGINTERN PyObject *_wrap_calc_props(PyObject *self, PyObject *args) {
   }
   arg5 = (fourierprops *)(argp5);
   {
-    errno = 0;
-    calc_props(arg1,arg2,arg3,arg4,arg5);
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      errno = 0;
+      calc_props(arg1,arg2,arg3,arg4,arg5);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
     
     if (errno != 0)
     {
@@ -11927,6 +14465,9 @@ SWIGINTERN PyObject *_wrap_calc_props(PyObject *self, PyObject *args) {
       case ENOMEM:
         PyErr_Format(PyExc_MemoryError, "Failed malloc()");
         break;
+      case EINVAL:
+        PyErr_Format(PyExc_ValueError, "Invalid argument(s)");
+        break;
       default:
         PyErr_Format(PyExc_Exception, "Unknown exception");
       }
@@ -11987,8 +14528,17 @@ SWIGINTERN PyObject *_wrap_calc_binprops(PyObject *self, PyObject *args) {
   }
   arg5 = (binaryprops *)(argp5);
   {
-    errno = 0;
-    calc_binprops(arg1,arg2,arg3,arg4,arg5);
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      errno = 0;
+      calc_binprops(arg1,arg2,arg3,arg4,arg5);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
     
     if (errno != 0)
     {
@@ -11997,6 +14547,9 @@ SWIGINTERN PyObject *_wrap_calc_binprops(PyObject *self, PyObject *args) {
       case ENOMEM:
         PyErr_Format(PyExc_MemoryError, "Failed malloc()");
         break;
+      case EINVAL:
+        PyErr_Format(PyExc_ValueError, "Invalid argument(s)");
+        break;
       default:
         PyErr_Format(PyExc_Exception, "Unknown exception");
       }
@@ -12041,8 +14594,17 @@ SWIGINTERN PyObject *_wrap_calc_rzwerrs(PyObject *self, PyObject *args) {
   }
   arg3 = (rzwerrs *)(argp3);
   {
-    errno = 0;
-    calc_rzwerrs(arg1,arg2,arg3);
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      errno = 0;
+      calc_rzwerrs(arg1,arg2,arg3);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
     
     if (errno != 0)
     {
@@ -12051,6 +14613,9 @@ SWIGINTERN PyObject *_wrap_calc_rzwerrs(PyObject *self, PyObject *args) {
       case ENOMEM:
         PyErr_Format(PyExc_MemoryError, "Failed malloc()");
         break;
+      case EINVAL:
+        PyErr_Format(PyExc_ValueError, "Invalid argument(s)");
+        break;
       default:
         PyErr_Format(PyExc_Exception, "Unknown exception");
       }
@@ -12081,8 +14646,17 @@ SWIGINTERN PyObject *_wrap_extended_equiv_gaussian_sigma(PyObject *self, PyObjec
   } 
   arg1 = (double)(val1);
   {
-    errno = 0;
-    result = (double)extended_equiv_gaussian_sigma(arg1);
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      errno = 0;
+      result = (double)extended_equiv_gaussian_sigma(arg1);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
     
     if (errno != 0)
     {
@@ -12091,6 +14665,9 @@ SWIGINTERN PyObject *_wrap_extended_equiv_gaussian_sigma(PyObject *self, PyObjec
       case ENOMEM:
         PyErr_Format(PyExc_MemoryError, "Failed malloc()");
         break;
+      case EINVAL:
+        PyErr_Format(PyExc_ValueError, "Invalid argument(s)");
+        break;
       default:
         PyErr_Format(PyExc_Exception, "Unknown exception");
       }
@@ -12128,8 +14705,17 @@ SWIGINTERN PyObject *_wrap_log_asymtotic_incomplete_gamma(PyObject *self, PyObje
   } 
   arg2 = (double)(val2);
   {
-    errno = 0;
-    result = (double)log_asymtotic_incomplete_gamma(arg1,arg2);
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      errno = 0;
+      result = (double)log_asymtotic_incomplete_gamma(arg1,arg2);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
     
     if (errno != 0)
     {
@@ -12138,6 +14724,9 @@ SWIGINTERN PyObject *_wrap_log_asymtotic_incomplete_gamma(PyObject *self, PyObje
       case ENOMEM:
         PyErr_Format(PyExc_MemoryError, "Failed malloc()");
         break;
+      case EINVAL:
+        PyErr_Format(PyExc_ValueError, "Invalid argument(s)");
+        break;
       default:
         PyErr_Format(PyExc_Exception, "Unknown exception");
       }
@@ -12168,8 +14757,17 @@ SWIGINTERN PyObject *_wrap_log_asymtotic_gamma(PyObject *self, PyObject *args) {
   } 
   arg1 = (double)(val1);
   {
-    errno = 0;
-    result = (double)log_asymtotic_gamma(arg1);
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      errno = 0;
+      result = (double)log_asymtotic_gamma(arg1);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
     
     if (errno != 0)
     {
@@ -12178,6 +14776,9 @@ SWIGINTERN PyObject *_wrap_log_asymtotic_gamma(PyObject *self, PyObject *args) {
       case ENOMEM:
         PyErr_Format(PyExc_MemoryError, "Failed malloc()");
         break;
+      case EINVAL:
+        PyErr_Format(PyExc_ValueError, "Invalid argument(s)");
+        break;
       default:
         PyErr_Format(PyExc_Exception, "Unknown exception");
       }
@@ -12208,8 +14809,17 @@ SWIGINTERN PyObject *_wrap_equivalent_gaussian_sigma(PyObject *self, PyObject *a
   } 
   arg1 = (double)(val1);
   {
-    errno = 0;
-    result = (double)equivalent_gaussian_sigma(arg1);
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      errno = 0;
+      result = (double)equivalent_gaussian_sigma(arg1);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
     
     if (errno != 0)
     {
@@ -12218,6 +14828,9 @@ SWIGINTERN PyObject *_wrap_equivalent_gaussian_sigma(PyObject *self, PyObject *a
       case ENOMEM:
         PyErr_Format(PyExc_MemoryError, "Failed malloc()");
         break;
+      case EINVAL:
+        PyErr_Format(PyExc_ValueError, "Invalid argument(s)");
+        break;
       default:
         PyErr_Format(PyExc_Exception, "Unknown exception");
       }
@@ -12255,8 +14868,17 @@ SWIGINTERN PyObject *_wrap_chi2_logp(PyObject *self, PyObject *args) {
   } 
   arg2 = (double)(val2);
   {
-    errno = 0;
-    result = (double)chi2_logp(arg1,arg2);
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      errno = 0;
+      result = (double)chi2_logp(arg1,arg2);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
     
     if (errno != 0)
     {
@@ -12265,6 +14887,9 @@ SWIGINTERN PyObject *_wrap_chi2_logp(PyObject *self, PyObject *args) {
       case ENOMEM:
         PyErr_Format(PyExc_MemoryError, "Failed malloc()");
         break;
+      case EINVAL:
+        PyErr_Format(PyExc_ValueError, "Invalid argument(s)");
+        break;
       default:
         PyErr_Format(PyExc_Exception, "Unknown exception");
       }
@@ -12302,8 +14927,17 @@ SWIGINTERN PyObject *_wrap_chi2_sigma(PyObject *self, PyObject *args) {
   } 
   arg2 = (double)(val2);
   {
-    errno = 0;
-    result = (double)chi2_sigma(arg1,arg2);
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      errno = 0;
+      result = (double)chi2_sigma(arg1,arg2);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
     
     if (errno != 0)
     {
@@ -12312,6 +14946,9 @@ SWIGINTERN PyObject *_wrap_chi2_sigma(PyObject *self, PyObject *args) {
       case ENOMEM:
         PyErr_Format(PyExc_MemoryError, "Failed malloc()");
         break;
+      case EINVAL:
+        PyErr_Format(PyExc_ValueError, "Invalid argument(s)");
+        break;
       default:
         PyErr_Format(PyExc_Exception, "Unknown exception");
       }
@@ -12357,8 +14994,17 @@ SWIGINTERN PyObject *_wrap_candidate_sigma(PyObject *self, PyObject *args) {
   } 
   arg3 = (double)(val3);
   {
-    errno = 0;
-    result = (double)candidate_sigma(arg1,arg2,arg3);
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      errno = 0;
+      result = (double)candidate_sigma(arg1,arg2,arg3);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
     
     if (errno != 0)
     {
@@ -12367,6 +15013,9 @@ SWIGINTERN PyObject *_wrap_candidate_sigma(PyObject *self, PyObject *args) {
       case ENOMEM:
         PyErr_Format(PyExc_MemoryError, "Failed malloc()");
         break;
+      case EINVAL:
+        PyErr_Format(PyExc_ValueError, "Invalid argument(s)");
+        break;
       default:
         PyErr_Format(PyExc_Exception, "Unknown exception");
       }
@@ -12412,8 +15061,17 @@ SWIGINTERN PyObject *_wrap_power_for_sigma(PyObject *self, PyObject *args) {
   } 
   arg3 = (double)(val3);
   {
-    errno = 0;
-    result = (double)power_for_sigma(arg1,arg2,arg3);
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      errno = 0;
+      result = (double)power_for_sigma(arg1,arg2,arg3);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
     
     if (errno != 0)
     {
@@ -12422,6 +15080,9 @@ SWIGINTERN PyObject *_wrap_power_for_sigma(PyObject *self, PyObject *args) {
       case ENOMEM:
         PyErr_Format(PyExc_MemoryError, "Failed malloc()");
         break;
+      case EINVAL:
+        PyErr_Format(PyExc_ValueError, "Invalid argument(s)");
+        break;
       default:
         PyErr_Format(PyExc_Exception, "Unknown exception");
       }
@@ -12478,8 +15139,17 @@ SWIGINTERN PyObject *_wrap_switch_f_and_p(PyObject *self, PyObject *args) {
   } 
   arg3 = (double)(val3);
   {
-    errno = 0;
-    switch_f_and_p(arg1,arg2,arg3,arg4,arg5,arg6);
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      errno = 0;
+      switch_f_and_p(arg1,arg2,arg3,arg4,arg5,arg6);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
     
     if (errno != 0)
     {
@@ -12488,6 +15158,9 @@ SWIGINTERN PyObject *_wrap_switch_f_and_p(PyObject *self, PyObject *args) {
       case ENOMEM:
         PyErr_Format(PyExc_MemoryError, "Failed malloc()");
         break;
+      case EINVAL:
+        PyErr_Format(PyExc_ValueError, "Invalid argument(s)");
+        break;
       default:
         PyErr_Format(PyExc_Exception, "Unknown exception");
       }
@@ -12559,8 +15232,17 @@ SWIGINTERN PyObject *_wrap_chisqr(PyObject *self, PyObject *args) {
   } 
   arg4 = (double)(val4);
   {
-    errno = 0;
-    result = (double)chisqr(arg1,arg2,arg3,arg4);
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      errno = 0;
+      result = (double)chisqr(arg1,arg2,arg3,arg4);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
     
     if (errno != 0)
     {
@@ -12569,6 +15251,9 @@ SWIGINTERN PyObject *_wrap_chisqr(PyObject *self, PyObject *args) {
       case ENOMEM:
         PyErr_Format(PyExc_MemoryError, "Failed malloc()");
         break;
+      case EINVAL:
+        PyErr_Format(PyExc_ValueError, "Invalid argument(s)");
+        break;
       default:
         PyErr_Format(PyExc_Exception, "Unknown exception");
       }
@@ -12634,8 +15319,17 @@ SWIGINTERN PyObject *_wrap_z2n(PyObject *self, PyObject *args) {
   } 
   arg4 = (int)(val4);
   {
-    errno = 0;
-    result = (double)z2n(arg1,arg2,arg3,arg4);
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      errno = 0;
+      result = (double)z2n(arg1,arg2,arg3,arg4);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
     
     if (errno != 0)
     {
@@ -12644,6 +15338,9 @@ SWIGINTERN PyObject *_wrap_z2n(PyObject *self, PyObject *args) {
       case ENOMEM:
         PyErr_Format(PyExc_MemoryError, "Failed malloc()");
         break;
+      case EINVAL:
+        PyErr_Format(PyExc_ValueError, "Invalid argument(s)");
+        break;
       default:
         PyErr_Format(PyExc_Exception, "Unknown exception");
       }
@@ -12716,8 +15413,17 @@ SWIGINTERN PyObject *_wrap_print_candidate(PyObject *self, PyObject *args) {
   } 
   arg5 = (int)(val5);
   {
-    errno = 0;
-    print_candidate(arg1,arg2,arg3,arg4,arg5);
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      errno = 0;
+      print_candidate(arg1,arg2,arg3,arg4,arg5);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
     
     if (errno != 0)
     {
@@ -12726,6 +15432,9 @@ SWIGINTERN PyObject *_wrap_print_candidate(PyObject *self, PyObject *args) {
       case ENOMEM:
         PyErr_Format(PyExc_MemoryError, "Failed malloc()");
         break;
+      case EINVAL:
+        PyErr_Format(PyExc_ValueError, "Invalid argument(s)");
+        break;
       default:
         PyErr_Format(PyExc_Exception, "Unknown exception");
       }
@@ -12762,8 +15471,17 @@ SWIGINTERN PyObject *_wrap_print_bin_candidate(PyObject *self, PyObject *args) {
   } 
   arg2 = (int)(val2);
   {
-    errno = 0;
-    print_bin_candidate(arg1,arg2);
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      errno = 0;
+      print_bin_candidate(arg1,arg2);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
     
     if (errno != 0)
     {
@@ -12772,6 +15490,9 @@ SWIGINTERN PyObject *_wrap_print_bin_candidate(PyObject *self, PyObject *args) {
       case ENOMEM:
         PyErr_Format(PyExc_MemoryError, "Failed malloc()");
         break;
+      case EINVAL:
+        PyErr_Format(PyExc_ValueError, "Invalid argument(s)");
+        break;
       default:
         PyErr_Format(PyExc_Exception, "Unknown exception");
       }
@@ -12811,8 +15532,17 @@ SWIGINTERN PyObject *_wrap_fopen(PyObject *self, PyObject *args) {
   }
   arg2 = (char *)(buf2);
   {
-    errno = 0;
-    result = (FILE *)fopen((char const *)arg1,(char const *)arg2);
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      errno = 0;
+      result = (FILE *)fopen((char const *)arg1,(char const *)arg2);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
     
     if (errno != 0)
     {
@@ -12821,6 +15551,9 @@ SWIGINTERN PyObject *_wrap_fopen(PyObject *self, PyObject *args) {
       case ENOMEM:
         PyErr_Format(PyExc_MemoryError, "Failed malloc()");
         break;
+      case EINVAL:
+        PyErr_Format(PyExc_ValueError, "Invalid argument(s)");
+        break;
       default:
         PyErr_Format(PyExc_Exception, "Unknown exception");
       }
@@ -12863,8 +15596,17 @@ SWIGINTERN PyObject *_wrap_fputs(PyObject *self, PyObject *args) {
   }
   arg2 = (FILE *)(argp2);
   {
-    errno = 0;
-    result = (int)fputs((char const *)arg1,arg2);
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      errno = 0;
+      result = (int)fputs((char const *)arg1,arg2);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
     
     if (errno != 0)
     {
@@ -12873,6 +15615,9 @@ SWIGINTERN PyObject *_wrap_fputs(PyObject *self, PyObject *args) {
       case ENOMEM:
         PyErr_Format(PyExc_MemoryError, "Failed malloc()");
         break;
+      case EINVAL:
+        PyErr_Format(PyExc_ValueError, "Invalid argument(s)");
+        break;
       default:
         PyErr_Format(PyExc_Exception, "Unknown exception");
       }
@@ -12905,8 +15650,17 @@ SWIGINTERN PyObject *_wrap_fclose(PyObject *self, PyObject *args) {
   }
   arg1 = (FILE *)(argp1);
   {
-    errno = 0;
-    result = (int)fclose(arg1);
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      errno = 0;
+      result = (int)fclose(arg1);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
     
     if (errno != 0)
     {
@@ -12915,6 +15669,9 @@ SWIGINTERN PyObject *_wrap_fclose(PyObject *self, PyObject *args) {
       case ENOMEM:
         PyErr_Format(PyExc_MemoryError, "Failed malloc()");
         break;
+      case EINVAL:
+        PyErr_Format(PyExc_ValueError, "Invalid argument(s)");
+        break;
       default:
         PyErr_Format(PyExc_Exception, "Unknown exception");
       }
@@ -12960,8 +15717,17 @@ SWIGINTERN PyObject *_wrap_fseek(PyObject *self, PyObject *args) {
   } 
   arg3 = (int)(val3);
   {
-    errno = 0;
-    result = (int)fseek(arg1,arg2,arg3);
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      errno = 0;
+      result = (int)fseek(arg1,arg2,arg3);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
     
     if (errno != 0)
     {
@@ -12970,6 +15736,9 @@ SWIGINTERN PyObject *_wrap_fseek(PyObject *self, PyObject *args) {
       case ENOMEM:
         PyErr_Format(PyExc_MemoryError, "Failed malloc()");
         break;
+      case EINVAL:
+        PyErr_Format(PyExc_ValueError, "Invalid argument(s)");
+        break;
       default:
         PyErr_Format(PyExc_Exception, "Unknown exception");
       }
@@ -13007,8 +15776,17 @@ SWIGINTERN PyObject *_wrap_read_rzw_cand(PyObject *self, PyObject *args) {
   }
   arg2 = (fourierprops *)(argp2);
   {
-    errno = 0;
-    result = (int)read_rzw_cand(arg1,arg2);
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      errno = 0;
+      result = (int)read_rzw_cand(arg1,arg2);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
     
     if (errno != 0)
     {
@@ -13017,6 +15795,9 @@ SWIGINTERN PyObject *_wrap_read_rzw_cand(PyObject *self, PyObject *args) {
       case ENOMEM:
         PyErr_Format(PyExc_MemoryError, "Failed malloc()");
         break;
+      case EINVAL:
+        PyErr_Format(PyExc_ValueError, "Invalid argument(s)");
+        break;
       default:
         PyErr_Format(PyExc_Exception, "Unknown exception");
       }
@@ -13062,8 +15843,17 @@ SWIGINTERN PyObject *_wrap_get_rzw_cand(PyObject *self, PyObject *args) {
   }
   arg3 = (fourierprops *)(argp3);
   {
-    errno = 0;
-    get_rzw_cand(arg1,arg2,arg3);
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      errno = 0;
+      get_rzw_cand(arg1,arg2,arg3);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
     
     if (errno != 0)
     {
@@ -13072,6 +15862,9 @@ SWIGINTERN PyObject *_wrap_get_rzw_cand(PyObject *self, PyObject *args) {
       case ENOMEM:
         PyErr_Format(PyExc_MemoryError, "Failed malloc()");
         break;
+      case EINVAL:
+        PyErr_Format(PyExc_ValueError, "Invalid argument(s)");
+        break;
       default:
         PyErr_Format(PyExc_Exception, "Unknown exception");
       }
@@ -13111,8 +15904,17 @@ SWIGINTERN PyObject *_wrap_read_bin_cand(PyObject *self, PyObject *args) {
   }
   arg2 = (binaryprops *)(argp2);
   {
-    errno = 0;
-    result = (int)read_bin_cand(arg1,arg2);
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      errno = 0;
+      result = (int)read_bin_cand(arg1,arg2);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
     
     if (errno != 0)
     {
@@ -13121,6 +15923,9 @@ SWIGINTERN PyObject *_wrap_read_bin_cand(PyObject *self, PyObject *args) {
       case ENOMEM:
         PyErr_Format(PyExc_MemoryError, "Failed malloc()");
         break;
+      case EINVAL:
+        PyErr_Format(PyExc_ValueError, "Invalid argument(s)");
+        break;
       default:
         PyErr_Format(PyExc_Exception, "Unknown exception");
       }
@@ -13166,8 +15971,17 @@ SWIGINTERN PyObject *_wrap_get_bin_cand(PyObject *self, PyObject *args) {
   }
   arg3 = (binaryprops *)(argp3);
   {
-    errno = 0;
-    get_bin_cand(arg1,arg2,arg3);
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      errno = 0;
+      get_bin_cand(arg1,arg2,arg3);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
     
     if (errno != 0)
     {
@@ -13176,6 +15990,9 @@ SWIGINTERN PyObject *_wrap_get_bin_cand(PyObject *self, PyObject *args) {
       case ENOMEM:
         PyErr_Format(PyExc_MemoryError, "Failed malloc()");
         break;
+      case EINVAL:
+        PyErr_Format(PyExc_ValueError, "Invalid argument(s)");
+        break;
       default:
         PyErr_Format(PyExc_Exception, "Unknown exception");
       }
@@ -13208,8 +16025,17 @@ SWIGINTERN PyObject *_wrap_next2_to_n(PyObject *self, PyObject *args) {
   } 
   arg1 = (long long)(val1);
   {
-    errno = 0;
-    result = (long long)next2_to_n(arg1);
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      errno = 0;
+      result = (long long)next2_to_n(arg1);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
     
     if (errno != 0)
     {
@@ -13218,6 +16044,9 @@ SWIGINTERN PyObject *_wrap_next2_to_n(PyObject *self, PyObject *args) {
       case ENOMEM:
         PyErr_Format(PyExc_MemoryError, "Failed malloc()");
         break;
+      case EINVAL:
+        PyErr_Format(PyExc_ValueError, "Invalid argument(s)");
+        break;
       default:
         PyErr_Format(PyExc_Exception, "Unknown exception");
       }
@@ -13248,8 +16077,17 @@ SWIGINTERN PyObject *_wrap_is_power_of_10(PyObject *self, PyObject *args) {
   } 
   arg1 = (long long)(val1);
   {
-    errno = 0;
-    result = (int)is_power_of_10(arg1);
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      errno = 0;
+      result = (int)is_power_of_10(arg1);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
     
     if (errno != 0)
     {
@@ -13258,6 +16096,9 @@ SWIGINTERN PyObject *_wrap_is_power_of_10(PyObject *self, PyObject *args) {
       case ENOMEM:
         PyErr_Format(PyExc_MemoryError, "Failed malloc()");
         break;
+      case EINVAL:
+        PyErr_Format(PyExc_ValueError, "Invalid argument(s)");
+        break;
       default:
         PyErr_Format(PyExc_Exception, "Unknown exception");
       }
@@ -13288,8 +16129,17 @@ SWIGINTERN PyObject *_wrap_choose_good_N(PyObject *self, PyObject *args) {
   } 
   arg1 = (long long)(val1);
   {
-    errno = 0;
-    result = (long long)choose_good_N(arg1);
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      errno = 0;
+      result = (long long)choose_good_N(arg1);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
     
     if (errno != 0)
     {
@@ -13298,6 +16148,9 @@ SWIGINTERN PyObject *_wrap_choose_good_N(PyObject *self, PyObject *args) {
       case ENOMEM:
         PyErr_Format(PyExc_MemoryError, "Failed malloc()");
         break;
+      case EINVAL:
+        PyErr_Format(PyExc_ValueError, "Invalid argument(s)");
+        break;
       default:
         PyErr_Format(PyExc_Exception, "Unknown exception");
       }
@@ -13343,8 +16196,17 @@ SWIGINTERN PyObject *_wrap_dms2rad(PyObject *self, PyObject *args) {
   } 
   arg3 = (double)(val3);
   {
-    errno = 0;
-    result = (double)dms2rad(arg1,arg2,arg3);
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      errno = 0;
+      result = (double)dms2rad(arg1,arg2,arg3);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
     
     if (errno != 0)
     {
@@ -13353,6 +16215,9 @@ SWIGINTERN PyObject *_wrap_dms2rad(PyObject *self, PyObject *args) {
       case ENOMEM:
         PyErr_Format(PyExc_MemoryError, "Failed malloc()");
         break;
+      case EINVAL:
+        PyErr_Format(PyExc_ValueError, "Invalid argument(s)");
+        break;
       default:
         PyErr_Format(PyExc_Exception, "Unknown exception");
       }
@@ -13398,8 +16263,17 @@ SWIGINTERN PyObject *_wrap_hms2rad(PyObject *self, PyObject *args) {
   } 
   arg3 = (double)(val3);
   {
-    errno = 0;
-    result = (double)hms2rad(arg1,arg2,arg3);
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      errno = 0;
+      result = (double)hms2rad(arg1,arg2,arg3);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
     
     if (errno != 0)
     {
@@ -13408,6 +16282,9 @@ SWIGINTERN PyObject *_wrap_hms2rad(PyObject *self, PyObject *args) {
       case ENOMEM:
         PyErr_Format(PyExc_MemoryError, "Failed malloc()");
         break;
+      case EINVAL:
+        PyErr_Format(PyExc_ValueError, "Invalid argument(s)");
+        break;
       default:
         PyErr_Format(PyExc_Exception, "Unknown exception");
       }
@@ -13449,8 +16326,17 @@ SWIGINTERN PyObject *_wrap_hours2hms(PyObject *self, PyObject *args) {
   } 
   arg1 = (double)(val1);
   {
-    errno = 0;
-    hours2hms(arg1,arg2,arg3,arg4);
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      errno = 0;
+      hours2hms(arg1,arg2,arg3,arg4);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
     
     if (errno != 0)
     {
@@ -13459,6 +16345,9 @@ SWIGINTERN PyObject *_wrap_hours2hms(PyObject *self, PyObject *args) {
       case ENOMEM:
         PyErr_Format(PyExc_MemoryError, "Failed malloc()");
         break;
+      case EINVAL:
+        PyErr_Format(PyExc_ValueError, "Invalid argument(s)");
+        break;
       default:
         PyErr_Format(PyExc_Exception, "Unknown exception");
       }
@@ -13518,8 +16407,17 @@ SWIGINTERN PyObject *_wrap_deg2dms(PyObject *self, PyObject *args) {
   } 
   arg1 = (double)(val1);
   {
-    errno = 0;
-    deg2dms(arg1,arg2,arg3,arg4);
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      errno = 0;
+      deg2dms(arg1,arg2,arg3,arg4);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
     
     if (errno != 0)
     {
@@ -13528,6 +16426,9 @@ SWIGINTERN PyObject *_wrap_deg2dms(PyObject *self, PyObject *args) {
       case ENOMEM:
         PyErr_Format(PyExc_MemoryError, "Failed malloc()");
         break;
+      case EINVAL:
+        PyErr_Format(PyExc_ValueError, "Invalid argument(s)");
+        break;
       default:
         PyErr_Format(PyExc_Exception, "Unknown exception");
       }
@@ -13599,8 +16500,17 @@ SWIGINTERN PyObject *_wrap_sphere_ang_diff(PyObject *self, PyObject *args) {
   } 
   arg4 = (double)(val4);
   {
-    errno = 0;
-    result = (double)sphere_ang_diff(arg1,arg2,arg3,arg4);
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      errno = 0;
+      result = (double)sphere_ang_diff(arg1,arg2,arg3,arg4);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
     
     if (errno != 0)
     {
@@ -13609,6 +16519,9 @@ SWIGINTERN PyObject *_wrap_sphere_ang_diff(PyObject *self, PyObject *args) {
       case ENOMEM:
         PyErr_Format(PyExc_MemoryError, "Failed malloc()");
         break;
+      case EINVAL:
+        PyErr_Format(PyExc_ValueError, "Invalid argument(s)");
+        break;
       default:
         PyErr_Format(PyExc_Exception, "Unknown exception");
       }
@@ -13673,8 +16586,17 @@ SWIGINTERN PyObject *_wrap_rz_interp(PyObject *self, PyObject *args) {
   } 
   arg5 = (int)(val5);
   {
-    errno = 0;
-    wrap_rz_interp(arg1,arg2,arg3,arg4,arg5,arg6,arg7);
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      errno = 0;
+      wrap_rz_interp(arg1,arg2,arg3,arg4,arg5,arg6,arg7);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
     
     if (errno != 0)
     {
@@ -13683,6 +16605,9 @@ SWIGINTERN PyObject *_wrap_rz_interp(PyObject *self, PyObject *args) {
       case ENOMEM:
         PyErr_Format(PyExc_MemoryError, "Failed malloc()");
         break;
+      case EINVAL:
+        PyErr_Format(PyExc_ValueError, "Invalid argument(s)");
+        break;
       default:
         PyErr_Format(PyExc_Exception, "Unknown exception");
       }
@@ -13794,8 +16719,17 @@ SWIGINTERN PyObject *_wrap_corr_rz_plane(PyObject *self, PyObject *args) {
   } 
   arg9 = (presto_interp_acc)(val9);
   {
-    errno = 0;
-    wrap_corr_rz_plane(arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10,arg11,arg12);
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      errno = 0;
+      wrap_corr_rz_plane(arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10,arg11,arg12);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
     
     if (errno != 0)
     {
@@ -13804,6 +16738,9 @@ SWIGINTERN PyObject *_wrap_corr_rz_plane(PyObject *self, PyObject *args) {
       case ENOMEM:
         PyErr_Format(PyExc_MemoryError, "Failed malloc()");
         break;
+      case EINVAL:
+        PyErr_Format(PyExc_ValueError, "Invalid argument(s)");
+        break;
       default:
         PyErr_Format(PyExc_Exception, "Unknown exception");
       }
@@ -13953,8 +16890,17 @@ SWIGINTERN PyObject *_wrap_corr_rzw_vol(PyObject *self, PyObject *args) {
   } 
   arg12 = (presto_interp_acc)(val12);
   {
-    errno = 0;
-    wrap_corr_rzw_vol(arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10,arg11,arg12,arg13,arg14,arg15,arg16);
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      errno = 0;
+      wrap_corr_rzw_vol(arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10,arg11,arg12,arg13,arg14,arg15,arg16);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
     
     if (errno != 0)
     {
@@ -13963,6 +16909,9 @@ SWIGINTERN PyObject *_wrap_corr_rzw_vol(PyObject *self, PyObject *args) {
       case ENOMEM:
         PyErr_Format(PyExc_MemoryError, "Failed malloc()");
         break;
+      case EINVAL:
+        PyErr_Format(PyExc_ValueError, "Invalid argument(s)");
+        break;
       default:
         PyErr_Format(PyExc_Exception, "Unknown exception");
       }
@@ -14042,8 +16991,17 @@ SWIGINTERN PyObject *_wrap_max_r_arr(PyObject *self, PyObject *args) {
   }
   arg4 = (rderivs *)(argp4);
   {
-    errno = 0;
-    wrap_max_r_arr(arg1,arg2,arg3,arg4,arg5,arg6);
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      errno = 0;
+      wrap_max_r_arr(arg1,arg2,arg3,arg4,arg5,arg6);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
     
     if (errno != 0)
     {
@@ -14052,6 +17010,9 @@ SWIGINTERN PyObject *_wrap_max_r_arr(PyObject *self, PyObject *args) {
       case ENOMEM:
         PyErr_Format(PyExc_MemoryError, "Failed malloc()");
         break;
+      case EINVAL:
+        PyErr_Format(PyExc_ValueError, "Invalid argument(s)");
+        break;
       default:
         PyErr_Format(PyExc_Exception, "Unknown exception");
       }
@@ -14132,8 +17093,17 @@ SWIGINTERN PyObject *_wrap_max_rz_arr(PyObject *self, PyObject *args) {
   }
   arg5 = (rderivs *)(argp5);
   {
-    errno = 0;
-    wrap_max_rz_arr(arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8);
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      errno = 0;
+      wrap_max_rz_arr(arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
     
     if (errno != 0)
     {
@@ -14142,6 +17112,9 @@ SWIGINTERN PyObject *_wrap_max_rz_arr(PyObject *self, PyObject *args) {
       case ENOMEM:
         PyErr_Format(PyExc_MemoryError, "Failed malloc()");
         break;
+      case EINVAL:
+        PyErr_Format(PyExc_ValueError, "Invalid argument(s)");
+        break;
       default:
         PyErr_Format(PyExc_Exception, "Unknown exception");
       }
@@ -14228,8 +17201,17 @@ SWIGINTERN PyObject *_wrap_max_rz_arr_harmonics(PyObject *self, PyObject *args)
     for (i5=0; i5 < array_numdims(array5); ++i5) arg6 *= array_size(array5,i5);
   }
   {
-    errno = 0;
-    wrap_max_rz_arr_harmonics(arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8);
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      errno = 0;
+      wrap_max_rz_arr_harmonics(arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
     
     if (errno != 0)
     {
@@ -14238,6 +17220,9 @@ SWIGINTERN PyObject *_wrap_max_rz_arr_harmonics(PyObject *self, PyObject *args)
       case ENOMEM:
         PyErr_Format(PyExc_MemoryError, "Failed malloc()");
         break;
+      case EINVAL:
+        PyErr_Format(PyExc_ValueError, "Invalid argument(s)");
+        break;
       default:
         PyErr_Format(PyExc_Exception, "Unknown exception");
       }
@@ -14330,8 +17315,17 @@ SWIGINTERN PyObject *_wrap_max_rzw_arr_harmonics(PyObject *self, PyObject *args)
     for (i6=0; i6 < array_numdims(array6); ++i6) arg7 *= array_size(array6,i6);
   }
   {
-    errno = 0;
-    wrap_max_rzw_arr_harmonics(arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10);
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      errno = 0;
+      wrap_max_rzw_arr_harmonics(arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
     
     if (errno != 0)
     {
@@ -14340,6 +17334,9 @@ SWIGINTERN PyObject *_wrap_max_rzw_arr_harmonics(PyObject *self, PyObject *args)
       case ENOMEM:
         PyErr_Format(PyExc_MemoryError, "Failed malloc()");
         break;
+      case EINVAL:
+        PyErr_Format(PyExc_ValueError, "Invalid argument(s)");
+        break;
       default:
         PyErr_Format(PyExc_Exception, "Unknown exception");
       }
@@ -14438,8 +17435,17 @@ SWIGINTERN PyObject *_wrap_max_rzw_arr(PyObject *self, PyObject *args) {
   }
   arg6 = (rderivs *)(argp6);
   {
-    errno = 0;
-    wrap_max_rzw_arr(arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10);
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      errno = 0;
+      wrap_max_rzw_arr(arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
     
     if (errno != 0)
     {
@@ -14448,6 +17454,9 @@ SWIGINTERN PyObject *_wrap_max_rzw_arr(PyObject *self, PyObject *args) {
       case ENOMEM:
         PyErr_Format(PyExc_MemoryError, "Failed malloc()");
         break;
+      case EINVAL:
+        PyErr_Format(PyExc_ValueError, "Invalid argument(s)");
+        break;
       default:
         PyErr_Format(PyExc_Exception, "Unknown exception");
       }
@@ -14564,8 +17573,17 @@ SWIGINTERN PyObject *_wrap_barycenter(PyObject *self, PyObject *args) {
   }
   arg10 = (char *)(buf10);
   {
-    errno = 0;
-    wrap_barycenter(arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10);
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      errno = 0;
+      wrap_barycenter(arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
     
     if (errno != 0)
     {
@@ -14574,6 +17592,9 @@ SWIGINTERN PyObject *_wrap_barycenter(PyObject *self, PyObject *args) {
       case ENOMEM:
         PyErr_Format(PyExc_MemoryError, "Failed malloc()");
         break;
+      case EINVAL:
+        PyErr_Format(PyExc_ValueError, "Invalid argument(s)");
+        break;
       default:
         PyErr_Format(PyExc_Exception, "Unknown exception");
       }
@@ -14612,8 +17633,17 @@ SWIGINTERN PyObject *_wrap_DOF_corr(PyObject *self, PyObject *args) {
   } 
   arg1 = (double)(val1);
   {
-    errno = 0;
-    result = (double)DOF_corr(arg1);
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      errno = 0;
+      result = (double)DOF_corr(arg1);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
     
     if (errno != 0)
     {
@@ -14622,6 +17652,9 @@ SWIGINTERN PyObject *_wrap_DOF_corr(PyObject *self, PyObject *args) {
       case ENOMEM:
         PyErr_Format(PyExc_MemoryError, "Failed malloc()");
         break;
+      case EINVAL:
+        PyErr_Format(PyExc_ValueError, "Invalid argument(s)");
+        break;
       default:
         PyErr_Format(PyExc_Exception, "Unknown exception");
       }
@@ -14723,8 +17756,17 @@ SWIGINTERN PyObject *_wrap_simplefold(PyObject *self, PyObject *args) {
   } 
   arg11 = (int)(val11);
   {
-    errno = 0;
-    result = (double)wrap_simplefold(arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10,arg11);
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      errno = 0;
+      result = (double)wrap_simplefold(arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10,arg11);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
     
     if (errno != 0)
     {
@@ -14733,6 +17775,9 @@ SWIGINTERN PyObject *_wrap_simplefold(PyObject *self, PyObject *args) {
       case ENOMEM:
         PyErr_Format(PyExc_MemoryError, "Failed malloc()");
         break;
+      case EINVAL:
+        PyErr_Format(PyExc_ValueError, "Invalid argument(s)");
+        break;
       default:
         PyErr_Format(PyExc_Exception, "Unknown exception");
       }
@@ -14746,6 +17791,217 @@ fail:
 }
 
 
+SWIGINTERN PyObject *_wrap_rfifind_sweep(PyObject *self, PyObject *args) {
+  PyObject *resultobj = 0;
+  char *arg1 = (char *) 0 ;
+  float *arg2 = (float *) 0 ;
+  long arg3 ;
+  float *arg4 = (float *) 0 ;
+  long arg5 ;
+  float *arg6 = (float *) 0 ;
+  long arg7 ;
+  float *arg8 = (float *) 0 ;
+  long arg9 ;
+  float *arg10 = (float *) 0 ;
+  long arg11 ;
+  float *arg12 = (float *) 0 ;
+  long arg13 ;
+  float *arg14 = (float *) 0 ;
+  long arg15 ;
+  int res1 ;
+  char *buf1 = 0 ;
+  int alloc1 = 0 ;
+  PyArrayObject *array2 = NULL ;
+  int i2 = 1 ;
+  PyArrayObject *array4 = NULL ;
+  int i4 = 1 ;
+  PyArrayObject *array6 = NULL ;
+  int i6 = 1 ;
+  PyArrayObject *array8 = NULL ;
+  int i8 = 1 ;
+  PyArrayObject *array10 = NULL ;
+  int i10 = 1 ;
+  PyArrayObject *array12 = NULL ;
+  int i12 = 1 ;
+  PyArrayObject *array14 = NULL ;
+  int i14 = 1 ;
+  PyObject *swig_obj[8] ;
+  
+  (void)self;
+  if (!SWIG_Python_UnpackTuple(args, "rfifind_sweep", 8, 8, swig_obj)) SWIG_fail;
+  res1 = SWIG_AsCharPtrAndSize(swig_obj[0], &buf1, NULL, &alloc1);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "rfifind_sweep" "', argument " "1"" of type '" "char *""'");
+  }
+  arg1 = (char *)(buf1);
+  {
+    array2 = obj_to_array_no_conversion(swig_obj[1], NPY_FLOAT);
+    if (!array2 || !require_dimensions(array2,1) || !require_contiguous(array2)
+      || !require_native(array2)) SWIG_fail;
+    arg2 = (float*) array_data(array2);
+    arg3 = 1;
+    for (i2=0; i2 < array_numdims(array2); ++i2) arg3 *= array_size(array2,i2);
+  }
+  {
+    array4 = obj_to_array_no_conversion(swig_obj[2], NPY_FLOAT);
+    if (!array4 || !require_dimensions(array4,1) || !require_contiguous(array4)
+      || !require_native(array4)) SWIG_fail;
+    arg4 = (float*) array_data(array4);
+    arg5 = 1;
+    for (i4=0; i4 < array_numdims(array4); ++i4) arg5 *= array_size(array4,i4);
+  }
+  {
+    array6 = obj_to_array_no_conversion(swig_obj[3], NPY_FLOAT);
+    if (!array6 || !require_dimensions(array6,1) || !require_contiguous(array6)
+      || !require_native(array6)) SWIG_fail;
+    arg6 = (float*) array_data(array6);
+    arg7 = 1;
+    for (i6=0; i6 < array_numdims(array6); ++i6) arg7 *= array_size(array6,i6);
+  }
+  {
+    array8 = obj_to_array_no_conversion(swig_obj[4], NPY_FLOAT);
+    if (!array8 || !require_dimensions(array8,1) || !require_contiguous(array8)
+      || !require_native(array8)) SWIG_fail;
+    arg8 = (float*) array_data(array8);
+    arg9 = 1;
+    for (i8=0; i8 < array_numdims(array8); ++i8) arg9 *= array_size(array8,i8);
+  }
+  {
+    array10 = obj_to_array_no_conversion(swig_obj[5], NPY_FLOAT);
+    if (!array10 || !require_dimensions(array10,1) || !require_contiguous(array10)
+      || !require_native(array10)) SWIG_fail;
+    arg10 = (float*) array_data(array10);
+    arg11 = 1;
+    for (i10=0; i10 < array_numdims(array10); ++i10) arg11 *= array_size(array10,i10);
+  }
+  {
+    array12 = obj_to_array_no_conversion(swig_obj[6], NPY_FLOAT);
+    if (!array12 || !require_dimensions(array12,1) || !require_contiguous(array12)
+      || !require_native(array12)) SWIG_fail;
+    arg12 = (float*) array_data(array12);
+    arg13 = 1;
+    for (i12=0; i12 < array_numdims(array12); ++i12) arg13 *= array_size(array12,i12);
+  }
+  {
+    array14 = obj_to_array_no_conversion(swig_obj[7], NPY_FLOAT);
+    if (!array14 || !require_dimensions(array14,1) || !require_contiguous(array14)
+      || !require_native(array14)) SWIG_fail;
+    arg14 = (float*) array_data(array14);
+    arg15 = 1;
+    for (i14=0; i14 < array_numdims(array14); ++i14) arg15 *= array_size(array14,i14);
+  }
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      errno = 0;
+      wrap_rfifind_sweep(arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10,arg11,arg12,arg13,arg14,arg15);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+    
+    if (errno != 0)
+    {
+      switch(errno)
+      {
+      case ENOMEM:
+        PyErr_Format(PyExc_MemoryError, "Failed malloc()");
+        break;
+      case EINVAL:
+        PyErr_Format(PyExc_ValueError, "Invalid argument(s)");
+        break;
+      default:
+        PyErr_Format(PyExc_Exception, "Unknown exception");
+      }
+      SWIG_fail;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  if (alloc1 == SWIG_NEWOBJ) free((char*)buf1);
+  return resultobj;
+fail:
+  if (alloc1 == SWIG_NEWOBJ) free((char*)buf1);
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_median_filter(PyObject *self, PyObject *args) {
+  PyObject *resultobj = 0;
+  float *arg1 = (float *) 0 ;
+  long arg2 ;
+  float *arg3 = (float *) 0 ;
+  long arg4 ;
+  int arg5 ;
+  PyArrayObject *array1 = NULL ;
+  int i1 = 1 ;
+  PyArrayObject *array3 = NULL ;
+  int i3 = 1 ;
+  int val5 ;
+  int ecode5 = 0 ;
+  PyObject *swig_obj[3] ;
+  
+  (void)self;
+  if (!SWIG_Python_UnpackTuple(args, "median_filter", 3, 3, swig_obj)) SWIG_fail;
+  {
+    array1 = obj_to_array_no_conversion(swig_obj[0], NPY_FLOAT);
+    if (!array1 || !require_dimensions(array1,1) || !require_contiguous(array1)
+      || !require_native(array1)) SWIG_fail;
+    arg1 = (float*) array_data(array1);
+    arg2 = 1;
+    for (i1=0; i1 < array_numdims(array1); ++i1) arg2 *= array_size(array1,i1);
+  }
+  {
+    array3 = obj_to_array_no_conversion(swig_obj[1], NPY_FLOAT);
+    if (!array3 || !require_dimensions(array3,1) || !require_contiguous(array3)
+      || !require_native(array3)) SWIG_fail;
+    arg3 = (float*) array_data(array3);
+    arg4 = 1;
+    for (i3=0; i3 < array_numdims(array3); ++i3) arg4 *= array_size(array3,i3);
+  }
+  ecode5 = SWIG_AsVal_int(swig_obj[2], &val5);
+  if (!SWIG_IsOK(ecode5)) {
+    SWIG_exception_fail(SWIG_ArgError(ecode5), "in method '" "median_filter" "', argument " "5"" of type '" "int""'");
+  } 
+  arg5 = (int)(val5);
+  {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      errno = 0;
+      wrap_median_filter(arg1,arg2,arg3,arg4,arg5);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
+    
+    if (errno != 0)
+    {
+      switch(errno)
+      {
+      case ENOMEM:
+        PyErr_Format(PyExc_MemoryError, "Failed malloc()");
+        break;
+      case EINVAL:
+        PyErr_Format(PyExc_ValueError, "Invalid argument(s)");
+        break;
+      default:
+        PyErr_Format(PyExc_Exception, "Unknown exception");
+      }
+      SWIG_fail;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
 SWIGINTERN PyObject *_wrap_nice_output_1(PyObject *self, PyObject *args) {
   PyObject *resultobj = 0;
   char *arg1 = (char *) 0 ;
@@ -14787,8 +18043,17 @@ SWIGINTERN PyObject *_wrap_nice_output_1(PyObject *self, PyObject *args) {
   } 
   arg4 = (int)(val4);
   {
-    errno = 0;
-    result = (int)nice_output_1(arg1,arg2,arg3,arg4);
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      errno = 0;
+      result = (int)nice_output_1(arg1,arg2,arg3,arg4);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
     
     if (errno != 0)
     {
@@ -14797,6 +18062,9 @@ SWIGINTERN PyObject *_wrap_nice_output_1(PyObject *self, PyObject *args) {
       case ENOMEM:
         PyErr_Format(PyExc_MemoryError, "Failed malloc()");
         break;
+      case EINVAL:
+        PyErr_Format(PyExc_ValueError, "Invalid argument(s)");
+        break;
       default:
         PyErr_Format(PyExc_Exception, "Unknown exception");
       }
@@ -14853,8 +18121,17 @@ SWIGINTERN PyObject *_wrap_nice_output_2(PyObject *self, PyObject *args) {
   } 
   arg4 = (int)(val4);
   {
-    errno = 0;
-    result = (int)nice_output_2(arg1,arg2,arg3,arg4);
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+      errno = 0;
+      result = (int)nice_output_2(arg1,arg2,arg3,arg4);
+      presto_end_try(&errctx);
+    } else {
+      PyErr_SetString(presto_status_exception(presto_last_status()),
+        presto_last_error());
+      SWIG_fail;
+    }
     
     if (errno != 0)
     {
@@ -14863,6 +18140,9 @@ SWIGINTERN PyObject *_wrap_nice_output_2(PyObject *self, PyObject *args) {
       case ENOMEM:
         PyErr_Format(PyExc_MemoryError, "Failed malloc()");
         break;
+      case EINVAL:
+        PyErr_Format(PyExc_ValueError, "Invalid argument(s)");
+        break;
       default:
         PyErr_Format(PyExc_Exception, "Unknown exception");
       }
@@ -15157,6 +18437,8 @@ static PyMethodDef SwigMethods[] = {
 	 { "barycenter", _wrap_barycenter, METH_VARARGS, NULL},
 	 { "DOF_corr", _wrap_DOF_corr, METH_O, NULL},
 	 { "simplefold", _wrap_simplefold, METH_VARARGS, NULL},
+	 { "rfifind_sweep", _wrap_rfifind_sweep, METH_VARARGS, NULL},
+	 { "median_filter", _wrap_median_filter, METH_VARARGS, NULL},
 	 { "nice_output_1", _wrap_nice_output_1, METH_VARARGS, NULL},
 	 { "nice_output_2", _wrap_nice_output_2, METH_VARARGS, NULL},
 	 { NULL, NULL, 0, NULL }
@@ -479,6 +479,12 @@ def DOF_corr(dt_per_bin):
 def simplefold(data, dt, tlo, prof, startphs, f0, fdot, fdotdot, standard):
     return _presto.simplefold(data, dt, tlo, prof, startphs, f0, fdot, fdotdot, standard)
 
+def rfifind_sweep(statsfilenm, timesigmas, freqsigmas, chantrigfracs, inttrigfracs, maskfracs, numzapchans, numzapints):
+    return _presto.rfifind_sweep(statsfilenm, timesigmas, freqsigmas, chantrigfracs, inttrigfracs, maskfracs, numzapchans, numzapints)
+
+def median_filter(data, result, medlen):
+    return _presto.median_filter(data, result, medlen)
+
 def nice_output_1(output, val, err, len):
     return _presto.nice_output_1(output, val, err, len)
 
@@ -9,6 +9,8 @@
 
 %{
 #include "presto.h"
+#include "mask.h"
+#include "presto_error.h"
 #include "errno.h"
 
 // A few function declarations from some functions not in headers
@@ -23,6 +25,37 @@ int get_psr_from_parfile(char *parfilenm, double epoch, psrparams * psr);
     import_array();
 %}
 
+// Turn fatal errors in the PRESTO library (which would otherwise
+// exit the Python interpreter) into Python exceptions.
+%{
+static PyObject *presto_status_exception(presto_status status)
+{
+    switch (status) {
+    case PRESTO_ERR_NOMEM:
+        return PyExc_MemoryError;
+    case PRESTO_ERR_IO:
+        return PyExc_IOError;
+    case PRESTO_ERR_EOF:
+        return PyExc_EOFError;
+    default:
+        return PyExc_ValueError;
+    }
+}
+%}
+
+%exception {
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+        $action
+        presto_end_try(&errctx);
+    } else {
+        PyErr_SetString(presto_status_exception(presto_last_status()),
+                        presto_last_error());
+        SWIG_fail;
+    }
+}
+
 typedef struct FCOMPLEX {
     float r, i;
 } fcomplex;
@@ -312,10 +345,20 @@ typedef struct foldstats {
 %apply (float** ARGOUTVIEWM_ARRAY1, long* DIM1) {(float** vect1, long *n1)}
 %apply (fcomplex** ARGOUTVIEWM_ARRAY1, long* DIM1) {(fcomplex** vect2, long *n2)}
 
+// From here on also check errno (the library errors are still trapped)
 %exception
 {
-    errno = 0;
-    $action
+    presto_errctx errctx;
+    presto_begin_try(&errctx);
+    if (PRESTO_TRY(errctx)) {
+        errno = 0;
+        $action
+        presto_end_try(&errctx);
+    } else {
+        PyErr_SetString(presto_status_exception(presto_last_status()),
+                        presto_last_error());
+        SWIG_fail;
+    }
 
     if (errno != 0)
     {
@@ -324,6 +367,9 @@ typedef struct foldstats {
             case ENOMEM:
                 PyErr_Format(PyExc_MemoryError, "Failed malloc()");
                 break;
+            case EINVAL:
+                PyErr_Format(PyExc_ValueError, "Invalid argument(s)");
+                break;
             default:
                 PyErr_Format(PyExc_Exception, "Unknown exception");
         }
@@ -958,6 +1004,78 @@ double DOF_corr(double dt_per_bin);
 %clear (float *data, long N1);
 %clear (double *prof, long N2);
 
+%apply (float* INPLACE_ARRAY1, long DIM1) {(float *timesigmas, long N1)};
+%apply (float* INPLACE_ARRAY1, long DIM1) {(float *freqsigmas, long N2)};
+%apply (float* INPLACE_ARRAY1, long DIM1) {(float *chantrigfracs, long N3)};
+%apply (float* INPLACE_ARRAY1, long DIM1) {(float *inttrigfracs, long N4)};
+%apply (float* INPLACE_ARRAY1, long DIM1) {(float *maskfracs, long N5)};
+%apply (float* INPLACE_ARRAY1, long DIM1) {(float *numzapchans, long N6)};
+%apply (float* INPLACE_ARRAY1, long DIM1) {(float *numzapints, long N7)};
+%rename (rfifind_sweep) wrap_rfifind_sweep;
+// Make the rfifind masks for many sets of thresholds using a
+// single (mmapped) read of an rfifind '.stats' file.  All of the
+// arrays must be float32 and the same length.  The fraction of the
+// data that is masked and the numbers of fully zapped channels and
+// intervals for each set of thresholds are returned in maskfracs,
+// numzapchans, and numzapints.
+%inline %{
+    void wrap_rfifind_sweep(char *statsfilenm,
+                            float *timesigmas, long N1,
+                            float *freqsigmas, long N2,
+                            float *chantrigfracs, long N3,
+                            float *inttrigfracs, long N4,
+                            float *maskfracs, long N5,
+                            float *numzapchans, long N6,
+                            float *numzapints, long N7){
+        int ii, *zapchans, *zapints;
+        rfistats stats;
+
+        if (N2 != N1 || N3 != N1 || N4 != N1 ||
+            N5 != N1 || N6 != N1 || N7 != N1) {
+            errno = EINVAL;
+            return;
+        }
+        read_rfistats(statsfilenm, &stats);
+        zapchans = gen_ivect(N1);
+        zapints = gen_ivect(N1);
+        sweep_rfistats(&stats, N1, timesigmas, freqsigmas, chantrigfracs,
+                       inttrigfracs, maskfracs, zapchans, zapints);
+        for (ii = 0; ii < N1; ii++) {
+            numzapchans[ii] = zapchans[ii];
+            numzapints[ii] = zapints[ii];
+        }
+        vect_free(zapchans);
+        vect_free(zapints);
+        free_rfistats(&stats);
+    }
+%}
+%clear (float *timesigmas, long N1);
+%clear (float *freqsigmas, long N2);
+%clear (float *chantrigfracs, long N3);
+%clear (float *inttrigfracs, long N4);
+%clear (float *maskfracs, long N5);
+%clear (float *numzapchans, long N6);
+%clear (float *numzapints, long N7);
+
+%apply (float* INPLACE_ARRAY1, long DIM1) {(float *data, long N1)};
+%apply (float* INPLACE_ARRAY1, long DIM1) {(float *result, long N2)};
+%rename (median_filter) wrap_median_filter;
+// Running median of length medlen (odd) of the float32 array data
+// with zero padding at the ends (like scipy.signal.medfilt()).
+// The filtered values are placed in result.
+%inline %{
+    void wrap_median_filter(float *data, long N1,
+                            float *result, long N2, int medlen){
+        if (N2 != N1 || medlen < 1 || !(medlen & 1)) {
+            errno = EINVAL;
+            return;
+        }
+        median_filter(data, result, N1, medlen);
+    }
+%}
+%clear (float *data, long N1);
+%clear (float *result, long N2);
+
 int nice_output_1(char *output, double val, double err, int len);
 /* Generates a string in "output" of length len with "val" rounded  */
 /*   to the appropriate decimal place and the error in parenthesis  */
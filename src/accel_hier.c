@@ -0,0 +1,362 @@
+#include "accel.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+/*
+ * Coarse-to-fine ("hierarchical") acceleration and jerk searches.
+ *
+ * Most of the f-fdot(-fdotdot) volume of a wide search contains only
+ * noise, but it is all computed at full resolution (r steps of
+ * ACCEL_DR, z steps of ACCEL_DZ, and w steps of ACCEL_DW).  In a
+ * hierarchical search, a coarse pass first computes the volume of
+ * each block of frequencies (and of its subharmonics) with
+ * correlation kernels that are half as long (no interpolation
+ * between Fourier bins) at every other z and w.  The powers at the
+ * half-bins are estimated by "interbinning":
+ *   A(k + 1/2) ~ pi/4 * (A(k) - A(k+1))
+ * The harmonic sums of the coarse powers are compared to a lower
+ * cutoff, to allow for the power lost to the coarser grid, which is
+ * the mean noise power (numharm) plus the fraction obs->hierfrac of
+ * the power above it needed by the normal cutoff.  Only the blocks with
+ * coarse hits (and the neighbors of blocks with hits near their
+ * edges) are then searched at full resolution in the normal way, so
+ * the candidates, their significances, and the output files are
+ * exactly those of a normal search, except for signals that the
+ * coarse pass missed.  The coarse pass of a jerk search costs about
+ * 1/8 of the full-resolution search.
+ *
+ * Smaller values of obs->hierfrac miss fewer signals but refine
+ * more of the blocks.  The coarse grid loses less than about 30% of
+ * the power of a signal (and usually less than 5%), so the default
+ * of 0.6 very rarely misses signals that the full search finds.
+ * tests/test_accel_hier.c measures the losses, the false-dismissal
+ * rates, and the fraction of noise blocks refined with injected
+ * signals.
+ */
+
+#define NEAREST_INT(x) (int) (x<0 ? x-0.5 : x+0.5)
+
+/* Refine the neighboring block if a coarse hit is this close (bins) */
+#define HIER_EDGE 2.0
+
+static void init_coarse_subharminfo(subharminfo * shi, subharminfo * cshi,
+                                    accelobs * obs)
+/* Prepare the coarse kernels 'cshi' for the subharmonic 'shi'.  They */
+/* cover the same z and w as 'shi' with steps of HIER_DZ and HIER_DW, */
+/* and need half of the FFT length since they do not interpolate.     */
+{
+    int ii, jj, fftlen;
+
+    cshi->numharm = shi->numharm;
+    cshi->harmnum = shi->harmnum;
+    cshi->zmax = (shi->zmax / HIER_DZ) * HIER_DZ;
+    cshi->wmax = (shi->wmax / HIER_DW) * HIER_DW;
+    if (cshi->numharm > 1) {
+        cshi->rinds = (unsigned short *) malloc(obs->corr_uselen * sizeof(unsigned short));
+        cshi->zinds = (unsigned short *) malloc(obs->corr_uselen * sizeof(unsigned short));
+    }
+    fftlen = shi->kern[0][0].fftlen / ACCEL_NUMBETWEEN;
+    cshi->numkern_zdim = (cshi->zmax / HIER_DZ) * 2 + 1;
+    cshi->numkern_wdim = (cshi->wmax / HIER_DW) * 2 + 1;
+    cshi->numkern = cshi->numkern_zdim * cshi->numkern_wdim;
+    cshi->kern = gen_kernmatrix(cshi->numkern_zdim, cshi->numkern_wdim);
+    for (ii = 0; ii < cshi->numkern_wdim; ii++) {
+        for (jj = 0; jj < cshi->numkern_zdim; jj++) {
+            init_kernel(-cshi->zmax + jj * HIER_DZ, -cshi->wmax + ii * HIER_DW,
+                        1, fftlen, &cshi->kern[ii][jj]);
+        }
+    }
+}
+
+
+subharminfo **create_coarse_subharminfos(accelobs * obs, subharminfo ** shis)
+/* Return the coarse kernels for each of the subharmonics in 'shis'. */
+/* They can be freed with free_subharminfos().                       */
+{
+    int ii, jj, harmtosum, numkern = 0;
+    subharminfo **cshis;
+
+    cshis = (subharminfo **) malloc(obs->numharmstages * sizeof(subharminfo *));
+    cshis[0] = (subharminfo *) malloc(2 * sizeof(subharminfo));
+    init_coarse_subharminfo(&shis[0][0], &cshis[0][0], obs);
+    numkern += cshis[0][0].numkern;
+    for (ii = 1; ii < obs->numharmstages; ii++) {
+        harmtosum = 1 << ii;
+        cshis[ii] = (subharminfo *) malloc(harmtosum * sizeof(subharminfo));
+        for (jj = 1; jj < harmtosum; jj += 2) {
+            init_coarse_subharminfo(&shis[ii][jj - 1], &cshis[ii][jj - 1], obs);
+            numkern += cshis[ii][jj - 1].numkern;
+        }
+    }
+    printf("  %d coarse kernels with z steps of %d and w steps of %d (%d pt FFTs)\n",
+           numkern, HIER_DZ, HIER_DW, cshis[0][0].kern[0][0].fftlen);
+    return cshis;
+}
+
+
+ffdotpows *coarse_fderivs_vol(int numharm, int harmnum,
+                              double fullrlo, double fullrhi,
+                              subharminfo * shi, subharminfo * cshi,
+                              accelobs * obs)
+/* The coarse version of subharm_fderivs_vol().  The powers are on */
+/* the same r grid (steps of ACCEL_DR), but the z and w grids are  */
+/* those of the coarse kernels 'cshi', and the powers at the       */
+/* half-bins are interbinned.  'shi' are the full-resolution       */
+/* kernels, which set the Fourier amplitudes to use.               */
+{
+    int fftlen, binoffset, numints;
+    long long lobin;
+    double drlo, drhi, harm_fract;
+    fcomplex *data;
+    fftwf_plan invplan;
+    ffdotpows *ffdot = (ffdotpows *) malloc(sizeof(ffdotpows));
+
+    harm_fract = (double) harmnum / (double) numharm;
+    drlo = rint(ACCEL_RDR * fullrlo * harm_fract) * ACCEL_DR;
+    drhi = rint(ACCEL_RDR * fullrhi * harm_fract) * ACCEL_DR;
+    ffdot->rlo = (long long) floor(drlo);
+    ffdot->zlo = -cshi->zmax;
+    ffdot->wlo = -cshi->wmax;
+    if (numharm == 1 && harmnum == 1)
+        ffdot->numrs = obs->corr_uselen;
+    else
+        ffdot->numrs = (int) ((ceil(drhi) - floor(drlo))
+                              * ACCEL_RDR + DBLCORRECT) + 1;
+    ffdot->numzs = cshi->numkern_zdim;
+    ffdot->numws = cshi->numkern_wdim;
+    ffdot->rinds = NULL;
+    ffdot->zinds = NULL;
+
+    /* Use exactly the (normalized) amplitudes of the full resolution */
+    /* correlations, so that the coarse and fine powers match.        */
+    binoffset = shi->kern[0][0].kern_half_width;
+    fftlen = cshi->kern[0][0].fftlen;
+    lobin = ffdot->rlo - binoffset;
+    data = get_normalized_amplitudes(lobin, fftlen, obs);
+    // Note COMPLEXFFT is not thread-safe because of wisdom caching
+    COMPLEXFFT(data, fftlen, -1);
+
+    /* The number of integer bins needed for the interbinning */
+    numints = ffdot->numrs / 2 + 1;
+    if (binoffset + numints > fftlen)
+        numints = fftlen - binoffset;
+
+    ffdot->powers = gen_f3Darr(ffdot->numws, ffdot->numzs, ffdot->numrs);
+
+    {
+        fcomplex *tmpdat = gen_cvect(fftlen);
+        fcomplex *tmpout = gen_cvect(fftlen);
+        // FFTW planning is *not* thread-safe
+        invplan = fftwf_plan_dft_1d(fftlen, (fftwf_complex *) tmpdat,
+                                    (fftwf_complex *) tmpout, +1,
+                                    FFTW_MEASURE | FFTW_DESTROY_INPUT);
+        vect_free(tmpdat);
+        vect_free(tmpout);
+    }
+
+#ifdef _OPENMP
+#pragma omp parallel default(none) shared(data,cshi,fftlen,binoffset,numints,ffdot,invplan)
+#endif
+    {
+        const float norm = 1.0 / ((float) fftlen * fftlen);
+        const float inorm = norm * (PI * PI / 16.0);
+        fcomplex *tmpdat = gen_cvect(fftlen);
+        fcomplex *tmpout = gen_cvect(fftlen);
+        int kern;
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic)
+#endif
+        for (kern = 0; kern < ffdot->numws * ffdot->numzs; kern++) {
+            int kk, ind;
+            const int ii = kern / ffdot->numzs, jj = kern % ffdot->numzs;
+            float *fkern = (float *) cshi->kern[ii][jj].data;
+            float *fpdata = (float *) data;
+            float *fdata = (float *) tmpdat;
+            float *outpows = ffdot->powers[ii][jj];
+
+#if (defined(__GNUC__) || defined(__GNUG__)) &&         \
+    !(defined(__clang__) || defined(__INTEL_COMPILER))
+#pragma GCC ivdep
+#endif
+            for (kk = 0; kk < fftlen * 2; kk += 2) {
+                const float dr = fpdata[kk], di = fpdata[kk + 1];
+                const float kr = fkern[kk], ki = fkern[kk + 1];
+                fdata[kk] = dr * kr + di * ki;
+                fdata[kk + 1] = di * kr - dr * ki;
+            }
+            fftwf_execute_dft(invplan, (fftwf_complex *) tmpdat,
+                              (fftwf_complex *) tmpout);
+            // The integer bins and the interbinned half-bins
+            fdata = (float *) tmpout + 2 * binoffset;
+            for (kk = 0; kk < ffdot->numrs; kk++) {
+                ind = kk / 2;
+                if (ind >= numints) {
+                    outpows[kk] = 0.0;
+                } else if (kk % 2 == 0 || ind + 1 >= numints) {
+                    outpows[kk] = (fdata[2 * ind] * fdata[2 * ind] +
+                                   fdata[2 * ind + 1] * fdata[2 * ind + 1]) * norm;
+                } else {
+                    const float dr = fdata[2 * ind] - fdata[2 * ind + 2];
+                    const float di = fdata[2 * ind + 1] - fdata[2 * ind + 3];
+                    outpows[kk] = (dr * dr + di * di) * inorm;
+                }
+            }
+        }
+        vect_free(tmpdat);
+        vect_free(tmpout);
+    }
+    fftwf_destroy_plan(invplan);
+    vect_free(data);
+    return ffdot;
+}
+
+
+static void add_coarse_ffdotpows(ffdotpows * fundamental,
+                                 ffdotpows * subharmonic, int numharm, int harmnum)
+/* Add the powers of the coarse 'subharmonic' to the coarse 'fundamental' */
+{
+    int ii, jj, kk, wind, *rinds, *zinds;
+    const double harm_fract = (double) harmnum / (double) numharm;
+
+    /* The nearest subharmonic r, z, and w for each fundamental one */
+    rinds = gen_ivect(fundamental->numrs);
+    for (kk = 0; kk < fundamental->numrs; kk++) {
+        double subr = rint(ACCEL_RDR * (fundamental->rlo + kk * ACCEL_DR) *
+                           harm_fract) * ACCEL_DR;
+        rinds[kk] = (int) ((subr - subharmonic->rlo) * ACCEL_RDR + DBLCORRECT);
+        if (rinds[kk] > subharmonic->numrs - 1)
+            rinds[kk] = subharmonic->numrs - 1;
+    }
+    zinds = gen_ivect(fundamental->numzs);
+    for (jj = 0; jj < fundamental->numzs; jj++) {
+        double subz = (fundamental->zlo + jj * HIER_DZ) * harm_fract;
+        zinds[jj] = NEAREST_INT((subz - subharmonic->zlo) / HIER_DZ);
+        if (zinds[jj] < 0)
+            zinds[jj] = 0;
+        if (zinds[jj] > subharmonic->numzs - 1)
+            zinds[jj] = subharmonic->numzs - 1;
+    }
+    for (ii = 0; ii < fundamental->numws; ii++) {
+        double subw = (fundamental->wlo + ii * HIER_DW) * harm_fract;
+        wind = NEAREST_INT((subw - subharmonic->wlo) / HIER_DW);
+        if (wind < 0)
+            wind = 0;
+        if (wind > subharmonic->numws - 1)
+            wind = subharmonic->numws - 1;
+        for (jj = 0; jj < fundamental->numzs; jj++) {
+            float *outpows = fundamental->powers[ii][jj];
+            float *inpows = subharmonic->powers[wind][zinds[jj]];
+            for (kk = 0; kk < fundamental->numrs; kk++)
+                outpows[kk] += inpows[rinds[kk]];
+        }
+    }
+    vect_free(rinds);
+    vect_free(zinds);
+}
+
+
+static float coarse_powcut(accelobs * obs, int stage)
+/* The coarse cutoff for harmonic summing 'stage' */
+{
+    int numharm = 1 << stage;
+
+    return numharm + obs->hierfrac * (obs->powcut[stage] - numharm);
+}
+
+
+static int coarse_hits(ffdotpows * ffdot, float powcut, double *rmin, double *rmax)
+/* Return the number of coarse powers above 'powcut' and update the */
+/* range of r (of the highest harmonic) where they were found.      */
+{
+    int ii, jj, kk, numhits = 0;
+
+    for (ii = 0; ii < ffdot->numws; ii++) {
+        for (jj = 0; jj < ffdot->numzs; jj++) {
+            float *pows = ffdot->powers[ii][jj];
+            for (kk = 0; kk < ffdot->numrs; kk++) {
+                if (pows[kk] > powcut) {
+                    double rr = ffdot->rlo + kk * (double) ACCEL_DR;
+                    if (rr < *rmin)
+                        *rmin = rr;
+                    if (rr > *rmax)
+                        *rmax = rr;
+                    numhits++;
+                }
+            }
+        }
+    }
+    return numhits;
+}
+
+
+char *hier_coarse_search(accelobs * obs, subharminfo ** shis, int *numrefine)
+/* Do the coarse pass of a hierarchical search using the blocks of */
+/* the normal search, which have the kernels 'shis'.  Return an    */
+/* array (to be free()d) that is non-zero for each of the blocks   */
+/* that need to be searched at full resolution, and the number of  */
+/* those blocks in 'numrefine'.                                    */
+{
+    int ii, numblocks, blocknum, rstep;
+    long long numhits = 0;
+    double startr, lastr;
+    char *refine;
+    subharminfo **cshis;
+
+    rstep = obs->corr_uselen * ACCEL_DR;
+    numblocks = 0;
+    for (startr = obs->rlo; startr + rstep < obs->highestbin; startr += rstep)
+        numblocks++;
+    refine = (char *) calloc(numblocks + 1, 1);
+
+    printf("Generating coarse correlation kernels:\n");
+    cshis = create_coarse_subharminfos(obs, shis);
+    printf("Starting the coarse search (with %.2f of the full signal power cutoffs).\n\n",
+           obs->hierfrac);
+
+    for (blocknum = 0, startr = obs->rlo; blocknum < numblocks;
+         blocknum++, startr += rstep) {
+        int stage, harmtosum, harm, hits;
+        double rmin = obs->highestbin, rmax = 0.0;
+        ffdotpows *fundamental, *subharmonic;
+
+        printf("\rAmount of coarse search complete = %3d%%",
+               (int) (blocknum * 100.0 / numblocks));
+        fflush(stdout);
+        lastr = startr + rstep - ACCEL_DR;
+        fundamental = coarse_fderivs_vol(1, 1, startr, lastr,
+                                         &shis[0][0], &cshis[0][0], obs);
+        hits = coarse_hits(fundamental, coarse_powcut(obs, 0), &rmin, &rmax);
+        for (stage = 1; stage < obs->numharmstages; stage++) {
+            harmtosum = 1 << stage;
+            for (harm = 1; harm < harmtosum; harm += 2) {
+                subharmonic = coarse_fderivs_vol(harmtosum, harm, startr, lastr,
+                                                 &shis[stage][harm - 1],
+                                                 &cshis[stage][harm - 1], obs);
+                add_coarse_ffdotpows(fundamental, subharmonic, harmtosum, harm);
+                free_ffdotpows(subharmonic);
+            }
+            hits += coarse_hits(fundamental, coarse_powcut(obs, stage),
+                                &rmin, &rmax);
+        }
+        free_ffdotpows(fundamental);
+        if (hits) {
+            numhits += hits;
+            refine[blocknum] = 1;
+            if (blocknum > 0 && rmin < startr + HIER_EDGE)
+                refine[blocknum - 1] = 1;
+            if (blocknum < numblocks - 1 && rmax > lastr - HIER_EDGE)
+                refine[blocknum + 1] = 1;
+        }
+    }
+    printf("\rAmount of coarse search complete = %3d%%\n\n", 100);
+    free_subharminfos(obs, cshis);
+
+    *numrefine = 0;
+    for (ii = 0; ii < numblocks; ii++)
+        *numrefine += refine[ii];
+    printf("Found %lld coarse hits.  Searching %d of %d blocks at full resolution.\n\n",
+           numhits, *numrefine, numblocks);
+    return refine;
+}
@@ -0,0 +1,277 @@
+#include "accel.h"
+
+/*
+ * The steps of an acceleration search of a single input file, so
+ * that they can be shared by accelsearch and mpiaccelsearch.  The
+ * latter searches many files in the same process, so nothing here
+ * depends on (or changes) state left over from a previous file.
+ */
+
+extern void zapbirds(double lobin, double hibin, FILE * fftfile, fcomplex * fft);
+
+static void print_percent_complete(int current, int number, char *what, int reset)
+{
+    static int newper = 0, oldper = -1;
+
+    if (reset) {
+        oldper = -1;
+        newper = 0;
+    } else {
+        newper = (int) (current / (float) (number) * 100.0);
+        if (newper < 0)
+            newper = 0;
+        if (newper > 100)
+            newper = 100;
+        if (newper > oldper) {
+            printf("\rAmount of %s complete = %3d%%", what, newper);
+            fflush(stdout);
+            oldper = newper;
+        }
+    }
+}
+
+
+void zap_accel_birdies(accelobs * obs, Cmdline * cmd)
+/* Zap birdies if requested and if in memory */
+{
+    int ii, jj, numbirds;
+    double *bird_lobins, *bird_hibins, hibin;
+
+    if (!cmd->zaplistP || obs->mmap_file || !obs->fft)
+        return;
+
+    /* Read the Standard bird list */
+    numbirds = get_birdies(cmd->zaplist, obs->T, cmd->baryv,
+                           &bird_lobins, &bird_hibins);
+
+    /* Zap the birdies */
+    printf("Zapping them using a barycentric velocity of %.5gc.\n\n", cmd->baryv);
+    hibin = obs->N / 2;
+    for (ii = 0; ii < numbirds; ii++) {
+        if (bird_lobins[ii] >= hibin)
+            break;
+        if (bird_hibins[ii] >= hibin)
+            bird_hibins[ii] = hibin - 1;
+        zapbirds(bird_lobins[ii], bird_hibins[ii], NULL, obs->fft);
+        /* The segments of a semi-coherent search as well */
+        for (jj = 0; jj < obs->numseg && obs->segffts; jj++)
+            zapbirds(bird_lobins[ii] / obs->numseg, bird_hibins[ii] / obs->numseg,
+                     NULL, obs->segffts[jj]);
+    }
+
+    vect_free(bird_lobins);
+    vect_free(bird_hibins);
+}
+
+
+int same_subharminfos(accelobs * obs1, accelobs * obs2)
+/* Return 1 if the subharminfos (i.e. the correlation kernels) made */
+/* by create_subharminfos() for 'obs1' will work for 'obs2' as well */
+{
+    return (obs1->numharmstages == obs2->numharmstages &&
+            obs1->allharm == obs2->allharm &&
+            obs1->inmem == obs2->inmem &&
+            obs1->fftlen == obs2->fftlen &&
+            obs1->zhi == obs2->zhi &&
+            obs1->whi == obs2->whi &&
+            obs1->numz == obs2->numz && obs1->numw == obs2->numw);
+}
+
+
+GSList *search_accelobs(accelobs * obs, subharminfo ** subharminfs,
+                        Cmdline * cmd, GSList * cands)
+/* Search the full f-fdot(-fdotdot) volume of 'obs' (with numseg  */
+/* = 1) using the kernels in 'subharminfs' and add the candidates */
+/* to 'cands'.                                                    */
+{
+    int rstep, blocknum, numrefine = 0;
+    char *refine = NULL;
+    double startr, lastr, nextr;
+    ffdotpows *fundamental;
+
+    /* The step-size of blocks to walk through the input data */
+    rstep = obs->corr_uselen * ACCEL_DR;
+
+    /* A hierarchical search only refines the blocks with coarse hits */
+    if (obs->hierfrac > 0.0)
+        refine = hier_coarse_search(obs, subharminfs, &numrefine);
+
+    /* Function pointers to make code a bit cleaner */
+    void (*fund_to_ffdot)() = NULL;
+    void (*add_subharm)() = NULL;
+    void (*inmem_add_subharm)() = NULL;
+    if (obs->inmem) {
+        if (cmd->otheroptP) {
+            fund_to_ffdot = &fund_to_ffdotplane_trans;
+            inmem_add_subharm = &inmem_add_ffdotpows_trans;
+        } else {
+            fund_to_ffdot = &fund_to_ffdotplane;
+            inmem_add_subharm = &inmem_add_ffdotpows;
+        }
+    } else {
+        if (cmd->otheroptP) {
+            add_subharm = &add_ffdotpows_ptrs;
+        } else {
+            add_subharm = &add_ffdotpows;
+        }
+    }
+
+    /* Populate the saved F-Fdot plane at low freqs for in-memory
+     * searches of harmonics that are below obs->rlo */
+    if (obs->inmem) {
+        startr = 8;             // Choose a very low Fourier bin
+        lastr = 0;
+        nextr = 0;
+        while (startr < obs->rlo) {
+            nextr = startr + rstep;
+            lastr = nextr - ACCEL_DR;
+            // Compute the F-Fdot plane
+            fundamental = subharm_fderivs_vol(1, 1, startr, lastr,
+                                              &subharminfs[0][0], obs);
+            // Copy it into the full in-core one
+            fund_to_ffdot(fundamental, obs);
+            free_ffdotpows(fundamental);
+            startr = nextr;
+        }
+    }
+
+    /* Reset indices if needed and search for real */
+    print_percent_complete(0, 0, NULL, 1);
+    startr = obs->rlo;
+    lastr = 0;
+    nextr = 0;
+    blocknum = 0;
+    while (startr + rstep < obs->highestbin) {
+        /* Search the fundamental */
+        print_percent_complete(startr - obs->rlo,
+                               obs->highestbin - obs->rlo, "search", 0);
+        nextr = startr + rstep;
+        lastr = nextr - ACCEL_DR;
+        if (refine && !refine[blocknum++]) {
+            startr = nextr;
+            continue;
+        }
+        fundamental = subharm_fderivs_vol(1, 1, startr, lastr,
+                                          &subharminfs[0][0], obs);
+        cands = search_ffdotpows(fundamental, 1, obs, cands);
+
+        if (obs->numharmstages > 1) {   /* Search the subharmonics */
+            int base, harmtosum, harm, maxharm;
+            ffdotpows *subharmonic, *harmsum;
+
+            // Copy the fundamental's ffdot plane to the full in-core one
+            if (obs->inmem)
+                fund_to_ffdot(fundamental, obs);
+            // The sums are built up in chains where the number of
+            // harmonics doubles each step (1, 2, 4, ...; 3, 6, ...).
+            // Without -allharm there is only the chain starting at 1.
+            // That one is last so it can use the fundamental itself.
+            maxharm = stage_numharm(obs, obs->numharmstages - 1);
+            for (base = obs->allharm ? (maxharm - 1) | 1 : 1; base >= 1; base -= 2) {
+                harmsum = (base == 1) ? fundamental : copy_ffdotpows(fundamental);
+                for (harmtosum = (base == 1) ? 2 : base;
+                     harmtosum <= maxharm; harmtosum *= 2) {
+                    for (harm = 1; harm < harmtosum; harm++) {
+                        if (!new_subharmonic(harmtosum, harm))
+                            continue;
+                        if (obs->inmem) {
+                            inmem_add_subharm(harmsum, obs, harmtosum, harm);
+                        } else {
+                            subharmonic =
+                                subharm_fderivs_vol(harmtosum, harm, startr, lastr,
+                                                    &subharminfs[numharm_stage
+                                                                 (obs, harmtosum)][harm - 1],
+                                                    obs);
+                            add_subharm(harmsum, subharmonic, harmtosum, harm);
+                            free_ffdotpows(subharmonic);
+                        }
+                    }
+                    cands = search_ffdotpows(harmsum, harmtosum, obs, cands);
+                }
+                if (harmsum != fundamental)
+                    free_ffdotpows(harmsum);
+            }
+        }
+        free_ffdotpows(fundamental);
+        startr = nextr;
+    }
+    print_percent_complete(obs->highestbin - obs->rlo,
+                           obs->highestbin - obs->rlo, "search", 0);
+    if (refine)
+        free(refine);
+    return cands;
+}
+
+
+int output_accelobs_cands(GSList ** cands, accelobs * obs,
+                          infodata * idata, Cmdline * cmd)
+/* Trim, optimize, and write out the candidates from the search of */
+/* 'obs'.  Return the number of candidates that were written (the  */
+/* first ones in the sorted list '*cands').                        */
+{
+    int ii, numcands = g_slist_length(*cands);
+    GSList *listptr;
+    accelcand *cand;
+    fourierprops *props;
+
+    if (!numcands) {
+        printf("No candidates above sigma = %.2f were found.\n\n", obs->sigma);
+        return 0;
+    }
+
+    /* Sort the candidates according to the optimized sigmas */
+    *cands = sort_accelcands(*cands);
+
+    /* Eliminate (most of) the harmonically related candidates */
+    if ((cmd->numharm > 1) && !(cmd->noharmremoveP))
+        eliminate_harmonics(*cands, &numcands);
+
+    /* Now optimize each candidate and its harmonics */
+    print_percent_complete(0, 0, NULL, 1);
+    listptr = *cands;
+    for (ii = 0; ii < numcands; ii++) {
+        print_percent_complete(ii, numcands, "optimization", 0);
+        cand = (accelcand *) (listptr->data);
+        optimize_accelcand(cand, obs);
+        listptr = listptr->next;
+    }
+    print_percent_complete(ii, numcands, "optimization", 0);
+
+    /* Calculate the properties of the fundamentals */
+    props = (fourierprops *) malloc(sizeof(fourierprops) * numcands);
+    listptr = *cands;
+    for (ii = 0; ii < numcands; ii++) {
+        cand = (accelcand *) (listptr->data);
+        /* In case the fundamental harmonic is not significant,  */
+        /* send the originally determined r and z from the       */
+        /* harmonic sum in the search.  Note that the derivs are */
+        /* not used for the computations with the fundamental.   */
+        calc_props(cand->derivs[0], cand->r, cand->z, cand->w, props + ii);
+        /* Override the error estimates based on power */
+        props[ii].rerr = (float) (ACCEL_DR) / cand->numharm;
+        props[ii].zerr = (float) (ACCEL_DZ) / cand->numharm;
+        props[ii].werr = (float) (ACCEL_DW) / cand->numharm;
+        listptr = listptr->next;
+    }
+
+    /* Write the fundamentals to the output text file */
+    output_fundamentals(props, *cands, obs, idata);
+
+    /* Write the harmonics to the output text file */
+    output_harmonics(*cands, obs, idata);
+
+    /* Write the fundamental fourierprops to the cand file */
+    obs->workfile = chkfopen(obs->candnm, "wb");
+    chkfwrite(props, sizeof(fourierprops), numcands, obs->workfile);
+    fclose(obs->workfile);
+
+    /* Write all of the candidate info to the columnar file */
+    output_accelcols(props, *cands, obs, idata);
+
+    /* And barycentric versions of the fundamentals if requested */
+    if (obs->topo2bary)
+        output_bary_cands(props, *cands, obs, idata);
+    free(props);
+    printf("\n\n");
+    return numcands;
+}
@@ -0,0 +1,305 @@
+#include "accel.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+/*
+ * Semi-coherent ("StackSlide") acceleration and jerk searches.
+ *
+ * The time series is split into obs->numseg equal segments of
+ * length Tseg = T / numseg.  Each segment is searched coherently
+ * (using the normal correlation kernels, but with the small 'zmax'
+ * and 'wmax' that are appropriate for a segment), and the powers of
+ * the segment f-fdot(-fdotdot) planes are then summed incoherently
+ * along the tracks that a signal with a given (f, fdot, fdotdot)
+ * follows through the segments.
+ *
+ * The tracks are parameterized in units of segment Fourier bins:
+ *   r0 = f * Tseg             at the middle of the observation
+ *   u  = fdot * T * Tseg      total frequency drift over the obs
+ *   v  = fdotdot * T^2 * Tseg / 8  drift from fdotdot at the ends
+ * so that for segment k, whose center is at time x_k * T from the
+ * middle of the observation (-1/2 < x_k < 1/2):
+ *   r_k = r0 + u * x_k + 4 * v * x_k^2
+ *   z_k = (u + 8 * v * x_k) / numseg
+ *   w_k = 8 * v / numseg^2
+ * Both u and v are stepped by 1 bin so that a track is never more
+ * than half of a Fourier bin from the signal.  The candidates are
+ * reported with the full-resolution values of r, z, and w so that
+ * they can be optimized and folded normally.  Like the rest of
+ * PRESTO, r is the average over the observation, which is
+ * (r0 + v / 3) * numseg, and z is the value at the middle.
+ */
+
+#define NEAREST_INT(x) (int) (x<0 ? x-0.5 : x+0.5)
+
+static void stackslide_tracks(accelobs * obs, int *umax, int *vmax)
+/* Return the maximum track parameters u and v given the */
+/* coherent zmax and wmax of each segment.               */
+{
+    *umax = (int) obs->zhi * obs->numseg;
+    *vmax = (obs->numw) ?
+        (int) ceil(obs->whi * obs->numseg * obs->numseg / 8.0) : 0;
+}
+
+
+void prep_stackslide_segments(float *data, long long numdata, accelobs * obs)
+/* Split the time series 'data' into obs->numseg equal-length    */
+/* segments (dropping any leftover points) and store their       */
+/* de-reddened FFTs in obs->segffts.  The FFTs are padded by     */
+/* ACCEL_PADDING like the FFT of a full '.dat' file.             */
+{
+    int ii;
+    long long seglen;
+    float *ftmp;
+
+    seglen = numdata / obs->numseg;
+    if (seglen % 2)
+        seglen--;
+    if (seglen < 1000) {
+        printf("\nThe segments (%lld points) are too short.  Use a smaller '-numseg'.\n\n",
+               seglen);
+        exit(0);
+    }
+    obs->seglen = seglen;
+    obs->segffts = (fcomplex **) malloc(obs->numseg * sizeof(fcomplex *));
+    for (ii = 0; ii < obs->numseg; ii++) {
+        ftmp = gen_fvect(seglen + 2 * ACCEL_PADDING);
+        memset(ftmp, 0, sizeof(float) * (seglen + 2 * ACCEL_PADDING));
+        ftmp += ACCEL_PADDING;
+        memcpy(ftmp, data + ii * seglen, sizeof(float) * seglen);
+        realfft(ftmp, seglen, -1);
+        obs->segffts[ii] = (fcomplex *) ftmp;
+        deredden(obs->segffts[ii], seglen / 2);
+        obs->segffts[ii][0].r = 1.0;
+        obs->segffts[ii][0].i = 1.0;
+    }
+}
+
+
+long long stackslide_numindep(accelobs * obs)
+/* Return the approximate number of independent tracks searched */
+{
+    int umax, vmax;
+
+    stackslide_tracks(obs, &umax, &vmax);
+    return (long long) ((obs->rhi - obs->rlo) / obs->numseg) *
+        (2 * umax + 1) * (2 * vmax + 1);
+}
+
+
+void free_stackslide_segments(accelobs * obs)
+{
+    int ii;
+
+    for (ii = 0; ii < obs->numseg; ii++)
+        vect_free((float *) obs->segffts[ii] - ACCEL_PADDING);
+    free(obs->segffts);
+}
+
+
+static void fill_segment_strip(accelobs * segobs, subharminfo * shi,
+                               long long striplo, int numchunks, float *strip)
+/* Fill 'strip' with the powers of the segment's f-fdot(-fdotdot) */
+/* volume from Fourier bin 'striplo' upwards in 'numchunks'       */
+/* blocks of the normal correlation length.  Powers below bin 0   */
+/* or above the highest bin of the segment are set to zero.       */
+{
+    int ii, jj, chunk, numrs, rstep, striprs, numzs, numws;
+    long long startr, offset;
+    ffdotpows *ffdot;
+
+    rstep = segobs->corr_uselen * ACCEL_DR;
+    striprs = numchunks * segobs->corr_uselen;
+    numzs = shi->numkern_zdim;
+    numws = shi->numkern_wdim;
+    memset(strip, 0, sizeof(float) * numws * numzs * striprs);
+    for (chunk = 0; chunk < numchunks; chunk++) {
+        startr = striplo + chunk * rstep;
+        if (startr + rstep <= 0)
+            continue;
+        if (startr < 0)
+            startr = 0;
+        if (startr + rstep >= segobs->highestbin)
+            break;
+        ffdot = subharm_fderivs_vol(1, 1, startr, startr + rstep - ACCEL_DR,
+                                    shi, segobs);
+        offset = (startr - striplo) * ACCEL_RDR;
+        numrs = ffdot->numrs;
+        if (offset + numrs > striprs)
+            numrs = striprs - offset;
+        for (ii = 0; ii < numws; ii++)
+            for (jj = 0; jj < numzs; jj++)
+                memcpy(strip + (ii * numzs + jj) * striprs + offset,
+                       ffdot->powers[ii][jj], sizeof(float) * numrs);
+        free_ffdotpows(ffdot);
+    }
+}
+
+
+GSList *stackslide_search(accelobs * obs, GSList * cands)
+/* Perform a semi-coherent search of the segments in obs->segffts */
+/* and add the candidates found to 'cands'.  See the description  */
+/* at the top of this file.                                       */
+{
+    int ii, umax, vmax, numu, numv, numzs, numws, margin;
+    int rstep, numchunks, stripchunks, striprs, blockrs;
+    long long rlo, rhi, blo, numindep;
+    float powcut, **strips;
+    double *xs;
+    accelobs *segobs;
+    subharminfo **shis;
+
+    /* Prepare an accelobs structure for each segment */
+    segobs = (accelobs *) malloc(obs->numseg * sizeof(accelobs));
+    for (ii = 0; ii < obs->numseg; ii++) {
+        segobs[ii] = *obs;
+        segobs[ii].N = obs->seglen;
+        segobs[ii].numbins = obs->seglen / 2;
+        segobs[ii].lobin = 0;
+        segobs[ii].highestbin = segobs[ii].numbins - 1;
+        segobs[ii].T = obs->seglen * obs->dt;
+        segobs[ii].fft = obs->segffts[ii];
+        segobs[ii].fftfile = NULL;
+        segobs[ii].mmap_file = 0;
+        segobs[ii].dat_input = 1;
+        segobs[ii].inmem = 0;
+        segobs[ii].numharmstages = 1;
+    }
+
+    /* The segments all use the same correlation kernels */
+    printf("Generating correlation kernels for the segments:\n");
+    shis = create_subharminfos(&segobs[0]);
+    printf("Done generating kernels.\n\n");
+    numzs = shis[0][0].numkern_zdim;
+    numws = shis[0][0].numkern_wdim;
+
+    /* The track parameters and the segment mid-times */
+    stackslide_tracks(obs, &umax, &vmax);
+    numu = 2 * umax + 1;
+    numv = 2 * vmax + 1;
+    xs = gen_dvect(obs->numseg);
+    for (ii = 0; ii < obs->numseg; ii++)
+        xs[ii] = (ii + 0.5) / obs->numseg - 0.5;
+    powcut = obs->powcut[0];
+    numindep = obs->numindep[0];
+
+    /* The search range in segment Fourier bins */
+    rlo = (long long) floor(obs->rlo / obs->numseg);
+    if (rlo < 1)
+        rlo = 1;
+    rhi = (long long) (obs->highestbin / obs->numseg);
+    if (rhi > segobs[0].highestbin)
+        rhi = segobs[0].highestbin;
+
+    /* The blocks of frequencies searched at once.  Each needs the  */
+    /* segment powers within 'margin' bins of the block for tracks */
+    /* that slide across it.  Make the blocks long compared to the */
+    /* margin so that we don't compute too many powers twice.      */
+    margin = umax / 2 + vmax + 1;
+    rstep = obs->corr_uselen * ACCEL_DR;
+    numchunks = (4 * margin) / rstep + 1;
+    stripchunks = numchunks + (2 * margin + rstep - 1) / rstep;
+    blockrs = numchunks * obs->corr_uselen;
+    striprs = stripchunks * obs->corr_uselen;
+    strips = (float **) malloc(obs->numseg * sizeof(float *));
+    for (ii = 0; ii < obs->numseg; ii++)
+        strips[ii] = gen_fvect((long) numws * numzs * striprs);
+
+    printf("Semi-coherent search of %d segments of %.1f s each:\n",
+           obs->numseg, segobs[0].T);
+    printf("  f = %.4f to %.4f Hz\n", rlo / segobs[0].T, rhi / segobs[0].T);
+    printf("  %d f-dot tracks (|z| < %d in the full observation)\n",
+           numu, umax * obs->numseg);
+    if (obs->numw)
+        printf("  %d f-dot-dot tracks (|w| < %d in the full observation)\n",
+               numv, 8 * vmax * obs->numseg);
+    printf("  Approx number of independent trials:  %lld\n\n", numindep);
+
+    for (blo = rlo; blo < rhi; blo += numchunks * rstep) {
+        printf("\rAmount of search complete = %3d%%",
+               (int) ((blo - rlo) * 100.0 / (rhi - rlo)));
+        fflush(stdout);
+
+        /* Compute the powers for each segment */
+        for (ii = 0; ii < obs->numseg; ii++)
+            fill_segment_strip(&segobs[ii], &shis[0][0], blo - margin,
+                               stripchunks, strips[ii]);
+
+        /* Sum the powers along the tracks */
+#ifdef _OPENMP
+#pragma omp parallel default(shared)
+#endif
+        {
+            int jj, kk, track, shift, zind, wind, added;
+            float pow, sig, *stack, **rows;
+            double uu, vv, zz, ww, x, r0;
+
+            stack = gen_fvect(blockrs);
+            rows = (float **) malloc(obs->numseg * sizeof(float *));
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic)
+#endif
+            for (track = 0; track < numu * numv; track++) {
+                uu = -umax + track % numu;
+                vv = -vmax + track / numu;
+                ww = 8.0 * vv / ((double) obs->numseg * obs->numseg);
+                wind = NEAREST_INT((ww - obs->wlo) * ACCEL_RDW);
+                if (wind < 0)
+                    wind = 0;
+                if (wind > numws - 1)
+                    wind = numws - 1;
+                for (jj = 0; jj < obs->numseg; jj++) {
+                    x = xs[jj];
+                    shift = NEAREST_INT((uu * x + 4.0 * vv * x * x) * ACCEL_RDR);
+                    zz = (uu + 8.0 * vv * x) / obs->numseg;
+                    zind = NEAREST_INT((zz - obs->zlo) * ACCEL_RDZ);
+                    if (zind < 0)
+                        zind = 0;
+                    if (zind > numzs - 1)
+                        zind = numzs - 1;
+                    rows[jj] = strips[jj] + (wind * numzs + zind) * striprs +
+                        margin * ACCEL_RDR + shift;
+                }
+                memcpy(stack, rows[0], sizeof(float) * blockrs);
+                for (jj = 1; jj < obs->numseg; jj++) {
+                    float *row = rows[jj];
+                    for (kk = 0; kk < blockrs; kk++)
+                        stack[kk] += row[kk];
+                }
+                for (kk = 0; kk < blockrs; kk++) {
+                    if (stack[kk] > powcut) {
+                        r0 = blo + kk * (double) ACCEL_DR;
+                        if (r0 > rhi)
+                            break;
+                        pow = stack[kk];
+                        sig = candidate_sigma(pow, obs->numseg, numindep);
+#ifdef _OPENMP
+#pragma omp critical
+#endif
+                        {
+                            cands = insert_new_accelcand(cands, pow, sig, 1,
+                                                         (r0 + vv / 3.0) * obs->numseg,
+                                                         uu * obs->numseg,
+                                                         8.0 * vv * obs->numseg,
+                                                         &added);
+                        }
+                    }
+                }
+            }
+            free(rows);
+            vect_free(stack);
+        }
+    }
+    printf("\rAmount of search complete = %3d%%", 100);
+    fflush(stdout);
+
+    for (ii = 0; ii < obs->numseg; ii++)
+        vect_free(strips[ii]);
+    free(strips);
+    vect_free(xs);
+    free_subharminfos(&segobs[0], shis);
+    free(segobs);
+    return cands;
+}
@@ -51,6 +51,32 @@ static inline int twon_to_index(int n)
 }
 
 
+int stage_numharm(accelobs * obs, int stage)
+/* The number of harmonics summed in harmonic summing stage 'stage' */
+{
+    return obs->allharm ? stage + 1 : index_to_twon(stage);
+}
+
+
+int numharm_stage(accelobs * obs, int numharm)
+/* The harmonic summing stage where 'numharm' harmonics are summed */
+{
+    return obs->allharm ? numharm - 1 : twon_to_index(numharm);
+}
+
+
+int new_subharmonic(int numharm, int harmnum)
+/* Harmonic sums are built up in chains where the number of harmonics */
+/* doubles at each step (1, 2, 4, ... or 3, 6, 12, ... etc).  Return  */
+/* true if subharmonic 'harmnum' / 'numharm' is not already in the    */
+/* running sum from the previous step of its chain.                   */
+{
+    if (numharm % 2)            /* Odd numbers start a new chain */
+        return 1;
+    return harmnum % 2;
+}
+
+
 static inline double calc_required_r(double harm_fract, double rfull)
 /* Calculate the 'r' you need for subharmonic  */
 /* harm_fract = harmnum / numharm if the       */
@@ -149,7 +175,9 @@ static int calc_fftlen(int numharm, int harmnum, int max_zfull, int max_wfull, a
 }
 
 
-static void init_kernel(int z, int w, int fftlen, kernel * kern)
+void init_kernel(int z, int w, int numbetween, int fftlen, kernel * kern)
+/* Generate the FFTd correlation kernel for f-dot 'z', f-dot-dot 'w', */
+/* and Fourier frequency resolution 'numbetween' of length 'fftlen'.  */
 {
     int numkern;
     fcomplex *tempkern;
@@ -157,7 +185,7 @@ static void init_kernel(int z, int w, int fftlen, kernel * kern)
     kern->z = z;
     kern->w = w;
     kern->fftlen = fftlen;
-    kern->numbetween = ACCEL_NUMBETWEEN;
+    kern->numbetween = numbetween;
     kern->kern_half_width = w_resp_halfwidth((double) z, (double) w, LOWACC);
     numkern = 2 * kern->numbetween * kern->kern_half_width;
     kern->numgoodbins = kern->fftlen - numkern;
@@ -225,10 +253,183 @@ static void init_subharminfo(int numharm, int harmnum, int zmax, int wmax, subha
     /* Actually append kernels to each array element */
     for (ii = 0; ii < shi->numkern_wdim; ii++) {
         for (jj = 0; jj < shi->numkern_zdim; jj++) {
-            init_kernel(-shi->zmax + jj * ACCEL_DZ,
-                        -shi->wmax + ii * ACCEL_DW, fftlen, &shi->kern[ii][jj]);
+            init_kernel(-shi->zmax + jj * ACCEL_DZ, -shi->wmax + ii * ACCEL_DW,
+                        ACCEL_NUMBETWEEN, fftlen, &shi->kern[ii][jj]);
+        }
+    }
+}
+
+
+/* Kernels only depend on z, w, and the FFT length.  So when summing */
+/* every number of harmonics, the many subharmonics share a "bank"   */
+/* of kernels for each FFT length, rather than each having their own */
+/* (which would take far too much memory).                           */
+typedef struct kernbank {
+    int fftlen;        /* Number of complex points in the kernels */
+    int zmax;          /* The maximum Fourier f-dot of the kernels */
+    int wmax;          /* The maximum Fourier f-dot-dot of the kernels */
+    kernel **kern;     /* A 2D array of the kernels, with dimensions of z and w */
+} kernbank;
+
+static kernbank *kernbanks = NULL;
+static int numkernbanks = 0;
+
+
+static kernbank *get_kernbank(int fftlen)
+/* Return the kernel bank for 'fftlen', adding a new one if needed */
+{
+    int ii;
+
+    for (ii = 0; ii < numkernbanks; ii++)
+        if (kernbanks[ii].fftlen == fftlen)
+            return kernbanks + ii;
+    kernbanks = (kernbank *) realloc(kernbanks, (numkernbanks + 1) * sizeof(kernbank));
+    kernbanks[numkernbanks].fftlen = fftlen;
+    kernbanks[numkernbanks].zmax = 0;
+    kernbanks[numkernbanks].wmax = 0;
+    kernbanks[numkernbanks].kern = NULL;
+    return kernbanks + numkernbanks++;
+}
+
+
+static double init_kernbanks(accelobs * obs)
+/* Generate the kernels for all of the subharmonics of a search that */
+/* sums every number of harmonics.  Return the RAM used (in bytes).  */
+{
+    int ii, jj, kk, numharm, zmax, wmax;
+    double harm_fract, ram_use = 0.0;
+    kernbank *bank;
+
+    /* Find the range of z and w needed for each FFT length */
+    for (ii = 1; ii < obs->numharmstages; ii++) {
+        numharm = stage_numharm(obs, ii);
+        for (jj = 1; jj < numharm; jj++) {
+            if (!new_subharmonic(numharm, jj))
+                continue;
+            harm_fract = (double) jj / (double) numharm;
+            zmax = calc_required_z(harm_fract, obs->zhi);
+            wmax = calc_required_w(harm_fract, obs->whi);
+            bank = get_kernbank(calc_fftlen(numharm, jj, (int) obs->zhi,
+                                            (int) obs->whi, obs));
+            if (zmax > bank->zmax)
+                bank->zmax = zmax;
+            if (wmax > bank->wmax)
+                bank->wmax = wmax;
+        }
+    }
+    /* And generate them */
+    for (ii = 0; ii < numkernbanks; ii++) {
+        int numkern_zdim, numkern_wdim;
+
+        bank = kernbanks + ii;
+        numkern_zdim = (bank->zmax / ACCEL_DZ) * 2 + 1;
+        numkern_wdim = (bank->wmax / ACCEL_DW) * 2 + 1;
+        bank->kern = gen_kernmatrix(numkern_zdim, numkern_wdim);
+        for (jj = 0; jj < numkern_wdim; jj++)
+            for (kk = 0; kk < numkern_zdim; kk++)
+                init_kernel(-bank->zmax + kk * ACCEL_DZ, -bank->wmax + jj * ACCEL_DW,
+                            ACCEL_NUMBETWEEN, bank->fftlen, &bank->kern[jj][kk]);
+        ram_use += (double) numkern_zdim * numkern_wdim * bank->fftlen * sizeof(fcomplex);
+    }
+    return ram_use;
+}
+
+
+static void free_kernbanks(void)
+{
+    int ii, jj, kk, numkern_zdim, numkern_wdim;
+
+    for (ii = 0; ii < numkernbanks; ii++) {
+        numkern_zdim = (kernbanks[ii].zmax / ACCEL_DZ) * 2 + 1;
+        numkern_wdim = (kernbanks[ii].wmax / ACCEL_DW) * 2 + 1;
+        for (jj = 0; jj < numkern_wdim; jj++)
+            for (kk = 0; kk < numkern_zdim; kk++)
+                free_kernel(&kernbanks[ii].kern[jj][kk]);
+        free(kernbanks[ii].kern[0]);
+        free(kernbanks[ii].kern);
+    }
+    free(kernbanks);
+    kernbanks = NULL;
+    numkernbanks = 0;
+}
+
+
+static void init_banked_subharminfo(int numharm, int harmnum, subharminfo * shi,
+                                    accelobs * obs)
+/* Like init_subharminfo(), but the kernels are in a kernel bank */
+{
+    int ii, zoff, woff;
+    double harm_fract;
+    kernbank *bank;
+
+    harm_fract = (double) harmnum / (double) numharm;
+    shi->numharm = numharm;
+    shi->harmnum = harmnum;
+    shi->zmax = calc_required_z(harm_fract, obs->zhi);
+    shi->wmax = calc_required_w(harm_fract, obs->whi);
+    shi->rinds = (unsigned short *) malloc(obs->corr_uselen * sizeof(unsigned short));
+    shi->zinds = (unsigned short *) malloc(obs->corr_uselen * sizeof(unsigned short));
+    shi->numkern_zdim = (shi->zmax / ACCEL_DZ) * 2 + 1;
+    shi->numkern_wdim = (shi->wmax / ACCEL_DW) * 2 + 1;
+    shi->numkern = shi->numkern_zdim * shi->numkern_wdim;
+    bank = get_kernbank(calc_fftlen(numharm, harmnum, (int) obs->zhi,
+                                    (int) obs->whi, obs));
+    zoff = (bank->zmax - shi->zmax) / ACCEL_DZ;
+    woff = (bank->wmax - shi->wmax) / ACCEL_DW;
+    shi->kern = (kernel **) malloc(shi->numkern_wdim * sizeof(kernel *));
+    for (ii = 0; ii < shi->numkern_wdim; ii++)
+        shi->kern[ii] = bank->kern[ii + woff] + zoff;
+}
+
+
+static double correlation_cost(subharminfo * shi)
+/* Rough number of floating point operations to correlate a block */
+/* of data with all of the kernels of a subharmonic (i.e. complex */
+/* multiplies and inverse FFTs) and to make the powers.           */
+{
+    double fftlen = shi->kern[0][0].fftlen;
+
+    return shi->numkern * fftlen * (5.0 * log2(fftlen) + 9.0);
+}
+
+
+static void print_harmsum_costs(accelobs * obs, subharminfo ** shis)
+/* Print a simple model of the cost of each harmonic summing stage,   */
+/* per block of the search and relative to computing and searching    */
+/* the fundamental's plane.  Each stage computes its new subharmonics */
+/* (unless searching in memory), adds them into the summed plane, and */
+/* checks that plane against the stage's cutoff power.                */
+{
+    int ii, jj, numharm, numnew;
+    double planesize, fundcost, cost, totcost;
+
+    if (obs->numharmstages == 1)
+        return;
+    planesize = (double) obs->corr_uselen * shis[0][0].numkern;
+    fundcost = correlation_cost(&shis[0][0]) + planesize;
+    totcost = fundcost;
+    printf("\nApprox relative cost of each harmonic summing stage:\n");
+    printf("  Numharm  New subharms  Marginal  Cumulative\n");
+    printf("  %7d  %12d  %8.3f  %10.3f\n", 1, 0, 1.0, 1.0);
+    for (ii = 1; ii < obs->numharmstages; ii++) {
+        numharm = stage_numharm(obs, ii);
+        /* The search of the summed plane, and if this starts a new */
+        /* chain of sums, the copy of the fundamental to start it   */
+        cost = planesize * ((numharm % 2) ? 2.0 : 1.0);
+        numnew = 0;
+        for (jj = 1; jj < numharm; jj++) {
+            if (!new_subharmonic(numharm, jj))
+                continue;
+            numnew++;
+            cost += 2.0 * planesize;
+            if (!obs->inmem)
+                cost += correlation_cost(&shis[ii][jj - 1]);
         }
+        totcost += cost;
+        printf("  %7d  %12d  %8.3f  %10.3f\n", numharm, numnew,
+               cost / fundcost, totcost / fundcost);
     }
+    printf("\n");
 }
 
 
@@ -252,7 +453,23 @@ subharminfo **create_subharminfos(accelobs * obs)
         printf("  Harm  1/1 : %5d kernels, %4d < z < %-4d (%d pt FFTs)\n",
                shis[0][0].numkern, -shis[0][0].zmax, shis[0][0].zmax, fftlen);
     /* Prep the sub-harmonics if needed */
-    if (!obs->inmem) {
+    if (!obs->inmem && obs->allharm) {
+        kern_ram_use += init_kernbanks(obs);
+        for (ii = 1; ii < obs->numharmstages; ii++) {
+            int numnew = 0;
+
+            harmtosum = stage_numharm(obs, ii);
+            shis[ii] = (subharminfo *) malloc(harmtosum * sizeof(subharminfo));
+            for (jj = 1; jj < harmtosum; jj++) {
+                if (!new_subharmonic(harmtosum, jj))
+                    continue;
+                init_banked_subharminfo(harmtosum, jj, &shis[ii][jj - 1], obs);
+                numnew++;
+            }
+            printf("  Harms %3d : %3d new subharmonics\n", harmtosum, numnew);
+        }
+        printf("  (The subharmonics share %d banks of kernels)\n", numkernbanks);
+    } else if (!obs->inmem) {
         for (ii = 1; ii < obs->numharmstages; ii++) {
             harmtosum = index_to_twon(ii);
             shis[ii] = (subharminfo *) malloc(harmtosum * sizeof(subharminfo));
@@ -274,6 +491,7 @@ subharminfo **create_subharminfos(accelobs * obs)
         }
     }
     printf("Total RAM used by correlation kernels:  %.3f GB\n", kern_ram_use / (1 << 30));
+    print_harmsum_costs(obs, shis);
     return shis;
 }
 
@@ -302,12 +520,23 @@ void free_subharminfos(accelobs * obs, subharminfo ** shis)
     /* Free the sub-harmonics */
     if (!obs->inmem) {
         for (ii = 1; ii < obs->numharmstages; ii++) {
-            harmtosum = index_to_twon(ii);
-            for (jj = 1; jj < harmtosum; jj += 2) {
-                free_subharminfo(&shis[ii][jj - 1]);
+            harmtosum = stage_numharm(obs, ii);
+            for (jj = 1; jj < harmtosum; jj++) {
+                if (!new_subharmonic(harmtosum, jj))
+                    continue;
+                if (obs->allharm) {
+                    /* The kernels themselves are in the kernel banks */
+                    free(shis[ii][jj - 1].rinds);
+                    free(shis[ii][jj - 1].zinds);
+                    free(shis[ii][jj - 1].kern);
+                } else {
+                    free_subharminfo(&shis[ii][jj - 1]);
+                }
             }
             free(shis[ii]);
         }
+        if (obs->allharm)
+            free_kernbanks();
     }
     /* Free the fundamental */
     free_subharminfo(&shis[0][0]);
@@ -374,8 +603,8 @@ GSList *sort_accelcands(GSList * list)
 }
 
 
-static GSList *insert_new_accelcand(GSList * list, float power, float sigma,
-                                    int numharm, double rr, double zz, double ww, int *added)
+GSList *insert_new_accelcand(GSList * list, float power, float sigma,
+                             int numharm, double rr, double zz, double ww, int *added)
 /* Checks the current list to see if there is already */
 /* a candidate within ACCEL_CLOSEST_R bins.  If not,  */
 /* it adds it to the list in increasing freq order.   */
@@ -609,8 +838,16 @@ void optimize_accelcand(accelcand * cand, accelobs * obs)
             cand->hirs[ii] += obs->lobin;
         }
     }
-    cand->sigma = candidate_sigma(cand->power, cand->numharm,
-                                  obs->numindep[twon_to_index(cand->numharm)]);
+    if (obs->numseg > 1) {
+        /* The polished powers are coherent over the full observation, */
+        /* so they replace the semi-coherent (summed) segment power    */
+        cand->power = 0.0;
+        for (ii = 0; ii < cand->numharm; ii++)
+            cand->power += cand->pows[ii];
+        cand->sigma = candidate_sigma(cand->power, cand->numharm, obs->numindep[0]);
+    } else
+        cand->sigma = candidate_sigma(cand->power, cand->numharm,
+                                      obs->numindep[numharm_stage(obs, cand->numharm)]);
 }
 
 
@@ -651,11 +888,56 @@ static void write_val_with_err(FILE * outfile, double val, double err,
 }
 
 
+static double calc_coherent_pow(accelcand * cand, accelobs * obs)
+/* Return the coherently summed power of the harmonics of 'cand' */
+{
+    int jj;
+    double coherent_r = 0.0, coherent_i = 0.0;
+    double phs0, phscorr, amp;
+    rderivs harm;
+
+    /* These phase calculations assume the fundamental is best */
+    /* Better to irfft them and check the amplitude */
+    phs0 = cand->derivs[0].phs;
+    for (jj = 0; jj < cand->numharm; jj++) {
+        harm = cand->derivs[jj];
+        if (obs->nph > 0.0)
+            amp = sqrt(harm.pow / obs->nph);
+        else
+            amp = sqrt(harm.pow / harm.locpow);
+        phscorr = phs0 - fmod((jj + 1.0) * phs0, TWOPI);
+        coherent_r += amp * cos(harm.phs + phscorr);
+        coherent_i += amp * sin(harm.phs + phscorr);
+    }
+    return coherent_r * coherent_r + coherent_i * coherent_i;
+}
+
+
+static void calc_harm_props(accelcand * cand, int harmnum, accelobs * obs,
+                            fourierprops * props)
+/* Calculate the fourierprops of harmonic 'harmnum' (0 = fundamental) */
+/* of 'cand', normalized by the freq 0 level if it was requested.     */
+{
+    if (obs->nph > 0.0) {
+        double tmp_locpow;
+
+        tmp_locpow = cand->derivs[harmnum].locpow;
+        cand->derivs[harmnum].locpow = obs->nph;
+        calc_props(cand->derivs[harmnum], cand->hirs[harmnum],
+                   cand->hizs[harmnum], cand->hiws[harmnum], props);
+        cand->derivs[harmnum].locpow = tmp_locpow;
+    } else {
+        calc_props(cand->derivs[harmnum], cand->hirs[harmnum],
+                   cand->hizs[harmnum], cand->hiws[harmnum], props);
+    }
+}
+
+
 void output_fundamentals(fourierprops * props, GSList * list,
                          accelobs * obs, infodata * idata)
 {
     double accel = 0.0, accelerr = 0.0, coherent_pow;
-    int ii, jj, numcols = 13, numcands, *width, *error;
+    int ii, numcols = 13, numcands, *width, *error;
     int widths[13] = { 4, 5, 6, 8, 4, 16, 15, 15, 15, 11, 11, 15, 20 };
     int errors[13] = { 0, 0, 0, 0, 0, 1, 1, 2, 1, 2, 2, 2, 0 };
     char tmpstr[80], ctrstr[80], *notes;
@@ -756,26 +1038,7 @@ void output_fundamentals(fourierprops * props, GSList * list,
         cand = (accelcand *) (listptr->data);
         calc_rzwerrs(props + ii, obs->T, &errs);
 
-        {                       /* Calculate the coherently summed power */
-            double coherent_r = 0.0, coherent_i = 0.0;
-            double phs0, phscorr, amp;
-            rderivs harm;
-
-            /* These phase calculations assume the fundamental is best */
-            /* Better to irfft them and check the amplitude */
-            phs0 = cand->derivs[0].phs;
-            for (jj = 0; jj < cand->numharm; jj++) {
-                harm = cand->derivs[jj];
-                if (obs->nph > 0.0)
-                    amp = sqrt(harm.pow / obs->nph);
-                else
-                    amp = sqrt(harm.pow / harm.locpow);
-                phscorr = phs0 - fmod((jj + 1.0) * phs0, TWOPI);
-                coherent_r += amp * cos(harm.phs + phscorr);
-                coherent_i += amp * sin(harm.phs + phscorr);
-            }
-            coherent_pow = coherent_r * coherent_r + coherent_i * coherent_i;
-        }
+        coherent_pow = calc_coherent_pow(cand, obs);
 
         sprintf(tmpstr, "%-4d", ii + 1);
         center_string(ctrstr, tmpstr, *width++);
@@ -894,18 +1157,7 @@ void output_harmonics(GSList * list, accelobs * obs, infodata * idata)
     for (ii = 0; ii < numcands; ii++) {
         cand = (accelcand *) (listptr->data);
         for (jj = 0; jj < cand->numharm; jj++) {
-            if (obs->nph > 0.0) {
-                double tmp_locpow;
-
-                tmp_locpow = cand->derivs[jj].locpow;
-                cand->derivs[jj].locpow = obs->nph;
-                calc_props(cand->derivs[jj], cand->hirs[jj],
-                           cand->hizs[jj], cand->hiws[jj], &props);
-                cand->derivs[jj].locpow = tmp_locpow;
-            } else {
-                calc_props(cand->derivs[jj], cand->hirs[jj],
-                           cand->hizs[jj], cand->hiws[jj], &props);
-            }
+            calc_harm_props(cand, jj, obs, &props);
             calc_rzwerrs(&props, obs->T, &errs);
             if (strncmp(idata->telescope, "None", 4) != 0) {
                 comp_psr_to_cand(&props, idata, notes, 0);
@@ -967,6 +1219,190 @@ void output_harmonics(GSList * list, accelobs * obs, infodata * idata)
 }
 
 
+static void add_accelcol(accelcol_desc * cols, void **data, int *numcols,
+                         char *name, accelcol_type type, long long length,
+                         void *values)
+{
+    memset(cols + *numcols, 0, sizeof(accelcol_desc));
+    strncpy(cols[*numcols].name, name, sizeof(cols[*numcols].name) - 1);
+    cols[*numcols].type = type;
+    cols[*numcols].length = length;
+    data[(*numcols)++] = values;
+}
+
+
+void output_bary_cands(fourierprops * props, GSList * list,
+                       accelobs * obs, infodata * idata)
+/* Write barycentric versions of the (topocentric) fundamentals to */
+/* '<accelnm>_BARY' (text) and '<accelnm>_BARY.cand' (binary).     */
+{
+    int ii, numcands;
+    char *accelnm, *barynm;
+    fourierprops *bprops;
+
+    numcands = g_slist_length(list);
+    bprops = (fourierprops *) malloc(sizeof(fourierprops) * numcands);
+    for (ii = 0; ii < numcands; ii++) {
+        bprops[ii] = props[ii];
+        topo2bary_rzw(obs->baryderivs, obs->T, props[ii].r, props[ii].z, props[ii].w,
+                      &bprops[ii].r, &bprops[ii].z, &bprops[ii].w);
+    }
+    accelnm = obs->accelnm;
+    barynm = (char *) malloc(strlen(accelnm) + 11);
+    sprintf(barynm, "%s_BARY.cand", accelnm);
+    obs->workfile = chkfopen(barynm, "wb");
+    chkfwrite(bprops, sizeof(fourierprops), numcands, obs->workfile);
+    /* output_fundamentals() closes the work file unless using .dat input */
+    if (obs->dat_input)
+        fclose(obs->workfile);
+    sprintf(barynm, "%s_BARY", accelnm);
+    obs->accelnm = barynm;
+    output_fundamentals(bprops, list, obs, idata);
+    fclose(obs->workfile);
+    obs->accelnm = accelnm;
+    free(barynm);
+    free(bprops);
+}
+
+
+void output_accelcols(fourierprops * props, GSList * list,
+                      accelobs * obs, infodata * idata)
+/* Write the candidates and their harmonics to the columnar binary */
+/* file '<accelnm>.cols'.  See accelcols.h for the format.         */
+{
+    static char *cand_fnames[] = { "sigma", "power", "cpow",
+        "rerr", "zerr", "werr"
+    };
+    static char *cand_dnames[] = { "r", "z", "w", "period", "perr",
+        "freq", "freqerr", "fdot", "fdoterr", "accel", "accelerr"
+    };
+    static char *harm_fnames[] = { "h_pow", "h_powerr", "h_rawpow", "h_sigma",
+        "h_rerr", "h_zerr", "h_werr", "h_phs", "h_phserr",
+        "h_cen", "h_cenerr", "h_pur", "h_purerr", "h_locpow"
+    };
+    static char *harm_dnames[] = { "h_r", "h_z", "h_w" };
+    int ii, jj, kk, numcands, numcols = 0, *numharm;
+    int numcf = 6, numcd = 11, numhf = 14, numhd = 3;
+    long long numharms = 0, hh, *harmstart;
+    float **cf, **hf;
+    double **cd, **hd;
+    char *colsnm;
+    void *data[40];
+    accelcol_desc cols[40];
+    accelcols_header hdr;
+    accelcand *cand;
+    GSList *listptr;
+    fourierprops hprops;
+    rzwerrs errs;
+
+    numcands = g_slist_length(list);
+    for (listptr = list; listptr; listptr = listptr->next)
+        numharms += ((accelcand *) (listptr->data))->numharm;
+
+    cf = gen_fmatrix(numcf, numcands);
+    cd = gen_dmatrix(numcd, numcands);
+    hf = gen_fmatrix(numhf, numharms);
+    hd = gen_dmatrix(numhd, numharms);
+    numharm = gen_ivect(numcands);
+    harmstart = (long long *) malloc(sizeof(long long) * numcands);
+
+    /* Fill the columns */
+
+    hh = 0;
+    listptr = list;
+    for (ii = 0; ii < numcands; ii++) {
+        cand = (accelcand *) (listptr->data);
+        calc_rzwerrs(props + ii, obs->T, &errs);
+        cf[0][ii] = cand->sigma;
+        cf[1][ii] = cand->power;
+        cf[2][ii] = calc_coherent_pow(cand, obs);
+        cf[3][ii] = props[ii].rerr;
+        cf[4][ii] = props[ii].zerr;
+        cf[5][ii] = props[ii].werr;
+        numharm[ii] = cand->numharm;
+        cd[0][ii] = props[ii].r;
+        cd[1][ii] = props[ii].z;
+        cd[2][ii] = props[ii].w;
+        cd[3][ii] = errs.p;
+        cd[4][ii] = errs.perr;
+        cd[5][ii] = errs.f;
+        cd[6][ii] = errs.ferr;
+        cd[7][ii] = errs.fd;
+        cd[8][ii] = errs.fderr;
+        cd[9][ii] = props[ii].z * SOL / (obs->T * obs->T * errs.f);
+        cd[10][ii] = props[ii].zerr * SOL / (obs->T * obs->T * errs.f);
+        harmstart[ii] = hh;
+        for (jj = 0; jj < cand->numharm; jj++, hh++) {
+            calc_harm_props(cand, jj, obs, &hprops);
+            hf[0][hh] = hprops.pow;
+            hf[1][hh] = hprops.powerr;
+            hf[2][hh] = hprops.rawpow;
+            hf[3][hh] = candidate_sigma(hprops.pow, 1, 1);
+            hf[4][hh] = hprops.rerr;
+            hf[5][hh] = hprops.zerr;
+            hf[6][hh] = hprops.werr;
+            hf[7][hh] = hprops.phs;
+            hf[8][hh] = hprops.phserr;
+            hf[9][hh] = hprops.cen;
+            hf[10][hh] = hprops.cenerr;
+            hf[11][hh] = hprops.pur;
+            hf[12][hh] = hprops.purerr;
+            hf[13][hh] = hprops.locpow;
+            hd[0][hh] = hprops.r;
+            hd[1][hh] = hprops.z;
+            hd[2][hh] = hprops.w;
+        }
+        listptr = listptr->next;
+    }
+
+    /* Describe the columns and write the file */
+
+    for (kk = 0; kk < numcf; kk++)
+        add_accelcol(cols, data, &numcols, cand_fnames[kk],
+                     ACCELCOL_FLOAT32, numcands, cf[kk]);
+    add_accelcol(cols, data, &numcols, "numharm", ACCELCOL_INT32, numcands,
+                 numharm);
+    for (kk = 0; kk < numcd; kk++)
+        add_accelcol(cols, data, &numcols, cand_dnames[kk],
+                     ACCELCOL_FLOAT64, numcands, cd[kk]);
+    add_accelcol(cols, data, &numcols, "harmstart", ACCELCOL_INT64, numcands,
+                 harmstart);
+    for (kk = 0; kk < numhf; kk++)
+        add_accelcol(cols, data, &numcols, harm_fnames[kk],
+                     ACCELCOL_FLOAT32, numharms, hf[kk]);
+    for (kk = 0; kk < numhd; kk++)
+        add_accelcol(cols, data, &numcols, harm_dnames[kk],
+                     ACCELCOL_FLOAT64, numharms, hd[kk]);
+
+    memset(&hdr, 0, sizeof(accelcols_header));
+    hdr.numcands = numcands;
+    hdr.numharms = numharms;
+    hdr.T = obs->T;
+    hdr.dt = obs->dt;
+    hdr.N = obs->N;
+    hdr.dm = idata->dm;
+    hdr.numcols = numcols;
+    hdr.zmax = (int) obs->zhi;
+    hdr.wmax = (int) obs->whi;
+    hdr.numharm = stage_numharm(obs, obs->numharmstages - 1);
+    colsnm = (char *) malloc(strlen(obs->accelnm) + 6);
+    sprintf(colsnm, "%s.cols", obs->accelnm);
+    write_accelcols(colsnm, &hdr, cols, data);
+
+    free(colsnm);
+    vect_free(cf[0]);
+    vect_free(cf);
+    vect_free(cd[0]);
+    vect_free(cd);
+    vect_free(hf[0]);
+    vect_free(hf);
+    vect_free(hd[0]);
+    vect_free(hd);
+    vect_free(numharm);
+    free(harmstart);
+}
+
+
 void print_accelcand(gpointer data, gpointer user_data)
 {
     accelcand *obj = (accelcand *) data;
@@ -1008,13 +1444,61 @@ fcomplex *get_fourier_amplitudes(long long lobin, int numbins, accelobs * obs)
     }
 }
 
+fcomplex *get_normalized_amplitudes(long long lobin, int numdata, accelobs * obs)
+/* Return the 'numdata' Fourier amplitudes starting at bin 'lobin' */
+/* normalized so that the noise powers have a mean of 1.           */
+{
+    int ii;
+    float powargr, powargi;
+    fcomplex *data;
+
+    data = get_fourier_amplitudes(lobin, numdata, obs);
+    if (obs->nph > 0.0) {
+        //  Use freq 0 normalization if requested (i.e. photons)
+        double norm = 1.0 / sqrt(obs->nph);
+        for (ii = 0; ii < numdata; ii++) {
+            data[ii].r *= norm;
+            data[ii].i *= norm;
+        }
+    } else if (obs->norm_type == 0) {
+        // default block median normalization
+        float *powers;
+        double norm;
+        powers = gen_fvect(numdata);
+        for (ii = 0; ii < numdata; ii++)
+            powers[ii] = POWER(data[ii].r, data[ii].i);
+        norm = 1.0 / sqrt(median(powers, numdata) / log(2.0));
+        vect_free(powers);
+        for (ii = 0; ii < numdata; ii++) {
+            data[ii].r *= norm;
+            data[ii].i *= norm;
+        }
+    } else {
+        // optional running double-tophat local-power normalization
+        float *powers, *loc_powers;
+        powers = gen_fvect(numdata);
+        for (ii = 0; ii < numdata; ii++) {
+            powers[ii] = POWER(data[ii].r, data[ii].i);
+        }
+        loc_powers = corr_loc_pow(powers, numdata);
+        for (ii = 0; ii < numdata; ii++) {
+            float norm = invsqrtf(loc_powers[ii]);
+            data[ii].r *= norm;
+            data[ii].i *= norm;
+        }
+        vect_free(powers);
+        vect_free(loc_powers);
+    }
+    return data;
+}
+
+
 ffdotpows *subharm_fderivs_vol(int numharm, int harmnum,
                                double fullrlo, double fullrhi,
                                subharminfo * shi, accelobs * obs)
 {
     int ii, numdata, fftlen, binoffset;
     long long lobin;
-    float powargr, powargi;
     double drlo, drhi, harm_fract;
     fcomplex *data, *pdata;
     fftwf_plan invplan;
@@ -1064,47 +1548,7 @@ ffdotpows *subharm_fderivs_vol(int numharm, int harmnum,
     fftlen = shi->kern[0][0].fftlen;
     lobin = ffdot->rlo - binoffset;
     numdata = fftlen / ACCEL_NUMBETWEEN;
-    data = get_fourier_amplitudes(lobin, numdata, obs);
-    //if (!obs->mmap_file && !obs->dat_input && 0)
-    //    printf("This is newly malloc'd!\n");
-
-    // Normalize the Fourier amplitudes
-    if (obs->nph > 0.0) {
-        //  Use freq 0 normalization if requested (i.e. photons)
-        double norm = 1.0 / sqrt(obs->nph);
-        for (ii = 0; ii < numdata; ii++) {
-            data[ii].r *= norm;
-            data[ii].i *= norm;
-        }
-    } else if (obs->norm_type == 0) {
-        // default block median normalization
-        float *powers;
-        double norm;
-        powers = gen_fvect(numdata);
-        for (ii = 0; ii < numdata; ii++)
-            powers[ii] = POWER(data[ii].r, data[ii].i);
-        norm = 1.0 / sqrt(median(powers, numdata) / log(2.0));
-        vect_free(powers);
-        for (ii = 0; ii < numdata; ii++) {
-            data[ii].r *= norm;
-            data[ii].i *= norm;
-        }
-    } else {
-        // optional running double-tophat local-power normalization
-        float *powers, *loc_powers;
-        powers = gen_fvect(numdata);
-        for (ii = 0; ii < numdata; ii++) {
-            powers[ii] = POWER(data[ii].r, data[ii].i);
-        }
-        loc_powers = corr_loc_pow(powers, numdata);
-        for (ii = 0; ii < numdata; ii++) {
-            float norm = invsqrtf(loc_powers[ii]);
-            data[ii].r *= norm;
-            data[ii].i *= norm;
-        }
-        vect_free(powers);
-        vect_free(loc_powers);
-    }
+    data = get_normalized_amplitudes(lobin, numdata, obs);
 
     // Prep, spread, and FFT the data
     pdata = gen_cvect(fftlen);
@@ -1406,8 +1850,8 @@ GSList *search_ffdotpows(ffdotpows * ffdot, int numharm,
     float powcut;
     long long numindep;
     
-    powcut = obs->powcut[twon_to_index(numharm)];
-    numindep = obs->numindep[twon_to_index(numharm)];
+    powcut = obs->powcut[numharm_stage(obs, numharm)];
+    numindep = obs->numindep[numharm_stage(obs, numharm)];
     
 #ifdef _OPENMP
 #pragma omp parallel for shared(ffdot,powcut,obs,numharm,numindep)
@@ -1521,6 +1965,71 @@ void deredden(fcomplex * fft, int numamps)
 }
 
 
+static void calc_baryderivs(accelobs * obs, infodata * idata)
+/* Use TEMPO to determine how the Doppler shift from the motion of */
+/* the observatory changes during the observation (for -topo2bary) */
+{
+    int ii, numbarypts;
+    double *topotimes, *barytimes, *voverc;
+    char obscode[3], scope[40], ephem[10], rastring[50], decstring[50];
+
+    /* A point about every 20 s (like prepfold), and at least 16 */
+    numbarypts = (int) (obs->T / 20.0) + 1;
+    if (numbarypts < 16)
+        numbarypts = 16;
+    topotimes = gen_dvect(numbarypts);
+    barytimes = gen_dvect(numbarypts);
+    voverc = gen_dvect(numbarypts);
+    for (ii = 0; ii < numbarypts; ii++)
+        topotimes[ii] = idata->mjd_i + idata->mjd_f +
+            ii * obs->T / (numbarypts - 1) / SECPERDAY;
+    telescope_to_tempocode(idata->telescope, scope, obscode);
+    strcpy(ephem, "DE405");
+    ra_dec_to_string(rastring, idata->ra_h, idata->ra_m, idata->ra_s);
+    ra_dec_to_string(decstring, idata->dec_d, idata->dec_m, idata->dec_s);
+    printf("Generating barycentric corrections...\n");
+    barycenter(topotimes, barytimes, voverc, numbarypts,
+               rastring, decstring, obscode, ephem);
+    doppler_derivs(topotimes, voverc, numbarypts, obs->T, obs->baryderivs);
+    printf("   Mid-obs d(t_bary)/d(t_topo) = %.12f (%.3g / s)\n\n",
+           obs->baryderivs[0], obs->baryderivs[1]);
+    vect_free(topotimes);
+    vect_free(barytimes);
+    vect_free(voverc);
+}
+
+
+void calc_accel_powcuts(accelobs * obs, double trialsfact)
+/* Allocate and set the approximate numbers of independent trials */
+/* and the cutoff powers of the harmonic sums of 'obs'.  The      */
+/* trials are multiplied by 'trialsfact' (for searches of many    */
+/* parts of an observation).                                      */
+{
+    int ii;
+
+    obs->powcut = (float *) malloc(obs->numharmstages * sizeof(float));
+    obs->numindep = (long long *) malloc(obs->numharmstages * sizeof(long long));
+    for (ii = 0; ii < obs->numharmstages; ii++) {
+        if (obs->numz == 1 && obs->numw == 0)
+            obs->numindep[ii] = (obs->rhi - obs->rlo) / stage_numharm(obs, ii);
+        else if (obs->numz > 1 && obs->numw == 0)
+            /* The numz+1 takes care of the small amount of  */
+            /* search we get above zmax and below zmin.      */
+            obs->numindep[ii] = (obs->rhi - obs->rlo) * (obs->numz + 1) *
+                (obs->dz / 6.95) / stage_numharm(obs, ii);
+        else
+            /* The numw+1 takes care of the small amount of  */
+            /* search we get above wmax and below wmin.      */
+            obs->numindep[ii] = (obs->rhi - obs->rlo) * \
+                (obs->numz + 1) * (obs->dz / 6.95) *        \
+                (obs->numw + 1) * (obs->dw / 44.2) / stage_numharm(obs, ii);
+        obs->numindep[ii] *= trialsfact;
+        obs->powcut[ii] = power_for_sigma(obs->sigma,
+                                          stage_numharm(obs, ii), obs->numindep[ii]);
+    }
+}
+
+
 void create_accelobs(accelobs * obs, infodata * idata, Cmdline * cmd, int usemmap)
 {
     int ii, rootlen, input_shorts = 0;
@@ -1556,6 +2065,46 @@ void create_accelobs(accelobs * obs, infodata * idata, Cmdline * cmd, int usemma
         }
     }
 
+    obs->numseg = cmd->numseg;
+    obs->seglen = 0;
+    obs->segffts = NULL;
+    if (obs->numseg > 1 && !obs->dat_input) {
+        printf("\nA semi-coherent search ('-numseg %d') needs a '.[s]dat' file!\n\n",
+               obs->numseg);
+        exit(0);
+    }
+
+    obs->winlen = (cmd->winlenP) ? cmd->winlen : 0.0;
+    obs->numwinlens = (cmd->winlenP) ? cmd->numwinlens : 0;
+    obs->tseries = NULL;
+    if (obs->numwinlens && !obs->dat_input) {
+        printf("\nA windowed search ('-winlen %g') needs a '.[s]dat' file!\n\n",
+               obs->winlen);
+        exit(0);
+    }
+    if (obs->numwinlens && obs->numseg > 1) {
+        printf("\nA windowed search ('-winlen') can not also be semi-coherent ('-numseg')!\n\n");
+        exit(0);
+    }
+    if (obs->numwinlens && cmd->topo2baryP) {
+        printf("\nA windowed search ('-winlen') can not write barycentric candidates ('-topo2bary')!\n\n");
+        exit(0);
+    }
+
+    obs->hierfrac = (cmd->hierP) ? cmd->hierfrac : 0.0;
+    if (obs->hierfrac > 0.0 && obs->numseg > 1) {
+        printf("Note:  The semi-coherent search is not done hierarchically.\n\n");
+        obs->hierfrac = 0.0;
+    }
+    if (obs->hierfrac > 0.0 && cmd->allharmP) {
+        printf("Note:  Searches summing every number of harmonics are not done hierarchically.\n\n");
+        obs->hierfrac = 0.0;
+    }
+    if (obs->hierfrac > 0.0 && obs->numwinlens) {
+        printf("Note:  The windowed search is not done hierarchically.\n\n");
+        obs->hierfrac = 0.0;
+    }
+
     if (cmd->noharmpolishP)
         obs->use_harmonic_polishing = 0;
     else
@@ -1596,27 +2145,31 @@ void create_accelobs(accelobs * obs, infodata * idata, Cmdline * cmd, int usemma
         /* Note:  The padding allows us to search very short time series */
         /*        using correlations without having to worry about       */
         /*        accessing data before or after the valid FFT freqs.    */
+        /*        The buffer is a (zeroed) large vector so that the FFTs */
+        /*        and correlations can use huge pages.                   */
+        ftmp = gen_big_fvect(filelen + 2 * ACCEL_PADDING);
         if (input_shorts) {
             short *stmp = gen_svect(filelen);
-            ftmp = gen_fvect(filelen + 2 * ACCEL_PADDING);
-            for (ii = 0; ii < ACCEL_PADDING; ii++) {
-                ftmp[ii] = 0.0;
-                ftmp[ii + filelen + ACCEL_PADDING] = 0.0;
-            }
             chkfread(stmp, sizeof(short), filelen, datfile);
             for (ii = 0; ii < filelen; ii++)
                 ftmp[ii + ACCEL_PADDING] = (float) stmp[ii];
             vect_free(stmp);
         } else {
-            ftmp =
-                read_float_file(datfile, -ACCEL_PADDING,
-                                filelen + 2 * ACCEL_PADDING);
+            chkfread(ftmp + ACCEL_PADDING, sizeof(float), filelen, datfile);
         }
         /* Now, offset the pointer so that we are pointing at the first */
         /* bits of valid data.                                          */
         ftmp += ACCEL_PADDING;
         fclose(datfile);
 
+        /* FFT the segments for a semi-coherent search */
+        if (obs->numseg > 1)
+            prep_stackslide_segments(ftmp, filelen, obs);
+
+        /* Keep the time series for a windowed search */
+        if (obs->numwinlens)
+            prep_accel_windows(ftmp, filelen, obs);
+
         /* FFT it */
         realfft(ftmp, filelen, -1);
         obs->fftfile = NULL;
@@ -1699,17 +2252,17 @@ void create_accelobs(accelobs * obs, infodata * idata, Cmdline * cmd, int usemma
             exit(1);
         }
     }
-    if (cmd->numharm != 1 &&
-        cmd->numharm != 2 &&
-        cmd->numharm != 4 &&
-        cmd->numharm != 8 &&
-        cmd->numharm != 16 &&
-        cmd->numharm != 32) {
-        printf("\n'numharm' = %d must be a power-of-two!  Exiting\n\n",
+    obs->allharm = cmd->allharmP;
+    if (!obs->allharm && (cmd->numharm & (cmd->numharm - 1))) {
+        printf("\n'numharm' = %d must be a power-of-two (unless using -allharm)!  Exiting\n\n",
                cmd->numharm);
         exit(1);
     }
-    obs->numharmstages = twon_to_index(cmd->numharm) + 1;
+    obs->numharmstages = numharm_stage(obs, cmd->numharm) + 1;
+    if (obs->numseg > 1 && obs->numharmstages > 1) {
+        printf("Note:  The semi-coherent search does not sum harmonics.\n\n");
+        obs->numharmstages = 1;
+    }
 
     obs->dz = ACCEL_DZ;
     obs->numz = (cmd->zmax / ACCEL_DZ) * 2 + 1;
@@ -1737,7 +2290,23 @@ void create_accelobs(accelobs * obs, infodata * idata, Cmdline * cmd, int usemma
     obs->candnm = (char *) calloc(rootlen, 1);
     obs->accelnm = (char *) calloc(rootlen, 1);
     obs->workfilenm = (char *) calloc(rootlen, 1);
-    if (obs->numw) {
+    if (obs->numwinlens && obs->numw) {
+        sprintf(obs->candnm, "%s_ACCEL_%d_JERK_%d_WIN.cand", obs->rootfilenm, cmd->zmax, cmd->wmax);
+        sprintf(obs->accelnm, "%s_ACCEL_%d_JERK_%d_WIN", obs->rootfilenm, cmd->zmax, cmd->wmax);
+        sprintf(obs->workfilenm, "%s_ACCEL_%d_JERK_%d_WIN.txtcand", obs->rootfilenm, cmd->zmax, cmd->wmax);
+    } else if (obs->numwinlens) {
+        sprintf(obs->candnm, "%s_ACCEL_%d_WIN.cand", obs->rootfilenm, cmd->zmax);
+        sprintf(obs->accelnm, "%s_ACCEL_%d_WIN", obs->rootfilenm, cmd->zmax);
+        sprintf(obs->workfilenm, "%s_ACCEL_%d_WIN.txtcand", obs->rootfilenm, cmd->zmax);
+    } else if (obs->numseg > 1 && obs->numw) {
+        sprintf(obs->candnm, "%s_ACCEL_%d_JERK_%d_SEG_%d.cand", obs->rootfilenm, cmd->zmax, cmd->wmax, obs->numseg);
+        sprintf(obs->accelnm, "%s_ACCEL_%d_JERK_%d_SEG_%d", obs->rootfilenm, cmd->zmax, cmd->wmax, obs->numseg);
+        sprintf(obs->workfilenm, "%s_ACCEL_%d_JERK_%d_SEG_%d.txtcand", obs->rootfilenm, cmd->zmax, cmd->wmax, obs->numseg);
+    } else if (obs->numseg > 1) {
+        sprintf(obs->candnm, "%s_ACCEL_%d_SEG_%d.cand", obs->rootfilenm, cmd->zmax, obs->numseg);
+        sprintf(obs->accelnm, "%s_ACCEL_%d_SEG_%d", obs->rootfilenm, cmd->zmax, obs->numseg);
+        sprintf(obs->workfilenm, "%s_ACCEL_%d_SEG_%d.txtcand", obs->rootfilenm, cmd->zmax, obs->numseg);
+    } else if (obs->numw) {
         sprintf(obs->candnm, "%s_ACCEL_%d_JERK_%d.cand", obs->rootfilenm, cmd->zmax, cmd->wmax);
         sprintf(obs->accelnm, "%s_ACCEL_%d_JERK_%d", obs->rootfilenm, cmd->zmax, cmd->wmax);
         sprintf(obs->workfilenm, "%s_ACCEL_%d_JERK_%d.txtcand", obs->rootfilenm, cmd->zmax, cmd->wmax);
@@ -1752,6 +2321,14 @@ void create_accelobs(accelobs * obs, infodata * idata, Cmdline * cmd, int usemma
     obs->numbetween = ACCEL_NUMBETWEEN;
     obs->dt = idata->dt;
     obs->T = idata->dt * idata->N;
+    obs->topo2bary = cmd->topo2baryP;
+    if (obs->topo2bary) {
+        if (idata->bary) {
+            printf("\nThe data are already barycentered, so '-topo2bary' is not needed.  Exiting.\n\n");
+            exit(1);
+        }
+        calc_baryderivs(obs, idata);
+    }
     if (cmd->floP) {
         obs->rlo = floor(cmd->flo * obs->T);
         if (obs->rlo < obs->lobin)
@@ -1800,24 +2377,11 @@ void create_accelobs(accelobs * obs, infodata * idata, Cmdline * cmd, int usemma
     obs->zhi = cmd->zmax;
     obs->zlo = -cmd->zmax;
     obs->sigma = cmd->sigma;
-    obs->powcut = (float *) malloc(obs->numharmstages * sizeof(float));
-    obs->numindep = (long long *) malloc(obs->numharmstages * sizeof(long long));
-    for (ii = 0; ii < obs->numharmstages; ii++) {
-        if (obs->numz == 1 && obs->numw == 0)
-            obs->numindep[ii] = (obs->rhi - obs->rlo) / index_to_twon(ii);
-        else if (obs->numz > 1 && obs->numw == 0)
-            /* The numz+1 takes care of the small amount of  */
-            /* search we get above zmax and below zmin.      */
-            obs->numindep[ii] = (obs->rhi - obs->rlo) * (obs->numz + 1) *
-                (obs->dz / 6.95) / index_to_twon(ii);
-        else
-            /* The numw+1 takes care of the small amount of  */
-            /* search we get above wmax and below wmin.      */
-            obs->numindep[ii] = (obs->rhi - obs->rlo) * \
-                (obs->numz + 1) * (obs->dz / 6.95) *        \
-                (obs->numw + 1) * (obs->dw / 44.2) / index_to_twon(ii);
-        obs->powcut[ii] = power_for_sigma(obs->sigma,
-                                          index_to_twon(ii), obs->numindep[ii]);
+    calc_accel_powcuts(obs, 1.0);
+    if (obs->numseg > 1) {
+        /* The semi-coherent trials are tracks through the segments */
+        obs->numindep[0] = stackslide_numindep(obs);
+        obs->powcut[0] = power_for_sigma(obs->sigma, obs->numseg, obs->numindep[0]);
     }
     obs->numzap = 0;
     /*
@@ -1856,10 +2420,27 @@ void create_accelobs(accelobs * obs, infodata * idata, Cmdline * cmd, int usemma
             printf("Full f-fdot plane would need %.2f GB: ", (float) memuse / gb);
         }
 
-        if (!cmd->wmaxP && (memuse < MAXRAMUSE || cmd->inmemP)) {
+        if (obs->numseg > 1) {
+            printf("using a semi-coherent search of %d segments.\n\n", obs->numseg);
+            obs->inmem = 0;
+            obs->ffdotplane = NULL;
+        } else if (obs->numwinlens) {
+            printf("using a windowed search.\n\n");
+            obs->inmem = 0;
+            obs->ffdotplane = NULL;
+        } else if (!cmd->wmaxP && (memuse < MAXRAMUSE || cmd->inmemP)) {
             printf("using in-memory accelsearch.\n\n");
+            if (obs->hierfrac > 0.0) {
+                /* Harmonic summing in memory is faster than the coarse pass */
+                printf("Note:  In-memory searches are not done hierarchically.\n\n");
+                obs->hierfrac = 0.0;
+            }
             obs->inmem = 1;
-            obs->ffdotplane = gen_fvect(memuse / sizeof(float));
+            obs->ffdotplane = gen_big_fvect(memuse / sizeof(float));
+        } else if (obs->hierfrac > 0.0) {
+            printf("using a hierarchical (coarse-to-fine) accelsearch.\n\n");
+            obs->inmem = 0;
+            obs->ffdotplane = NULL;
         } else {
             printf("using standard accelsearch.\n\n");
             obs->inmem = 0;
@@ -1874,7 +2455,7 @@ void free_accelobs(accelobs * obs)
     if (obs->mmap_file)
         close(obs->mmap_file);
     else if (obs->dat_input)
-        free(obs->fft - ACCEL_PADDING / 2);
+        vect_free(obs->fft - ACCEL_PADDING / 2);
     else
         fclose(obs->fftfile);
     free(obs->powcut);
@@ -1890,4 +2471,8 @@ void free_accelobs(accelobs * obs)
     if (obs->inmem) {
         vect_free(obs->ffdotplane);
     }
+    if (obs->numseg > 1)
+        free_stackslide_segments(obs);
+    if (obs->numwinlens)
+        free_accel_windows(obs);
 }
@@ -0,0 +1,423 @@
+#include "accel.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+/*
+ * Windowed acceleration and jerk searches of a long observation.
+ *
+ * Signals from pulsars in tight binaries (or that are eclipsed, or
+ * that scintillate) are often only detectable in part of a long
+ * observation.  Here the time series is read once and split into
+ * windows of length Tw = winlen, 2 * winlen, ... (obs->numwinlens
+ * lengths) that overlap by half.  The windows of each length are
+ * FFTd in parallel using a single FFTW plan and each of them is
+ * searched with the normal f-fdot(-fdotdot) search.  Since the
+ * correlation kernels only depend on zmax and wmax (which are in
+ * Fourier bins of the window), one set of kernels is shared by all
+ * of the windows.  The same -zmax therefore covers much larger
+ * accelerations in short windows than in long ones.
+ *
+ * The number of trials of each search is multiplied by the number
+ * of independent windows (of all lengths), and the candidates from
+ * all of the windows are converted to the r, z, and w of the full
+ * observation (so that they can be folded with 'prepfold -accelcand'
+ * together with '-start' and '-end') and merged.  The output lists
+ * where in the observation each candidate was found.
+ */
+
+/* Number of detections to allocate space for at a time */
+#define WINCHUNK 256
+
+extern void zapbirds(double lobin, double hibin, FILE * fftfile, fcomplex * fft);
+
+typedef struct accelwincand {
+    fourierprops props;  /* Properties using the full observation's r, z, and w */
+    float sigma;         /* Sigma of the best detection */
+    int numharm;         /* Number of harmonics summed in the best detection */
+    int numwins;         /* Number of windows it was detected in */
+    double f, fd;        /* Frequency (Hz) and f-dot at 'tmid' */
+    double tmid;         /* Time (s) of the middle of the best window */
+    double winlen;       /* Length (s) of the best window */
+    double start, end;   /* Fractions of the obs where the best window starts and ends */
+    double first, last;  /* Fractions of the obs covered by all of the windows */
+} accelwincand;
+
+
+static int compare_accelwincand_sigma(const void *ca, const void *cb)
+/*  Used as compare function for qsort() */
+{
+    accelwincand *a, *b;
+
+    a = (accelwincand *) ca;
+    b = (accelwincand *) cb;
+    if (b->sigma > a->sigma)
+        return 1;
+    if (b->sigma < a->sigma)
+        return -1;
+    return 0;
+}
+
+
+void prep_accel_windows(float *data, long long numdata, accelobs * obs)
+/* Keep a copy of the time series 'data' for a windowed search */
+{
+    obs->tseries = gen_fvect(numdata);
+    memcpy(obs->tseries, data, sizeof(float) * numdata);
+}
+
+
+void free_accel_windows(accelobs * obs)
+{
+    if (obs->tseries)
+        vect_free(obs->tseries);
+    obs->tseries = NULL;
+}
+
+
+static long long *window_starts(long long winlen, long long numdata, int *numwins)
+/* Return the starting points of the windows of length 'winlen'   */
+/* which overlap by half and cover all of the 'numdata' points.   */
+{
+    int ii;
+    long long *starts;
+
+    *numwins = (numdata - winlen) / (winlen / 2) + 1;
+    if ((*numwins - 1) * (winlen / 2) + winlen < numdata)
+        (*numwins)++;
+    starts = (long long *) malloc(sizeof(long long) * *numwins);
+    for (ii = 0; ii < *numwins; ii++)
+        starts[ii] = ii * (winlen / 2);
+    starts[*numwins - 1] = numdata - winlen;
+    return starts;
+}
+
+
+static fcomplex **fft_windows(accelobs * obs, long long winlen,
+                              long long *starts, int numwins)
+/* Return the de-reddened FFTs (padded like the FFT of a '.dat'   */
+/* file) of the 'numwins' windows of length 'winlen' that begin   */
+/* at 'starts'.  The windows are FFTd in parallel.                */
+{
+    int ii;
+    fcomplex **ffts;
+    fftwf_plan plan;
+
+    ffts = (fcomplex **) malloc(numwins * sizeof(fcomplex *));
+    for (ii = 0; ii < numwins; ii++) {
+        float *ftmp = gen_fvect(winlen + 2 * ACCEL_PADDING);
+        memset(ftmp, 0, sizeof(float) * (winlen + 2 * ACCEL_PADDING));
+        ffts[ii] = (fcomplex *) (ftmp + ACCEL_PADDING);
+    }
+
+    // FFTW planning is *not* thread-safe, so make a plan that all
+    // of the threads can use with the new-array execute function
+    plan = fftwf_plan_dft_r2c_1d(winlen, (float *) ffts[0],
+                                 (fftwf_complex *) ffts[0], FFTW_ESTIMATE);
+
+#ifdef _OPENMP
+#pragma omp parallel for default(none) schedule(dynamic) \
+    shared(obs,winlen,starts,numwins,ffts,plan)
+#endif
+    for (ii = 0; ii < numwins; ii++) {
+        fcomplex *fft = ffts[ii];
+
+        memcpy(fft, obs->tseries + starts[ii], sizeof(float) * winlen);
+        fftwf_execute_dft_r2c(plan, (float *) fft, (fftwf_complex *) fft);
+        /* Pack the Nyquist frequency like realfft() does */
+        fft[0].i = fft[winlen / 2].r;
+        fft[winlen / 2].r = fft[winlen / 2].i = 0.0;
+        deredden(fft, winlen / 2);
+    }
+    fftwf_destroy_plan(plan);
+    return ffts;
+}
+
+
+static void zap_window_birdies(fcomplex ** ffts, int numwins, double T,
+                               long long numbins, Cmdline * cmd)
+/* Zap the birdies in the FFTs of windows of duration 'T' */
+{
+    int ii, jj, numbirds;
+    double *bird_lobins, *bird_hibins;
+
+    numbirds = get_birdies(cmd->zaplist, T, cmd->baryv, &bird_lobins, &bird_hibins);
+    for (ii = 0; ii < numbirds; ii++) {
+        if (bird_lobins[ii] >= numbins)
+            break;
+        if (bird_hibins[ii] >= numbins)
+            bird_hibins[ii] = numbins - 1;
+        for (jj = 0; jj < numwins; jj++)
+            zapbirds(bird_lobins[ii], bird_hibins[ii], NULL, ffts[jj]);
+    }
+    vect_free(bird_lobins);
+    vect_free(bird_hibins);
+}
+
+
+static void window_to_full_props(fourierprops * props, double t0, double Tw,
+                                 double T)
+/* Convert 'props' from the search of the window of duration 'Tw' */
+/* starting at time 't0' into those of the full observation of    */
+/* duration 'T' (i.e. the average r, z, and w over the obs).      */
+{
+    double f, fd, fdd, r0, z0, w0, ratio = T / Tw;
+
+    /* The values at the start of the window... */
+    w0 = props->w;
+    z0 = props->z - 0.5 * w0;
+    r0 = props->r - 0.5 * z0 - w0 / 6.0;
+    f = r0 / Tw;
+    fd = z0 / (Tw * Tw);
+    fdd = w0 / (Tw * Tw * Tw);
+    /* ...and at the start of the observation */
+    f += -fd * t0 + 0.5 * fdd * t0 * t0;
+    fd += -fdd * t0;
+    r0 = f * T;
+    z0 = fd * T * T;
+    w0 = fdd * T * T * T;
+    props->w = w0;
+    props->z = z0 + 0.5 * w0;
+    props->r = r0 + 0.5 * z0 + w0 / 6.0;
+    props->rerr *= ratio;
+    props->zerr *= ratio * ratio;
+    props->werr *= ratio * ratio * ratio;
+}
+
+
+static int same_accelwincand(accelwincand * a, accelwincand * b)
+/* Return 1 if 'b' is (very likely) the same signal as 'a' */
+{
+    double dt = b->tmid - a->tmid, tol;
+
+    /* Allow for a frequency error of a bin in each window */
+    /* and that of the f-dot of 'a' propagated to 'b'.     */
+    tol = 1.0 / a->winlen + 1.0 / b->winlen + ACCEL_DZ * fabs(dt) / (a->winlen * a->winlen);
+    return (fabs(a->f + a->fd * dt - b->f) < tol);
+}
+
+
+static void output_window_cands(accelwincand * cands, int numcands,
+                                long long *winlens, int numlens,
+                                accelobs * obs, infodata * idata)
+/* Write the merged candidates to the text and binary output files */
+{
+    int ii;
+    FILE *outfile;
+    fourierprops *props;
+
+    outfile = chkfopen(obs->accelnm, "w");
+    fprintf(outfile, "# Windowed acceleration search of '%s'\n", obs->rootfilenm);
+    fprintf(outfile, "# N = %lld  dt = %.12g s  T = %.6g s  DM = %.3f\n",
+            obs->N, obs->dt, obs->T, idata->dm);
+    fprintf(outfile, "# Window lengths (s) =");
+    for (ii = 0; ii < numlens; ii++)
+        fprintf(outfile, " %.6g", winlens[ii] * obs->dt);
+    fprintf(outfile, "  (overlapping by half)\n");
+    fprintf(outfile, "# zmax = %.0f", obs->zhi);
+    if (obs->numw)
+        fprintf(outfile, "  wmax = %.0f", obs->whi);
+    fprintf(outfile, " (Fourier bins of each window)  sigma >= %.2f\n", obs->sigma);
+    fprintf(outfile, "# Freq and Fdot are at the middle of the best window.  'r', 'z'%s are\n",
+            obs->numw ? ", and 'w'" : "");
+    fprintf(outfile, "# those of the full observation (as in the '.cand' file).  Start, End,\n");
+    fprintf(outfile, "# First, and Last are fractions of the observation for the best window\n");
+    fprintf(outfile, "# and for all of the windows with detections.\n");
+    fprintf(outfile, "#\n");
+    fprintf(outfile, "#%4s %6s %8s %4s %14s %14s %12s %15s %11s", "Cand", "Sigma",
+            "CohPow", "Harm", "Period(ms)", "Freq(Hz)", "Fdot(Hz/s)", "r(bin)", "z(bins)");
+    if (obs->numw)
+        fprintf(outfile, " %11s", "w(bins)");
+    fprintf(outfile, " %9s %6s %6s %4s %6s %6s\n", "Win(s)", "Start", "End", "Wins",
+            "First", "Last");
+    for (ii = 0; ii < numcands; ii++) {
+        accelwincand *cand = cands + ii;
+
+        fprintf(outfile, "%5d %6.2f %8.2f %4d %14.8f %14.8f %12.4e %15.3f %11.2f",
+                ii + 1, cand->sigma, cand->props.pow, cand->numharm,
+                1000.0 / cand->f, cand->f, cand->fd, cand->props.r, cand->props.z);
+        if (obs->numw)
+            fprintf(outfile, " %11.2f", cand->props.w);
+        fprintf(outfile, " %9.2f %6.4f %6.4f %4d %6.4f %6.4f\n", cand->winlen,
+                cand->start, cand->end, cand->numwins, cand->first, cand->last);
+    }
+    fclose(outfile);
+
+    /* Write the fundamental fourierprops to the cand file */
+    props = (fourierprops *) malloc(sizeof(fourierprops) * (numcands ? numcands : 1));
+    for (ii = 0; ii < numcands; ii++)
+        props[ii] = cands[ii].props;
+    outfile = chkfopen(obs->candnm, "wb");
+    chkfwrite(props, sizeof(fourierprops), numcands, outfile);
+    fclose(outfile);
+    free(props);
+}
+
+
+int accel_windows_search(accelobs * obs, infodata * idata, Cmdline * cmd)
+/* Search the windows of the time series of 'obs', and merge and */
+/* write out the candidates.  Return the number of candidates.   */
+{
+    int ii, jj, numlens, numwins, numdets = 0, maxdets = WINCHUNK, numcands = 0;
+    long long numdata = 2 * obs->numbins, winlens[32];
+    accelobs winobs;
+    subharminfo **shis = NULL;
+    accelwincand *dets, *cands;
+
+    /* The window lengths (in points) */
+    winlens[0] = 2 * (long long) (obs->winlen / obs->dt / 2);
+    if (winlens[0] < 1000) {
+        printf("\nThe windows (%lld points) are too short.  Use a larger '-winlen'.\n\n",
+               winlens[0]);
+        exit(0);
+    }
+    if (winlens[0] >= numdata) {
+        printf("\nThe windows (%lld points) are not shorter than the observation.\n",
+               winlens[0]);
+        printf("   Use a smaller '-winlen'.\n\n");
+        exit(0);
+    }
+    for (numlens = 1; numlens < obs->numwinlens; numlens++) {
+        winlens[numlens] = 2 * winlens[numlens - 1];
+        if (winlens[numlens] >= numdata) {
+            /* The longest "window" is the full observation */
+            winlens[numlens++] = numdata;
+            break;
+        }
+    }
+
+    dets = (accelwincand *) malloc(sizeof(accelwincand) * maxdets);
+    for (ii = 0; ii < numlens; ii++) {
+        long long *starts;
+        double Tw = winlens[ii] * obs->dt;
+        fcomplex **ffts;
+
+        starts = window_starts(winlens[ii], numdata, &numwins);
+        printf("\nSearching %d windows of %.2f s (%lld points):\n",
+               numwins, Tw, winlens[ii]);
+        ffts = fft_windows(obs, winlens[ii], starts, numwins);
+        if (cmd->zaplistP)
+            zap_window_birdies(ffts, numwins, Tw, winlens[ii] / 2, cmd);
+
+        /* The search parameters of the windows of this length */
+        winobs = *obs;
+        winobs.N = winlens[ii];
+        winobs.numbins = winlens[ii] / 2;
+        winobs.lobin = 0;
+        winobs.T = Tw;
+        winobs.numwinlens = 0;
+        winobs.tseries = NULL;
+        winobs.rlo = floor(obs->rlo * Tw / obs->T);
+        if (winobs.rlo < 1.0)
+            winobs.rlo = 1.0;
+        winobs.highestbin = ceil(obs->highestbin * Tw / obs->T);
+        if (winobs.highestbin > winobs.numbins - 1)
+            winobs.highestbin = winobs.numbins - 1;
+        winobs.rhi = winobs.highestbin;
+        calc_accel_powcuts(&winobs, numlens * (double) numdata / winlens[ii]);
+
+        /* The kernels don't depend on the length of the window */
+        if (!shis) {
+            printf("\nGenerating correlation kernels:\n");
+            shis = create_subharminfos(&winobs);
+            printf("Done generating kernels.\n");
+        }
+
+        for (jj = 0; jj < numwins; jj++) {
+            int kk, numwincands;
+            double t0 = starts[jj] * obs->dt;
+            GSList *list, *listptr;
+
+            printf("\nWindow %d of %d (starting at %.2f s):\n", jj + 1, numwins, t0);
+            winobs.fft = ffts[jj];
+            if (winobs.nph > 0.0) {
+                winobs.nph = ffts[jj][0].r;
+            } else {
+                ffts[jj][0].r = 1.0;
+                ffts[jj][0].i = 1.0;
+            }
+            list = search_accelobs(&winobs, shis, cmd, NULL);
+            numwincands = g_slist_length(list);
+            if (numwincands) {
+                list = sort_accelcands(list);
+                if ((cmd->numharm > 1) && !(cmd->noharmremoveP))
+                    eliminate_harmonics(list, &numwincands);
+            }
+
+            /* Optimize the candidates and save them in full-obs units */
+            listptr = list;
+            for (kk = 0; kk < numwincands; kk++) {
+                accelcand *cand = (accelcand *) (listptr->data);
+                accelwincand *det;
+
+                optimize_accelcand(cand, &winobs);
+                if (numdets == maxdets) {
+                    maxdets += WINCHUNK;
+                    dets = (accelwincand *) realloc(dets, sizeof(accelwincand) * maxdets);
+                }
+                det = dets + numdets++;
+                calc_props(cand->derivs[0], cand->r, cand->z, cand->w, &det->props);
+                det->props.rerr = (float) (ACCEL_DR) / cand->numharm;
+                det->props.zerr = (float) (ACCEL_DZ) / cand->numharm;
+                det->props.werr = (float) (ACCEL_DW) / cand->numharm;
+                det->f = det->props.r / Tw;
+                det->fd = det->props.z / (Tw * Tw);
+                window_to_full_props(&det->props, t0, Tw, obs->T);
+                det->sigma = cand->sigma;
+                det->numharm = cand->numharm;
+                det->numwins = 1;
+                det->tmid = t0 + 0.5 * Tw;
+                det->winlen = Tw;
+                det->start = det->first = starts[jj] / (double) numdata;
+                det->end = det->last = (starts[jj] + winlens[ii]) / (double) numdata;
+                listptr = listptr->next;
+            }
+            g_slist_foreach(list, free_accelcand, NULL);
+            g_slist_free(list);
+        }
+        printf("\n");
+
+        for (jj = 0; jj < numwins; jj++)
+            vect_free((float *) ffts[jj] - ACCEL_PADDING);
+        free(ffts);
+        free(starts);
+        free(winobs.powcut);
+        free(winobs.numindep);
+    }
+    free_subharminfos(&winobs, shis);
+
+    /* Merge the detections of the same signals in different windows */
+    qsort(dets, numdets, sizeof(accelwincand), compare_accelwincand_sigma);
+    cands = (accelwincand *) malloc(sizeof(accelwincand) * (numdets ? numdets : 1));
+    for (ii = 0; ii < numdets; ii++) {
+        for (jj = 0; jj < numcands; jj++)
+            if (same_accelwincand(cands + jj, dets + ii))
+                break;
+        if (jj == numcands) {
+            cands[numcands++] = dets[ii];
+        } else {
+            cands[jj].numwins++;
+            if (dets[ii].first < cands[jj].first)
+                cands[jj].first = dets[ii].first;
+            if (dets[ii].last > cands[jj].last)
+                cands[jj].last = dets[ii].last;
+        }
+    }
+    free(dets);
+
+    /* The trials of all of the window lengths */
+    for (ii = 0; ii < obs->numharmstages; ii++)
+        obs->numindep[ii] *= numlens;
+
+    printf("\nDone searching.  Found %d candidates (from %d detections).\n\n",
+           numcands, numdets);
+    if (numcands)
+        output_window_cands(cands, numcands, winlens, numlens, obs, idata);
+    else
+        printf("No candidates above sigma = %.2f were found.\n\n", obs->sigma);
+    free(cands);
+    return numcands;
+}
+
+#undef WINCHUNK
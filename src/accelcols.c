@@ -0,0 +1,152 @@
+#include "presto.h"
+#include "accelcols.h"
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+
+/* Reading and writing the columnar binary candidate files.  See */
+/* accelcols.h for the format.                                   */
+
+static size_t accelcol_size(int type)
+/* Return the size in bytes of a value of 'type' or 0 if unknown */
+{
+    switch (type) {
+    case ACCELCOL_INT32:
+    case ACCELCOL_FLOAT32:
+        return 4;
+    case ACCELCOL_INT64:
+    case ACCELCOL_FLOAT64:
+        return 8;
+    }
+    return 0;
+}
+
+
+void write_accelcols(char *filenm, accelcols_header * hdr,
+                     accelcol_desc * cols, void **data)
+/* Write a columnar candidate file.  'hdr' must have everything but */
+/* the magic, version, and byteorder set.  'cols' has the names,     */
+/* types, and lengths of the hdr->numcols columns (the offsets are   */
+/* computed) and 'data' has pointers to the values of each column.   */
+{
+    int ii;
+    long long offset, colbytes;
+    char zeros[8] = { 0, 0, 0, 0, 0, 0, 0, 0 };
+    FILE *outfile;
+
+    memcpy(hdr->magic, ACCELCOLS_MAGIC, sizeof(hdr->magic));
+    hdr->version = ACCELCOLS_VERSION;
+    hdr->byteorder = ACCELCOLS_BYTEORDER;
+    offset = sizeof(accelcols_header) + hdr->numcols * sizeof(accelcol_desc);
+    for (ii = 0; ii < hdr->numcols; ii++) {
+        if (accelcol_size(cols[ii].type) == 0)
+            presto_error(PRESTO_ERR_VALUE,
+                         "Unknown type (%d) for column '%s' in write_accelcols()",
+                         cols[ii].type, cols[ii].name);
+        cols[ii].reserved = 0;
+        cols[ii].offset = (offset + 7) / 8 * 8;
+        offset = cols[ii].offset + cols[ii].length * accelcol_size(cols[ii].type);
+    }
+
+    outfile = chkfopen(filenm, "wb");
+    chkfwrite(hdr, sizeof(accelcols_header), 1, outfile);
+    chkfwrite(cols, sizeof(accelcol_desc), hdr->numcols, outfile);
+    offset = sizeof(accelcols_header) + hdr->numcols * sizeof(accelcol_desc);
+    for (ii = 0; ii < hdr->numcols; ii++) {
+        if (cols[ii].offset > offset)
+            chkfwrite(zeros, 1, cols[ii].offset - offset, outfile);
+        colbytes = cols[ii].length * accelcol_size(cols[ii].type);
+        if (colbytes)
+            chkfwrite(data[ii], 1, colbytes, outfile);
+        offset = cols[ii].offset + colbytes;
+    }
+    fclose(outfile);
+}
+
+
+void read_accelcols(char *filenm, accelcols * ac)
+/* Memory-map the columnar candidate file 'filenm' into 'ac'. */
+{
+    int fd, ii;
+    struct stat buf;
+
+    fd = open(filenm, O_RDONLY);
+    if (fd == -1)
+        presto_perror(PRESTO_ERR_IO, "Unable to open '%s'", filenm);
+    if (fstat(fd, &buf) == -1) {
+        close(fd);
+        presto_perror(PRESTO_ERR_IO, "Unable to stat '%s'", filenm);
+    }
+    if (buf.st_size < (off_t) sizeof(accelcols_header)) {
+        close(fd);
+        presto_error(PRESTO_ERR_FORMAT,
+                     "'%s' is too short to be a columnar candidate file", filenm);
+    }
+    ac->maplen = buf.st_size;
+    ac->map = mmap(0, ac->maplen, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (ac->map == MAP_FAILED)
+        presto_perror(PRESTO_ERR_IO, "Unable to mmap() '%s'", filenm);
+    ac->hdr = (accelcols_header *) ac->map;
+    ac->cols = (accelcol_desc *) ((char *) ac->map + sizeof(accelcols_header));
+
+    /* Check that this is a file we can use in place */
+    if (memcmp(ac->hdr->magic, ACCELCOLS_MAGIC, sizeof(ac->hdr->magic)) != 0) {
+        free_accelcols(ac);
+        presto_error(PRESTO_ERR_FORMAT,
+                     "'%s' is not a columnar candidate file", filenm);
+    }
+    if (ac->hdr->byteorder != ACCELCOLS_BYTEORDER ||
+        ac->hdr->version != ACCELCOLS_VERSION) {
+        free_accelcols(ac);
+        presto_error(PRESTO_ERR_FORMAT,
+                     "'%s' has the wrong byte order or version", filenm);
+    }
+    if (ac->hdr->numcols < 0 || sizeof(accelcols_header) +
+        ac->hdr->numcols * sizeof(accelcol_desc) > ac->maplen) {
+        free_accelcols(ac);
+        presto_error(PRESTO_ERR_FORMAT, "'%s' is truncated", filenm);
+    }
+    for (ii = 0; ii < ac->hdr->numcols; ii++) {
+        size_t size = accelcol_size(ac->cols[ii].type);
+        if (size && (ac->cols[ii].offset % 8 || ac->cols[ii].length < 0 ||
+                     ac->cols[ii].offset + ac->cols[ii].length * size >
+                     ac->maplen)) {
+            free_accelcols(ac);
+            presto_error(PRESTO_ERR_FORMAT, "'%s' is truncated", filenm);
+        }
+    }
+}
+
+
+void *accelcols_column(accelcols * ac, char *name, accelcol_type type,
+                       long long *length)
+/* Return a pointer to the values of column 'name' (which must be of */
+/* 'type') of the mapped file 'ac', and its length in 'length'.      */
+/* Return NULL if there is no such column.                           */
+{
+    int ii;
+
+    *length = 0;
+    for (ii = 0; ii < ac->hdr->numcols; ii++) {
+        if (strncmp(ac->cols[ii].name, name, sizeof(ac->cols[ii].name)) == 0 &&
+            ac->cols[ii].type == (int) type) {
+            *length = ac->cols[ii].length;
+            return (char *) ac->map + ac->cols[ii].offset;
+        }
+    }
+    return NULL;
+}
+
+
+void free_accelcols(accelcols * ac)
+/* Unmap a file mapped with read_accelcols(). */
+{
+    munmap(ac->map, ac->maplen);
+    ac->map = NULL;
+    ac->hdr = NULL;
+    ac->cols = NULL;
+    ac->maplen = 0;
+}
@@ -30,10 +30,12 @@ static Cmdline cmd = {
     /* lobinP = */ 1,
     /* lobin = */ 0,
     /* lobinC = */ 1,
-  /***** -numharm: The number of harmonics to sum (power-of-two) */
+  /***** -numharm: The number of harmonics to sum (power-of-two unless -allharm) */
     /* numharmP = */ 1,
     /* numharm = */ 8,
     /* numharmC = */ 1,
+  /***** -allharm: Sum every number of harmonics from 1 to numharm, not just powers-of-two */
+    /* allharmP = */ 0,
   /***** -zmax: The max (+ and -) Fourier freq deriv to search */
     /* zmaxP = */ 1,
     /* zmax = */ 200,
@@ -42,6 +44,18 @@ static Cmdline cmd = {
     /* wmaxP = */ 0,
     /* wmax = */ (int) 0,
     /* wmaxC = */ 0,
+  /***** -numseg: Number of segments for a semi-coherent (StackSlide) search of a .[s]dat file */
+    /* numsegP = */ 1,
+    /* numseg = */ 1,
+    /* numsegC = */ 1,
+  /***** -winlen: Length (s) of the shortest time windows (overlapping by half) for a windowed search of a .[s]dat file */
+    /* winlenP = */ 0,
+    /* winlen = */ (double) 0,
+    /* winlenC = */ 0,
+  /***** -numwinlens: Number of window lengths for -winlen (each twice as long as the previous) */
+    /* numwinlensP = */ 1,
+    /* numwinlens = */ 1,
+    /* numwinlensC = */ 1,
   /***** -sigma: Cutoff sigma for choosing candidates */
     /* sigmaP = */ 1,
     /* sigma = */ 2.0,
@@ -64,6 +78,12 @@ static Cmdline cmd = {
     /* fhiC = */ 1,
   /***** -inmem: Compute full f-fdot plane in memory.  Very fast, but only for short time series. */
     /* inmemP = */ 0,
+  /***** -hier: Do a coarse-to-fine (hierarchical) search that only searches near coarse candidates at full resolution */
+    /* hierP = */ 0,
+  /***** -hierfrac: Coarse candidate cutoff for -hier (fraction of the signal power of the full cutoff).  Smaller is more sensitive but slower */
+    /* hierfracP = */ 1,
+    /* hierfrac = */ 0.6,
+    /* hierfracC = */ 1,
   /***** -photon: Data is poissonian so use freq 0 as power normalization */
     /* photonP = */ 0,
   /***** -median: Use block-median power normalization (default) */
@@ -78,6 +98,8 @@ static Cmdline cmd = {
     /* baryvP = */ 1,
     /* baryv = */ 0.0,
     /* baryvC = */ 1,
+  /***** -topo2bary: Also write barycentric versions of the candidates from a topocentric search */
+    /* topo2baryP = */ 0,
   /***** -otheropt: Use the alternative optimization (for testing/debugging) */
     /* otheroptP = */ 0,
   /***** -noharmpolish: Do not use 'harmpolish' by default */
@@ -838,7 +860,7 @@ void showOptionValues(void)
         }
     }
 
-  /***** -numharm: The number of harmonics to sum (power-of-two) */
+  /***** -numharm: The number of harmonics to sum (power-of-two unless -allharm) */
     if (!cmd.numharmP) {
         printf("-numharm not found.\n");
     } else {
@@ -850,6 +872,13 @@ void showOptionValues(void)
         }
     }
 
+  /***** -allharm: Sum every number of harmonics from 1 to numharm, not just powers-of-two */
+    if (!cmd.allharmP) {
+        printf("-allharm not found.\n");
+    } else {
+        printf("-allharm found:\n");
+    }
+
   /***** -zmax: The max (+ and -) Fourier freq deriv to search */
     if (!cmd.zmaxP) {
         printf("-zmax not found.\n");
@@ -874,6 +903,42 @@ void showOptionValues(void)
         }
     }
 
+  /***** -numseg: Number of segments for a semi-coherent (StackSlide) search of a .[s]dat file */
+    if (!cmd.numsegP) {
+        printf("-numseg not found.\n");
+    } else {
+        printf("-numseg found:\n");
+        if (!cmd.numsegC) {
+            printf("  no values\n");
+        } else {
+            printf("  value = `%d'\n", cmd.numseg);
+        }
+    }
+
+  /***** -winlen: Length (s) of the shortest time windows (overlapping by half) for a windowed search of a .[s]dat file */
+    if (!cmd.winlenP) {
+        printf("-winlen not found.\n");
+    } else {
+        printf("-winlen found:\n");
+        if (!cmd.winlenC) {
+            printf("  no values\n");
+        } else {
+            printf("  value = `%.40g'\n", cmd.winlen);
+        }
+    }
+
+  /***** -numwinlens: Number of window lengths for -winlen (each twice as long as the previous) */
+    if (!cmd.numwinlensP) {
+        printf("-numwinlens not found.\n");
+    } else {
+        printf("-numwinlens found:\n");
+        if (!cmd.numwinlensC) {
+            printf("  no values\n");
+        } else {
+            printf("  value = `%d'\n", cmd.numwinlens);
+        }
+    }
+
   /***** -sigma: Cutoff sigma for choosing candidates */
     if (!cmd.sigmaP) {
         printf("-sigma not found.\n");
@@ -941,6 +1006,25 @@ void showOptionValues(void)
         printf("-inmem found:\n");
     }
 
+  /***** -hier: Do a coarse-to-fine (hierarchical) search that only searches near coarse candidates at full resolution */
+    if (!cmd.hierP) {
+        printf("-hier not found.\n");
+    } else {
+        printf("-hier found:\n");
+    }
+
+  /***** -hierfrac: Coarse candidate cutoff for -hier (fraction of the signal power of the full cutoff).  Smaller is more sensitive but slower */
+    if (!cmd.hierfracP) {
+        printf("-hierfrac not found.\n");
+    } else {
+        printf("-hierfrac found:\n");
+        if (!cmd.hierfracC) {
+            printf("  no values\n");
+        } else {
+            printf("  value = `%.40g'\n", cmd.hierfrac);
+        }
+    }
+
   /***** -photon: Data is poissonian so use freq 0 as power normalization */
     if (!cmd.photonP) {
         printf("-photon not found.\n");
@@ -986,6 +1070,13 @@ void showOptionValues(void)
         }
     }
 
+  /***** -topo2bary: Also write barycentric versions of the candidates from a topocentric search */
+    if (!cmd.topo2baryP) {
+        printf("-topo2bary not found.\n");
+    } else {
+        printf("-topo2bary found:\n");
+    }
+
   /***** -otheropt: Use the alternative optimization (for testing/debugging) */
     if (!cmd.otheroptP) {
         printf("-otheropt not found.\n");
@@ -1022,7 +1113,7 @@ void showOptionValues(void)
 void usage(void)
 {
     fprintf(stderr, "%s",
-            "   [-ncpus ncpus] [-lobin lobin] [-numharm numharm] [-zmax zmax] [-wmax wmax] [-sigma sigma] [-rlo rlo] [-rhi rhi] [-flo flo] [-fhi fhi] [-inmem] [-photon] [-median] [-locpow] [-zaplist zaplist] [-baryv baryv] [-otheropt] [-noharmpolish] [-noharmremove] [--] infile ...\n");
+            "   [-ncpus ncpus] [-lobin lobin] [-numharm numharm] [-allharm] [-zmax zmax] [-wmax wmax] [-numseg numseg] [-winlen winlen] [-numwinlens numwinlens] [-sigma sigma] [-rlo rlo] [-rhi rhi] [-flo flo] [-fhi fhi] [-inmem] [-hier] [-hierfrac hierfrac] [-photon] [-median] [-locpow] [-zaplist zaplist] [-baryv baryv] [-topo2bary] [-otheropt] [-noharmpolish] [-noharmremove] [--] infile ...\n");
     fprintf(stderr, "%s",
             "      Search an FFT or short time series for pulsars using a Fourier domain acceleration search with harmonic summing.\n");
     fprintf(stderr, "%s",
@@ -1034,9 +1125,11 @@ void usage(void)
     fprintf(stderr, "%s", "                   1 int value between 0 and oo\n");
     fprintf(stderr, "%s", "                   default: `0'\n");
     fprintf(stderr, "%s",
-            "         -numharm: The number of harmonics to sum (power-of-two)\n");
-    fprintf(stderr, "%s", "                   1 int value between 1 and 32\n");
+            "         -numharm: The number of harmonics to sum (power-of-two unless -allharm)\n");
+    fprintf(stderr, "%s", "                   1 int value between 1 and 128\n");
     fprintf(stderr, "%s", "                   default: `8'\n");
+    fprintf(stderr, "%s",
+            "         -allharm: Sum every number of harmonics from 1 to numharm, not just powers-of-two\n");
     fprintf(stderr, "%s",
             "            -zmax: The max (+ and -) Fourier freq deriv to search\n");
     fprintf(stderr, "%s", "                   1 int value between 0 and 1200\n");
@@ -1044,6 +1137,17 @@ void usage(void)
     fprintf(stderr, "%s",
             "            -wmax: The max (+ and -) Fourier freq double derivs to search\n");
     fprintf(stderr, "%s", "                   1 int value between 0 and 4000\n");
+    fprintf(stderr, "%s",
+            "          -numseg: Number of segments for a semi-coherent (StackSlide) search of a .[s]dat file\n");
+    fprintf(stderr, "%s", "                   1 int value between 1 and 1024\n");
+    fprintf(stderr, "%s", "                   default: `1'\n");
+    fprintf(stderr, "%s",
+            "          -winlen: Length (s) of the shortest time windows (overlapping by half) for a windowed search of a .[s]dat file\n");
+    fprintf(stderr, "%s", "                   1 double value between 0.0 and oo\n");
+    fprintf(stderr, "%s",
+            "      -numwinlens: Number of window lengths for -winlen (each twice as long as the previous)\n");
+    fprintf(stderr, "%s", "                   1 int value between 1 and 16\n");
+    fprintf(stderr, "%s", "                   default: `1'\n");
     fprintf(stderr, "%s",
             "           -sigma: Cutoff sigma for choosing candidates\n");
     fprintf(stderr, "%s", "                   1 float value between 1.0 and 30.0\n");
@@ -1064,6 +1168,12 @@ void usage(void)
     fprintf(stderr, "%s", "                   default: `10000.0'\n");
     fprintf(stderr, "%s",
             "           -inmem: Compute full f-fdot plane in memory.  Very fast, but only for short time series.\n");
+    fprintf(stderr, "%s",
+            "            -hier: Do a coarse-to-fine (hierarchical) search that only searches near coarse candidates at full resolution\n");
+    fprintf(stderr, "%s",
+            "        -hierfrac: Coarse candidate cutoff for -hier (fraction of the signal power of the full cutoff).  Smaller is more sensitive but slower\n");
+    fprintf(stderr, "%s", "                   1 float value between 0.05 and 1.0\n");
+    fprintf(stderr, "%s", "                   default: `0.6'\n");
     fprintf(stderr, "%s",
             "          -photon: Data is poissonian so use freq 0 as power normalization\n");
     fprintf(stderr, "%s",
@@ -1078,6 +1188,8 @@ void usage(void)
     fprintf(stderr, "%s",
             "                   1 double value between -0.1 and 0.1\n");
     fprintf(stderr, "%s", "                   default: `0.0'\n");
+    fprintf(stderr, "%s",
+            "       -topo2bary: Also write barycentric versions of the candidates from a topocentric search\n");
     fprintf(stderr, "%s",
             "        -otheropt: Use the alternative optimization (for testing/debugging)\n");
     fprintf(stderr, "%s", "    -noharmpolish: Do not use 'harmpolish' by default\n");
@@ -1128,11 +1240,16 @@ Cmdline *parseCmdline(int argc, char **argv)
             cmd.numharmP = 1;
             i = getIntOpt(argc, argv, i, &cmd.numharm, 1);
             cmd.numharmC = i - keep;
-            checkIntLower("-numharm", &cmd.numharm, cmd.numharmC, 32);
+            checkIntLower("-numharm", &cmd.numharm, cmd.numharmC, 128);
             checkIntHigher("-numharm", &cmd.numharm, cmd.numharmC, 1);
             continue;
         }
 
+        if (0 == strcmp("-allharm", argv[i])) {
+            cmd.allharmP = 1;
+            continue;
+        }
+
         if (0 == strcmp("-zmax", argv[i])) {
             int keep = i;
             cmd.zmaxP = 1;
@@ -1153,6 +1270,35 @@ Cmdline *parseCmdline(int argc, char **argv)
             continue;
         }
 
+        if (0 == strcmp("-numseg", argv[i])) {
+            int keep = i;
+            cmd.numsegP = 1;
+            i = getIntOpt(argc, argv, i, &cmd.numseg, 1);
+            cmd.numsegC = i - keep;
+            checkIntLower("-numseg", &cmd.numseg, cmd.numsegC, 1024);
+            checkIntHigher("-numseg", &cmd.numseg, cmd.numsegC, 1);
+            continue;
+        }
+
+        if (0 == strcmp("-winlen", argv[i])) {
+            int keep = i;
+            cmd.winlenP = 1;
+            i = getDoubleOpt(argc, argv, i, &cmd.winlen, 1);
+            cmd.winlenC = i - keep;
+            checkDoubleHigher("-winlen", &cmd.winlen, cmd.winlenC, 0.0);
+            continue;
+        }
+
+        if (0 == strcmp("-numwinlens", argv[i])) {
+            int keep = i;
+            cmd.numwinlensP = 1;
+            i = getIntOpt(argc, argv, i, &cmd.numwinlens, 1);
+            cmd.numwinlensC = i - keep;
+            checkIntLower("-numwinlens", &cmd.numwinlens, cmd.numwinlensC, 16);
+            checkIntHigher("-numwinlens", &cmd.numwinlens, cmd.numwinlensC, 1);
+            continue;
+        }
+
         if (0 == strcmp("-sigma", argv[i])) {
             int keep = i;
             cmd.sigmaP = 1;
@@ -1204,6 +1350,21 @@ Cmdline *parseCmdline(int argc, char **argv)
             continue;
         }
 
+        if (0 == strcmp("-hier", argv[i])) {
+            cmd.hierP = 1;
+            continue;
+        }
+
+        if (0 == strcmp("-hierfrac", argv[i])) {
+            int keep = i;
+            cmd.hierfracP = 1;
+            i = getFloatOpt(argc, argv, i, &cmd.hierfrac, 1);
+            cmd.hierfracC = i - keep;
+            checkFloatLower("-hierfrac", &cmd.hierfrac, cmd.hierfracC, 1.0);
+            checkFloatHigher("-hierfrac", &cmd.hierfrac, cmd.hierfracC, 0.05);
+            continue;
+        }
+
         if (0 == strcmp("-photon", argv[i])) {
             cmd.photonP = 1;
             continue;
@@ -1237,6 +1398,11 @@ Cmdline *parseCmdline(int argc, char **argv)
             continue;
         }
 
+        if (0 == strcmp("-topo2bary", argv[i])) {
+            cmd.topo2baryP = 1;
+            continue;
+        }
+
         if (0 == strcmp("-otheropt", argv[i])) {
             cmd.otheroptP = 1;
             continue;
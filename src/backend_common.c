@@ -23,6 +23,10 @@ extern short transpose_float(float *a, int nx, int ny, unsigned char *move,
 extern double DATEOBS_to_MJD(char *dateobs, int *mjd_day, double *mjd_fracday);
 extern void read_filterbank_files(struct spectra_info *s);
 extern void read_PSRFITS_files(struct spectra_info *s);
+extern void read_baseband_files(struct spectra_info *s);
+extern void read_shmring_files(struct spectra_info *s);
+extern void close_shmring_files(struct spectra_info *s);
+extern fitsfile *get_PSRFITS_fitsfile(struct spectra_info *s, int filenum);
 extern fftwf_plan plan_transpose(int rows, int cols, float *in, float *out);
 extern int *ranges_to_ivect(char *str, int minval, int maxval, int *numvals);
 
@@ -48,6 +52,10 @@ void psrdatatype_description(char *outstr, psrdatatype ptype)
         strcpy(outstr, "PRESTO time series of shorts");
     else if (ptype == EVENTS)
         strcpy(outstr, "Event list");
+    else if (ptype == BASEBAND)
+        strcpy(outstr, "DADA baseband");
+    else if (ptype == SHMRING)
+        strcpy(outstr, "Shared-memory ring of SIGPROC filterbank");
     else
         strcpy(outstr, "Unknown");
     return;
@@ -64,8 +72,11 @@ void close_rawfiles(struct spectra_info *s)
     if (s->datatype == PSRFITS) {
         int status = 0;
         for (ii = 0; ii < s->num_files; ii++)
-            fits_close_file(s->fitsfiles[ii], &status);
+            if (s->fitsfiles[ii] != NULL)
+                fits_close_file(s->fitsfiles[ii], &status);
         free(s->fitsfiles);
+    } else if (s->datatype == SHMRING) {
+        close_shmring_files(s);
     } else {
         for (ii = 0; ii < s->num_files; ii++)
             fclose(s->files[ii]);
@@ -73,20 +84,131 @@ void close_rawfiles(struct spectra_info *s)
     }
 }
 
+// When time or frequency scrunching is requested, the backend readers
+// keep working at their native resolution on this copy of the
+// spectra_info, while the tools only ever see the scrunched data.
+static struct spectra_info rawspec;
+static float *rawscrunchbuf = NULL;
+
+static int get_scrunched_rawblock(float *fdata, struct spectra_info *s, int *padding)
+// Read a native resolution block of raw data and sum it down by
+// s->tscrunch spectra and s->fscrunch channels.  This is done right
+// after the samples are unpacked, so all of the masking, clipping,
+// and dedispersion only has to deal with the scrunched data.
+{
+    int ii, tt = s->tscrunch, ff = s->fscrunch;
+    int rawnchan = rawspec.num_channels;
+    float padscale = 1.0 / (tt * ff);
+
+    // The padding values are set (e.g. from a mask) at the scrunched
+    // resolution, so spread them back out for the reader
+    for (ii = 0; ii < rawnchan; ii++)
+        rawspec.padvals[ii] = s->padvals[ii / ff] * padscale;
+    if (!rawspec.get_rawblock(rawscrunchbuf, &rawspec, padding))
+        return 0;
+    // For the usual integer samples, these float sums are exact (up
+    // to 2^24) and so identical to summing before the conversion
+#ifdef _OPENMP
+#pragma omp parallel for default(none) shared(fdata,rawscrunchbuf,s,rawnchan,tt,ff)
+#endif
+    for (ii = 0; ii < s->spectra_per_subint; ii++) {
+        int jj, kk;
+        float *acc = rawscrunchbuf + (long long) ii * tt * rawnchan;
+        float *out = fdata + (long long) ii * s->num_channels;
+        // Co-add the spectra in time (into the first of them)...
+        for (jj = 1; jj < tt; jj++) {
+            float *spec = acc + jj * rawnchan;
+            for (kk = 0; kk < rawnchan; kk++)
+                acc[kk] += spec[kk];
+        }
+        // ...and then the neighboring channels
+        for (kk = 0; kk < s->num_channels; kk++) {
+            float sum = 0.0, *chans = acc + kk * ff;
+            for (jj = 0; jj < ff; jj++)
+                sum += chans[jj];
+            out[kk] = sum;
+        }
+    }
+    return 1;
+}
+
+
+static long long offset_to_scrunched_spectra(long long specnum,
+                                             struct spectra_info *s)
+{
+    return rawspec.offset_to_spectra(specnum * s->tscrunch, &rawspec) / s->tscrunch;
+}
+
+
+static void scrunch_spectra_info(struct spectra_info *s)
+// Change 's' so that it describes the data after scrunching by
+// s->tscrunch spectra and s->fscrunch channels, and hook up the
+// routines that read and scrunch the native resolution data.
+{
+    int ii, tt = s->tscrunch, ff = s->fscrunch;
+
+    if (s->num_channels % ff)
+        presto_error(PRESTO_ERR_VALUE,
+                     "the frequency scrunch factor (%d) must evenly divide\n"
+                     "\tthe number of channels (%d)", ff, s->num_channels);
+    if (s->spectra_per_subint % tt)
+        presto_error(PRESTO_ERR_VALUE,
+                     "the time scrunch factor (%d) must evenly divide\n"
+                     "\tthe number of spectra per subint (%d)",
+                     tt, s->spectra_per_subint);
+    rawspec = *s;
+    // Needs to be twice as large for buffering if adding observations together
+    rawscrunchbuf = gen_fvect(2L * rawspec.spectra_per_subint * rawspec.num_channels);
+
+    s->num_channels /= ff;
+    s->samples_per_spectra = s->num_channels;
+    s->df *= ff;
+    s->lo_freq += 0.5 * (ff - 1) * rawspec.df;
+    s->hi_freq -= 0.5 * (ff - 1) * rawspec.df;
+    s->spectra_per_subint /= tt;
+    s->samples_per_subint = s->spectra_per_subint * s->num_channels;
+    s->dt *= tt;
+    s->N /= tt;
+    s->T = s->N * s->dt;
+    s->start_spec = (long long *) malloc(sizeof(long long) * s->num_files);
+    s->num_spec = (long long *) malloc(sizeof(long long) * s->num_files);
+    s->num_pad = (long long *) malloc(sizeof(long long) * s->num_files);
+    for (ii = 0; ii < s->num_files; ii++) {
+        long long endspec = rawspec.start_spec[ii] + rawspec.num_spec[ii];
+        s->start_spec[ii] = rawspec.start_spec[ii] / tt;
+        s->num_spec[ii] = endspec / tt - s->start_spec[ii];
+        s->num_pad[ii] = (endspec + rawspec.num_pad[ii]) / tt - endspec / tt;
+    }
+    s->padvals = gen_fvect(s->num_channels);
+    for (ii = 0; ii < s->num_channels; ii++) {
+        int jj;
+        s->padvals[ii] = 0.0;
+        for (jj = 0; jj < ff; jj++)
+            s->padvals[ii] += rawspec.padvals[ii * ff + jj];
+        s->padvals[ii] *= tt;
+    }
+    s->get_rawblock = &get_scrunched_rawblock;
+    s->offset_to_spectra = &offset_to_scrunched_spectra;
+}
+
+
 void read_rawdata_files(struct spectra_info *s)
 {
     if (s->datatype == SIGPROCFB)
         read_filterbank_files(s);
     else if (s->datatype == PSRFITS)
         read_PSRFITS_files(s);
-    else if (s->datatype == SCAMP)
-        exit(1);
-    else if (s->datatype == BPP)
-        exit(1);
-    else if (s->datatype == WAPP)
-        exit(1);
-    else if (s->datatype == SPIGOT)
-        exit(1);
+    else if (s->datatype == BASEBAND)
+        read_baseband_files(s);
+    else if (s->datatype == SHMRING)
+        read_shmring_files(s);
+    else if (s->datatype == SCAMP || s->datatype == BPP ||
+             s->datatype == WAPP || s->datatype == SPIGOT)
+        presto_error(PRESTO_ERR_FORMAT,
+                     "Unsupported raw data type (%d) in read_rawdata_files()",
+                     s->datatype);
+    if (s->tscrunch > 1 || s->fscrunch > 1)
+        scrunch_spectra_info(s);
     return;
 }
 
@@ -104,10 +226,9 @@ void identify_psrdatatype(struct spectra_info *s, int output)
 
     /* Split the filename into a rootname and a suffix */
     if (split_root_suffix(s->filenames[0], &root, &suffix) == 0) {
-        fprintf(stderr,
-                "Error!:  The input filename (%s) must have a suffix!",
-                s->filenames[0]);
-        exit(-1);
+        presto_error(PRESTO_ERR_VALUE,
+                     "The input filename (%s) must have a suffix!",
+                     s->filenames[0]);
     } else {
         if (strcmp(suffix, "dat") == 0)
             s->datatype = DAT;
@@ -121,6 +242,10 @@ void identify_psrdatatype(struct spectra_info *s, int output)
             s->datatype = BPP;
         else if (strcmp(suffix, "fil") == 0 || strcmp(suffix, "fb") == 0)
             s->datatype = SIGPROCFB;
+        else if (strcmp(suffix, "dada") == 0)
+            s->datatype = BASEBAND;
+        else if (strcmp(suffix, "shmring") == 0)
+            s->datatype = SHMRING;
         else if ((strcmp(suffix, "fits") == 0) || (strcmp(suffix, "sf") == 0)) {
             if (strstr(root, "spigot_5") != NULL)
                 s->datatype = SPIGOT;
@@ -202,6 +327,8 @@ void spectra_info_set_defaults(struct spectra_info *s)
     s->use_poln = 0;
     s->flip_bytes = 0;
     s->num_ignorechans = 0;
+    s->tscrunch = 1;
+    s->fscrunch = 1;
     s->zero_offset = 0.0;
     s->clip_sigma = 0.0;
     s->start_MJD = NULL;
@@ -273,6 +400,8 @@ void print_spectra_info(struct spectra_info *s)
     printf("         High channel (MHz) = %-17.15g\n", s->hi_freq);
     printf("        Channel width (MHz) = %-17.15g\n", s->df);
     printf("         Number of channels = %d\n", s->num_channels);
+    if (s->tscrunch > 1 || s->fscrunch > 1)
+        printf("      Scrunch (time x freq) = %d x %d\n", s->tscrunch, s->fscrunch);
     if (s->chan_dm != 0.0) {
         printf("   Orig Channel width (MHz) = %-17.15g\n", s->orig_df);
         printf("    Orig Number of channels = %d\n", s->orig_num_chan);
@@ -311,15 +440,17 @@ void print_spectra_info(struct spectra_info *s)
     if (s->datatype == PSRFITS) {
         int ii, numhdus, hdutype, status = 0;
         char comment[120];
+        fitsfile *fptr = get_PSRFITS_fitsfile(s, 0);
         printf("  PSRFITS Specific info:\n");
-        fits_get_num_hdus(s->fitsfiles[0], &numhdus, &status);
+        fits_get_num_hdus(fptr, &numhdus, &status);
         printf("                       HDUs = primary, ");
         for (ii = 2; ii < numhdus + 1; ii++) {
-            fits_movabs_hdu(s->fitsfiles[0], ii, &hdutype, &status);
-            fits_read_key(s->fitsfiles[0], TSTRING, "EXTNAME", ctmp, comment,
-                          &status);
+            fits_movabs_hdu(fptr, ii, &hdutype, &status);
+            fits_read_key(fptr, TSTRING, "EXTNAME", ctmp, comment, &status);
             printf("%s%s", ctmp, (ii < numhdus) ? ", " : "\n");
         }
+        // Go back to the SUBINT HDU for reading the data
+        fits_movnam_hdu(fptr, BINARY_TBL, "SUBINT", 0, &status);
         printf("              FITS typecode = %d\n", s->FITS_typecode);
         printf("                DATA column = %d\n", s->data_col);
         printf("             Apply scaling? = %s\n",
@@ -355,6 +486,8 @@ void print_spectra_info_summary(struct spectra_info *s)
     printf("   Invert the band? = %s\n", (s->apply_flipband > 0) ? "True" : "False");
     printf("          Byteswap? = %s\n", s->flip_bytes ? "True" : "False");
     printf("     Remove zeroDM? = %s\n", s->remove_zerodm ? "True" : "False");
+    if (s->tscrunch > 1 || s->fscrunch > 1)
+        printf("    Scrunch (t x f) = %d x %d\n", s->tscrunch, s->fscrunch);
     if (s->datatype == PSRFITS) {
         printf("     Apply scaling? = %s\n", s->apply_scale ? "True" : "False");
         printf("     Apply offsets? = %s\n", s->apply_offset ? "True" : "False");
@@ -532,10 +665,9 @@ int read_psrdata(float *fdata, int numspect, struct spectra_info *s,
     *nummasked = 0;
     if (firsttime) {
         if (numspect % s->spectra_per_subint) {
-            fprintf(stderr,
-                    "Error!:  numspect %d must be a multiple of %d in read_psrdata()!\n",
-                    numspect, s->spectra_per_subint);
-            exit(-1);
+            presto_error(PRESTO_ERR_VALUE,
+                         "numspect %d must be a multiple of %d in read_psrdata()!",
+                         numspect, s->spectra_per_subint);
         } else
             numsubints = numspect / s->spectra_per_subint;
         if (obsmask->numchan)
@@ -635,9 +767,8 @@ void get_channel(float chandat[], int channum, int numsubints, float rawdata[],
     long long ii, jj, numspec = numsubints * s->spectra_per_subint;
 
     if (channum > s->num_channels || channum < 0) {
-        fprintf(stderr, "Error!: channum = %d is out of range in get_channel()!\n",
-                channum);
-        exit(-1);
+        presto_error(PRESTO_ERR_VALUE,
+                     "channum = %d is out of range in get_channel()!", channum);
     }
     /* Check to see if we are explicitly zeroing this channel */
     if (s->num_ignorechans) {
@@ -781,20 +912,20 @@ int read_subbands(float *fdata, int *delays, int numsubbands,
         // Check to make sure there isn't more dispersion across a
         // subband than time in a block of data
         if (delays[0] > s->spectra_per_subint) {
-            perror("\nError: there is more dispersion across a subband than time\n"
-                   "in a block of data.  Increase spectra_per_subint if possible.");
-            exit(-1);
+            presto_error(PRESTO_ERR_VALUE,
+                         "there is more dispersion across a subband than time\n"
+                         "in a block of data.  Increase spectra_per_subint if possible.");
         }
         // Needs to be twice as large for buffering if adding observations together
         frawdata = gen_fvect(2 * s->num_channels * s->spectra_per_subint);
         if (!s->get_rawblock(frawdata, s, padding)) {
-            perror("Error: problem reading the raw data file in read_subbands()");
-            exit(-1);
+            presto_error(PRESTO_ERR_IO,
+                         "problem reading the raw data file in read_subbands()");
         }
         if (0 != prep_subbands(fdata, frawdata, delays, numsubbands, s,
                                transpose, maskchans, nummasked, obsmask)) {
-            perror("Error: problem initializing prep_subbands() in read_subbands()");
-            exit(-1);
+            presto_error(PRESTO_ERR_VALUE,
+                         "problem initializing prep_subbands() in read_subbands()");
         }
         firsttime = 0;
     }
@@ -863,21 +994,16 @@ int *get_ignorechans(char *ignorechans_str, int minchan, int maxchan,
                     break;
                 } else {
                     if (feof(file)) {
-                        sprintf(*filestr,
-                                "Error:  end-of-file while looking for range string in get_ignorechans()\n");
-                        perror(*filestr);
-                        exit(EXIT_FAILURE);
+                        presto_error(PRESTO_ERR_EOF,
+                                     "end-of-file while looking for range string in get_ignorechans()");
                     }
                 }
             } while (1);
             
         } else {
-            parsestr = (char *) malloc(1000);
-            sprintf(parsestr,
-                    "Error:  '%s' is a file, but too big to parse in get_ignorechans()\n",
-                    ignorechans_str);
-            perror(parsestr);
-            exit(EXIT_FAILURE);
+            presto_error(PRESTO_ERR_VALUE,
+                         "'%s' is a file, but too big to parse in get_ignorechans()",
+                         ignorechans_str);
         }
     } else {
         // Input string name is not a file, so we will parse it directly
@@ -250,3 +250,103 @@ void barycenter(double *topotimes, double *barytimes,
     free(origdir);
     rmdir(tmpdir);
 }
+
+
+void doppler_derivs(double *topotimes, double *voverc, long N, double T,
+                    double *derivs)
+/* Fit the Doppler factor B = d(t_bary)/d(t_topo) = 1/(1+voverc)  */
+/* of the observatory motion during an observation of length 'T'  */
+/* (s) with a cubic.  'topotimes' (MJD) and 'voverc' are 'N'      */
+/* (>= 4) values from barycenter() spanning the observation, with */
+/* topotimes[0] at its start.  Return B, dB/dt, and d^2B/dt^2 at  */
+/* the topocentric middle of the observation in derivs[0-2], and  */
+/* the barycentric time (s) from its start to its middle in       */
+/* derivs[3].                                                     */
+{
+    int ii, jj, kk;
+    long nn;
+    double x, xpow[7], ata[4][4], atb[4], coefs[4], tmp, tempzz;
+
+    if (N < 4)
+        presto_error(PRESTO_ERR_VALUE,
+                     "doppler_derivs() needs at least 4 points (got %ld)", N);
+    /* Normal equations for a cubic in x = 2 t / T - 1 (i.e. -1 to 1) */
+    for (ii = 0; ii < 4; ii++) {
+        atb[ii] = 0.0;
+        for (jj = 0; jj < 4; jj++)
+            ata[ii][jj] = 0.0;
+    }
+    for (nn = 0; nn < N; nn++) {
+        x = 2.0 * (topotimes[nn] - topotimes[0]) * SECPERDAY / T - 1.0;
+        xpow[0] = 1.0;
+        for (ii = 1; ii < 7; ii++)
+            xpow[ii] = xpow[ii - 1] * x;
+        for (ii = 0; ii < 4; ii++) {
+            atb[ii] += xpow[ii] / (1.0 + voverc[nn]);
+            for (jj = 0; jj < 4; jj++)
+                ata[ii][jj] += xpow[ii + jj];
+        }
+    }
+    /* Solve them using Gaussian elimination with partial pivoting */
+    for (ii = 0; ii < 4; ii++) {
+        kk = ii;
+        for (jj = ii + 1; jj < 4; jj++)
+            if (fabs(ata[jj][ii]) > fabs(ata[kk][ii]))
+                kk = jj;
+        for (jj = 0; jj < 4; jj++) {
+            SWAP(ata[ii][jj], ata[kk][jj]);
+        }
+        SWAP(atb[ii], atb[kk]);
+        for (jj = ii + 1; jj < 4; jj++) {
+            tmp = ata[jj][ii] / ata[ii][ii];
+            for (kk = ii; kk < 4; kk++)
+                ata[jj][kk] -= tmp * ata[ii][kk];
+            atb[jj] -= tmp * atb[ii];
+        }
+    }
+    for (ii = 3; ii >= 0; ii--) {
+        tmp = atb[ii];
+        for (jj = ii + 1; jj < 4; jj++)
+            tmp -= ata[ii][jj] * coefs[jj];
+        coefs[ii] = tmp / ata[ii][ii];
+    }
+    /* The derivatives at the middle (x = 0) */
+    derivs[0] = coefs[0];
+    derivs[1] = coefs[1] * (2.0 / T);
+    derivs[2] = 2.0 * coefs[2] * (2.0 / T) * (2.0 / T);
+    /* Integrate B from the start to the middle (x = -1 to 0) */
+    derivs[3] = 0.5 * T * (coefs[0] - coefs[1] / 2.0 + coefs[2] / 3.0 - coefs[3] / 4.0);
+}
+
+
+void topo2bary_rzw(double *derivs, double T, double rt, double zt, double wt,
+                   double *rb, double *zb, double *wb)
+/* Convert the topocentric Fourier frequency 'rt', f-dot 'zt', and  */
+/* f-dot-dot 'wt' of a candidate (the averages over an observation  */
+/* of length 'T' s, as from accelsearch) into barycentric ones,     */
+/* including the f-dot and f-dot-dot that the changing Doppler      */
+/* shift induces.  'derivs' are from doppler_derivs().  The results */
+/* describe the barycentric spin starting at the barycentric time   */
+/* of the start of the observation, in units of the same 'T', so    */
+/* they can be used like the topocentric values (e.g. by prepfold). */
+{
+    double B0 = derivs[0], B1 = derivs[1], B2 = derivs[2], dts = derivs[3];
+    double f, fd, fdd, fb, fbd, fbdd, z0;
+
+    /* Topocentric spin at the middle of the observation */
+    fdd = wt / (T * T * T);
+    fd = zt / (T * T);
+    f = (rt - wt / 24.0) / T;
+    /* Since f_topo(t) = f_bary(t_bary(t)) * B(t) */
+    fb = f / B0;
+    fbd = (fd - fb * B1) / (B0 * B0);
+    fbdd = (fdd - 3.0 * fbd * B0 * B1 - fb * B2) / (B0 * B0 * B0);
+    /* Move the barycentric reference back to the start */
+    fb += dts * (-fbd + 0.5 * dts * fbdd);
+    fbd -= dts * fbdd;
+    /* And convert to average values over 'T' */
+    *wb = fbdd * T * T * T;
+    z0 = fbd * T * T;
+    *zb = z0 + 0.5 * *wb;
+    *rb = fb * T + 0.5 * z0 + *wb / 6.0;
+}
@@ -0,0 +1,556 @@
+#include "presto.h"
+#include "mask.h"
+#include "baseband.h"
+#include "fftw3.h"
+
+/* Reading complex baseband voltages (DADA format, TFP order).        */
+/*                                                                    */
+/* Each block of spectra is made by overlap-save convolution of each  */
+/* (coarse) channel of voltages: a length 'nfft' forward FFT, a       */
+/* multiplication by the chirp that removes the dispersion within     */
+/* each of 'nfine' output channels, and an inverse FFT of each        */
+/* 'nfft / nfine' bin piece of the spectrum.  The 'nover / 2' samples */
+/* that are corrupted at each end of the inverse FFTs are thrown      */
+/* away, and the rest are detected, summed over the polarizations,    */
+/* and averaged in groups of 'navg' into the output spectra.  The     */
+/* channel-to-channel delays are left alone, so the data can be       */
+/* dedispersed by prepsubband, prepfold, etc exactly like normal      */
+/* filterbank data, but with no smearing within the channels at the   */
+/* coherent DM (s->chan_dm).                                          */
+/*                                                                    */
+/* The coherent DM is the DM keyword in the DADA header unless it is  */
+/* given by the PRESTO_BASEBAND_DM environment variable.  The number  */
+/* of output channels per coarse channel (default 16) and the number  */
+/* of detected samples averaged per spectrum (default 1) can be set   */
+/* with PRESTO_BASEBAND_NFINE and PRESTO_BASEBAND_NAVG.               */
+
+#define DEFAULT_NFINE    16
+#define MIN_FFTLEN       65536
+#define MIN_BLOCK_SPECT  2048
+/* The dispersion constant (MHz) as used by delay_from_dm() */
+#define DM_CONST         (1.0e6 / 0.000241)
+
+static unsigned char *cdatabuffer;
+static float *fdatabuffer;
+static fcomplex **chirps;
+static fftwf_plan fwdplan, invplan;
+static long long *startbyte, *databytes, totbytes;
+static long long cur_spec = 0;
+static int nfft, nover, nvalid, nfine, navg, spect_per_fft;
+static int nchan, npol, nbit, bytes_per_samp, inverted;
+
+extern double DATEOBS_to_MJD(char *dateobs, int *mjd_day, double *mjd_fracday);
+
+
+int read_dada_header(dadahdr * hdr, FILE * inputfile)
+/* Read the ASCII header of the DADA file 'inputfile' into 'hdr'. */
+/* Return the number of bytes in the header.                      */
+{
+    int hdrlen = 4096, foundsize = 0;
+    char *buf, *line, *saveptr, key[80], value[160];
+
+    memset(hdr, 0, sizeof(dadahdr));
+    strcpy(hdr->source, "unset");
+    strcpy(hdr->telescope, "unset");
+    strcpy(hdr->instrument, "unset");
+    strcpy(hdr->ra_str, "00:00:00.0");
+    strcpy(hdr->dec_str, "00:00:00.0");
+    strcpy(hdr->order, "TFP");
+    hdr->obs_offset = -1;
+    hdr->nchan = hdr->npol = 1;
+    hdr->ndim = 2;
+    hdr->nbit = 8;
+
+    while (1) {
+        buf = (char *) calloc(hdrlen + 1, 1);
+        rewind(inputfile);
+        chkfread(buf, 1, hdrlen, inputfile);
+        for (line = strtok_r(buf, "\n", &saveptr); line != NULL;
+             line = strtok_r(NULL, "\n", &saveptr)) {
+            if (sscanf(line, "%79s %159[^\n]", key, value) != 2 || key[0] == '#')
+                continue;
+            if (strcmp(key, "HDR_SIZE") == 0) {
+                hdr->hdr_size = atoi(value);
+                foundsize = 1;
+            } else if (strcmp(key, "SOURCE") == 0)
+                sscanf(value, "%79s", hdr->source);
+            else if (strcmp(key, "TELESCOPE") == 0)
+                sscanf(value, "%79s", hdr->telescope);
+            else if (strcmp(key, "INSTRUMENT") == 0)
+                sscanf(value, "%79s", hdr->instrument);
+            else if (strcmp(key, "RA") == 0)
+                sscanf(value, "%39s", hdr->ra_str);
+            else if (strcmp(key, "DEC") == 0)
+                sscanf(value, "%39s", hdr->dec_str);
+            else if (strcmp(key, "UTC_START") == 0)
+                sscanf(value, "%39s", hdr->utc_start);
+            else if (strcmp(key, "ORDER") == 0)
+                sscanf(value, "%7s", hdr->order);
+            else if (strcmp(key, "FREQ") == 0)
+                hdr->freq = atof(value);
+            else if (strcmp(key, "BW") == 0)
+                hdr->bw = atof(value);
+            else if (strcmp(key, "TSAMP") == 0)
+                hdr->tsamp = atof(value);
+            else if (strcmp(key, "MJD_START") == 0)
+                hdr->mjd_start = atof(value);
+            else if (strcmp(key, "DM") == 0)
+                hdr->dm = atof(value);
+            else if (strcmp(key, "OBS_OFFSET") == 0)
+                hdr->obs_offset = atoll(value);
+            else if (strcmp(key, "FILE_SIZE") == 0)
+                hdr->file_size = atoll(value);
+            else if (strcmp(key, "PICOSECONDS") == 0)
+                hdr->picoseconds = atoll(value);
+            else if (strcmp(key, "NCHAN") == 0)
+                hdr->nchan = atoi(value);
+            else if (strcmp(key, "NPOL") == 0)
+                hdr->npol = atoi(value);
+            else if (strcmp(key, "NBIT") == 0)
+                hdr->nbit = atoi(value);
+            else if (strcmp(key, "NDIM") == 0)
+                hdr->ndim = atoi(value);
+        }
+        free(buf);
+        if (!foundsize)
+            presto_error(PRESTO_ERR_FORMAT,
+                         "no HDR_SIZE in the header.  Is this a DADA file?");
+        // Re-read if the header is longer than we assumed
+        if (hdr->hdr_size <= hdrlen)
+            break;
+        hdrlen = hdr->hdr_size;
+    }
+    if (hdr->ndim != 2)
+        presto_error(PRESTO_ERR_FORMAT,
+                     "only complex (NDIM 2) baseband data are supported (NDIM is %d)",
+                     hdr->ndim);
+    if (hdr->nbit != 8 && hdr->nbit != 16)
+        presto_error(PRESTO_ERR_FORMAT,
+                     "only 8 or 16-bit baseband data are supported (NBIT is %d)",
+                     hdr->nbit);
+    if (hdr->npol != 1 && hdr->npol != 2)
+        presto_error(PRESTO_ERR_FORMAT,
+                     "only 1 or 2 polarizations are supported (NPOL is %d)",
+                     hdr->npol);
+    if (strcmp(hdr->order, "TFP") != 0)
+        presto_error(PRESTO_ERR_FORMAT,
+                     "only TFP-ordered baseband data are supported (ORDER is %s)",
+                     hdr->order);
+    if (hdr->tsamp <= 0.0 || hdr->bw == 0.0 || hdr->freq <= 0.0 ||
+        hdr->nchan < 1)
+        presto_error(PRESTO_ERR_FORMAT,
+                     "the header needs valid TSAMP, FREQ, BW, and NCHAN values");
+    return hdr->hdr_size;
+}
+
+
+static double dada_start_MJD(dadahdr * hdr)
+/* Return the MJD of the first sample in the DADA file */
+{
+    double mjd = hdr->mjd_start;
+
+    if (hdr->utc_start[0] != '\0') {
+        int mjd_day;
+        double mjd_fracday;
+        char dateobs[40];
+
+        // UTC_START is YYYY-MM-DD-HH:MM:SS rather than DATE-OBS style
+        strcpy(dateobs, hdr->utc_start);
+        if (strlen(dateobs) > 10)
+            dateobs[10] = 'T';
+        mjd = DATEOBS_to_MJD(dateobs, &mjd_day, &mjd_fracday);
+    }
+    mjd += hdr->picoseconds * 1e-12 / SECPERDAY;
+    if (hdr->obs_offset > 0)
+        mjd += (hdr->obs_offset / (hdr->nchan * hdr->npol * hdr->ndim *
+                                   hdr->nbit / 8)) * hdr->tsamp * 1e-6 /
+            SECPERDAY;
+    return mjd;
+}
+
+
+static int baseband_env_int(char *name, int defval)
+/* Return the positive integer environment variable 'name' or 'defval' */
+{
+    char *envval = getenv(name);
+    int ival;
+
+    if (envval == NULL)
+        return defval;
+    ival = atoi(envval);
+    if (ival < 1)
+        presto_error(PRESTO_ERR_VALUE, "%s must be a positive integer (not '%s')",
+                     name, envval);
+    return ival;
+}
+
+
+static int fine_bin0(int finechan)
+/* Return the first bin (counting from the most negative frequency */
+/* of the FFT) that goes into output channel 'finechan' (in order  */
+/* of increasing sky frequency) of a coarse channel.               */
+{
+    return (inverted ? nfine - 1 - finechan : finechan) * (nfft / nfine);
+}
+
+
+static void make_chirp(fcomplex * chirp, double fctr, double bw, double dm)
+/* Fill 'chirp' with the (normalized) inverse of the dispersion by     */
+/* 'dm' across each output channel for the 'nfft' FFT bins of a coarse */
+/* channel centered at 'fctr' with bandwidth 'bw' (MHz).               */
+{
+    int ii, jj, kk, numbins = nfft / nfine;
+    double df = bw / nfine, finefctr, x, phase;
+
+    for (jj = 0; jj < nfine; jj++) {
+        finefctr = fctr - 0.5 * bw + (jj + 0.5) * df;
+        for (ii = 0; ii < numbins; ii++) {
+            kk = fine_bin0(jj) + ii;
+            // Offset from the center of the output channel in sky freq
+            x = (kk - nfft / 2) * bw / nfft;
+            if (inverted)
+                x = -x;
+            x -= finefctr - fctr;
+            phase = -TWOPI * DM_CONST * dm * x * x /
+                (finefctr * finefctr * (finefctr + x));
+            // An inverted (lower sideband) band is the complex conjugate
+            if (inverted)
+                phase = -phase;
+            // Store in normal FFT order
+            kk = (kk + nfft / 2) % nfft;
+            chirp[kk].r = cos(phase) / nfft;
+            chirp[kk].i = sin(phase) / nfft;
+        }
+    }
+}
+
+
+void read_baseband_files(struct spectra_info *s)
+{
+    dadahdr hdr, *hdrs;
+    int ii, unit, numblockffts;
+    long long numsamps, numffts, minsamps;
+    double tsamp, smear, lofreq;
+    fcomplex *tmpdat;
+
+    // s->num_files and s->filenames are assumed to be set
+    s->datatype = BASEBAND;
+    s->files = (FILE **) malloc(sizeof(FILE *) * s->num_files);
+    s->header_offset = gen_ivect(s->num_files);
+    s->start_subint = gen_ivect(s->num_files);
+    s->num_subint = gen_ivect(s->num_files);
+    s->start_spec = (long long *) malloc(sizeof(long long) * s->num_files);
+    s->num_spec = (long long *) malloc(sizeof(long long) * s->num_files);
+    s->num_pad = (long long *) malloc(sizeof(long long) * s->num_files);
+    s->start_MJD = (long double *) malloc(sizeof(long double) * s->num_files);
+    startbyte = (long long *) malloc(sizeof(long long) * s->num_files);
+    databytes = (long long *) malloc(sizeof(long long) * s->num_files);
+    hdrs = (dadahdr *) malloc(sizeof(dadahdr) * s->num_files);
+
+    // Read all of the headers.  The files must be pieces of a single
+    // contiguous stream of voltages.
+    totbytes = 0;
+    for (ii = 0; ii < s->num_files; ii++) {
+        s->files[ii] = chkfopen(s->filenames[ii], "rb");
+        s->header_offset[ii] = read_dada_header(hdrs + ii, s->files[ii]);
+        s->start_subint[ii] = 0;
+        s->num_subint[ii] = 0;
+        databytes[ii] = hdrs[ii].file_size;
+        if (databytes[ii] <= 0 ||
+            databytes[ii] > chkfilelen(s->files[ii], 1) - s->header_offset[ii])
+            databytes[ii] = chkfilelen(s->files[ii], 1) - s->header_offset[ii];
+        if (ii > 0) {
+            if (hdrs[ii].nchan != hdrs[0].nchan || hdrs[ii].npol != hdrs[0].npol ||
+                hdrs[ii].nbit != hdrs[0].nbit || hdrs[ii].tsamp != hdrs[0].tsamp ||
+                hdrs[ii].freq != hdrs[0].freq || hdrs[ii].bw != hdrs[0].bw)
+                presto_error(PRESTO_ERR_FORMAT,
+                             "the format of file #%d does not match that of file #1",
+                             ii + 1);
+            if (hdrs[ii].obs_offset >= 0 && hdrs[0].obs_offset >= 0 &&
+                hdrs[ii].obs_offset != hdrs[0].obs_offset + totbytes)
+                presto_error(PRESTO_ERR_FORMAT,
+                             "file #%d (OBS_OFFSET %lld) does not directly follow "
+                             "file #%d.\n   Coherent dedispersion needs contiguous data.",
+                             ii + 1, hdrs[ii].obs_offset, ii);
+        }
+        startbyte[ii] = totbytes;
+        totbytes += databytes[ii];
+    }
+    hdr = hdrs[0];
+    free(hdrs);
+
+    nchan = hdr.nchan;
+    npol = hdr.npol;
+    nbit = hdr.nbit;
+    inverted = (hdr.bw < 0.0);
+    bytes_per_samp = nchan * npol * 2 * nbit / 8;
+    tsamp = hdr.tsamp * 1e-6;
+    {
+        char *envval = getenv("PRESTO_BASEBAND_DM");
+        s->chan_dm = (envval == NULL) ? hdr.dm : atof(envval);
+        if (s->chan_dm < 0.0)
+            presto_error(PRESTO_ERR_VALUE, "the coherent DM (%g) must not be negative",
+                         s->chan_dm);
+    }
+    nfine = baseband_env_int("PRESTO_BASEBAND_NFINE", DEFAULT_NFINE);
+    navg = baseband_env_int("PRESTO_BASEBAND_NAVG", 1);
+
+    // The overlap must cover the dispersive smearing across the
+    // output channel with the lowest frequency
+    unit = 2 * nfine * navg;
+    s->orig_num_chan = nchan;
+    s->orig_df = fabs(hdr.bw) / nchan;
+    s->num_channels = nchan * nfine;
+    s->df = s->orig_df / nfine;
+    s->BW = fabs(hdr.bw);
+    lofreq = hdr.freq - 0.5 * s->BW;
+    smear = delay_from_dm(s->chan_dm, lofreq) - delay_from_dm(s->chan_dm,
+                                                               lofreq + s->df);
+    nover = ((int) ceil(smear / tsamp / unit) + 1) * unit;
+    nfft = unit;
+    while (nfft < MIN_FFTLEN || nfft < 4 * nover)
+        nfft *= 2;
+    nvalid = nfft - nover;
+    spect_per_fft = nvalid / (nfine * navg);
+    numblockffts = (MIN_BLOCK_SPECT + spect_per_fft - 1) / spect_per_fft;
+
+    // Fill in the spectra_info structure
+    strncpy(s->source, hdr.source, 80);
+    s->source[80] = '\0';
+    strncpy(s->telescope, hdr.telescope, 39);
+    s->telescope[39] = '\0';
+    strncpy(s->backend, hdr.instrument, 80);
+    s->backend[80] = '\0';
+    strcpy(s->ra_str, hdr.ra_str);
+    strcpy(s->dec_str, hdr.dec_str);
+    {
+        int d, h, m;
+        double sec;
+        ra_dec_from_string(s->ra_str, &h, &m, &sec);
+        s->ra2000 = hms2rad(h, m, sec) * RADTODEG;
+        ra_dec_from_string(s->dec_str, &d, &m, &sec);
+        s->dec2000 = dms2rad(d, m, sec) * RADTODEG;
+    }
+    s->num_polns = npol;
+    if (s->use_poln > npol)
+        s->use_poln = 0;
+    s->summed_polns = (npol == 2 && s->use_poln == 0);
+    if (npol == 2)
+        strcpy(s->poln_order, "AABB");
+    s->bits_per_sample = nbit;
+    s->signedints = 1;
+    s->dt = tsamp * nfine * navg;
+    s->fctr = hdr.freq;
+    s->lo_freq = lofreq + 0.5 * s->df;
+    s->hi_freq = s->lo_freq + (s->num_channels - 1) * s->df;
+    if (s->apply_flipband == -1)
+        s->apply_flipband = 0;  // The channels are made in the right order
+    s->samples_per_spectra = s->num_channels;
+    s->bytes_per_spectra = bytes_per_samp * nfine * navg;
+    s->spectra_per_subint = numblockffts * spect_per_fft;
+    s->samples_per_subint = s->spectra_per_subint * s->samples_per_spectra;
+    s->bytes_per_subint = s->spectra_per_subint * s->bytes_per_spectra;
+    s->time_per_subint = s->spectra_per_subint * s->dt;
+    s->min_spect_per_read = 1;
+    s->num_beams = 1;
+    s->beamnum = 0;
+
+    // Times and lengths.  The first output spectra is 'nover / 2'
+    // samples into the data.
+    numsamps = totbytes / bytes_per_samp;
+    minsamps = nfft;
+    if (numsamps < minsamps)
+        presto_error(PRESTO_ERR_VALUE,
+                     "need at least %lld samples for coherent dedispersion "
+                     "at DM %.3f (have %lld)", minsamps, s->chan_dm, numsamps);
+    numffts = (numsamps - nover) / nvalid;
+    s->N = numffts * spect_per_fft;
+    s->T = s->N * s->dt;
+    for (ii = 0; ii < s->num_files; ii++) {
+        s->start_spec[ii] = startbyte[ii] / bytes_per_samp / (nfine * navg);
+        s->num_spec[ii] = databytes[ii] / bytes_per_samp / (nfine * navg);
+        s->num_pad[ii] = 0;
+        s->start_MJD[ii] = dada_start_MJD(&hdr) +
+            (startbyte[ii] / bytes_per_samp + nover / 2) * tsamp / SECPERDAY;
+    }
+    s->num_spec[s->num_files - 1] = s->N - s->start_spec[s->num_files - 1];
+    if (s->num_spec[s->num_files - 1] < 0)
+        s->num_spec[s->num_files - 1] = 0;
+    mjd_to_datestr(s->start_MJD[0], s->date_obs);
+
+    // The buffers, chirps, and FFT plans
+    cdatabuffer = gen_bvect((long long) ((numblockffts + 1) * nvalid + nover) *
+                            bytes_per_samp);
+    fdatabuffer = gen_fvect((long long) (numblockffts + 1) * spect_per_fft *
+                            s->num_channels);
+    s->padvals = gen_fvect(s->num_channels);
+    for (ii = 0; ii < s->num_channels; ii++)
+        s->padvals[ii] = 0.0;
+    chirps = gen_cmatrix(nchan, nfft);
+    for (ii = 0; ii < nchan; ii++)
+        make_chirp(chirps[ii], hdr.freq + (ii + 0.5 - 0.5 * nchan) * hdr.bw / nchan,
+                   s->orig_df, s->chan_dm);
+    tmpdat = gen_cvect(nfft);
+    fwdplan = fftwf_plan_dft_1d(nfft, (fftwf_complex *) tmpdat,
+                                (fftwf_complex *) tmpdat, FFTW_FORWARD, FFTW_ESTIMATE);
+    invplan = fftwf_plan_dft_1d(nfft / nfine, (fftwf_complex *) tmpdat,
+                                (fftwf_complex *) tmpdat, FFTW_BACKWARD,
+                                FFTW_ESTIMATE);
+    vect_free(tmpdat);
+    cur_spec = 0;
+    s->get_rawblock = &get_baseband_rawblock;
+    s->offset_to_spectra = &offset_to_baseband_spectra;
+
+    printf("Coherently dedispersing %d channels to DM %.4f with %d-point FFTs\n"
+           "  (%d overlap) into %d channels of %d each (%.6g us samples).\n\n",
+           nchan, s->chan_dm, nfft, nover, s->num_channels, nfine, s->dt * 1e6);
+}
+
+
+long long offset_to_baseband_spectra(long long specnum, struct spectra_info *s)
+// This routine offsets into the baseband data to the spectra
+// 'specnum'.  It returns the current spectra number.
+{
+    if (specnum > s->N) {
+        presto_error(PRESTO_ERR_VALUE,
+                     "offset spectra %lld is > total spectra %lld", specnum, s->N);
+    }
+    cur_spec = specnum;
+    return specnum;
+}
+
+
+static void read_baseband_samples(struct spectra_info *s, long long firstsamp,
+                                  long long numsamps)
+/* Read 'numsamps' samples (all channels and polns) starting with */
+/* sample 'firstsamp' of the stream of files into cdatabuffer.    */
+{
+    int filenum = 0;
+    long long byte = firstsamp * bytes_per_samp;
+    long long numbytes = numsamps * bytes_per_samp, toread;
+    unsigned char *bufptr = cdatabuffer;
+
+    while (numbytes > 0) {
+        while (filenum + 1 < s->num_files && byte >= startbyte[filenum + 1])
+            filenum++;
+        toread = startbyte[filenum] + databytes[filenum] - byte;
+        if (toread <= 0) {      // Past the end of the data
+            memset(bufptr, 0, numbytes);
+            break;
+        }
+        if (toread > numbytes)
+            toread = numbytes;
+        chkfseek(s->files[filenum], s->header_offset[filenum] +
+                 (byte - startbyte[filenum]), SEEK_SET);
+        if (chkfread(bufptr, 1, toread, s->files[filenum]) != toread)
+            presto_error(PRESTO_ERR_IO,
+                         "problem reading baseband data from file #%d", filenum + 1);
+        bufptr += toread;
+        byte += toread;
+        numbytes -= toread;
+    }
+}
+
+
+static void dedisperse_channel(int fftnum, int chan, struct spectra_info *s,
+                               fcomplex * spect, fcomplex * fine)
+/* Coherently dedisperse, channelize, and detect FFT 'fftnum' of the  */
+/* data in cdatabuffer for coarse channel 'chan' into fdatabuffer.    */
+/* 'spect' and 'fine' are work arrays of length nfft and nfft / nfine. */
+{
+    int ii, jj, kk, pol, bin0, numbins = nfft / nfine;
+    int skip = nover / (2 * nfine), numgood = nvalid / nfine;
+    int outchan = (inverted ? nchan - 1 - chan : chan) * nfine;
+    long long sampoffset;
+    float *outspect, scale = (float) nfine / navg;
+
+    outspect = fdatabuffer + (long long) fftnum * spect_per_fft * s->num_channels +
+        outchan;
+    for (ii = 0; ii < spect_per_fft; ii++)
+        for (jj = 0; jj < nfine; jj++)
+            outspect[ii * s->num_channels + jj] = 0.0;
+    for (pol = 0; pol < npol; pol++) {
+        if (s->use_poln && pol != s->use_poln - 1)
+            continue;
+        // Unpack the complex voltages
+        sampoffset = ((long long) fftnum * nvalid * nchan + chan) * npol + pol;
+        if (nbit == 8) {
+            signed char *cdata = (signed char *) cdatabuffer + 2 * sampoffset;
+            for (ii = 0; ii < nfft; ii++, cdata += 2 * nchan * npol) {
+                spect[ii].r = cdata[0];
+                spect[ii].i = cdata[1];
+            }
+        } else {
+            short *sdata = (short *) cdatabuffer + 2 * sampoffset;
+            for (ii = 0; ii < nfft; ii++, sdata += 2 * nchan * npol) {
+                spect[ii].r = sdata[0];
+                spect[ii].i = sdata[1];
+            }
+        }
+        // Remove the dispersion within each output channel
+        fftwf_execute_dft(fwdplan, (fftwf_complex *) spect, (fftwf_complex *) spect);
+        for (ii = 0; ii < nfft; ii++) {
+            float rr = spect[ii].r, ri = spect[ii].i;
+            spect[ii].r = rr * chirps[chan][ii].r - ri * chirps[chan][ii].i;
+            spect[ii].i = rr * chirps[chan][ii].i + ri * chirps[chan][ii].r;
+        }
+        // Channelize and detect
+        for (jj = 0; jj < nfine; jj++) {
+            bin0 = fine_bin0(jj) + nfft / 2;
+            for (ii = 0; ii < numbins; ii++)
+                fine[ii] = spect[(bin0 + ii) % nfft];
+            fftwf_execute_dft(invplan, (fftwf_complex *) fine,
+                              (fftwf_complex *) fine);
+            for (ii = 0, kk = skip; ii < numgood; ii++, kk++)
+                outspect[(ii / navg) * s->num_channels + jj] +=
+                    scale * (fine[kk].r * fine[kk].r + fine[kk].i * fine[kk].i);
+        }
+    }
+}
+
+
+int get_baseband_rawblock(float *fdata, struct spectra_info *s, int *padding)
+// This routine makes a single block (i.e subint) of coherently
+// dedispersed and detected spectra from the baseband data.  Return 1
+// on success and 0 if there are not enough data left for a block.
+{
+    int ii, numffts;
+    long long firstfft;
+
+    *padding = 0;
+    if (cur_spec + s->spectra_per_subint > s->N)
+        return 0;
+    firstfft = cur_spec / spect_per_fft;
+    numffts = (cur_spec + s->spectra_per_subint - 1) / spect_per_fft - firstfft + 1;
+    read_baseband_samples(s, firstfft * nvalid,
+                          (long long) (numffts - 1) * nvalid + nfft);
+
+    // The FFTs of the channels are independent, so do them in parallel
+#ifdef _OPENMP
+#pragma omp parallel default(shared)
+#endif
+    {
+        fcomplex *spect = gen_cvect(nfft);
+        fcomplex *fine = gen_cvect(nfft / nfine);
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic)
+#endif
+        for (ii = 0; ii < numffts * nchan; ii++)
+            dedisperse_channel(ii / nchan, ii % nchan, s, spect, fine);
+        vect_free(spect);
+        vect_free(fine);
+    }
+    memcpy(fdata, fdatabuffer + (cur_spec - firstfft * spect_per_fft) *
+           s->num_channels, sizeof(float) * s->spectra_per_subint * s->num_channels);
+    cur_spec += s->spectra_per_subint;
+
+    // Invert the band if requested
+    if (s->apply_flipband)
+        flip_band(fdata, s);
+
+    // Perform Zero-DMing if requested
+    if (s->remove_zerodm)
+        remove_zerodm(fdata, s);
+
+    return 1;
+}
@@ -0,0 +1,494 @@
+#include "presto.h"
+#include "mask.h"
+#include "beamcoinc_cmd.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+/*
+ * Multibeam coincidence RFI rejection.  Terrestrial RFI usually
+ * shows up in most of the simultaneously recorded beams of a
+ * multibeam receiver, while astrophysical signals show up in only
+ * one or a few of them.  Intervals/channels (from the rfifind
+ * statistics of each beam's raw data or from zero-DM '.dat' files)
+ * and Fourier bins (from zero-DM '.fft' files) that are flagged in
+ * at least 'nbeams' of the beams are masked or zapped in all of them.
+ */
+
+typedef enum {
+    STATSFILES, DATFILES, FFTFILES
+} beamtype;
+
+typedef struct BEAM {
+    char *root;                 /* Root name of the beam's input file   */
+    infodata idata;             /* The beam's '.inf' file                */
+    rfistats stats;             /* Per-interval, per-channel statistics */
+    FILE *fftfile;              /* The beam's '.fft' file                */
+} beam;
+
+/* From CLIG */
+static Cmdline *cmd;
+
+static void dat_rfistats(char *datfilenm, beam * b, double inttime)
+/* Calculate rfifind-style statistics (with a single "channel") */
+/* for each interval of 'inttime' sec of a zero-DM '.dat' file.  */
+{
+    int ii, jj, ptsperint, numint;
+    long long N;
+    float *data;
+    double davg, dvar, norm, pow, powmax;
+    FILE *datfile;
+    rfistats *stats = &b->stats;
+
+    datfile = chkfopen(datfilenm, "rb");
+    N = chkfilelen(datfile, sizeof(float));
+    ptsperint = 2 * (int) (0.5 * inttime / b->idata.dt + 0.5);
+    numint = N / ptsperint;
+    if (ptsperint < 16 || numint < 1) {
+        printf("\nError:  '%s' is too short for intervals of %g s!\n\n",
+               datfilenm, inttime);
+        exit(1);
+    }
+    stats->numchan = 1;
+    stats->numint = numint;
+    stats->ptsperint = ptsperint;
+    stats->lobin = 1;
+    stats->numbetween = 1;
+    stats->datapow = gen_fvect(numint);
+    stats->dataavg = gen_fvect(numint);
+    stats->datastd = gen_fvect(numint);
+    stats->padmask = NULL;
+    stats->filemap = NULL;
+    stats->filelen = 0;
+    data = gen_fvect(ptsperint);
+    for (ii = 0; ii < numint; ii++) {
+        chkfread(data, sizeof(float), ptsperint, datfile);
+        avg_var(data, ptsperint, &davg, &dvar);
+        stats->dataavg[ii] = davg;
+        stats->datastd[ii] = sqrt(dvar);
+        powmax = 0.0;
+        // Don't search the power spectrum if there is little to no variance
+        if (stats->datastd[ii] > 1e-4) {
+            realfft(data, ptsperint, -1);
+            norm = 1.0 / (dvar * ptsperint);
+            for (jj = 1; jj < ptsperint / 2; jj++) {
+                pow = (data[2 * jj] * data[2 * jj] +
+                       data[2 * jj + 1] * data[2 * jj + 1]) * norm;
+                if (pow > powmax)
+                    powmax = pow;
+            }
+        }
+        stats->datapow[ii] = powmax;
+    }
+    vect_free(data);
+    fclose(datfile);
+    calc_rfistats(stats);
+}
+
+
+static void make_masks(beam * beams, int numbeams, int nbeams, beamtype type)
+/* Flag each beam's intervals/channels by themselves (as rfifind  */
+/* does) and, with the lower '-mbsig' cutoff, in coincidence with */
+/* at least 'nbeams' of the beams.  Write a mask for each beam.   */
+{
+    int ii, bb, numchan = beams[0].stats.numchan, numint = beams[0].stats.numint;
+    long kk, numvals, numcoinc = 0;
+    unsigned char **bytemasks, **mbmasks;
+    char *maskfilenm;
+
+    /* The intervals must line up in time in all of the beams */
+    for (bb = 1; bb < numbeams; bb++) {
+        infodata *id0 = &beams[0].idata, *id = &beams[bb].idata;
+        double dmjd = (id->mjd_i - id0->mjd_i) + (id->mjd_f - id0->mjd_f);
+
+        if (beams[bb].stats.numchan != numchan) {
+            printf("\nError:  The beams have different numbers of channels!\n\n");
+            exit(1);
+        }
+        if (fabs(id->dt - id0->dt) > 1e-9 * id0->dt) {
+            printf("\nError:  Beams 0 and %d have different sample times!\n\n", bb);
+            exit(1);
+        }
+        if (fabs(dmjd) * SECPERDAY > 0.5 * id0->dt) {
+            printf("\nError:  Beams 0 and %d have different start times!\n\n", bb);
+            exit(1);
+        }
+        if (beams[bb].stats.ptsperint != beams[0].stats.ptsperint) {
+            printf("\nError:  Beams 0 and %d have different points per interval!\n\n",
+                   bb);
+            exit(1);
+        }
+        if (beams[bb].stats.numint < numint)
+            numint = beams[bb].stats.numint;
+    }
+    numvals = (long) numint * numchan;
+
+    /* The single-beam and the coincidence flags for each beam */
+    bytemasks = (unsigned char **) malloc(sizeof(unsigned char *) * numbeams);
+    mbmasks = (unsigned char **) malloc(sizeof(unsigned char *) * numbeams);
+#ifdef _OPENMP
+#pragma omp parallel for private(bb) shared(beams, numbeams, bytemasks, mbmasks, cmd)
+#endif
+    for (bb = 0; bb < numbeams; bb++) {
+        rfistats *stats = &beams[bb].stats;
+        long len = (long) stats->numint * stats->numchan;
+
+        bytemasks[bb] = (unsigned char *) malloc(len);
+        mbmasks[bb] = (unsigned char *) malloc(len);
+        if (stats->padmask) {
+            memcpy(bytemasks[bb], stats->padmask, len);
+            memcpy(mbmasks[bb], stats->padmask, len);
+        } else {
+            memset(bytemasks[bb], 0, len);
+            memset(mbmasks[bb], 0, len);
+        }
+        flag_rfistats(stats, cmd->timesigma, cmd->freqsigma, bytemasks[bb]);
+        flag_rfistats(stats, cmd->mbsigma, cmd->mbsigma, mbmasks[bb]);
+    }
+
+    /* Flag the coincidences in all of the (un-padded) beams */
+#ifdef _OPENMP
+#pragma omp parallel for private(kk, bb) shared(numbeams, nbeams, numvals, bytemasks, mbmasks) reduction(+:numcoinc)
+#endif
+    for (kk = 0; kk < numvals; kk++) {
+        int numpow = 0, numavg = 0, numstd = 0;
+        unsigned char coinc = 0;
+
+        for (bb = 0; bb < numbeams; bb++) {
+            unsigned char bits = mbmasks[bb][kk];
+            numpow += (bits & BAD_POW) ? 1 : 0;
+            numavg += (bits & BAD_AVG) ? 1 : 0;
+            numstd += (bits & BAD_STD) ? 1 : 0;
+        }
+        if (numpow >= nbeams)
+            coinc |= BAD_POW;
+        if (numavg >= nbeams)
+            coinc |= BAD_AVG;
+        if (numstd >= nbeams)
+            coinc |= BAD_STD;
+        if (coinc) {
+            numcoinc++;
+            for (bb = 0; bb < numbeams; bb++)
+                if (!(bytemasks[bb][kk] & PADDING))
+                    bytemasks[bb][kk] |= coinc;
+        }
+    }
+    printf("Found %ld coincident intervals%s in %d or more beams.\n\n",
+           numcoinc, (type == STATSFILES) ? "/channels" : "", nbeams);
+
+    /* Write the masks */
+    for (bb = 0; bb < numbeams; bb++) {
+        beam *b = beams + bb;
+        int bnumint = b->stats.numint, *userints, *userchan;
+        int numuserints = 0, numuserchan = 0, masknumchan = numchan;
+        long numbad = 0, numpad = 0;
+        unsigned char **bytemask;
+        mask obsmask;
+
+        userints = gen_ivect(bnumint);
+        if (type == STATSFILES) {
+            userchan = gen_ivect(numchan);
+            bytemask = (unsigned char **) malloc(sizeof(unsigned char *) * bnumint);
+            for (ii = 0; ii < bnumint; ii++)
+                bytemask[ii] = bytemasks[bb] + (long) ii * numchan;
+            numuserints = trim_rfi_ints(bytemasks[bb], numchan, bnumint,
+                                        cmd->chantrigfrac, userints, 0);
+            numuserchan = trim_rfi_chans(bytemasks[bb], numchan, bnumint,
+                                         cmd->inttrigfrac, userchan, 0);
+        } else {
+            /* Mask all of the raw data channels in the bad intervals */
+            masknumchan = (b->idata.num_chan > 0) ? b->idata.num_chan : 1;
+            userchan = gen_ivect(1);
+            bytemask = gen_bmatrix(bnumint, masknumchan);
+            for (ii = 0; ii < bnumint; ii++) {
+                unsigned char bits = 0;
+                if (bytemasks[bb][ii] & BADDATA) {
+                    userints[numuserints++] = ii;
+                    bits = USERINTS;
+                } else if (bytemasks[bb][ii] & PADDING)
+                    bits = PADDING;
+                memset(bytemask[ii], bits, masknumchan);
+            }
+        }
+        fill_mask(cmd->timesigma, cmd->freqsigma, b->idata.mjd_i + b->idata.mjd_f,
+                  b->stats.ptsperint * b->idata.dt, b->idata.freq,
+                  b->idata.chan_wid, masknumchan, bnumint, b->stats.ptsperint,
+                  numuserchan, userchan, numuserints, userints, bytemask, &obsmask);
+        maskfilenm = (char *) calloc(strlen(b->root) + strlen(cmd->suffix) + 6, 1);
+        sprintf(maskfilenm, "%s%s.mask", b->root, cmd->suffix);
+        write_mask(maskfilenm, &obsmask);
+        for (kk = 0; kk < (long) bnumint * numchan; kk++) {
+            if (bytemasks[bb][kk] & PADDING)
+                numpad++;
+            else if (bytemasks[bb][kk] & (BADDATA | USERZAP))
+                numbad++;
+        }
+        printf("  '%s':  masked %.3g%% of the data\n", maskfilenm,
+               (numbad + numpad < (long) bnumint * numchan) ?
+               100.0 * numbad / ((long) bnumint * numchan - numpad) : 100.0);
+        free(maskfilenm);
+        free_mask(obsmask);
+        if (type == STATSFILES) {
+            free(bytemask);
+        } else {
+            vect_free(bytemask[0]);
+            vect_free(bytemask);
+        }
+        vect_free(userints);
+        vect_free(userchan);
+        free(bytemasks[bb]);
+        free(mbmasks[bb]);
+    }
+    free(bytemasks);
+    free(mbmasks);
+}
+
+
+static void find_birdies(beam * beams, int numbeams, int nbeams)
+/* Stream through the '.fft' files in blocks of '-normlen' bins  */
+/* and find the Fourier bins that have significant power (after  */
+/* normalizing by the median power of the block) in at least     */
+/* 'nbeams' of the beams.  Write a zaplist for each beam.         */
+{
+    int ii, bb, normlen = cmd->normlen, binerr = cmd->binerr;
+    int numbirds = 0, maxbirds = 100;
+    long long numbins, lobin, runstart = -1, *birdlo, *birdhi;
+    float powcut, **powers;
+    unsigned char **flags;
+    char *zapfilenm;
+    FILE *zapfile;
+
+    numbins = chkfilelen(beams[0].fftfile, sizeof(fcomplex));
+    for (bb = 1; bb < numbeams; bb++) {
+        long long N = chkfilelen(beams[bb].fftfile, sizeof(fcomplex));
+        if (N != numbins)
+            printf("Warning:  '%s.fft' has %lld bins instead of %lld.\n",
+                   beams[bb].root, N, numbins);
+        if (N < numbins)
+            numbins = N;
+    }
+    powcut = power_for_sigma(cmd->mbsigma, 1, 1);
+    powers = gen_fmatrix(numbeams, normlen + 2 * binerr);
+    flags = gen_bmatrix(numbeams, normlen + 2 * binerr);
+    birdlo = (long long *) malloc(sizeof(long long) * maxbirds);
+    birdhi = (long long *) malloc(sizeof(long long) * maxbirds);
+
+    /* Skip the DC bin */
+    for (lobin = 1; lobin < numbins; lobin += normlen) {
+        long long readlo = lobin - binerr, readhi = lobin + normlen + binerr;
+        int numread, numblock = normlen;
+
+        if (readlo < 1)
+            readlo = 1;
+        if (readhi > numbins)
+            readhi = numbins;
+        if (lobin + numblock > numbins)
+            numblock = numbins - lobin;
+        numread = readhi - readlo;
+#ifdef _OPENMP
+#pragma omp parallel for private(bb, ii) shared(beams, numbeams, powers, flags, readlo, numread, powcut)
+#endif
+        for (bb = 0; bb < numbeams; bb++) {
+            fcomplex *amps = (fcomplex *) malloc(sizeof(fcomplex) * numread);
+            float norm, powargr, powargi;
+
+            chkfileseek(beams[bb].fftfile, readlo, sizeof(fcomplex), SEEK_SET);
+            chkfread(amps, sizeof(fcomplex), numread, beams[bb].fftfile);
+            for (ii = 0; ii < numread; ii++)
+                powers[bb][ii] = POWER(amps[ii].r, amps[ii].i);
+            /* The median of an exponential distribution is ln(2) */
+            norm = median_nocopy(powers[bb], numread);
+            norm = (norm > 0.0) ? log(2.0) / norm : 0.0;
+            for (ii = 0; ii < numread; ii++)
+                flags[bb][ii] = (powers[bb][ii] * norm > powcut);
+            free(amps);
+        }
+        /* Count the beams with a flagged bin within binerr bins */
+        for (ii = 0; ii < numblock; ii++) {
+            long long bin = lobin + ii;
+            int jj, lo = bin - binerr - readlo, hi = bin + binerr - readlo;
+            int numcoinc = 0;
+
+            if (lo < 0)
+                lo = 0;
+            if (hi > numread - 1)
+                hi = numread - 1;
+            for (bb = 0; bb < numbeams; bb++) {
+                for (jj = lo; jj <= hi; jj++) {
+                    if (flags[bb][jj]) {
+                        numcoinc++;
+                        break;
+                    }
+                }
+            }
+            if (numcoinc >= nbeams) {
+                if (runstart < 0)
+                    runstart = bin;
+            } else if (runstart >= 0) {
+                if (numbirds == maxbirds) {
+                    maxbirds *= 2;
+                    birdlo = (long long *) realloc(birdlo, sizeof(long long) * maxbirds);
+                    birdhi = (long long *) realloc(birdhi, sizeof(long long) * maxbirds);
+                }
+                birdlo[numbirds] = runstart;
+                birdhi[numbirds++] = bin - 1;
+                runstart = -1;
+            }
+        }
+    }
+    if (runstart >= 0) {
+        if (numbirds == maxbirds) {
+            maxbirds++;
+            birdlo = (long long *) realloc(birdlo, sizeof(long long) * maxbirds);
+            birdhi = (long long *) realloc(birdhi, sizeof(long long) * maxbirds);
+        }
+        birdlo[numbirds] = runstart;
+        birdhi[numbirds++] = numbins - 1;
+    }
+    printf("Found %d coincident birdies in %d or more beams.\n\n", numbirds, nbeams);
+
+    /* Write the zaplists (get_birdies() can't read an empty one) */
+    if (numbirds == 0)
+        printf("  No zaplists written.\n");
+    for (bb = 0; numbirds > 0 && bb < numbeams; bb++) {
+        beam *b = beams + bb;
+        double T = b->idata.N * b->idata.dt;
+
+        zapfilenm = (char *) calloc(strlen(b->root) + strlen(cmd->suffix) + 9, 1);
+        sprintf(zapfilenm, "%s%s.zaplist", b->root, cmd->suffix);
+        zapfile = chkfopen(zapfilenm, "w");
+        fprintf(zapfile, "# Birdies seen in %d or more of %d beams (by beamcoinc)\n",
+                nbeams, numbeams);
+        fprintf(zapfile, "#%19s  %20s\n", "Freq", "Width");
+        for (ii = 0; ii < numbirds; ii++)
+            fprintf(zapfile, "  %20.15g  %20.15g\n",
+                    0.5 * (birdlo[ii] + birdhi[ii]) / T,
+                    (birdhi[ii] - birdlo[ii] + 1) / T);
+        fclose(zapfile);
+        printf("  Wrote '%s'\n", zapfilenm);
+        free(zapfilenm);
+    }
+    vect_free(powers[0]);
+    vect_free(powers);
+    vect_free(flags[0]);
+    vect_free(flags);
+    free(birdlo);
+    free(birdhi);
+}
+
+
+int main(int argc, char *argv[])
+{
+    int ii, numbeams, nbeams;
+    char *suffix;
+    beamtype type = STATSFILES;
+    beam *beams;
+
+    /* Call usage() if we have no command line arguments */
+
+    if (argc == 1) {
+        Program = argv[0];
+        usage();
+        exit(1);
+    }
+
+    /* Parse the command line using the excellent program Clig */
+
+    cmd = parseCmdline(argc, argv);
+
+#ifdef DEBUG
+    showOptionValues();
+#endif
+
+    printf("\n\n");
+    printf("      Multibeam Coincidence RFI Rejection\n");
+    printf("            by Scott M. Ransom\n\n");
+
+    if (cmd->ncpus > 1) {
+#ifdef _OPENMP
+        int maxcpus = omp_get_num_procs();
+        int openmp_numthreads = (cmd->ncpus <= maxcpus) ? cmd->ncpus : maxcpus;
+        // Make sure we are not dynamically setting the number of threads
+        omp_set_dynamic(0);
+        omp_set_num_threads(openmp_numthreads);
+        printf("Using %d threads with OpenMP\n\n", openmp_numthreads);
+#endif
+    } else {
+#ifdef _OPENMP
+        omp_set_num_threads(1); // Explicitly turn off OpenMP
+#endif
+    }
+
+    numbeams = cmd->argc;
+    nbeams = (cmd->nbeamsP) ? cmd->nbeams : numbeams / 2 + 1;
+    if (nbeams > numbeams) {
+        printf("Error:  -nbeams (%d) is more than the number of beams (%d)!\n\n",
+               nbeams, numbeams);
+        exit(1);
+    }
+
+    /* Read the beams */
+
+    beams = (beam *) malloc(sizeof(beam) * numbeams);
+    for (ii = 0; ii < numbeams; ii++) {
+        beam *b = beams + ii;
+        beamtype thistype;
+
+        if (split_root_suffix(cmd->argv[ii], &b->root, &suffix) == 0) {
+            printf("Error:  The input filename (%s) must have a suffix!\n\n",
+                   cmd->argv[ii]);
+            exit(1);
+        }
+        if (strcmp(suffix, "stats") == 0)
+            thistype = STATSFILES;
+        else if (strcmp(suffix, "dat") == 0)
+            thistype = DATFILES;
+        else if (strcmp(suffix, "fft") == 0)
+            thistype = FFTFILES;
+        else {
+            printf("Error:  The input files must be '.stats', '.dat', or '.fft' files!\n\n");
+            exit(1);
+        }
+        free(suffix);
+        if (ii == 0)
+            type = thistype;
+        else if (thistype != type) {
+            printf("Error:  The input files must all be of the same type!\n\n");
+            exit(1);
+        }
+        readinf(&b->idata, b->root);
+        printf("Beam %2d:  '%s'\n", ii, cmd->argv[ii]);
+        if (type == STATSFILES)
+            read_rfistats(cmd->argv[ii], &b->stats);
+        else if (type == DATFILES)
+            dat_rfistats(cmd->argv[ii], b, cmd->time);
+        else
+            b->fftfile = chkfopen(cmd->argv[ii], "rb");
+    }
+    printf("\n");
+
+    /* Find the coincidences */
+
+    if (type == FFTFILES)
+        find_birdies(beams, numbeams, nbeams);
+    else
+        make_masks(beams, numbeams, nbeams, type);
+
+    for (ii = 0; ii < numbeams; ii++) {
+        if (type == STATSFILES) {
+            free_rfistats(&beams[ii].stats);
+        } else if (type == DATFILES) {
+            vect_free(beams[ii].stats.datapow);
+            vect_free(beams[ii].stats.dataavg);
+            vect_free(beams[ii].stats.datastd);
+            free_rfistats(&beams[ii].stats);
+        } else {
+            fclose(beams[ii].fftfile);
+        }
+        free(beams[ii].root);
+    }
+    free(beams);
+    printf("\nDone.\n\n");
+    return 0;
+}
@@ -0,0 +1,1101 @@
+/*****
+  command line parser -- generated by clig
+  (http://wsd.iitb.fhg.de/~kir/clighome/)
+
+  The command line parser `clig':
+  (C) 1995-2004 Harald Kirsch (clig@geggus.net)
+*****/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <errno.h>
+#include <limits.h>
+#include <float.h>
+#include <math.h>
+
+#include "beamcoinc_cmd.h"
+
+char *Program;
+
+/*@-null*/
+
+static Cmdline cmd = {
+  /***** -ncpus: Number of processors to use with OpenMP */
+  /* ncpusP = */ 1,
+  /* ncpus = */ 1,
+  /* ncpusC = */ 1,
+  /***** -nbeams: The number of beams a signal must be seen in to be RFI (default is more than half of the beams) */
+  /* nbeamsP = */ 0,
+  /* nbeams = */ (int)0,
+  /* nbeamsC = */ 0,
+  /***** -mbsig: The +/-sigma cutoff for a signal in a single beam to count towards a coincidence */
+  /* mbsigmaP = */ 1,
+  /* mbsigma = */ 3,
+  /* mbsigmaC = */ 1,
+  /***** -timesig: The +/-sigma cutoff to reject time-domain chunks in each beam by itself (as in rfifind) */
+  /* timesigmaP = */ 1,
+  /* timesigma = */ 10,
+  /* timesigmaC = */ 1,
+  /***** -freqsig: The +/-sigma cutoff to reject freq-domain chunks in each beam by itself (as in rfifind) */
+  /* freqsigmaP = */ 1,
+  /* freqsigma = */ 4,
+  /* freqsigmaC = */ 1,
+  /***** -chanfrac: The fraction of bad channels that will mask a full interval */
+  /* chantrigfracP = */ 1,
+  /* chantrigfrac = */ 0.7,
+  /* chantrigfracC = */ 1,
+  /***** -intfrac: The fraction of bad intervals that will mask a full channel */
+  /* inttrigfracP = */ 1,
+  /* inttrigfrac = */ 0.3,
+  /* inttrigfracC = */ 1,
+  /***** -time: Seconds to integrate for stats and FFT calcs of '.dat' files */
+  /* timeP = */ 1,
+  /* time = */ 2.0,
+  /* timeC = */ 1,
+  /***** -normlen: Number of Fourier bins in each block of the '.fft' files normalized by its median power */
+  /* normlenP = */ 1,
+  /* normlen = */ 2048,
+  /* normlenC = */ 1,
+  /***** -binerr: Number of Fourier bins that coincident signals in the '.fft' files may differ by */
+  /* binerrP = */ 1,
+  /* binerr = */ 1,
+  /* binerrC = */ 1,
+  /***** -o: Suffix added to each beam's root name for its output files */
+  /* suffixP = */ 1,
+  /* suffix = */ "_mb",
+  /* suffixC = */ 1,
+  /***** uninterpreted rest of command line */
+  /* argc = */ 0,
+  /* argv = */ (char**)0,
+  /***** the original command line concatenated */
+  /* full_cmd_line = */ NULL
+};
+
+/*@=null*/
+
+/***** let LCLint run more smoothly */
+/*@-predboolothers*/
+/*@-boolops*/
+
+
+/******************************************************************/
+/*****
+ This is a bit tricky. We want to make a difference between overflow
+ and underflow and we want to allow v==Inf or v==-Inf but not
+ v>FLT_MAX. 
+
+ We don't use fabs to avoid linkage with -lm.
+*****/
+static void
+checkFloatConversion(double v, char *option, char *arg)
+{
+  char *err = NULL;
+
+  if( (errno==ERANGE && v!=0.0) /* even double overflowed */
+      || (v<HUGE_VAL && v>-HUGE_VAL && (v<0.0?-v:v)>(double)FLT_MAX) ) {
+    err = "large";
+  } else if( (errno==ERANGE && v==0.0) 
+	     || (v!=0.0 && (v<0.0?-v:v)<(double)FLT_MIN) ) {
+    err = "small";
+  }
+  if( err ) {
+    fprintf(stderr, 
+	    "%s: parameter `%s' of option `%s' to %s to represent\n",
+	    Program, arg, option, err);
+    exit(EXIT_FAILURE);
+  }
+}
+
+int
+getIntOpt(int argc, char **argv, int i, int *value, int force)
+{
+  char *end;
+  long v;
+
+  if( ++i>=argc ) goto nothingFound;
+
+  errno = 0;
+  v = strtol(argv[i], &end, 0);
+
+  /***** check for conversion error */
+  if( end==argv[i] ) goto nothingFound;
+
+  /***** check for surplus non-whitespace */
+  while( isspace((int) *end) ) end+=1;
+  if( *end ) goto nothingFound;
+
+  /***** check if it fits into an int */
+  if( errno==ERANGE || v>(long)INT_MAX || v<(long)INT_MIN ) {
+    fprintf(stderr, 
+	    "%s: parameter `%s' of option `%s' to large to represent\n",
+	    Program, argv[i], argv[i-1]);
+    exit(EXIT_FAILURE);
+  }
+  *value = (int)v;
+
+  return i;
+
+nothingFound:
+  if( !force ) return i-1;
+
+  fprintf(stderr, 
+	  "%s: missing or malformed integer value after option `%s'\n",
+	  Program, argv[i-1]);
+    exit(EXIT_FAILURE);
+}
+/**********************************************************************/
+
+int
+getIntOpts(int argc, char **argv, int i, 
+	   int **values,
+	   int cmin, int cmax)
+/*****
+  We want to find at least cmin values and at most cmax values.
+  cmax==-1 then means infinitely many are allowed.
+*****/
+{
+  int alloced, used;
+  char *end;
+  long v;
+  if( i+cmin >= argc ) {
+    fprintf(stderr, 
+	    "%s: option `%s' wants at least %d parameters\n",
+	    Program, argv[i], cmin);
+    exit(EXIT_FAILURE);
+  }
+
+  /***** 
+    alloc a bit more than cmin values. It does not hurt to have room
+    for a bit more values than cmax.
+  *****/
+  alloced = cmin + 4;
+  *values = (int*)calloc((size_t)alloced, sizeof(int));
+  if( ! *values ) {
+outMem:
+    fprintf(stderr, 
+	    "%s: out of memory while parsing option `%s'\n",
+	    Program, argv[i]);
+    exit(EXIT_FAILURE);
+  }
+
+  for(used=0; (cmax==-1 || used<cmax) && used+i+1<argc; used++) {
+    if( used==alloced ) {
+      alloced += 8;
+      *values = (int *) realloc(*values, alloced*sizeof(int));
+      if( !*values ) goto outMem;
+    }
+
+    errno = 0;
+    v = strtol(argv[used+i+1], &end, 0);
+
+    /***** check for conversion error */
+    if( end==argv[used+i+1] ) break;
+
+    /***** check for surplus non-whitespace */
+    while( isspace((int) *end) ) end+=1;
+    if( *end ) break;
+
+    /***** check for overflow */
+    if( errno==ERANGE || v>(long)INT_MAX || v<(long)INT_MIN ) {
+      fprintf(stderr, 
+	      "%s: parameter `%s' of option `%s' to large to represent\n",
+	      Program, argv[i+used+1], argv[i]);
+      exit(EXIT_FAILURE);
+    }
+
+    (*values)[used] = (int)v;
+
+  }
+    
+  if( used<cmin ) {
+    fprintf(stderr, 
+	    "%s: parameter `%s' of `%s' should be an "
+	    "integer value\n",
+	    Program, argv[i+used+1], argv[i]);
+    exit(EXIT_FAILURE);
+  }
+
+  return i+used;
+}
+/**********************************************************************/
+
+int
+getLongOpt(int argc, char **argv, int i, long *value, int force)
+{
+  char *end;
+
+  if( ++i>=argc ) goto nothingFound;
+
+  errno = 0;
+  *value = strtol(argv[i], &end, 0);
+
+  /***** check for conversion error */
+  if( end==argv[i] ) goto nothingFound;
+
+  /***** check for surplus non-whitespace */
+  while( isspace((int) *end) ) end+=1;
+  if( *end ) goto nothingFound;
+
+  /***** check for overflow */
+  if( errno==ERANGE ) {
+    fprintf(stderr, 
+	    "%s: parameter `%s' of option `%s' to large to represent\n",
+	    Program, argv[i], argv[i-1]);
+    exit(EXIT_FAILURE);
+  }
+  return i;
+
+nothingFound:
+  /***** !force means: this parameter may be missing.*/
+  if( !force ) return i-1;
+
+  fprintf(stderr, 
+	  "%s: missing or malformed value after option `%s'\n",
+	  Program, argv[i-1]);
+    exit(EXIT_FAILURE);
+}
+/**********************************************************************/
+
+int
+getLongOpts(int argc, char **argv, int i, 
+	    long **values,
+	    int cmin, int cmax)
+/*****
+  We want to find at least cmin values and at most cmax values.
+  cmax==-1 then means infinitely many are allowed.
+*****/
+{
+  int alloced, used;
+  char *end;
+
+  if( i+cmin >= argc ) {
+    fprintf(stderr, 
+	    "%s: option `%s' wants at least %d parameters\n",
+	    Program, argv[i], cmin);
+    exit(EXIT_FAILURE);
+  }
+
+  /***** 
+    alloc a bit more than cmin values. It does not hurt to have room
+    for a bit more values than cmax.
+  *****/
+  alloced = cmin + 4;
+  *values = (long int *)calloc((size_t)alloced, sizeof(long));
+  if( ! *values ) {
+outMem:
+    fprintf(stderr, 
+	    "%s: out of memory while parsing option `%s'\n",
+	    Program, argv[i]);
+    exit(EXIT_FAILURE);
+  }
+
+  for(used=0; (cmax==-1 || used<cmax) && used+i+1<argc; used++) {
+    if( used==alloced ) {
+      alloced += 8;
+      *values = (long int*) realloc(*values, alloced*sizeof(long));
+      if( !*values ) goto outMem;
+    }
+
+    errno = 0;
+    (*values)[used] = strtol(argv[used+i+1], &end, 0);
+
+    /***** check for conversion error */
+    if( end==argv[used+i+1] ) break;
+
+    /***** check for surplus non-whitespace */
+    while( isspace((int) *end) ) end+=1; 
+    if( *end ) break;
+
+    /***** check for overflow */
+    if( errno==ERANGE ) {
+      fprintf(stderr, 
+	      "%s: parameter `%s' of option `%s' to large to represent\n",
+	      Program, argv[i+used+1], argv[i]);
+      exit(EXIT_FAILURE);
+    }
+
+  }
+    
+  if( used<cmin ) {
+    fprintf(stderr, 
+	    "%s: parameter `%s' of `%s' should be an "
+	    "integer value\n",
+	    Program, argv[i+used+1], argv[i]);
+    exit(EXIT_FAILURE);
+  }
+
+  return i+used;
+}
+/**********************************************************************/
+
+int
+getFloatOpt(int argc, char **argv, int i, float *value, int force)
+{
+  char *end;
+  double v;
+
+  if( ++i>=argc ) goto nothingFound;
+
+  errno = 0;
+  v = strtod(argv[i], &end);
+
+  /***** check for conversion error */
+  if( end==argv[i] ) goto nothingFound;
+
+  /***** check for surplus non-whitespace */
+  while( isspace((int) *end) ) end+=1;
+  if( *end ) goto nothingFound;
+
+  /***** check for overflow */
+  checkFloatConversion(v, argv[i-1], argv[i]);
+
+  *value = (float)v;
+
+  return i;
+
+nothingFound:
+  if( !force ) return i-1;
+
+  fprintf(stderr,
+	  "%s: missing or malformed float value after option `%s'\n",
+	  Program, argv[i-1]);
+  exit(EXIT_FAILURE);
+ 
+}
+/**********************************************************************/
+
+int
+getFloatOpts(int argc, char **argv, int i, 
+	   float **values,
+	   int cmin, int cmax)
+/*****
+  We want to find at least cmin values and at most cmax values.
+  cmax==-1 then means infinitely many are allowed.
+*****/
+{
+  int alloced, used;
+  char *end;
+  double v;
+
+  if( i+cmin >= argc ) {
+    fprintf(stderr, 
+	    "%s: option `%s' wants at least %d parameters\n",
+	    Program, argv[i], cmin);
+    exit(EXIT_FAILURE);
+  }
+
+  /***** 
+    alloc a bit more than cmin values.
+  *****/
+  alloced = cmin + 4;
+  *values = (float*)calloc((size_t)alloced, sizeof(float));
+  if( ! *values ) {
+outMem:
+    fprintf(stderr, 
+	    "%s: out of memory while parsing option `%s'\n",
+	    Program, argv[i]);
+    exit(EXIT_FAILURE);
+  }
+
+  for(used=0; (cmax==-1 || used<cmax) && used+i+1<argc; used++) {
+    if( used==alloced ) {
+      alloced += 8;
+      *values = (float *) realloc(*values, alloced*sizeof(float));
+      if( !*values ) goto outMem;
+    }
+
+    errno = 0;
+    v = strtod(argv[used+i+1], &end);
+
+    /***** check for conversion error */
+    if( end==argv[used+i+1] ) break;
+
+    /***** check for surplus non-whitespace */
+    while( isspace((int) *end) ) end+=1;
+    if( *end ) break;
+
+    /***** check for overflow */
+    checkFloatConversion(v, argv[i], argv[i+used+1]);
+    
+    (*values)[used] = (float)v;
+  }
+    
+  if( used<cmin ) {
+    fprintf(stderr, 
+	    "%s: parameter `%s' of `%s' should be a "
+	    "floating-point value\n",
+	    Program, argv[i+used+1], argv[i]);
+    exit(EXIT_FAILURE);
+  }
+
+  return i+used;
+}
+/**********************************************************************/
+
+int
+getDoubleOpt(int argc, char **argv, int i, double *value, int force)
+{
+  char *end;
+
+  if( ++i>=argc ) goto nothingFound;
+
+  errno = 0;
+  *value = strtod(argv[i], &end);
+
+  /***** check for conversion error */
+  if( end==argv[i] ) goto nothingFound;
+
+  /***** check for surplus non-whitespace */
+  while( isspace((int) *end) ) end+=1;
+  if( *end ) goto nothingFound;
+
+  /***** check for overflow */
+  if( errno==ERANGE ) {
+    fprintf(stderr, 
+	    "%s: parameter `%s' of option `%s' to %s to represent\n",
+	    Program, argv[i], argv[i-1],
+	    (*value==0.0 ? "small" : "large"));
+    exit(EXIT_FAILURE);
+  }
+
+  return i;
+
+nothingFound:
+  if( !force ) return i-1;
+
+  fprintf(stderr,
+	  "%s: missing or malformed value after option `%s'\n",
+	  Program, argv[i-1]);
+  exit(EXIT_FAILURE);
+ 
+}
+/**********************************************************************/
+
+int
+getDoubleOpts(int argc, char **argv, int i, 
+	   double **values,
+	   int cmin, int cmax)
+/*****
+  We want to find at least cmin values and at most cmax values.
+  cmax==-1 then means infinitely many are allowed.
+*****/
+{
+  int alloced, used;
+  char *end;
+
+  if( i+cmin >= argc ) {
+    fprintf(stderr, 
+	    "%s: option `%s' wants at least %d parameters\n",
+	    Program, argv[i], cmin);
+    exit(EXIT_FAILURE);
+  }
+
+  /***** 
+    alloc a bit more than cmin values.
+  *****/
+  alloced = cmin + 4;
+  *values = (double*)calloc((size_t)alloced, sizeof(double));
+  if( ! *values ) {
+outMem:
+    fprintf(stderr, 
+	    "%s: out of memory while parsing option `%s'\n",
+	    Program, argv[i]);
+    exit(EXIT_FAILURE);
+  }
+
+  for(used=0; (cmax==-1 || used<cmax) && used+i+1<argc; used++) {
+    if( used==alloced ) {
+      alloced += 8;
+      *values = (double *) realloc(*values, alloced*sizeof(double));
+      if( !*values ) goto outMem;
+    }
+
+    errno = 0;
+    (*values)[used] = strtod(argv[used+i+1], &end);
+
+    /***** check for conversion error */
+    if( end==argv[used+i+1] ) break;
+
+    /***** check for surplus non-whitespace */
+    while( isspace((int) *end) ) end+=1;
+    if( *end ) break;
+
+    /***** check for overflow */
+    if( errno==ERANGE ) {
+      fprintf(stderr, 
+	      "%s: parameter `%s' of option `%s' to %s to represent\n",
+	      Program, argv[i+used+1], argv[i],
+	      ((*values)[used]==0.0 ? "small" : "large"));
+      exit(EXIT_FAILURE);
+    }
+
+  }
+    
+  if( used<cmin ) {
+    fprintf(stderr, 
+	    "%s: parameter `%s' of `%s' should be a "
+	    "double value\n",
+	    Program, argv[i+used+1], argv[i]);
+    exit(EXIT_FAILURE);
+  }
+
+  return i+used;
+}
+/**********************************************************************/
+
+/**
+  force will be set if we need at least one argument for the option.
+*****/
+int
+getStringOpt(int argc, char **argv, int i, char **value, int force)
+{
+  i += 1;
+  if( i>=argc ) {
+    if( force ) {
+      fprintf(stderr, "%s: missing string after option `%s'\n",
+	      Program, argv[i-1]);
+      exit(EXIT_FAILURE);
+    } 
+    return i-1;
+  }
+  
+  if( !force && argv[i][0] == '-' ) return i-1;
+  *value = argv[i];
+  return i;
+}
+/**********************************************************************/
+
+int
+getStringOpts(int argc, char **argv, int i, 
+	   char*  **values,
+	   int cmin, int cmax)
+/*****
+  We want to find at least cmin values and at most cmax values.
+  cmax==-1 then means infinitely many are allowed.
+*****/
+{
+  int alloced, used;
+
+  if( i+cmin >= argc ) {
+    fprintf(stderr, 
+	    "%s: option `%s' wants at least %d parameters\n",
+	    Program, argv[i], cmin);
+    exit(EXIT_FAILURE);
+  }
+
+  alloced = cmin + 4;
+    
+  *values = (char**)calloc((size_t)alloced, sizeof(char*));
+  if( ! *values ) {
+outMem:
+    fprintf(stderr, 
+	    "%s: out of memory during parsing of option `%s'\n",
+	    Program, argv[i]);
+    exit(EXIT_FAILURE);
+  }
+
+  for(used=0; (cmax==-1 || used<cmax) && used+i+1<argc; used++) {
+    if( used==alloced ) {
+      alloced += 8;
+      *values = (char **)realloc(*values, alloced*sizeof(char*));
+      if( !*values ) goto outMem;
+    }
+
+    if( used>=cmin && argv[used+i+1][0]=='-' ) break;
+    (*values)[used] = argv[used+i+1];
+  }
+    
+  if( used<cmin ) {
+    fprintf(stderr, 
+    "%s: less than %d parameters for option `%s', only %d found\n",
+	    Program, cmin, argv[i], used);
+    exit(EXIT_FAILURE);
+  }
+
+  return i+used;
+}
+/**********************************************************************/
+
+void
+checkIntLower(char *opt, int *values, int count, int max)
+{
+  int i;
+
+  for(i=0; i<count; i++) {
+    if( values[i]<=max ) continue;
+    fprintf(stderr, 
+	    "%s: parameter %d of option `%s' greater than max=%d\n",
+	    Program, i+1, opt, max);
+    exit(EXIT_FAILURE);
+  }
+}
+/**********************************************************************/
+
+void
+checkIntHigher(char *opt, int *values, int count, int min)
+{
+  int i;
+
+  for(i=0; i<count; i++) {
+    if( values[i]>=min ) continue;
+    fprintf(stderr, 
+	    "%s: parameter %d of option `%s' smaller than min=%d\n",
+	    Program, i+1, opt, min);
+    exit(EXIT_FAILURE);
+  }
+}
+/**********************************************************************/
+
+void
+checkLongLower(char *opt, long *values, int count, long max)
+{
+  int i;
+
+  for(i=0; i<count; i++) {
+    if( values[i]<=max ) continue;
+    fprintf(stderr, 
+	    "%s: parameter %d of option `%s' greater than max=%ld\n",
+	    Program, i+1, opt, max);
+    exit(EXIT_FAILURE);
+  }
+}
+/**********************************************************************/
+
+void
+checkLongHigher(char *opt, long *values, int count, long min)
+{
+  int i;
+
+  for(i=0; i<count; i++) {
+    if( values[i]>=min ) continue;
+    fprintf(stderr, 
+	    "%s: parameter %d of option `%s' smaller than min=%ld\n",
+	    Program, i+1, opt, min);
+    exit(EXIT_FAILURE);
+  }
+}
+/**********************************************************************/
+
+void
+checkFloatLower(char *opt, float *values, int count, float max)
+{
+  int i;
+
+  for(i=0; i<count; i++) {
+    if( values[i]<=max ) continue;
+    fprintf(stderr, 
+	    "%s: parameter %d of option `%s' greater than max=%f\n",
+	    Program, i+1, opt, max);
+    exit(EXIT_FAILURE);
+  }
+}
+/**********************************************************************/
+
+void
+checkFloatHigher(char *opt, float *values, int count, float min)
+{
+  int i;
+
+  for(i=0; i<count; i++) {
+    if( values[i]>=min ) continue;
+    fprintf(stderr, 
+	    "%s: parameter %d of option `%s' smaller than min=%f\n",
+	    Program, i+1, opt, min);
+    exit(EXIT_FAILURE);
+  }
+}
+/**********************************************************************/
+
+void
+checkDoubleLower(char *opt, double *values, int count, double max)
+{
+  int i;
+
+  for(i=0; i<count; i++) {
+    if( values[i]<=max ) continue;
+    fprintf(stderr, 
+	    "%s: parameter %d of option `%s' greater than max=%f\n",
+	    Program, i+1, opt, max);
+    exit(EXIT_FAILURE);
+  }
+}
+/**********************************************************************/
+
+void
+checkDoubleHigher(char *opt, double *values, int count, double min)
+{
+  int i;
+
+  for(i=0; i<count; i++) {
+    if( values[i]>=min ) continue;
+    fprintf(stderr, 
+	    "%s: parameter %d of option `%s' smaller than min=%f\n",
+	    Program, i+1, opt, min);
+    exit(EXIT_FAILURE);
+  }
+}
+/**********************************************************************/
+
+static void
+missingErr(char *opt)
+{
+  fprintf(stderr, "%s: mandatory option `%s' missing\n",
+	  Program, opt);
+}
+/**********************************************************************/
+
+static char *
+catArgv(int argc, char **argv)
+{
+  int i;
+  size_t l;
+  char *s, *t;
+
+  for(i=0, l=0; i<argc; i++) l += (1+strlen(argv[i]));
+  s = (char *)malloc(l);
+  if( !s ) {
+    fprintf(stderr, "%s: out of memory\n", Program);
+    exit(EXIT_FAILURE);
+  }
+  strcpy(s, argv[0]);
+  t = s;
+  for(i=1; i<argc; i++) {
+    t = t+strlen(t);
+    *t++ = ' ';
+    strcpy(t, argv[i]);
+  }
+  return s;
+}
+/**********************************************************************/
+
+void
+showOptionValues(void)
+{
+  int i;
+
+  printf("Full command line is:\n`%s'\n", cmd.full_cmd_line);
+
+  /***** -ncpus: Number of processors to use with OpenMP */
+  if( !cmd.ncpusP ) {
+    printf("-ncpus not found.\n");
+  } else {
+    printf("-ncpus found:\n");
+    if( !cmd.ncpusC ) {
+      printf("  no values\n");
+    } else {
+      printf("  value = `%d'\n", cmd.ncpus);
+    }
+  }
+
+  /***** -nbeams: The number of beams a signal must be seen in to be RFI (default is more than half of the beams) */
+  if( !cmd.nbeamsP ) {
+    printf("-nbeams not found.\n");
+  } else {
+    printf("-nbeams found:\n");
+    if( !cmd.nbeamsC ) {
+      printf("  no values\n");
+    } else {
+      printf("  value = `%d'\n", cmd.nbeams);
+    }
+  }
+
+  /***** -mbsig: The +/-sigma cutoff for a signal in a single beam to count towards a coincidence */
+  if( !cmd.mbsigmaP ) {
+    printf("-mbsig not found.\n");
+  } else {
+    printf("-mbsig found:\n");
+    if( !cmd.mbsigmaC ) {
+      printf("  no values\n");
+    } else {
+      printf("  value = `%.40g'\n", cmd.mbsigma);
+    }
+  }
+
+  /***** -timesig: The +/-sigma cutoff to reject time-domain chunks in each beam by itself (as in rfifind) */
+  if( !cmd.timesigmaP ) {
+    printf("-timesig not found.\n");
+  } else {
+    printf("-timesig found:\n");
+    if( !cmd.timesigmaC ) {
+      printf("  no values\n");
+    } else {
+      printf("  value = `%.40g'\n", cmd.timesigma);
+    }
+  }
+
+  /***** -freqsig: The +/-sigma cutoff to reject freq-domain chunks in each beam by itself (as in rfifind) */
+  if( !cmd.freqsigmaP ) {
+    printf("-freqsig not found.\n");
+  } else {
+    printf("-freqsig found:\n");
+    if( !cmd.freqsigmaC ) {
+      printf("  no values\n");
+    } else {
+      printf("  value = `%.40g'\n", cmd.freqsigma);
+    }
+  }
+
+  /***** -chanfrac: The fraction of bad channels that will mask a full interval */
+  if( !cmd.chantrigfracP ) {
+    printf("-chanfrac not found.\n");
+  } else {
+    printf("-chanfrac found:\n");
+    if( !cmd.chantrigfracC ) {
+      printf("  no values\n");
+    } else {
+      printf("  value = `%.40g'\n", cmd.chantrigfrac);
+    }
+  }
+
+  /***** -intfrac: The fraction of bad intervals that will mask a full channel */
+  if( !cmd.inttrigfracP ) {
+    printf("-intfrac not found.\n");
+  } else {
+    printf("-intfrac found:\n");
+    if( !cmd.inttrigfracC ) {
+      printf("  no values\n");
+    } else {
+      printf("  value = `%.40g'\n", cmd.inttrigfrac);
+    }
+  }
+
+  /***** -time: Seconds to integrate for stats and FFT calcs of '.dat' files */
+  if( !cmd.timeP ) {
+    printf("-time not found.\n");
+  } else {
+    printf("-time found:\n");
+    if( !cmd.timeC ) {
+      printf("  no values\n");
+    } else {
+      printf("  value = `%.40g'\n", cmd.time);
+    }
+  }
+
+  /***** -normlen: Number of Fourier bins in each block of the '.fft' files normalized by its median power */
+  if( !cmd.normlenP ) {
+    printf("-normlen not found.\n");
+  } else {
+    printf("-normlen found:\n");
+    if( !cmd.normlenC ) {
+      printf("  no values\n");
+    } else {
+      printf("  value = `%d'\n", cmd.normlen);
+    }
+  }
+
+  /***** -binerr: Number of Fourier bins that coincident signals in the '.fft' files may differ by */
+  if( !cmd.binerrP ) {
+    printf("-binerr not found.\n");
+  } else {
+    printf("-binerr found:\n");
+    if( !cmd.binerrC ) {
+      printf("  no values\n");
+    } else {
+      printf("  value = `%d'\n", cmd.binerr);
+    }
+  }
+
+  /***** -o: Suffix added to each beam's root name for its output files */
+  if( !cmd.suffixP ) {
+    printf("-o not found.\n");
+  } else {
+    printf("-o found:\n");
+    if( !cmd.suffixC ) {
+      printf("  no values\n");
+    } else {
+      printf("  value = `%s'\n", cmd.suffix);
+    }
+  }
+  if( !cmd.argc ) {
+    printf("no remaining parameters in argv\n");
+  } else {
+    printf("argv =");
+    for(i=0; i<cmd.argc; i++) {
+      printf(" `%s'", cmd.argv[i]);
+    }
+    printf("\n");
+  }
+}
+/**********************************************************************/
+
+void
+usage(void)
+{
+  fprintf(stderr,"%s","   [-ncpus ncpus] [-nbeams nbeams] [-mbsig mbsigma] [-timesig timesigma] [-freqsig freqsigma] [-chanfrac chantrigfrac] [-intfrac inttrigfrac] [-time time] [-normlen normlen] [-binerr binerr] [-o suffix] [--] infile ...\n");
+  fprintf(stderr,"%s","      Finds terrestrial RFI as signals that are coincident in many of the simultaneously recorded beams of a multibeam observation.  The inputs are one file per beam: rfifind '.stats' files (made from each beam's raw data), zero-DM '.dat' files, or zero-DM '.fft' files.  Per-beam '.mask' files are written for '.stats' and '.dat' inputs and per-beam '.zaplist' files for '.fft' inputs.\n");
+  fprintf(stderr,"%s","       -ncpus: Number of processors to use with OpenMP\n");
+  fprintf(stderr,"%s","               1 int value between 1 and oo\n");
+  fprintf(stderr,"%s","               default: `1'\n");
+  fprintf(stderr,"%s","      -nbeams: The number of beams a signal must be seen in to be RFI (default is more than half of the beams)\n");
+  fprintf(stderr,"%s","               1 int value between 2 and oo\n");
+  fprintf(stderr,"%s","       -mbsig: The +/-sigma cutoff for a signal in a single beam to count towards a coincidence\n");
+  fprintf(stderr,"%s","               1 float value between 0 and oo\n");
+  fprintf(stderr,"%s","               default: `3'\n");
+  fprintf(stderr,"%s","     -timesig: The +/-sigma cutoff to reject time-domain chunks in each beam by itself (as in rfifind)\n");
+  fprintf(stderr,"%s","               1 float value between 0 and oo\n");
+  fprintf(stderr,"%s","               default: `10'\n");
+  fprintf(stderr,"%s","     -freqsig: The +/-sigma cutoff to reject freq-domain chunks in each beam by itself (as in rfifind)\n");
+  fprintf(stderr,"%s","               1 float value between 0 and oo\n");
+  fprintf(stderr,"%s","               default: `4'\n");
+  fprintf(stderr,"%s","    -chanfrac: The fraction of bad channels that will mask a full interval\n");
+  fprintf(stderr,"%s","               1 float value between 0.0 and 1.0\n");
+  fprintf(stderr,"%s","               default: `0.7'\n");
+  fprintf(stderr,"%s","     -intfrac: The fraction of bad intervals that will mask a full channel\n");
+  fprintf(stderr,"%s","               1 float value between 0.0 and 1.0\n");
+  fprintf(stderr,"%s","               default: `0.3'\n");
+  fprintf(stderr,"%s","        -time: Seconds to integrate for stats and FFT calcs of '.dat' files\n");
+  fprintf(stderr,"%s","               1 double value between 0 and oo\n");
+  fprintf(stderr,"%s","               default: `2.0'\n");
+  fprintf(stderr,"%s","     -normlen: Number of Fourier bins in each block of the '.fft' files normalized by its median power\n");
+  fprintf(stderr,"%s","               1 int value between 16 and oo\n");
+  fprintf(stderr,"%s","               default: `2048'\n");
+  fprintf(stderr,"%s","      -binerr: Number of Fourier bins that coincident signals in the '.fft' files may differ by\n");
+  fprintf(stderr,"%s","               1 int value between 0 and oo\n");
+  fprintf(stderr,"%s","               default: `1'\n");
+  fprintf(stderr,"%s","           -o: Suffix added to each beam's root name for its output files\n");
+  fprintf(stderr,"%s","               1 char* value\n");
+  fprintf(stderr,"%s","               default: `_mb'\n");
+  fprintf(stderr,"%s","       infile: Input files (one per beam, all of the same type)\n");
+  fprintf(stderr,"%s","               2...oo values\n");
+  fprintf(stderr,"%s","  version: 18Oct26\n");
+  fprintf(stderr,"%s","  ");
+  exit(EXIT_FAILURE);
+}
+/**********************************************************************/
+Cmdline *
+parseCmdline(int argc, char **argv)
+{
+  int i;
+
+  Program = argv[0];
+  cmd.full_cmd_line = catArgv(argc, argv);
+  for(i=1, cmd.argc=1; i<argc; i++) {
+    if( 0==strcmp("--", argv[i]) ) {
+      while( ++i<argc ) argv[cmd.argc++] = argv[i];
+      continue;
+    }
+
+    if( 0==strcmp("-ncpus", argv[i]) ) {
+      int keep = i;
+      cmd.ncpusP = 1;
+      i = getIntOpt(argc, argv, i, &cmd.ncpus, 1);
+      cmd.ncpusC = i-keep;
+      checkIntHigher("-ncpus", &cmd.ncpus, cmd.ncpusC, 1);
+      continue;
+    }
+
+    if( 0==strcmp("-nbeams", argv[i]) ) {
+      int keep = i;
+      cmd.nbeamsP = 1;
+      i = getIntOpt(argc, argv, i, &cmd.nbeams, 1);
+      cmd.nbeamsC = i-keep;
+      checkIntHigher("-nbeams", &cmd.nbeams, cmd.nbeamsC, 2);
+      continue;
+    }
+
+    if( 0==strcmp("-mbsig", argv[i]) ) {
+      int keep = i;
+      cmd.mbsigmaP = 1;
+      i = getFloatOpt(argc, argv, i, &cmd.mbsigma, 1);
+      cmd.mbsigmaC = i-keep;
+      checkFloatHigher("-mbsig", &cmd.mbsigma, cmd.mbsigmaC, 0);
+      continue;
+    }
+
+    if( 0==strcmp("-timesig", argv[i]) ) {
+      int keep = i;
+      cmd.timesigmaP = 1;
+      i = getFloatOpt(argc, argv, i, &cmd.timesigma, 1);
+      cmd.timesigmaC = i-keep;
+      checkFloatHigher("-timesig", &cmd.timesigma, cmd.timesigmaC, 0);
+      continue;
+    }
+
+    if( 0==strcmp("-freqsig", argv[i]) ) {
+      int keep = i;
+      cmd.freqsigmaP = 1;
+      i = getFloatOpt(argc, argv, i, &cmd.freqsigma, 1);
+      cmd.freqsigmaC = i-keep;
+      checkFloatHigher("-freqsig", &cmd.freqsigma, cmd.freqsigmaC, 0);
+      continue;
+    }
+
+    if( 0==strcmp("-chanfrac", argv[i]) ) {
+      int keep = i;
+      cmd.chantrigfracP = 1;
+      i = getFloatOpt(argc, argv, i, &cmd.chantrigfrac, 1);
+      cmd.chantrigfracC = i-keep;
+      checkFloatLower("-chanfrac", &cmd.chantrigfrac, cmd.chantrigfracC, 1.0);
+      checkFloatHigher("-chanfrac", &cmd.chantrigfrac, cmd.chantrigfracC, 0.0);
+      continue;
+    }
+
+    if( 0==strcmp("-intfrac", argv[i]) ) {
+      int keep = i;
+      cmd.inttrigfracP = 1;
+      i = getFloatOpt(argc, argv, i, &cmd.inttrigfrac, 1);
+      cmd.inttrigfracC = i-keep;
+      checkFloatLower("-intfrac", &cmd.inttrigfrac, cmd.inttrigfracC, 1.0);
+      checkFloatHigher("-intfrac", &cmd.inttrigfrac, cmd.inttrigfracC, 0.0);
+      continue;
+    }
+
+    if( 0==strcmp("-time", argv[i]) ) {
+      int keep = i;
+      cmd.timeP = 1;
+      i = getDoubleOpt(argc, argv, i, &cmd.time, 1);
+      cmd.timeC = i-keep;
+      checkDoubleHigher("-time", &cmd.time, cmd.timeC, 0);
+      continue;
+    }
+
+    if( 0==strcmp("-normlen", argv[i]) ) {
+      int keep = i;
+      cmd.normlenP = 1;
+      i = getIntOpt(argc, argv, i, &cmd.normlen, 1);
+      cmd.normlenC = i-keep;
+      checkIntHigher("-normlen", &cmd.normlen, cmd.normlenC, 16);
+      continue;
+    }
+
+    if( 0==strcmp("-binerr", argv[i]) ) {
+      int keep = i;
+      cmd.binerrP = 1;
+      i = getIntOpt(argc, argv, i, &cmd.binerr, 1);
+      cmd.binerrC = i-keep;
+      checkIntHigher("-binerr", &cmd.binerr, cmd.binerrC, 0);
+      continue;
+    }
+
+    if( 0==strcmp("-o", argv[i]) ) {
+      int keep = i;
+      cmd.suffixP = 1;
+      i = getStringOpt(argc, argv, i, &cmd.suffix, 1);
+      cmd.suffixC = i-keep;
+      continue;
+    }
+
+    if( argv[i][0]=='-' ) {
+      fprintf(stderr, "\n%s: unknown option `%s'\n\n",
+              Program, argv[i]);
+      usage();
+    }
+    argv[cmd.argc++] = argv[i];
+  }/* for i */
+
+
+  /*@-mustfree*/
+  cmd.argv = argv+1;
+  /*@=mustfree*/
+  cmd.argc -= 1;
+
+  if( 2>cmd.argc ) {
+    fprintf(stderr, "%s: there should be at least 2 non-option argument(s)\n",
+            Program);
+    exit(EXIT_FAILURE);
+  }
+  /*@-compmempass*/  return &cmd;
+}
+
@@ -13,15 +13,47 @@
 
 static unsigned char tmpswap;
 
+presto_status try_fopen(char *path, const char *mode, FILE ** file)
+{
+    if ((*file = fopen(path, mode)) == NULL)
+        return PRESTO_ERR_IO;
+    return PRESTO_OK;
+}
+
+
+presto_status try_fread(void *data, size_t type, size_t number, FILE * stream,
+                        size_t * numread)
+{
+    *numread = fread(data, type, number, stream);
+    if (*numread != number)
+        return ferror(stream) ? PRESTO_ERR_IO : PRESTO_ERR_EOF;
+    return PRESTO_OK;
+}
+
+
+presto_status try_fwrite(void *data, size_t type, size_t number, FILE * stream)
+{
+    if (fwrite(data, type, number, stream) != number)
+        return PRESTO_ERR_IO;
+    return PRESTO_OK;
+}
+
+
+presto_status try_fileseek(FILE * stream, off_t offset, size_t size, int whence)
+{
+    if (fseeko(stream, offset * size, whence) == -1)
+        return PRESTO_ERR_IO;
+    return PRESTO_OK;
+}
+
+
 FILE *chkfopen(char *path, const char *mode)
 {
     FILE *file;
 
-    if ((file = fopen(path, mode)) == NULL) {
-        perror("\nError in chkfopen()");
-        printf("   path = '%s'\n", path);
-        exit(-1);
-    }
+    if (try_fopen(path, mode, &file) != PRESTO_OK)
+        presto_perror(PRESTO_ERR_IO, "chkfopen() can't open '%s' (mode '%s')",
+                      path, mode);
     return (file);
 }
 
@@ -30,12 +62,8 @@ size_t chkfread(void *data, size_t type, size_t number, FILE * stream)
 {
     size_t num;
 
-    num = fread(data, type, number, stream);
-    if (num != number && ferror(stream)) {
-        perror("\nError in chkfread()");
-        printf("\n");
-        exit(-1);
-    }
+    if (try_fread(data, type, number, stream, &num) == PRESTO_ERR_IO)
+        presto_perror(PRESTO_ERR_IO, "chkfread() failed");
     return num;
 }
 
@@ -45,11 +73,8 @@ size_t chkfwrite(void *data, size_t type, size_t number, FILE * stream)
     size_t num;
 
     num = fwrite(data, type, number, stream);
-    if (num != number && ferror(stream)) {
-        perror("\nError in chkfwrite()");
-        printf("\n");
-        exit(-1);
-    }
+    if (num != number && ferror(stream))
+        presto_perror(PRESTO_ERR_IO, "chkfwrite() failed");
     return num;
 }
 
@@ -64,14 +89,9 @@ size_t chkfseek(FILE * stream, long offset, int whence)
 
 size_t chkfileseek(FILE * stream, off_t offset, size_t size, int whence)
 {
-    int rt;
-
-    if ((rt = fseeko(stream, offset * size, whence)) == -1) {
-        perror("\nError in chkfileseek()");
-        printf("\n");
-        exit(-1);
-    }
-    return (rt);
+    if (try_fileseek(stream, offset, size, whence) != PRESTO_OK)
+        presto_perror(PRESTO_ERR_IO, "chkfileseek() failed");
+    return (0);
 }
 
 
@@ -82,11 +102,8 @@ long long chkfilelen(FILE * file, size_t size)
 
     filenum = fileno(file);
     rt = fstat(filenum, &buf);
-    if (rt == -1) {
-        perror("\nError in chkfilelen()");
-        printf("\n");
-        exit(-1);
-    }
+    if (rt == -1)
+        presto_perror(PRESTO_ERR_IO, "chkfilelen() failed");
     return (long long) (buf.st_size / size);
 }
 
@@ -93,11 +93,10 @@ int clip_times(float *rawdata, int ptsperblk, int numchan, float clip_sigma,
         powptr = rawdata + loffset;
         for (jj = 0; jj < numchan; jj++)
             zero_dm_block[ii] += *powptr++;
-        ftmp[ii] = zero_dm_block[ii];
     }
-    avg_var(ftmp, ptsperblk, &current_avg, &current_std);
+    avg_var(zero_dm_block, ptsperblk, &current_avg, &current_std);
     current_std = sqrt(current_std);
-    current_med = median(ftmp, ptsperblk);
+    current_med = median_nocopy(zero_dm_block, ptsperblk);
 
     /* Calculate the current standard deviation and mean  */
     /* but only for data points that are within a certain */
@@ -252,9 +251,8 @@ int old_clip_times(float *rawdata, int ptsperblk, int numchan, float clip_sigma,
         powptr = rawdata + ii * numchan;
         for (jj = 0; jj < numchan; jj++)
             zero_dm_block[ii] += *powptr++;
-        median_temp[ii] = zero_dm_block[ii];
     }
-    current_med = median(median_temp, ptsperblk);
+    current_med = median_nocopy(zero_dm_block, ptsperblk);
 
     /* Calculate the current standard deviation and mean  */
     /* but only for data points that are within a certain */
@@ -1,8 +1,22 @@
 #include "presto.h"
 #include "ctype.h"
 
-static psrparams pulsardata[NP];
-static int np = 0, have_database = 0;
+static psrparams *pulsardata = NULL;
+static int np = 0, maxnp = 0, have_database = 0;
+
+/* The sky-position and frequency index of the database used for    */
+/* matching candidates (see build_database_index()).  The sky is    */
+/* split into declination bands of height DBCELLSIZE, and each band */
+/* into roughly equal-area cells in RA (like HEALPix rings).  The   */
+/* pulsars in each cell are sorted by their catalog spin frequency. */
+#define DBCELLSIZE (1.0 * DEGTORAD)
+static int have_index = 0, numbands = 0, numcells = 0;
+static int *bandcell = NULL;    /* First cell of each band (numbands+1)  */
+static int *cellstart = NULL;   /* First entry of each cell (numcells+1) */
+static int *cellpsrs = NULL;    /* Pulsar numbers sorted by cell and f   */
+static double *cellfreqs = NULL;        /* Their catalog spin frequencies  */
+static double *cellmaxpdp = NULL;       /* Max |pd/p| of each cell (1/s)   */
+static double *cellminep = NULL, *cellmaxep = NULL;     /* Epoch ranges    */
 
 static char num[41][5] = { "0th", "1st", "2nd", "3rd", "4th", "5th", "6th",
     "7th", "8th", "9th", "10th", "11th", "12th",
@@ -14,24 +28,166 @@ static char num[41][5] = { "0th", "1st", "2nd", "3rd", "4th", "5th", "6th",
 };
 
 
+static psrparams *next_database_entry(void)
+/* Return a pointer to the next (new) entry in the database, */
+/* growing the database as needed.                           */
+{
+    if (np >= maxnp) {
+        maxnp = (maxnp) ? 2 * maxnp : NP;
+        pulsardata = (psrparams *) realloc(pulsardata, maxnp * sizeof(psrparams));
+        if (!pulsardata) {
+            perror("\nError in realloc() in next_database_entry()");
+            printf("\n");
+            exit(-1);
+        }
+    }
+    memset(pulsardata + np, 0, sizeof(psrparams));
+    return pulsardata + np;
+}
+
+
+static double sexagesimal_to_rad(char *str, double unit)
+/* Convert a string like '[+-]dd[:mm[:ss.sss]]' to radians where */
+/* 'unit' is the size of the first field in arcsec.              */
+{
+    int ii;
+    double sign = 1.0, val = 0.0, scale = 1.0;
+    char *ptr = str, *end;
+
+    while (isspace(*ptr))
+        ptr++;
+    if (*ptr == '-' || *ptr == '+') {
+        if (*ptr == '-')
+            sign = -1.0;
+        ptr++;
+    }
+    for (ii = 0; ii < 3; ii++, scale /= 60.0) {
+        val += scale * strtod(ptr, &end);
+        if (end == ptr || *end != ':')
+            break;
+        ptr = end + 1;
+    }
+    return sign * val * unit * ARCSEC2RAD;
+}
+
+
+static int read_psrcat_text(char *filenm)
+/* Read a psrcat text dump (the ';'-separated "Long csv with  */
+/* errors" format used for $PRESTO/lib/psr_catalog.txt) and   */
+/* append the pulsars to the database.  The first line of the */
+/* file must name the columns.  Returns the number of pulsars */
+/* read.  Pulsars without positions or frequencies are        */
+/* skipped.                                                   */
+{
+    enum { NAME, PSRJ, RAJ, DECJ, F0, F1, PEPOCH, DM, BINARY, T0, PB,
+        A1, OM, ECC, TASC, EPS1, EPS2, NUMCOLS
+    };
+    char *colnames[NUMCOLS] = { "NAME", "PSRJ", "RAJ", "DECJ", "F0", "F1",
+        "PEPOCH", "DM", "BINARY", "T0", "PB", "A1", "OM", "ECC", "TASC",
+        "EPS1", "EPS2"
+    };
+    int ii, col, cols[NUMCOLS], numread = 0;
+    char line[10000], *vals[NUMCOLS], *field, *ptr;
+    FILE *infile;
+    psrparams *psr;
+
+    infile = chkfopen(filenm, "r");
+
+    /* Find the columns that we need from the header */
+    for (ii = 0; ii < NUMCOLS; ii++)
+        cols[ii] = -1;
+    if (fgets(line, sizeof(line), infile) == NULL || line[0] != '#') {
+        printf("\nThe first line of '%s' does not name the columns!\n\n", filenm);
+        exit(1);
+    }
+    for (ptr = line, col = 0; (field = strsep(&ptr, ";\r\n")) != NULL; col++)
+        for (ii = 0; ii < NUMCOLS; ii++)
+            if (cols[ii] < 0 && strcmp(field, colnames[ii]) == 0)
+                cols[ii] = col;
+    if (cols[PSRJ] < 0 || cols[RAJ] < 0 || cols[DECJ] < 0 || cols[F0] < 0) {
+        printf("\n'%s' needs at least PSRJ, RAJ, DECJ, and F0 columns!\n\n",
+               filenm);
+        exit(1);
+    }
+
+    while (fgets(line, sizeof(line), infile) != NULL) {
+        /* Skip the units line and anything else that is not a pulsar */
+        if (!isdigit(line[0]))
+            continue;
+        for (ii = 0; ii < NUMCOLS; ii++)
+            vals[ii] = "*";
+        for (ptr = line, col = 0; (field = strsep(&ptr, ";\r\n")) != NULL; col++)
+            for (ii = 0; ii < NUMCOLS; ii++)
+                if (cols[ii] == col && field[0] != '\0')
+                    vals[ii] = field;
+        if (vals[PSRJ][0] == '*' || vals[RAJ][0] == '*' ||
+            vals[DECJ][0] == '*' || vals[F0][0] == '*')
+            continue;
+
+        psr = next_database_entry();
+        strncpy(psr->jname, vals[PSRJ] + 1, sizeof(psr->jname) - 1);
+        if (vals[NAME][0] == 'B')
+            strncpy(psr->bname, vals[NAME] + 1, sizeof(psr->bname) - 1);
+        psr->ra2000 = sexagesimal_to_rad(vals[RAJ], 15.0 * 3600.0);
+        psr->dec2000 = sexagesimal_to_rad(vals[DECJ], 3600.0);
+        psr->dm = (vals[DM][0] == '*') ? 0.0 : strtod(vals[DM], NULL);
+        psr->timepoch = (vals[PEPOCH][0] == '*') ? 51000.0 : strtod(vals[PEPOCH], NULL);
+        psr->f = strtod(vals[F0], NULL);
+        psr->fd = (vals[F1][0] == '*') ? 0.0 : strtod(vals[F1], NULL);
+        psr->p = 1.0 / psr->f;
+        psr->pd = -psr->fd / (psr->f * psr->f);
+        if (vals[BINARY][0] != '*') {
+            psr->orb.p = (vals[PB][0] == '*') ? 0.0 : strtod(vals[PB], NULL);
+            psr->orb.x = (vals[A1][0] == '*') ? 0.0 : strtod(vals[A1], NULL);
+            psr->orb.e = (vals[ECC][0] == '*') ? 0.0 : strtod(vals[ECC], NULL);
+            psr->orb.w = (vals[OM][0] == '*') ? 0.0 : strtod(vals[OM], NULL);
+            psr->orb.t = (vals[T0][0] == '*') ? 0.0 : strtod(vals[T0], NULL);
+            if (strcmp(vals[BINARY], "ELL1") == 0) {
+                double eps1, eps2;
+                if (vals[TASC][0] != '*')
+                    psr->orb.t = strtod(vals[TASC], NULL);
+                eps1 = (vals[EPS1][0] == '*') ? 0.0 : strtod(vals[EPS1], NULL);
+                eps2 = (vals[EPS2][0] == '*') ? 0.0 : strtod(vals[EPS2], NULL);
+                if (vals[EPS2][0] != '*') {
+                    psr->orb.e = sqrt(eps1 * eps1 + eps2 * eps2);
+                    psr->orb.w = atan2(eps1, eps2) / DEGTORAD;
+                    if (psr->orb.w < 0.0)
+                        psr->orb.w += 360.0;
+                }
+            }
+        }
+        np++;
+        numread++;
+    }
+    fclose(infile);
+    return numread;
+}
+
+
 int read_database(void)
 /* Reads the full pulsar database into the static array psrdata */
+/* If the environment variable PSRCAT_FILE is set, it names a   */
+/* psrcat text dump to read instead of $PRESTO/lib/pulsars.cat. */
 {
     FILE *database;
-    char databasenm[200];
+    char databasenm[200], *psrcatnm;
     psrdata pdata;
     binpsrdata bpdata;
 
+    /* Read a psrcat text file instead if requested */
+    psrcatnm = getenv("PSRCAT_FILE");
+    if (psrcatnm != NULL && strlen(psrcatnm) > 0) {
+        read_psrcat_text(psrcatnm);
+        have_database = 1;
+        return np;
+    }
+
     /* Open the binary data file */
     sprintf(databasenm, "%s/lib/pulsars.cat", getenv("PRESTO"));
     database = chkfopen(databasenm, "rb");
 
     while (chkfread(&pdata, sizeof(psrdata), 1, database)) {
-        if (np >= NP) {
-            printf("NP value set too small (%d) in $PRESTO/include/database.h\n", NP);
-            printf("Please increase it and recompile\n");
-            exit(-1);
-        }
+        next_database_entry();
         strncpy(pulsardata[np].jname, pdata.jname, sizeof(pulsardata[np].jname));
         pulsardata[np].jname[sizeof(pulsardata[np].jname)-1] = '\0';
         strncpy(pulsardata[np].bname, pdata.bname, sizeof(pulsardata[np].bname));
@@ -228,158 +384,252 @@ int get_psr_at_epoch(char *psrname, double epoch, psrparams * psr)
 }
 
 
-int comp_psr_to_cand(fourierprops * cand, infodata * idata, char *output, int full)
-/* Compares a pulsar candidate defined by its properties found in   */
-/*   *cand, and *idata with all of the pulsars in the pulsar        */
-/*   database.  It returns a string (verbose if full==1) describing */
-/*   the results of the search in *output.                          */
+static int compare_cell_entries(const void *ca, const void *cb)
+/* Sort index entries by cell and then by spin frequency */
 {
-    int ii, jj;
-    static infodata *old_idata;
-    double theor, theoz, sidedr = 20.0;
-    double r_criteria, z_criteria, rdiff, zdiff, difft = 0;
-    static double T, beam2, ra, dec, epoch;
-    char tmp1[80], tmp2[80], tmp3[80], shortout[30], psrname[20];
-    rzwerrs rzws;
+    const double *a = (const double *) ca, *b = (const double *) cb;
 
-    /* Read the database if needed */
+    if (a[0] != b[0])
+        return (a[0] < b[0]) ? -1 : 1;
+    if (a[1] != b[1])
+        return (a[1] < b[1]) ? -1 : 1;
+    return (a[2] < b[2]) ? -1 : (a[2] > b[2]);
+}
 
-    if (!have_database)
-        np = read_database();
 
-    /* If calling for the first time for a certain data set, */
-    /* initialize some values.                               */
+static int sky_cell(double ra, double dec, int *band)
+/* Return the index cell (and declination band) of a position */
+{
+    int ra_ind;
+
+    *band = (int) ((dec + 0.5 * PI) / DBCELLSIZE);
+    if (*band < 0)
+        *band = 0;
+    if (*band > numbands - 1)
+        *band = numbands - 1;
+    ra = fmod(ra, TWOPI);
+    if (ra < 0.0)
+        ra += TWOPI;
+    ra_ind = (int) (ra / TWOPI * (bandcell[*band + 1] - bandcell[*band]));
+    if (ra_ind > bandcell[*band + 1] - bandcell[*band] - 1)
+        ra_ind = bandcell[*band + 1] - bandcell[*band] - 1;
+    return bandcell[*band] + ra_ind;
+}
 
-    if (idata != old_idata) {
-        /* Convert the beam width to radians */
 
-        beam2 = 2.0 * ARCSEC2RAD * idata->fov;
+static void *index_malloc(size_t size)
+/* malloc() for the database index, with an error if it fails */
+{
+    void *ptr = malloc(size ? size : 1);
 
-        /* Convert RA and DEC to radians  (Use J2000) */
+    if (ptr == NULL)
+        presto_error(PRESTO_ERR_NOMEM,
+                     "Unable to allocate %zu bytes for the pulsar database index",
+                     size);
+    return ptr;
+}
 
-        ra = hms2rad(idata->ra_h, idata->ra_m, idata->ra_s);
-        dec = dms2rad(idata->dec_d, idata->dec_m, idata->dec_s);
-        T = idata->N * idata->dt;
-        epoch = (double) idata->mjd_i + idata->mjd_f + T / (2.0 * SECPERDAY);
 
-        /* Set up old_idata for next time */
+static void build_database_index(void)
+/* Build the sky-position and frequency index of the database */
+{
+    int ii, band, cell;
+    double *entries, center, pdp;
+
+    /* The cells in each declination band */
+    numbands = (int) ceil(PI / DBCELLSIZE);
+    bandcell = (int *) index_malloc((numbands + 1) * sizeof(int));
+    bandcell[0] = 0;
+    for (ii = 0; ii < numbands; ii++) {
+        center = -0.5 * PI + (ii + 0.5) * DBCELLSIZE;
+        bandcell[ii + 1] = bandcell[ii] + (int) (TWOPI * cos(center) / DBCELLSIZE) + 1;
+    }
+    numcells = bandcell[numbands];
 
-        old_idata = idata;
+    /* Sort the pulsars by cell and then frequency */
+    entries = (double *) index_malloc(3 * (np + 1) * sizeof(double));
+    for (ii = 0; ii < np; ii++) {
+        entries[3 * ii] = sky_cell(pulsardata[ii].ra2000, pulsardata[ii].dec2000, &band);
+        entries[3 * ii + 1] = pulsardata[ii].f;
+        entries[3 * ii + 2] = ii;
     }
-    /* Calculate the measured r, z, w's and their derivatives */
+    qsort(entries, np, 3 * sizeof(double), compare_cell_entries);
+
+    cellstart = (int *) index_malloc((numcells + 1) * sizeof(int));
+    cellpsrs = (int *) index_malloc((np + 1) * sizeof(int));
+    cellfreqs = (double *) index_malloc((np + 1) * sizeof(double));
+    cellmaxpdp = (double *) index_malloc(numcells * sizeof(double));
+    cellminep = (double *) index_malloc(numcells * sizeof(double));
+    cellmaxep = (double *) index_malloc(numcells * sizeof(double));
+    cellstart[0] = 0;
+    for (ii = 0; ii < numcells; ii++) {
+        cellstart[ii + 1] = 0;
+        cellmaxpdp[ii] = 0.0;
+        cellminep[ii] = 1e99;
+        cellmaxep[ii] = -1e99;
+    }
+    for (ii = 0; ii < np; ii++) {
+        int psr = (int) entries[3 * ii + 2];
+        cell = (int) entries[3 * ii];
+        cellstart[cell + 1]++;
+        cellpsrs[ii] = psr;
+        cellfreqs[ii] = entries[3 * ii + 1];
+        pdp = fabs(pulsardata[psr].pd / pulsardata[psr].p);
+        if (isnan(pdp))
+            pdp = 0.0;
+        if (pdp > cellmaxpdp[cell])
+            cellmaxpdp[cell] = pdp;
+        if (pulsardata[psr].timepoch < cellminep[cell])
+            cellminep[cell] = pulsardata[psr].timepoch;
+        if (pulsardata[psr].timepoch > cellmaxep[cell])
+            cellmaxep[cell] = pulsardata[psr].timepoch;
+    }
+    for (ii = 0; ii < numcells; ii++)
+        cellstart[ii + 1] += cellstart[ii];
+    free(entries);
+    have_index = 1;
+}
 
-    calc_rzwerrs(cand, T, &rzws);
 
-    /* Run through RAs in database looking for things close  */
-    /* If find one, check the DEC as well (the angle between */
-    /* the sources < 2*beam diam).  If find one, check its   */
-    /* period.  If this matches within 2*perr, return the    */
-    /* number of the pulsar.  If no matches, return 0.       */
+static int lower_freq_index(int lo, int hi, double freq)
+/* Return the first index in cellfreqs[lo:hi] with a frequency >= freq */
+{
+    int mid;
+
+    while (lo < hi) {
+        mid = (lo + hi) / 2;
+        if (cellfreqs[mid] < freq)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return lo;
+}
 
-    for (ii = 0; ii < np; ii++) {
 
-        /* See if we're close in RA */
+static int compare_ints(const void *ca, const void *cb)
+{
+    return *(const int *) ca - *(const int *) cb;
+}
 
-        if (fabs(pulsardata[ii].ra2000 - ra) < 5 * beam2) {
 
-            /* See if we're close in RA and DEC */
+static int psr_matches_cand(int ii, fourierprops * cand, double T, double beam2,
+                            double ra, double dec, double epoch, char *output,
+                            int full)
+/* Check if database pulsar 'ii' (or one of its harmonics) matches */
+/* the candidate.  If so, describe the match in *output and return */
+/* 1.  Otherwise return 0.                                         */
+{
+    int jj;
+    double theor, theoz, sidedr = 20.0;
+    double r_criteria, z_criteria, rdiff, zdiff, difft = 0;
+    char tmp1[80], tmp2[80], tmp3[80], shortout[30], psrname[20];
 
-            if (sphere_ang_diff(pulsardata[ii].ra2000, pulsardata[ii].dec2000,
-                                ra, dec) < 5 * beam2) {
+    /* See if we're close in RA */
 
-                /* Predict the period of the pulsar at the observation MJD */
+    if (fabs(pulsardata[ii].ra2000 - ra) < 5 * beam2) {
 
-                difft = SECPERDAY * (epoch - pulsardata[ii].timepoch);
-                theor = T / (pulsardata[ii].p + pulsardata[ii].pd * difft);
-                theoz = -pulsardata[ii].pd * theor * theor;
+        /* See if we're close in RA and DEC */
 
-                /* Check the predicted period and its harmonics against the */
-                /* measured period.                                         */
+        if (sphere_ang_diff(pulsardata[ii].ra2000, pulsardata[ii].dec2000,
+                            ra, dec) < 5 * beam2) {
 
-                for (jj = 1; jj < 41; jj++) {
+            /* Predict the period of the pulsar at the observation MJD */
 
-                    /* If the psr from the database is in a             */
-                    /* binary orbit, loosen the match criteria.         */
-                    /* This accounts for Doppler variations in period.  */
+            difft = SECPERDAY * (epoch - pulsardata[ii].timepoch);
+            theor = T / (pulsardata[ii].p + pulsardata[ii].pd * difft);
+            theoz = -pulsardata[ii].pd * theor * theor;
 
-                    if (pulsardata[ii].orb.p != 0.0) {
-                        r_criteria = 0.001 * theor * jj;        /* 0.1% fractional error   */
-                        z_criteria = 9999999999.0;      /* Always match for binary */
-                        strcpy(tmp1, "?");
-                        if (full) {
-                            strcpy(tmp3, "Possibly (large error) ");
-                        }
-                    } else {
-                        r_criteria = 5.0;       /* 5 bin error matching... */
-                        z_criteria = 9999999999.0;      /* Always match for binary */
-                        /* z_criteria = 2.5 * cand->zerr; */
-                        strcpy(tmp1, "");
-                        if (full) {
-                            strcpy(tmp3, "Looks like ");
-                        }
+            /* Check the predicted period and its harmonics against the */
+            /* measured period.                                         */
+
+            for (jj = 1; jj < 41; jj++) {
+
+                /* If the psr from the database is in a             */
+                /* binary orbit, loosen the match criteria.         */
+                /* This accounts for Doppler variations in period.  */
+
+                if (pulsardata[ii].orb.p != 0.0) {
+                    r_criteria = 0.001 * theor * jj;    /* 0.1% fractional error   */
+                    z_criteria = 9999999999.0;  /* Always match for binary */
+                    strcpy(tmp1, "?");
+                    if (full) {
+                        strcpy(tmp3, "Possibly (large error) ");
+                    }
+                } else {
+                    r_criteria = 5.0;   /* 5 bin error matching... */
+                    z_criteria = 9999999999.0;  /* Always match for binary */
+                    /* z_criteria = 2.5 * cand->zerr; */
+                    strcpy(tmp1, "");
+                    if (full) {
+                        strcpy(tmp3, "Looks like ");
                     }
+                }
 
-                    if (theor * jj > 1.5 * cand->r)
-                        break;
-
-                    rdiff = fabs(theor * jj - cand->r);
-                    zdiff = fabs(theoz * jj - cand->z);
-
-                    if (rdiff < r_criteria && zdiff < z_criteria) {
-                        if (strlen(pulsardata[ii].bname) == 0)
-                            sprintf(psrname, "J%s", pulsardata[ii].jname);
-                        else
-                            sprintf(psrname, "B%s", pulsardata[ii].bname);
-                        if (jj == 1) {
-                            if (full) {
-                                sprintf(tmp1, "the fundamental of ");
-                                sprintf(tmp2, "PSR %s. (predicted p = %11.7f s).\n",
-                                        psrname, T / theor);
-                                sprintf(output, "%s%s\n     %s", tmp3, tmp1, tmp2);
-                            } else {
-                                sprintf(shortout, "PSR %s%s", psrname, tmp1);
-                                strncpy(output, shortout, 20);
-                                output[20-1] = '\0';
-                            }
+                if (theor * jj > 1.5 * cand->r)
+                    break;
+
+                rdiff = fabs(theor * jj - cand->r);
+                zdiff = fabs(theoz * jj - cand->z);
+
+                if (rdiff < r_criteria && zdiff < z_criteria) {
+                    if (strlen(pulsardata[ii].bname) == 0)
+                        sprintf(psrname, "J%s", pulsardata[ii].jname);
+                    else
+                        sprintf(psrname, "B%s", pulsardata[ii].bname);
+                    if (jj == 1) {
+                        if (full) {
+                            sprintf(tmp1, "the fundamental of ");
+                            sprintf(tmp2, "PSR %s. (predicted p = %11.7f s).\n",
+                                    psrname, T / theor);
+                            sprintf(output, "%s%s\n     %s", tmp3, tmp1, tmp2);
                         } else {
-                            if (full) {
-                                sprintf(tmp1, "the %s harmonic of ", num[jj]);
-                                sprintf(tmp2, "PSR %s. (predicted p = %11.7f s).\n",
-                                        psrname, T / theor);
-                                sprintf(output, "%s%s\n     %s", tmp3, tmp1, tmp2);
-                            } else {
-                                sprintf(shortout, "%s H %s%s", num[jj], psrname,
-                                        tmp1);
-                                strncpy(output, shortout, 20);
-                                output[20-1] = '\0';
-                            }
+                            sprintf(shortout, "PSR %s%s", psrname, tmp1);
+                            strncpy(output, shortout, 20);
+                            output[20-1] = '\0';
                         }
-                        return ii + 1;
-                    } else if (rdiff < sidedr) {
-                        if (strlen(pulsardata[ii].bname) == 0)
-                            sprintf(psrname, "J%s", pulsardata[ii].jname);
-                        else
-                            sprintf(psrname, "B%s", pulsardata[ii].bname);
+                    } else {
                         if (full) {
-                            sprintf(tmp1, "a sidelobe of the %s harmonic of ",
-                                    num[jj]);
+                            sprintf(tmp1, "the %s harmonic of ", num[jj]);
                             sprintf(tmp2, "PSR %s. (predicted p = %11.7f s).\n",
                                     psrname, T / theor);
                             sprintf(output, "%s%s\n     %s", tmp3, tmp1, tmp2);
                         } else {
-                            sprintf(shortout, "SL H%d %s", jj, psrname);
+                            sprintf(shortout, "%s H %s%s", num[jj], psrname,
+                                    tmp1);
                             strncpy(output, shortout, 20);
                             output[20-1] = '\0';
                         }
-                        return ii + 1;
                     }
+                    return 1;
+                } else if (rdiff < sidedr) {
+                    if (strlen(pulsardata[ii].bname) == 0)
+                        sprintf(psrname, "J%s", pulsardata[ii].jname);
+                    else
+                        sprintf(psrname, "B%s", pulsardata[ii].bname);
+                    if (full) {
+                        sprintf(tmp1, "a sidelobe of the %s harmonic of ",
+                                num[jj]);
+                        sprintf(tmp2, "PSR %s. (predicted p = %11.7f s).\n",
+                                psrname, T / theor);
+                        sprintf(output, "%s%s\n     %s", tmp3, tmp1, tmp2);
+                    } else {
+                        sprintf(shortout, "SL H%d %s", jj, psrname);
+                        strncpy(output, shortout, 20);
+                        output[20-1] = '\0';
+                    }
+                    return 1;
                 }
             }
         }
     }
+    return 0;
+}
 
-    /* Didn't find a match */
 
+static void no_psr_match(char *output, int full)
+/* The output of the comparisons when no pulsar matches */
+{
     if (full) {
         sprintf(output,
                 "I don't recognize this candidate in the pulsar database.\n");
@@ -387,6 +637,159 @@ int comp_psr_to_cand(fourierprops * cand, infodata * idata, char *output, int fu
         strncpy(output, "                       ", 20);
         output[20-1] = '\0';
     }
+}
+
+
+int comp_psr_to_cand(fourierprops * cand, infodata * idata, char *output, int full)
+/* Compares a pulsar candidate defined by its properties found in   */
+/*   *cand, and *idata with all of the pulsars in the pulsar        */
+/*   database.  It returns a string (verbose if full==1) describing */
+/*   the results of the search in *output.                          */
+{
+    int ii, jj, band, loband, hiband, cell, numra, lora, hira, loind, hiind, kk;
+    int numfound = 0, maxfound = 0, *found = NULL;
+    double rad, maxdec, dra, fc, df, slack, maxdt;
+    double T, beam2, ra, dec, epoch;
+
+    /* Read the database if needed */
+
+    if (!have_database)
+        np = read_database();
+    if (!have_index)
+        build_database_index();
+
+    /* Values for the data set.  These are cheap enough to get every */
+    /* time, and *idata may have been re-used for another data set.  */
+
+    /* Convert the beam width to radians */
+
+    beam2 = 2.0 * ARCSEC2RAD * idata->fov;
+
+    /* Convert RA and DEC to radians  (Use J2000) */
+
+    ra = hms2rad(idata->ra_h, idata->ra_m, idata->ra_s);
+    dec = dms2rad(idata->dec_d, idata->dec_m, idata->dec_s);
+    T = idata->N * idata->dt;
+    epoch = (double) idata->mjd_i + idata->mjd_f + T / (2.0 * SECPERDAY);
+
+    /* Use the index to find the pulsars close to the position whose */
+    /* harmonics could match the candidate frequency.  A pulsar at   */
+    /* 'dec2' within 'rad' of the position has an RA within 'dra'    */
+    /* where sin(dra/2) = sin(rad/2) / cos(max(|dec|, |dec2|)).      */
+    /* The frequency windows include the 0.1% binary match criteria, */
+    /* the sidelobe criteria of 20 bins, and the spin-down since the */
+    /* catalog epochs.  The pulsars found are checked in order of    */
+    /* their database numbers, exactly like a full database scan.   */
+
+    rad = 5 * beam2;
+    fc = cand->r / T;
+    df = 0.0011 * fc + 21.0 / T;
+    loband = (int) ((dec - rad + 0.5 * PI) / DBCELLSIZE);
+    hiband = (int) ((dec + rad + 0.5 * PI) / DBCELLSIZE);
+    if (loband < 0)
+        loband = 0;
+    if (hiband > numbands - 1)
+        hiband = numbands - 1;
+    for (band = loband; band <= hiband; band++) {
+        maxdec = fabs(-0.5 * PI + band * DBCELLSIZE);
+        if (fabs(-0.5 * PI + (band + 1) * DBCELLSIZE) > maxdec)
+            maxdec = fabs(-0.5 * PI + (band + 1) * DBCELLSIZE);
+        if (fabs(dec) > maxdec)
+            maxdec = fabs(dec);
+        numra = bandcell[band + 1] - bandcell[band];
+        dra = sin(0.5 * rad) / cos(maxdec);
+        if (dra >= 1.0 || maxdec >= 0.5 * PI) {
+            lora = 0;
+            hira = numra - 1;
+        } else {
+            dra = 2.0 * asin(dra);
+            lora = (int) floor((ra - dra) / TWOPI * numra);
+            hira = (int) floor((ra + dra) / TWOPI * numra);
+            if (hira - lora >= numra - 1) {
+                lora = 0;
+                hira = numra - 1;
+            }
+        }
+        for (kk = lora; kk <= hira; kk++) {
+            cell = bandcell[band] + ((kk % numra) + numra) % numra;
+            if (cellstart[cell] == cellstart[cell + 1])
+                continue;
+            maxdt = SECPERDAY * fabs(epoch - cellminep[cell]);
+            if (SECPERDAY * fabs(epoch - cellmaxep[cell]) > maxdt)
+                maxdt = SECPERDAY * fabs(epoch - cellmaxep[cell]);
+            slack = 2.0 * cellmaxpdp[cell] * maxdt + 1e-9;
+            for (jj = 1; jj < 41; jj++) {
+                if (slack < 0.5) {
+                    loind = lower_freq_index(cellstart[cell], cellstart[cell + 1],
+                                             (fc - df) / jj * (1.0 - slack));
+                    hiind = lower_freq_index(loind, cellstart[cell + 1],
+                                             (fc + df) / jj * (1.0 + slack));
+                } else {
+                    /* Very old epochs or fast spin-down: check the whole cell */
+                    loind = cellstart[cell];
+                    hiind = cellstart[cell + 1];
+                    jj = 41;
+                }
+                for (ii = loind; ii < hiind; ii++) {
+                    if (numfound >= maxfound) {
+                        int *tmp;
+                        maxfound = (maxfound) ? 2 * maxfound : 64;
+                        tmp = (int *) realloc(found, maxfound * sizeof(int));
+                        if (tmp == NULL) {
+                            free(found);
+                            presto_error(PRESTO_ERR_NOMEM,
+                                         "Unable to allocate the database matches");
+                        }
+                        found = tmp;
+                    }
+                    found[numfound++] = cellpsrs[ii];
+                }
+            }
+        }
+    }
+
+    /* Check the possible matches in order */
+
+    qsort(found, numfound, sizeof(int), compare_ints);
+    for (ii = 0; ii < numfound; ii++) {
+        if (ii > 0 && found[ii] == found[ii - 1])
+            continue;
+        if (psr_matches_cand(found[ii], cand, T, beam2, ra, dec, epoch,
+                             output, full)) {
+            jj = found[ii];
+            free(found);
+            return jj + 1;
+        }
+    }
+    free(found);
+
+    /* Didn't find a match */
+
+    no_psr_match(output, full);
+    return 0;
+}
+
+
+int comp_psr_to_cand_scan(fourierprops * cand, infodata * idata, char *output,
+                          int full)
+/* The same as comp_psr_to_cand(), but checking every pulsar in */
+/*   the database instead of using the index.  This is slow and */
+/*   is meant for checking the index.                           */
+{
+    int ii;
+    double T, beam2, ra, dec, epoch;
+
+    if (!have_database)
+        np = read_database();
+    beam2 = 2.0 * ARCSEC2RAD * idata->fov;
+    ra = hms2rad(idata->ra_h, idata->ra_m, idata->ra_s);
+    dec = dms2rad(idata->dec_d, idata->dec_m, idata->dec_s);
+    T = idata->N * idata->dt;
+    epoch = (double) idata->mjd_i + idata->mjd_f + T / (2.0 * SECPERDAY);
+    for (ii = 0; ii < np; ii++)
+        if (psr_matches_cand(ii, cand, T, beam2, ra, dec, epoch, output, full))
+            return ii + 1;
+    no_psr_match(output, full);
     return 0;
 }
 
@@ -0,0 +1,331 @@
+#include <sys/time.h>
+#include <unistd.h>
+#include "presto.h"
+#include "ddbench_cmd.h"
+#include "mask.h"
+#include "backend_common.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+/* Time the kernels that the subband de-dispersion routines  */
+/* (prepsubband and mpiprepsubband) and the searches of their */
+/* output spend their time in, and write the costs (seconds  */
+/* per element) for DDplan.py's de-dispersion plan optimizer. */
+
+typedef struct BENCH {
+    struct spectra_info *s;
+    mask *obsmask;
+    int nsub, downsamp, numdms, numpts, fftlen;
+    int *chandelays, *maskchans, **offsets;
+    float *rawdata, *subdata, *lastsubdata, *dsdata, **outdata, *fftdata, *fftsave;
+    FILE *outfile;
+} bench;
+
+/* From CLIG */
+static Cmdline *cmd;
+
+static double wtime(void)
+{
+    struct timeval tv;
+
+    gettimeofday(&tv, NULL);
+    return tv.tv_sec + 1e-6 * tv.tv_usec;
+}
+
+
+static double time_kernel(void (*kernel) (bench *), bench * b,
+                          double seconds, long *numcalls)
+/* Call 'kernel' repeatedly (at least twice) until 'seconds' of */
+/* wall time have passed.  Return the average time per call.    */
+{
+    long ii = 0;
+    double t0 = wtime(), dt;
+
+    do {
+        kernel(b);
+        ii++;
+        dt = wtime() - t0;
+    } while (ii < 2 || dt < seconds);
+    *numcalls = ii;
+    return dt / ii;
+}
+
+
+static void subband_kernel(bench * b)
+/* Clip, transpose, and de-disperse a block of raw data into */
+/* subbands exactly as read_subbands() does for prepsubband.  */
+{
+    int nummasked;
+
+    prep_subbands(b->subdata, b->rawdata, b->chandelays, b->nsub, b->s,
+                  0, b->maskchans, &nummasked, b->obsmask);
+}
+
+
+static void downsamp_kernel(bench * b)
+/* The subband downsampling of prepsubband's get_data() */
+{
+    int ii, jj, kk, index;
+    int dsnumpts = b->numpts / b->downsamp;
+    float ftmp;
+
+    for (ii = 0; ii < dsnumpts; ii++) {
+        const int dsoffset = ii * b->nsub;
+        const int offset = dsoffset * b->downsamp;
+        for (jj = 0; jj < b->nsub; jj++) {
+            index = offset + jj;
+            ftmp = 0.0;
+            for (kk = 0; kk < b->downsamp; kk++) {
+                ftmp += b->subdata[index];
+                index += b->nsub;
+            }
+            b->dsdata[dsoffset + jj] = ftmp / b->downsamp;
+        }
+    }
+}
+
+
+static void dedisp_kernel(bench * b)
+/* De-disperse the subbands to each of the DMs */
+{
+    int ii;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) default(shared)
+#endif
+    for (ii = 0; ii < b->numdms; ii++)
+        float_dedisp(b->subdata, b->lastsubdata, b->numpts,
+                     b->nsub, b->offsets[ii], 0.0, b->outdata[ii]);
+}
+
+
+static void write_kernel(bench * b)
+/* Write the de-dispersed time series */
+{
+    int ii;
+
+    for (ii = 0; ii < b->numdms; ii++)
+        chkfwrite(b->outdata[ii], sizeof(float), b->numpts, b->outfile);
+    fflush(b->outfile);
+}
+
+
+static void fft_kernel(bench * b)
+/* A forward FFT of a de-dispersed time series.  The FFT is in-place, */
+/* so start from the same data each time (repeated FFTs of the same  */
+/* buffer would overflow to inf/NaN and change the timing).          */
+{
+    memcpy(b->fftdata, b->fftsave, sizeof(float) * b->fftlen);
+    realfft(b->fftdata, b->fftlen, -1);
+}
+
+
+int main(int argc, char *argv[])
+{
+    int ii, jj, padding = 0, chan_per_sub;
+    long numcalls, numread = 0;
+    double t0, dt, cost_rawread = 0.0, cost_subband, cost_downsamp = 0.0;
+    double cost_dedisp, cost_write, cost_fft;
+    char tmpfilenm[] = "ddbench_XXXXXX";
+    FILE *outfile = stdout;
+    struct spectra_info s;
+    mask obsmask;
+    bench b;
+
+    /* Parse the command line using the excellent program Clig */
+
+    cmd = parseCmdline(argc, argv);
+    spectra_info_set_defaults(&s);
+    s.filenames = cmd->argv;
+    s.num_files = cmd->argc;
+    s.clip_sigma = cmd->clip;
+    obsmask.numchan = obsmask.numint = 0;
+
+    if (cmd->ncpus > 1) {
+#ifdef _OPENMP
+        int maxcpus = omp_get_num_procs();
+        int openmp_numthreads = (cmd->ncpus <= maxcpus) ? cmd->ncpus : maxcpus;
+        // Make sure we are not dynamically setting the number of threads
+        omp_set_dynamic(0);
+        omp_set_num_threads(openmp_numthreads);
+        fprintf(stderr, "Using %d threads with OpenMP\n\n", openmp_numthreads);
+#endif
+    } else {
+#ifdef _OPENMP
+        omp_set_num_threads(1); // Explicitly turn off OpenMP
+#endif
+    }
+
+#ifdef DEBUG
+    showOptionValues();
+#endif
+
+    /* Time the raw data reading if we have some raw data */
+
+    if (s.num_files) {
+        if (cmd->filterbankP)
+            s.datatype = SIGPROCFB;
+        else if (cmd->psrfitsP)
+            s.datatype = PSRFITS;
+        else
+            identify_psrdatatype(&s, 1);
+        if (s.datatype != SIGPROCFB && s.datatype != PSRFITS) {
+            fprintf(stderr, "Error:  Unable to identify the input data files.  "
+                    "Please specify type.\n\n");
+            exit(1);
+        }
+        read_rawdata_files(&s);
+        cmd->numchan = s.num_channels;
+        cmd->blocklen = s.spectra_per_subint;
+        b.rawdata = gen_fvect(2 * s.num_channels * s.spectra_per_subint);
+        t0 = wtime();
+        do {
+            if (!s.get_rawblock(b.rawdata, &s, &padding))
+                break;
+            numread++;
+            dt = wtime() - t0;
+        } while (dt < cmd->seconds);
+        if (numread < 2) {
+            fprintf(stderr, "Error:  Not enough raw data to time the reads.\n\n");
+            exit(1);
+        }
+        cost_rawread = dt / ((double) numread * s.num_channels *
+                             s.spectra_per_subint);
+    } else {
+        s.num_channels = cmd->numchan;
+        s.spectra_per_subint = cmd->blocklen;
+        s.dt = 6.4e-5;
+        s.time_per_subint = s.dt * s.spectra_per_subint;
+        s.padvals = gen_fvect(s.num_channels);
+        for (ii = 0; ii < s.num_channels; ii++)
+            s.padvals[ii] = 0.0;
+        b.rawdata = gen_fvect(s.num_channels * s.spectra_per_subint);
+        srand(1);
+        for (ii = 0; ii < s.num_channels * s.spectra_per_subint; ii++)
+            b.rawdata[ii] = rand() % 32;
+    }
+    if (s.num_channels % cmd->nsub) {
+        fprintf(stderr, "Error:  The number of subbands (-nsub %d) must divide into the\n"
+                "        number of channels (%d)\n\n", cmd->nsub, s.num_channels);
+        exit(1);
+    }
+    if (cmd->downsamp > 1 && s.spectra_per_subint % cmd->downsamp) {
+        fprintf(stderr, "Error:  The downsampling factor (-downsamp %d) must divide into\n"
+                "        the block length (%d)\n\n", cmd->downsamp, s.spectra_per_subint);
+        exit(1);
+    }
+
+    b.s = &s;
+    b.obsmask = &obsmask;
+    b.nsub = cmd->nsub;
+    b.downsamp = cmd->downsamp;
+    b.numdms = cmd->numdms;
+    b.numpts = s.spectra_per_subint;
+    b.fftlen = cmd->fftlen;
+    b.maskchans = gen_ivect(s.num_channels);
+
+    /* Subbanding: channel delays within each subband that are */
+    /* typical of a moderate DM (larger at lower frequencies)   */
+
+    chan_per_sub = s.num_channels / b.nsub;
+    b.chandelays = gen_ivect(s.num_channels);
+    for (ii = 0; ii < s.num_channels; ii++)
+        b.chandelays[ii] = (chan_per_sub - 1 - ii % chan_per_sub) %
+            (s.spectra_per_subint / 2 + 1);
+    b.subdata = gen_fvect(b.nsub * b.numpts);
+    b.lastsubdata = gen_fvect(b.nsub * b.numpts);
+    subband_kernel(&b);         /* The first call primes prep_subbands() */
+    cost_subband = time_kernel(subband_kernel, &b, cmd->seconds, &numcalls) /
+        ((double) s.num_channels * b.numpts);
+    memcpy(b.lastsubdata, b.subdata, sizeof(float) * b.nsub * b.numpts);
+
+    /* Downsampling the subbands */
+
+    if (b.downsamp > 1) {
+        b.dsdata = gen_fvect(b.nsub * b.numpts / b.downsamp);
+        cost_downsamp = time_kernel(downsamp_kernel, &b, cmd->seconds, &numcalls) /
+            ((double) b.nsub * b.numpts);
+        vect_free(b.dsdata);
+    }
+
+    /* De-dispersing the subbands (full resolution, since the cost */
+    /* is per output point it does not depend on the downsampling) */
+
+    b.offsets = gen_imatrix(b.numdms, b.nsub);
+    for (ii = 0; ii < b.numdms; ii++)
+        for (jj = 0; jj < b.nsub; jj++)
+            b.offsets[ii][jj] = ((b.nsub - 1 - jj) * (ii + 1)) % b.numpts;
+    b.outdata = gen_fmatrix(b.numdms, b.numpts);
+    cost_dedisp = time_kernel(dedisp_kernel, &b, cmd->seconds, &numcalls) /
+        ((double) b.numdms * b.numpts * b.nsub);
+
+    /* Writing the time series (to the current directory, */
+    /* where prepsubband would write them)                */
+
+    ii = mkstemp(tmpfilenm);
+    if (ii < 0) {
+        perror("\nError in ddbench");
+        fprintf(stderr, "Unable to create a temporary file in the current directory.\n\n");
+        exit(1);
+    }
+    b.outfile = fdopen(ii, "wb");
+    cost_write = time_kernel(write_kernel, &b, cmd->seconds, &numcalls) /
+        ((double) b.numdms * b.numpts);
+    fclose(b.outfile);
+    remove(tmpfilenm);
+
+    /* FFTing the time series */
+
+    b.fftdata = gen_fvect(b.fftlen);
+    b.fftsave = gen_fvect(b.fftlen);
+    for (ii = 0; ii < b.fftlen; ii++)
+        b.fftsave[ii] = rand() % 32;
+    fft_kernel(&b);             /* Make (or read) the FFTW plans */
+    cost_fft = time_kernel(fft_kernel, &b, cmd->seconds, &numcalls) /
+        ((double) b.fftlen * log2((double) b.fftlen));
+
+    /* Write the results */
+
+    if (cmd->outfileP)
+        outfile = chkfopen(cmd->outfile, "w");
+    fprintf(outfile, "# ddbench costs in seconds per element from:\n");
+    fprintf(outfile, "#   %s\n", cmd->full_cmd_line);
+    fprintf(outfile, "numchan       = %d\n", s.num_channels);
+    fprintf(outfile, "nsub          = %d\n", b.nsub);
+    fprintf(outfile, "blocklen      = %d\n", b.numpts);
+    fprintf(outfile, "downsamp      = %d\n", b.downsamp);
+    fprintf(outfile, "numdms        = %d\n", b.numdms);
+    fprintf(outfile, "fftlen        = %d\n", b.fftlen);
+    fprintf(outfile, "ncpus         = %d\n", cmd->ncpus);
+    fprintf(outfile, "# per raw channel-sample read (0 if no raw data given)\n");
+    fprintf(outfile, "cost_rawread  = %.4e\n", cost_rawread);
+    fprintf(outfile, "# per raw channel-sample clipped, transposed, and subbanded\n");
+    fprintf(outfile, "cost_subband  = %.4e\n", cost_subband);
+    fprintf(outfile, "# per subband-sample downsampled\n");
+    fprintf(outfile, "cost_downsamp = %.4e\n", cost_downsamp);
+    fprintf(outfile, "# per subband-sample de-dispersed for each DM\n");
+    fprintf(outfile, "cost_dedisp   = %.4e\n", cost_dedisp);
+    fprintf(outfile, "# per de-dispersed point written\n");
+    fprintf(outfile, "cost_write    = %.4e\n", cost_write);
+    fprintf(outfile, "# per N*log2(N) of a length-N real FFT\n");
+    fprintf(outfile, "cost_fft      = %.4e\n", cost_fft);
+    if (cmd->outfileP)
+        fclose(outfile);
+
+    if (s.num_files)
+        close_rawfiles(&s);
+    vect_free(b.rawdata);
+    vect_free(b.chandelays);
+    vect_free(b.maskchans);
+    vect_free(b.subdata);
+    vect_free(b.lastsubdata);
+    vect_free(b.offsets[0]);
+    vect_free(b.offsets);
+    vect_free(b.outdata[0]);
+    vect_free(b.outdata);
+    vect_free(b.fftdata);
+    vect_free(b.fftsave);
+    return (0);
+}
@@ -242,7 +242,6 @@ static dataview *get_dataview(long centern, long zoomlevel, datapart * dp)
 {
     long ii, jj, offset;
     double tmpavg, tmpvar;
-    float *tmpchunk;
     dataview *dv;
 
     dv = (dataview *) malloc(sizeof(dataview));
@@ -270,14 +269,12 @@ static dataview *get_dataview(long centern, long zoomlevel, datapart * dp)
         dv->lon = dp->nn - dv->numsamps;
         dv->centern = dv->lon + dv->numsamps / 2;
     }
-    tmpchunk = gen_fvect(dv->chunklen);
     for (ii = 0; ii < dv->numchunks; ii++) {
         float tmpmin = LARGENUM, tmpmax = SMALLNUM, tmpval;
         offset = dv->lon + ii * dv->chunklen;
-        memcpy(tmpchunk, dp->data + offset, sizeof(float) * dv->chunklen);
         avg_var(dp->data + offset, dv->chunklen, &tmpavg, &tmpvar);
         if (usemedian)
-            dv->avgmeds[ii] = median(tmpchunk, dv->chunklen);
+            dv->avgmeds[ii] = median_nocopy(dp->data + offset, dv->chunklen);
         else
             dv->avgmeds[ii] = tmpavg;
         dv->stds[ii] = sqrt(tmpvar);
@@ -295,7 +292,6 @@ static dataview *get_dataview(long centern, long zoomlevel, datapart * dp)
         if (tmpmin < dv->minval)
             dv->minval = tmpmin;
     }
-    vect_free(tmpchunk);
     offset = dv->lon;
     if (zoomlevel > 0) {
         for (ii = 0, offset = dv->lon; ii < dv->numsamps; ii++, offset++)
@@ -0,0 +1,342 @@
+#include "presto.h"
+#include "ffa.h"
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+/* Number of detections to allocate space for at a time */
+#define HITCHUNK 1024
+
+static int compare_ffacand_snr(const void *ca, const void *cb)
+/*  Used as compare function for qsort() */
+{
+    ffacand *a, *b;
+
+    a = (ffacand *) ca;
+    b = (ffacand *) cb;
+    if (b->snr > a->snr)
+        return 1;
+    if (b->snr < a->snr)
+        return -1;
+    return 0;
+}
+
+
+static void ffa_recurse(float *data, float *out, float *work, int m, int p)
+/* Recursive part of ffa_transform().  The FFAs of the first half and */
+/* the second half of the rows are placed in 'work' (using 'out' as   */
+/* their workspace) and then combined into 'out'.                     */
+{
+    int s, h, t, ih, it, b, jj;
+    float *hrow, *trow, *orow;
+
+    if (m == 1) {
+        memcpy(out, data, sizeof(float) * p);
+        return;
+    }
+    h = m / 2;
+    t = m - h;
+    ffa_recurse(data, work, out, h, p);
+    ffa_recurse(data + h * p, work + h * p, out + h * p, t, p);
+    for (s = 0; s < m; s++) {
+        /* The shifts of the head, the start of the tail, and the tail */
+        ih = (int) (s * (h - 1.0) / (m - 1.0) + 0.5);
+        it = (int) (s * (t - 1.0) / (m - 1.0) + 0.5);
+        b = (int) (s * (double) h / (m - 1.0) + 0.5) % p;
+        hrow = work + ih * p;
+        trow = work + (h + it) * p;
+        orow = out + s * p;
+        /* Two contiguous pieces so that the adds vectorize */
+        for (jj = 0; jj < p - b; jj++)
+            orow[jj] = hrow[jj] + trow[jj + b];
+        for (jj = p - b; jj < p; jj++)
+            orow[jj] = hrow[jj] + trow[jj + b - p];
+    }
+}
+
+
+void ffa_transform(float *data, int numrows, int numbins, float *result)
+/* Compute the Fast Folding Algorithm transform of 'data', which is  */
+/* 'numrows' consecutive pulse periods of 'numbins' bins each.  Row  */
+/* 's' of 'result' (also numrows x numbins) is the sum of all the    */
+/* rows after row 'k' has been shifted by k * s / (numrows - 1)      */
+/* bins, i.e. the profile folded at a period of numbins + s /        */
+/* (numrows - 1) bins.  'numrows' does not need to be a power-of-2.  */
+{
+    float *work;
+
+    work = gen_fvect((long) numrows * numbins);
+    ffa_recurse(data, result, work, numrows, numbins);
+    vect_free(work);
+}
+
+
+long ffa_downsample(float *indata, long numin, double factor, float *outdata)
+/* Sum 'indata' into bins that are 'factor' (which may be fractional, */
+/* but must be >= 1) input samples long.  Partial samples are split   */
+/* linearly between output bins.  Returns the number of output bins.  */
+{
+    long ii, jj, jlo, jhi, numout;
+    double lo, hi, sum;
+
+    numout = (long) (numin / factor);
+    if (factor == 1.0) {
+        memcpy(outdata, indata, sizeof(float) * numout);
+        return numout;
+    }
+    for (ii = 0; ii < numout; ii++) {
+        lo = ii * factor;
+        hi = lo + factor;
+        jlo = (long) lo;
+        jhi = (long) hi;
+        sum = (jlo + 1 - lo) * indata[jlo];
+        for (jj = jlo + 1; jj < jhi; jj++)
+            sum += indata[jj];
+        if (jhi < numin)
+            sum += (hi - jhi) * indata[jhi];
+        outdata[ii] = sum;
+    }
+    return numout;
+}
+
+
+void ffa_detrend(float *data, long numdata, long blocklen)
+/* Remove a running median from 'data' (using the medians of blocks */
+/* of 'blocklen' points, linearly interpolated between the blocks)  */
+/* and then normalize the data to unit standard deviation.          */
+{
+    long ii, jj, numblocks, lo;
+    float *meds;
+    double avg, var, norm, frac;
+
+    if (blocklen > numdata || blocklen < 1)
+        blocklen = numdata;
+    numblocks = numdata / blocklen;
+    meds = gen_fvect(numblocks);
+    for (ii = 0; ii < numblocks; ii++)
+        meds[ii] = median_nocopy(data + ii * blocklen, blocklen);
+
+    /* The medians apply to the block centers */
+
+    for (ii = 0; ii < numdata; ii++) {
+        frac = (ii - 0.5 * (blocklen - 1)) / blocklen;
+        if (frac <= 0.0 || numblocks == 1) {
+            data[ii] -= meds[0];
+        } else if (frac >= numblocks - 1) {
+            data[ii] -= meds[numblocks - 1];
+        } else {
+            lo = (long) frac;
+            frac -= lo;
+            data[ii] -= (1.0 - frac) * meds[lo] + frac * meds[lo + 1];
+        }
+    }
+    vect_free(meds);
+
+    /* Normalize to unit variance */
+
+    avg_var(data, numdata, &avg, &var);
+    norm = (var > 0.0) ? 1.0 / sqrt(var) : 1.0;
+    for (jj = 0; jj < numdata; jj++)
+        data[jj] = (data[jj] - avg) * norm;
+}
+
+
+float ffa_boxcar_snr(float *prof, int numbins, int *widths, int numwidths,
+                     double stdev, int *bestwidth, int *bestbin)
+/* Return the highest boxcar S/N of the (cyclic) profile 'prof' for  */
+/* each of the 'numwidths' boxcar 'widths'.  Each profile bin has a  */
+/* noise standard deviation of 'stdev'.  The width and starting bin  */
+/* of the best boxcar are returned in 'bestwidth' and 'bestbin'.     */
+{
+    int ii, jj, kk, w, maxw = 0;
+    double *cum, mean, sum, maxsum, snr, bestsnr = -1e30;
+
+    for (ii = 0; ii < numwidths; ii++)
+        if (widths[ii] > maxw)
+            maxw = widths[ii];
+    cum = gen_dvect(numbins + maxw + 1);
+    cum[0] = 0.0;
+    for (ii = 0; ii < numbins + maxw; ii++)
+        cum[ii + 1] = cum[ii] + prof[ii % numbins];
+    mean = cum[numbins] / numbins;
+    *bestwidth = 1;
+    *bestbin = 0;
+    for (ii = 0; ii < numwidths; ii++) {
+        w = widths[ii];
+        if (w >= numbins)
+            continue;
+        maxsum = cum[w] - cum[0];
+        jj = 0;
+        for (kk = 1; kk < numbins; kk++) {
+            sum = cum[kk + w] - cum[kk];
+            if (sum > maxsum) {
+                maxsum = sum;
+                jj = kk;
+            }
+        }
+        snr = (maxsum - w * mean) / (stdev * sqrt(w * (1.0 - (double) w / numbins)));
+        if (snr > bestsnr) {
+            bestsnr = snr;
+            *bestwidth = w;
+            *bestbin = jj;
+        }
+    }
+    vect_free(cum);
+    return (float) bestsnr;
+}
+
+
+int *ffa_widths(int maxwidth, int *numwidths)
+/* Return a vector of roughly logarithmically spaced boxcar widths */
+/* (1, 2, 3, 4, 6, 9, ...) up to 'maxwidth' bins.                  */
+{
+    int ii, w, *widths;
+
+    if (maxwidth < 1)
+        maxwidth = 1;
+    widths = gen_ivect(64);
+    ii = 0;
+    w = 1;
+    while (w <= maxwidth && ii < 64) {
+        widths[ii++] = w;
+        w = (w < 4) ? w + 1 : (int) (1.5 * w);
+    }
+    *numwidths = ii;
+    return widths;
+}
+
+
+double ffa_sigma(double snr, double numtrials)
+/* Return the Gaussian significance of a boxcar S/N of 'snr' */
+/* after correcting for 'numtrials' independent trials.      */
+{
+    double logp;
+
+    if (snr <= 0.0)
+        return 0.0;
+    /* The one-sided Gaussian tail probability */
+    logp = log(0.5) + chi2_logp(snr * snr, 1.0);
+    if (numtrials > 1.0)
+        logp += log(numtrials);
+    if (logp >= 0.0)
+        return 0.0;
+    return equivalent_gaussian_sigma(logp);
+}
+
+
+ffacand *ffa_search(float *data, long numdata, double dt,
+                    double pmin, double pmax, int bmin, int bmax,
+                    double maxduty, float snrmin, int *numcands)
+/* Search the detrended and normalized time series 'data' (see     */
+/* ffa_detrend()) with a sample time of 'dt' for periodic signals  */
+/* with periods between 'pmin' and 'pmax' seconds.  The data are   */
+/* downsampled by octaves so that the profiles always have between */
+/* 'bmin' and 'bmax' bins, and boxcars up to 'maxduty' of a period */
+/* are checked.  The FFAs of the different profile lengths are     */
+/* done in parallel.  The detections with S/N >= 'snrmin' are      */
+/* clustered into candidates which are returned (sorted by S/N)    */
+/* and their number placed in 'numcands'.                          */
+{
+    int ii, jj, *widths, numwidths, numhits = 0, maxhits = HITCHUNK, ncands = 0;
+    long numds;
+    double factor, tsamp, T, tol, numtrials = 0.0;
+    float *ds;
+    ffacand *hits, *cands;
+
+    T = numdata * dt;
+    widths = ffa_widths((int) (maxduty * bmin), &numwidths);
+    hits = (ffacand *) malloc(sizeof(ffacand) * maxhits);
+    factor = pmin / (bmin * dt);
+    if (factor < 1.0)
+        factor = 1.0;
+    ds = gen_fvect(numdata / factor + 1);
+
+    /* Loop over the octaves of sample times */
+
+    while (bmin * factor * dt <= pmax) {
+        double avg, var, norm;
+
+        tsamp = factor * dt;
+        numds = ffa_downsample(data, numdata, factor, ds);
+        avg_var(ds, numds, &avg, &var);
+        norm = (var > 0.0) ? 1.0 / sqrt(var) : 1.0;
+        for (ii = 0; ii < numds; ii++)
+            ds[ii] = (ds[ii] - avg) * norm;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) default(shared) private(jj)
+#endif
+        for (ii = bmin; ii < bmax; ii++) {
+            int numrows, numbins = ii, w, b;
+            float snr, *ffa;
+            double period;
+
+            numrows = numds / numbins;
+            if (numrows < 2 || numbins * tsamp > pmax)
+                continue;
+            ffa = gen_fvect((long) numrows * numbins);
+            ffa_transform(ds, numrows, numbins, ffa);
+            for (jj = 0; jj < numrows; jj++) {
+                period = tsamp * (numbins + jj / (numrows - 1.0));
+                if (period < pmin || period > pmax)
+                    continue;
+                snr = ffa_boxcar_snr(ffa + (long) jj * numbins, numbins,
+                                     widths, numwidths, sqrt(numrows), &w, &b);
+                if (snr >= snrmin) {
+#ifdef _OPENMP
+#pragma omp critical (ffa_hits)
+#endif
+                    {
+                        if (numhits == maxhits) {
+                            maxhits += HITCHUNK;
+                            hits = (ffacand *) realloc(hits,
+                                                       sizeof(ffacand) * maxhits);
+                        }
+                        hits[numhits].period = period;
+                        hits[numhits].dt = tsamp;
+                        hits[numhits].snr = snr;
+                        hits[numhits].sigma = 0.0;
+                        hits[numhits].phase = (float) b / numbins;
+                        hits[numhits].width = w;
+                        hits[numhits].numbins = numbins;
+                        numhits++;
+                    }
+                }
+            }
+#ifdef _OPENMP
+#pragma omp atomic
+#endif
+            numtrials += numrows;
+            vect_free(ffa);
+        }
+        factor *= (double) bmax / bmin;
+    }
+    vect_free(ds);
+    vect_free(widths);
+
+    /* Cluster the detections.  A detection is part of a stronger    */
+    /* candidate if the pulse drifts by less than two of the larger  */
+    /* of their boxcar widths over the observation.                  */
+
+    qsort(hits, numhits, sizeof(ffacand), compare_ffacand_snr);
+    cands = (ffacand *) malloc(sizeof(ffacand) * (numhits ? numhits : 1));
+    for (ii = 0; ii < numhits; ii++) {
+        for (jj = 0; jj < ncands; jj++) {
+            double wmax = cands[jj].width * cands[jj].dt;
+            if (hits[ii].width * hits[ii].dt > wmax)
+                wmax = hits[ii].width * hits[ii].dt;
+            tol = 2.0 * cands[jj].period * wmax / T;
+            if (fabs(hits[ii].period - cands[jj].period) < tol)
+                break;
+        }
+        if (jj == ncands)
+            cands[ncands++] = hits[ii];
+    }
+    free(hits);
+    for (ii = 0; ii < ncands; ii++)
+        cands[ii].sigma = ffa_sigma(cands[ii].snr, numtrials);
+    *numcands = ncands;
+    return cands;
+}
+
+#undef HITCHUNK
@@ -0,0 +1,173 @@
+#include "presto.h"
+#include "ffa.h"
+#include "ffasearch_cmd.h"
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+static void write_ffa_cands(ffacand * cands, int numcands, char *rootnm,
+                            infodata * idata)
+/* Write the candidates in text (root_FFA) and binary fourierprops */
+/* (root_FFA.cand) formats.  The fourierprops file can be used     */
+/* with prepfold's -accelfile and -accelcand options.              */
+{
+    int ii;
+    double T, r;
+    char *txtnm, *candnm;
+    FILE *txtfile, *candfile;
+    fourierprops props;
+
+    txtnm = (char *) calloc(strlen(rootnm) + 10, sizeof(char));
+    candnm = (char *) calloc(strlen(rootnm) + 10, sizeof(char));
+    sprintf(txtnm, "%s_FFA", rootnm);
+    sprintf(candnm, "%s_FFA.cand", rootnm);
+    T = idata->N * idata->dt;
+
+    txtfile = chkfopen(txtnm, "w");
+    fprintf(txtfile, "# FFA candidates from '%s.dat'\n", rootnm);
+    fprintf(txtfile, "# Number of bins in the time series    = %.0f\n", idata->N);
+    fprintf(txtfile, "# Width of each time series bin (sec)  = %.15g\n", idata->dt);
+    fprintf(txtfile, "# Dispersion measure (cm-3 pc)         = %.12g\n", idata->dm);
+    fprintf(txtfile, "#%5s  %6s  %7s  %14s  %13s  %14s  %6s  %9s  %6s  %5s\n",
+            "Cand", "Sigma", "S/N", "Period(ms)", "Freq(Hz)", "FFT 'r'(bin)",
+            "Width", "Width(ms)", "Duty", "Phase");
+    candfile = chkfopen(candnm, "wb");
+    memset(&props, 0, sizeof(fourierprops));
+    for (ii = 0; ii < numcands; ii++) {
+        r = T / cands[ii].period;
+        fprintf(txtfile, "%6d  %6.2f  %7.2f  %14.8f  %13.9f  %14.3f  %6d  %9.3f  %6.4f  %5.3f\n",
+                ii + 1, cands[ii].sigma, cands[ii].snr, cands[ii].period * 1000.0,
+                1.0 / cands[ii].period, r, cands[ii].width,
+                cands[ii].width * cands[ii].dt * 1000.0,
+                (double) cands[ii].width / cands[ii].numbins, cands[ii].phase);
+        props.r = r;
+        props.rerr = cands[ii].width * cands[ii].dt / cands[ii].period;
+        props.pow = 0.5 * cands[ii].snr * cands[ii].snr;
+        props.rawpow = cands[ii].snr * cands[ii].snr;
+        props.sig = cands[ii].sigma;
+        props.phs = cands[ii].phase;
+        props.locpow = 1.0;
+        chkfwrite(&props, sizeof(fourierprops), 1, candfile);
+    }
+    fclose(txtfile);
+    fclose(candfile);
+    printf("Candidates in text format are in '%s'.\n", txtnm);
+    printf("Candidates in binary format are in '%s'.\n", candnm);
+    free(txtnm);
+    free(candnm);
+}
+
+
+int main(int argc, char *argv[])
+{
+    int ii, numcands = 0;
+    long long numdata;
+    float *data;
+    double rmed;
+    char *rootnm, *suffix;
+    FILE *infile;
+    infodata idata;
+    ffacand *cands;
+    Cmdline *cmd;
+
+    /* Call usage() if we have no command line arguments */
+
+    if (argc == 1) {
+        Program = argv[0];
+        printf("\n");
+        usage();
+        exit(0);
+    }
+
+    /* Parse the command line using the excellent program Clig */
+
+    cmd = parseCmdline(argc, argv);
+
+    if (cmd->ncpus > 1) {
+#ifdef _OPENMP
+        int maxcpus = omp_get_num_procs();
+        int openmp_numthreads = (cmd->ncpus <= maxcpus) ? cmd->ncpus : maxcpus;
+        // Make sure we are not dynamically setting the number of threads
+        omp_set_dynamic(0);
+        omp_set_num_threads(openmp_numthreads);
+        printf("Using %d threads with OpenMP\n\n", openmp_numthreads);
+#endif
+    } else {
+#ifdef _OPENMP
+        omp_set_num_threads(1); // Explicitly turn off OpenMP
+#endif
+    }
+
+#ifdef DEBUG
+    showOptionValues();
+#endif
+
+    printf("\n\n");
+    printf("        Fast Folding Algorithm Periodicity Search\n\n");
+
+    if (!split_root_suffix(cmd->argv[0], &rootnm, &suffix) ||
+        strcmp(suffix, "dat") != 0) {
+        printf("\nInput file ('%s') must be a time series ('.dat')!\n\n",
+               cmd->argv[0]);
+        exit(1);
+    }
+    free(suffix);
+    if (cmd->pmin >= cmd->pmax) {
+        printf("\nThe minimum period (%g s) must be less than the maximum (%g s)!\n\n",
+               cmd->pmin, cmd->pmax);
+        exit(1);
+    }
+    if (cmd->bmin >= cmd->bmax) {
+        printf("\n-bmin (%d) must be less than -bmax (%d)!\n\n", cmd->bmin, cmd->bmax);
+        exit(1);
+    }
+
+    /* Read the info file and the data */
+
+    readinf(&idata, rootnm);
+    infile = chkfopen(cmd->argv[0], "rb");
+    numdata = chkfilelen(infile, sizeof(float));
+    data = read_float_file(infile, 0, numdata);
+    fclose(infile);
+    printf("Read %lld points (%.1f s) from '%s'.\n",
+           numdata, numdata * idata.dt, cmd->argv[0]);
+    if (cmd->pmin < cmd->bmin * idata.dt) {
+        printf("\nWARNING:  -pmin is shorter than bmin samples.  Searching from %g s.\n",
+               cmd->bmin * idata.dt);
+        cmd->pmin = cmd->bmin * idata.dt;
+    }
+    if (cmd->pmax > 0.5 * numdata * idata.dt) {
+        printf("\nWARNING:  -pmax is longer than half the observation.  Searching to %g s.\n",
+               0.5 * numdata * idata.dt);
+        cmd->pmax = 0.5 * numdata * idata.dt;
+    }
+
+    /* Remove the red noise and normalize */
+
+    rmed = (cmd->rmedP) ? cmd->rmed : 4.0 * cmd->pmax;
+    printf("Removing a %.1f s running median and normalizing...\n", rmed);
+    ffa_detrend(data, numdata, (long) (rmed / idata.dt + 0.5));
+
+    /* Do the search */
+
+    printf("Searching periods from %g to %g s with %d-%d bin profiles...\n",
+           cmd->pmin, cmd->pmax, cmd->bmin, cmd->bmax);
+    cands = ffa_search(data, numdata, idata.dt, cmd->pmin, cmd->pmax,
+                       cmd->bmin, cmd->bmax, cmd->maxduty, cmd->snr, &numcands);
+    vect_free(data);
+    if (numcands > cmd->numcands)
+        numcands = cmd->numcands;
+    printf("Found %d candidates with S/N >= %.1f.\n\n", numcands, cmd->snr);
+    for (ii = 0; ii < numcands && ii < 10; ii++)
+        printf("  %3d:  P = %12.8f s  S/N = %6.2f  sigma = %6.2f  width = %d bins\n",
+               ii + 1, cands[ii].period, cands[ii].snr, cands[ii].sigma,
+               cands[ii].width);
+    if (numcands)
+        printf("\n");
+
+    write_ffa_cands(cands, numcands, rootnm, &idata);
+    printf("\nDone.\n\n");
+    free(cands);
+    free(rootnm);
+    return (0);
+}
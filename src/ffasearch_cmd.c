@@ -0,0 +1,1050 @@
+/*****
+  command line parser -- generated by clig
+  (http://wsd.iitb.fhg.de/~kir/clighome/)
+
+  The command line parser `clig':
+  (C) 1995-2004 Harald Kirsch (clig@geggus.net)
+*****/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <errno.h>
+#include <limits.h>
+#include <float.h>
+#include <math.h>
+
+#include "ffasearch_cmd.h"
+
+char *Program;
+
+/*@-null*/
+
+static Cmdline cmd = {
+  /***** -ncpus: Number of processors to use with OpenMP */
+  /* ncpusP = */ 1,
+  /* ncpus = */ 1,
+  /* ncpusC = */ 1,
+  /***** -pmin: Shortest period to search (s) */
+  /* pminP = */ 1,
+  /* pmin = */ 0.5,
+  /* pminC = */ 1,
+  /***** -pmax: Longest period to search (s) */
+  /* pmaxP = */ 1,
+  /* pmax = */ 10.0,
+  /* pmaxC = */ 1,
+  /***** -bmin: Minimum number of bins in the folded profiles */
+  /* bminP = */ 1,
+  /* bmin = */ 240,
+  /* bminC = */ 1,
+  /***** -bmax: Maximum number of bins in the folded profiles (the data are downsampled by bmax/bmin per octave) */
+  /* bmaxP = */ 1,
+  /* bmax = */ 260,
+  /* bmaxC = */ 1,
+  /***** -maxduty: Widest boxcar to test as a fraction of the period */
+  /* maxdutyP = */ 1,
+  /* maxduty = */ 0.2,
+  /* maxdutyC = */ 1,
+  /***** -rmed: Width (s) of the running median used to remove red noise (default is 4 * pmax) */
+  /* rmedP = */ 0,
+  /* rmed = */ (double)0,
+  /* rmedC = */ 0,
+  /***** -snr: Minimum boxcar S/N of the candidates to keep */
+  /* snrP = */ 1,
+  /* snr = */ 6.0,
+  /* snrC = */ 1,
+  /***** -numcands: Maximum number of candidates to return */
+  /* numcandsP = */ 1,
+  /* numcands = */ 200,
+  /* numcandsC = */ 1,
+  /***** uninterpreted rest of command line */
+  /* argc = */ 0,
+  /* argv = */ (char**)0,
+  /***** the original command line concatenated */
+  /* full_cmd_line = */ NULL
+};
+
+/*@=null*/
+
+/***** let LCLint run more smoothly */
+/*@-predboolothers*/
+/*@-boolops*/
+
+
+/******************************************************************/
+/*****
+ This is a bit tricky. We want to make a difference between overflow
+ and underflow and we want to allow v==Inf or v==-Inf but not
+ v>FLT_MAX. 
+
+ We don't use fabs to avoid linkage with -lm.
+*****/
+static void
+checkFloatConversion(double v, char *option, char *arg)
+{
+  char *err = NULL;
+
+  if( (errno==ERANGE && v!=0.0) /* even double overflowed */
+      || (v<HUGE_VAL && v>-HUGE_VAL && (v<0.0?-v:v)>(double)FLT_MAX) ) {
+    err = "large";
+  } else if( (errno==ERANGE && v==0.0) 
+	     || (v!=0.0 && (v<0.0?-v:v)<(double)FLT_MIN) ) {
+    err = "small";
+  }
+  if( err ) {
+    fprintf(stderr, 
+	    "%s: parameter `%s' of option `%s' to %s to represent\n",
+	    Program, arg, option, err);
+    exit(EXIT_FAILURE);
+  }
+}
+
+int
+getIntOpt(int argc, char **argv, int i, int *value, int force)
+{
+  char *end;
+  long v;
+
+  if( ++i>=argc ) goto nothingFound;
+
+  errno = 0;
+  v = strtol(argv[i], &end, 0);
+
+  /***** check for conversion error */
+  if( end==argv[i] ) goto nothingFound;
+
+  /***** check for surplus non-whitespace */
+  while( isspace((int) *end) ) end+=1;
+  if( *end ) goto nothingFound;
+
+  /***** check if it fits into an int */
+  if( errno==ERANGE || v>(long)INT_MAX || v<(long)INT_MIN ) {
+    fprintf(stderr, 
+	    "%s: parameter `%s' of option `%s' to large to represent\n",
+	    Program, argv[i], argv[i-1]);
+    exit(EXIT_FAILURE);
+  }
+  *value = (int)v;
+
+  return i;
+
+nothingFound:
+  if( !force ) return i-1;
+
+  fprintf(stderr, 
+	  "%s: missing or malformed integer value after option `%s'\n",
+	  Program, argv[i-1]);
+    exit(EXIT_FAILURE);
+}
+/**********************************************************************/
+
+int
+getIntOpts(int argc, char **argv, int i, 
+	   int **values,
+	   int cmin, int cmax)
+/*****
+  We want to find at least cmin values and at most cmax values.
+  cmax==-1 then means infinitely many are allowed.
+*****/
+{
+  int alloced, used;
+  char *end;
+  long v;
+  if( i+cmin >= argc ) {
+    fprintf(stderr, 
+	    "%s: option `%s' wants at least %d parameters\n",
+	    Program, argv[i], cmin);
+    exit(EXIT_FAILURE);
+  }
+
+  /***** 
+    alloc a bit more than cmin values. It does not hurt to have room
+    for a bit more values than cmax.
+  *****/
+  alloced = cmin + 4;
+  *values = (int*)calloc((size_t)alloced, sizeof(int));
+  if( ! *values ) {
+outMem:
+    fprintf(stderr, 
+	    "%s: out of memory while parsing option `%s'\n",
+	    Program, argv[i]);
+    exit(EXIT_FAILURE);
+  }
+
+  for(used=0; (cmax==-1 || used<cmax) && used+i+1<argc; used++) {
+    if( used==alloced ) {
+      alloced += 8;
+      *values = (int *) realloc(*values, alloced*sizeof(int));
+      if( !*values ) goto outMem;
+    }
+
+    errno = 0;
+    v = strtol(argv[used+i+1], &end, 0);
+
+    /***** check for conversion error */
+    if( end==argv[used+i+1] ) break;
+
+    /***** check for surplus non-whitespace */
+    while( isspace((int) *end) ) end+=1;
+    if( *end ) break;
+
+    /***** check for overflow */
+    if( errno==ERANGE || v>(long)INT_MAX || v<(long)INT_MIN ) {
+      fprintf(stderr, 
+	      "%s: parameter `%s' of option `%s' to large to represent\n",
+	      Program, argv[i+used+1], argv[i]);
+      exit(EXIT_FAILURE);
+    }
+
+    (*values)[used] = (int)v;
+
+  }
+    
+  if( used<cmin ) {
+    fprintf(stderr, 
+	    "%s: parameter `%s' of `%s' should be an "
+	    "integer value\n",
+	    Program, argv[i+used+1], argv[i]);
+    exit(EXIT_FAILURE);
+  }
+
+  return i+used;
+}
+/**********************************************************************/
+
+int
+getLongOpt(int argc, char **argv, int i, long *value, int force)
+{
+  char *end;
+
+  if( ++i>=argc ) goto nothingFound;
+
+  errno = 0;
+  *value = strtol(argv[i], &end, 0);
+
+  /***** check for conversion error */
+  if( end==argv[i] ) goto nothingFound;
+
+  /***** check for surplus non-whitespace */
+  while( isspace((int) *end) ) end+=1;
+  if( *end ) goto nothingFound;
+
+  /***** check for overflow */
+  if( errno==ERANGE ) {
+    fprintf(stderr, 
+	    "%s: parameter `%s' of option `%s' to large to represent\n",
+	    Program, argv[i], argv[i-1]);
+    exit(EXIT_FAILURE);
+  }
+  return i;
+
+nothingFound:
+  /***** !force means: this parameter may be missing.*/
+  if( !force ) return i-1;
+
+  fprintf(stderr, 
+	  "%s: missing or malformed value after option `%s'\n",
+	  Program, argv[i-1]);
+    exit(EXIT_FAILURE);
+}
+/**********************************************************************/
+
+int
+getLongOpts(int argc, char **argv, int i, 
+	    long **values,
+	    int cmin, int cmax)
+/*****
+  We want to find at least cmin values and at most cmax values.
+  cmax==-1 then means infinitely many are allowed.
+*****/
+{
+  int alloced, used;
+  char *end;
+
+  if( i+cmin >= argc ) {
+    fprintf(stderr, 
+	    "%s: option `%s' wants at least %d parameters\n",
+	    Program, argv[i], cmin);
+    exit(EXIT_FAILURE);
+  }
+
+  /***** 
+    alloc a bit more than cmin values. It does not hurt to have room
+    for a bit more values than cmax.
+  *****/
+  alloced = cmin + 4;
+  *values = (long int *)calloc((size_t)alloced, sizeof(long));
+  if( ! *values ) {
+outMem:
+    fprintf(stderr, 
+	    "%s: out of memory while parsing option `%s'\n",
+	    Program, argv[i]);
+    exit(EXIT_FAILURE);
+  }
+
+  for(used=0; (cmax==-1 || used<cmax) && used+i+1<argc; used++) {
+    if( used==alloced ) {
+      alloced += 8;
+      *values = (long int*) realloc(*values, alloced*sizeof(long));
+      if( !*values ) goto outMem;
+    }
+
+    errno = 0;
+    (*values)[used] = strtol(argv[used+i+1], &end, 0);
+
+    /***** check for conversion error */
+    if( end==argv[used+i+1] ) break;
+
+    /***** check for surplus non-whitespace */
+    while( isspace((int) *end) ) end+=1; 
+    if( *end ) break;
+
+    /***** check for overflow */
+    if( errno==ERANGE ) {
+      fprintf(stderr, 
+	      "%s: parameter `%s' of option `%s' to large to represent\n",
+	      Program, argv[i+used+1], argv[i]);
+      exit(EXIT_FAILURE);
+    }
+
+  }
+    
+  if( used<cmin ) {
+    fprintf(stderr, 
+	    "%s: parameter `%s' of `%s' should be an "
+	    "integer value\n",
+	    Program, argv[i+used+1], argv[i]);
+    exit(EXIT_FAILURE);
+  }
+
+  return i+used;
+}
+/**********************************************************************/
+
+int
+getFloatOpt(int argc, char **argv, int i, float *value, int force)
+{
+  char *end;
+  double v;
+
+  if( ++i>=argc ) goto nothingFound;
+
+  errno = 0;
+  v = strtod(argv[i], &end);
+
+  /***** check for conversion error */
+  if( end==argv[i] ) goto nothingFound;
+
+  /***** check for surplus non-whitespace */
+  while( isspace((int) *end) ) end+=1;
+  if( *end ) goto nothingFound;
+
+  /***** check for overflow */
+  checkFloatConversion(v, argv[i-1], argv[i]);
+
+  *value = (float)v;
+
+  return i;
+
+nothingFound:
+  if( !force ) return i-1;
+
+  fprintf(stderr,
+	  "%s: missing or malformed float value after option `%s'\n",
+	  Program, argv[i-1]);
+  exit(EXIT_FAILURE);
+ 
+}
+/**********************************************************************/
+
+int
+getFloatOpts(int argc, char **argv, int i, 
+	   float **values,
+	   int cmin, int cmax)
+/*****
+  We want to find at least cmin values and at most cmax values.
+  cmax==-1 then means infinitely many are allowed.
+*****/
+{
+  int alloced, used;
+  char *end;
+  double v;
+
+  if( i+cmin >= argc ) {
+    fprintf(stderr, 
+	    "%s: option `%s' wants at least %d parameters\n",
+	    Program, argv[i], cmin);
+    exit(EXIT_FAILURE);
+  }
+
+  /***** 
+    alloc a bit more than cmin values.
+  *****/
+  alloced = cmin + 4;
+  *values = (float*)calloc((size_t)alloced, sizeof(float));
+  if( ! *values ) {
+outMem:
+    fprintf(stderr, 
+	    "%s: out of memory while parsing option `%s'\n",
+	    Program, argv[i]);
+    exit(EXIT_FAILURE);
+  }
+
+  for(used=0; (cmax==-1 || used<cmax) && used+i+1<argc; used++) {
+    if( used==alloced ) {
+      alloced += 8;
+      *values = (float *) realloc(*values, alloced*sizeof(float));
+      if( !*values ) goto outMem;
+    }
+
+    errno = 0;
+    v = strtod(argv[used+i+1], &end);
+
+    /***** check for conversion error */
+    if( end==argv[used+i+1] ) break;
+
+    /***** check for surplus non-whitespace */
+    while( isspace((int) *end) ) end+=1;
+    if( *end ) break;
+
+    /***** check for overflow */
+    checkFloatConversion(v, argv[i], argv[i+used+1]);
+    
+    (*values)[used] = (float)v;
+  }
+    
+  if( used<cmin ) {
+    fprintf(stderr, 
+	    "%s: parameter `%s' of `%s' should be a "
+	    "floating-point value\n",
+	    Program, argv[i+used+1], argv[i]);
+    exit(EXIT_FAILURE);
+  }
+
+  return i+used;
+}
+/**********************************************************************/
+
+int
+getDoubleOpt(int argc, char **argv, int i, double *value, int force)
+{
+  char *end;
+
+  if( ++i>=argc ) goto nothingFound;
+
+  errno = 0;
+  *value = strtod(argv[i], &end);
+
+  /***** check for conversion error */
+  if( end==argv[i] ) goto nothingFound;
+
+  /***** check for surplus non-whitespace */
+  while( isspace((int) *end) ) end+=1;
+  if( *end ) goto nothingFound;
+
+  /***** check for overflow */
+  if( errno==ERANGE ) {
+    fprintf(stderr, 
+	    "%s: parameter `%s' of option `%s' to %s to represent\n",
+	    Program, argv[i], argv[i-1],
+	    (*value==0.0 ? "small" : "large"));
+    exit(EXIT_FAILURE);
+  }
+
+  return i;
+
+nothingFound:
+  if( !force ) return i-1;
+
+  fprintf(stderr,
+	  "%s: missing or malformed value after option `%s'\n",
+	  Program, argv[i-1]);
+  exit(EXIT_FAILURE);
+ 
+}
+/**********************************************************************/
+
+int
+getDoubleOpts(int argc, char **argv, int i, 
+	   double **values,
+	   int cmin, int cmax)
+/*****
+  We want to find at least cmin values and at most cmax values.
+  cmax==-1 then means infinitely many are allowed.
+*****/
+{
+  int alloced, used;
+  char *end;
+
+  if( i+cmin >= argc ) {
+    fprintf(stderr, 
+	    "%s: option `%s' wants at least %d parameters\n",
+	    Program, argv[i], cmin);
+    exit(EXIT_FAILURE);
+  }
+
+  /***** 
+    alloc a bit more than cmin values.
+  *****/
+  alloced = cmin + 4;
+  *values = (double*)calloc((size_t)alloced, sizeof(double));
+  if( ! *values ) {
+outMem:
+    fprintf(stderr, 
+	    "%s: out of memory while parsing option `%s'\n",
+	    Program, argv[i]);
+    exit(EXIT_FAILURE);
+  }
+
+  for(used=0; (cmax==-1 || used<cmax) && used+i+1<argc; used++) {
+    if( used==alloced ) {
+      alloced += 8;
+      *values = (double *) realloc(*values, alloced*sizeof(double));
+      if( !*values ) goto outMem;
+    }
+
+    errno = 0;
+    (*values)[used] = strtod(argv[used+i+1], &end);
+
+    /***** check for conversion error */
+    if( end==argv[used+i+1] ) break;
+
+    /***** check for surplus non-whitespace */
+    while( isspace((int) *end) ) end+=1;
+    if( *end ) break;
+
+    /***** check for overflow */
+    if( errno==ERANGE ) {
+      fprintf(stderr, 
+	      "%s: parameter `%s' of option `%s' to %s to represent\n",
+	      Program, argv[i+used+1], argv[i],
+	      ((*values)[used]==0.0 ? "small" : "large"));
+      exit(EXIT_FAILURE);
+    }
+
+  }
+    
+  if( used<cmin ) {
+    fprintf(stderr, 
+	    "%s: parameter `%s' of `%s' should be a "
+	    "double value\n",
+	    Program, argv[i+used+1], argv[i]);
+    exit(EXIT_FAILURE);
+  }
+
+  return i+used;
+}
+/**********************************************************************/
+
+/**
+  force will be set if we need at least one argument for the option.
+*****/
+int
+getStringOpt(int argc, char **argv, int i, char **value, int force)
+{
+  i += 1;
+  if( i>=argc ) {
+    if( force ) {
+      fprintf(stderr, "%s: missing string after option `%s'\n",
+	      Program, argv[i-1]);
+      exit(EXIT_FAILURE);
+    } 
+    return i-1;
+  }
+  
+  if( !force && argv[i][0] == '-' ) return i-1;
+  *value = argv[i];
+  return i;
+}
+/**********************************************************************/
+
+int
+getStringOpts(int argc, char **argv, int i, 
+	   char*  **values,
+	   int cmin, int cmax)
+/*****
+  We want to find at least cmin values and at most cmax values.
+  cmax==-1 then means infinitely many are allowed.
+*****/
+{
+  int alloced, used;
+
+  if( i+cmin >= argc ) {
+    fprintf(stderr, 
+	    "%s: option `%s' wants at least %d parameters\n",
+	    Program, argv[i], cmin);
+    exit(EXIT_FAILURE);
+  }
+
+  alloced = cmin + 4;
+    
+  *values = (char**)calloc((size_t)alloced, sizeof(char*));
+  if( ! *values ) {
+outMem:
+    fprintf(stderr, 
+	    "%s: out of memory during parsing of option `%s'\n",
+	    Program, argv[i]);
+    exit(EXIT_FAILURE);
+  }
+
+  for(used=0; (cmax==-1 || used<cmax) && used+i+1<argc; used++) {
+    if( used==alloced ) {
+      alloced += 8;
+      *values = (char **)realloc(*values, alloced*sizeof(char*));
+      if( !*values ) goto outMem;
+    }
+
+    if( used>=cmin && argv[used+i+1][0]=='-' ) break;
+    (*values)[used] = argv[used+i+1];
+  }
+    
+  if( used<cmin ) {
+    fprintf(stderr, 
+    "%s: less than %d parameters for option `%s', only %d found\n",
+	    Program, cmin, argv[i], used);
+    exit(EXIT_FAILURE);
+  }
+
+  return i+used;
+}
+/**********************************************************************/
+
+void
+checkIntLower(char *opt, int *values, int count, int max)
+{
+  int i;
+
+  for(i=0; i<count; i++) {
+    if( values[i]<=max ) continue;
+    fprintf(stderr, 
+	    "%s: parameter %d of option `%s' greater than max=%d\n",
+	    Program, i+1, opt, max);
+    exit(EXIT_FAILURE);
+  }
+}
+/**********************************************************************/
+
+void
+checkIntHigher(char *opt, int *values, int count, int min)
+{
+  int i;
+
+  for(i=0; i<count; i++) {
+    if( values[i]>=min ) continue;
+    fprintf(stderr, 
+	    "%s: parameter %d of option `%s' smaller than min=%d\n",
+	    Program, i+1, opt, min);
+    exit(EXIT_FAILURE);
+  }
+}
+/**********************************************************************/
+
+void
+checkLongLower(char *opt, long *values, int count, long max)
+{
+  int i;
+
+  for(i=0; i<count; i++) {
+    if( values[i]<=max ) continue;
+    fprintf(stderr, 
+	    "%s: parameter %d of option `%s' greater than max=%ld\n",
+	    Program, i+1, opt, max);
+    exit(EXIT_FAILURE);
+  }
+}
+/**********************************************************************/
+
+void
+checkLongHigher(char *opt, long *values, int count, long min)
+{
+  int i;
+
+  for(i=0; i<count; i++) {
+    if( values[i]>=min ) continue;
+    fprintf(stderr, 
+	    "%s: parameter %d of option `%s' smaller than min=%ld\n",
+	    Program, i+1, opt, min);
+    exit(EXIT_FAILURE);
+  }
+}
+/**********************************************************************/
+
+void
+checkFloatLower(char *opt, float *values, int count, float max)
+{
+  int i;
+
+  for(i=0; i<count; i++) {
+    if( values[i]<=max ) continue;
+    fprintf(stderr, 
+	    "%s: parameter %d of option `%s' greater than max=%f\n",
+	    Program, i+1, opt, max);
+    exit(EXIT_FAILURE);
+  }
+}
+/**********************************************************************/
+
+void
+checkFloatHigher(char *opt, float *values, int count, float min)
+{
+  int i;
+
+  for(i=0; i<count; i++) {
+    if( values[i]>=min ) continue;
+    fprintf(stderr, 
+	    "%s: parameter %d of option `%s' smaller than min=%f\n",
+	    Program, i+1, opt, min);
+    exit(EXIT_FAILURE);
+  }
+}
+/**********************************************************************/
+
+void
+checkDoubleLower(char *opt, double *values, int count, double max)
+{
+  int i;
+
+  for(i=0; i<count; i++) {
+    if( values[i]<=max ) continue;
+    fprintf(stderr, 
+	    "%s: parameter %d of option `%s' greater than max=%f\n",
+	    Program, i+1, opt, max);
+    exit(EXIT_FAILURE);
+  }
+}
+/**********************************************************************/
+
+void
+checkDoubleHigher(char *opt, double *values, int count, double min)
+{
+  int i;
+
+  for(i=0; i<count; i++) {
+    if( values[i]>=min ) continue;
+    fprintf(stderr, 
+	    "%s: parameter %d of option `%s' smaller than min=%f\n",
+	    Program, i+1, opt, min);
+    exit(EXIT_FAILURE);
+  }
+}
+/**********************************************************************/
+
+static void
+missingErr(char *opt)
+{
+  fprintf(stderr, "%s: mandatory option `%s' missing\n",
+	  Program, opt);
+}
+/**********************************************************************/
+
+static char *
+catArgv(int argc, char **argv)
+{
+  int i;
+  size_t l;
+  char *s, *t;
+
+  for(i=0, l=0; i<argc; i++) l += (1+strlen(argv[i]));
+  s = (char *)malloc(l);
+  if( !s ) {
+    fprintf(stderr, "%s: out of memory\n", Program);
+    exit(EXIT_FAILURE);
+  }
+  strcpy(s, argv[0]);
+  t = s;
+  for(i=1; i<argc; i++) {
+    t = t+strlen(t);
+    *t++ = ' ';
+    strcpy(t, argv[i]);
+  }
+  return s;
+}
+/**********************************************************************/
+
+void
+showOptionValues(void)
+{
+  int i;
+
+  printf("Full command line is:\n`%s'\n", cmd.full_cmd_line);
+
+  /***** -ncpus: Number of processors to use with OpenMP */
+  if( !cmd.ncpusP ) {
+    printf("-ncpus not found.\n");
+  } else {
+    printf("-ncpus found:\n");
+    if( !cmd.ncpusC ) {
+      printf("  no values\n");
+    } else {
+      printf("  value = `%d'\n", cmd.ncpus);
+    }
+  }
+
+  /***** -pmin: Shortest period to search (s) */
+  if( !cmd.pminP ) {
+    printf("-pmin not found.\n");
+  } else {
+    printf("-pmin found:\n");
+    if( !cmd.pminC ) {
+      printf("  no values\n");
+    } else {
+      printf("  value = `%.40g'\n", cmd.pmin);
+    }
+  }
+
+  /***** -pmax: Longest period to search (s) */
+  if( !cmd.pmaxP ) {
+    printf("-pmax not found.\n");
+  } else {
+    printf("-pmax found:\n");
+    if( !cmd.pmaxC ) {
+      printf("  no values\n");
+    } else {
+      printf("  value = `%.40g'\n", cmd.pmax);
+    }
+  }
+
+  /***** -bmin: Minimum number of bins in the folded profiles */
+  if( !cmd.bminP ) {
+    printf("-bmin not found.\n");
+  } else {
+    printf("-bmin found:\n");
+    if( !cmd.bminC ) {
+      printf("  no values\n");
+    } else {
+      printf("  value = `%d'\n", cmd.bmin);
+    }
+  }
+
+  /***** -bmax: Maximum number of bins in the folded profiles (the data are downsampled by bmax/bmin per octave) */
+  if( !cmd.bmaxP ) {
+    printf("-bmax not found.\n");
+  } else {
+    printf("-bmax found:\n");
+    if( !cmd.bmaxC ) {
+      printf("  no values\n");
+    } else {
+      printf("  value = `%d'\n", cmd.bmax);
+    }
+  }
+
+  /***** -maxduty: Widest boxcar to test as a fraction of the period */
+  if( !cmd.maxdutyP ) {
+    printf("-maxduty not found.\n");
+  } else {
+    printf("-maxduty found:\n");
+    if( !cmd.maxdutyC ) {
+      printf("  no values\n");
+    } else {
+      printf("  value = `%.40g'\n", cmd.maxduty);
+    }
+  }
+
+  /***** -rmed: Width (s) of the running median used to remove red noise (default is 4 * pmax) */
+  if( !cmd.rmedP ) {
+    printf("-rmed not found.\n");
+  } else {
+    printf("-rmed found:\n");
+    if( !cmd.rmedC ) {
+      printf("  no values\n");
+    } else {
+      printf("  value = `%.40g'\n", cmd.rmed);
+    }
+  }
+
+  /***** -snr: Minimum boxcar S/N of the candidates to keep */
+  if( !cmd.snrP ) {
+    printf("-snr not found.\n");
+  } else {
+    printf("-snr found:\n");
+    if( !cmd.snrC ) {
+      printf("  no values\n");
+    } else {
+      printf("  value = `%.40g'\n", cmd.snr);
+    }
+  }
+
+  /***** -numcands: Maximum number of candidates to return */
+  if( !cmd.numcandsP ) {
+    printf("-numcands not found.\n");
+  } else {
+    printf("-numcands found:\n");
+    if( !cmd.numcandsC ) {
+      printf("  no values\n");
+    } else {
+      printf("  value = `%d'\n", cmd.numcands);
+    }
+  }
+  if( !cmd.argc ) {
+    printf("no remaining parameters in argv\n");
+  } else {
+    printf("argv =");
+    for(i=0; i<cmd.argc; i++) {
+      printf(" `%s'", cmd.argv[i]);
+    }
+    printf("\n");
+  }
+}
+/**********************************************************************/
+
+void
+usage(void)
+{
+  fprintf(stderr,"%s","   [-ncpus ncpus] [-pmin pmin] [-pmax pmax] [-bmin bmin] [-bmax bmax] [-maxduty maxduty] [-rmed rmed] [-snr snr] [-numcands numcands] [--] infile\n");
+  fprintf(stderr,"%s","      Searches a time series ('.dat' file) for long-period, narrow duty-cycle pulsars using the Fast Folding Algorithm (FFA).\n");
+  fprintf(stderr,"%s","       -ncpus: Number of processors to use with OpenMP\n");
+  fprintf(stderr,"%s","               1 int value between 1 and oo\n");
+  fprintf(stderr,"%s","               default: `1'\n");
+  fprintf(stderr,"%s","        -pmin: Shortest period to search (s)\n");
+  fprintf(stderr,"%s","               1 double value between 0.0 and oo\n");
+  fprintf(stderr,"%s","               default: `0.5'\n");
+  fprintf(stderr,"%s","        -pmax: Longest period to search (s)\n");
+  fprintf(stderr,"%s","               1 double value between 0.0 and oo\n");
+  fprintf(stderr,"%s","               default: `10.0'\n");
+  fprintf(stderr,"%s","        -bmin: Minimum number of bins in the folded profiles\n");
+  fprintf(stderr,"%s","               1 int value between 8 and oo\n");
+  fprintf(stderr,"%s","               default: `240'\n");
+  fprintf(stderr,"%s","        -bmax: Maximum number of bins in the folded profiles (the data are downsampled by bmax/bmin per octave)\n");
+  fprintf(stderr,"%s","               1 int value between 9 and oo\n");
+  fprintf(stderr,"%s","               default: `260'\n");
+  fprintf(stderr,"%s","     -maxduty: Widest boxcar to test as a fraction of the period\n");
+  fprintf(stderr,"%s","               1 double value between 0.0 and 0.5\n");
+  fprintf(stderr,"%s","               default: `0.2'\n");
+  fprintf(stderr,"%s","        -rmed: Width (s) of the running median used to remove red noise (default is 4 * pmax)\n");
+  fprintf(stderr,"%s","               1 double value between 0.0 and oo\n");
+  fprintf(stderr,"%s","         -snr: Minimum boxcar S/N of the candidates to keep\n");
+  fprintf(stderr,"%s","               1 float value between 0.0 and oo\n");
+  fprintf(stderr,"%s","               default: `6.0'\n");
+  fprintf(stderr,"%s","    -numcands: Maximum number of candidates to return\n");
+  fprintf(stderr,"%s","               1 int value between 1 and oo\n");
+  fprintf(stderr,"%s","               default: `200'\n");
+  fprintf(stderr,"%s","       infile: Input '.dat' file name\n");
+  fprintf(stderr,"%s","               1 value\n");
+  fprintf(stderr,"%s","  version: 18Oct26\n");
+  fprintf(stderr,"%s","  ");
+  exit(EXIT_FAILURE);
+}
+/**********************************************************************/
+Cmdline *
+parseCmdline(int argc, char **argv)
+{
+  int i;
+
+  Program = argv[0];
+  cmd.full_cmd_line = catArgv(argc, argv);
+  for(i=1, cmd.argc=1; i<argc; i++) {
+    if( 0==strcmp("--", argv[i]) ) {
+      while( ++i<argc ) argv[cmd.argc++] = argv[i];
+      continue;
+    }
+
+    if( 0==strcmp("-ncpus", argv[i]) ) {
+      int keep = i;
+      cmd.ncpusP = 1;
+      i = getIntOpt(argc, argv, i, &cmd.ncpus, 1);
+      cmd.ncpusC = i-keep;
+      checkIntHigher("-ncpus", &cmd.ncpus, cmd.ncpusC, 1);
+      continue;
+    }
+
+    if( 0==strcmp("-pmin", argv[i]) ) {
+      int keep = i;
+      cmd.pminP = 1;
+      i = getDoubleOpt(argc, argv, i, &cmd.pmin, 1);
+      cmd.pminC = i-keep;
+      checkDoubleHigher("-pmin", &cmd.pmin, cmd.pminC, 0.0);
+      continue;
+    }
+
+    if( 0==strcmp("-pmax", argv[i]) ) {
+      int keep = i;
+      cmd.pmaxP = 1;
+      i = getDoubleOpt(argc, argv, i, &cmd.pmax, 1);
+      cmd.pmaxC = i-keep;
+      checkDoubleHigher("-pmax", &cmd.pmax, cmd.pmaxC, 0.0);
+      continue;
+    }
+
+    if( 0==strcmp("-bmin", argv[i]) ) {
+      int keep = i;
+      cmd.bminP = 1;
+      i = getIntOpt(argc, argv, i, &cmd.bmin, 1);
+      cmd.bminC = i-keep;
+      checkIntHigher("-bmin", &cmd.bmin, cmd.bminC, 8);
+      continue;
+    }
+
+    if( 0==strcmp("-bmax", argv[i]) ) {
+      int keep = i;
+      cmd.bmaxP = 1;
+      i = getIntOpt(argc, argv, i, &cmd.bmax, 1);
+      cmd.bmaxC = i-keep;
+      checkIntHigher("-bmax", &cmd.bmax, cmd.bmaxC, 9);
+      continue;
+    }
+
+    if( 0==strcmp("-maxduty", argv[i]) ) {
+      int keep = i;
+      cmd.maxdutyP = 1;
+      i = getDoubleOpt(argc, argv, i, &cmd.maxduty, 1);
+      cmd.maxdutyC = i-keep;
+      checkDoubleLower("-maxduty", &cmd.maxduty, cmd.maxdutyC, 0.5);
+      checkDoubleHigher("-maxduty", &cmd.maxduty, cmd.maxdutyC, 0.0);
+      continue;
+    }
+
+    if( 0==strcmp("-rmed", argv[i]) ) {
+      int keep = i;
+      cmd.rmedP = 1;
+      i = getDoubleOpt(argc, argv, i, &cmd.rmed, 1);
+      cmd.rmedC = i-keep;
+      checkDoubleHigher("-rmed", &cmd.rmed, cmd.rmedC, 0.0);
+      continue;
+    }
+
+    if( 0==strcmp("-snr", argv[i]) ) {
+      int keep = i;
+      cmd.snrP = 1;
+      i = getFloatOpt(argc, argv, i, &cmd.snr, 1);
+      cmd.snrC = i-keep;
+      checkFloatHigher("-snr", &cmd.snr, cmd.snrC, 0.0);
+      continue;
+    }
+
+    if( 0==strcmp("-numcands", argv[i]) ) {
+      int keep = i;
+      cmd.numcandsP = 1;
+      i = getIntOpt(argc, argv, i, &cmd.numcands, 1);
+      cmd.numcandsC = i-keep;
+      checkIntHigher("-numcands", &cmd.numcands, cmd.numcandsC, 1);
+      continue;
+    }
+
+    if( argv[i][0]=='-' ) {
+      fprintf(stderr, "\n%s: unknown option `%s'\n\n",
+              Program, argv[i]);
+      usage();
+    }
+    argv[cmd.argc++] = argv[i];
+  }/* for i */
+
+
+  /*@-mustfree*/
+  cmd.argv = argv+1;
+  /*@=mustfree*/
+  cmd.argc -= 1;
+
+  if( 1>cmd.argc ) {
+    fprintf(stderr, "%s: there should be at least 1 non-option argument(s)\n",
+            Program);
+    exit(EXIT_FAILURE);
+  }
+  if( 1<cmd.argc ) {
+    fprintf(stderr, "%s: there should be at most 1 non-option argument(s)\n",
+            Program);
+    exit(EXIT_FAILURE);
+  }
+  /*@-compmempass*/  return &cmd;
+}
+
@@ -0,0 +1,500 @@
+#include "presto.h"
+
+/* A C version of Joe Taylor's FFTFIT (Taylor 1992, Phil. Trans. R.   */
+/* Soc. Lond. A, 341, 117) that follows the Fortran code in           */
+/* python/fftfit_src step for step (including the 64-lag CCF used to  */
+/* get the initial guess and the harmonic-by-harmonic Brent refining  */
+/* of tau), so that results agree with the Python 'fftfit' module to  */
+/* single-precision rounding.  It is thread safe and re-entrant so    */
+/* that many profiles can be fit in parallel.                         */
+
+#define FFTFIT_NPROF   64
+#define FFTFIT_ITMAX   100
+#define FFTFIT_EPS     6.e-8
+
+
+static void ffft(fcomplex * d, int npts, int isign)
+/* In-place radix-2 complex FFT of length 'npts' (a power-of-two).  */
+/* This is Taylor's ffft() (the same as Brenner's FOUR1).  Note     */
+/* that isign = +1 is the "forward" transform used by cprof().      */
+/* It is done in single precision (as in the Fortran) so that the   */
+/* noise floor of the high harmonics (and therefore 'ngood') is the */
+/* same as that of the original code.                               */
+{
+    int ii, jj, m, mmax, istep, irev;
+    float api, wr, wi, wsr, wsi, tr, ti, tmp;
+
+    /* Shuffle the data to bit-reversed order */
+    irev = 0;
+    for (ii = 0; ii < npts; ii++) {
+        if (ii < irev) {
+            fcomplex t = d[ii];
+            d[ii] = d[irev];
+            d[irev] = t;
+        }
+        mmax = npts >> 1;
+        while (mmax >= 1 && irev >= mmax) {
+            irev -= mmax;
+            mmax >>= 1;
+        }
+        irev += mmax;
+    }
+
+    /* The radix-2 transform */
+    api = isign * PIBYTWO;
+    for (mmax = 1; mmax < npts; mmax = istep) {
+        istep = 2 * mmax;
+        tmp = sin(api / mmax);
+        wsr = -2.0 * tmp * tmp;
+        wsi = sin(2.0 * api / mmax);
+        wr = 1.0;
+        wi = 0.0;
+        for (m = 0; m < mmax; m++) {
+            for (ii = m; ii < npts; ii += istep) {
+                jj = ii + mmax;
+                tr = wr * d[jj].r - wi * d[jj].i;
+                ti = wr * d[jj].i + wi * d[jj].r;
+                d[jj].r = d[ii].r - tr;
+                d[jj].i = d[ii].i - ti;
+                d[ii].r += tr;
+                d[ii].i += ti;
+            }
+            tmp = wr;
+            wr += tmp * wsr - wi * wsi;
+            wi += tmp * wsi + wi * wsr;
+        }
+    }
+}
+
+
+static void dffft(dcomplex * d, int npts, int isign)
+/* A double precision version of ffft() for fft_rotate() */
+{
+    int ii, jj, m, mmax, istep, irev;
+    double api, wr, wi, wsr, wsi, tr, ti, tmp;
+
+    /* Shuffle the data to bit-reversed order */
+    irev = 0;
+    for (ii = 0; ii < npts; ii++) {
+        if (ii < irev) {
+            dcomplex t = d[ii];
+            d[ii] = d[irev];
+            d[irev] = t;
+        }
+        mmax = npts >> 1;
+        while (mmax >= 1 && irev >= mmax) {
+            irev -= mmax;
+            mmax >>= 1;
+        }
+        irev += mmax;
+    }
+
+    /* The radix-2 transform */
+    api = isign * PIBYTWO;
+    for (mmax = 1; mmax < npts; mmax = istep) {
+        istep = 2 * mmax;
+        tmp = sin(api / mmax);
+        wsr = -2.0 * tmp * tmp;
+        wsi = sin(2.0 * api / mmax);
+        wr = 1.0;
+        wi = 0.0;
+        for (m = 0; m < mmax; m++) {
+            for (ii = m; ii < npts; ii += istep) {
+                jj = ii + mmax;
+                tr = wr * d[jj].r - wi * d[jj].i;
+                ti = wr * d[jj].i + wi * d[jj].r;
+                d[jj].r = d[ii].r - tr;
+                d[jj].i = d[ii].i - ti;
+                d[ii].r += tr;
+                d[ii].i += ti;
+            }
+            tmp = wr;
+            wr += tmp * wsr - wi * wsi;
+            wi += tmp * wsi + wi * wsr;
+        }
+    }
+}
+
+
+static int is_power_of_two(int n)
+{
+    return (n > 1 && (n & (n - 1)) == 0);
+}
+
+
+void fftfit_cprof(float *y, int nmax, float *amp, float *pha)
+/* Compute the FFT of the profile 'y' of length 'nmax' (a power-of-   */
+/* two) and return the amplitudes and phases of harmonics 1 to nh     */
+/* (where nh = nmax/2) in 'amp' and 'pha' (which must have room for   */
+/* nh values).  amp[0] is the fundamental.                            */
+{
+    int ii, nh = nmax / 2;
+    fcomplex *c;
+
+    if (!is_power_of_two(nmax)) {
+        presto_error(PRESTO_ERR_VALUE,
+                     "fftfit_cprof():  length (%d) is not a power-of-two", nmax);
+    }
+    c = (fcomplex *) malloc(sizeof(fcomplex) * nmax);
+    if (c == NULL)
+        presto_error(PRESTO_ERR_NOMEM,
+                     "fftfit_cprof():  Unable to allocate the FFT array (%d points)",
+                     nmax);
+    for (ii = 0; ii < nmax; ii++) {
+        c[ii].r = y[ii];
+        c[ii].i = 0.0;
+    }
+    ffft(c, nmax, 1);
+    /* Taylor's doubled-up real transform returns twice the DFT */
+    for (ii = 1; ii <= nh; ii++) {
+        amp[ii - 1] = 2.0 * sqrt(c[ii].r * c[ii].r + c[ii].i * c[ii].i);
+        pha[ii - 1] = (amp[ii - 1] > 0.0) ? atan2(c[ii].i, c[ii].r) : 0.0;
+    }
+    free(c);
+}
+
+
+static float fccf(float *amp, float *pha, int nh)
+/* Calculate the CCF in the Fourier domain using the first 16        */
+/* harmonics of amp (=p*s) and pha (=theta-phi).  Find the maximum   */
+/* of the CCF at 64 lags over the pulse period and return the shift  */
+/* in radians.                                                       */
+{
+    int ii, imax = 0, ia, ic, nuse;
+    fcomplex ccf[FFTFIT_NPROF];
+    double cmax, fa, fb, fc, shift;
+
+    nuse = (nh < FFTFIT_NPROF / 4) ? nh : FFTFIT_NPROF / 4;
+    for (ii = 0; ii < FFTFIT_NPROF; ii++)
+        ccf[ii].r = ccf[ii].i = 0.0;
+    for (ii = 1; ii <= nuse; ii++) {
+        ccf[ii].r = amp[ii - 1] * cos(pha[ii - 1]);
+        ccf[ii].i = amp[ii - 1] * sin(pha[ii - 1]);
+        ccf[FFTFIT_NPROF - ii].r = ccf[ii].r;
+        ccf[FFTFIT_NPROF - ii].i = -ccf[ii].i;
+    }
+    ffft(ccf, FFTFIT_NPROF, -1);
+    cmax = -1.e30;
+    for (ii = 0; ii < FFTFIT_NPROF; ii++) {
+        if (ccf[ii].r > cmax) {
+            cmax = ccf[ii].r;
+            imax = ii;
+        }
+    }
+    fb = cmax;
+    ia = (imax == 0) ? FFTFIT_NPROF - 1 : imax - 1;
+    ic = (imax == FFTFIT_NPROF - 1) ? 0 : imax + 1;
+    fa = ccf[ia].r;
+    fc = ccf[ic].r;
+    if ((2.0 * fb - fc - fa) != 0.0)
+        shift = imax + 0.5 * (fa - fc) / (2.0 * fb - fc - fa);
+    else
+        shift = imax;
+    if (shift > FFTFIT_NPROF / 2)
+        shift -= FFTFIT_NPROF;
+    return (float) (shift * TWOPI / FFTFIT_NPROF);
+}
+
+
+static float dchisqr(float tau, float *tmp, float *r, int nsum)
+/* The derivative of chi-squared with respect to tau */
+{
+    int k;
+    float s = 0.0;
+
+    for (k = 1; k <= nsum; k++)
+        s += k * tmp[k - 1] * sinf(-r[k - 1] + k * tau);
+    return s;
+}
+
+
+static float zbrent(float x1, float x2, float f1, float f2, float tol,
+                    float *tmp, float *pha, int nsum)
+/* Brent's method root finding of dchisqr() */
+{
+    int iter;
+    float a = x1, b = x2, c = x2, d = 0.0, e = 0.0;
+    float fa = f1, fb = f2, fc = f2;
+    float p, q, r, s, tol1, xm;
+
+    for (iter = 0; iter < FFTFIT_ITMAX; iter++) {
+        if (fb * fc > 0.0) {
+            c = a;
+            fc = fa;
+            d = b - a;
+            e = d;
+        }
+        if (fabsf(fc) < fabsf(fb)) {
+            a = b;
+            b = c;
+            c = a;
+            fa = fb;
+            fb = fc;
+            fc = fa;
+        }
+        tol1 = 2.0 * FFTFIT_EPS * fabsf(b) + 0.5 * tol;
+        xm = 0.5 * (c - b);
+        if (fabsf(xm) <= tol1 || fb == 0.0)
+            return b;
+        if (fabsf(e) >= tol1 && fabsf(fa) > fabsf(fb)) {
+            s = fb / fa;
+            if (a == c) {
+                p = 2.0 * xm * s;
+                q = 1.0 - s;
+            } else {
+                q = fa / fc;
+                r = fb / fc;
+                p = s * (2.0 * xm * q * (q - r) - (b - a) * (r - 1.0));
+                q = (q - 1.0) * (r - 1.0) * (s - 1.0);
+            }
+            if (p > 0.0)
+                q = -q;
+            p = fabsf(p);
+            if (2.0 * p < fminf(3.0 * xm * q - fabsf(tol1 * q), fabsf(e * q))) {
+                e = d;
+                d = p / q;
+            } else {
+                d = xm;
+                e = d;
+            }
+        } else {
+            d = xm;
+            e = d;
+        }
+        a = b;
+        fa = fb;
+        if (fabsf(d) > tol1)
+            b += d;
+        else
+            b += (xm >= 0.0) ? fabsf(tol1) : -fabsf(tol1);
+        fb = dchisqr(b, tmp, pha, nsum);
+    }
+    return b;
+}
+
+
+void fftfit_harmonics(float *p, float *theta, float *s, float *phi,
+                      int nmax, fftfitresult * result)
+/* The core of FFTFIT.  Fit the harmonic amplitudes 'p' and phases  */
+/* 'theta' of a profile of length 'nmax' (i.e. as returned by       */
+/* fftfit_cprof()) to those of a template ('s' and 'phi').  This    */
+/* allows profiles that have been combined (or rotated) directly in */
+/* the Fourier domain to be fit without an additional FFT.          */
+{
+    int ii, k, nh = nmax / 2, ngood, nsum, nsum0, ntries, low, high;
+    float *tmp, *r, sum, ave, fac, shift, tau, dtau, edtau, ftau;
+    float a = 0.0, b = 0.0, fa = 0.0, fb = 0.0;
+    double s1, s2, s3, cosfac, sq, rms, bb, errtau;
+
+    /* Determine how many of the template harmonics are significant */
+    sum = 0.0;
+    for (ii = nh / 2 + 1; ii <= nh; ii++)
+        sum += s[ii - 1];
+    ave = 2.0 * sum / nh;
+    for (ii = 1; ii <= nh; ii++)
+        if (s[ii - 1] < ave)
+            break;
+    ngood = ii - 1;
+    result->ngood = ngood;
+
+    tmp = gen_fvect(nh);
+    r = gen_fvect(nh);
+    for (k = 0; k < nh; k++) {
+        tmp[k] = p[k] * s[k];
+        r[k] = theta[k] - phi[k];
+    }
+    fac = nmax / TWOPI;
+    shift = fccf(tmp, r, nh);
+
+    /* Solve the transcendental equation for the best-fit tau */
+    tau = shift;
+    nsum0 = (16 < ngood / 4) ? 16 : ngood / 4;
+    if (nsum0 < 1)
+        nsum0 = 1;
+    for (nsum = nsum0; nsum <= ngood; nsum++) {
+        dtau = 0.2 / nsum;
+        edtau = 0.01 / nsum;
+        if (nsum > (nh / 2.0 + 0.5))
+            edtau = 1.e-4;
+        ntries = 0;
+        low = high = 0;
+        do {
+            ftau = dchisqr(tau, tmp, r, nsum);
+            ntries++;
+            if (ftau < 0.0) {
+                a = tau;
+                fa = ftau;
+                tau += dtau;
+                low = 1;
+            } else {
+                b = tau;
+                fb = ftau;
+                tau -= dtau;
+                high = 1;
+            }
+            if (ntries > 100) {
+                /* These are the standard FFTFIT "error" flags */
+                result->shift = 0.0;
+                result->eshift = 999.0;
+                result->snr = 0.0;
+                result->esnr = 0.0;
+                result->b = 0.0;
+                result->errb = 0.0;
+                vect_free(tmp);
+                vect_free(r);
+                return;
+            }
+        } while (low != high);
+        tau = zbrent(a, b, fa, fb, edtau, tmp, r, nsum);
+    }
+
+    s1 = s2 = s3 = 0.0;
+    for (k = 1; k <= ngood; k++) {
+        cosfac = cos(-r[k - 1] + k * tau);
+        s1 += tmp[k - 1] * cosfac;
+        s2 += s[k - 1] * s[k - 1];
+        s3 += k * k * tmp[k - 1] * cosfac;
+    }
+    bb = s1 / s2;
+    s1 = 0.0;
+    for (k = 1; k <= ngood; k++) {
+        sq = p[k - 1] * p[k - 1] -
+            2.0 * bb * p[k - 1] * s[k - 1] * cos(r[k - 1] - k * tau) +
+            (bb * s[k - 1]) * (bb * s[k - 1]);
+        s1 += sq;
+    }
+    rms = sqrt(s1 / ngood);
+    result->b = bb;
+    result->errb = rms / sqrt(2.0 * s2);
+    errtau = (s3 > 0.0) ? rms / sqrt(2.0 * bb * s3) : 0.0;
+    result->snr = 2.0 * sqrt(2.0 * nh) * bb / rms;
+    result->shift = fac * tau;
+    result->eshift = fac * errtau;
+    result->esnr = result->snr * result->errb / bb;
+    vect_free(tmp);
+    vect_free(r);
+}
+
+
+void fftfit(float *prof, float *s, float *phi, int nmax, fftfitresult * result)
+/* Determine the shift (in bins) required to align the template     */
+/* (described by its harmonic amplitudes 's' and phases 'phi' as    */
+/* returned by fftfit_cprof()) with the profile 'prof' of length    */
+/* 'nmax' (a power-of-two).  The shift, the signal-to-noise, the    */
+/* template scaling 'b' and their errors are returned in 'result'.  */
+/* A failed fit returns shift = 0.0 and eshift = 999.0.             */
+{
+    int nh = nmax / 2;
+    float *p, *theta;
+
+    p = gen_fvect(nh);
+    theta = gen_fvect(nh);
+    fftfit_cprof(prof, nmax, p, theta);
+    fftfit_harmonics(p, theta, s, phi, nmax, result);
+    vect_free(p);
+    vect_free(theta);
+}
+
+
+static void dft_rotate(double *data, long numbins, double bins_to_left)
+/* fft_rotate() for lengths that are not a power-of-two.  This is a  */
+/* direct (i.e. O(N^2)) real DFT done in double precision, which is  */
+/* plenty fast for the profile lengths that need it.                 */
+{
+    long ii, jj, nh = numbins / 2;
+    double phs, cp, sp, tr, wt, *costab, *sintab;
+    dcomplex *c;
+
+    c = (dcomplex *) malloc(sizeof(dcomplex) * (nh + 1));
+    costab = (double *) malloc(sizeof(double) * numbins);
+    sintab = (double *) malloc(sizeof(double) * numbins);
+    if (c == NULL || costab == NULL || sintab == NULL)
+        presto_error(PRESTO_ERR_NOMEM,
+                     "fft_rotate():  Unable to allocate the DFT arrays (%ld points)",
+                     numbins);
+    for (ii = 0; ii < numbins; ii++) {
+        costab[ii] = cos(TWOPI * ii / numbins);
+        sintab[ii] = sin(TWOPI * ii / numbins);
+    }
+    /* Forward transform with the numpy (i.e. exp(-i...)) convention */
+    for (ii = 0; ii <= nh; ii++) {
+        c[ii].r = c[ii].i = 0.0;
+        for (jj = 0; jj < numbins; jj++) {
+            c[ii].r += data[jj] * costab[(ii * jj) % numbins];
+            c[ii].i -= data[jj] * sintab[(ii * jj) % numbins];
+        }
+    }
+    for (ii = 1; ii <= nh; ii++) {
+        phs = TWOPI * ii * bins_to_left / numbins;
+        cp = cos(phs);
+        sp = sin(phs);
+        tr = c[ii].r * cp - c[ii].i * sp;
+        c[ii].i = c[ii].r * sp + c[ii].i * cp;
+        c[ii].r = tr;
+    }
+    /* irfft() only uses the real part of the Nyquist term, */
+    /* which (unlike the other harmonics) is counted once   */
+    if (!(numbins & 1))
+        c[nh].i = 0.0;
+    for (jj = 0; jj < numbins; jj++) {
+        tr = c[0].r;
+        for (ii = 1; ii <= nh; ii++) {
+            wt = (!(numbins & 1) && ii == nh) ? 1.0 : 2.0;
+            tr += wt * (c[ii].r * costab[(ii * jj) % numbins] -
+                        c[ii].i * sintab[(ii * jj) % numbins]);
+        }
+        data[jj] = tr / numbins;
+    }
+    free(c);
+    free(costab);
+    free(sintab);
+}
+
+
+void fft_rotate(double *data, long numbins, double bins_to_left)
+/* Rotate the vector 'data' of length 'numbins' by 'bins_to_left' */
+/* (which can be fractional) places to the left using the Fourier */
+/* shift theorem.  This is identical to psr_utils.fft_rotate() in */
+/* the python package.  Power-of-two lengths use an FFT and other  */
+/* lengths a direct DFT, both in double precision.                  */
+{
+    long ii, nh = numbins / 2;
+    double phs, cp, sp, tr;
+    dcomplex *c;
+
+    if (numbins < 2)
+        return;
+    if (!is_power_of_two((int) numbins)) {
+        dft_rotate(data, numbins, bins_to_left);
+        return;
+    }
+    c = (dcomplex *) malloc(sizeof(dcomplex) * numbins);
+    if (c == NULL)
+        presto_error(PRESTO_ERR_NOMEM,
+                     "fft_rotate():  Unable to allocate the FFT array (%ld points)",
+                     numbins);
+    for (ii = 0; ii < numbins; ii++) {
+        c[ii].r = data[ii];
+        c[ii].i = 0.0;
+    }
+    /* Note:  isign = -1 is the numpy (i.e. exp(-i...)) convention */
+    dffft(c, numbins, -1);
+    for (ii = 1; ii <= nh; ii++) {
+        phs = TWOPI * ii * bins_to_left / numbins;
+        cp = cos(phs);
+        sp = sin(phs);
+        tr = c[ii].r * cp - c[ii].i * sp;
+        c[ii].i = c[ii].r * sp + c[ii].i * cp;
+        c[ii].r = tr;
+    }
+    /* irfft() only uses the real part of the Nyquist term */
+    c[nh].i = 0.0;
+    for (ii = 1; ii < nh; ii++) {
+        c[numbins - ii].r = c[ii].r;
+        c[numbins - ii].i = -c[ii].i;
+    }
+    dffft(c, numbins, 1);
+    for (ii = 0; ii < numbins; ii++)
+        data[ii] = c[ii].r / numbins;
+    free(c);
+}
@@ -6,8 +6,9 @@
 #define WORKLEN 16384
 
 /* Some macros to make the flag checking easier */
-#define DELAYS (flags % 2 == 1)
-#define ONOFF (flags > 1)
+#define DELAYS (flags & 1)
+#define ONOFF (flags & 2)
+#define GRIDDELAYS (flags & 4)
 
 /* Simple linear interpolation macro */
 #define LININTERP(X, xlo, xhi, ylo, yhi) \
@@ -294,6 +295,9 @@ double foldfile(FILE * datafile, double dt, double tlo,
 /*            1 = Use *delays but no *onoffpairs                      */
 /*            2 = No *delays but use *onoffpairs                      */
 /*            3 = Use *delays and use *onoffpairs                     */
+/*            Adding 4 means that the delays are tabulated at evenly  */
+/*            spaced times (i.e. from get_bindelays()) and will be    */
+/*            cubic-interpolated without searching 'delaytimes'.      */
 /*    'delays' is an array of time delays.                            */
 /*    'delaytimes' are the times where 'delays' were calculated.      */
 /*    'numdelays' is how many points are in 'delays' and 'delaytimes' */
@@ -320,10 +324,7 @@ double foldfile(FILE * datafile, double dt, double tlo,
     if (ONOFF)
         onoffptr = onoffpairs;
     stats->numdata = stats->data_avg = stats->data_var = 0.0;
-    if (DELAYS)
-        ourflags = 1;
-    else
-        ourflags = 0;
+    ourflags = flags & 5;       /* Just the delay flags */
 
     /* Create and initialize the buffer needed by fold() */
 
@@ -475,6 +476,9 @@ double fold(float *data, int numdata, double dt, double tlo,
 /*            1 = Use *delays but no *onoffpairs                      */
 /*            2 = No *delays but use *onoffpairs                      */
 /*            3 = Use *delays and use *onoffpairs                     */
+/*            Adding 4 means that the delays are tabulated at evenly  */
+/*            spaced times (i.e. from get_bindelays()) and will be    */
+/*            cubic-interpolated without searching 'delaytimes'.      */
 /*    'delays' is an array of time delays.                            */
 /*    'delaytimes' are the times where 'delays' were calculated.      */
 /*    'numdelays' is how many points are in 'delays' and 'delaytimes' */
@@ -499,7 +503,7 @@ double fold(float *data, int numdata, double dt, double tlo,
     long double phase, phasenext = 0.0, deltaphase, T, Tnext, TD, TDnext;
     long double profbinwidth, lophase, hiphase;
     double dev, delaytlo = 0.0, delaythi = 0.0, delaylo = 0.0, delayhi = 0.0;
-    double *delayptr = NULL, *delaytimeptr = NULL, dtmp;
+    double *delayptr = NULL, *delaytimeptr = NULL, dtmp, griddtinv = 0.0;
 
     /* Initialize some variables and save some FLOPs later... */
 
@@ -510,6 +514,8 @@ double fold(float *data, int numdata, double dt, double tlo,
         onoffptr = onoffpairs;
     stats->numprof = (double) numprof;
     stats->data_var *= (stats->numdata - 1.0);
+    if (DELAYS && GRIDDELAYS)
+        griddtinv = 1.0 / (delaytimes[1] - delaytimes[0]);
 
     do {                        /* Loop over the on-off pairs */
 
@@ -531,7 +537,10 @@ double fold(float *data, int numdata, double dt, double tlo,
 
         /* Set the delay pointers and variables */
 
-        if (DELAYS) {
+        if (DELAYS && GRIDDELAYS) {
+            TD -= cubic_interp_grid(delays, numdelays,
+                                    (TD - delaytimes[0]) * griddtinv);
+        } else if (DELAYS) {
 
             /* Guess that the next delay we want is the next available */
 
@@ -566,7 +575,10 @@ double fold(float *data, int numdata, double dt, double tlo,
 
             /* Set the delay pointers and variables */
 
-            if (DELAYS) {
+            if (DELAYS && GRIDDELAYS) {
+                TDnext -= cubic_interp_grid(delays, numdelays,
+                                            (Tnext - delaytimes[0]) * griddtinv);
+            } else if (DELAYS) {
                 if (Tnext > delaythi) {
 
                     /* Guess that the next delay we want is the next available */
@@ -649,6 +661,7 @@ double fold(float *data, int numdata, double dt, double tlo,
 #undef WORKLEN
 #undef DELAYS
 #undef ONOFF
+#undef GRIDDELAYS
 #undef LININTERP
 #undef TEST_ONE
 
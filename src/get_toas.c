@@ -0,0 +1,802 @@
+#include "prepfold.h"
+#include "get_toas_cmd.h"
+#include "float.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#ifdef USEDMALLOC
+#include "dmalloc.h"
+#endif
+
+/*
+ * A compiled version of bin/get_TOAs.py.  The TOAs (and the
+ * warnings) that it writes are the same as those from the python
+ * program, but many .pfd files can be processed in a single call and
+ * the de-dispersion and the FFTFIT template matching of all of the
+ * profiles in a fold are done in parallel.
+ */
+
+#define TEST_EQUAL(a, b) (fabs(a) == 0.0 ? \
+(fabs((a)-(b)) <= 2 * DBL_EPSILON ? 1 : 0) : \
+(fabs((a)-(b))/fabs((a)) <= 2 * DBL_EPSILON ? 1 : 0))
+
+/* Zoom factor used for the time-domain correlations */
+#define CORRZOOM 10
+
+/* Status codes for the individual TOAs */
+#define TOA_OK      0
+#define TOA_NOSIG   1
+#define TOA_BADLEN  2
+#define TOA_BADFIT  3
+
+extern int *ranges_to_ivect(char *str, int minval, int maxval, int *numvals);
+extern int getpoly(double mjd, double duration, double *dm, FILE * fp, char *pname);
+extern int phcalc(double mjd0, double mjd1, int last_index,
+                  double *phase, double *psrfreq);
+
+typedef struct OBSCODE {
+    char *name;
+    char *code;
+} obscode;
+
+/* TEMPO one character observatory codes */
+static obscode scopes[] = {
+    {"GBT", "1"}, {"Arecibo", "3"}, {"Parkes", "7"}, {"GMRT", "r"},
+    {"IRAM", "s"}, {"LWA1", "x"}, {"LWA", "x"}, {"MWA", "u"},
+    {"VLA", "c"}, {"FAST", "k"}, {"MeerKAT", "m"}, {"Geocenter", "o"},
+    {NULL, NULL}
+};
+
+/* Tempo2 observatory codes */
+static obscode scopes2[] = {
+    {"GBT", "gbt"}, {"Parkes", "pks"}, {"GMRT", "gmrt"}, {"LWA1", "lwa1"},
+    {"LWA", "lwa1"}, {"MWA", "mwa"}, {"VLA", "vla"}, {"FAST", "fast"},
+    {"MeerKAT", "mk"}, {"Geocenter", "coe"}, {"Gemini-S", "gs"},
+    {"CPT", "cpt"}, {"ARO", "aro"}, {"IAR", "iar1"},
+    {NULL, NULL}
+};
+
+typedef struct TOARESULT {
+    double tau;                 /* Pulse phase of the TOA              */
+    double tau_err;             /* Error in the pulse phase            */
+    fftfitresult fit;           /* The full FFTFIT results             */
+    int status;                 /* One of the TOA_* codes              */
+} toaresult;
+
+
+static char *get_obscode(obscode * codes, char *telescope)
+/* Return the observatory code for the first word of 'telescope' */
+{
+    int ii, len;
+
+    len = strcspn(telescope, " \t");
+    for (ii = 0; codes[ii].name != NULL; ii++)
+        if (strlen(codes[ii].name) == len &&
+            strncmp(codes[ii].name, telescope, len) == 0)
+            return codes[ii].code;
+    return NULL;
+}
+
+
+static void get_epochs(double epoch, double *epochi, double *epochf)
+/* Split an MJD epoch into integer and fractional parts exactly the  */
+/* way that the python bestprof class does (i.e. from the string     */
+/* written to the .bestprof file).  If the epoch is very close to an */
+/* integer second, it is assumed to be exactly on the second.        */
+{
+    char str[80], fstr[80], *dot;
+    double fsec;
+
+    sprintf(str, "%-.12f", epoch);
+    dot = strchr(str, '.');
+    *dot = '\0';
+    *epochi = strtod(str, NULL);
+    sprintf(fstr, "0.%s", dot + 1);
+    *epochf = strtod(fstr, NULL);
+    fsec = *epochf * SECPERDAY + 1e-10;
+    if (fabs(fsec - (int) fsec) < 1e-6)
+        *epochf = (int) fsec / SECPERDAY;
+}
+
+
+static int use_for_timing(prepfoldinfo * search, double T)
+/* Return 1 if the fold was made without searching (i.e. can be */
+/* used for timing), otherwise return 0.  This is the same as   */
+/* pfd.use_for_timing() in the python package.                  */
+{
+    double bestp, bestpd, bestpdd, foldp, foldpd, bestf, bestfd, bestfdd;
+    double bin_dphi, dphis[3];
+
+    if (search->fold.pow == 1.0) {
+        bestp = search->bary.p1;
+        bestpd = search->bary.p2;
+        bestpdd = search->bary.p3;
+    } else if (search->topo.p1 == 0.0) {
+        bestp = search->fold.p1;
+        bestpd = search->fold.p2;
+        bestpdd = search->fold.p3;
+    } else {
+        bestp = search->topo.p1;
+        bestpd = search->topo.p2;
+        bestpdd = search->topo.p3;
+    }
+    /* The fold values are frequencies */
+    foldp = 1.0 / search->fold.p1;
+    foldpd = switch_pfdot(search->fold.p1, search->fold.p2);
+    bestfdd = switch_pfdotdot(foldp, foldpd, bestpdd);
+    bestfd = switch_pfdot(foldp, bestpd);
+    bestf = 1.0 / bestp;
+    bin_dphi = 1.0 / search->proflen;
+    dphis[0] = fabs(bestf - search->fold.p1) * T;
+    dphis[1] = fabs(bestfd - search->fold.p2) * T * T / 2.0;
+    dphis[2] = (bestpdd != 0.0) ?
+        fabs(bestfdd - search->fold.p3) * T * T * T / 6.0 : 0.0;
+    /* Allow up to a 0.5 bin shift for fdd since the conversions */
+    /* back and forth can cause float issues.                     */
+    if (dphis[0] > 0.1 * bin_dphi || dphis[1] > 0.1 * bin_dphi ||
+        dphis[2] > 0.5 * bin_dphi)
+        return 0;
+    return 1;
+}
+
+
+static double *read_profile(char *filenm, int *proflen)
+/* Read a simple ASCII profile with one bin per line (the last  */
+/* column is used so .bestprof files work) and normalize it so  */
+/* that it goes from 0 to 1.  Lines beginning with '#' are      */
+/* ignored.                                                     */
+{
+    FILE *infile;
+    char line[1000], *word, *last;
+    int ii, numalloc = 1024;
+    double *vals, *prof, minval, maxval;
+
+    infile = chkfopen(filenm, "r");
+    vals = (double *) malloc(sizeof(double) * numalloc);
+    *proflen = 0;
+    while (fgets(line, sizeof(line), infile) != NULL) {
+        if (line[0] == '#')
+            continue;
+        last = NULL;
+        word = strtok(line, " \t\n");
+        while (word != NULL) {
+            last = word;
+            word = strtok(NULL, " \t\n");
+        }
+        if (last == NULL)
+            continue;
+        if (*proflen == numalloc) {
+            numalloc *= 2;
+            vals = (double *) realloc(vals, sizeof(double) * numalloc);
+        }
+        vals[(*proflen)++] = strtod(last, NULL);
+    }
+    fclose(infile);
+    if (*proflen == 0) {
+        fprintf(stderr, "\nError:  no profile values in '%s'!\n\n", filenm);
+        exit(1);
+    }
+    prof = gen_dvect(*proflen);
+    memcpy(prof, vals, sizeof(double) * *proflen);
+    free(vals);
+    minval = maxval = prof[0];
+    for (ii = 1; ii < *proflen; ii++) {
+        if (prof[ii] < minval)
+            minval = prof[ii];
+        if (prof[ii] > maxval)
+            maxval = prof[ii];
+    }
+    for (ii = 0; ii < *proflen; ii++)
+        prof[ii] = (prof[ii] - minval) / (maxval - minval);
+    return prof;
+}
+
+
+static double *gaussian_profile(int N, double phase, double fwhm)
+/* Return a gaussian pulse profile with 'N' bins, an integrated */
+/* 'flux' of 1 unit, centered at 'phase' (0-1) and with a full  */
+/* width at half max of 'fwhm' (in phase).                      */
+{
+    int ii;
+    double sigma, mean, phs, zs, *prof;
+
+    prof = gen_dvect(N);
+    sigma = fwhm / 2.35482;
+    mean = fmod(phase, 1.0);
+    if (mean < 0.0)
+        mean += 1.0;
+    for (ii = 0; ii < N; ii++) {
+        phs = (double) ii / N - mean;
+        /* Allow the Gaussian to wrap in phase */
+        if (phs > 0.5)
+            phs -= 1.0;
+        else if (phs < -0.5)
+            phs += 1.0;
+        zs = fabs(phs) / sigma;
+        /* Avoid underflow by truncating the Gaussian at 20 sigma */
+        prof[ii] = (zs < 20.0) ? exp(-0.5 * zs * zs) / (sigma * sqrt(TWOPI)) : 0.0;
+    }
+    return prof;
+}
+
+
+static double *linear_interpolate(double *vector, int n, int zoom)
+/* Linearly interpolate 'vector' of length 'n' by a factor 'zoom' */
+{
+    int ii, jj;
+    double loy, hiy, *ivect;
+
+    ivect = gen_dvect(zoom * n);
+    loy = vector[0];
+    for (ii = 0; ii < n; ii++) {
+        hiy = (ii == n - 1) ? vector[0] : vector[ii + 1];
+        for (jj = 0; jj < zoom; jj++)
+            ivect[ii * zoom + jj] = ((double) jj / zoom) * (hiy - loy) + loy;
+        loy = hiy;
+    }
+    return ivect;
+}
+
+
+static double measure_phase_corr(double *prof, double *template, int n)
+/* Return the phase offset required to get 'prof' to best match */
+/* 'template' (both of length 'n') using a time-domain circular */
+/* correlation after linearly interpolating each by CORRZOOM.   */
+{
+    int ii, jj, maxlag = 0, zn = n * CORRZOOM;
+    double *iprof, *itemp, sum, maxval = -DBL_MAX;
+
+    iprof = linear_interpolate(prof, n, CORRZOOM);
+    itemp = linear_interpolate(template, n, CORRZOOM);
+    for (ii = 0; ii < zn; ii++) {
+        sum = 0.0;
+        for (jj = 0; jj < zn - ii; jj++)
+            sum += itemp[jj + ii] * iprof[jj];
+        for (jj = zn - ii; jj < zn; jj++)
+            sum += itemp[jj + ii - zn] * iprof[jj];
+        if (sum > maxval) {
+            maxval = sum;
+            maxlag = ii;
+        }
+    }
+    vect_free(iprof);
+    vect_free(itemp);
+    return (double) maxlag / zn;
+}
+
+
+static int is_power_of_two(int n)
+{
+    return (n > 1 && (n & (n - 1)) == 0);
+}
+
+
+static void write_toa(Cmdline * cmd, char *pfdnm, char *obs, double toa_MJDi,
+                      double toa_MJDf, double toaerr, double freq, double tau,
+                      double tau_err)
+/* Write a Princeton or Tempo2 format TOA to STDOUT */
+{
+    char toa[40], frac[40];
+
+    /* Splice together the integer and fractional MJDs */
+    sprintf(toa, "%5d", (int) toa_MJDi);
+    sprintf(frac, "%.13f", toa_MJDf);
+    strcat(toa, frac + 1);
+    if (cmd->tempo2P) {
+        char flags[80] = "";
+
+        if (cmd->phaseP) {
+            double phs = fmod(tau, 1.0);
+            if (phs < 0.0)
+                phs += 1.0;
+            sprintf(flags, "-ffphs %.4f -fferr %.4f", phs, tau_err);
+        }
+        printf("%s %f %s %.2f %s %s\n", pfdnm, freq, toa, toaerr, obs, flags);
+    } else {
+        printf("%s %13s %8.3f %s %8.2f\n", obs, "", freq, toa, toaerr);
+    }
+}
+
+
+static void get_toas(char *pfdnm, Cmdline * cmd)
+/* Generate the TOAs for the .pfd file 'pfdnm' */
+{
+    prepfoldinfo search;
+    int ii, jj, kk, topo, psr, tlen, numtoas, numsub, proflen, compatible = 1;
+    double N = 0.0, T, dt, dm, epoch, epochi, epochf, timestep_day;
+    double binspersec, p_dedisp, subdeltafreq, hifreq, *profs, *template;
+    double *sumsubfreqs, *sumsubdelays_phs, *subdelays2, *pp, *tp, *t0is, *t0fs;
+    float *s, *phi;
+    char *obs, tmpstr[80];
+    toaresult *results;
+
+    read_prepfoldinfo(&search, pfdnm);
+    numtoas = cmd->numtoas;
+    numsub = cmd->numsub;
+    proflen = search.proflen;
+
+    /* The number of points folded and the duration of the fold */
+    for (ii = 0; ii < search.npart; ii++)
+        N += search.stats[ii * search.nsub].numdata;
+    if (!use_for_timing(&search, N * search.dt)) {
+        fprintf(stderr, "Error: '%s' was made allowing prepfold to search!\n",
+                pfdnm);
+        delete_prepfoldinfo(&search);
+        return;
+    }
+    /* The python code uses the (rounded) values from the .bestprof */
+    sprintf(tmpstr, "%.6g", search.dt);
+    dt = strtod(tmpstr, NULL);
+    T = dt * N;
+    timestep_day = T / numtoas / SECPERDAY;
+
+    if (TEST_EQUAL(search.tepoch, 0.0) || TEST_EQUAL(search.tepoch, -1)) {
+        topo = 0;
+        epoch = search.bepoch;
+    } else {
+        topo = 1;
+        epoch = search.tepoch;
+    }
+    if (epoch == 0.0) {
+        fprintf(stderr, "Error: '%s' does not have a valid epoch!\n", pfdnm);
+        delete_prepfoldinfo(&search);
+        return;
+    }
+    get_epochs(epoch, &epochi, &epochf);
+
+    /* If the requested number of TOAs doesn't divide into the */
+    /* number of time intervals, then skip the file            */
+    if (search.npart % numtoas) {
+        fprintf(stderr,
+                "Error: # of TOAs (%d) doesn't divide # of time intervals (%d)!\n",
+                numtoas, search.npart);
+        delete_prepfoldinfo(&search);
+        return;
+    }
+    if (search.nsub % numsub) {
+        fprintf(stderr,
+                "Error: # of subbands (%d) doesn't divide # of subbands folded (%d)!\n",
+                numsub, search.nsub);
+        delete_prepfoldinfo(&search);
+        return;
+    }
+
+    /* Get the DM and number of channels from the .inf file */
+    /* for folds of de-dispersed time series                */
+    if (search.numchan == 1) {
+        char *infroot, *suffix;
+        FILE *testfile;
+
+        infroot = (char *) calloc(strlen(search.filenm) + 5, sizeof(char));
+        strcpy(infroot, search.filenm);
+        if ((suffix = strrchr(infroot, '.')) != NULL)
+            *suffix = '\0';
+        strcat(infroot, ".inf");
+        if ((testfile = fopen(infroot, "r")) != NULL) {
+            infodata idata;
+
+            fclose(testfile);
+            infroot[strlen(infroot) - 4] = '\0';
+            readinf(&idata, infroot);
+            if (strcmp(idata.band, "Radio") == 0) {
+                search.bestdm = idata.dm;
+                search.numchan = idata.num_chan;
+            }
+        } else {
+            fprintf(stderr, "Warning!  Can't open the .inf file for %s!\n", pfdnm);
+        }
+        free(infroot);
+    }
+
+    /* Over-ride the DM that was used during the fold */
+    dm = (cmd->eventsP) ? 0.0 : cmd->dm;
+    if (dm != 0.0) {
+        if (search.nsub == 1)
+            fprintf(stderr, "Warning: Do not set DM when using .pfds "
+                    "from de-dispersed time series!\n");
+        else
+            search.bestdm = dm;
+    }
+    if (search.numchan == 1 && dm == 0.0 && cmd->eventsP)
+        search.bestdm = 0.0;
+
+    /* Kill any required subbands and/or intervals */
+    if (cmd->killsubsstrP) {
+        int *killsubs, numkillsubs = 0;
+
+        killsubs = ranges_to_ivect(cmd->killsubsstr, 0,
+                                   search.nsub - 1, &numkillsubs);
+        for (ii = 0; ii < numkillsubs; ii++) {
+            if ((killsubs[ii] >= 0) && (killsubs[ii] < search.nsub)) {
+                for (jj = 0; jj < search.npart; jj++) {
+                    pp = search.rawfolds +
+                        (jj * search.nsub + killsubs[ii]) * proflen;
+                    for (kk = 0; kk < proflen; kk++)
+                        pp[kk] = 0.0;
+                }
+            }
+        }
+        free(killsubs);
+    }
+    if (cmd->killpartsstrP) {
+        int *killparts, numkillparts = 0;
+
+        killparts = ranges_to_ivect(cmd->killpartsstr, 0,
+                                    search.npart - 1, &numkillparts);
+        for (ii = 0; ii < numkillparts; ii++) {
+            if ((killparts[ii] >= 0) && (killparts[ii] < search.npart)) {
+                pp = search.rawfolds + killparts[ii] * search.nsub * proflen;
+                for (kk = 0; kk < search.nsub * proflen; kk++)
+                    pp[kk] = 0.0;
+            }
+        }
+        free(killparts);
+    }
+
+    /* The subband frequencies and the pulse period used for dedispersion */
+    binspersec = search.fold.p1 * proflen;
+    p_dedisp = proflen / binspersec;
+    subdeltafreq = search.chan_wid * (search.numchan / search.nsub);
+    hifreq = search.lofreq + (search.numchan - 1) * search.chan_wid;
+
+    /* De-disperse at the requested DM using FFT-based rotations */
+    if (search.nsub > 1) {
+        double losubfreq, hisubdelay, *delaybins;
+
+        losubfreq = search.lofreq + subdeltafreq - search.chan_wid;
+        delaybins = gen_dvect(search.nsub);
+        hisubdelay = delay_from_dm(search.bestdm,
+                                   (search.nsub - 1) * subdeltafreq + losubfreq);
+        for (jj = 0; jj < search.nsub; jj++)
+            delaybins[jj] = (delay_from_dm(search.bestdm,
+                                           jj * subdeltafreq + losubfreq) -
+                             hisubdelay) * binspersec;
+#ifdef _OPENMP
+#pragma omp parallel for default(none) private(jj) shared(search,delaybins,proflen)
+#endif
+        for (ii = 0; ii < search.npart * search.nsub; ii++) {
+            jj = ii % search.nsub;
+            fft_rotate(search.rawfolds + ii * proflen, proflen, delaybins[jj]);
+        }
+        vect_free(delaybins);
+    }
+
+    /* Combine the profiles as required */
+    profs = gen_dvect(numtoas * numsub * proflen);
+    for (ii = 0; ii < numtoas * numsub * proflen; ii++)
+        profs[ii] = 0.0;
+    {
+        int dp = search.npart / numtoas, ds = search.nsub / numsub;
+
+        for (ii = 0; ii < search.npart; ii++) {
+            for (jj = 0; jj < search.nsub; jj++) {
+                pp = search.rawfolds + (ii * search.nsub + jj) * proflen;
+                tp = profs + ((ii / dp) * numsub + jj / ds) * proflen;
+                for (kk = 0; kk < proflen; kk++)
+                    tp[kk] += pp[kk];
+            }
+        }
+    }
+
+    /* PRESTO de-disperses at the high frequency channel so determine */
+    /* a correction to the middle of the band                         */
+    sumsubfreqs = gen_dvect(numsub);
+    sumsubdelays_phs = gen_dvect(numsub);
+    subdelays2 = gen_dvect(numsub);
+    for (jj = 0; jj < numsub; jj++) {
+        if (cmd->eventsP) {
+            sumsubfreqs[jj] = sumsubdelays_phs[jj] = subdelays2[jj] = 0.0;
+        } else {
+            double subpersumsub = (double) search.nsub / numsub;
+
+            sumsubfreqs[jj] = (jj + 0.5) * subpersumsub * subdeltafreq +
+                (search.lofreq - 0.5 * search.chan_wid);
+            /* Note:  This uses the topocentric high frequency */
+            sumsubdelays_phs[jj] =
+                fmod((delay_from_dm(search.bestdm, sumsubfreqs[jj]) -
+                      delay_from_dm(search.bestdm, hifreq)) / p_dedisp, 1.0);
+            /* The "highest channel within a subband" delays for use */
+            /* in the later DM/timing correction                     */
+            subdelays2[jj] = delay_from_dm(search.bestdm, sumsubfreqs[jj]) -
+                delay_from_dm(search.bestdm, sumsubfreqs[jj] +
+                              subdeltafreq / 2.0 - search.chan_wid / 2.0);
+        }
+    }
+
+    /* Read or generate the template profile */
+    if (cmd->templateP) {
+        template = read_profile(cmd->template, &tlen);
+    } else {
+        double maxval = -DBL_MAX;
+
+        tlen = proflen;
+        template = gaussian_profile(tlen, 0.0, cmd->gaussian);
+        for (ii = 0; ii < tlen; ii++)
+            if (template[ii] > maxval)
+                maxval = template[ii];
+        for (ii = 0; ii < tlen; ii++)
+            template[ii] /= maxval;
+    }
+
+    /* Rotate the template so that its maximum value is in bin 0 */
+    if (cmd->centerP) {
+        int maxbin = 0;
+        double *tmpprof = gen_dvect(tlen);
+
+        for (ii = 1; ii < tlen; ii++)
+            if (template[ii] > template[maxbin])
+                maxbin = ii;
+        for (ii = 0; ii < tlen; ii++)
+            tmpprof[ii] = template[(ii + maxbin) % tlen];
+        vect_free(template);
+        template = tmpprof;
+    }
+
+    /* Make sure that the template and the data have the same number of bins */
+    if (tlen != proflen) {
+        if (!((tlen % proflen) == 0 || (proflen % tlen) == 0)) {
+            fprintf(stderr,
+                    "WARNING!: Lengths of template (%d) and data (%d) are incompatible!  Skipping '%s'!\n",
+                    tlen, proflen, search.filenm);
+            compatible = 0;
+        } else if (tlen > proflen) {
+            fprintf(stderr, "Note: Interpolating the data for '%s'\n",
+                    search.filenm);
+        } else {
+            double *tmpprof = linear_interpolate(template, tlen, proflen / tlen);
+
+            vect_free(template);
+            template = tmpprof;
+            tlen = proflen;
+            fprintf(stderr, "Note: Interpolating the template for '%s'\n",
+                    search.filenm);
+        }
+    }
+
+    /* Determine the Telescope used */
+    if (!topo) {
+        obs = "@";              /* Solar System Barycenter */
+    } else {
+        obs = get_obscode(cmd->tempo2P ? scopes2 : scopes, search.telescope);
+        if (obs == NULL) {
+            fprintf(stderr, "Unknown telescope!!! : %s  Skipping '%s'!\n",
+                    search.telescope, pfdnm);
+            compatible = 0;
+        }
+    }
+
+    /* The harmonics of the template for FFTFIT */
+    s = gen_fvect(tlen / 2);
+    phi = gen_fvect(tlen / 2);
+    if (compatible && is_power_of_two(tlen)) {
+        float *ftemp = gen_fvect(tlen);
+
+        for (ii = 0; ii < tlen; ii++)
+            ftemp[ii] = template[ii];
+        fftfit_cprof(ftemp, tlen, s, phi);
+        if (!(cmd->norotateP || cmd->centerP)) {
+            double pha1 = phi[0];
+
+            for (ii = 0; ii < tlen / 2; ii++)
+                phi[ii] = fmod(phi[ii] - (ii + 1) * pha1, TWOPI);
+        }
+        vect_free(ftemp);
+    }
+
+    /* The spin period and reference times for each TOA */
+    psr = (strncmp(search.candnm, "PSR_", 4) == 0);
+    pp = gen_dvect(numtoas);
+    t0is = gen_dvect(numtoas);
+    t0fs = gen_dvect(numtoas);
+    if (compatible && psr && topo) {
+        char *polycofilenm, *psrname;
+        FILE *polycofile;
+        double polyco_dm, phs0, phs, f0, mjdf;
+
+        polycofilenm = (char *) calloc(strlen(pfdnm) + 9, sizeof(char));
+        sprintf(polycofilenm, "%s.polycos", pfdnm);
+        psrname = (char *) calloc(strlen(search.candnm), sizeof(char));
+        strcpy(psrname, search.candnm + 4);
+        psrname[strcspn(psrname, "_")] = '\0';
+        polycofile = chkfopen(polycofilenm, "r");
+        getpoly(epochi + epochf, T / SECPERDAY, &polyco_dm, polycofile, psrname);
+        fclose(polycofile);
+        phcalc(epochi, epochf, 0, &phs0, &f0);
+        for (ii = 0; ii < numtoas; ii++) {
+            mjdf = epochf + (ii + 0.5) * timestep_day;
+            phcalc(epochi, mjdf, 0, &phs, &f0);
+            phs -= phs0;
+            pp[ii] = 1.0 / f0;
+            if (phs < 0.0)
+                phs += 1.0;     /* Consistent with pat */
+            t0fs[ii] = mjdf - phs * pp[ii] / SECPERDAY;
+            t0is[ii] = epochi;
+        }
+        free(polycofilenm);
+        free(psrname);
+    } else if (compatible) {
+        double f0, f1, f2, t, phs, midtime, t0;
+
+        f0 = search.fold.p1;
+        f1 = search.fold.p2;
+        f2 = search.fold.p3;
+        epoch = epochi + epochf;
+        for (ii = 0; ii < numtoas; ii++) {
+            /* Time at the middle of the interval in question */
+            midtime = epoch + (ii + 0.5) * timestep_day;
+            t = (midtime - epoch) * SECPERDAY;
+            pp[ii] = 1.0 / (f0 + t * (f1 + t * f2 / 2.0));
+            phs = fmod(t * (f0 + t * (f1 / 2.0 + t * f2 / 6.0)), 1.0);
+            t0 = midtime - phs * pp[ii] / SECPERDAY;
+            t0is[ii] = (int) (t0 + 1e-9);
+            t0fs[ii] = t0 - t0is[ii];
+        }
+    }
+
+    /* Measure the phases of all of the profiles in parallel */
+    results = (toaresult *) malloc(sizeof(toaresult) * numtoas * numsub);
+    if (compatible) {
+#ifdef _OPENMP
+#pragma omp parallel for default(none) schedule(dynamic) private(jj) shared(numtoas,numsub,profs,proflen,tlen,template,s,phi,results)
+#endif
+        for (ii = 0; ii < numtoas * numsub; ii++) {
+            toaresult *res = results + ii;
+            double *prof = profs + ii * proflen, *iprof = NULL;
+            int len = proflen, nosig = 1;
+
+            res->status = TOA_OK;
+            res->fit.shift = 0.0;
+            res->fit.eshift = 999.0;
+            /* If we have zapped intervals or subbands, or added padding */
+            /* sometimes we get folds with no signal at all.  Skip them.  */
+            for (jj = 1; jj < proflen; jj++) {
+                if (prof[jj] != prof[0]) {
+                    nosig = 0;
+                    break;
+                }
+            }
+            if (nosig) {
+                res->status = TOA_NOSIG;
+                continue;
+            }
+            /* Interpolate the data if the template is longer */
+            if (tlen > proflen) {
+                iprof = linear_interpolate(prof, proflen, tlen / proflen);
+                prof = iprof;
+                len = tlen;
+            }
+            if (!is_power_of_two(len)) {
+                res->status = TOA_BADLEN;
+            } else {
+                float *fprof = gen_fvect(len);
+
+                for (jj = 0; jj < len; jj++)
+                    fprof[jj] = prof[jj];
+                fftfit(fprof, s, phi, len, &res->fit);
+                vect_free(fprof);
+                /* tau and tau_err are the predicted phase of the pulse arrival */
+                res->tau = res->fit.shift / len;
+                res->tau_err = res->fit.eshift / len;
+                /* Note: "error" flags are shift = 0.0 and eshift = 999.0 */
+                if (fabs(res->fit.shift) < 1e-7 && fabs(res->fit.eshift - 999.0) < 1e-7)
+                    res->status = TOA_BADFIT;
+            }
+            /* If FFTFIT failed, use a time-domain correlation */
+            if (res->status != TOA_OK) {
+                res->tau = measure_phase_corr(prof, template, len);
+                res->tau_err = 0.1 / len;
+            }
+            if (iprof)
+                vect_free(iprof);
+        }
+    }
+
+    /* Write the TOAs in order */
+    for (ii = 0; compatible && ii < numtoas; ii++) {
+        for (jj = 0; jj < numsub; jj++) {
+            toaresult *res = results + ii * numsub + jj;
+            double dd_phs_2, tau_tot, toaf, newdays;
+            int len = (tlen > proflen) ? tlen : proflen;
+
+            if (res->status == TOA_NOSIG) {
+                fprintf(stderr,
+                        "Skipping TOA %d for subband %d due to lack of signal\n",
+                        ii + 1, jj + 1);
+                continue;
+            } else if (res->status == TOA_BADLEN) {
+                fprintf(stderr, "Profile length %d is not a power of two; "
+                        "unable to use FFTFIT.\n", len);
+            } else if (res->status == TOA_BADFIT) {
+                fprintf(stderr, "Warning!  Bad return from FFTFIT. "
+                        "May be due to inadequate signal-to-noise.\n");
+            }
+            if (res->status != TOA_OK)
+                fprintf(stderr, "Warning: using PRESTO correlation - "
+                        "reported error is incorrect...\n");
+
+            /* Calculate correction for dedispersion to true channel */
+            /* center freqs that used a slightly different period    */
+            dd_phs_2 = subdelays2[jj] * (1.0 / pp[ii] - 1.0 / p_dedisp);
+
+            /* Sum up several phase shifts */
+            tau_tot = fmod(res->tau + sumsubdelays_phs[jj] + dd_phs_2 + 3.0, 1.0);
+            if (tau_tot > 0.5)
+                tau_tot -= 1.0;
+
+            /* Send the TOA to STDOUT */
+            toaf = t0fs[ii] + (tau_tot * pp[ii] + cmd->offset) / SECPERDAY;
+            newdays = floor(toaf);
+            write_toa(cmd, pfdnm, obs, t0is[ii] + newdays, toaf - newdays,
+                      res->tau_err * pp[ii] * 1000000.0, sumsubfreqs[jj],
+                      res->tau, res->tau_err);
+            if (cmd->fftfitoutsP && res->status == TOA_OK)
+                fprintf(stderr,
+                        "FFTFIT results:  b = %.4g +/- %.4g   SNR = %.4g +/- %.4g\n",
+                        res->fit.b, res->fit.errb, res->fit.snr, res->fit.esnr);
+        }
+    }
+    fflush(stdout);
+
+    free(results);
+    vect_free(pp);
+    vect_free(t0is);
+    vect_free(t0fs);
+    vect_free(s);
+    vect_free(phi);
+    vect_free(template);
+    vect_free(sumsubfreqs);
+    vect_free(sumsubdelays_phs);
+    vect_free(subdelays2);
+    vect_free(profs);
+    delete_prepfoldinfo(&search);
+}
+
+
+int main(int argc, char *argv[])
+{
+    Cmdline *cmd;
+    int ii;
+
+    /* Call usage() if we have no command line arguments */
+
+    if (argc == 1) {
+        Program = argv[0];
+        usage();
+        exit(0);
+    }
+
+    /* Parse the command line using the excellent program Clig */
+
+    cmd = parseCmdline(argc, argv);
+    if (cmd->phaseP)
+        cmd->tempo2P = 1;
+
+#ifdef DEBUG
+    showOptionValues();
+#endif
+
+    if (cmd->ncpus > 1) {
+#ifdef _OPENMP
+        int maxcpus = omp_get_num_procs();
+        int openmp_numthreads = (cmd->ncpus <= maxcpus) ? cmd->ncpus : maxcpus;
+        // Make sure we are not dynamically setting the number of threads
+        omp_set_dynamic(0);
+        omp_set_num_threads(openmp_numthreads);
+        fprintf(stderr, "Using %d threads with OpenMP\n\n", openmp_numthreads);
+#endif
+    } else {
+#ifdef _OPENMP
+        omp_set_num_threads(1); // Explicitly turn off OpenMP
+#endif
+    }
+
+    if (cmd->tempo2P)
+        printf("FORMAT 1\n");
+
+    for (ii = 0; ii < cmd->argc; ii++)
+        get_toas(cmd->argv[ii], cmd);
+
+    return 0;
+}
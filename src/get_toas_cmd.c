@@ -0,0 +1,1134 @@
+/*****
+  command line parser -- generated by clig
+  (http://wsd.iitb.fhg.de/~kir/clighome/)
+
+  The command line parser `clig':
+  (C) 1995-2004 Harald Kirsch (clig@geggus.net)
+*****/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <errno.h>
+#include <limits.h>
+#include <float.h>
+#include <math.h>
+
+#include "get_toas_cmd.h"
+
+char *Program;
+
+/*@-null*/
+
+static Cmdline cmd = {
+  /***** -ncpus: Number of processors to use with OpenMP */
+  /* ncpusP = */ 1,
+  /* ncpus = */ 1,
+  /* ncpusC = */ 1,
+  /***** -n: Divide each fold into this many parts in time */
+  /* numtoasP = */ 1,
+  /* numtoas = */ 1,
+  /* numtoasC = */ 1,
+  /***** -s: Divide each fold into this many subbands */
+  /* numsubP = */ 1,
+  /* numsub = */ 1,
+  /* numsubC = */ 1,
+  /***** -dm: Re-combine the subbands at this DM (0.0 uses the fold DM) */
+  /* dmP = */ 1,
+  /* dm = */ 0.0,
+  /* dmC = */ 1,
+  /***** -t: The template .bestprof (or single column ASCII) profile to use */
+  /* templateP = */ 0,
+  /* template = */ (char*)0,
+  /* templateC = */ 0,
+  /***** -g: Use a Gaussian template of this FWHM (in phase) if no template is given */
+  /* gaussianP = */ 1,
+  /* gaussian = */ 0.1,
+  /* gaussianC = */ 1,
+  /***** -killsubs: Comma separated string (no spaces!) of subbands to explicitly remove from analysis (i.e. zero out).  Ranges are specified by min:max[:step] */
+  /* killsubsstrP = */ 0,
+  /* killsubsstr = */ (char*)0,
+  /* killsubsstrC = */ 0,
+  /***** -killparts: Comma separated string (no spaces!) of intervals to explicitly remove from analysis (i.e. zero-out).  Ranges are specified by min:max[:step] */
+  /* killpartsstrP = */ 0,
+  /* killpartsstr = */ (char*)0,
+  /* killpartsstrC = */ 0,
+  /***** -o: Add this offset in seconds to all of the TOAs */
+  /* offsetP = */ 1,
+  /* offset = */ 0.0,
+  /* offsetC = */ 1,
+  /***** -events: The folded data were events instead of samples or bins */
+  /* eventsP = */ 0,
+  /***** -norotate: Do not rotate the template for FFTFIT */
+  /* norotateP = */ 0,
+  /***** -center: Rotate the template so that its maximum is in bin 0 (implies -norotate) */
+  /* centerP = */ 0,
+  /***** -tempo2: Write Tempo2 format TOAs */
+  /* tempo2P = */ 0,
+  /***** -phase: Include the FFTFIT phase and error in the TOA flags (implies -tempo2) */
+  /* phaseP = */ 0,
+  /***** -fftfit: Print all of the FFTFIT outputs and errors to STDERR */
+  /* fftfitoutsP = */ 0,
+  /***** uninterpreted rest of command line */
+  /* argc = */ 0,
+  /* argv = */ (char**)0,
+  /***** the original command line concatenated */
+  /* full_cmd_line = */ NULL
+};
+
+/*@=null*/
+
+/***** let LCLint run more smoothly */
+/*@-predboolothers*/
+/*@-boolops*/
+
+
+/******************************************************************/
+/*****
+ This is a bit tricky. We want to make a difference between overflow
+ and underflow and we want to allow v==Inf or v==-Inf but not
+ v>FLT_MAX. 
+
+ We don't use fabs to avoid linkage with -lm.
+*****/
+static void
+checkFloatConversion(double v, char *option, char *arg)
+{
+  char *err = NULL;
+
+  if( (errno==ERANGE && v!=0.0) /* even double overflowed */
+      || (v<HUGE_VAL && v>-HUGE_VAL && (v<0.0?-v:v)>(double)FLT_MAX) ) {
+    err = "large";
+  } else if( (errno==ERANGE && v==0.0) 
+	     || (v!=0.0 && (v<0.0?-v:v)<(double)FLT_MIN) ) {
+    err = "small";
+  }
+  if( err ) {
+    fprintf(stderr, 
+	    "%s: parameter `%s' of option `%s' to %s to represent\n",
+	    Program, arg, option, err);
+    exit(EXIT_FAILURE);
+  }
+}
+
+int
+getIntOpt(int argc, char **argv, int i, int *value, int force)
+{
+  char *end;
+  long v;
+
+  if( ++i>=argc ) goto nothingFound;
+
+  errno = 0;
+  v = strtol(argv[i], &end, 0);
+
+  /***** check for conversion error */
+  if( end==argv[i] ) goto nothingFound;
+
+  /***** check for surplus non-whitespace */
+  while( isspace((int) *end) ) end+=1;
+  if( *end ) goto nothingFound;
+
+  /***** check if it fits into an int */
+  if( errno==ERANGE || v>(long)INT_MAX || v<(long)INT_MIN ) {
+    fprintf(stderr, 
+	    "%s: parameter `%s' of option `%s' to large to represent\n",
+	    Program, argv[i], argv[i-1]);
+    exit(EXIT_FAILURE);
+  }
+  *value = (int)v;
+
+  return i;
+
+nothingFound:
+  if( !force ) return i-1;
+
+  fprintf(stderr, 
+	  "%s: missing or malformed integer value after option `%s'\n",
+	  Program, argv[i-1]);
+    exit(EXIT_FAILURE);
+}
+/**********************************************************************/
+
+int
+getIntOpts(int argc, char **argv, int i, 
+	   int **values,
+	   int cmin, int cmax)
+/*****
+  We want to find at least cmin values and at most cmax values.
+  cmax==-1 then means infinitely many are allowed.
+*****/
+{
+  int alloced, used;
+  char *end;
+  long v;
+  if( i+cmin >= argc ) {
+    fprintf(stderr, 
+	    "%s: option `%s' wants at least %d parameters\n",
+	    Program, argv[i], cmin);
+    exit(EXIT_FAILURE);
+  }
+
+  /***** 
+    alloc a bit more than cmin values. It does not hurt to have room
+    for a bit more values than cmax.
+  *****/
+  alloced = cmin + 4;
+  *values = (int*)calloc((size_t)alloced, sizeof(int));
+  if( ! *values ) {
+outMem:
+    fprintf(stderr, 
+	    "%s: out of memory while parsing option `%s'\n",
+	    Program, argv[i]);
+    exit(EXIT_FAILURE);
+  }
+
+  for(used=0; (cmax==-1 || used<cmax) && used+i+1<argc; used++) {
+    if( used==alloced ) {
+      alloced += 8;
+      *values = (int *) realloc(*values, alloced*sizeof(int));
+      if( !*values ) goto outMem;
+    }
+
+    errno = 0;
+    v = strtol(argv[used+i+1], &end, 0);
+
+    /***** check for conversion error */
+    if( end==argv[used+i+1] ) break;
+
+    /***** check for surplus non-whitespace */
+    while( isspace((int) *end) ) end+=1;
+    if( *end ) break;
+
+    /***** check for overflow */
+    if( errno==ERANGE || v>(long)INT_MAX || v<(long)INT_MIN ) {
+      fprintf(stderr, 
+	      "%s: parameter `%s' of option `%s' to large to represent\n",
+	      Program, argv[i+used+1], argv[i]);
+      exit(EXIT_FAILURE);
+    }
+
+    (*values)[used] = (int)v;
+
+  }
+    
+  if( used<cmin ) {
+    fprintf(stderr, 
+	    "%s: parameter `%s' of `%s' should be an "
+	    "integer value\n",
+	    Program, argv[i+used+1], argv[i]);
+    exit(EXIT_FAILURE);
+  }
+
+  return i+used;
+}
+/**********************************************************************/
+
+int
+getLongOpt(int argc, char **argv, int i, long *value, int force)
+{
+  char *end;
+
+  if( ++i>=argc ) goto nothingFound;
+
+  errno = 0;
+  *value = strtol(argv[i], &end, 0);
+
+  /***** check for conversion error */
+  if( end==argv[i] ) goto nothingFound;
+
+  /***** check for surplus non-whitespace */
+  while( isspace((int) *end) ) end+=1;
+  if( *end ) goto nothingFound;
+
+  /***** check for overflow */
+  if( errno==ERANGE ) {
+    fprintf(stderr, 
+	    "%s: parameter `%s' of option `%s' to large to represent\n",
+	    Program, argv[i], argv[i-1]);
+    exit(EXIT_FAILURE);
+  }
+  return i;
+
+nothingFound:
+  /***** !force means: this parameter may be missing.*/
+  if( !force ) return i-1;
+
+  fprintf(stderr, 
+	  "%s: missing or malformed value after option `%s'\n",
+	  Program, argv[i-1]);
+    exit(EXIT_FAILURE);
+}
+/**********************************************************************/
+
+int
+getLongOpts(int argc, char **argv, int i, 
+	    long **values,
+	    int cmin, int cmax)
+/*****
+  We want to find at least cmin values and at most cmax values.
+  cmax==-1 then means infinitely many are allowed.
+*****/
+{
+  int alloced, used;
+  char *end;
+
+  if( i+cmin >= argc ) {
+    fprintf(stderr, 
+	    "%s: option `%s' wants at least %d parameters\n",
+	    Program, argv[i], cmin);
+    exit(EXIT_FAILURE);
+  }
+
+  /***** 
+    alloc a bit more than cmin values. It does not hurt to have room
+    for a bit more values than cmax.
+  *****/
+  alloced = cmin + 4;
+  *values = (long int *)calloc((size_t)alloced, sizeof(long));
+  if( ! *values ) {
+outMem:
+    fprintf(stderr, 
+	    "%s: out of memory while parsing option `%s'\n",
+	    Program, argv[i]);
+    exit(EXIT_FAILURE);
+  }
+
+  for(used=0; (cmax==-1 || used<cmax) && used+i+1<argc; used++) {
+    if( used==alloced ) {
+      alloced += 8;
+      *values = (long int*) realloc(*values, alloced*sizeof(long));
+      if( !*values ) goto outMem;
+    }
+
+    errno = 0;
+    (*values)[used] = strtol(argv[used+i+1], &end, 0);
+
+    /***** check for conversion error */
+    if( end==argv[used+i+1] ) break;
+
+    /***** check for surplus non-whitespace */
+    while( isspace((int) *end) ) end+=1; 
+    if( *end ) break;
+
+    /***** check for overflow */
+    if( errno==ERANGE ) {
+      fprintf(stderr, 
+	      "%s: parameter `%s' of option `%s' to large to represent\n",
+	      Program, argv[i+used+1], argv[i]);
+      exit(EXIT_FAILURE);
+    }
+
+  }
+    
+  if( used<cmin ) {
+    fprintf(stderr, 
+	    "%s: parameter `%s' of `%s' should be an "
+	    "integer value\n",
+	    Program, argv[i+used+1], argv[i]);
+    exit(EXIT_FAILURE);
+  }
+
+  return i+used;
+}
+/**********************************************************************/
+
+int
+getFloatOpt(int argc, char **argv, int i, float *value, int force)
+{
+  char *end;
+  double v;
+
+  if( ++i>=argc ) goto nothingFound;
+
+  errno = 0;
+  v = strtod(argv[i], &end);
+
+  /***** check for conversion error */
+  if( end==argv[i] ) goto nothingFound;
+
+  /***** check for surplus non-whitespace */
+  while( isspace((int) *end) ) end+=1;
+  if( *end ) goto nothingFound;
+
+  /***** check for overflow */
+  checkFloatConversion(v, argv[i-1], argv[i]);
+
+  *value = (float)v;
+
+  return i;
+
+nothingFound:
+  if( !force ) return i-1;
+
+  fprintf(stderr,
+	  "%s: missing or malformed float value after option `%s'\n",
+	  Program, argv[i-1]);
+  exit(EXIT_FAILURE);
+ 
+}
+/**********************************************************************/
+
+int
+getFloatOpts(int argc, char **argv, int i, 
+	   float **values,
+	   int cmin, int cmax)
+/*****
+  We want to find at least cmin values and at most cmax values.
+  cmax==-1 then means infinitely many are allowed.
+*****/
+{
+  int alloced, used;
+  char *end;
+  double v;
+
+  if( i+cmin >= argc ) {
+    fprintf(stderr, 
+	    "%s: option `%s' wants at least %d parameters\n",
+	    Program, argv[i], cmin);
+    exit(EXIT_FAILURE);
+  }
+
+  /***** 
+    alloc a bit more than cmin values.
+  *****/
+  alloced = cmin + 4;
+  *values = (float*)calloc((size_t)alloced, sizeof(float));
+  if( ! *values ) {
+outMem:
+    fprintf(stderr, 
+	    "%s: out of memory while parsing option `%s'\n",
+	    Program, argv[i]);
+    exit(EXIT_FAILURE);
+  }
+
+  for(used=0; (cmax==-1 || used<cmax) && used+i+1<argc; used++) {
+    if( used==alloced ) {
+      alloced += 8;
+      *values = (float *) realloc(*values, alloced*sizeof(float));
+      if( !*values ) goto outMem;
+    }
+
+    errno = 0;
+    v = strtod(argv[used+i+1], &end);
+
+    /***** check for conversion error */
+    if( end==argv[used+i+1] ) break;
+
+    /***** check for surplus non-whitespace */
+    while( isspace((int) *end) ) end+=1;
+    if( *end ) break;
+
+    /***** check for overflow */
+    checkFloatConversion(v, argv[i], argv[i+used+1]);
+    
+    (*values)[used] = (float)v;
+  }
+    
+  if( used<cmin ) {
+    fprintf(stderr, 
+	    "%s: parameter `%s' of `%s' should be a "
+	    "floating-point value\n",
+	    Program, argv[i+used+1], argv[i]);
+    exit(EXIT_FAILURE);
+  }
+
+  return i+used;
+}
+/**********************************************************************/
+
+int
+getDoubleOpt(int argc, char **argv, int i, double *value, int force)
+{
+  char *end;
+
+  if( ++i>=argc ) goto nothingFound;
+
+  errno = 0;
+  *value = strtod(argv[i], &end);
+
+  /***** check for conversion error */
+  if( end==argv[i] ) goto nothingFound;
+
+  /***** check for surplus non-whitespace */
+  while( isspace((int) *end) ) end+=1;
+  if( *end ) goto nothingFound;
+
+  /***** check for overflow */
+  if( errno==ERANGE ) {
+    fprintf(stderr, 
+	    "%s: parameter `%s' of option `%s' to %s to represent\n",
+	    Program, argv[i], argv[i-1],
+	    (*value==0.0 ? "small" : "large"));
+    exit(EXIT_FAILURE);
+  }
+
+  return i;
+
+nothingFound:
+  if( !force ) return i-1;
+
+  fprintf(stderr,
+	  "%s: missing or malformed value after option `%s'\n",
+	  Program, argv[i-1]);
+  exit(EXIT_FAILURE);
+ 
+}
+/**********************************************************************/
+
+int
+getDoubleOpts(int argc, char **argv, int i, 
+	   double **values,
+	   int cmin, int cmax)
+/*****
+  We want to find at least cmin values and at most cmax values.
+  cmax==-1 then means infinitely many are allowed.
+*****/
+{
+  int alloced, used;
+  char *end;
+
+  if( i+cmin >= argc ) {
+    fprintf(stderr, 
+	    "%s: option `%s' wants at least %d parameters\n",
+	    Program, argv[i], cmin);
+    exit(EXIT_FAILURE);
+  }
+
+  /***** 
+    alloc a bit more than cmin values.
+  *****/
+  alloced = cmin + 4;
+  *values = (double*)calloc((size_t)alloced, sizeof(double));
+  if( ! *values ) {
+outMem:
+    fprintf(stderr, 
+	    "%s: out of memory while parsing option `%s'\n",
+	    Program, argv[i]);
+    exit(EXIT_FAILURE);
+  }
+
+  for(used=0; (cmax==-1 || used<cmax) && used+i+1<argc; used++) {
+    if( used==alloced ) {
+      alloced += 8;
+      *values = (double *) realloc(*values, alloced*sizeof(double));
+      if( !*values ) goto outMem;
+    }
+
+    errno = 0;
+    (*values)[used] = strtod(argv[used+i+1], &end);
+
+    /***** check for conversion error */
+    if( end==argv[used+i+1] ) break;
+
+    /***** check for surplus non-whitespace */
+    while( isspace((int) *end) ) end+=1;
+    if( *end ) break;
+
+    /***** check for overflow */
+    if( errno==ERANGE ) {
+      fprintf(stderr, 
+	      "%s: parameter `%s' of option `%s' to %s to represent\n",
+	      Program, argv[i+used+1], argv[i],
+	      ((*values)[used]==0.0 ? "small" : "large"));
+      exit(EXIT_FAILURE);
+    }
+
+  }
+    
+  if( used<cmin ) {
+    fprintf(stderr, 
+	    "%s: parameter `%s' of `%s' should be a "
+	    "double value\n",
+	    Program, argv[i+used+1], argv[i]);
+    exit(EXIT_FAILURE);
+  }
+
+  return i+used;
+}
+/**********************************************************************/
+
+/**
+  force will be set if we need at least one argument for the option.
+*****/
+int
+getStringOpt(int argc, char **argv, int i, char **value, int force)
+{
+  i += 1;
+  if( i>=argc ) {
+    if( force ) {
+      fprintf(stderr, "%s: missing string after option `%s'\n",
+	      Program, argv[i-1]);
+      exit(EXIT_FAILURE);
+    } 
+    return i-1;
+  }
+  
+  if( !force && argv[i][0] == '-' ) return i-1;
+  *value = argv[i];
+  return i;
+}
+/**********************************************************************/
+
+int
+getStringOpts(int argc, char **argv, int i, 
+	   char*  **values,
+	   int cmin, int cmax)
+/*****
+  We want to find at least cmin values and at most cmax values.
+  cmax==-1 then means infinitely many are allowed.
+*****/
+{
+  int alloced, used;
+
+  if( i+cmin >= argc ) {
+    fprintf(stderr, 
+	    "%s: option `%s' wants at least %d parameters\n",
+	    Program, argv[i], cmin);
+    exit(EXIT_FAILURE);
+  }
+
+  alloced = cmin + 4;
+    
+  *values = (char**)calloc((size_t)alloced, sizeof(char*));
+  if( ! *values ) {
+outMem:
+    fprintf(stderr, 
+	    "%s: out of memory during parsing of option `%s'\n",
+	    Program, argv[i]);
+    exit(EXIT_FAILURE);
+  }
+
+  for(used=0; (cmax==-1 || used<cmax) && used+i+1<argc; used++) {
+    if( used==alloced ) {
+      alloced += 8;
+      *values = (char **)realloc(*values, alloced*sizeof(char*));
+      if( !*values ) goto outMem;
+    }
+
+    if( used>=cmin && argv[used+i+1][0]=='-' ) break;
+    (*values)[used] = argv[used+i+1];
+  }
+    
+  if( used<cmin ) {
+    fprintf(stderr, 
+    "%s: less than %d parameters for option `%s', only %d found\n",
+	    Program, cmin, argv[i], used);
+    exit(EXIT_FAILURE);
+  }
+
+  return i+used;
+}
+/**********************************************************************/
+
+void
+checkIntLower(char *opt, int *values, int count, int max)
+{
+  int i;
+
+  for(i=0; i<count; i++) {
+    if( values[i]<=max ) continue;
+    fprintf(stderr, 
+	    "%s: parameter %d of option `%s' greater than max=%d\n",
+	    Program, i+1, opt, max);
+    exit(EXIT_FAILURE);
+  }
+}
+/**********************************************************************/
+
+void
+checkIntHigher(char *opt, int *values, int count, int min)
+{
+  int i;
+
+  for(i=0; i<count; i++) {
+    if( values[i]>=min ) continue;
+    fprintf(stderr, 
+	    "%s: parameter %d of option `%s' smaller than min=%d\n",
+	    Program, i+1, opt, min);
+    exit(EXIT_FAILURE);
+  }
+}
+/**********************************************************************/
+
+void
+checkLongLower(char *opt, long *values, int count, long max)
+{
+  int i;
+
+  for(i=0; i<count; i++) {
+    if( values[i]<=max ) continue;
+    fprintf(stderr, 
+	    "%s: parameter %d of option `%s' greater than max=%ld\n",
+	    Program, i+1, opt, max);
+    exit(EXIT_FAILURE);
+  }
+}
+/**********************************************************************/
+
+void
+checkLongHigher(char *opt, long *values, int count, long min)
+{
+  int i;
+
+  for(i=0; i<count; i++) {
+    if( values[i]>=min ) continue;
+    fprintf(stderr, 
+	    "%s: parameter %d of option `%s' smaller than min=%ld\n",
+	    Program, i+1, opt, min);
+    exit(EXIT_FAILURE);
+  }
+}
+/**********************************************************************/
+
+void
+checkFloatLower(char *opt, float *values, int count, float max)
+{
+  int i;
+
+  for(i=0; i<count; i++) {
+    if( values[i]<=max ) continue;
+    fprintf(stderr, 
+	    "%s: parameter %d of option `%s' greater than max=%f\n",
+	    Program, i+1, opt, max);
+    exit(EXIT_FAILURE);
+  }
+}
+/**********************************************************************/
+
+void
+checkFloatHigher(char *opt, float *values, int count, float min)
+{
+  int i;
+
+  for(i=0; i<count; i++) {
+    if( values[i]>=min ) continue;
+    fprintf(stderr, 
+	    "%s: parameter %d of option `%s' smaller than min=%f\n",
+	    Program, i+1, opt, min);
+    exit(EXIT_FAILURE);
+  }
+}
+/**********************************************************************/
+
+void
+checkDoubleLower(char *opt, double *values, int count, double max)
+{
+  int i;
+
+  for(i=0; i<count; i++) {
+    if( values[i]<=max ) continue;
+    fprintf(stderr, 
+	    "%s: parameter %d of option `%s' greater than max=%f\n",
+	    Program, i+1, opt, max);
+    exit(EXIT_FAILURE);
+  }
+}
+/**********************************************************************/
+
+void
+checkDoubleHigher(char *opt, double *values, int count, double min)
+{
+  int i;
+
+  for(i=0; i<count; i++) {
+    if( values[i]>=min ) continue;
+    fprintf(stderr, 
+	    "%s: parameter %d of option `%s' smaller than min=%f\n",
+	    Program, i+1, opt, min);
+    exit(EXIT_FAILURE);
+  }
+}
+/**********************************************************************/
+
+static void
+missingErr(char *opt)
+{
+  fprintf(stderr, "%s: mandatory option `%s' missing\n",
+	  Program, opt);
+}
+/**********************************************************************/
+
+static char *
+catArgv(int argc, char **argv)
+{
+  int i;
+  size_t l;
+  char *s, *t;
+
+  for(i=0, l=0; i<argc; i++) l += (1+strlen(argv[i]));
+  s = (char *)malloc(l);
+  if( !s ) {
+    fprintf(stderr, "%s: out of memory\n", Program);
+    exit(EXIT_FAILURE);
+  }
+  strcpy(s, argv[0]);
+  t = s;
+  for(i=1; i<argc; i++) {
+    t = t+strlen(t);
+    *t++ = ' ';
+    strcpy(t, argv[i]);
+  }
+  return s;
+}
+/**********************************************************************/
+
+void
+showOptionValues(void)
+{
+  int i;
+
+  printf("Full command line is:\n`%s'\n", cmd.full_cmd_line);
+
+  /***** -ncpus: Number of processors to use with OpenMP */
+  if( !cmd.ncpusP ) {
+    printf("-ncpus not found.\n");
+  } else {
+    printf("-ncpus found:\n");
+    if( !cmd.ncpusC ) {
+      printf("  no values\n");
+    } else {
+      printf("  value = `%d'\n", cmd.ncpus);
+    }
+  }
+
+  /***** -n: Divide each fold into this many parts in time */
+  if( !cmd.numtoasP ) {
+    printf("-n not found.\n");
+  } else {
+    printf("-n found:\n");
+    if( !cmd.numtoasC ) {
+      printf("  no values\n");
+    } else {
+      printf("  value = `%d'\n", cmd.numtoas);
+    }
+  }
+
+  /***** -s: Divide each fold into this many subbands */
+  if( !cmd.numsubP ) {
+    printf("-s not found.\n");
+  } else {
+    printf("-s found:\n");
+    if( !cmd.numsubC ) {
+      printf("  no values\n");
+    } else {
+      printf("  value = `%d'\n", cmd.numsub);
+    }
+  }
+
+  /***** -dm: Re-combine the subbands at this DM (0.0 uses the fold DM) */
+  if( !cmd.dmP ) {
+    printf("-dm not found.\n");
+  } else {
+    printf("-dm found:\n");
+    if( !cmd.dmC ) {
+      printf("  no values\n");
+    } else {
+      printf("  value = `%.40g'\n", cmd.dm);
+    }
+  }
+
+  /***** -t: The template .bestprof (or single column ASCII) profile to use */
+  if( !cmd.templateP ) {
+    printf("-t not found.\n");
+  } else {
+    printf("-t found:\n");
+    if( !cmd.templateC ) {
+      printf("  no values\n");
+    } else {
+      printf("  value = `%s'\n", cmd.template);
+    }
+  }
+
+  /***** -g: Use a Gaussian template of this FWHM (in phase) if no template is given */
+  if( !cmd.gaussianP ) {
+    printf("-g not found.\n");
+  } else {
+    printf("-g found:\n");
+    if( !cmd.gaussianC ) {
+      printf("  no values\n");
+    } else {
+      printf("  value = `%.40g'\n", cmd.gaussian);
+    }
+  }
+
+  /***** -killsubs: Comma separated string (no spaces!) of subbands to explicitly remove from analysis (i.e. zero out).  Ranges are specified by min:max[:step] */
+  if( !cmd.killsubsstrP ) {
+    printf("-killsubs not found.\n");
+  } else {
+    printf("-killsubs found:\n");
+    if( !cmd.killsubsstrC ) {
+      printf("  no values\n");
+    } else {
+      printf("  value = `%s'\n", cmd.killsubsstr);
+    }
+  }
+
+  /***** -killparts: Comma separated string (no spaces!) of intervals to explicitly remove from analysis (i.e. zero-out).  Ranges are specified by min:max[:step] */
+  if( !cmd.killpartsstrP ) {
+    printf("-killparts not found.\n");
+  } else {
+    printf("-killparts found:\n");
+    if( !cmd.killpartsstrC ) {
+      printf("  no values\n");
+    } else {
+      printf("  value = `%s'\n", cmd.killpartsstr);
+    }
+  }
+
+  /***** -o: Add this offset in seconds to all of the TOAs */
+  if( !cmd.offsetP ) {
+    printf("-o not found.\n");
+  } else {
+    printf("-o found:\n");
+    if( !cmd.offsetC ) {
+      printf("  no values\n");
+    } else {
+      printf("  value = `%.40g'\n", cmd.offset);
+    }
+  }
+
+  /***** -events: The folded data were events instead of samples or bins */
+  if( !cmd.eventsP ) {
+    printf("-events not found.\n");
+  } else {
+    printf("-events found:\n");
+  }
+
+  /***** -norotate: Do not rotate the template for FFTFIT */
+  if( !cmd.norotateP ) {
+    printf("-norotate not found.\n");
+  } else {
+    printf("-norotate found:\n");
+  }
+
+  /***** -center: Rotate the template so that its maximum is in bin 0 (implies -norotate) */
+  if( !cmd.centerP ) {
+    printf("-center not found.\n");
+  } else {
+    printf("-center found:\n");
+  }
+
+  /***** -tempo2: Write Tempo2 format TOAs */
+  if( !cmd.tempo2P ) {
+    printf("-tempo2 not found.\n");
+  } else {
+    printf("-tempo2 found:\n");
+  }
+
+  /***** -phase: Include the FFTFIT phase and error in the TOA flags (implies -tempo2) */
+  if( !cmd.phaseP ) {
+    printf("-phase not found.\n");
+  } else {
+    printf("-phase found:\n");
+  }
+
+  /***** -fftfit: Print all of the FFTFIT outputs and errors to STDERR */
+  if( !cmd.fftfitoutsP ) {
+    printf("-fftfit not found.\n");
+  } else {
+    printf("-fftfit found:\n");
+  }
+  if( !cmd.argc ) {
+    printf("no remaining parameters in argv\n");
+  } else {
+    printf("argv =");
+    for(i=0; i<cmd.argc; i++) {
+      printf(" `%s'", cmd.argv[i]);
+    }
+    printf("\n");
+  }
+}
+/**********************************************************************/
+
+void
+usage(void)
+{
+  fprintf(stderr,"%s","   [-ncpus ncpus] [-n numtoas] [-s numsub] [-dm dm] [-t template] [-g gaussian] [-killsubs killsubsstr] [-killparts killpartsstr] [-o offset] [-events] [-norotate] [-center] [-tempo2] [-phase] [-fftfit] [--] infiles ...\n");
+  fprintf(stderr,"%s","      Generates TOAs from many 'pfd' files using Taylor's FFTFIT (a compiled get_TOAs.py).\n");
+  fprintf(stderr,"%s","        -ncpus: Number of processors to use with OpenMP\n");
+  fprintf(stderr,"%s","                1 int value between 1 and oo\n");
+  fprintf(stderr,"%s","                default: `1'\n");
+  fprintf(stderr,"%s","            -n: Divide each fold into this many parts in time\n");
+  fprintf(stderr,"%s","                1 int value between 1 and oo\n");
+  fprintf(stderr,"%s","                default: `1'\n");
+  fprintf(stderr,"%s","            -s: Divide each fold into this many subbands\n");
+  fprintf(stderr,"%s","                1 int value between 1 and oo\n");
+  fprintf(stderr,"%s","                default: `1'\n");
+  fprintf(stderr,"%s","           -dm: Re-combine the subbands at this DM (0.0 uses the fold DM)\n");
+  fprintf(stderr,"%s","                1 double value between 0 and oo\n");
+  fprintf(stderr,"%s","                default: `0.0'\n");
+  fprintf(stderr,"%s","            -t: The template .bestprof (or single column ASCII) profile to use\n");
+  fprintf(stderr,"%s","                1 char* value\n");
+  fprintf(stderr,"%s","            -g: Use a Gaussian template of this FWHM (in phase) if no template is given\n");
+  fprintf(stderr,"%s","                1 double value between 0 and 1\n");
+  fprintf(stderr,"%s","                default: `0.1'\n");
+  fprintf(stderr,"%s","     -killsubs: Comma separated string (no spaces!) of subbands to explicitly remove from analysis (i.e. zero out).  Ranges are specified by min:max[:step]\n");
+  fprintf(stderr,"%s","                1 char* value\n");
+  fprintf(stderr,"%s","    -killparts: Comma separated string (no spaces!) of intervals to explicitly remove from analysis (i.e. zero-out).  Ranges are specified by min:max[:step]\n");
+  fprintf(stderr,"%s","                1 char* value\n");
+  fprintf(stderr,"%s","            -o: Add this offset in seconds to all of the TOAs\n");
+  fprintf(stderr,"%s","                1 double value\n");
+  fprintf(stderr,"%s","                default: `0.0'\n");
+  fprintf(stderr,"%s","       -events: The folded data were events instead of samples or bins\n");
+  fprintf(stderr,"%s","     -norotate: Do not rotate the template for FFTFIT\n");
+  fprintf(stderr,"%s","       -center: Rotate the template so that its maximum is in bin 0 (implies -norotate)\n");
+  fprintf(stderr,"%s","       -tempo2: Write Tempo2 format TOAs\n");
+  fprintf(stderr,"%s","        -phase: Include the FFTFIT phase and error in the TOA flags (implies -tempo2)\n");
+  fprintf(stderr,"%s","       -fftfit: Print all of the FFTFIT outputs and errors to STDERR\n");
+  fprintf(stderr,"%s","       infiles: The input 'pfd' files (made with -nosearch or -timing).\n");
+  fprintf(stderr,"%s","                1...16384 values\n");
+  fprintf(stderr,"%s","  version: 18Oct26\n");
+  fprintf(stderr,"%s","  ");
+  exit(EXIT_FAILURE);
+}
+/**********************************************************************/
+Cmdline *
+parseCmdline(int argc, char **argv)
+{
+  int i;
+
+  Program = argv[0];
+  cmd.full_cmd_line = catArgv(argc, argv);
+  for(i=1, cmd.argc=1; i<argc; i++) {
+    if( 0==strcmp("--", argv[i]) ) {
+      while( ++i<argc ) argv[cmd.argc++] = argv[i];
+      continue;
+    }
+
+    if( 0==strcmp("-ncpus", argv[i]) ) {
+      int keep = i;
+      cmd.ncpusP = 1;
+      i = getIntOpt(argc, argv, i, &cmd.ncpus, 1);
+      cmd.ncpusC = i-keep;
+      checkIntHigher("-ncpus", &cmd.ncpus, cmd.ncpusC, 1);
+      continue;
+    }
+
+    if( 0==strcmp("-n", argv[i]) ) {
+      int keep = i;
+      cmd.numtoasP = 1;
+      i = getIntOpt(argc, argv, i, &cmd.numtoas, 1);
+      cmd.numtoasC = i-keep;
+      checkIntHigher("-n", &cmd.numtoas, cmd.numtoasC, 1);
+      continue;
+    }
+
+    if( 0==strcmp("-s", argv[i]) ) {
+      int keep = i;
+      cmd.numsubP = 1;
+      i = getIntOpt(argc, argv, i, &cmd.numsub, 1);
+      cmd.numsubC = i-keep;
+      checkIntHigher("-s", &cmd.numsub, cmd.numsubC, 1);
+      continue;
+    }
+
+    if( 0==strcmp("-dm", argv[i]) ) {
+      int keep = i;
+      cmd.dmP = 1;
+      i = getDoubleOpt(argc, argv, i, &cmd.dm, 1);
+      cmd.dmC = i-keep;
+      checkDoubleHigher("-dm", &cmd.dm, cmd.dmC, 0);
+      continue;
+    }
+
+    if( 0==strcmp("-t", argv[i]) ) {
+      int keep = i;
+      cmd.templateP = 1;
+      i = getStringOpt(argc, argv, i, &cmd.template, 1);
+      cmd.templateC = i-keep;
+      continue;
+    }
+
+    if( 0==strcmp("-g", argv[i]) ) {
+      int keep = i;
+      cmd.gaussianP = 1;
+      i = getDoubleOpt(argc, argv, i, &cmd.gaussian, 1);
+      cmd.gaussianC = i-keep;
+      checkDoubleLower("-g", &cmd.gaussian, cmd.gaussianC, 1);
+      checkDoubleHigher("-g", &cmd.gaussian, cmd.gaussianC, 0);
+      continue;
+    }
+
+    if( 0==strcmp("-killsubs", argv[i]) ) {
+      int keep = i;
+      cmd.killsubsstrP = 1;
+      i = getStringOpt(argc, argv, i, &cmd.killsubsstr, 1);
+      cmd.killsubsstrC = i-keep;
+      continue;
+    }
+
+    if( 0==strcmp("-killparts", argv[i]) ) {
+      int keep = i;
+      cmd.killpartsstrP = 1;
+      i = getStringOpt(argc, argv, i, &cmd.killpartsstr, 1);
+      cmd.killpartsstrC = i-keep;
+      continue;
+    }
+
+    if( 0==strcmp("-o", argv[i]) ) {
+      int keep = i;
+      cmd.offsetP = 1;
+      i = getDoubleOpt(argc, argv, i, &cmd.offset, 1);
+      cmd.offsetC = i-keep;
+      continue;
+    }
+
+    if( 0==strcmp("-events", argv[i]) ) {
+      cmd.eventsP = 1;
+      continue;
+    }
+
+    if( 0==strcmp("-norotate", argv[i]) ) {
+      cmd.norotateP = 1;
+      continue;
+    }
+
+    if( 0==strcmp("-center", argv[i]) ) {
+      cmd.centerP = 1;
+      continue;
+    }
+
+    if( 0==strcmp("-tempo2", argv[i]) ) {
+      cmd.tempo2P = 1;
+      continue;
+    }
+
+    if( 0==strcmp("-phase", argv[i]) ) {
+      cmd.phaseP = 1;
+      continue;
+    }
+
+    if( 0==strcmp("-fftfit", argv[i]) ) {
+      cmd.fftfitoutsP = 1;
+      continue;
+    }
+
+    if( argv[i][0]=='-' ) {
+      fprintf(stderr, "\n%s: unknown option `%s'\n\n",
+              Program, argv[i]);
+      usage();
+    }
+    argv[cmd.argc++] = argv[i];
+  }/* for i */
+
+
+  /*@-mustfree*/
+  cmd.argv = argv+1;
+  /*@=mustfree*/
+  cmd.argc -= 1;
+
+  if( 1>cmd.argc ) {
+    fprintf(stderr, "%s: there should be at least 1 non-option argument(s)\n",
+            Program);
+    exit(EXIT_FAILURE);
+  }
+  if( 16384<cmd.argc ) {
+    fprintf(stderr, "%s: there should be at most 16384 non-option argument(s)\n",
+            Program);
+    exit(EXIT_FAILURE);
+  }
+  /*@-compmempass*/  return &cmd;
+}
+
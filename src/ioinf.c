@@ -35,11 +35,9 @@ void read_inf_line_valstr(FILE * infofile, char *valstr, char *errdesc)
                     break;
             }
             if (ii + 1 == 0) {
-                sprintf(line,
-                        "Error:  no '=' to separate key/val while looking for '%s' in readinf()\n",
-                        errdesc);
-                perror(line);
-                exit(EXIT_FAILURE);
+                presto_error(PRESTO_ERR_FORMAT,
+                             "no '=' to separate key/val while looking for '%s' in readinf()",
+                             errdesc);
             }
             sptr = line + ii + 1;
         }
@@ -50,11 +48,9 @@ void read_inf_line_valstr(FILE * infofile, char *valstr, char *errdesc)
                 (strcmp(errdesc, "data->telescope") == 0 && slen > 39) ||
                 (strcmp(errdesc, "data->band") == 0 && slen > 39) ||
                 (strcmp(errdesc, "data->name") != 0 && slen > 99)) {
-                sprintf(line,
-                        "Error:  value string is too long (%d char) while looking for '%s' in readinf()\n",
-                        slen, errdesc);
-                perror(line);
-                exit(EXIT_FAILURE);
+                presto_error(PRESTO_ERR_FORMAT,
+                             "value string is too long (%d char) while looking for '%s' in readinf()",
+                             slen, errdesc);
             }
             strcpy(valstr, sptr);
         } else {
@@ -62,58 +58,49 @@ void read_inf_line_valstr(FILE * infofile, char *valstr, char *errdesc)
         }
         return;
     } else {
-        if (feof(infofile)) {
-            sprintf(line,
-                    "Error:  end-of-file while looking for '%s' in readinf()\n",
-                    errdesc);
-        } else {
-            sprintf(line,
-                    "Error:  found blank line while looking for '%s' in readinf()\n",
-                    errdesc);
-        }
-        perror(line);
-        exit(EXIT_FAILURE);
+        if (feof(infofile))
+            presto_error(PRESTO_ERR_EOF,
+                         "end-of-file while looking for '%s' in readinf()",
+                         errdesc);
+        else
+            presto_error(PRESTO_ERR_FORMAT,
+                         "found blank line while looking for '%s' in readinf()",
+                         errdesc);
     }
     // Should never get here....
 }
 
 double chk_str2double(char *instr, char *desc)
 {
-    char tmp[100], *sptr = instr, *endptr;
+    char *sptr = instr, *endptr;
     double retval;
 
     retval = strtod(sptr, &endptr);
     if (retval == 0.0 && endptr == instr) {
-        sprintf(tmp,
-                "Error:  can not convert '%s' to a double (%s) in chk_str2double()\n",
-                instr, desc);
-        perror(tmp);
-        exit(EXIT_FAILURE);
+        presto_error(PRESTO_ERR_FORMAT,
+                     "can not convert '%s' to a double (%s) in chk_str2double()",
+                     instr, desc);
     }
     return retval;
 }
 
 long chk_str2long(char *instr, char *desc)
 {
-    char tmp[100], *sptr = instr, *endptr;
+    char *sptr = instr, *endptr;
     long retval;
 
     errno = 0;
     retval = strtol(sptr, &endptr, 10);
     if ((errno == ERANGE && (retval == LONG_MAX || retval == LONG_MIN))
         || (errno != 0 && retval == 0)) {
-        sprintf(tmp,
-                "Error:  can not convert '%s' to an int/long (%s) in chk_str2long()\n",
-                instr, desc);
-        perror(tmp);
-        exit(EXIT_FAILURE);
+        presto_error(PRESTO_ERR_FORMAT,
+                     "can not convert '%s' to an int/long (%s) in chk_str2long()",
+                     instr, desc);
     }
     if (endptr == instr) {
-        sprintf(tmp,
-                "Error:  No digits were found in '%s' for %s in chk_str2long()\n",
-                instr, desc);
-        perror(tmp);
-        exit(EXIT_FAILURE);
+        presto_error(PRESTO_ERR_FORMAT,
+                     "No digits were found in '%s' for %s in chk_str2long()",
+                     instr, desc);
     }
     return retval;
 }
@@ -143,10 +130,9 @@ void readinf(infodata * data, char *filenm)
         read_inf_line_valstr(infofile, tmp1, "MJD string");
         retval = sscanf(tmp1, "%d.%s", &data->mjd_i, tmp2);
         if (retval != 2) {
-            sprintf(tmp3, "Error:  can not parse MJD string '%s' in readinf()'\n",
-                    tmp1);
-            perror(tmp3);
-            exit(EXIT_FAILURE);
+            presto_error(PRESTO_ERR_FORMAT,
+                         "can not parse MJD string '%s' in readinf()'",
+                         tmp1);
         }
         sprintf(tmp3, "0.%s", tmp2);
         data->mjd_f = chk_str2double(tmp3, "data->mjd_f");
@@ -169,21 +155,17 @@ void readinf(infodata * data, char *filenm)
             retval = sscanf(tmp1, "%lf %*[ ,] %lf",
                             &data->onoff[ii], &data->onoff[ii + 1]);
             if (retval != 2) {
-                sprintf(tmp3,
-                        "Error:  can not parse on-off pair (%d) in readinf()\n",
-                        ii / 2);
-                perror(tmp3);
-                exit(EXIT_FAILURE);
+                presto_error(PRESTO_ERR_FORMAT,
+                             "can not parse on-off pair (%d) in readinf()",
+                             ii / 2);
             }
             ii += 2;
         } while (data->onoff[ii - 1] < data->N - 1 && ii < 2 * MAXNUMONOFF);
         data->numonoff = ii / 2;
         if (data->numonoff >= MAXNUMONOFF) {
-            sprintf(tmp3,
-                    "Error:  number of onoff pairs (%d) >= MAXNUMONOFF (%d) in readinf().\n",
-                    data->numonoff, MAXNUMONOFF);
-            perror(tmp3);
-            exit(EXIT_FAILURE);
+            presto_error(PRESTO_ERR_FORMAT,
+                         "number of onoff pairs (%d) >= MAXNUMONOFF (%d) in readinf().",
+                         data->numonoff, MAXNUMONOFF);
         }
     } else {
         data->numonoff = 1;
@@ -0,0 +1,288 @@
+#include "presto.h"
+#include "lombscargle.h"
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+/* Number of frequencies computed at once (by each thread) */
+#define LS_CHUNKLEN 262144
+/* Number of detections to allocate space for at a time */
+#define HITCHUNK 1024
+
+static int compare_lscand_sigma(const void *ca, const void *cb)
+/*  Used as compare function for qsort() */
+{
+    lscand *a, *b;
+
+    a = (lscand *) ca;
+    b = (lscand *) cb;
+    if (b->sigma > a->sigma)
+        return 1;
+    if (b->sigma < a->sigma)
+        return -1;
+    return 0;
+}
+
+
+static inline void extirpolate(fcomplex * grid, long gridlen, double x,
+                               float re, float im)
+/* Add the value (re, im) at position 'x' to the cyclic uniform   */
+/* 'grid' (whose length is a power-of-2) by spreading it over the */
+/* 4 nearest grid points with Lagrange interpolation weights.     */
+/* The sums of exp(-2 pi i k x / gridlen) over the values are     */
+/* then (very nearly) the FFT of the grid for k << gridlen.       */
+{
+    long ilo = (long) floor(x) - 1, mask = gridlen - 1;
+    double u = x - ilo, w[4];
+    int jj;
+
+    w[0] = -(u - 1.0) * (u - 2.0) * (u - 3.0) / 6.0;
+    w[1] = u * (u - 2.0) * (u - 3.0) / 2.0;
+    w[2] = -u * (u - 1.0) * (u - 3.0) / 2.0;
+    w[3] = u * (u - 1.0) * (u - 2.0) / 6.0;
+    for (jj = 0; jj < 4; jj++) {
+        fcomplex *g = grid + ((ilo + jj) & mask);
+        g->r += w[jj] * re;
+        g->i += w[jj] * im;
+    }
+}
+
+
+float *ls_periodogram(double *times, float *data, long numpts,
+                      double df, long klo, long numf)
+/* Return the normalized Lomb-Scargle periodogram of the unevenly     */
+/* sampled 'data' (taken at 'times' seconds) for the 'numf'           */
+/* frequencies (klo + i) * df.  If 'data' is NULL, 'times' is a list  */
+/* of events and the Rayleigh powers are returned instead.  Noise     */
+/* powers are exponentially distributed with a mean of 1 (just like   */
+/* PRESTO's normalized Fourier powers).  The sums are computed with   */
+/* FFTs after the Press & Rybicki (1989, ApJ, 338, 277) extirpolation */
+/* of the data onto a uniform grid, and chunks of frequencies are     */
+/* done in parallel.                                                  */
+{
+    long ii, chunk, chunklen, numchunks, gridlen;
+    double tlo, avg = 0.0, var = 0.0;
+    float *ydata = NULL, *powers;
+    fftwf_plan plan;
+
+    chunklen = (numf < LS_CHUNKLEN) ? numf : LS_CHUNKLEN;
+    numchunks = (numf + chunklen - 1) / chunklen;
+    /* The 2-omega sums need frequencies up to 2 * chunklen and */
+    /* the extirpolation is only accurate well below the grid's */
+    /* Nyquist frequency (as in Numerical Recipes' fasper()).   */
+    gridlen = next2_to_n(16 * chunklen);
+
+    /* The times relative to the first one (which doesn't change */
+    /* the powers) and the data with their mean removed          */
+    tlo = times[0];
+    for (ii = 1; ii < numpts; ii++)
+        if (times[ii] < tlo)
+            tlo = times[ii];
+    if (data) {
+        for (ii = 0; ii < numpts; ii++)
+            avg += data[ii];
+        avg /= numpts;
+        ydata = gen_fvect(numpts);
+        for (ii = 0; ii < numpts; ii++) {
+            ydata[ii] = data[ii] - avg;
+            var += ydata[ii] * (double) ydata[ii];
+        }
+        var /= (numpts - 1);
+        if (var <= 0.0)
+            presto_error(PRESTO_ERR_VALUE,
+                         "the data have zero variance in ls_periodogram()");
+    }
+
+    powers = gen_fvect(numf);
+
+    // FFTW planning is *not* thread-safe, so make a plan that all
+    // of the threads can use with the new-array execute function
+    {
+        fcomplex *tmp = gen_cvect(gridlen);
+        plan = fftwf_plan_dft_1d(gridlen, (fftwf_complex *) tmp,
+                                 (fftwf_complex *) tmp, -1, FFTW_ESTIMATE);
+        vect_free(tmp);
+    }
+
+#ifdef _OPENMP
+#pragma omp parallel default(none) private(ii) \
+    shared(times,data,ydata,numpts,df,klo,numf,chunklen,numchunks,gridlen,tlo,var,powers,plan)
+#endif
+    {
+        fcomplex *dgrid = gen_cvect(gridlen);
+        fcomplex *wgrid = data ? gen_cvect(gridlen) : NULL;
+
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic)
+#endif
+        for (chunk = 0; chunk < numchunks; chunk++) {
+            long k0 = klo + chunk * chunklen, numk;
+            double f0 = k0 * df, scale = gridlen * df;
+            float *outpows = powers + chunk * chunklen;
+
+            numk = numf - chunk * chunklen;
+            if (numk > chunklen)
+                numk = chunklen;
+            memset(dgrid, 0, sizeof(fcomplex) * gridlen);
+            if (wgrid)
+                memset(wgrid, 0, sizeof(fcomplex) * gridlen);
+
+            /* Heterodyne the data down by the lowest frequency of the */
+            /* chunk so the FFT bins are offsets from it, then spread  */
+            /* the values onto the grids.                              */
+            for (ii = 0; ii < numpts; ii++) {
+                double t = times[ii] - tlo, phs, c, s, x;
+
+                phs = TWOPI * fmod(f0 * t, 1.0);
+                c = cos(phs);
+                s = sin(phs);
+                x = fmod(scale * t, (double) gridlen);
+                if (data) {
+                    extirpolate(dgrid, gridlen, x, ydata[ii] * c, -ydata[ii] * s);
+                    extirpolate(wgrid, gridlen, x, c * c - s * s, -2.0 * c * s);
+                } else {
+                    extirpolate(dgrid, gridlen, x, c, -s);
+                }
+            }
+            fftwf_execute_dft(plan, (fftwf_complex *) dgrid, (fftwf_complex *) dgrid);
+            if (wgrid)
+                fftwf_execute_dft(plan, (fftwf_complex *) wgrid,
+                                  (fftwf_complex *) wgrid);
+
+            for (ii = 0; ii < numk; ii++) {
+                /* The sums of y * cos(wt) and y * sin(wt) */
+                double yc = dgrid[ii].r, ys = -dgrid[ii].i;
+
+                if (!data) {
+                    outpows[ii] = (yc * yc + ys * ys) / numpts;
+                } else {
+                    /* The sums of cos(2wt) and sin(2wt) give tau */
+                    double c2 = wgrid[2 * ii].r, s2 = -wgrid[2 * ii].i;
+                    double hypo, hc2wt = 0.5, hs2wt = 0.0, cwt, swt, den;
+                    double ct, st, lspow = 0.0;
+
+                    hypo = sqrt(c2 * c2 + s2 * s2);
+                    if (hypo > 0.0) {
+                        hc2wt = 0.5 * c2 / hypo;
+                        hs2wt = 0.5 * s2 / hypo;
+                    }
+                    cwt = sqrt(0.5 + hc2wt);
+                    swt = sqrt(fabs(0.5 - hc2wt));
+                    if (hs2wt < 0.0)
+                        swt = -swt;
+                    /* The sum of cos^2(w(t - tau)) */
+                    den = 0.5 * numpts + hc2wt * c2 + hs2wt * s2;
+                    ct = cwt * yc + swt * ys;
+                    st = cwt * ys - swt * yc;
+                    if (den > 0.0)
+                        lspow += ct * ct / den;
+                    if (numpts - den > 0.0)
+                        lspow += st * st / (numpts - den);
+                    outpows[ii] = 0.5 * lspow / var;
+                }
+            }
+        }
+        vect_free(dgrid);
+        if (wgrid)
+            vect_free(wgrid);
+    }
+    fftwf_destroy_plan(plan);
+    if (ydata)
+        vect_free(ydata);
+    return powers;
+}
+
+
+lscand *ls_search(float *powers, long klo, long numf, long numfund,
+                  double df, double ofac, int numharm, float sigma,
+                  int *numcands)
+/* Search the periodogram 'powers' (at the frequencies (klo + i) *  */
+/* df for i < numf, oversampled by 'ofac') for signals with their   */
+/* fundamentals in the first 'numfund' bins.  Sums of 1, 2, 4, ...  */
+/* 'numharm' harmonics are checked.  The local maxima with sigma >= */
+/* 'sigma' are clustered into candidates which are returned (sorted */
+/* by sigma) and their number placed in 'numcands'.                 */
+{
+    int ii, jj, harm, lastharm = 0, numhits = 0, maxhits = HITCHUNK, ncands = 0;
+    long kk, numsum = numfund;
+    float *sums;
+    lscand *hits, *cands;
+
+    sums = gen_fvect(numfund);
+    for (kk = 0; kk < numfund; kk++)
+        sums[kk] = 0.0;
+    hits = (lscand *) malloc(sizeof(lscand) * maxhits);
+
+    for (harm = 1; harm <= numharm; harm *= 2) {
+        double numindep, cutoff;
+
+        /* Add the new harmonics.  Only the fundamentals with all of */
+        /* their harmonics in the periodogram can be checked.        */
+        while (numsum > 0 && (klo + numsum - 1) * harm >= klo + numf)
+            numsum--;
+        if (numsum < 3)
+            break;
+#ifdef _OPENMP
+#pragma omp parallel for default(none) private(ii) \
+    shared(sums,powers,klo,numsum,harm,lastharm)
+#endif
+        for (kk = 0; kk < numsum; kk++)
+            for (ii = lastharm + 1; ii <= harm; ii++)
+                sums[kk] += powers[(klo + kk) * ii - klo];
+        lastharm = harm;
+
+        /* The number of independent frequencies (each harmonic sum */
+        /* decreases it since the harmonics are not independent)    */
+        numindep = numfund / ofac / harm;
+        if (numindep < 1.0)
+            numindep = 1.0;
+        cutoff = power_for_sigma(sigma, harm, numindep);
+
+#ifdef _OPENMP
+#pragma omp parallel for default(none) private(ii) \
+    shared(sums,powers,klo,numsum,harm,numindep,cutoff,df,hits,numhits,maxhits)
+#endif
+        for (kk = 1; kk < numsum - 1; kk++) {
+            if (sums[kk] < cutoff || sums[kk] < sums[kk - 1] || sums[kk] <= sums[kk + 1])
+                continue;
+#ifdef _OPENMP
+#pragma omp critical (ls_hits)
+#endif
+            {
+                if (numhits == maxhits) {
+                    maxhits += HITCHUNK;
+                    hits = (lscand *) realloc(hits, sizeof(lscand) * maxhits);
+                }
+                hits[numhits].freq = (klo + kk) * df;
+                hits[numhits].power = sums[kk];
+                hits[numhits].sigma = candidate_sigma(sums[kk], harm, numindep);
+                hits[numhits].numharm = harm;
+                for (ii = 0; ii < LS_MAXHARM; ii++)
+                    hits[numhits].harmpows[ii] = (ii < harm) ?
+                        powers[(klo + kk) * (ii + 1) - klo] : 0.0;
+                numhits++;
+            }
+        }
+    }
+    vect_free(sums);
+
+    /* Cluster the detections.  A detection is part of a stronger */
+    /* candidate if their frequencies differ by less than two     */
+    /* independent Fourier bins (i.e. 2 / T).                     */
+
+    qsort(hits, numhits, sizeof(lscand), compare_lscand_sigma);
+    cands = (lscand *) malloc(sizeof(lscand) * (numhits ? numhits : 1));
+    for (ii = 0; ii < numhits; ii++) {
+        for (jj = 0; jj < ncands; jj++)
+            if (fabs(hits[ii].freq - cands[jj].freq) < 2.0 * ofac * df)
+                break;
+        if (jj == ncands)
+            cands[ncands++] = hits[ii];
+    }
+    free(hits);
+    *numcands = ncands;
+    return cands;
+}
+
+#undef LS_CHUNKLEN
+#undef HITCHUNK
@@ -0,0 +1,320 @@
+#include "presto.h"
+#include "lombscargle.h"
+#include "lssearch_cmd.h"
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+static double *read_ls_events(char *filenm, int binary, int eventtype,
+                              infodata * idata, long *numevents)
+/* Read the events from 'filenm' (binary doubles if 'binary', or  */
+/* else text) and return them in seconds since the EPOCH of the   */
+/* '.inf' file 'idata'.  The events are in seconds (eventtype 0), */
+/* days (1) since that EPOCH, or MJDs (2).                        */
+{
+    long N = 0, maxN = 100000;
+    double *ts, dtmp;
+    char line[200];
+    FILE *infile;
+
+    if (binary) {
+        infile = chkfopen(filenm, "rb");
+        N = chkfilelen(infile, sizeof(double));
+        ts = (double *) malloc(sizeof(double) * (N ? N : 1));
+        chkfread(ts, sizeof(double), N, infile);
+    } else {
+        infile = chkfopen(filenm, "r");
+        ts = (double *) malloc(sizeof(double) * maxN);
+        while (fgets(line, sizeof(line), infile)) {
+            if (line[0] == '#' || sscanf(line, "%lf", &dtmp) != 1)
+                continue;
+            if (N == maxN) {
+                maxN *= 2;
+                ts = (double *) realloc(ts, sizeof(double) * maxN);
+            }
+            ts[N++] = dtmp;
+        }
+    }
+    fclose(infile);
+    if (eventtype == 1) {
+        for (maxN = 0; maxN < N; maxN++)
+            ts[maxN] *= SECPERDAY;
+    } else if (eventtype == 2) {
+        for (maxN = 0; maxN < N; maxN++)
+            ts[maxN] = ((ts[maxN] - idata->mjd_i) - idata->mjd_f) * SECPERDAY;
+    }
+    *numevents = N;
+    return ts;
+}
+
+
+static long read_ls_dat(char *filenm, infodata * idata, double toffset,
+                        int useonoff, double **times, float **data, long numpts)
+/* Append the samples of the '.dat' file 'filenm' that are within  */
+/* the on/off pairs of its '.inf' file 'idata' (or all of them if  */
+/* not 'useonoff') to '*times' and '*data' (which already have     */
+/* 'numpts' points).  Each file's mean is removed so that multiple */
+/* epochs with different baselines can be combined.  The times are */
+/* offset by 'toffset' seconds.  Returns the new number of points. */
+{
+    long ii, jj, numdata, lo, hi, numnew = 0;
+    float *fdata;
+    double avg = 0.0;
+    FILE *infile;
+
+    infile = chkfopen(filenm, "rb");
+    numdata = chkfilelen(infile, sizeof(float));
+    fdata = read_float_file(infile, 0, numdata);
+    fclose(infile);
+    *times = (double *) realloc(*times, sizeof(double) * (numpts + numdata));
+    *data = (float *) realloc(*data, sizeof(float) * (numpts + numdata));
+
+    for (ii = 0; ii < (useonoff ? idata->numonoff : 1); ii++) {
+        if (useonoff) {
+            lo = (long) idata->onoff[2 * ii];
+            hi = (long) idata->onoff[2 * ii + 1];
+            /* The final on/off pair of padded data is (N-1, N-1) */
+            if (ii > 0 && lo == hi && lo == (long) idata->N - 1)
+                continue;
+        } else {
+            lo = 0;
+            hi = numdata - 1;
+        }
+        if (hi > numdata - 1)
+            hi = numdata - 1;
+        for (jj = lo; jj <= hi; jj++) {
+            (*times)[numpts + numnew] = toffset + jj * idata->dt;
+            (*data)[numpts + numnew] = fdata[jj];
+            avg += fdata[jj];
+            numnew++;
+        }
+    }
+    vect_free(fdata);
+    if (numnew) {
+        avg /= numnew;
+        for (ii = numpts; ii < numpts + numnew; ii++)
+            (*data)[ii] -= avg;
+    }
+    printf("Read %ld of %ld points (%.1f s) from '%s'.\n",
+           numnew, numdata, numnew * idata->dt, filenm);
+    return numpts + numnew;
+}
+
+
+static void write_ls_cands(lscand * cands, int numcands, char *rootnm,
+                           infodata * idata, long numpts, double Tspan, double df)
+/* Write the candidates in text (root_LS) and binary fourierprops  */
+/* (root_LS.cand) formats.  The fourierprops file can be used with */
+/* prepfold's -accelfile and -accelcand options.                   */
+{
+    int ii, jj;
+    double T, r;
+    char *txtnm, *candnm;
+    FILE *txtfile, *candfile;
+    fourierprops props;
+
+    txtnm = (char *) calloc(strlen(rootnm) + 10, sizeof(char));
+    candnm = (char *) calloc(strlen(rootnm) + 10, sizeof(char));
+    sprintf(txtnm, "%s_LS", rootnm);
+    sprintf(candnm, "%s_LS.cand", rootnm);
+    /* The 'r's are Fourier bins of the first (or only) '.inf' file */
+    T = idata->N * idata->dt;
+
+    txtfile = chkfopen(txtnm, "w");
+    fprintf(txtfile, "# Lomb-Scargle candidates from '%s'\n", rootnm);
+    fprintf(txtfile, "# Number of bins in the time series    = %.0f\n", idata->N);
+    fprintf(txtfile, "# Width of each time series bin (sec)  = %.15g\n", idata->dt);
+    fprintf(txtfile, "# Dispersion measure (cm-3 pc)         = %.12g\n", idata->dm);
+    fprintf(txtfile, "# Number of points (or events) used    = %ld\n", numpts);
+    fprintf(txtfile, "# Time spanned by the points (sec)     = %.15g\n", Tspan);
+    fprintf(txtfile, "# Frequency step of the search (Hz)    = %.15g\n", df);
+    fprintf(txtfile, "#%5s  %6s  %9s  %7s  %14s  %13s  %14s\n",
+            "Cand", "Sigma", "Power", "NumHarm", "Period(ms)", "Freq(Hz)",
+            "FFT 'r'(bin)");
+    candfile = chkfopen(candnm, "wb");
+    memset(&props, 0, sizeof(fourierprops));
+    for (ii = 0; ii < numcands; ii++) {
+        r = cands[ii].freq * T;
+        fprintf(txtfile, "%6d  %6.2f  %9.2f  %7d  %14.8f  %13.9f  %14.3f\n",
+                ii + 1, cands[ii].sigma, cands[ii].power, cands[ii].numharm,
+                1000.0 / cands[ii].freq, cands[ii].freq, r);
+        props.r = r;
+        props.rerr = df * T;
+        props.pow = cands[ii].power;
+        props.rawpow = cands[ii].power;
+        props.sig = cands[ii].sigma;
+        props.locpow = 1.0;
+        chkfwrite(&props, sizeof(fourierprops), 1, candfile);
+    }
+    /* The powers of the individual harmonics (for sifting) */
+    fprintf(txtfile, "\n# Harmonic powers\n");
+    fprintf(txtfile, "#%5s  %4s  %9s  %13s\n", "Cand", "Harm", "Power", "Freq(Hz)");
+    for (ii = 0; ii < numcands; ii++)
+        for (jj = 0; jj < cands[ii].numharm; jj++)
+            fprintf(txtfile, "%6d  %4d  %9.2f  %13.9f\n", ii + 1, jj + 1,
+                    cands[ii].harmpows[jj], cands[ii].freq * (jj + 1));
+    fclose(txtfile);
+    fclose(candfile);
+    printf("Candidates in text format are in '%s'.\n", txtnm);
+    printf("Candidates in binary format are in '%s'.\n", candnm);
+    free(txtnm);
+    free(candnm);
+}
+
+
+int main(int argc, char *argv[])
+{
+    int ii, numcands = 0;
+    long numpts = 0, klo, kfhi, khi, numfund, numf;
+    double *times = NULL, tlo, thi, Tspan, df, fhi;
+    float *data = NULL, *powers;
+    char *rootnm, *suffix = NULL;
+    infodata idata;
+    lscand *cands;
+    Cmdline *cmd;
+
+    /* Call usage() if we have no command line arguments */
+
+    if (argc == 1) {
+        Program = argv[0];
+        printf("\n");
+        usage();
+        exit(0);
+    }
+
+    /* Parse the command line using the excellent program Clig */
+
+    cmd = parseCmdline(argc, argv);
+
+    if (cmd->ncpus > 1) {
+#ifdef _OPENMP
+        int maxcpus = omp_get_num_procs();
+        int openmp_numthreads = (cmd->ncpus <= maxcpus) ? cmd->ncpus : maxcpus;
+        // Make sure we are not dynamically setting the number of threads
+        omp_set_dynamic(0);
+        omp_set_num_threads(openmp_numthreads);
+        printf("Using %d threads with OpenMP\n\n", openmp_numthreads);
+#endif
+    } else {
+#ifdef _OPENMP
+        omp_set_num_threads(1); // Explicitly turn off OpenMP
+#endif
+    }
+
+#ifdef DEBUG
+    showOptionValues();
+#endif
+
+    printf("\n\n");
+    printf("        Lomb-Scargle Periodogram Periodicity Search\n\n");
+
+    if (cmd->numharm & (cmd->numharm - 1)) {
+        printf("\n-numharm (%d) must be a power-of-two!\n\n", cmd->numharm);
+        exit(1);
+    }
+    if (cmd->eventsP && cmd->argc > 1) {
+        printf("\nOnly a single event file can be searched!\n\n");
+        exit(1);
+    }
+
+    /* Read the data (with times relative to the first '.inf' file) */
+
+    split_root_suffix(cmd->argv[0], &rootnm, &suffix);
+    readinf(&idata, rootnm);
+    if (cmd->eventsP) {
+        int eventtype = cmd->daysP ? 1 : (cmd->mjdsP ? 2 : 0);
+
+        times = read_ls_events(cmd->argv[0], cmd->doubleP, eventtype, &idata, &numpts);
+        printf("Read %ld events from '%s'.\n", numpts, cmd->argv[0]);
+    } else {
+        for (ii = 0; ii < cmd->argc; ii++) {
+            infodata epochdata;
+            char *root, *suf;
+            double toffset;
+
+            if (!split_root_suffix(cmd->argv[ii], &root, &suf) ||
+                strcmp(suf, "dat") != 0) {
+                printf("\nInput file ('%s') must be a time series ('.dat')!\n\n",
+                       cmd->argv[ii]);
+                exit(1);
+            }
+            readinf(&epochdata, root);
+            toffset = ((epochdata.mjd_i - idata.mjd_i) +
+                       (epochdata.mjd_f - idata.mjd_f)) * SECPERDAY;
+            numpts = read_ls_dat(cmd->argv[ii], &epochdata, toffset, !cmd->noonoffP,
+                                 &times, &data, numpts);
+            free(root);
+            free(suf);
+        }
+    }
+    free(suffix);
+    if (numpts < 2) {
+        printf("\nThere are not enough points (%ld) to search!\n\n", numpts);
+        exit(1);
+    }
+
+    /* The frequencies to search */
+
+    tlo = thi = times[0];
+    for (numf = 1; numf < numpts; numf++) {
+        if (times[numf] < tlo)
+            tlo = times[numf];
+        if (times[numf] > thi)
+            thi = times[numf];
+    }
+    Tspan = thi - tlo;
+    if (Tspan <= 0.0) {
+        printf("\nThe points must span a non-zero time!\n\n");
+        exit(1);
+    }
+    df = 1.0 / (cmd->ofac * Tspan);
+    fhi = (cmd->fhiP) ? cmd->fhi : 0.5 / idata.dt;
+    if (!cmd->fhiP && idata.dt <= 0.0) {
+        printf("\nYou must specify -fhi since the '.inf' file has no sample time!\n\n");
+        exit(1);
+    }
+    klo = (long) ceil(cmd->flo / df);
+    if (klo < 1)
+        klo = 1;
+    kfhi = (long) floor(fhi / df);
+    numfund = kfhi - klo + 1;
+    if (numfund < 3) {
+        printf("\nThere are too few frequencies between %g and %g Hz to search!\n\n",
+               cmd->flo, fhi);
+        exit(1);
+    }
+    /* The harmonics are only summed up to the Nyquist frequency of */
+    /* time series (events don't have one)                          */
+    khi = kfhi * cmd->numharm;
+    if (!cmd->eventsP && khi > (long) floor(0.5 / idata.dt / df))
+        khi = (long) floor(0.5 / idata.dt / df);
+    numf = khi - klo + 1;
+    printf("Searching %g to %g Hz in steps of %.6g Hz (%ld frequencies) with\n"
+           "  harmonics up to %g Hz (%.1f MB of powers)...\n",
+           klo * df, kfhi * df, df, numfund, khi * df, numf * sizeof(float) / 1e6);
+
+    /* Do the search */
+
+    powers = ls_periodogram(times, data, numpts, df, klo, numf);
+    free(times);
+    if (data)
+        free(data);
+    cands = ls_search(powers, klo, numf, numfund, df, cmd->ofac, cmd->numharm,
+                      cmd->sigma, &numcands);
+    vect_free(powers);
+    if (numcands > cmd->numcands)
+        numcands = cmd->numcands;
+    printf("Found %d candidates with sigma >= %.1f.\n\n", numcands, cmd->sigma);
+    for (ii = 0; ii < numcands && ii < 10; ii++)
+        printf("  %3d:  f = %13.9f Hz  power = %8.2f  sigma = %6.2f  numharm = %d\n",
+               ii + 1, cands[ii].freq, cands[ii].power, cands[ii].sigma,
+               cands[ii].numharm);
+    if (numcands)
+        printf("\n");
+
+    write_ls_cands(cands, numcands, rootnm, &idata, numpts, Tspan, df);
+    printf("\nDone.\n\n");
+    free(cands);
+    free(rootnm);
+    return (0);
+}
@@ -1,31 +1,37 @@
+#include "presto.h"
+
 /*
  *  This Quickselect routine is based on the algorithm described in
  *  "Numerical recipies in C", Second Edition,
  *  Cambridge University Press, 1992, Section 8.5, ISBN 0-521-43108-5
  */
 
-/* Fast computation of the median of an array. */
-/* Note:  It messes up the order!              */
+/* Number of histogram bins used by hist_median() */
+#define MEDHISTBINS 1024
+/* Number of values sampled to bracket the median */
+#define MEDSAMPLELEN 4096
+/* Shorter arrays just use a quickselect of all of the values */
+#define MEDSELECTLEN 4096
 
 #define ELEM_SWAP(a,b) { register float t=(a);(a)=(b);(b)=t; }
 
-float median(float arr[], int n)
+float select_kth(float arr[], int n, int k)
+/* Return the 'k'th smallest (starting from 0) of the 'n' values  */
+/* in 'arr'.  Note:  It messes up the order!                      */
 {
     int low, high;
-    int median;
     int middle, ll, hh;
 
     low = 0;
     high = n - 1;
-    median = (low + high) / 2;
     for (;;) {
         if (high <= low)        /* One element only */
-            return arr[median];
+            return arr[k];
 
         if (high == low + 1) {  /* Two elements only */
             if (arr[low] > arr[high])
                 ELEM_SWAP(arr[low], arr[high]);
-            return arr[median];
+            return arr[k];
         }
 
         /* Find median of low, middle and high items; swap into position low */
@@ -61,11 +67,383 @@ float median(float arr[], int n)
         ELEM_SWAP(arr[low], arr[hh]);
 
         /* Re-set active partition */
-        if (hh <= median)
+        if (hh <= k)
             low = ll;
-        if (hh >= median)
+        if (hh >= k)
             high = hh - 1;
     }
 }
 
 #undef ELEM_SWAP
+
+
+static void sample_bracket(float arr[], int n, int k, float *lo, float *hi)
+/* Place the values in '*lo' and '*hi' that (very likely) bracket */
+/* the 'k'th smallest value of 'arr' from a sample of its values. */
+{
+    /* The rank of the median in the sample has a standard */
+    /* deviation of sqrt(MEDSAMPLELEN) / 2, so use 4 sigma */
+    int ii, klo, khi, margin = 2 * (int) sqrt(MEDSAMPLELEN);
+    float sample[MEDSAMPLELEN];
+    double stride = (double) n / MEDSAMPLELEN;
+
+    for (ii = 0; ii < MEDSAMPLELEN; ii++)
+        sample[ii] = arr[(long) (ii * stride)];
+    klo = (int) ((double) k / n * MEDSAMPLELEN) - margin;
+    khi = (int) ((double) k / n * MEDSAMPLELEN) + margin;
+    *lo = select_kth(sample, MEDSAMPLELEN, (klo < 0) ? 0 : klo);
+    *hi = select_kth(sample, MEDSAMPLELEN,
+                     (khi >= MEDSAMPLELEN) ? MEDSAMPLELEN - 1 : khi);
+}
+
+
+static float minmax(float arr[], int n, float *max)
+/* Return the minimum value of 'arr' and place the maximum in 'max' */
+{
+    int ii;
+    float min = arr[0];
+
+    *max = arr[0];
+    for (ii = 1; ii < n; ii++) {
+        min = (arr[ii] < min) ? arr[ii] : min;
+        *max = (arr[ii] > *max) ? arr[ii] : *max;
+    }
+    return min;
+}
+
+
+static int bracket_select(float arr[], int n, int k, float *result)
+/* Place the 'k'th smallest value of 'arr' in '*result' (without   */
+/* re-ordering 'arr') and return 1.  Only the values between a     */
+/* pair that bracket it (chosen from a sample of the values) are   */
+/* copied and a quickselect done on them.  If the bracket misses   */
+/* (which is unlikely) or holds too many values, 0 is returned.    */
+{
+    int ii, numbelow = 0, numin = 0, maxnumin = n / 8, found = 0;
+    float lo, hi, *tmp;
+
+    sample_bracket(arr, n, k, &lo, &hi);
+    tmp = gen_fvect(maxnumin + 1);
+    /* Branch-free so that the (random) comparisons don't */
+    /* cause branch mispredictions                        */
+    for (ii = 0; ii < n && numin < maxnumin; ii++) {
+        float val = arr[ii];
+
+        numbelow += (val < lo);
+        tmp[numin] = val;
+        numin += (val >= lo) & (val <= hi);
+    }
+    if (ii == n && k >= numbelow && k < numbelow + numin) {
+        *result = select_kth(tmp, numin, k - numbelow);
+        found = 1;
+    }
+    vect_free(tmp);
+    return found;
+}
+
+
+/* Fast computation of the median of an array. */
+/* Note:  It (may) mess up the order!          */
+
+float median(float arr[], int n)
+{
+    int k = (n - 1) / 2;
+    float med;
+
+    /* For long arrays, selecting from the values near the */
+    /* median is much faster than a full quickselect       */
+    if (n > MEDSELECTLEN && bracket_select(arr, n, k, &med))
+        return med;
+    return select_kth(arr, n, k);
+}
+
+
+float median_nocopy(float arr[], int n)
+/* Find the median of 'arr' (the same value as median()) without   */
+/* re-ordering it.  Instead of a copy of the full array, only the  */
+/* values between a pair that bracket the median (chosen from a    */
+/* sample of the values) are copied and a quickselect done on them. */
+{
+    int k = (n - 1) / 2;
+    float med, *tmp;
+
+    if (n > MEDSELECTLEN && bracket_select(arr, n, k, &med))
+        return med;
+    tmp = gen_fvect(n);
+    memcpy(tmp, arr, sizeof(float) * n);
+    med = select_kth(tmp, n, k);
+    vect_free(tmp);
+    return med;
+}
+
+
+static int hist_bin(float arr[], int n, int k, float *lo, float *hi)
+/* Histogram the values of 'arr' between '*lo' and '*hi'.  If the  */
+/* 'k'th smallest value is one of them, '*lo' and '*hi' become the */
+/* smallest and largest values in its bin and 1 is returned.       */
+/* Otherwise 0 is returned.                                        */
+{
+    int ii, bin, numbelow = 0, count[MEDHISTBINS];
+    float binlo[MEDHISTBINS], binhi[MEDHISTBINS];
+    float min = *lo, max = *hi;
+    double scale = (MEDHISTBINS - 1) / ((double) max - min);
+
+    for (ii = 0; ii < MEDHISTBINS; ii++) {
+        count[ii] = 0;
+        binlo[ii] = max;
+        binhi[ii] = min;
+    }
+    for (ii = 0; ii < n; ii++) {
+        if (arr[ii] < min) {
+            numbelow++;
+        } else if (arr[ii] <= max) {
+            bin = (int) ((arr[ii] - (double) min) * scale);
+            if (bin >= MEDHISTBINS)
+                bin = MEDHISTBINS - 1;
+            count[bin]++;
+            if (arr[ii] < binlo[bin])
+                binlo[bin] = arr[ii];
+            if (arr[ii] > binhi[bin])
+                binhi[bin] = arr[ii];
+        }
+    }
+    if (k < numbelow)
+        return 0;
+    for (bin = 0; bin < MEDHISTBINS; bin++) {
+        numbelow += count[bin];
+        if (numbelow > k) {
+            *lo = binlo[bin];
+            *hi = binhi[bin];
+            return 1;
+        }
+    }
+    return 0;
+}
+
+
+static int has_rank(float arr[], int n, int k, float val)
+/* Return 1 if 'val' is the 'k'th smallest value of 'arr' */
+{
+    int ii, numbelow = 0, numequal = 0;
+
+    for (ii = 0; ii < n; ii++) {
+        numbelow += (arr[ii] < val);
+        numequal += (arr[ii] == val);
+    }
+    return (k >= numbelow && k < numbelow + numequal);
+}
+
+
+float hist_median(float arr[], int n, float *maxerr)
+/* Return an approximate median of 'arr' from a histogram of its  */
+/* values (without copying or re-ordering them).  The true median */
+/* is within 'maxerr' of the returned value.                      */
+{
+    int k = (n - 1) / 2, found = 0;
+    float lo, hi;
+
+    if (n > MEDSELECTLEN) {
+        sample_bracket(arr, n, k, &lo, &hi);
+        /* Many equal values can make the bracket a single value */
+        if (lo == hi)
+            found = has_rank(arr, n, k, lo);
+        else
+            found = hist_bin(arr, n, k, &lo, &hi);
+    }
+    if (!found) {
+        lo = minmax(arr, n, &hi);
+        if (lo < hi)
+            hist_bin(arr, n, k, &lo, &hi);
+    }
+    *maxerr = 0.5 * (hi - lo);
+    return 0.5 * (lo + hi);
+}
+
+
+/* A running median of the last 'winlen' values.  The values are   */
+/* kept in a circular buffer and the buffer indices in two heaps:  */
+/* a max-heap of the smaller half of the values and a min-heap of  */
+/* the larger half.  'where' is the heap position of each value    */
+/* (>= 0 in 'lo' and < 0, as -(index + 1), in 'hi').               */
+struct RUNMED {
+    int winlen;        /* Number of values in the window   */
+    int numvals;       /* Number of values so far (<= winlen) */
+    int oldest;        /* Buffer index of the oldest value */
+    int numlo;         /* Number of values in 'lo'         */
+    int numhi;         /* Number of values in 'hi'         */
+    float *vals;       /* Circular buffer of the values    */
+    int *lo;           /* Max-heap of the smaller values   */
+    int *hi;           /* Min-heap of the larger values    */
+    int *where;        /* Heap positions of the values     */
+};
+
+/* Is the value at heap position a "better" than b?  The lo heap */
+/* has the largest value at the top and the hi heap the smallest */
+#define LO_BETTER(rm,a,b) ((rm)->vals[(rm)->lo[a]] > (rm)->vals[(rm)->lo[b]])
+#define HI_BETTER(rm,a,b) ((rm)->vals[(rm)->hi[a]] < (rm)->vals[(rm)->hi[b]])
+
+static void heap_swap(runmed * rm, int *heap, int a, int b, int islo)
+{
+    int tmp = heap[a];
+
+    heap[a] = heap[b];
+    heap[b] = tmp;
+    rm->where[heap[a]] = islo ? a : -(a + 1);
+    rm->where[heap[b]] = islo ? b : -(b + 1);
+}
+
+
+static void lo_sift(runmed * rm, int pos)
+/* Restore the order of the lo heap after a change at 'pos' */
+{
+    int child;
+
+    while (pos > 0 && LO_BETTER(rm, pos, (pos - 1) / 2)) {
+        heap_swap(rm, rm->lo, pos, (pos - 1) / 2, 1);
+        pos = (pos - 1) / 2;
+    }
+    while ((child = 2 * pos + 1) < rm->numlo) {
+        if (child + 1 < rm->numlo && LO_BETTER(rm, child + 1, child))
+            child++;
+        if (!LO_BETTER(rm, child, pos))
+            break;
+        heap_swap(rm, rm->lo, pos, child, 1);
+        pos = child;
+    }
+}
+
+
+static void hi_sift(runmed * rm, int pos)
+/* Restore the order of the hi heap after a change at 'pos' */
+{
+    int child;
+
+    while (pos > 0 && HI_BETTER(rm, pos, (pos - 1) / 2)) {
+        heap_swap(rm, rm->hi, pos, (pos - 1) / 2, 0);
+        pos = (pos - 1) / 2;
+    }
+    while ((child = 2 * pos + 1) < rm->numhi) {
+        if (child + 1 < rm->numhi && HI_BETTER(rm, child + 1, child))
+            child++;
+        if (!HI_BETTER(rm, child, pos))
+            break;
+        heap_swap(rm, rm->hi, pos, child, 0);
+        pos = child;
+    }
+}
+
+#undef LO_BETTER
+#undef HI_BETTER
+
+
+static void lo_push(runmed * rm, int index)
+{
+    rm->lo[rm->numlo] = index;
+    rm->where[index] = rm->numlo++;
+    lo_sift(rm, rm->numlo - 1);
+}
+
+
+static void hi_push(runmed * rm, int index)
+{
+    rm->hi[rm->numhi] = index;
+    rm->where[index] = -(rm->numhi++ + 1);
+    hi_sift(rm, rm->numhi - 1);
+}
+
+
+static int lo_pop(runmed * rm)
+/* Remove and return the (buffer index of the) top of the lo heap */
+{
+    int top = rm->lo[0];
+
+    rm->lo[0] = rm->lo[--rm->numlo];
+    rm->where[rm->lo[0]] = 0;
+    lo_sift(rm, 0);
+    return top;
+}
+
+
+static int hi_pop(runmed * rm)
+/* Remove and return the (buffer index of the) top of the hi heap */
+{
+    int top = rm->hi[0];
+
+    rm->hi[0] = rm->hi[--rm->numhi];
+    rm->where[rm->hi[0]] = -1;
+    hi_sift(rm, 0);
+    return top;
+}
+
+
+runmed *runmed_alloc(int winlen)
+/* Allocate a running median of the last 'winlen' values */
+{
+    runmed *rm = (runmed *) malloc(sizeof(runmed));
+
+    rm->winlen = winlen;
+    rm->numvals = rm->oldest = rm->numlo = rm->numhi = 0;
+    rm->vals = gen_fvect(winlen);
+    rm->lo = gen_ivect(winlen);
+    rm->hi = gen_ivect(winlen);
+    rm->where = gen_ivect(winlen);
+    return rm;
+}
+
+
+void runmed_free(runmed * rm)
+{
+    vect_free(rm->vals);
+    vect_free(rm->lo);
+    vect_free(rm->hi);
+    vect_free(rm->where);
+    free(rm);
+}
+
+
+float runmed_update(runmed * rm, float val)
+/* Add 'val' to the running median (replacing the oldest value */
+/* once there are 'winlen' of them) and return the median of   */
+/* the values (the same value as median() would return).       */
+{
+    int index = rm->oldest, pos;
+
+    rm->oldest = (rm->oldest + 1) % rm->winlen;
+    rm->vals[index] = val;
+    if (rm->numvals < rm->winlen) {
+        /* Still filling the window.  The lo heap has the extra */
+        /* value if there are an odd number of them.            */
+        rm->numvals++;
+        if (rm->numlo == 0 || val <= rm->vals[rm->lo[0]])
+            lo_push(rm, index);
+        else
+            hi_push(rm, index);
+        if (rm->numlo > (rm->numvals + 1) / 2)
+            hi_push(rm, lo_pop(rm));
+        else if (rm->numlo < (rm->numvals + 1) / 2)
+            lo_push(rm, hi_pop(rm));
+    } else {
+        /* Replace the oldest value in place */
+        pos = rm->where[index];
+        if (pos >= 0)
+            lo_sift(rm, pos);
+        else
+            hi_sift(rm, -pos - 1);
+        /* Only the new value can be out of order between the heaps */
+        if (rm->numhi && rm->vals[rm->lo[0]] > rm->vals[rm->hi[0]]) {
+            int tmp = rm->lo[0];
+
+            rm->lo[0] = rm->hi[0];
+            rm->hi[0] = tmp;
+            rm->where[rm->lo[0]] = 0;
+            rm->where[rm->hi[0]] = -1;
+            lo_sift(rm, 0);
+            hi_sift(rm, 0);
+        }
+    }
+    return rm->vals[rm->lo[0]];
+}
+
+#undef MEDHISTBINS
+#undef MEDSAMPLELEN
+#undef MEDSELECTLEN
@@ -0,0 +1,384 @@
+#include <time.h>
+#include <sys/stat.h>
+#include "accel.h"
+#include "mpi.h"
+
+// Use OpenMP
+#ifdef _OPENMP
+#include <omp.h>
+extern void set_openmp_numthreads(int numthreads);
+#endif
+
+/*
+ * Acceleration searches of many input files (e.g. the .fft or .dat
+ * files from all the DMs of a beam) using MPI.  It takes exactly the
+ * same options as accelsearch, which are applied to every file.
+ *
+ * Rank 0 hands out the files one at a time (largest first) to the
+ * other ranks as they finish their previous one, so that fast and
+ * slow files and nodes balance out.  The workers are long-lived, so
+ * the correlation kernels (and the FFTW plans and wisdom) are only
+ * made once as long as the search parameters stay the same.  Each
+ * worker writes the usual _ACCEL_ files for its inputs (and its
+ * screen output to 'mpiaccelsearch_rank<N>.log'), and sends a
+ * summary of each candidate back to rank 0, which writes all of them
+ * (in the order of the input files) to a single merged candidate list.
+ */
+
+#define TAG_READY 1
+#define TAG_CANDS 2
+#define TAG_WORK  3
+
+typedef struct accelsum {
+    double r;                   /* Optimized Fourier freq of the fundamental */
+    double z;                   /* Optimized Fourier f-dot of the fundamental */
+    double w;                   /* Optimized Fourier f-dot-dot of the fundamental */
+    double T;                   /* Duration of the observation (s) */
+    double dm;                  /* DM of the input file */
+    float sigma;                /* Significance of the candidate */
+    float power;                /* Summed power (normalized) */
+    int numharm;                /* Number of harmonics summed */
+} accelsum;
+
+static MPI_Datatype accelsum_type;
+static int myid = 0, numprocs = 1;
+
+
+static void make_accelsum_struct(void)
+{
+    int blockcounts[3] = { 5, 2, 1 };
+    MPI_Datatype types[3] = { MPI_DOUBLE, MPI_FLOAT, MPI_INT };
+    MPI_Aint displs[3];
+    MPI_Datatype tmptype;
+    accelsum sum;
+
+    MPI_Get_address(&sum.r, &displs[0]);
+    MPI_Get_address(&sum.sigma, &displs[1]);
+    MPI_Get_address(&sum.numharm, &displs[2]);
+    displs[2] -= displs[0];
+    displs[1] -= displs[0];
+    displs[0] = 0;
+    MPI_Type_create_struct(3, blockcounts, displs, types, &tmptype);
+    // Make sure arrays of them are padded like the C struct
+    MPI_Type_create_resized(tmptype, 0, sizeof(accelsum), &accelsum_type);
+    MPI_Type_free(&tmptype);
+    MPI_Type_commit(&accelsum_type);
+}
+
+
+static int search_file(char *filenm, Cmdline * cmd, subharminfo *** shis,
+                       accelobs * kernobs, accelsum ** sums)
+/* Do a normal accelsearch of 'filenm' re-using the kernels in   */
+/* '*shis' (made for 'kernobs') if they are the right ones.      */
+/* Return the number of candidates (summarized in '*sums').      */
+{
+    int ii, numcands;
+    char *infile[1];
+    accelobs obs;
+    infodata idata;
+    GSList *cands = NULL, *listptr;
+    accelcand *cand;
+
+    // create_accelobs() reads the input file name from the command line
+    infile[0] = filenm;
+    cmd->argv = infile;
+    cmd->argc = 1;
+    create_accelobs(&obs, &idata, cmd, 1);
+    cmd->argv = NULL;
+    cmd->argc = 0;
+
+    zap_accel_birdies(&obs, cmd);
+
+    if (obs.numseg > 1) {
+        cands = stackslide_search(&obs, cands);
+    } else {
+        if (*shis && !same_subharminfos(kernobs, &obs)) {
+            free_subharminfos(kernobs, *shis);
+            *shis = NULL;
+        }
+        if (*shis == NULL) {
+            printf("\nGenerating correlation kernels:\n");
+            *shis = create_subharminfos(&obs);
+            printf("Done generating kernels.\n\n");
+            // Only the search parameters are used from now on
+            *kernobs = obs;
+        } else {
+            printf("\nRe-using the correlation kernels.\n\n");
+        }
+        cands = search_accelobs(&obs, *shis, cmd, cands);
+    }
+
+    printf("\n\nDone searching.  Now optimizing each candidate.\n\n");
+    numcands = output_accelobs_cands(&cands, &obs, &idata, cmd);
+
+    *sums = (accelsum *) malloc(sizeof(accelsum) * (numcands ? numcands : 1));
+    listptr = cands;
+    for (ii = 0; ii < numcands; ii++) {
+        cand = (accelcand *) (listptr->data);
+        (*sums)[ii].r = cand->r;
+        (*sums)[ii].z = cand->z;
+        (*sums)[ii].w = cand->w;
+        (*sums)[ii].T = obs.T;
+        (*sums)[ii].dm = idata.dm;
+        (*sums)[ii].sigma = cand->sigma;
+        (*sums)[ii].power = cand->power;
+        (*sums)[ii].numharm = cand->numharm;
+        listptr = listptr->next;
+    }
+    printf("Finished '%s' with %d candidates.\n\n", filenm, numcands);
+    fflush(stdout);
+
+    free_accelobs(&obs);
+    g_slist_foreach(cands, free_accelcand, NULL);
+    g_slist_free(cands);
+    return numcands;
+}
+
+
+static int *sort_by_size(char **filenms, int numfiles)
+/* Return the file indices in the order of decreasing file size */
+{
+    int ii, jj, tmp, *order;
+    long long *sizes;
+    struct stat st;
+
+    order = gen_ivect(numfiles);
+    sizes = (long long *) malloc(sizeof(long long) * numfiles);
+    for (ii = 0; ii < numfiles; ii++) {
+        order[ii] = ii;
+        sizes[ii] = (stat(filenms[ii], &st) == 0) ? (long long) st.st_size : 0;
+    }
+    // Insertion sort is stable, so equal sizes keep the input order
+    for (ii = 1; ii < numfiles; ii++) {
+        tmp = order[ii];
+        for (jj = ii; jj > 0 && sizes[order[jj - 1]] < sizes[tmp]; jj--)
+            order[jj] = order[jj - 1];
+        order[jj] = tmp;
+    }
+    free(sizes);
+    return order;
+}
+
+
+static void write_merged_cands(char *outfilenm, char **filenms, int numfiles,
+                               int *numcands, accelsum ** sums)
+{
+    int ii, jj;
+    double f, fd;
+    FILE *outfile;
+    accelsum *s;
+
+    outfile = chkfopen(outfilenm, "w");
+    fprintf(outfile,
+            "# %-30s %5s %7s %9s %4s %9s %16s %13s %13s %14s %12s %10s %10s\n",
+            "File", "Cand", "Sigma", "Power", "Harm", "DM", "Freq(Hz)",
+            "Fdot(Hz/s)", "Fdotdot", "Period(ms)", "r", "z", "w");
+    for (ii = 0; ii < numfiles; ii++) {
+        for (jj = 0; jj < numcands[ii]; jj++) {
+            s = sums[ii] + jj;
+            f = s->r / s->T;
+            fd = s->z / (s->T * s->T);
+            fprintf(outfile,
+                    "  %-30s %5d %7.2f %9.2f %4d %9.3f %16.10f %13.5g %13.5g %14.8f %12.2f %10.2f %10.2f\n",
+                    filenms[ii], jj + 1, s->sigma, s->power, s->numharm, s->dm, f,
+                    fd, s->w / (s->T * s->T * s->T), 1000.0 / f, s->r, s->z, s->w);
+        }
+    }
+    fclose(outfile);
+}
+
+
+static void wait_for_ready(MPI_Status * status)
+/* Wait (without spinning, so that rank 0 can share a CPU with a */
+/* worker) until a worker is ready for more work                 */
+{
+    int flag = 0;
+    struct timespec ts = { 0, 10000000 };
+
+    while (1) {
+        MPI_Iprobe(MPI_ANY_SOURCE, TAG_READY, MPI_COMM_WORLD, &flag, status);
+        if (flag)
+            return;
+        nanosleep(&ts, NULL);
+    }
+}
+
+
+int main(int argc, char *argv[])
+{
+    int ii, numfiles, *numcands, *order;
+    char **filenms, outfilenm[200], logfilenm[100];
+    double starttime, *starts, *times, tottime = 0.0;
+    subharminfo **shis = NULL;
+    accelobs kernobs;
+    accelsum **sums;
+    Cmdline *cmd;
+
+    MPI_Init(&argc, &argv);
+    MPI_Comm_size(MPI_COMM_WORLD, &numprocs);
+    MPI_Comm_rank(MPI_COMM_WORLD, &myid);
+
+    /* Call usage() if we have no command line arguments */
+
+    if (argc == 1) {
+        if (myid == 0) {
+            Program = argv[0];
+            printf("\n");
+            usage();
+        }
+        MPI_Finalize();
+        exit(1);
+    }
+
+    /* Parse the command line using the excellent program Clig */
+
+    cmd = parseCmdline(argc, argv);
+    filenms = cmd->argv;
+    numfiles = cmd->argc;
+
+    if (cmd->winlenP) {
+        if (myid == 0)
+            printf("\nThe windowed search ('-winlen') is only done by 'accelsearch'.\n\n");
+        MPI_Finalize();
+        exit(1);
+    }
+
+    if (myid == 0) {
+        printf("\n\n");
+        printf("   Fourier-Domain Acceleration and Jerk Searches using MPI\n");
+        printf("                    by Scott M. Ransom\n\n");
+        printf("Searching %d files using %d worker process(es).\n\n", numfiles,
+               numprocs > 1 ? numprocs - 1 : 1);
+        fflush(stdout);
+    }
+
+    if (cmd->ncpus > 1) {
+#ifdef _OPENMP
+        set_openmp_numthreads(cmd->ncpus);
+#endif
+    } else {
+#ifdef _OPENMP
+        omp_set_num_threads(1); // Explicitly turn off OpenMP
+#endif
+    }
+    make_accelsum_struct();
+
+    if (myid > 0) {
+        /* The workers */
+        int msg[2] = { -1, 0 }, filenum;
+        accelsum *mysums = NULL;
+
+        sprintf(logfilenm, "mpiaccelsearch_rank%d.log", myid);
+        if (freopen(logfilenm, "w", stdout) == NULL)
+            presto_perror(PRESTO_ERR_IO, "cannot open '%s'", logfilenm);
+        while (1) {
+            // Report the last results (if any) and ask for more work
+            MPI_Send(msg, 2, MPI_INT, 0, TAG_READY, MPI_COMM_WORLD);
+            if (msg[1])
+                MPI_Send(mysums, msg[1], accelsum_type, 0, TAG_CANDS, MPI_COMM_WORLD);
+            if (mysums)
+                free(mysums);
+            mysums = NULL;
+            MPI_Recv(&filenum, 1, MPI_INT, 0, TAG_WORK, MPI_COMM_WORLD,
+                     MPI_STATUS_IGNORE);
+            if (filenum < 0)
+                break;
+            msg[0] = filenum;
+            msg[1] = search_file(filenms[filenum], cmd, &shis, &kernobs, &mysums);
+        }
+        if (shis)
+            free_subharminfos(&kernobs, shis);
+        MPI_Type_free(&accelsum_type);
+        MPI_Finalize();
+        return (0);
+    }
+
+    /* The master */
+
+    starttime = MPI_Wtime();
+    numcands = gen_ivect(numfiles);
+    starts = gen_dvect(numfiles);
+    times = gen_dvect(numfiles);
+    sums = (accelsum **) calloc(numfiles, sizeof(accelsum *));
+    order = sort_by_size(filenms, numfiles);
+    if (numprocs == 1) {
+        // No workers, so do it all here
+        for (ii = 0; ii < numfiles; ii++) {
+            starts[ii] = MPI_Wtime();
+            numcands[ii] = search_file(filenms[ii], cmd, &shis, &kernobs, sums + ii);
+            times[ii] = MPI_Wtime() - starts[ii];
+        }
+        if (shis)
+            free_subharminfos(&kernobs, shis);
+    } else {
+        int msg[2], filenum, worker, nextfile = 0, numworking = numprocs - 1;
+        MPI_Status status;
+
+        while (numworking) {
+            wait_for_ready(&status);
+            worker = status.MPI_SOURCE;
+            MPI_Recv(msg, 2, MPI_INT, worker, TAG_READY, MPI_COMM_WORLD,
+                     MPI_STATUS_IGNORE);
+            if (msg[0] >= 0) {
+                filenum = msg[0];
+                numcands[filenum] = msg[1];
+                sums[filenum] = (accelsum *) malloc(sizeof(accelsum) *
+                                                    (msg[1] ? msg[1] : 1));
+                if (msg[1])
+                    MPI_Recv(sums[filenum], msg[1], accelsum_type, worker, TAG_CANDS,
+                             MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+                times[filenum] = MPI_Wtime() - starts[filenum];
+                printf("  '%s':  %d candidates  (rank %d, %.1f s)\n",
+                       filenms[filenum], msg[1], worker, times[filenum]);
+                fflush(stdout);
+            }
+            if (nextfile < numfiles) {
+                filenum = order[nextfile++];
+                starts[filenum] = MPI_Wtime();
+                MPI_Send(&filenum, 1, MPI_INT, worker, TAG_WORK, MPI_COMM_WORLD);
+            } else {
+                filenum = -1;
+                MPI_Send(&filenum, 1, MPI_INT, worker, TAG_WORK, MPI_COMM_WORLD);
+                numworking--;
+            }
+        }
+    }
+
+    /* Write the merged candidate list */
+
+    if (cmd->wmaxP && cmd->wmax)
+        sprintf(outfilenm, "mpiaccelsearch_ACCEL_%d_JERK_%d", cmd->zmax, cmd->wmax);
+    else
+        sprintf(outfilenm, "mpiaccelsearch_ACCEL_%d", cmd->zmax);
+    write_merged_cands(outfilenm, filenms, numfiles, numcands, sums);
+
+    {
+        int totcands = 0;
+        double walltime;
+
+        for (ii = 0; ii < numfiles; ii++) {
+            totcands += numcands[ii];
+            tottime += times[ii];
+        }
+        printf("\nFound %d candidates in %d files.\n", totcands, numfiles);
+        printf("Merged candidate list is in '%s'.\n", outfilenm);
+        if (numprocs > 1)
+            printf("Per-file outputs of the workers are in 'mpiaccelsearch_rank<N>.log'.\n");
+        walltime = MPI_Wtime() - starttime;
+        printf("\nTiming summary:\n");
+        printf("  Total time: %.3f sec for %.3f sec of searches (%.2fx)\n\n",
+               walltime, tottime, walltime > 0.0 ? tottime / walltime : 0.0);
+    }
+
+    for (ii = 0; ii < numfiles; ii++)
+        if (sums[ii])
+            free(sums[ii]);
+    free(sums);
+    vect_free(numcands);
+    vect_free(starts);
+    vect_free(times);
+    vect_free(order);
+    MPI_Type_free(&accelsum_type);
+    MPI_Finalize();
+    return (0);
+}
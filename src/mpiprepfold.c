@@ -0,0 +1,277 @@
+#include <ctype.h>
+#include <time.h>
+#include <sys/wait.h>
+#include "presto.h"
+#include "mpi.h"
+
+/*
+ * Fold many candidates with prepfold using MPI.  The input is a text
+ * file with the prepfold options for one candidate per line, e.g.:
+ *
+ *   -noxwin -accelcand 2 -accelfile DM10.00_ACCEL_50.cand DM10.00.dat
+ *   -noxwin -nosearch -p 0.0331 -dm 56.8 -o B0531+21 raw.fil
+ *
+ * Blank lines and lines starting with '#' are skipped.  Rank 0 hands
+ * out the lines one at a time to the other ranks as they finish their
+ * previous one.  prepfold keeps most of its state in globals (and
+ * exits on errors), so each fold is a separate prepfold process that
+ * the worker runs, but the workers are long-lived so that the folds
+ * are balanced across the nodes.  The output of each fold is sent
+ * back to rank 0, which prints them in the order of the input file
+ * (no matter which worker did them or when they finished).
+ */
+
+#define TAG_READY  1
+#define TAG_OUTPUT 2
+#define TAG_WORK   3
+
+static int myid = 0, numprocs = 1;
+
+
+static void usage(void)
+{
+    printf("\nUsage:  mpirun -np N mpiprepfold [-prepfold program] foldfile\n\n"
+           "   -prepfold program   The prepfold to run (default 'prepfold')\n"
+           "   foldfile            Text file with the prepfold options for one\n"
+           "                       candidate per line\n\n");
+}
+
+
+static char **read_foldfile(char *filenm, int *numfolds)
+/* Read the non-blank, non-comment lines of 'filenm' */
+{
+    int maxfolds = 100;
+    char line[10000], *ptr, **folds;
+    FILE *infile;
+
+    infile = chkfopen(filenm, "r");
+    folds = (char **) malloc(sizeof(char *) * maxfolds);
+    *numfolds = 0;
+    while (fgets(line, sizeof(line), infile)) {
+        if (strlen(line) == sizeof(line) - 1 && line[sizeof(line) - 2] != '\n')
+            presto_error(PRESTO_ERR_FORMAT, "line %d of '%s' is too long",
+                         *numfolds + 1, filenm);
+        ptr = line;
+        while (isspace((unsigned char) *ptr))
+            ptr++;
+        if (*ptr == '\0' || *ptr == '#')
+            continue;
+        ptr[strcspn(ptr, "\r\n")] = '\0';
+        if (*numfolds == maxfolds) {
+            maxfolds *= 2;
+            folds = (char **) realloc(folds, sizeof(char *) * maxfolds);
+        }
+        folds[(*numfolds)++] = strdup(ptr);
+    }
+    fclose(infile);
+    return folds;
+}
+
+
+static char *run_fold(char *prepfold, char *args, int *status, int *outlen)
+/* Run 'prepfold args' and return its (stdout and stderr) output */
+{
+    int maxlen = 10000, numread;
+    char *command, *output;
+    FILE *pipe;
+
+    command = (char *) malloc(strlen(prepfold) + strlen(args) + 20);
+    sprintf(command, "%s %s 2>&1", prepfold, args);
+    output = (char *) malloc(maxlen);
+    *outlen = 0;
+    if ((pipe = popen(command, "r")) == NULL) {
+        *outlen = sprintf(output, "Error:  cannot run '%s'\n", command);
+        *status = -1;
+        free(command);
+        return output;
+    }
+    while ((numread = fread(output + *outlen, 1, maxlen - *outlen, pipe)) > 0) {
+        *outlen += numread;
+        if (*outlen == maxlen) {
+            maxlen *= 2;
+            output = (char *) realloc(output, maxlen);
+        }
+    }
+    *status = pclose(pipe);
+    if (*status != -1 && WIFEXITED(*status))
+        *status = WEXITSTATUS(*status);
+    free(command);
+    return output;
+}
+
+
+static void print_fold(char *prepfold, int foldnum, char **folds, char *output,
+                       int outlen, int status, int worker, double time)
+{
+    printf("\n'%s %s'\n", prepfold, folds[foldnum]);
+    fwrite(output, 1, outlen, stdout);
+    if (status)
+        printf("Warning:  fold %d failed with status %d\n", foldnum + 1, status);
+    printf("[fold %d done by rank %d in %.1f s]\n", foldnum + 1, worker, time);
+    fflush(stdout);
+}
+
+
+static void wait_for_ready(MPI_Status * status)
+/* Wait (without spinning, so that rank 0 can share a CPU with a */
+/* worker) until a worker is ready for more work                 */
+{
+    int flag = 0;
+    struct timespec ts = { 0, 10000000 };
+
+    while (1) {
+        MPI_Iprobe(MPI_ANY_SOURCE, TAG_READY, MPI_COMM_WORLD, &flag, status);
+        if (flag)
+            return;
+        nanosleep(&ts, NULL);
+    }
+}
+
+
+int main(int argc, char *argv[])
+{
+    int ii, numfolds = 0, numfailed = 0;
+    char *prepfold = "prepfold", **folds = NULL;
+
+    MPI_Init(&argc, &argv);
+    MPI_Comm_size(MPI_COMM_WORLD, &numprocs);
+    MPI_Comm_rank(MPI_COMM_WORLD, &myid);
+
+    if (argc == 4 && strcmp(argv[1], "-prepfold") == 0) {
+        prepfold = argv[2];
+    } else if (argc != 2 || argv[1][0] == '-') {
+        if (myid == 0)
+            usage();
+        MPI_Finalize();
+        exit(1);
+    }
+
+    if (myid > 0) {
+        /* The workers */
+        int msg[3] = { -1, 0, 0 }, foldnum;
+        char *output = NULL, *args;
+
+        while (1) {
+            // Report the last fold (if any) and ask for more work
+            MPI_Send(msg, 3, MPI_INT, 0, TAG_READY, MPI_COMM_WORLD);
+            if (msg[2])
+                MPI_Send(output, msg[2], MPI_CHAR, 0, TAG_OUTPUT, MPI_COMM_WORLD);
+            if (output)
+                free(output);
+            output = NULL;
+            MPI_Recv(&foldnum, 1, MPI_INT, 0, TAG_WORK, MPI_COMM_WORLD,
+                     MPI_STATUS_IGNORE);
+            if (foldnum < 0)
+                break;
+            // Then the options for the fold
+            MPI_Recv(msg, 1, MPI_INT, 0, TAG_WORK, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+            args = (char *) malloc(msg[0] + 1);
+            MPI_Recv(args, msg[0] + 1, MPI_CHAR, 0, TAG_WORK, MPI_COMM_WORLD,
+                     MPI_STATUS_IGNORE);
+            msg[0] = foldnum;
+            output = run_fold(prepfold, args, &msg[1], &msg[2]);
+            free(args);
+        }
+        MPI_Finalize();
+        return (0);
+    }
+
+    /* The master */
+
+    {
+        int *statuses, *workers, *outlens, nextprint = 0;
+        char **outputs;
+        double starttime, *starts, *times;
+
+        folds = read_foldfile(argv[argc - 1], &numfolds);
+        printf("\n\n");
+        printf("          Folding %d candidates with prepfold using MPI\n\n", numfolds);
+        fflush(stdout);
+        starttime = MPI_Wtime();
+        statuses = gen_ivect(numfolds + 1);
+        workers = gen_ivect(numfolds + 1);
+        outlens = gen_ivect(numfolds + 1);
+        starts = gen_dvect(numfolds + 1);
+        times = gen_dvect(numfolds + 1);
+        outputs = (char **) calloc(numfolds + 1, sizeof(char *));
+
+        if (numprocs == 1) {
+            // No workers, so do them all here
+            for (ii = 0; ii < numfolds; ii++) {
+                starts[ii] = MPI_Wtime();
+                outputs[ii] = run_fold(prepfold, folds[ii], statuses + ii, outlens + ii);
+                times[ii] = MPI_Wtime() - starts[ii];
+                print_fold(prepfold, ii, folds, outputs[ii], outlens[ii],
+                           statuses[ii], 0, times[ii]);
+                free(outputs[ii]);
+                if (statuses[ii])
+                    numfailed++;
+            }
+        } else {
+            int msg[3], foldnum, worker, nextfold = 0, numworking = numprocs - 1;
+            MPI_Status status;
+
+            while (numworking) {
+                wait_for_ready(&status);
+                worker = status.MPI_SOURCE;
+                MPI_Recv(msg, 3, MPI_INT, worker, TAG_READY, MPI_COMM_WORLD,
+                         MPI_STATUS_IGNORE);
+                if (msg[0] >= 0) {
+                    foldnum = msg[0];
+                    statuses[foldnum] = msg[1];
+                    outlens[foldnum] = msg[2];
+                    outputs[foldnum] = (char *) malloc(msg[2] + 1);
+                    if (msg[2])
+                        MPI_Recv(outputs[foldnum], msg[2], MPI_CHAR, worker, TAG_OUTPUT,
+                                 MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+                    times[foldnum] = MPI_Wtime() - starts[foldnum];
+                    if (msg[1])
+                        numfailed++;
+                    // Print all of the folds that are now in order
+                    while (nextprint < numfolds && outputs[nextprint]) {
+                        print_fold(prepfold, nextprint, folds, outputs[nextprint],
+                                   outlens[nextprint], statuses[nextprint],
+                                   workers[nextprint], times[nextprint]);
+                        free(outputs[nextprint]);
+                        outputs[nextprint++] = NULL;
+                    }
+                }
+                if (nextfold < numfolds) {
+                    foldnum = nextfold++;
+                    starts[foldnum] = MPI_Wtime();
+                    workers[foldnum] = worker;
+                    msg[0] = strlen(folds[foldnum]);
+                    MPI_Send(&foldnum, 1, MPI_INT, worker, TAG_WORK, MPI_COMM_WORLD);
+                    MPI_Send(msg, 1, MPI_INT, worker, TAG_WORK, MPI_COMM_WORLD);
+                    MPI_Send(folds[foldnum], msg[0] + 1, MPI_CHAR, worker, TAG_WORK,
+                             MPI_COMM_WORLD);
+                } else {
+                    foldnum = -1;
+                    MPI_Send(&foldnum, 1, MPI_INT, worker, TAG_WORK, MPI_COMM_WORLD);
+                    numworking--;
+                }
+            }
+        }
+
+        {
+            double tottime = 0.0, walltime = MPI_Wtime() - starttime;
+
+            for (ii = 0; ii < numfolds; ii++)
+                tottime += times[ii];
+            printf("\nFolded %d candidates (%d failed).\n", numfolds, numfailed);
+            printf("  Total time: %.3f sec for %.3f sec of folds (%.2fx)\n\n",
+                   walltime, tottime, walltime > 0.0 ? tottime / walltime : 0.0);
+        }
+        for (ii = 0; ii < numfolds; ii++)
+            free(folds[ii]);
+        free(folds);
+        free(outputs);
+        vect_free(statuses);
+        vect_free(workers);
+        vect_free(outlens);
+        vect_free(starts);
+        vect_free(times);
+    }
+    MPI_Finalize();
+    return (numfailed ? 1 : 0);
+}
@@ -812,9 +812,8 @@ int clip_PKMB_times(unsigned char *rawdata, int ptsperblk, int numchan,
         powptr = rawdata + ii * numchan;
         for (jj = 0; jj < numchan; jj++)
             zero_dm_block[ii] += *powptr++;
-        median_temp[ii] = zero_dm_block[ii];
     }
-    current_med = median(median_temp, ptsperblk);
+    current_med = median_nocopy(zero_dm_block, ptsperblk);
 
     /* Calculate the current standard deviation and mean  */
     /* but only for data points that are within a certain */
@@ -222,3 +222,157 @@ double lin_interp_E(double *E, double currenttime, double to, double dt, double
     dtemp = E[ipart];
     return (fpart * (E[ipart + 1] - dtemp)) + dtemp;
 }
+
+
+void keplers_eqn_grid(double *E, long numpts, double to, double dt,
+                      orbitparams * orb, double Eacc)
+/* Solve Kepler's Equation for the eccentric anomalys (*E) at the     */
+/* 'numpts' evenly spaced times t = to + ii * dt (sec since the start */
+/* of the data, so orb->t is added to get the time since periapsis).  */
+/* All the points are iterated together with Newton-Raphson (using    */
+/* Danby's starting values) so the loops vectorize.                   */
+{
+    long ii;
+    int iter;
+    double *M, e, twopif, maxdE, dE;
+
+    e = orb->e;
+    twopif = TWOPI / orb->p;
+    M = gen_dvect(numpts);
+    for (ii = 0; ii < numpts; ii++) {
+        M[ii] = twopif * fmod(orb->t + to + ii * dt, orb->p);
+        if (M[ii] < 0.0)
+            M[ii] += TWOPI;
+        E[ii] = M[ii] + ((M[ii] < PI) ? 0.85 * e : -0.85 * e);
+    }
+    for (iter = 0; iter < 50; iter++) {
+        maxdE = 0.0;
+        for (ii = 0; ii < numpts; ii++) {
+            dE = (E[ii] - e * sin(E[ii]) - M[ii]) / (1.0 - e * cos(E[ii]));
+            E[ii] -= dE;
+            dE = fabs(dE);
+            maxdE = (dE > maxdE) ? dE : maxdE;
+        }
+        if (maxdE < Eacc)
+            break;
+    }
+    vect_free(M);
+}
+
+
+double cubic_interp_grid(double *y, long numpts, double x)
+/* Return the 4-point (cubic) Lagrange interpolation of the evenly  */
+/* tabulated vector *y at the fractional index 'x'.  Points outside */
+/* of the table are extrapolated from the nearest 4 points.         */
+{
+    long ii;
+    double f, fm1, fm2, fp1;
+
+    if (numpts < 4) {
+        ii = (x < 0.0) ? 0 : (long) x;
+        if (ii > numpts - 2)
+            ii = numpts - 2;
+        if (ii < 0)
+            return y[0];
+        return y[ii] + (x - ii) * (y[ii + 1] - y[ii]);
+    }
+    ii = (long) floor(x);
+    if (ii < 1)
+        ii = 1;
+    else if (ii > numpts - 3)
+        ii = numpts - 3;
+    f = x - ii;
+    fm1 = f - 1.0;
+    fm2 = f - 2.0;
+    fp1 = f + 1.0;
+    return (fp1 * f * fm1 * y[ii + 2] - f * fm1 * fm2 * y[ii - 1] +
+            3.0 * fp1 * fm2 * (fm1 * y[ii] - f * y[ii + 1])) / 6.0;
+}
+
+
+/* The number of delay grids that get_bindelays() remembers */
+#define NUMBINDELAYS 4
+
+static bindelays bdcache[NUMBINDELAYS];
+static int bdlastused[NUMBINDELAYS] = { 0, 0, 0, 0 };
+static int bdcount = 0;
+
+static int same_bindelays(bindelays * bd, orbitparams * orb,
+                          double to, double dt, long numpts)
+{
+    return (bd->delays != NULL &&
+            bd->orb.p == orb->p && bd->orb.e == orb->e &&
+            bd->orb.x == orb->x && bd->orb.w == orb->w &&
+            bd->orb.t == orb->t && bd->orb.pd == orb->pd &&
+            bd->orb.wd == orb->wd && bd->to == to &&
+            bd->dt == dt && bd->numpts == numpts);
+}
+
+
+bindelays *get_bindelays(orbitparams * orb, double to, double dt, long numpts)
+/* Return the orbital (Roemer) delays of a binary pulsar on the grid */
+/* of times t = to + ii * dt (sec since the start of the data).  The */
+/* grids are cached using the orbital parameters and times as keys,  */
+/* so repeated calls (from many threads or subbands, or during       */
+/* searches over orbital trials) are essentially free.  The result   */
+/* belongs to the cache and stays valid until NUMBINDELAYS other     */
+/* grids have been requested or free_bindelays_cache() is called.    */
+{
+    int ii, slot = -1;
+    bindelays *bd;
+
+#ifdef _OPENMP
+#pragma omp critical (bindelays_cache)
+#endif
+    {
+        for (ii = 0; ii < NUMBINDELAYS; ii++) {
+            if (same_bindelays(bdcache + ii, orb, to, dt, numpts)) {
+                slot = ii;
+                break;
+            }
+        }
+        if (slot < 0) {
+            /* Replace the least recently used grid */
+            slot = 0;
+            for (ii = 1; ii < NUMBINDELAYS; ii++)
+                if (bdlastused[ii] < bdlastused[slot])
+                    slot = ii;
+            bd = bdcache + slot;
+            if (bd->delays)
+                vect_free(bd->delays);
+            bd->orb = *orb;
+            bd->to = to;
+            bd->dt = dt;
+            bd->numpts = numpts;
+            bd->delays = gen_dvect(numpts);
+            keplers_eqn_grid(bd->delays, numpts, to, dt, orb, DBLCORRECT);
+            E_to_phib(bd->delays, numpts, orb);
+        }
+        bdlastused[slot] = ++bdcount;
+    }
+    return bdcache + slot;
+}
+
+
+double bindelay(bindelays * bd, double t)
+/* Return the cubic-interpolated orbital delay (s) at time 't' (sec */
+/* since the start of the data) using a grid from get_bindelays().  */
+{
+    return cubic_interp_grid(bd->delays, bd->numpts, (t - bd->to) / bd->dt);
+}
+
+
+void free_bindelays_cache(void)
+/* Free all of the delay grids remembered by get_bindelays() */
+{
+    int ii;
+
+    for (ii = 0; ii < NUMBINDELAYS; ii++) {
+        if (bdcache[ii].delays)
+            vect_free(bdcache[ii].delays);
+        bdcache[ii].delays = NULL;
+        bdlastused[ii] = 0;
+    }
+}
+
+#undef NUMBINDELAYS
@@ -276,23 +276,22 @@ int getpoly(double mjd, double duration, double *dm, FILE * fp, char *pname)
                 if (binary)
                     sscanf(binpha, "%lf%lf", &aphi0b[j], &adphib[j]);
                 if (ncoeff > 15) {
-                    printf("ncoeff too big in polyco.dat.\n");
-                    exit(1);
+                    presto_error(PRESTO_ERR_FORMAT,
+                                 "ncoeff (%d) too big in polyco.dat.", ncoeff);
                 }
                 if (ncoeff < 15)
                     for (k = ncoeff; k < 15; k++)
                         coeff[j][k] = 0.;
                 rphase[j] -= floor(rphase[j]);
                 if ((rphase[j] < 0.) || (rphase[j] > 1.)) {
-                    printf("rphase[%d] = %f\n", j, rphase[j]);
-                    exit(1);
+                    presto_error(PRESTO_ERR_FORMAT,
+                                 "Bad polyco rphase[%d] = %f", j, rphase[j]);
                 }
                 j++;
                 if (j >= MAX_POLYCOS) {
-                    fprintf(stderr,
-                            "Too many polycos in polycos.c (MAX_POLYCO = %d)",
-                            MAX_POLYCOS);
-                    exit(32);
+                    presto_error(PRESTO_ERR_VALUE,
+                                 "Too many polycos in polycos.c (MAX_POLYCO = %d)",
+                                 MAX_POLYCOS);
                 }
             }
         }
@@ -340,20 +339,19 @@ int phcalc(double mjd0, double mjd1, int last_index, double *phase, double *psrf
                 printf("phase = %21.15e   f0: %21.15e\n", *phase, f0[j]);
             *phase -= floor(*phase);
             if ((*phase < 0.) || (*phase > 1.)) {
-                printf("phase = %21.15f\n", *phase);
-                exit(1);
+                presto_error(PRESTO_ERR_VALUE,
+                             "Bad polyco phase = %21.15f", *phase);
             }
             icurr = j;
             break;
         }
     }
     if (icurr == -1) {
-        printf("MJD %9.3f out of range (%9.3f to %9.3f)\n",
-               (mjd0 + mjd1), mjdmid[0] - nblk / 2880.,
-               mjdmid[isets - 1] + nblk / 2880.);
         *phase = -999.;
-        printf("isets = %d\n", isets);
-        exit(1);
+        presto_error(PRESTO_ERR_VALUE,
+                     "MJD %9.3f out of range (%9.3f to %9.3f, isets = %d)",
+                     (mjd0 + mjd1), mjdmid[0] - nblk / 2880.,
+                     mjdmid[isets - 1] + nblk / 2880., isets);
     }
     return icurr;
 }
@@ -20,7 +20,7 @@
 /* x.5s get rounded away from zero.                */
 #define NEAREST_LONG(x) (long) (x < 0 ? ceil(x - 0.5) : floor(x + 0.5))
 
-#define RAWDATA (cmd->filterbankP || cmd->psrfitsP)
+#define RAWDATA (cmd->filterbankP || cmd->psrfitsP || cmd->basebandP || cmd->shmringP)
 
 /* Some function definitions */
 static int read_floats(FILE * file, float *data, int numpts, int numchan);
@@ -28,6 +28,13 @@ static int read_shorts(FILE * file, float *data, int numpts, int numchan);
 static int downsample(float outdata[], int numread, int downsampfact);
 static void update_infodata(infodata * idata, long datawrote, long padwrote,
                             int *barybins, int numbarybins);
+static int *bary_diffbins(double *btoa, long numbarypts, double dsdt,
+                          long numout, int *numdiffbins);
+static int read_dmlist(char *dmlist, double **dms);
+static void prep_many_dms(struct spectra_info *s, infodata * idata,
+                          mask * obsmask, Cmdline * cmd, double *dms,
+                          int numdms, int *maskchans, char *obs,
+                          long numbarypts);
 
 /* The main program */
 
@@ -48,7 +55,8 @@ int main(int argc, char *argv[])
     long numread = 0, numtowrite = 0, totwrote = 0, datawrote = 0;
     long padwrote = 0, padtowrite = 0, statnum = 0;
     int numdiffbins = 0, *diffbins = NULL, *diffbinptr = NULL, good_padvals = 0;
-    int *idispdt;
+    int *idispdt, numdms = 1, multidm = 0;
+    double *dms = NULL;
     struct spectra_info s;
     infodata idata;
     Cmdline *cmd;
@@ -79,6 +87,8 @@ int main(int argc, char *argv[])
     s.apply_scale = (cmd->noscalesP) ? 0 : -1;
     s.apply_offset = (cmd->nooffsetsP) ? 0 : -1;
     s.remove_zerodm = (cmd->zerodmP) ? 1 : 0;
+    s.tscrunch = cmd->tscrunch;
+    s.fscrunch = cmd->fscrunch;
     if (cmd->noclipP) {
         cmd->clip = 0.0;
         s.clip_sigma = 0.0;
@@ -117,12 +127,20 @@ int main(int argc, char *argv[])
             s.datatype = SIGPROCFB;
         else if (cmd->psrfitsP)
             s.datatype = PSRFITS;
+        else if (cmd->basebandP)
+            s.datatype = BASEBAND;
+        else if (cmd->shmringP)
+            s.datatype = SHMRING;
     } else {                    // Attempt to auto-identify the data
         identify_psrdatatype(&s, 1);
         if (s.datatype == SIGPROCFB)
             cmd->filterbankP = 1;
         else if (s.datatype == PSRFITS)
             cmd->psrfitsP = 1;
+        else if (s.datatype == BASEBAND)
+            cmd->basebandP = 1;
+        else if (s.datatype == SHMRING)
+            cmd->shmringP = 1;
         else if (s.datatype == SDAT)
             useshorts = 1;
         else if (s.datatype != DAT) {
@@ -132,6 +150,27 @@ int main(int argc, char *argv[])
         }
     }
 
+    /* Are we de-dispersing several DMs in a single pass? */
+    multidm = (cmd->dmlistP || cmd->numdms > 1);
+    if (multidm) {
+        if (!RAWDATA) {
+            printf("Error:  Several DMs can only be de-dispersed from raw data.\n\n");
+            exit(1);
+        }
+        if (cmd->shortsP) {
+            printf("Error:  '-shorts' can not be used with several DMs.\n\n");
+            exit(1);
+        }
+        if (cmd->dmlistP) {
+            numdms = read_dmlist(cmd->dmlist, &dms);
+        } else {
+            numdms = cmd->numdms;
+            dms = gen_dvect(numdms);
+            for (ii = 0; ii < numdms; ii++)
+                dms[ii] = cmd->dm + ii * cmd->dmstep;
+        }
+    }
+
     if (!RAWDATA) {
         char *root, *suffix;
         /* Split the filename into a rootname and a suffix */
@@ -165,7 +204,8 @@ int main(int argc, char *argv[])
     slen = strlen(cmd->outfile) + 8;
     datafilenm = (char *) calloc(slen, 1);
     sprintf(datafilenm, "%s.dat", cmd->outfile);
-    outfile = chkfopen(datafilenm, "wb");
+    if (!multidm)
+        outfile = chkfopen(datafilenm, "wb");
     sprintf(idata.name, "%s", cmd->outfile);
     outinfonm = (char *) calloc(slen, 1);
     sprintf(outinfonm, "%s.inf", cmd->outfile);
@@ -203,13 +243,15 @@ int main(int argc, char *argv[])
         if (cmd->numoutP) {
             dtmp = idata.N;
             idata.N = cmd->numout;
-            writeinf(&idata);
+            if (!multidm)
+                writeinf(&idata);
             idata.N = dtmp;
         } else {
         /* Set the output length to a good number if it wasn't requested */
             cmd->numoutP = 1;
             cmd->numout = choose_good_N((long long)(idata.N/cmd->downsamp));
-            writeinf(&idata);
+            if (!multidm)
+                writeinf(&idata);
             printf("Setting a 'good' output length of %ld samples\n", cmd->numout);
         }
 
@@ -294,6 +336,20 @@ int main(int argc, char *argv[])
             exit(1);
         }
     }
+
+    if (multidm) {
+        prep_many_dms(&s, &idata, &obsmask, cmd, dms, numdms, maskchans,
+                      obs, numbarypts);
+        if (cmd->maskfileP) {
+            free_mask(obsmask);
+            vect_free(maskchans);
+        }
+        close_rawfiles(&s);
+        vect_free(dms);
+        free(outinfonm);
+        free(datafilenm);
+        return (0);
+    }
     printf("Writing output data to '%s'.\n", datafilenm);
     printf("Writing information to '%s'.\n\n", outinfonm);
 
@@ -475,40 +531,8 @@ int main(int argc, char *argv[])
         for (ii = 0; ii < numbarypts; ii++)
             btoa[ii] = ((btoa[ii] - ttoa[ii]) - dtmp) * SECPERDAY / dsdt;
 
-        {                       /* Find the points where we need to add or remove bins */
-
-            int oldbin = 0, currentbin;
-            double lobin, hibin, calcpt;
-
-            numdiffbins = labs(NEAREST_LONG(btoa[numbarypts - 1])) + 1;
-            diffbins = gen_ivect(numdiffbins);
-            diffbinptr = diffbins;
-            for (ii = 1; ii < numbarypts; ii++) {
-                currentbin = NEAREST_LONG(btoa[ii]);
-                if (currentbin != oldbin) {
-                    if (currentbin > 0) {
-                        calcpt = oldbin + 0.5;
-                        lobin = (ii - 1) * TDT / dsdt;
-                        hibin = ii * TDT / dsdt;
-                    } else {
-                        calcpt = oldbin - 0.5;
-                        lobin = -((ii - 1) * TDT / dsdt);
-                        hibin = -(ii * TDT / dsdt);
-                    }
-                    while (fabs(calcpt) < fabs(btoa[ii])) {
-                        /* Negative bin number means remove that bin */
-                        /* Positive bin number means add a bin there */
-                        *diffbinptr = NEAREST_LONG(LININTERP(calcpt, btoa[ii - 1],
-                                                             btoa[ii], lobin,
-                                                             hibin));
-                        diffbinptr++;
-                        calcpt = (currentbin > 0) ? calcpt + 1.0 : calcpt - 1.0;
-                    }
-                    oldbin = currentbin;
-                }
-            }
-            *diffbinptr = cmd->numout;  /* Used as a marker */
-        }
+        /* Find the points where we need to add or remove bins */
+        diffbins = bary_diffbins(btoa, numbarypts, dsdt, cmd->numout, &numdiffbins);
         diffbinptr = diffbins;
 
         /* Now perform the barycentering */
@@ -814,6 +838,447 @@ static int read_shorts(FILE * file, float *data, int numpts, int numchan)
     return numread;
 }
 
+static int *bary_diffbins(double *btoa, long numbarypts, double dsdt,
+                          long numout, int *numdiffbins)
+/* Return the output bins where a bin must be added (positive bin   */
+/* numbers) or removed (negative bin numbers) to barycenter data    */
+/* sampled every 'dsdt' sec.  'btoa' are the 'numbarypts' (one per  */
+/* TDT sec) differences between the barycentric and topocentric    */
+/* times in bins.  The array ends with the marker 'numout' and its  */
+/* length is returned in 'numdiffbins'.                             */
+{
+    int oldbin = 0, currentbin, *diffbins, *diffbinptr;
+    long ii;
+    double lobin, hibin, calcpt;
+
+    *numdiffbins = labs(NEAREST_LONG(btoa[numbarypts - 1])) + 1;
+    diffbins = gen_ivect(*numdiffbins);
+    diffbinptr = diffbins;
+    for (ii = 1; ii < numbarypts; ii++) {
+        currentbin = NEAREST_LONG(btoa[ii]);
+        if (currentbin != oldbin) {
+            if (currentbin > 0) {
+                calcpt = oldbin + 0.5;
+                lobin = (ii - 1) * TDT / dsdt;
+                hibin = ii * TDT / dsdt;
+            } else {
+                calcpt = oldbin - 0.5;
+                lobin = -((ii - 1) * TDT / dsdt);
+                hibin = -(ii * TDT / dsdt);
+            }
+            while (fabs(calcpt) < fabs(btoa[ii])) {
+                /* Negative bin number means remove that bin */
+                /* Positive bin number means add a bin there */
+                *diffbinptr = NEAREST_LONG(LININTERP(calcpt, btoa[ii - 1],
+                                                     btoa[ii], lobin, hibin));
+                diffbinptr++;
+                calcpt = (currentbin > 0) ? calcpt + 1.0 : calcpt - 1.0;
+            }
+            oldbin = currentbin;
+        }
+    }
+    *diffbinptr = numout;       /* Used as a marker */
+    return diffbins;
+}
+
+
+static int read_dmlist(char *dmlist, double **dms)
+/* Read the DMs in 'dmlist', which is either a comma separated list */
+/* or the name of a file containing them (separated by whitespace   */
+/* or commas, with '#' comments).  The DMs are returned in '*dms'   */
+/* (allocated here) and their number is the return value.           */
+{
+    int ii, numdms = 0, maxdms = 64;
+    char *str, *tok, *endptr;
+    double *tmpdms;
+    FILE *file;
+
+    if ((file = fopen(dmlist, "r")) != NULL) {
+        long len = chkfilelen(file, 1);
+
+        str = (char *) calloc(len + 1, 1);
+        chkfread(str, 1, len, file);
+        fclose(file);
+        /* Blank the comments */
+        for (tok = strchr(str, '#'); tok; tok = strchr(tok, '#'))
+            while (*tok && *tok != '\n')
+                *tok++ = ' ';
+    } else {
+        str = (char *) calloc(strlen(dmlist) + 1, 1);
+        strcpy(str, dmlist);
+    }
+    tmpdms = (double *) malloc(sizeof(double) * maxdms);
+    for (tok = strtok(str, ", \t\r\n"); tok; tok = strtok(NULL, ", \t\r\n")) {
+        if (numdms == maxdms) {
+            maxdms *= 2;
+            tmpdms = (double *) realloc(tmpdms, sizeof(double) * maxdms);
+        }
+        tmpdms[numdms] = strtod(tok, &endptr);
+        if (*endptr != '\0' || tmpdms[numdms] < 0.0) {
+            printf("Error:  Bad DM '%s' in '-dmlist'.\n\n", tok);
+            exit(1);
+        }
+        numdms++;
+    }
+    if (numdms == 0) {
+        printf("Error:  No DMs were found in '-dmlist'.\n\n");
+        exit(1);
+    }
+    *dms = gen_dvect(numdms);
+    for (ii = 0; ii < numdms; ii++)
+        (*dms)[ii] = tmpdms[ii];
+    free(tmpdms);
+    free(str);
+    return numdms;
+}
+
+
+/* A piece of the barycentered output of a block of data: either */
+/* 'num' points starting at 'start' or (if 'start' < 0) an added */
+/* bin.  The pieces are the same for all of the DMs.             */
+typedef struct writeop {
+    int start;
+    int num;
+} writeop;
+
+
+static int read_chan_block(float *data, int blocksperread,
+                           struct spectra_info *s, int *zerodelays,
+                           int *padding, int *maskchans, mask * obsmask)
+/* Read 'blocksperread' blocks of raw data into 'data' (in time  */
+/* order, with the channels together at each time point).       */
+/* Return the number of spectra that were read.                 */
+{
+    int ii, numread, totnumread = 0, tmppad = 0, nummasked = 0;
+    int numchan = s->num_channels, blocksize = s->spectra_per_subint * numchan;
+
+    *padding = 0;
+    for (ii = 0; ii < blocksperread; ii++) {
+        numread = read_subbands(data + ii * blocksize, zerodelays, numchan, s, 0,
+                                &tmppad, maskchans, &nummasked, obsmask);
+        totnumread += numread;
+        if (numread != s->spectra_per_subint)
+            memset(data + ii * blocksize, 0, sizeof(float) * blocksize);
+        if (tmppad)
+            *padding = 1;
+    }
+    return totnumread;
+}
+
+
+static void prep_many_dms(struct spectra_info *s, infodata * idata,
+                          mask * obsmask, Cmdline * cmd, double *dms,
+                          int numdms, int *maskchans, char *obs,
+                          long numbarypts)
+/* De-disperse (and barycenter unless -nobary) the raw data at each */
+/* of the 'numdms' DMs in 'dms' with a single pass through the raw  */
+/* data.  The delays for each DM are computed once, and the bins    */
+/* added or removed for barycentering are the same for all of the   */
+/* DMs.  Each DM's time series is de-dispersed and written to its   */
+/* own output file by a separate thread.                            */
+{
+    FILE **outfiles;
+    float *data1, *data2, *currentdata, *lastdata, **outdata, *tempzz;
+    double *btoa = NULL, *ttoa = NULL, avgvoverc = 0.0, blotoa = 0.0;
+    double dsdt, maxdm = 0.0, BW_ddelay, dtmp;
+    double *mins, *maxs, *avgs, *vars;
+    char datafilenm[200];
+    int ii, jj, numchan = s->num_channels, blocksperread, worklen, dsworklen;
+    int maxoffset = 0;
+    int **offsets, *zerodelays, numdiffbins = 0, *diffbins = NULL;
+    int *diffbinptr = NULL, *lastdiffbin = NULL, padding = 0, lastpadding;
+    int numops, maxops, numadded = 0, numremoved = 0, newper, oldper = 0;
+    long numread, totwrote = 0, datawrote = 0, padwrote = 0, statnum = 0;
+    writeop *ops;
+
+    dsdt = idata->dt * cmd->downsamp;
+    for (ii = 0; ii < numdms; ii++)
+        if (dms[ii] > maxdm)
+            maxdm = dms[ii];
+    BW_ddelay = delay_from_dm(maxdm, idata->freq) -
+        delay_from_dm(maxdm, idata->freq + (numchan - 1) * idata->chan_wid);
+    blocksperread = ((int) (BW_ddelay / idata->dt) / s->spectra_per_subint + 1);
+    worklen = s->spectra_per_subint * blocksperread;
+    dsworklen = worklen / cmd->downsamp;
+
+    if (!cmd->nobaryP) {
+        double maxvoverc = -1.0, minvoverc = 1.0, *voverc;
+        char ephem[10], rastring[50], decstring[50];
+
+        /* What ephemeris will we use?  (Default is DE405) */
+        strcpy(ephem, "DE405");
+
+        /* Define the RA and DEC of the observation */
+        ra_dec_to_string(rastring, idata->ra_h, idata->ra_m, idata->ra_s);
+        ra_dec_to_string(decstring, idata->dec_d, idata->dec_m, idata->dec_s);
+
+        btoa = gen_dvect(numbarypts);
+        ttoa = gen_dvect(numbarypts);
+        voverc = gen_dvect(numbarypts);
+        for (ii = 0; ii < numbarypts; ii++)
+            ttoa[ii] = idata->mjd_i + idata->mjd_f + TDT * ii / SECPERDAY;
+
+        /* Call TEMPO for the barycentering */
+        printf("Generating barycentric corrections...\n");
+        barycenter(ttoa, btoa, voverc, numbarypts, rastring, decstring, obs, ephem);
+        for (ii = 0; ii < numbarypts; ii++) {
+            if (voverc[ii] > maxvoverc)
+                maxvoverc = voverc[ii];
+            if (voverc[ii] < minvoverc)
+                minvoverc = voverc[ii];
+            avgvoverc += voverc[ii];
+        }
+        avgvoverc /= numbarypts;
+        vect_free(voverc);
+        blotoa = btoa[0];
+
+        printf("   Average topocentric velocity (c) = %.7g\n", avgvoverc);
+        printf("   Maximum topocentric velocity (c) = %.7g\n", maxvoverc);
+        printf("   Minimum topocentric velocity (c) = %.7g\n\n", minvoverc);
+
+        /* Convert the bary TOAs to differences from the topo TOAs in  */
+        /* units of bin length (dsdt) and find the bins to add/remove. */
+        dtmp = (btoa[0] - ttoa[0]);
+        for (ii = 0; ii < numbarypts; ii++)
+            btoa[ii] = ((btoa[ii] - ttoa[ii]) - dtmp) * SECPERDAY / dsdt;
+        diffbins = bary_diffbins(btoa, numbarypts, dsdt, cmd->numout, &numdiffbins);
+        diffbinptr = diffbins;
+        /* The marker at the end of the diffbins */
+        for (lastdiffbin = diffbins; *lastdiffbin != cmd->numout; lastdiffbin++);
+    }
+
+    /* The dispersion delays (in output bins) for each DM.  The */
+    /* highest frequency channel gets no delay.                 */
+    offsets = gen_imatrix(numdms, numchan);
+    for (ii = 0; ii < numdms; ii++) {
+        double *dispdt = dedisp_delays(numchan, dms[ii], idata->freq,
+                                       idata->chan_wid, avgvoverc);
+
+        for (jj = 0; jj < numchan; jj++)
+            offsets[ii][jj] = NEAREST_LONG((dispdt[jj] - dispdt[numchan - 1]) /
+                                           idata->dt);
+        if (offsets[ii][0] > maxoffset)
+            maxoffset = offsets[ii][0];
+        vect_free(dispdt);
+    }
+    zerodelays = gen_ivect(numchan);
+    for (jj = 0; jj < numchan; jj++)
+        zerodelays[jj] = 0;
+
+    /* Open the output files */
+    printf("De-dispersing %d DMs from %.*f to %.*f (writing '%s_DM*.dat').\n",
+           numdms, cmd->dmprec, dms[0], cmd->dmprec, dms[numdms - 1], cmd->outfile);
+    if (cmd->downsamp > 1)
+        printf("Downsampling by a factor of %d (new dt = %.10g)\n",
+               cmd->downsamp, dsdt);
+    printf("\n");
+    outfiles = (FILE **) malloc(numdms * sizeof(FILE *));
+    for (ii = 0; ii < numdms; ii++) {
+        sprintf(datafilenm, "%s_DM%.*f.dat", cmd->outfile, cmd->dmprec, dms[ii]);
+        outfiles[ii] = chkfopen(datafilenm, "wb");
+    }
+
+    outdata = gen_fmatrix(numdms, worklen);
+    data1 = gen_fvect(numchan * worklen);
+    data2 = gen_fvect(numchan * worklen);
+    currentdata = data1;
+    lastdata = data2;
+    mins = gen_dvect(numdms);
+    maxs = gen_dvect(numdms);
+    avgs = gen_dvect(numdms);
+    vars = gen_dvect(numdms);
+    for (ii = 0; ii < numdms; ii++) {
+        mins[ii] = 9.9E30;
+        maxs[ii] = -9.9E30;
+        avgs[ii] = vars[ii] = 0.0;
+    }
+    maxops = 2 * numdiffbins + 4;
+    ops = (writeop *) malloc(maxops * sizeof(writeop));
+
+    printf("Massaging the data ...\n\n");
+    printf("Amount Complete = 0%%");
+
+    /* The first block is only used for the de-dispersion of the next */
+    numread = read_chan_block(lastdata, blocksperread, s, zerodelays,
+                              &lastpadding, maskchans, obsmask);
+    while (numread == worklen) {
+        int pos = 0, numstats = 0, numvalid = dsworklen;
+
+        numread = read_chan_block(currentdata, blocksperread, s, zerodelays,
+                                  &padding, maskchans, obsmask);
+        /* At the end of the data, only write the points that were */
+        /* completely de-dispersed at all of the DMs               */
+        if (numread < worklen && numread + worklen - maxoffset < worklen)
+            numvalid = (numread + worklen - maxoffset) / cmd->downsamp;
+
+        /* Determine which parts of the last block get written, and   */
+        /* where bins are added or removed (the same for all the DMs) */
+        numops = 0;
+        while (pos < numvalid && totwrote < cmd->numout) {
+            long numtowrite = numvalid - pos;
+
+            if (diffbinptr && diffbinptr < lastdiffbin &&
+                datawrote == abs(*diffbinptr)) {
+                if (*diffbinptr > 0) {
+                    /* Add a bin */
+                    ops[numops].start = -1;
+                    ops[numops++].num = 1;
+                    numadded++;
+                    totwrote++;
+                } else {
+                    /* Remove a bin */
+                    numremoved++;
+                    datawrote++;
+                    pos++;
+                }
+                diffbinptr++;
+                continue;
+            }
+            if (diffbinptr && diffbinptr < lastdiffbin &&
+                numtowrite > abs(*diffbinptr) - datawrote)
+                numtowrite = abs(*diffbinptr) - datawrote;
+            if (totwrote + numtowrite > cmd->numout)
+                numtowrite = cmd->numout - totwrote;
+            ops[numops].start = pos;
+            ops[numops++].num = numtowrite;
+            pos += numtowrite;
+            datawrote += numtowrite;
+            totwrote += numtowrite;
+            numstats += numtowrite;
+        }
+
+        /* De-disperse and write each DM */
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) default(none) private(jj) \
+    shared(numdms,currentdata,lastdata,worklen,dsworklen,numchan,cmd,offsets,outdata,ops,numops,outfiles,lastpadding,statnum,mins,maxs,avgs,vars)
+#endif
+        for (ii = 0; ii < numdms; ii++) {
+            int kk, nstat = 0;
+            double block_avg, block_var;
+
+            float_dedisp(currentdata, lastdata, worklen, numchan, offsets[ii],
+                         0.0, outdata[ii]);
+            if (cmd->downsamp > 1)
+                downsample(outdata[ii], worklen, cmd->downsamp);
+            /* Determine the approximate local average */
+            avg_var(outdata[ii], dsworklen, &block_avg, &block_var);
+            for (jj = 0; jj < numops; jj++) {
+                if (ops[jj].start < 0) {
+                    float favg = (float) block_avg;
+                    chkfwrite(&favg, sizeof(float), 1, outfiles[ii]);
+                    continue;
+                }
+                chkfwrite(outdata[ii] + ops[jj].start, sizeof(float), ops[jj].num,
+                          outfiles[ii]);
+                if (!lastpadding)
+                    for (kk = 0; kk < ops[jj].num; kk++, nstat++)
+                        update_stats(statnum + nstat, outdata[ii][ops[jj].start + kk],
+                                     mins + ii, maxs + ii, avgs + ii, vars + ii);
+            }
+        }
+        if (!lastpadding)
+            statnum += numstats;
+
+        /* Print percent complete */
+        newper = (int) ((float) totwrote / cmd->numout * 100.0) + 1;
+        if (newper > oldper) {
+            printf("\rAmount Complete = %3d%%", newper);
+            fflush(stdout);
+            oldper = newper;
+        }
+
+        /* Stop if we have written out all the data we need to */
+        if (totwrote == cmd->numout)
+            break;
+        SWAP(currentdata, lastdata);
+        lastpadding = padding;
+    }
+
+    /* Pad the outputs to the requested length */
+    if (cmd->numout > totwrote)
+        padwrote = cmd->numout - totwrote;
+    if (cmd->downsamp > 1)
+        idata->dt = dsdt;
+    update_infodata(idata, totwrote, padwrote, diffbins, numdiffbins);
+    for (ii = 0; ii < numdms; ii++) {
+        idata->dm = dms[ii];
+        if (!cmd->nobaryP) {
+            double barydispdt, baryepoch;
+
+            barydispdt = delay_from_dm(dms[ii],
+                                       doppler(idata->freq + (numchan - 1) *
+                                               idata->chan_wid, avgvoverc));
+            baryepoch = blotoa - (barydispdt / SECPERDAY);
+            idata->bary = 1;
+            idata->mjd_i = (int) floor(baryepoch);
+            idata->mjd_f = baryepoch - idata->mjd_i;
+        }
+        sprintf(idata->name, "%s_DM%.*f", cmd->outfile, cmd->dmprec, dms[ii]);
+        writeinf(idata);
+
+        /* Set the padded points equal to the average data point */
+        if (idata->numonoff >= 1) {
+            int index, startpad, endpad, kk;
+            float favg = (float) avgs[ii];
+
+            fclose(outfiles[ii]);
+            sprintf(datafilenm, "%s_DM%.*f.dat", cmd->outfile, cmd->dmprec, dms[ii]);
+            outfiles[ii] = chkfopen(datafilenm, "rb+");
+            for (jj = 0; jj < idata->numonoff; jj++) {
+                index = 2 * jj;
+                startpad = idata->onoff[index + 1];
+                if (jj == idata->numonoff - 1)
+                    endpad = idata->N - 1;
+                else
+                    endpad = idata->onoff[index + 2];
+                chkfseek(outfiles[ii], (startpad + 1) * sizeof(float), SEEK_SET);
+                for (kk = 0; kk < endpad - startpad; kk++)
+                    chkfwrite(&favg, sizeof(float), 1, outfiles[ii]);
+            }
+        }
+        fclose(outfiles[ii]);
+    }
+
+    /* Print simple stats and results */
+    printf("\n\nDone.\n\n");
+    printf("             Data points written:  %ld\n", totwrote);
+    if (padwrote)
+        printf("          Padding points written:  %ld\n", padwrote);
+    if (!cmd->nobaryP) {
+        if (numadded)
+            printf("    Bins added for barycentering:  %d\n", numadded);
+        if (numremoved)
+            printf("  Bins removed for barycentering:  %d\n", numremoved);
+    }
+    printf("\nSimple statistics of the output data:\n");
+    printf("  %12s %12s %12s %12s %12s\n", "DM", "Average", "Std Dev", "Minimum",
+           "Maximum");
+    for (ii = 0; ii < numdms; ii++)
+        printf("  %12.*f %12.2f %12.2f %12.2f %12.2f\n", cmd->dmprec, dms[ii],
+               avgs[ii], sqrt(vars[ii] / (statnum - 1)), mins[ii], maxs[ii]);
+    printf("\n");
+
+    free(ops);
+    free(outfiles);
+    vect_free(outdata[0]);
+    vect_free(outdata);
+    vect_free(data1);
+    vect_free(data2);
+    vect_free(mins);
+    vect_free(maxs);
+    vect_free(avgs);
+    vect_free(vars);
+    vect_free(offsets[0]);
+    vect_free(offsets);
+    vect_free(zerodelays);
+    if (!cmd->nobaryP) {
+        vect_free(btoa);
+        vect_free(ttoa);
+        vect_free(diffbins);
+    }
+}
+
+
 static int downsample(float outdata[], int numread, int downsampfact)
 /* Downsample the floating point data by a factor downsampfact */
 {
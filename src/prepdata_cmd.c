@@ -34,6 +34,10 @@ static Cmdline cmd = {
   /* filterbankP = */ 0,
   /***** -psrfits: Raw data in PSRFITS format */
   /* psrfitsP = */ 0,
+  /***** -baseband: Raw complex baseband data in DADA format */
+  /* basebandP = */ 0,
+  /***** -shmring: Raw SIGPROC filterbank data from a shared-memory ring */
+  /* shmringP = */ 0,
   /***** -noweights: Do not apply PSRFITS weights */
   /* noweightsP = */ 0,
   /***** -noscales: Do not apply PSRFITS scales */
@@ -56,6 +60,14 @@ static Cmdline cmd = {
   /* invertP = */ 0,
   /***** -zerodm: Subtract the mean of all channels from each sample (i.e. remove zero DM) */
   /* zerodmP = */ 0,
+  /***** -tscrunch: Number of neighboring spectra to sum (in time) as the raw data are read */
+  /* tscrunchP = */ 1,
+  /* tscrunch = */ 1,
+  /* tscrunchC = */ 1,
+  /***** -fscrunch: Number of neighboring channels to sum (in frequency) as the raw data are read */
+  /* fscrunchP = */ 1,
+  /* fscrunch = */ 1,
+  /* fscrunchC = */ 1,
   /***** -nobary: Do not barycenter the data */
   /* nobaryP = */ 0,
   /***** -shorts: Use short ints for the output data instead of floats */
@@ -80,6 +92,22 @@ static Cmdline cmd = {
   /* dmP = */ 1,
   /* dm = */ 0,
   /* dmC = */ 1,
+  /***** -dmstep: The stepsize in DM for -numdms (cm^-3 pc) */
+  /* dmstepP = */ 1,
+  /* dmstep = */ 1.0,
+  /* dmstepC = */ 1,
+  /***** -numdms: The number of DMs (starting at -dm) to de-disperse in a single pass of the raw data */
+  /* numdmsP = */ 1,
+  /* numdms = */ 1,
+  /* numdmsC = */ 1,
+  /***** -dmlist: Comma separated list (no spaces!) of DMs (or a file containing them) to de-disperse in a single pass of the raw data */
+  /* dmlistP = */ 0,
+  /* dmlist = */ (char*)0,
+  /* dmlistC = */ 0,
+  /***** -dmprec: The number of decimals in the precision of the DM in the filenames when de-dispersing several DMs */
+  /* dmprecP = */ 1,
+  /* dmprec = */ 2,
+  /* dmprecC = */ 1,
   /***** -mask: File containing masking information to use */
   /* maskfileP = */ 0,
   /* maskfile = */ (char*)0,
@@ -837,6 +865,20 @@ showOptionValues(void)
     printf("-psrfits found:\n");
   }
 
+  /***** -baseband: Raw complex baseband data in DADA format */
+  if( !cmd.basebandP ) {
+    printf("-baseband not found.\n");
+  } else {
+    printf("-baseband found:\n");
+  }
+
+  /***** -shmring: Raw SIGPROC filterbank data from a shared-memory ring */
+  if( !cmd.shmringP ) {
+    printf("-shmring not found.\n");
+  } else {
+    printf("-shmring found:\n");
+  }
+
   /***** -noweights: Do not apply PSRFITS weights */
   if( !cmd.noweightsP ) {
     printf("-noweights not found.\n");
@@ -910,6 +952,30 @@ showOptionValues(void)
     printf("-zerodm found:\n");
   }
 
+  /***** -tscrunch: Number of neighboring spectra to sum (in time) as the raw data are read */
+  if( !cmd.tscrunchP ) {
+    printf("-tscrunch not found.\n");
+  } else {
+    printf("-tscrunch found:\n");
+    if( !cmd.tscrunchC ) {
+      printf("  no values\n");
+    } else {
+      printf("  value = `%d'\n", cmd.tscrunch);
+    }
+  }
+
+  /***** -fscrunch: Number of neighboring channels to sum (in frequency) as the raw data are read */
+  if( !cmd.fscrunchP ) {
+    printf("-fscrunch not found.\n");
+  } else {
+    printf("-fscrunch found:\n");
+    if( !cmd.fscrunchC ) {
+      printf("  no values\n");
+    } else {
+      printf("  value = `%d'\n", cmd.fscrunch);
+    }
+  }
+
   /***** -nobary: Do not barycenter the data */
   if( !cmd.nobaryP ) {
     printf("-nobary not found.\n");
@@ -984,6 +1050,54 @@ showOptionValues(void)
     }
   }
 
+  /***** -dmstep: The stepsize in DM for -numdms (cm^-3 pc) */
+  if( !cmd.dmstepP ) {
+    printf("-dmstep not found.\n");
+  } else {
+    printf("-dmstep found:\n");
+    if( !cmd.dmstepC ) {
+      printf("  no values\n");
+    } else {
+      printf("  value = `%.40g'\n", cmd.dmstep);
+    }
+  }
+
+  /***** -numdms: The number of DMs (starting at -dm) to de-disperse in a single pass of the raw data */
+  if( !cmd.numdmsP ) {
+    printf("-numdms not found.\n");
+  } else {
+    printf("-numdms found:\n");
+    if( !cmd.numdmsC ) {
+      printf("  no values\n");
+    } else {
+      printf("  value = `%d'\n", cmd.numdms);
+    }
+  }
+
+  /***** -dmlist: Comma separated list (no spaces!) of DMs (or a file containing them) to de-disperse in a single pass of the raw data */
+  if( !cmd.dmlistP ) {
+    printf("-dmlist not found.\n");
+  } else {
+    printf("-dmlist found:\n");
+    if( !cmd.dmlistC ) {
+      printf("  no values\n");
+    } else {
+      printf("  value = `%s'\n", cmd.dmlist);
+    }
+  }
+
+  /***** -dmprec: The number of decimals in the precision of the DM in the filenames when de-dispersing several DMs */
+  if( !cmd.dmprecP ) {
+    printf("-dmprec not found.\n");
+  } else {
+    printf("-dmprec found:\n");
+    if( !cmd.dmprecC ) {
+      printf("  no values\n");
+    } else {
+      printf("  value = `%d'\n", cmd.dmprec);
+    }
+  }
+
   /***** -mask: File containing masking information to use */
   if( !cmd.maskfileP ) {
     printf("-mask not found.\n");
@@ -1022,7 +1136,7 @@ showOptionValues(void)
 void
 usage(void)
 {
-  fprintf(stderr,"%s","   [-ncpus ncpus] -o outfile [-filterbank] [-psrfits] [-noweights] [-noscales] [-nooffsets] [-window] [-if ifs] [-clip clip] [-noclip] [-invert] [-zerodm] [-nobary] [-shorts] [-numout numout] [-downsamp downsamp] [-offset offset] [-start start] [-dm dm] [-mask maskfile] [-ignorechan ignorechanstr] [--] infile ...\n");
+  fprintf(stderr,"%s","   [-ncpus ncpus] -o outfile [-filterbank] [-psrfits] [-baseband] [-shmring] [-noweights] [-noscales] [-nooffsets] [-window] [-if ifs] [-clip clip] [-noclip] [-invert] [-zerodm] [-tscrunch tscrunch] [-fscrunch fscrunch] [-nobary] [-shorts] [-numout numout] [-downsamp downsamp] [-offset offset] [-start start] [-dm dm] [-dmstep dmstep] [-numdms numdms] [-dmlist dmlist] [-dmprec dmprec] [-mask maskfile] [-ignorechan ignorechanstr] [--] infile ...\n");
   fprintf(stderr,"%s","      Prepares a raw data file for pulsar searching or folding (conversion, de-dispersion, and barycentering).\n");
   fprintf(stderr,"%s","         -ncpus: Number of processors to use with OpenMP\n");
   fprintf(stderr,"%s","                 1 int value between 1 and oo\n");
@@ -1031,6 +1145,8 @@ usage(void)
   fprintf(stderr,"%s","                 1 char* value\n");
   fprintf(stderr,"%s","    -filterbank: Raw data in SIGPROC filterbank format\n");
   fprintf(stderr,"%s","       -psrfits: Raw data in PSRFITS format\n");
+  fprintf(stderr,"%s","      -baseband: Raw complex baseband data in DADA format\n");
+  fprintf(stderr,"%s","       -shmring: Raw SIGPROC filterbank data from a shared-memory ring\n");
   fprintf(stderr,"%s","     -noweights: Do not apply PSRFITS weights\n");
   fprintf(stderr,"%s","      -noscales: Do not apply PSRFITS scales\n");
   fprintf(stderr,"%s","     -nooffsets: Do not apply PSRFITS offsets\n");
@@ -1043,6 +1159,12 @@ usage(void)
   fprintf(stderr,"%s","        -noclip: Do not clip the data.  (The default is to _always_ clip!)\n");
   fprintf(stderr,"%s","        -invert: For rawdata, flip (or invert) the band\n");
   fprintf(stderr,"%s","        -zerodm: Subtract the mean of all channels from each sample (i.e. remove zero DM)\n");
+  fprintf(stderr,"%s","      -tscrunch: Number of neighboring spectra to sum (in time) as the raw data are read\n");
+  fprintf(stderr,"%s","                 1 int value between 1 and 1024\n");
+  fprintf(stderr,"%s","                 default: `1'\n");
+  fprintf(stderr,"%s","      -fscrunch: Number of neighboring channels to sum (in frequency) as the raw data are read\n");
+  fprintf(stderr,"%s","                 1 int value between 1 and 1024\n");
+  fprintf(stderr,"%s","                 default: `1'\n");
   fprintf(stderr,"%s","        -nobary: Do not barycenter the data\n");
   fprintf(stderr,"%s","        -shorts: Use short ints for the output data instead of floats\n");
   fprintf(stderr,"%s","        -numout: Output this many values.  If there are not enough values in the original data file, will pad the output file with the average value\n");
@@ -1059,13 +1181,24 @@ usage(void)
   fprintf(stderr,"%s","            -dm: The dispersion measure to de-disperse (cm^-3 pc)\n");
   fprintf(stderr,"%s","                 1 double value between 0 and oo\n");
   fprintf(stderr,"%s","                 default: `0'\n");
+  fprintf(stderr,"%s","        -dmstep: The stepsize in DM for -numdms (cm^-3 pc)\n");
+  fprintf(stderr,"%s","                 1 double value between 0 and oo\n");
+  fprintf(stderr,"%s","                 default: `1.0'\n");
+  fprintf(stderr,"%s","        -numdms: The number of DMs (starting at -dm) to de-disperse in a single pass of the raw data\n");
+  fprintf(stderr,"%s","                 1 int value between 1 and 10000\n");
+  fprintf(stderr,"%s","                 default: `1'\n");
+  fprintf(stderr,"%s","        -dmlist: Comma separated list (no spaces!) of DMs (or a file containing them) to de-disperse in a single pass of the raw data\n");
+  fprintf(stderr,"%s","                 1 char* value\n");
+  fprintf(stderr,"%s","        -dmprec: The number of decimals in the precision of the DM in the filenames when de-dispersing several DMs\n");
+  fprintf(stderr,"%s","                 1 int value between 2 and 4\n");
+  fprintf(stderr,"%s","                 default: `2'\n");
   fprintf(stderr,"%s","          -mask: File containing masking information to use\n");
   fprintf(stderr,"%s","                 1 char* value\n");
   fprintf(stderr,"%s","    -ignorechan: Comma separated string (no spaces!) of channels to ignore (or file containing such string).  Ranges are specified by min:max[:step]\n");
   fprintf(stderr,"%s","                 1 char* value\n");
   fprintf(stderr,"%s","         infile: Input data file name.  If the data is not in a known raw format, it should be a single channel of single-precision floating point data.  In this case a '.inf' file with the same root filename must also exist (Note that this means that the input data file must have a suffix that starts with a period)\n");
   fprintf(stderr,"%s","                 1...16384 values\n");
-  fprintf(stderr,"%s","  version: 16Jun19\n");
+  fprintf(stderr,"%s","  version: 18Oct26\n");
   fprintf(stderr,"%s","  ");
   exit(EXIT_FAILURE);
 }
@@ -1111,6 +1244,16 @@ parseCmdline(int argc, char **argv)
       continue;
     }
 
+    if( 0==strcmp("-baseband", argv[i]) ) {
+      cmd.basebandP = 1;
+      continue;
+    }
+
+    if( 0==strcmp("-shmring", argv[i]) ) {
+      cmd.shmringP = 1;
+      continue;
+    }
+
     if( 0==strcmp("-noweights", argv[i]) ) {
       cmd.noweightsP = 1;
       continue;
@@ -1166,6 +1309,26 @@ parseCmdline(int argc, char **argv)
       continue;
     }
 
+    if( 0==strcmp("-tscrunch", argv[i]) ) {
+      int keep = i;
+      cmd.tscrunchP = 1;
+      i = getIntOpt(argc, argv, i, &cmd.tscrunch, 1);
+      cmd.tscrunchC = i-keep;
+      checkIntLower("-tscrunch", &cmd.tscrunch, cmd.tscrunchC, 1024);
+      checkIntHigher("-tscrunch", &cmd.tscrunch, cmd.tscrunchC, 1);
+      continue;
+    }
+
+    if( 0==strcmp("-fscrunch", argv[i]) ) {
+      int keep = i;
+      cmd.fscrunchP = 1;
+      i = getIntOpt(argc, argv, i, &cmd.fscrunch, 1);
+      cmd.fscrunchC = i-keep;
+      checkIntLower("-fscrunch", &cmd.fscrunch, cmd.fscrunchC, 1024);
+      checkIntHigher("-fscrunch", &cmd.fscrunch, cmd.fscrunchC, 1);
+      continue;
+    }
+
     if( 0==strcmp("-nobary", argv[i]) ) {
       cmd.nobaryP = 1;
       continue;
@@ -1223,6 +1386,43 @@ parseCmdline(int argc, char **argv)
       continue;
     }
 
+    if( 0==strcmp("-dmstep", argv[i]) ) {
+      int keep = i;
+      cmd.dmstepP = 1;
+      i = getDoubleOpt(argc, argv, i, &cmd.dmstep, 1);
+      cmd.dmstepC = i-keep;
+      checkDoubleHigher("-dmstep", &cmd.dmstep, cmd.dmstepC, 0);
+      continue;
+    }
+
+    if( 0==strcmp("-numdms", argv[i]) ) {
+      int keep = i;
+      cmd.numdmsP = 1;
+      i = getIntOpt(argc, argv, i, &cmd.numdms, 1);
+      cmd.numdmsC = i-keep;
+      checkIntLower("-numdms", &cmd.numdms, cmd.numdmsC, 10000);
+      checkIntHigher("-numdms", &cmd.numdms, cmd.numdmsC, 1);
+      continue;
+    }
+
+    if( 0==strcmp("-dmlist", argv[i]) ) {
+      int keep = i;
+      cmd.dmlistP = 1;
+      i = getStringOpt(argc, argv, i, &cmd.dmlist, 1);
+      cmd.dmlistC = i-keep;
+      continue;
+    }
+
+    if( 0==strcmp("-dmprec", argv[i]) ) {
+      int keep = i;
+      cmd.dmprecP = 1;
+      i = getIntOpt(argc, argv, i, &cmd.dmprec, 1);
+      cmd.dmprecC = i-keep;
+      checkIntLower("-dmprec", &cmd.dmprec, cmd.dmprecC, 4);
+      checkIntHigher("-dmprec", &cmd.dmprec, cmd.dmprecC, 2);
+      continue;
+    }
+
     if( 0==strcmp("-mask", argv[i]) ) {
       int keep = i;
       cmd.maskfileP = 1;
@@ -9,7 +9,7 @@
 #include <omp.h>
 #endif
 
-#define RAWDATA (cmd->filterbankP || cmd->psrfitsP)
+#define RAWDATA (cmd->filterbankP || cmd->psrfitsP || cmd->basebandP || cmd->shmringP)
 
 extern int getpoly(double mjd, double duration, double *dm, FILE * fp, char *pname);
 extern int phcalc(double mjd0, double mjd1, int last_index,
@@ -34,6 +34,7 @@ int main(int argc, char *argv[])
     double polyco_phase = 0.0, polyco_phase0 = 0.0;
     double *obsf = NULL, *parttimes = NULL, *Ep = NULL, *tp = NULL;
     double *barytimes = NULL, *topotimes = NULL, *bestprof, dtmp;
+    bindelays *bd = NULL;
     double *buffers, *phasesadded, *events = NULL, orig_foldf = 0.0;
     char *plotfilenm, *outfilenm, *rootnm;
     char obs[3], ephem[6], pname[30], rastring[50], decstring[50];
@@ -78,6 +79,8 @@ int main(int argc, char *argv[])
     s.apply_scale = (cmd->noscalesP) ? 0 : -1;
     s.apply_offset = (cmd->nooffsetsP) ? 0 : -1;
     s.remove_zerodm = (cmd->zerodmP) ? 1 : 0;
+    s.tscrunch = cmd->tscrunch;
+    s.fscrunch = cmd->fscrunch;
     if (cmd->ncpus > 1) {
 #ifdef _OPENMP
         int maxcpus = omp_get_num_procs();
@@ -182,12 +185,20 @@ int main(int argc, char *argv[])
             s.datatype = SIGPROCFB;
         else if (cmd->psrfitsP)
             s.datatype = PSRFITS;
+        else if (cmd->basebandP)
+            s.datatype = BASEBAND;
+        else if (cmd->shmringP)
+            s.datatype = SHMRING;
     } else {                    // Attempt to auto-identify the data
         identify_psrdatatype(&s, 1);
         if (s.datatype == SIGPROCFB)
             cmd->filterbankP = 1;
         else if (s.datatype == PSRFITS)
             cmd->psrfitsP = 1;
+        else if (s.datatype == BASEBAND)
+            cmd->basebandP = 1;
+        else if (s.datatype == SHMRING)
+            cmd->shmringP = 1;
         else if (s.datatype == EVENTS)
             cmd->eventsP = pflags.events = 1;
         else if (s.datatype == SDAT)
@@ -366,7 +377,9 @@ int main(int argc, char *argv[])
                     printf("file (-accelfile filename)\n");
                     printf("Exiting.\n\n");
                     exit(1);
-                } else if (NULL != (cptr = strstr(cmd->accelfile, "_ACCEL"))) {
+                } else if (NULL != (cptr = strstr(cmd->accelfile, "_ACCEL")) ||
+                           NULL != (cptr = strstr(cmd->accelfile, "_FFA")) ||
+                           NULL != (cptr = strstr(cmd->accelfile, "_LS.cand"))) {
                     ii = (long) (cptr - cmd->accelfile);
                 }
                 cptr = (char *) calloc(ii + 1, sizeof(char));
@@ -437,6 +450,10 @@ int main(int argc, char *argv[])
             search.candnm = (char *) calloc(slen, sizeof(char));
             if (NULL != (cptr = strstr(cmd->accelfile, "_JERK")))
                 sprintf(search.candnm, "JERK_Cand_%d", cmd->accelcand);
+            else if (NULL != (cptr = strstr(cmd->accelfile, "_FFA")))
+                sprintf(search.candnm, "FFA_Cand_%d", cmd->accelcand);
+            else if (NULL != (cptr = strstr(cmd->accelfile, "_LS.cand")))
+                sprintf(search.candnm, "LS_Cand_%d", cmd->accelcand);
             else
                 sprintf(search.candnm, "ACCEL_Cand_%d", cmd->accelcand);
         } else {
@@ -741,7 +758,9 @@ int main(int argc, char *argv[])
             printf("file (-accelfile filename)\n");
             printf("Exiting.\n\n");
             exit(1);
-        } else if (NULL != (cptr = strstr(cmd->accelfile, "_ACCEL"))) {
+        } else if (NULL != (cptr = strstr(cmd->accelfile, "_ACCEL")) ||
+                   NULL != (cptr = strstr(cmd->accelfile, "_FFA")) ||
+                   NULL != (cptr = strstr(cmd->accelfile, "_LS.cand"))) {
             ii = (long) (cptr - cmd->accelfile);
         }
         cptr = (char *) calloc(ii + 1, sizeof(char));
@@ -767,7 +786,16 @@ int main(int argc, char *argv[])
             f += lorec * recdt * fd;
         else
             f += lorec * search.dt * fd;
-        if (rzwidata.bary)
+        /* With -accelbary the candidates are barycentric (e.g. from */
+        /* 'accelsearch -topo2bary') even though the searched data   */
+        /* were not.                                                 */
+        if (cmd->accelbaryP && !rzwidata.bary &&
+            (cmd->topoP || !(RAWDATA || insubs || idata.bary))) {
+            printf("\nCannot fold the barycentric candidates in '%s'\n", cmd->accelfile);
+            printf("   topocentrically.  Use the topocentric '.cand' file instead.\n\n");
+            exit(1);
+        }
+        if (rzwidata.bary || cmd->accelbaryP)
             switch_f_and_p(f, fd, fdd, &search.bary.p1,
                            &search.bary.p2, &search.bary.p3);
         else
@@ -857,28 +885,28 @@ int main(int argc, char *argv[])
     /* Determine the phase delays caused by the orbit if needed */
 
     if (binary && !cmd->eventsP) {
-        double orbdt = 1.0, startE = 0.0;
+        double orbdt = 1.0;
 
         /* Save the orbital solution every half second               */
         /* The times in *tp are now calculated as barycentric times. */
         /* Later, we will change them to topocentric times after     */
-        /* applying corrections to Ep using TEMPO.                   */
+        /* applying corrections to Ep using TEMPO.  The delays are   */
+        /* evenly spaced so fold() can cubic-interpolate them.       */
 
-        startE = keplers_eqn(search.orb.t, search.orb.p, search.orb.e, 1.0E-15);
         if (T > 2048)
             orbdt = 0.5;
         else
             orbdt = T / 4096.0;
         numbinpoints = (long) floor(T / orbdt + 0.5) + 1;
-        Ep = dorbint(startE, numbinpoints, orbdt, &search.orb);
+        bd = get_bindelays(&search.orb, 0.0, orbdt, numbinpoints);
+        Ep = gen_dvect(numbinpoints);
         tp = gen_dvect(numbinpoints);
-        for (ii = 0; ii < numbinpoints; ii++)
+        for (ii = 0; ii < numbinpoints; ii++) {
             tp[ii] = ii * orbdt;
-
-        /* Convert Eccentric anomaly to time delays */
-
-        E_to_phib(Ep, numbinpoints, &search.orb);
+            Ep[ii] = bd->delays[ii];
+        }
         numdelays = numbinpoints;
+        flags = 5;
         if (search.bepoch == 0.0)
             search.orb.t = -search.orb.t / SECPERDAY + search.tepoch;
         else
@@ -1194,24 +1222,32 @@ int main(int argc, char *argv[])
                 printf("Topocentric folding f-dotdot (hz/s^2)  =  %-.8g\n", foldfdd);
             printf("\n");
 
-            /* Modify the binary delay times so they refer to */
+            /* Re-tabulate the binary delays at evenly spaced */
             /* topocentric reference times.                   */
 
             if (binary) {
+                double topo0, orbdt = tp[1] - tp[0];
+
+                arrayoffset++;  /* Beware nasty NR zero-offset kludges! */
+                hunt(barytimes, numbarypts, search.bepoch, &arrayoffset);
+                arrayoffset--;
+                topo0 = LININTERP(search.bepoch, barytimes[arrayoffset],
+                                  barytimes[arrayoffset + 1],
+                                  topotimes[arrayoffset],
+                                  topotimes[arrayoffset + 1]);
                 for (ii = 0; ii < numbinpoints; ii++) {
                     arrayoffset++;      /* Beware nasty NR zero-offset kludges! */
-                    dtmp = search.bepoch + tp[ii] / SECPERDAY;
-                    hunt(barytimes, numbarypts, dtmp, &arrayoffset);
+                    dtmp = topo0 + ii * orbdt / SECPERDAY;
+                    hunt(topotimes, numbarypts, dtmp, &arrayoffset);
                     arrayoffset--;
-                    tp[ii] = LININTERP(dtmp, barytimes[arrayoffset],
-                                       barytimes[arrayoffset + 1],
-                                       topotimes[arrayoffset],
-                                       topotimes[arrayoffset + 1]);
+                    dtmp = LININTERP(dtmp, topotimes[arrayoffset],
+                                     topotimes[arrayoffset + 1],
+                                     barytimes[arrayoffset],
+                                     barytimes[arrayoffset + 1]);
+                    Ep[ii] = bindelay(bd, (dtmp - search.bepoch) * SECPERDAY);
+                    tp[ii] = ii * orbdt;
                 }
                 numdelays = numbinpoints;
-                dtmp = tp[0];
-                for (ii = 0; ii < numdelays; ii++)
-                    tp[ii] = (tp[ii] - dtmp) * SECPERDAY;
             }
         }
 
@@ -1837,6 +1873,7 @@ int main(int argc, char *argv[])
     if (binary) {
         vect_free(Ep);
         vect_free(tp);
+        free_bindelays_cache();
     }
     if (cmd->maskfileP)
         free_mask(obsmask);
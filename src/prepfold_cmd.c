@@ -34,6 +34,10 @@ static Cmdline cmd = {
   /* filterbankP = */ 0,
   /***** -psrfits: Raw data in PSRFITS format */
   /* psrfitsP = */ 0,
+  /***** -baseband: Raw complex baseband data in DADA format */
+  /* basebandP = */ 0,
+  /***** -shmring: Raw SIGPROC filterbank data from a shared-memory ring */
+  /* shmringP = */ 0,
   /***** -noweights: Do not apply PSRFITS weights */
   /* noweightsP = */ 0,
   /***** -noscales: Do not apply PSRFITS scales */
@@ -50,6 +54,14 @@ static Cmdline cmd = {
   /* invertP = */ 0,
   /***** -zerodm: Subtract the mean of all channels from each sample (i.e. remove zero DM) */
   /* zerodmP = */ 0,
+  /***** -tscrunch: Number of neighboring spectra to sum (in time) as the raw data are read */
+  /* tscrunchP = */ 1,
+  /* tscrunch = */ 1,
+  /* tscrunchC = */ 1,
+  /***** -fscrunch: Number of neighboring channels to sum (in frequency) as the raw data are read */
+  /* fscrunchP = */ 1,
+  /* fscrunch = */ 1,
+  /* fscrunchC = */ 1,
   /***** -absphase: Use the absolute phase associated with polycos */
   /* absphaseP = */ 0,
   /***** -barypolycos: Force the use of polycos for barycentered events */
@@ -216,6 +228,8 @@ static Cmdline cmd = {
   /* accelfileP = */ 0,
   /* accelfile = */ (char*)0,
   /* accelfileC = */ 0,
+  /***** -accelbary: The -accelfile candidates are barycentric (e.g. '_BARY.cand' files from 'accelsearch -topo2bary') */
+  /* accelbaryP = */ 0,
   /***** -bin: Fold a binary pulsar.  Must include all of the following parameters */
   /* binaryP = */ 0,
   /***** -pb: The orbital period (s) */
@@ -1003,6 +1017,20 @@ showOptionValues(void)
     printf("-psrfits found:\n");
   }
 
+  /***** -baseband: Raw complex baseband data in DADA format */
+  if( !cmd.basebandP ) {
+    printf("-baseband not found.\n");
+  } else {
+    printf("-baseband found:\n");
+  }
+
+  /***** -shmring: Raw SIGPROC filterbank data from a shared-memory ring */
+  if( !cmd.shmringP ) {
+    printf("-shmring not found.\n");
+  } else {
+    printf("-shmring found:\n");
+  }
+
   /***** -noweights: Do not apply PSRFITS weights */
   if( !cmd.noweightsP ) {
     printf("-noweights not found.\n");
@@ -1059,6 +1087,30 @@ showOptionValues(void)
     printf("-zerodm found:\n");
   }
 
+  /***** -tscrunch: Number of neighboring spectra to sum (in time) as the raw data are read */
+  if( !cmd.tscrunchP ) {
+    printf("-tscrunch not found.\n");
+  } else {
+    printf("-tscrunch found:\n");
+    if( !cmd.tscrunchC ) {
+      printf("  no values\n");
+    } else {
+      printf("  value = `%d'\n", cmd.tscrunch);
+    }
+  }
+
+  /***** -fscrunch: Number of neighboring channels to sum (in frequency) as the raw data are read */
+  if( !cmd.fscrunchP ) {
+    printf("-fscrunch not found.\n");
+  } else {
+    printf("-fscrunch found:\n");
+    if( !cmd.fscrunchC ) {
+      printf("  no values\n");
+    } else {
+      printf("  value = `%d'\n", cmd.fscrunch);
+    }
+  }
+
   /***** -absphase: Use the absolute phase associated with polycos */
   if( !cmd.absphaseP ) {
     printf("-absphase not found.\n");
@@ -1578,6 +1630,13 @@ showOptionValues(void)
     }
   }
 
+  /***** -accelbary: The -accelfile candidates are barycentric (e.g. '_BARY.cand' files from 'accelsearch -topo2bary') */
+  if( !cmd.accelbaryP ) {
+    printf("-accelbary not found.\n");
+  } else {
+    printf("-accelbary found:\n");
+  }
+
   /***** -bin: Fold a binary pulsar.  Must include all of the following parameters */
   if( !cmd.binaryP ) {
     printf("-bin not found.\n");
@@ -1735,7 +1794,7 @@ showOptionValues(void)
 void
 usage(void)
 {
-  fprintf(stderr,"%s","   [-ncpus ncpus] [-o outfile] [-filterbank] [-psrfits] [-noweights] [-noscales] [-nooffsets] [-wapp] [-window] [-topo] [-invert] [-zerodm] [-absphase] [-barypolycos] [-debug] [-samples] [-normalize] [-numwapps numwapps] [-if ifs] [-clip clip] [-noclip] [-noxwin] [-runavg] [-fine] [-coarse] [-slow] [-searchpdd] [-searchfdd] [-nosearch] [-nopsearch] [-nopdsearch] [-nodmsearch] [-scaleparts] [-allgrey] [-fixchi] [-justprofs] [-dm dm] [-n proflen] [-nsub nsub] [-npart npart] [-pstep pstep] [-pdstep pdstep] [-dmstep dmstep] [-npfact npfact] [-ndmfact ndmfact] [-p p] [-pd pd] [-pdd pdd] [-f f] [-fd fd] [-fdd fdd] [-pfact pfact] [-ffact ffact] [-phs phs] [-start startT] [-end endT] [-psr psrname] [-par parname] [-polycos polycofile] [-timing timing] [-rzwcand rzwcand] [-rzwfile rzwfile] [-accelcand accelcand] [-accelfile accelfile] [-bin] [-pb pb] [-x asinic] [-e e] [-To To] [-w w] [-wdot wdot] [-mask maskfile] [-ignorechan ignorechanstr] [-events] [-days] [-mjds] [-double] [-offset offset] [--] infile ...\n");
+  fprintf(stderr,"%s","   [-ncpus ncpus] [-o outfile] [-filterbank] [-psrfits] [-baseband] [-shmring] [-noweights] [-noscales] [-nooffsets] [-wapp] [-window] [-topo] [-invert] [-zerodm] [-tscrunch tscrunch] [-fscrunch fscrunch] [-absphase] [-barypolycos] [-debug] [-samples] [-normalize] [-numwapps numwapps] [-if ifs] [-clip clip] [-noclip] [-noxwin] [-runavg] [-fine] [-coarse] [-slow] [-searchpdd] [-searchfdd] [-nosearch] [-nopsearch] [-nopdsearch] [-nodmsearch] [-scaleparts] [-allgrey] [-fixchi] [-justprofs] [-dm dm] [-n proflen] [-nsub nsub] [-npart npart] [-pstep pstep] [-pdstep pdstep] [-dmstep dmstep] [-npfact npfact] [-ndmfact ndmfact] [-p p] [-pd pd] [-pdd pdd] [-f f] [-fd fd] [-fdd fdd] [-pfact pfact] [-ffact ffact] [-phs phs] [-start startT] [-end endT] [-psr psrname] [-par parname] [-polycos polycofile] [-timing timing] [-rzwcand rzwcand] [-rzwfile rzwfile] [-accelcand accelcand] [-accelfile accelfile] [-accelbary] [-bin] [-pb pb] [-x asinic] [-e e] [-To To] [-w w] [-wdot wdot] [-mask maskfile] [-ignorechan ignorechanstr] [-events] [-days] [-mjds] [-double] [-offset offset] [--] infile ...\n");
   fprintf(stderr,"%s","      Prepares (if required) and folds raw radio data, standard time series, or events.\n");
   fprintf(stderr,"%s","          -ncpus: Number of processors to use with OpenMP\n");
   fprintf(stderr,"%s","                  1 int value between 1 and oo\n");
@@ -1744,6 +1803,8 @@ usage(void)
   fprintf(stderr,"%s","                  1 char* value\n");
   fprintf(stderr,"%s","     -filterbank: Raw data in SIGPROC filterbank format\n");
   fprintf(stderr,"%s","        -psrfits: Raw data in PSRFITS format\n");
+  fprintf(stderr,"%s","       -baseband: Raw complex baseband data in DADA format\n");
+  fprintf(stderr,"%s","        -shmring: Raw SIGPROC filterbank data from a shared-memory ring\n");
   fprintf(stderr,"%s","      -noweights: Do not apply PSRFITS weights\n");
   fprintf(stderr,"%s","       -noscales: Do not apply PSRFITS scales\n");
   fprintf(stderr,"%s","      -nooffsets: Do not apply PSRFITS offsets\n");
@@ -1752,6 +1813,12 @@ usage(void)
   fprintf(stderr,"%s","           -topo: Fold the data topocentrically (i.e. don't barycenter)\n");
   fprintf(stderr,"%s","         -invert: For rawdata, flip (or invert) the band\n");
   fprintf(stderr,"%s","         -zerodm: Subtract the mean of all channels from each sample (i.e. remove zero DM)\n");
+  fprintf(stderr,"%s","       -tscrunch: Number of neighboring spectra to sum (in time) as the raw data are read\n");
+  fprintf(stderr,"%s","                  1 int value between 1 and 1024\n");
+  fprintf(stderr,"%s","                  default: `1'\n");
+  fprintf(stderr,"%s","       -fscrunch: Number of neighboring channels to sum (in frequency) as the raw data are read\n");
+  fprintf(stderr,"%s","                  1 int value between 1 and 1024\n");
+  fprintf(stderr,"%s","                  default: `1'\n");
   fprintf(stderr,"%s","       -absphase: Use the absolute phase associated with polycos\n");
   fprintf(stderr,"%s","    -barypolycos: Force the use of polycos for barycentered events\n");
   fprintf(stderr,"%s","          -debug: Show debugging output when calling TEMPO for polycos\n");
@@ -1853,6 +1920,7 @@ usage(void)
   fprintf(stderr,"%s","                  1 int value between 1 and oo\n");
   fprintf(stderr,"%s","      -accelfile: Name of the accel search '.cand' file to use (with suffix)\n");
   fprintf(stderr,"%s","                  1 char* value\n");
+  fprintf(stderr,"%s","      -accelbary: The -accelfile candidates are barycentric (e.g. '_BARY.cand' files from 'accelsearch -topo2bary')\n");
   fprintf(stderr,"%s","            -bin: Fold a binary pulsar.  Must include all of the following parameters\n");
   fprintf(stderr,"%s","             -pb: The orbital period (s)\n");
   fprintf(stderr,"%s","                  1 double value between 0 and oo\n");
@@ -1926,6 +1994,16 @@ parseCmdline(int argc, char **argv)
       continue;
     }
 
+    if( 0==strcmp("-baseband", argv[i]) ) {
+      cmd.basebandP = 1;
+      continue;
+    }
+
+    if( 0==strcmp("-shmring", argv[i]) ) {
+      cmd.shmringP = 1;
+      continue;
+    }
+
     if( 0==strcmp("-noweights", argv[i]) ) {
       cmd.noweightsP = 1;
       continue;
@@ -1966,6 +2044,26 @@ parseCmdline(int argc, char **argv)
       continue;
     }
 
+    if( 0==strcmp("-tscrunch", argv[i]) ) {
+      int keep = i;
+      cmd.tscrunchP = 1;
+      i = getIntOpt(argc, argv, i, &cmd.tscrunch, 1);
+      cmd.tscrunchC = i-keep;
+      checkIntLower("-tscrunch", &cmd.tscrunch, cmd.tscrunchC, 1024);
+      checkIntHigher("-tscrunch", &cmd.tscrunch, cmd.tscrunchC, 1);
+      continue;
+    }
+
+    if( 0==strcmp("-fscrunch", argv[i]) ) {
+      int keep = i;
+      cmd.fscrunchP = 1;
+      i = getIntOpt(argc, argv, i, &cmd.fscrunch, 1);
+      cmd.fscrunchC = i-keep;
+      checkIntLower("-fscrunch", &cmd.fscrunch, cmd.fscrunchC, 1024);
+      checkIntHigher("-fscrunch", &cmd.fscrunch, cmd.fscrunchC, 1);
+      continue;
+    }
+
     if( 0==strcmp("-absphase", argv[i]) ) {
       cmd.absphaseP = 1;
       continue;
@@ -2354,6 +2452,11 @@ parseCmdline(int argc, char **argv)
       continue;
     }
 
+    if( 0==strcmp("-accelbary", argv[i]) ) {
+      cmd.accelbaryP = 1;
+      continue;
+    }
+
     if( 0==strcmp("-bin", argv[i]) ) {
       cmd.binaryP = 1;
       continue;
@@ -10,7 +10,7 @@
 #include <omp.h>
 #endif
 
-#define RAWDATA (cmd->filterbankP || cmd->psrfitsP)
+#define RAWDATA (cmd->filterbankP || cmd->psrfitsP || cmd->basebandP || cmd->shmringP)
 
 /* This causes the barycentric motion to be calculated once per TDT sec */
 #define TDT 20.0
@@ -102,6 +102,8 @@ int main(int argc, char *argv[])
     s.apply_scale = (cmd->noscalesP) ? 0 : -1;
     s.apply_offset = (cmd->nooffsetsP) ? 0 : -1;
     s.remove_zerodm = (cmd->zerodmP) ? 1 : 0;
+    s.tscrunch = cmd->tscrunch;
+    s.fscrunch = cmd->fscrunch;
     if (cmd->noclipP) {
         cmd->clip = 0.0;
         s.clip_sigma = 0.0;
@@ -141,12 +143,20 @@ int main(int argc, char *argv[])
             s.datatype = SIGPROCFB;
         else if (cmd->psrfitsP)
             s.datatype = PSRFITS;
+        else if (cmd->basebandP)
+            s.datatype = BASEBAND;
+        else if (cmd->shmringP)
+            s.datatype = SHMRING;
     } else {                    // Attempt to auto-identify the data
         identify_psrdatatype(&s, 1);
         if (s.datatype == SIGPROCFB)
             cmd->filterbankP = 1;
         else if (s.datatype == PSRFITS)
             cmd->psrfitsP = 1;
+        else if (s.datatype == BASEBAND)
+            cmd->basebandP = 1;
+        else if (s.datatype == SHMRING)
+            cmd->shmringP = 1;
         else if (s.datatype == SUBBAND)
             insubs = 1;
         else {
@@ -1008,6 +1018,9 @@ static int get_data(float **outdata, int blocksperread,
             break;
     }
     if (!cmd->subP) {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) default(shared)
+#endif
         for (ii = 0; ii < cmd->numdms; ii++)
             float_dedisp(currentdsdata, lastdsdata, dsworklen,
                          cmd->nsub, offsets[ii], 0.0, outdata[ii]);
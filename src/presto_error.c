@@ -0,0 +1,115 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <string.h>
+#include <errno.h>
+#include "presto_error.h"
+
+/* The error contexts are per-thread so that separate threads (or  */
+/* the Python wrappers) can trap errors independently.             */
+static __thread presto_errctx *current_ctx = NULL;
+static __thread presto_status last_status = PRESTO_OK;
+static __thread char last_msg[512] = "";
+
+static const char *status_strings[] = {
+    "No error",
+    "Memory allocation failed",
+    "I/O error",
+    "Unexpected end of file",
+    "Bad file format",
+    "Bad value"
+};
+
+
+void presto_begin_try(presto_errctx * ctx)
+{
+    ctx->prev = current_ctx;
+    ctx->status = PRESTO_OK;
+    ctx->msg[0] = '\0';
+    current_ctx = ctx;
+}
+
+
+void presto_end_try(presto_errctx * ctx)
+{
+    if (current_ctx != ctx) {
+        printf("\nError:  presto_end_try() called for the wrong context!\n\n");
+        exit(-1);
+    }
+    current_ctx = ctx->prev;
+}
+
+
+int presto_trapping_errors(void)
+{
+    return (current_ctx != NULL);
+}
+
+
+static void raise_error(presto_status status, const char *fmt, va_list ap,
+                        int errnum)
+{
+    presto_errctx *ctx;
+    size_t len;
+
+    vsnprintf(last_msg, sizeof(last_msg), fmt, ap);
+    if (errnum) {
+        len = strlen(last_msg);
+        snprintf(last_msg + len, sizeof(last_msg) - len, ":  %s",
+                 strerror(errnum));
+    }
+    last_status = status;
+    if (current_ctx == NULL) {
+        printf("\nError:  %s\n\n", last_msg);
+        fflush(NULL);
+        exit(-1);
+    }
+    ctx = current_ctx;
+    current_ctx = ctx->prev;
+    ctx->status = status;
+    strcpy(ctx->msg, last_msg);
+    longjmp(ctx->env, 1);
+}
+
+
+void presto_error(presto_status status, const char *fmt, ...)
+{
+    va_list ap;
+
+    va_start(ap, fmt);
+    raise_error(status, fmt, ap, 0);
+    va_end(ap);
+    exit(-1);                   /* Not reached */
+}
+
+
+void presto_perror(presto_status status, const char *fmt, ...)
+{
+    va_list ap;
+    int errnum = errno;
+
+    va_start(ap, fmt);
+    raise_error(status, fmt, ap, errnum ? errnum : EIO);
+    va_end(ap);
+    exit(-1);                   /* Not reached */
+}
+
+
+presto_status presto_last_status(void)
+{
+    return last_status;
+}
+
+
+const char *presto_last_error(void)
+{
+    return last_msg;
+}
+
+
+const char *presto_status_string(presto_status status)
+{
+    if (status < PRESTO_OK || status > PRESTO_ERR_VALUE)
+        return "Unknown error";
+    return status_strings[status];
+}
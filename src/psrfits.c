@@ -1,5 +1,8 @@
 #include <sys/types.h>
+#include <sys/stat.h>
+#include <unistd.h>
 #include <pwd.h>
+#include <stdarg.h>
 #include "presto.h"
 #include "mask.h"
 #include "psrfits.h"
@@ -29,9 +32,26 @@ double DATEOBS_to_MJD(char *dateobs, int *mjd_day, double *mjd_fracday)
     return *mjd_day + *mjd_fracday;
 }
 
-int is_PSRFITS(char *filename)
-// Return 1 if the file described by filename is a PSRFITS file
-// Return 0 otherwise.
+static void scan_msg(char **msgs, const char *fmt, ...)
+// Add a printf()-style message to the malloc()ed string *msgs (which
+// starts as NULL).  The header scans run in parallel, so their
+// messages are saved and printed later in file order.
+{
+    va_list ap;
+    int len = (*msgs) ? strlen(*msgs) : 0, msglen;
+
+    va_start(ap, fmt);
+    msglen = vsnprintf(NULL, 0, fmt, ap);
+    va_end(ap);
+    *msgs = (char *) realloc(*msgs, len + msglen + 1);
+    va_start(ap, fmt);
+    vsnprintf(*msgs + len, msglen + 1, fmt, ap);
+    va_end(ap);
+}
+
+static int check_PSRFITS(char *filename, char **msgs)
+// Return 1 if the file described by filename is a search-mode PSRFITS
+// file, 0 otherwise.  Any messages are added to *msgs (see scan_msg()).
 {
     fitsfile *fptr;
     int status = 0;
@@ -41,7 +61,7 @@ int is_PSRFITS(char *filename)
     fits_open_file(&fptr, filename, READONLY, &status);
     if (status) {
         fits_get_errstatus(status, err_text);
-        printf("Error %d opening %s : %s\n", status, filename, err_text);
+        scan_msg(msgs, "Error %d opening %s : %s\n", status, filename, err_text);
         fits_close_file(fptr, &status);
         return 0;
     }
@@ -50,13 +70,13 @@ int is_PSRFITS(char *filename)
     fits_read_key(fptr, TSTRING, "FITSTYPE", ctmp, comment, &status);
     if (status) {
         fits_get_errstatus(status, err_text);
-        printf("Error %d reading 'FITSTYPE' from %s : %s\n",
-               status, filename, err_text);
+        scan_msg(msgs, "Error %d reading 'FITSTYPE' from %s : %s\n",
+                       status, filename, err_text);
         fits_close_file(fptr, &status);
         return 0;
     } else {
         if (strcmp(ctmp, "PSRFITS")) {
-            printf("Error 'FITSTYPE' is not 'PSRFITS' in %s\n", filename);
+            scan_msg(msgs, "Error 'FITSTYPE' is not 'PSRFITS' in %s\n", filename);
             fits_close_file(fptr, &status);
             return 0;
         }
@@ -66,13 +86,13 @@ int is_PSRFITS(char *filename)
     fits_read_key(fptr, TSTRING, "OBS_MODE", ctmp, comment, &status);
     if (status) {
         fits_get_errstatus(status, err_text);
-        printf("Error %d reading 'OBS_MODE' from %s : %s\n",
-               status, filename, err_text);
+        scan_msg(msgs, "Error %d reading 'OBS_MODE' from %s : %s\n",
+                       status, filename, err_text);
         fits_close_file(fptr, &status);
         return 0;
     } else {
         if ((strcmp(ctmp, "SEARCH") && strcmp(ctmp, "SRCH"))) {
-            printf("Error 'OBS_MODE' is not 'SEARCH' in %s\n", filename);
+            scan_msg(msgs, "Error 'OBS_MODE' is not 'SEARCH' in %s\n", filename);
             fits_close_file(fptr, &status);
             return 0;
         }
@@ -81,523 +101,951 @@ int is_PSRFITS(char *filename)
     return 1;                   // it is search-mode  PSRFITS
 }
 
+int is_PSRFITS(char *filename)
+// Return 1 if the file described by filename is a PSRFITS file
+// Return 0 otherwise.
+{
+    char *msgs = NULL;
+    int retval = check_PSRFITS(filename, &msgs);
+
+    if (msgs) {
+        printf("%s", msgs);
+        free(msgs);
+    }
+    return retval;
+}
+
 #define check_read_status(name) {                                   \
         if (status) {\
             fits_get_errstatus(status, err_text); \
-            printf("Error %d reading %s : %s\n", status, name, err_text); \
+            scan_msg(msgs, "Error %d reading %s : %s\n", status, name, err_text); \
             status=0;      \
         }                                                               \
     }
 
-#define get_hdr_string(name, param) {                                   \
-        fits_read_key(s->fitsfiles[ii], TSTRING, (name), ctmp, comment, &status); \
-        if (status) {\
-            fits_get_errstatus(status, err_text); \
-            printf("Error %d reading %s : %s\n", status, name, err_text); \
-            if (ii==0) param[0]='\0'; \
-            if (status==KEY_NO_EXIST) status=0;                       \
-        } else {                                                      \
-            if (ii==0) {                                              \
-                if (sizeof(ctmp) > sizeof((param))) {                 \
-                    strncpy((param), ctmp, sizeof(param));            \
-                    (param)[sizeof((param))-1] = '\0';                \
-                } else {                                              \
-                    strncpy((param), ctmp, sizeof((param)));          \
-                }                                                     \
-            } else if (strcmp((param), ctmp)!=0)                      \
-                printf("Warning!:  %s values don't match for files 0 and %d!\n", \
-                       (name), ii);                                         \
+// The header keys that should match in all of the files.  Bit
+// (1 << HDR_XXX) of psrfits_fileinfo.missing is set if XXX is missing.
+enum {
+    HDR_TELESCOP, HDR_OBSERVER, HDR_SRC_NAME, HDR_FRONTEND, HDR_BACKEND,
+    HDR_PROJID, HDR_DATE_OBS, HDR_FD_POLN, HDR_RA, HDR_DEC, HDR_OBSFREQ,
+    HDR_OBSNCHAN, HDR_OBSBW, HDR_BMIN, HDR_TBIN, HDR_NCHAN, HDR_NPOL,
+    HDR_POL_TYPE, HDR_NSBLK, HDR_NBITS
+};
+
+// Bits for psrfits_fileinfo.flags
+#define PF_NO_OFFS_SUB   0x0001 // No OFFS_SUB column
+#define PF_NSUBOFFS_BAD  0x0002 // NSUBOFFS is less than OFFS_SUB implies
+#define PF_OFFS_SUB_ZERO 0x0004 // All of the OFFS_SUB are 0.0
+#define PF_NO_INDEXVAL   0x0008 // ... and there is no INDEXVAL column
+#define PF_NO_DATA       0x0010 // No DATA column
+#define PF_NO_TEL_AZ     0x0020 // No TEL_AZ column
+#define PF_NO_TEL_ZEN    0x0040 // No TEL_ZEN column
+#define PF_NO_DAT_FREQ   0x0080 // No DAT_FREQ column
+#define PF_DF_CHANGES    0x0100 // The channel spacing changes in the file
+#define PF_NO_DAT_WTS    0x0200 // No DAT_WTS column
+#define PF_NO_DAT_OFFS   0x0400 // No DAT_OFFS column
+#define PF_NO_DAT_SCL    0x0800 // No DAT_SCL column
+#define PF_USE_DAT_WTS   0x1000 // The DAT_WTS in row 1 are not all 1.0
+#define PF_USE_DAT_OFFS  0x2000 // The DAT_OFFS in row 1 are not all 0.0
+#define PF_USE_DAT_SCL   0x4000 // The DAT_SCL in row 1 are not all 1.0
+
+// Fatal problems found during the scan of a file
+enum { PF_OK, PF_NOT_PSRFITS, PF_NOT_SEARCH, PF_BAD_OFFS_SUB };
+
+// Everything read_PSRFITS_files() needs from each file.  These are
+// what gets stored in the index files, so bump PSRFITS_INDEX_VERSION
+// if anything here changes.
+typedef struct PSRFITS_FILEINFO {
+    char telescope[40];
+    char observer[100];
+    char source[100];
+    char frontend[100];
+    char backend[100];
+    char project_id[40];
+    char date_obs[40];
+    char poln_type[40];
+    char ra_str[40];
+    char dec_str[40];
+    char poln_order[40];
+    long double start_MJD;      // From STT_*MJD, STT_OFFS, and BE_DELAY
+    double fctr;
+    double orig_df;
+    double beam_FWHM;
+    double chan_dm;
+    double dt;
+    double azimuth;
+    double zenith_ang;
+    double lo_freq;             // Freq of the 1st channel
+    double hi_freq;             // Freq of the last channel
+    double df;                  // Mean channel spacing
+    double df01;                // Spacing of the first two channels
+    float zero_offset;
+    int orig_num_chan;
+    int num_channels;
+    int num_polns;
+    int nchnoffs;
+    int spectra_per_subint;
+    int bits_per_sample;
+    int tracking;
+    int num_subint;
+    int nsuboffs;               // NSUBOFFS from the header
+    int start_subint;           // After checking OFFS_SUB and INDEXVAL
+    int offs_sub_col;
+    int data_col;
+    int FITS_typecode;
+    int dat_wts_col;
+    int dat_offs_col;
+    int dat_scl_col;
+    int missing;                // Bitmask of the missing HDR_* keys
+    int flags;                  // Bitmask of PF_* flags
+    int error;                  // PF_OK or a fatal problem
+} psrfits_fileinfo;
+
+// The index file (filenames[0] + PSRFITS_INDEX_SUFFIX) stores one of
+// these for every file, so that we only have to re-read the headers
+// of files that are new or have changed.
+#define PSRFITS_INDEX_MAGIC   "PRESTO_PFIDX"
+#define PSRFITS_INDEX_VERSION 1
+#define PSRFITS_INDEX_SUFFIX  ".pfidx"
+#define PSRFITS_SUMBYTES      (4 * 2880)
+
+typedef struct PSRFITS_INDEXENTRY {
+    char filename[256];         // Without the path
+    long long size;             // File size in bytes
+    long long mtime;            // Modification time
+    unsigned long long checksum;        // Of the first PSRFITS_SUMBYTES
+    psrfits_fileinfo info;
+} psrfits_indexentry;
+
+#define scan_hdr_string(key, name, param) {                             \
+        fits_read_key(fptr, TSTRING, (name), ctmp, comment, &status);   \
+        if (status) {                                                   \
+            fits_get_errstatus(status, err_text);                       \
+            scan_msg(msgs, "Error %d reading %s : %s\n", status, name, err_text); \
+            fi->missing |= 1 << (key);                                  \
+            if (status==KEY_NO_EXIST) status=0;                         \
+        } else {                                                        \
+            strncpy(fi->param, ctmp, sizeof(fi->param));                \
+            fi->param[sizeof(fi->param)-1] = '\0';                      \
         }                                                               \
     }
 
-#define get_hdr_int(name, param) {                                      \
-        fits_read_key(s->fitsfiles[ii], TINT, (name), &itmp, comment, &status); \
-        if (status) {\
-            fits_get_errstatus(status, err_text); \
-            printf("Error %d reading %s : %s\n", status, name, err_text); \
-            if (ii==0) param=0; \
-            if (status==KEY_NO_EXIST) status=0;\
-        } else {                                                          \
-            if (ii==0) param = itmp;                                        \
-            else if (param != itmp)                                         \
-                printf("Warning!:  %s values don't match for files 0 and %d!\n", \
-                       (name), ii);                                         \
+#define scan_hdr_value(key, type, name, tmp, param) {                   \
+        fits_read_key(fptr, (type), (name), &(tmp), comment, &status);  \
+        if (status) {                                                   \
+            fits_get_errstatus(status, err_text);                       \
+            scan_msg(msgs, "Error %d reading %s : %s\n", status, name, err_text); \
+            fi->missing |= 1 << (key);                                  \
+            if (status==KEY_NO_EXIST) status=0;                         \
+        } else {                                                        \
+            fi->param = (tmp);                                          \
         }                                                               \
     }
 
-#define get_hdr_double(name, param) {                                   \
-        fits_read_key(s->fitsfiles[ii], TDOUBLE, (name), &dtmp, comment, &status); \
-        if (status) {\
-            fits_get_errstatus(status, err_text); \
-            printf("Error %d reading %s : %s\n", status, name, err_text); \
-            if (ii==0.0) param=0.0; \
-            if (status==KEY_NO_EXIST) status=0;\
-        } else {                                                          \
-            if (ii==0) param = dtmp;                                  \
-            else if ((strcmp(name, "BMIN") != 0) && (param != dtmp))                                   \
+#define get_hdr_string(key, name, param) {                              \
+        if (fi->missing & (1 << (key))) {                               \
+            if (ii==0) s->param[0]='\0';                                \
+        } else {                                                        \
+            if (ii==0) {                                                \
+                strcpy(s->param, fi->param);                            \
+            } else if (strcmp(s->param, fi->param)!=0)                  \
                 printf("Warning!:  %s values don't match for files 0 and %d!\n", \
-                       (name), ii);                                   \
-        }                                                                 \
+                       (name), ii);                                     \
+        }                                                               \
     }
 
+#define get_hdr_value(key, name, param) {                               \
+        if (fi->missing & (1 << (key))) {                               \
+            if (ii==0) s->param=0;                                      \
+        } else {                                                        \
+            if (ii==0) s->param = fi->param;                            \
+            else if (s->param != fi->param)                             \
+                printf("Warning!:  %s values don't match for files 0 and %d!\n", \
+                       (name), ii);                                     \
+        }                                                               \
+    }
 
 
-void read_PSRFITS_files(struct spectra_info *s)
-// Read and convert PSRFITS information from a group of files
-// and place the resulting info into a spectra_info structure.
+static fitsfile *scan_PSRFITS_file(char *filename, psrfits_fileinfo * fi,
+                                   char **msgs)
+// Read everything that read_PSRFITS_files() needs from the headers
+// and the first row of a PSRFITS file.  This only touches 'fi' and
+// '*msgs' (and doesn't exit on errors) so that files can be scanned
+// in parallel.  Return the open file, positioned at the SUBINT HDU,
+// or NULL.
 {
-    int IMJD, SMJD, itmp, ii, status = 0;
-    double OFFS, BE_DELAY, dtmp;
-    long double MJDf;
+    fitsfile *fptr;
+    int IMJD, SMJD, itmp, status = 0;
+    double OFFS, BE_DELAY, dtmp, time_per_subint;
     char ctmp[80], comment[120], err_text[81];
 
-    s->datatype = PSRFITS;
-    s->fitsfiles = (fitsfile **) malloc(sizeof(fitsfile *) * s->num_files);
-    s->start_subint = gen_ivect(s->num_files);
-    s->num_subint = gen_ivect(s->num_files);
-    s->start_spec = (long long *) malloc(sizeof(long long) * s->num_files);
-    s->num_spec = (long long *) malloc(sizeof(long long) * s->num_files);
-    s->num_pad = (long long *) malloc(sizeof(long long) * s->num_files);
-    s->start_MJD = (long double *) malloc(sizeof(long double) * s->num_files);
-    s->N = 0;
-    s->num_beams = 1;
-    s->get_rawblock = &get_PSRFITS_rawblock;
-    s->offset_to_spectra = &offset_to_PSRFITS_spectra;
+    memset(fi, 0, sizeof(psrfits_fileinfo));
 
-    // By default, don't flip the band.  But don't change
-    // the input value if it is aleady set to flip the band always
-    if (s->apply_flipband == -1)
-        s->apply_flipband = 0;
+    // Is the file a PSRFITS file?
+    if (!check_PSRFITS(filename, msgs)) {
+        fi->error = PF_NOT_PSRFITS;
+        return NULL;
+    }
+    // Open the PSRFITS file
+    fits_open_file(&fptr, filename, READONLY, &status);
 
-    // Step through the other files
-    for (ii = 0; ii < s->num_files; ii++) {
+    // Is the data in search mode?
+    fits_read_key(fptr, TSTRING, "OBS_MODE", ctmp, comment, &status);
+    check_read_status("OBS_MODE");
+    // Quick fix for Parkes DFB data (SRCH?  why????)...
+    if (strcmp("SRCH", ctmp) == 0) {
+        strncpy(ctmp, "SEARCH", sizeof(ctmp));
+    }
+    if (strcmp(ctmp, "SEARCH")) {
+        fi->error = PF_NOT_SEARCH;
+        fits_close_file(fptr, &status);
+        return NULL;
+    }
+    // Now get the stuff we need from the primary HDU header
+    fits_read_key(fptr, TSTRING, "TELESCOP", ctmp, comment, &status);
+    // Quick fix for MockSpec data...
+    if (strcmp("ARECIBO 305m", ctmp) == 0) {
+        strncpy(ctmp, "Arecibo", sizeof(ctmp));
+    }
+    // Quick fix for Parkes DFB data...
+    {
+        char newctmp[80];
 
-        // Is the file a PSRFITS file?
-        if (!is_PSRFITS(s->filenames[ii])) {
-            fprintf(stderr,
-                    "\nError!  File '%s' does not appear to be PSRFITS!\n",
-                    s->filenames[ii]);
-            exit(1);
+        // Copy ctmp first since strlower() is in-place
+        strcpy(newctmp, ctmp);
+        if (strcmp("parkes", strlower(remove_whitespace(newctmp))) == 0) {
+            strncpy(ctmp, "Parkes", sizeof(ctmp));
         }
-        // Open the PSRFITS file
-        fits_open_file(&(s->fitsfiles[ii]), s->filenames[ii], READONLY, &status);
-
-        // Is the data in search mode?
-        fits_read_key(s->fitsfiles[ii], TSTRING, "OBS_MODE", ctmp, comment, &status);
-        check_read_status("OBS_MODE");
-        // Quick fix for Parkes DFB data (SRCH?  why????)...
-        if (strcmp("SRCH", ctmp) == 0) {
-            strncpy(ctmp, "SEARCH", sizeof(ctmp));
-        }
-        if (strcmp(ctmp, "SEARCH")) {
-            fprintf(stderr,
-                    "\nError!  File '%s' does not contain SEARCH-mode data!\n",
-                    s->filenames[ii]);
-            exit(1);
+    }
+    if (status) {
+        scan_msg(msgs, "Error %d reading key %s\n", status, "TELESCOP");
+        fi->missing |= 1 << HDR_TELESCOP;
+        if (status == KEY_NO_EXIST)
+            status = 0;
+    } else {
+        strncpy(fi->telescope, ctmp, sizeof(fi->telescope));
+        // ensure that we are null-terminated
+        fi->telescope[sizeof(fi->telescope) - 1] = '\0';
+    }
+
+    scan_hdr_string(HDR_OBSERVER, "OBSERVER", observer);
+    scan_hdr_string(HDR_SRC_NAME, "SRC_NAME", source);
+    scan_hdr_string(HDR_FRONTEND, "FRONTEND", frontend);
+    scan_hdr_string(HDR_BACKEND, "BACKEND", backend);
+    scan_hdr_string(HDR_PROJID, "PROJID", project_id);
+    scan_hdr_string(HDR_DATE_OBS, "DATE-OBS", date_obs);
+    scan_hdr_string(HDR_FD_POLN, "FD_POLN", poln_type);
+    scan_hdr_string(HDR_RA, "RA", ra_str);
+    scan_hdr_string(HDR_DEC, "DEC", dec_str);
+    scan_hdr_value(HDR_OBSFREQ, TDOUBLE, "OBSFREQ", dtmp, fctr);
+    scan_hdr_value(HDR_OBSNCHAN, TINT, "OBSNCHAN", itmp, orig_num_chan);
+    scan_hdr_value(HDR_OBSBW, TDOUBLE, "OBSBW", dtmp, orig_df);
+    scan_hdr_value(HDR_BMIN, TDOUBLE, "BMIN", dtmp, beam_FWHM);
+
+    /* This is likely not in earlier versions of PSRFITS */
+    fits_read_key(fptr, TDOUBLE, "CHAN_DM", &(fi->chan_dm), comment, &status);
+    if (status==KEY_NO_EXIST) status=0; // Prevents error messages on old files
+    check_read_status("CHAN_DM");
+    // Don't use the macros unless you are using the struct!
+    fits_read_key(fptr, TINT, "STT_IMJD", &IMJD, comment, &status);
+    check_read_status("STT_IMJD");
+    fits_read_key(fptr, TINT, "STT_SMJD", &SMJD, comment, &status);
+    check_read_status("STT_SMJD");
+    fits_read_key(fptr, TDOUBLE, "STT_OFFS", &OFFS, comment, &status);
+    check_read_status("STT_OFFS");
+    BE_DELAY = 0.0; // Back-end delay.  Will only be applied to STT*-based times
+    fits_read_key(fptr, TDOUBLE, "BE_DELAY", &BE_DELAY, comment, &status);
+    if (status==KEY_NO_EXIST) status=0; // Prevents error messages on old files
+    check_read_status("BE_DELAY");
+    fi->start_MJD = (long double) IMJD + ((long double) SMJD +
+                                          (long double) OFFS +
+                                          (long double) BE_DELAY) / SECPERDAY;
+
+    // Are we tracking?
+    fits_read_key(fptr, TSTRING, "TRK_MODE", ctmp, comment, &status);
+    check_read_status("TRK_MODE");
+    fi->tracking = (strcmp("TRACK", ctmp) == 0) ? 1 : 0;
+
+    // Now switch to the SUBINT HDU header
+    fits_movnam_hdu(fptr, BINARY_TBL, "SUBINT", 0, &status);
+    check_read_status("SUBINT");
+    scan_hdr_value(HDR_TBIN, TDOUBLE, "TBIN", dtmp, dt);
+    scan_hdr_value(HDR_NCHAN, TINT, "NCHAN", itmp, num_channels);
+    scan_hdr_value(HDR_NPOL, TINT, "NPOL", itmp, num_polns);
+    scan_hdr_string(HDR_POL_TYPE, "POL_TYPE", poln_order);
+    fits_read_key(fptr, TINT, "NCHNOFFS", &(fi->nchnoffs), comment, &status);
+    check_read_status("NCHNOFFS");
+    scan_hdr_value(HDR_NSBLK, TINT, "NSBLK", itmp, spectra_per_subint);
+    scan_hdr_value(HDR_NBITS, TINT, "NBITS", itmp, bits_per_sample);
+    fits_read_key(fptr, TINT, "NAXIS2", &(fi->num_subint), comment, &status);
+    check_read_status("NAXIS2");
+    fits_read_key(fptr, TINT, "NSUBOFFS", &(fi->nsuboffs), comment, &status);
+    check_read_status("NSUBOFFS");
+    fi->start_subint = fi->nsuboffs;
+    time_per_subint = fi->dt * fi->spectra_per_subint;
+
+    /* This is likely not in earlier versions of PSRFITS */
+    fits_read_key(fptr, TFLOAT, "ZERO_OFF", &(fi->zero_offset), comment, &status);
+    if (status==KEY_NO_EXIST) status=0; // Prevents error messages on old files
+    check_read_status("ZERO_OFF");
+    fi->zero_offset = fabs(fi->zero_offset);
+
+    // Get the time offset column info and the offset for the 1st row
+    {
+        double offs_sub = 0.0;
+        int anynull, numrows;
+
+        // Identify the OFFS_SUB column number
+        fits_get_colnum(fptr, 0, "OFFS_SUB", &(fi->offs_sub_col), &status);
+        if (status == COL_NOT_FOUND) {
+            fi->flags |= PF_NO_OFFS_SUB;
+            status = 0;     // Reset status
         }
-        // Now get the stuff we need from the primary HDU header
-        fits_read_key(s->fitsfiles[ii], TSTRING, "TELESCOP", ctmp, comment, &status);
-        // Quick fix for MockSpec data...
-        if (strcmp("ARECIBO 305m", ctmp) == 0) {
-            strncpy(ctmp, "Arecibo", sizeof(ctmp));
+
+        // Read the OFFS_SUB column value for the 1st row
+        fits_read_col(fptr, TDOUBLE, fi->offs_sub_col, 1L, 1L, 1L,
+                      0, &offs_sub, &anynull, &status);
+
+        if (offs_sub != 0.0) {
+            numrows = (int) ((offs_sub - 0.5 * time_per_subint) /
+                             time_per_subint + 1e-7);
+            // Check to see if any rows have been deleted or are missing
+            if (numrows > fi->start_subint)
+                fi->flags |= PF_NSUBOFFS_BAD;
+            fi->start_subint = numrows;
+        } else {
+            int indexval_col, jj;
+
+            // If OFFS_SUB are all 0.0, then we will assume that there are
+            // no gaps in the file.  This isn't truly proper PSRFITS, but
+            // we should still be able to handle it
+            for (jj = 1; jj <= fi->num_subint; jj++) {
+                fits_read_col(fptr, TDOUBLE, fi->offs_sub_col, jj, 1L, 1L,
+                              0, &offs_sub, &anynull, &status);
+                if (offs_sub != 0.0) {
+                    fi->error = PF_BAD_OFFS_SUB;
+                    fits_close_file(fptr, &status);
+                    return NULL;
+                }
+            }
+            fi->flags |= PF_OFFS_SUB_ZERO;
+            // Check to see if there is an INDEXVAL column.  That should tell
+            // us if we are missing any subints.  Use it in lieu of OFFS_SUB
+            fits_get_colnum(fptr, 0, "INDEXVAL", &indexval_col, &status);
+            if (status == COL_NOT_FOUND) {
+                fi->flags |= PF_NO_INDEXVAL;
+                status = 0; // Reset status
+                fi->start_subint = 0;
+            } else {
+                double subint_index;
+                // Read INDEXVAL
+                fits_read_col(fptr, TDOUBLE, indexval_col, 1L, 1L, 1L,
+                              0, &subint_index, &anynull, &status);
+                fi->start_subint = (int) (subint_index + 1e-7 - 1.0);
+            }
         }
-        // Quick fix for Parkes DFB data...
-        {
-            char newctmp[80];
-
-            // Copy ctmp first since strlower() is in-place
-            strcpy(newctmp, ctmp);
-            if (strcmp("parkes", strlower(remove_whitespace(newctmp))) == 0) {
-                strncpy(ctmp, "Parkes", sizeof(ctmp));
+    }
+
+    // Now pull stuff from the other columns
+    {
+        float ftmp;
+        long repeat, width;
+        int colnum, anynull, jj;
+
+        // Identify the data column and the data type
+        fits_get_colnum(fptr, 0, "DATA", &(fi->data_col), &status);
+        if (status == COL_NOT_FOUND) {
+            fi->flags |= PF_NO_DATA;
+            status = 0;     // Reset status
+        } else {
+            fits_get_coltype(fptr, fi->data_col, &(fi->FITS_typecode),
+                             &repeat, &width, &status);
+            // This makes CFITSIO treat 1-bit data as written in 'B' mode
+            // even if it was written in 'X' mode originally.  This means
+            // that we unpack it ourselves.
+            if (fi->bits_per_sample < 8 && fi->FITS_typecode == 1) {
+                fi->FITS_typecode = 11;
             }
         }
-        if (status) {
-            printf("Error %d reading key %s\n", status, "TELESCOP");
-            if (ii == 0)
-                s->telescope[0] = '\0';
-            if (status == KEY_NO_EXIST)
-                status = 0;
+
+        // Telescope azimuth
+        fits_get_colnum(fptr, 0, "TEL_AZ", &colnum, &status);
+        if (status == COL_NOT_FOUND) {
+            fi->flags |= PF_NO_TEL_AZ;
+            status = 0;     // Reset status
         } else {
-            if (ii == 0) {
-                strncpy(s->telescope, ctmp, sizeof(s->telescope));
-                // ensure that we are null-terminated
-                s->telescope[sizeof(s->telescope)-1] = '\0';
-            } else if (strcmp(s->telescope, ctmp) != 0)
-                printf("Warning!:  %s values don't match for files 0 and %d!\n",
-                       "TELESCOP", ii);
+            fits_read_col(fptr, TFLOAT, colnum,
+                          1L, 1L, 1L, 0, &ftmp, &anynull, &status);
+            fi->azimuth = (double) ftmp;
         }
 
-        get_hdr_string("OBSERVER", s->observer);
-        get_hdr_string("SRC_NAME", s->source);
-        get_hdr_string("FRONTEND", s->frontend);
-        get_hdr_string("BACKEND", s->backend);
-        get_hdr_string("PROJID", s->project_id);
-        get_hdr_string("DATE-OBS", s->date_obs);
-        get_hdr_string("FD_POLN", s->poln_type);
-        get_hdr_string("RA", s->ra_str);
-        get_hdr_string("DEC", s->dec_str);
-        get_hdr_double("OBSFREQ", s->fctr);
-        get_hdr_int("OBSNCHAN", s->orig_num_chan);
-        get_hdr_double("OBSBW", s->orig_df);
-        //get_hdr_double("CHAN_DM", s->chan_dm);
-        get_hdr_double("BMIN", s->beam_FWHM);
-        // There is a VEGAS PSRFITS header bug where the beamwidth
-        // was fixed at 65 deg(!).  This IDs and fixes that
-        if ((strcmp("VEGAS", s->backend) == 0) && (s->beam_FWHM == 65.0)) {
-            // beam_halfwidth() returns halfwidth in arcsec
-            s->beam_FWHM = 2 * beam_halfwidth(s->fctr, 100.0) / 3600.0; // 100m for GBT
+        // Telescope zenith angle
+        fits_get_colnum(fptr, 0, "TEL_ZEN", &colnum, &status);
+        if (status == COL_NOT_FOUND) {
+            fi->flags |= PF_NO_TEL_ZEN;
+            status = 0;     // Reset status
+        } else {
+            fits_read_col(fptr, TFLOAT, colnum,
+                          1L, 1L, 1L, 0, &ftmp, &anynull, &status);
+            fi->zenith_ang = (double) ftmp;
         }
 
-        /* This is likely not in earlier versions of PSRFITS */
-        s->chan_dm = 0.0;
-        fits_read_key(s->fitsfiles[ii], TDOUBLE, "CHAN_DM",
-                      &(s->chan_dm), comment, &status);
-        if (status==KEY_NO_EXIST) status=0; // Prevents error messages on old files
-        check_read_status("CHAN_DM");
-        // Don't use the macros unless you are using the struct!
-        fits_read_key(s->fitsfiles[ii], TINT, "STT_IMJD", &IMJD, comment, &status);
-        check_read_status("STT_IMJD");
-        s->start_MJD[ii] = (long double) IMJD;
-        fits_read_key(s->fitsfiles[ii], TINT, "STT_SMJD", &SMJD, comment, &status);
-        check_read_status("STT_SMJD");
-        fits_read_key(s->fitsfiles[ii], TDOUBLE, "STT_OFFS", &OFFS, comment,
-                      &status);
-        check_read_status("STT_OFFS");
-        BE_DELAY = 0.0; // Back-end delay.  Will only be applied to STT*-based times
-        fits_read_key(s->fitsfiles[ii], TDOUBLE, "BE_DELAY", &BE_DELAY, comment,
-                      &status);
-        if (status==KEY_NO_EXIST) status=0; // Prevents error messages on old files
-        check_read_status("BE_DELAY");
-        s->start_MJD[ii] += ((long double) SMJD +
-                             (long double) OFFS +
-                             (long double) BE_DELAY) / SECPERDAY;
-
-        // Are we tracking?
-        fits_read_key(s->fitsfiles[ii], TSTRING, "TRK_MODE", ctmp, comment, &status);
-        check_read_status("TRK_MODE");
-        itmp = (strcmp("TRACK", ctmp) == 0) ? 1 : 0;
-        if (ii == 0)
-            s->tracking = itmp;
-        else if (s->tracking != itmp)
-            printf("Warning!:  TRK_MODE values don't match for files 0 and %d!\n",
-                   ii);
-
-        // Now switch to the SUBINT HDU header
-        fits_movnam_hdu(s->fitsfiles[ii], BINARY_TBL, "SUBINT", 0, &status);
-        check_read_status("SUBINT");
-        get_hdr_double("TBIN", s->dt);
-        get_hdr_int("NCHAN", s->num_channels);
-        get_hdr_int("NPOL", s->num_polns);
-        get_hdr_string("POL_TYPE", s->poln_order);
-        fits_read_key(s->fitsfiles[ii], TINT, "NCHNOFFS", &itmp, comment, &status);
-        check_read_status("NCHNOFFS");
-        if (itmp > 0)
-            printf("Warning!:  First freq channel is not 0 in file %d!\n", ii);
-        get_hdr_int("NSBLK", s->spectra_per_subint);
-        get_hdr_int("NBITS", s->bits_per_sample);
-        fits_read_key(s->fitsfiles[ii], TINT, "NAXIS2",
-                      &(s->num_subint[ii]), comment, &status);
-        check_read_status("NAXIS2");
-        fits_read_key(s->fitsfiles[ii], TINT, "NSUBOFFS",
-                      &(s->start_subint[ii]), comment, &status);
-        check_read_status("NSUBOFFS");
-        s->time_per_subint = s->dt * s->spectra_per_subint;
-
-        /* This is likely not in earlier versions of PSRFITS */
-        s->zero_offset = 0.0;
-        fits_read_key(s->fitsfiles[ii], TFLOAT, "ZERO_OFF",
-                      &(s->zero_offset), comment, &status);
-        if (status==KEY_NO_EXIST) status=0; // Prevents error messages on old files
-        check_read_status("ZERO_OFF");
-        s->zero_offset = fabs(s->zero_offset);
-
-        // Get the time offset column info and the offset for the 1st row
-        {
-            double offs_sub;
-            int colnum, anynull, numrows;
-
-            // Identify the OFFS_SUB column number
-            fits_get_colnum(s->fitsfiles[ii], 0, "OFFS_SUB", &colnum, &status);
-            if (status == COL_NOT_FOUND) {
-                printf("Warning!:  Can't find the OFFS_SUB column!\n");
-                status = 0;     // Reset status
-            } else {
-                if (ii == 0) {
-                    s->offs_sub_col = colnum;
-                } else if (colnum != s->offs_sub_col) {
-                    printf("Warning!:  OFFS_SUB column changes between files!\n");
+        // Observing frequencies
+        fits_get_colnum(fptr, 0, "DAT_FREQ", &colnum, &status);
+        if (status == COL_NOT_FOUND) {
+            fi->flags |= PF_NO_DAT_FREQ;
+            status = 0;     // Reset status
+        } else {
+            double *freqs = (double *) malloc(sizeof(double) * fi->num_channels);
+            fits_read_col(fptr, TDOUBLE, colnum, 1L, 1L,
+                          fi->num_channels, 0, freqs, &anynull, &status);
+            fi->lo_freq = freqs[0];
+            fi->hi_freq = freqs[fi->num_channels - 1];
+            if (fi->num_channels > 1) {
+                fi->df = ((double) freqs[fi->num_channels - 1] -
+                          (double) freqs[0]) / (double) (fi->num_channels - 1);
+                fi->df01 = freqs[1] - freqs[0];
+            }
+            // Now check that the channel spacing is the same throughout
+            for (jj = 0; jj < fi->num_channels - 1; jj++) {
+                ftmp = freqs[jj + 1] - freqs[jj];
+                if (fabs(ftmp - fi->df) > 1e-7) {
+                    fi->flags |= PF_DF_CHANGES;
+                    break;
                 }
             }
+            free(freqs);
+        }
 
-            // Read the OFFS_SUB column value for the 1st row
-            fits_read_col(s->fitsfiles[ii], TDOUBLE,
-                          s->offs_sub_col, 1L, 1L, 1L,
-                          0, &offs_sub, &anynull, &status);
-
-            if (offs_sub != 0.0) {
-                numrows = (int) ((offs_sub - 0.5 * s->time_per_subint) /
-                                 s->time_per_subint + 1e-7);
-                // Check to see if any rows have been deleted or are missing
-                if (numrows > s->start_subint[ii]) {
-                    printf("Warning!:  NSUBOFFS reports %d previous rows\n"
-                           "           but OFFS_SUB implies %d.  Using OFFS_SUB.\n"
-                           "           Will likely be able to correct for this.\n",
-                           s->start_subint[ii], numrows);
-                }
-                s->start_subint[ii] = numrows;
-            } else {
-                int indexval_col, jj;
-                offs_sub_are_zero = 1;
-
-                // If OFFS_SUB are all 0.0, then we will assume that there are
-                // no gaps in the file.  This isn't truly proper PSRFITS, but
-                // we should still be able to handle it
-                for (jj = 1; jj <= s->num_subint[ii]; jj++) {
-                    fits_read_col(s->fitsfiles[ii], TDOUBLE,
-                                  s->offs_sub_col, jj, 1L, 1L,
-                                  0, &offs_sub, &anynull, &status);
-                    if (offs_sub != 0.0) {
-                        offs_sub_are_zero = 0;
-                        perror
-                            ("Error!:  Some, but not all OFFS_SUB are 0.0.  Not good PSRFITS.\n");
-                        exit(EXIT_FAILURE);
-                    }
+        // Data weights
+        fits_get_colnum(fptr, 0, "DAT_WTS", &(fi->dat_wts_col), &status);
+        if (status == COL_NOT_FOUND) {
+            fi->flags |= PF_NO_DAT_WTS;
+            status = 0;     // Reset status
+        } else {
+            float *fvec = (float *) malloc(sizeof(float) * fi->num_channels);
+            fits_read_col(fptr, TFLOAT, fi->dat_wts_col, 1L, 1L,
+                          fi->num_channels, 0, fvec, &anynull, &status);
+            for (jj = 0; jj < fi->num_channels; jj++) {
+                // If the weights are not 1, apply them
+                if (fvec[jj] != 1.0) {
+                    fi->flags |= PF_USE_DAT_WTS;
+                    break;
                 }
-                if (offs_sub_are_zero) {
-                    printf
-                        ("Warning!:  All OFFS_SUB are 0.0.  Assuming no missing rows.\n");
+            }
+            free(fvec);
+        }
+
+        // Data offsets
+        fits_get_colnum(fptr, 0, "DAT_OFFS", &(fi->dat_offs_col), &status);
+        if (status == COL_NOT_FOUND) {
+            fi->flags |= PF_NO_DAT_OFFS;
+            status = 0;     // Reset status
+        } else {
+            float *fvec = (float *) malloc(sizeof(float) *
+                                           fi->num_channels * fi->num_polns);
+            fits_read_col(fptr, TFLOAT, fi->dat_offs_col, 1L, 1L,
+                          fi->num_channels * fi->num_polns,
+                          0, fvec, &anynull, &status);
+            for (jj = 0; jj < fi->num_channels * fi->num_polns; jj++) {
+                // If the offsets are not 0, apply them
+                if (fvec[jj] != 0.0) {
+                    fi->flags |= PF_USE_DAT_OFFS;
+                    break;
                 }
-                // Check to see if there is an INDEXVAL column.  That should tell
-                // us if we are missing any subints.  Use it in lieu of OFFS_SUB
-                fits_get_colnum(s->fitsfiles[ii], 0, "INDEXVAL", &indexval_col,
-                                &status);
-                if (status == COL_NOT_FOUND) {
-                    printf
-                        ("Warning!:  No INDEXVAL column, either.  This is not proper PSRFITS.\n");
-                    status = 0; // Reset status
-                    s->start_subint[ii] = 0;
-                } else {
-                    double subint_index;
-                    // Read INDEXVAL
-                    fits_read_col(s->fitsfiles[ii], TDOUBLE,
-                                  indexval_col, 1L, 1L, 1L,
-                                  0, &subint_index, &anynull, &status);
-                    s->start_subint[ii] = (int) (subint_index + 1e-7 - 1.0);
+            }
+            free(fvec);
+        }
+
+        // Data scalings
+        fits_get_colnum(fptr, 0, "DAT_SCL", &(fi->dat_scl_col), &status);
+        if (status == COL_NOT_FOUND) {
+            fi->flags |= PF_NO_DAT_SCL;
+            status = 0;     // Reset status
+        } else {
+            float *fvec = (float *) malloc(sizeof(float) *
+                                           fi->num_channels * fi->num_polns);
+            fits_read_col(fptr, TFLOAT, fi->dat_scl_col, 1L, 1L,
+                          fi->num_channels * fi->num_polns,
+                          0, fvec, &anynull, &status);
+            for (jj = 0; jj < fi->num_channels * fi->num_polns; jj++) {
+                // If the scales are not 1, apply them
+                if (fvec[jj] != 1.0) {
+                    fi->flags |= PF_USE_DAT_SCL;
+                    break;
                 }
             }
+            free(fvec);
         }
+    }
+    return fptr;
+}
 
-        // This is the MJD offset based on the starting subint number
-        MJDf = (s->time_per_subint * s->start_subint[ii]) / SECPERDAY;
-        // The start_MJD values should always be correct
-        s->start_MJD[ii] += MJDf;
 
-        // Compute the starting spectra from the times
-        MJDf = s->start_MJD[ii] - s->start_MJD[0];
-        if (MJDf < 0.0) {
-            fprintf(stderr, "Error!: File %d seems to be from before file 0!\n", ii);
-            exit(1);
+static void merge_PSRFITS_fileinfo(struct spectra_info *s, int ii,
+                                   psrfits_fileinfo * fi)
+// Add the info from file 'ii' to 's'.  The files must be merged in
+// order.  Values come from file 0 and the other files are checked
+// against it, with the same warnings as the files are read.
+{
+    long double MJDf;
+    float ftmp;
+
+    switch (fi->error) {
+    case PF_NOT_PSRFITS:
+        presto_error(PRESTO_ERR_FORMAT,
+                     "File '%s' does not appear to be PSRFITS!",
+                     s->filenames[ii]);
+    case PF_NOT_SEARCH:
+        presto_error(PRESTO_ERR_FORMAT,
+                     "File '%s' does not contain SEARCH-mode data!",
+                     s->filenames[ii]);
+    case PF_BAD_OFFS_SUB:
+        presto_error(PRESTO_ERR_FORMAT,
+                     "Some, but not all OFFS_SUB are 0.0 in '%s'.  Not good PSRFITS.",
+                     s->filenames[ii]);
+    }
+
+    get_hdr_string(HDR_TELESCOP, "TELESCOP", telescope);
+    get_hdr_string(HDR_OBSERVER, "OBSERVER", observer);
+    get_hdr_string(HDR_SRC_NAME, "SRC_NAME", source);
+    get_hdr_string(HDR_FRONTEND, "FRONTEND", frontend);
+    get_hdr_string(HDR_BACKEND, "BACKEND", backend);
+    get_hdr_string(HDR_PROJID, "PROJID", project_id);
+    get_hdr_string(HDR_DATE_OBS, "DATE-OBS", date_obs);
+    get_hdr_string(HDR_FD_POLN, "FD_POLN", poln_type);
+    get_hdr_string(HDR_RA, "RA", ra_str);
+    get_hdr_string(HDR_DEC, "DEC", dec_str);
+    get_hdr_value(HDR_OBSFREQ, "OBSFREQ", fctr);
+    get_hdr_value(HDR_OBSNCHAN, "OBSNCHAN", orig_num_chan);
+    get_hdr_value(HDR_OBSBW, "OBSBW", orig_df);
+    // The beam size is allowed to change between files
+    if (ii == 0)
+        s->beam_FWHM = (fi->missing & (1 << HDR_BMIN)) ? 0.0 : fi->beam_FWHM;
+    // There is a VEGAS PSRFITS header bug where the beamwidth
+    // was fixed at 65 deg(!).  This IDs and fixes that
+    if ((strcmp("VEGAS", s->backend) == 0) && (s->beam_FWHM == 65.0)) {
+        // beam_halfwidth() returns halfwidth in arcsec
+        s->beam_FWHM = 2 * beam_halfwidth(s->fctr, 100.0) / 3600.0; // 100m for GBT
+    }
+    s->chan_dm = fi->chan_dm;
+    s->start_MJD[ii] = fi->start_MJD;
+    if (ii == 0)
+        s->tracking = fi->tracking;
+    else if (s->tracking != fi->tracking)
+        printf("Warning!:  TRK_MODE values don't match for files 0 and %d!\n",
+               ii);
+
+    // From the SUBINT HDU header
+    get_hdr_value(HDR_TBIN, "TBIN", dt);
+    get_hdr_value(HDR_NCHAN, "NCHAN", num_channels);
+    get_hdr_value(HDR_NPOL, "NPOL", num_polns);
+    get_hdr_string(HDR_POL_TYPE, "POL_TYPE", poln_order);
+    if (fi->nchnoffs > 0)
+        printf("Warning!:  First freq channel is not 0 in file %d!\n", ii);
+    get_hdr_value(HDR_NSBLK, "NSBLK", spectra_per_subint);
+    get_hdr_value(HDR_NBITS, "NBITS", bits_per_sample);
+    s->num_subint[ii] = fi->num_subint;
+    s->time_per_subint = s->dt * s->spectra_per_subint;
+    s->zero_offset = fi->zero_offset;
+
+    // The OFFS_SUB column and the starting subint
+    if (fi->flags & PF_NO_OFFS_SUB) {
+        printf("Warning!:  Can't find the OFFS_SUB column!\n");
+    } else {
+        if (ii == 0) {
+            s->offs_sub_col = fi->offs_sub_col;
+        } else if (fi->offs_sub_col != s->offs_sub_col) {
+            printf("Warning!:  OFFS_SUB column changes between files!\n");
         }
-        s->start_spec[ii] = (long long) (MJDf * SECPERDAY / s->dt + 0.5);
+    }
+    if (fi->flags & PF_NSUBOFFS_BAD)
+        printf("Warning!:  NSUBOFFS reports %d previous rows\n"
+               "           but OFFS_SUB implies %d.  Using OFFS_SUB.\n"
+               "           Will likely be able to correct for this.\n",
+               fi->nsuboffs, fi->start_subint);
+    if (fi->flags & PF_OFFS_SUB_ZERO) {
+        offs_sub_are_zero = 1;
+        printf("Warning!:  All OFFS_SUB are 0.0.  Assuming no missing rows.\n");
+    }
+    if (fi->flags & PF_NO_INDEXVAL)
+        printf
+            ("Warning!:  No INDEXVAL column, either.  This is not proper PSRFITS.\n");
+    s->start_subint[ii] = fi->start_subint;
+
+    // This is the MJD offset based on the starting subint number
+    MJDf = (s->time_per_subint * s->start_subint[ii]) / SECPERDAY;
+    // The start_MJD values should always be correct
+    s->start_MJD[ii] += MJDf;
+
+    // Compute the starting spectra from the times
+    MJDf = s->start_MJD[ii] - s->start_MJD[0];
+    if (MJDf < 0.0) {
+        presto_error(PRESTO_ERR_FORMAT,
+                     "File %d seems to be from before file 0!", ii);
+    }
+    s->start_spec[ii] = (long long) (MJDf * SECPERDAY / s->dt + 0.5);
 
-        // Now pull stuff from the other columns
-        {
-            float ftmp;
-            long repeat, width;
-            int colnum, anynull;
+    // The data column and the data type
+    if (fi->flags & PF_NO_DATA) {
+        printf("Warning!:  Can't find the DATA column!\n");
+    } else {
+        if (ii == 0) {
+            s->data_col = fi->data_col;
+            s->FITS_typecode = fi->FITS_typecode;
+        } else if (fi->data_col != s->data_col) {
+            printf("Warning!:  DATA column changes between files!\n");
+        }
+    }
 
-            // Identify the data column and the data type
-            fits_get_colnum(s->fitsfiles[ii], 0, "DATA", &colnum, &status);
-            if (status == COL_NOT_FOUND) {
-                printf("Warning!:  Can't find the DATA column!\n");
-                status = 0;     // Reset status
-            } else {
-                if (ii == 0) {
-                    s->data_col = colnum;
-                    fits_get_coltype(s->fitsfiles[ii], colnum, &(s->FITS_typecode),
-                                     &repeat, &width, &status);
-                    // This makes CFITSIO treat 1-bit data as written in 'B' mode
-                    // even if it was written in 'X' mode originally.  This means
-                    // that we unpack it ourselves.
-                    if (s->bits_per_sample < 8 && s->FITS_typecode == 1) {
-                        s->FITS_typecode = 11;
-                    }
-                } else if (colnum != s->data_col) {
-                    printf("Warning!:  DATA column changes between files!\n");
-                }
-            }
+    // Telescope azimuth and zenith angle
+    if (fi->flags & PF_NO_TEL_AZ)
+        s->azimuth = 0.0;
+    else if (ii == 0)
+        s->azimuth = fi->azimuth;
+    if (fi->flags & PF_NO_TEL_ZEN)
+        s->zenith_ang = 0.0;
+    else if (ii == 0)
+        s->zenith_ang = fi->zenith_ang;
+
+    // Observing frequencies
+    if (fi->flags & PF_NO_DAT_FREQ) {
+        printf("Warning!:  Can't find the channel freq column!\n");
+    } else {
+        if (ii == 0) {
+            s->df = fi->df;
+            s->lo_freq = fi->lo_freq;
+            s->hi_freq = fi->hi_freq;
+            if (fi->flags & PF_DF_CHANGES)
+                printf("Warning!:  Channel spacing changes in file %d!\n", ii);
+        } else {
+            ftmp = fabs(s->df - fi->df01);
+            if (ftmp > 1e-7)
+                printf("Warning!:  Channel spacing changes between files!\n");
+            ftmp = fabs(s->lo_freq - fi->lo_freq);
+            if (ftmp > 1e-7)
+                printf("Warning!:  Low channel changes between files!\n");
+            ftmp = fabs(s->hi_freq - fi->hi_freq);
+            if (ftmp > 1e-7)
+                printf("Warning!:  High channel changes between files!\n");
+        }
+    }
 
-            // Telescope azimuth
-            fits_get_colnum(s->fitsfiles[ii], 0, "TEL_AZ", &colnum, &status);
-            if (status == COL_NOT_FOUND) {
-                s->azimuth = 0.0;
-                status = 0;     // Reset status
-            } else {
-                fits_read_col(s->fitsfiles[ii], TFLOAT, colnum,
-                              1L, 1L, 1L, 0, &ftmp, &anynull, &status);
-                if (ii == 0)
-                    s->azimuth = (double) ftmp;
+    // Data weights
+    if (fi->flags & PF_NO_DAT_WTS) {
+        printf("Warning!:  Can't find the channel weights!\n");
+    } else {
+        if (s->apply_weight < 0) {      // Use the data to decide
+            if (ii == 0) {
+                s->dat_wts_col = fi->dat_wts_col;
+            } else if (fi->dat_wts_col != s->dat_wts_col) {
+                printf("Warning!:  DAT_WTS column changes between files!\n");
             }
+            if (fi->flags & PF_USE_DAT_WTS)
+                s->apply_weight = 1;
+        }
+        if (s->apply_weight < 0)
+            s->apply_weight = 0;        // not needed
+    }
 
-            // Telescope zenith angle
-            fits_get_colnum(s->fitsfiles[ii], 0, "TEL_ZEN", &colnum, &status);
-            if (status == COL_NOT_FOUND) {
-                s->zenith_ang = 0.0;
-                status = 0;     // Reset status
-            } else {
-                fits_read_col(s->fitsfiles[ii], TFLOAT, colnum,
-                              1L, 1L, 1L, 0, &ftmp, &anynull, &status);
-                if (ii == 0)
-                    s->zenith_ang = (double) ftmp;
+    // Data offsets
+    if (fi->flags & PF_NO_DAT_OFFS) {
+        printf("Warning!:  Can't find the channel offsets!\n");
+    } else {
+        if (s->apply_offset < 0) {      // Use the data to decide
+            if (ii == 0) {
+                s->dat_offs_col = fi->dat_offs_col;
+            } else if (fi->dat_offs_col != s->dat_offs_col) {
+                printf("Warning!:  DAT_OFFS column changes between files!\n");
             }
+            if (fi->flags & PF_USE_DAT_OFFS)
+                s->apply_offset = 1;
+        }
+        if (s->apply_offset < 0)
+            s->apply_offset = 0;        // not needed
+    }
 
-            // Observing frequencies
-            fits_get_colnum(s->fitsfiles[ii], 0, "DAT_FREQ", &colnum, &status);
-            if (status == COL_NOT_FOUND) {
-                printf("Warning!:  Can't find the channel freq column!\n");
-                status = 0;     // Reset status
-            } else {
-                int jj;
-                double *freqs = (double *) malloc(sizeof(double) * s->num_channels);
-                fits_read_col(s->fitsfiles[ii], TDOUBLE, colnum, 1L, 1L,
-                              s->num_channels, 0, freqs, &anynull, &status);
-
-                if (ii == 0) {
-                    int trigger = 0;
-                    s->df = ((double) freqs[s->num_channels - 1] -
-                             (double) freqs[0]) / (double) (s->num_channels - 1);
-                    s->lo_freq = freqs[0];
-                    s->hi_freq = freqs[s->num_channels - 1];
-                    // Now check that the channel spacing is the same throughout
-                    for (jj = 0; jj < s->num_channels - 1; jj++) {
-                        ftmp = freqs[jj + 1] - freqs[jj];
-                        if ((fabs(ftmp - s->df) > 1e-7) && !trigger) {
-                            trigger = 1;
-                            printf
-                                ("Warning!:  Channel spacing changes in file %d!\n",
-                                 ii);
-                        }
-                    }
-                } else {
-                    ftmp = fabs(s->df - (freqs[1] - freqs[0]));
-                    if (ftmp > 1e-7)
-                        printf
-                            ("Warning!:  Channel spacing changes between files!\n");
-                    ftmp = fabs(s->lo_freq - freqs[0]);
-                    if (ftmp > 1e-7)
-                        printf("Warning!:  Low channel changes between files!\n");
-                    ftmp = fabs(s->hi_freq - freqs[s->num_channels - 1]);
-                    if (ftmp > 1e-7)
-                        printf("Warning!:  High channel changes between files!\n");
-                }
-                free(freqs);
+    // Data scalings
+    if (fi->flags & PF_NO_DAT_SCL) {
+        printf("Warning!:  Can't find the channel scalings!\n");
+    } else {
+        if (s->apply_scale < 0) {       // Use the data to decide
+            if (ii == 0) {
+                s->dat_scl_col = fi->dat_scl_col;
+            } else if (fi->dat_scl_col != s->dat_scl_col) {
+                printf("Warning!:  DAT_SCL column changes between files!\n");
             }
+            if (fi->flags & PF_USE_DAT_SCL)
+                s->apply_scale = 1;
+        }
+        if (s->apply_scale < 0)
+            s->apply_scale = 0; // not needed
+    }
 
-            // Data weights
-            fits_get_colnum(s->fitsfiles[ii], 0, "DAT_WTS", &colnum, &status);
-            if (status == COL_NOT_FOUND) {
-                printf("Warning!:  Can't find the channel weights!\n");
-                status = 0;     // Reset status
-            } else {
-                if (s->apply_weight < 0) {      // Use the data to decide
-                    int jj;
-                    if (ii == 0) {
-                        s->dat_wts_col = colnum;
-                    } else if (colnum != s->dat_wts_col) {
-                        printf("Warning!:  DAT_WTS column changes between files!\n");
-                    }
-                    float *fvec = (float *) malloc(sizeof(float) * s->num_channels);
-                    fits_read_col(s->fitsfiles[ii], TFLOAT, s->dat_wts_col, 1L, 1L,
-                                  s->num_channels, 0, fvec, &anynull, &status);
-                    for (jj = 0; jj < s->num_channels; jj++) {
-                        // If the weights are not 1, apply them
-                        if (fvec[jj] != 1.0) {
-                            s->apply_weight = 1;
-                            break;
-                        }
-                    }
-                    free(fvec);
-                }
-                if (s->apply_weight < 0)
-                    s->apply_weight = 0;        // not needed
-            }
+    // Compute the samples per file and the amount of padding
+    // that the _previous_ file has
+    s->num_pad[ii] = 0;
+    s->num_spec[ii] = s->spectra_per_subint * s->num_subint[ii];
+    if (ii > 0) {
+        if (s->start_spec[ii] > s->N) { // Need padding
+            s->num_pad[ii - 1] = s->start_spec[ii] - s->N;
+            s->N += s->num_pad[ii - 1];
+        }
+    }
+    s->N += s->num_spec[ii];
+}
 
-            // Data offsets
-            fits_get_colnum(s->fitsfiles[ii], 0, "DAT_OFFS", &colnum, &status);
-            if (status == COL_NOT_FOUND) {
-                printf("Warning!:  Can't find the channel offsets!\n");
-                status = 0;     // Reset status
-            } else {
-                if (s->apply_offset < 0) {      // Use the data to decide
-                    int jj;
-                    if (ii == 0) {
-                        s->dat_offs_col = colnum;
-                    } else if (colnum != s->dat_offs_col) {
-                        printf
-                            ("Warning!:  DAT_OFFS column changes between files!\n");
-                    }
-                    float *fvec = (float *) malloc(sizeof(float) *
-                                                   s->num_channels * s->num_polns);
-                    fits_read_col(s->fitsfiles[ii], TFLOAT, s->dat_offs_col, 1L, 1L,
-                                  s->num_channels * s->num_polns,
-                                  0, fvec, &anynull, &status);
-                    for (jj = 0; jj < s->num_channels * s->num_polns; jj++) {
-                        // If the offsets are not 0, apply them
-                        if (fvec[jj] != 0.0) {
-                            s->apply_offset = 1;
-                            break;
-                        }
-                    }
-                    free(fvec);
-                }
-                if (s->apply_offset < 0)
-                    s->apply_offset = 0;        // not needed
-            }
 
-            // Data scalings
-            fits_get_colnum(s->fitsfiles[ii], 0, "DAT_SCL", &colnum, &status);
-            if (status == COL_NOT_FOUND) {
-                printf("Warning!:  Can't find the channel scalings!\n");
-                status = 0;     // Reset status
-            } else {
-                if (s->apply_scale < 0) {       // Use the data to decide
-                    int jj;
-                    if (ii == 0) {
-                        s->dat_scl_col = colnum;
-                    } else if (colnum != s->dat_scl_col) {
-                        printf("Warning!:  DAT_SCL column changes between files!\n");
-                    }
-                    float *fvec = (float *) malloc(sizeof(float) *
-                                                   s->num_channels * s->num_polns);
-                    fits_read_col(s->fitsfiles[ii], TFLOAT, colnum, 1L, 1L,
-                                  s->num_channels * s->num_polns,
-                                  0, fvec, &anynull, &status);
-                    for (jj = 0; jj < s->num_channels * s->num_polns; jj++) {
-                        // If the scales are not 1, apply them
-                        if (fvec[jj] != 1.0) {
-                            s->apply_scale = 1;
-                            break;
-                        }
-                    }
-                    free(fvec);
-                }
-                if (s->apply_scale < 0)
-                    s->apply_scale = 0; // not needed
-            }
+static int PSRFITS_file_signature(char *filename, psrfits_indexentry * entry)
+// Fill in the name, size, mtime, and checksum in 'entry'.
+// Return 1 on success, 0 if the file can't be read.
+{
+    struct stat buf;
+    unsigned char bytes[PSRFITS_SUMBYTES];
+    unsigned long long sum = 14695981039346656037ULL;   // FNV-1a
+    size_t ii, numread;
+    char *base;
+    FILE *file;
+
+    if (stat(filename, &buf) != 0)
+        return 0;
+    if ((file = fopen(filename, "rb")) == NULL)
+        return 0;
+    numread = fread(bytes, 1, PSRFITS_SUMBYTES, file);
+    fclose(file);
+    for (ii = 0; ii < numread; ii++) {
+        sum ^= bytes[ii];
+        sum *= 1099511628211ULL;
+    }
+    base = strrchr(filename, '/');
+    base = (base == NULL) ? filename : base + 1;
+    memset(entry->filename, 0, sizeof(entry->filename));
+    strncpy(entry->filename, base, sizeof(entry->filename) - 1);
+    entry->size = (long long) buf.st_size;
+    entry->mtime = (long long) buf.st_mtime;
+    entry->checksum = sum;
+    return 1;
+}
+
+
+static psrfits_indexentry *read_PSRFITS_index(char *idxname, int *numentries)
+// Read the entries of a PSRFITS index file.  Return NULL if
+// there is no (usable) index.
+{
+    char magic[16];
+    int version, entrysize;
+    psrfits_indexentry *entries;
+    FILE *file;
+
+    *numentries = 0;
+    if ((file = fopen(idxname, "rb")) == NULL)
+        return NULL;
+    if (fread(magic, sizeof(magic), 1, file) != 1 ||
+        strncmp(magic, PSRFITS_INDEX_MAGIC, sizeof(magic)) != 0 ||
+        fread(&version, sizeof(int), 1, file) != 1 ||
+        version != PSRFITS_INDEX_VERSION ||
+        fread(&entrysize, sizeof(int), 1, file) != 1 ||
+        entrysize != sizeof(psrfits_indexentry) ||
+        fread(numentries, sizeof(int), 1, file) != 1 || *numentries <= 0) {
+        fclose(file);
+        *numentries = 0;
+        return NULL;
+    }
+    entries = (psrfits_indexentry *) malloc(sizeof(psrfits_indexentry) *
+                                            *numentries);
+    if (fread(entries, sizeof(psrfits_indexentry), *numentries, file) !=
+        (size_t) *numentries) {
+        free(entries);
+        entries = NULL;
+        *numentries = 0;
+    }
+    fclose(file);
+    return entries;
+}
+
+
+static void write_PSRFITS_index(char *idxname, psrfits_indexentry * entries,
+                                int numentries)
+// Write a PSRFITS index file.  This is only a cache, so quietly
+// give up if we can't (e.g. the data are in a read-only directory).
+// The index is renamed into place so that other programs reading
+// the same files never see a partial index.
+{
+    char magic[16], *tmpname;
+    int version = PSRFITS_INDEX_VERSION, entrysize = sizeof(psrfits_indexentry);
+    int ok;
+    FILE *file;
+
+    tmpname = (char *) malloc(strlen(idxname) + 20);
+    sprintf(tmpname, "%s.%d", idxname, (int) getpid());
+    if ((file = fopen(tmpname, "wb")) == NULL) {
+        free(tmpname);
+        return;
+    }
+    memset(magic, 0, sizeof(magic));
+    strncpy(magic, PSRFITS_INDEX_MAGIC, sizeof(magic));
+    ok = (fwrite(magic, sizeof(magic), 1, file) == 1 &&
+          fwrite(&version, sizeof(int), 1, file) == 1 &&
+          fwrite(&entrysize, sizeof(int), 1, file) == 1 &&
+          fwrite(&numentries, sizeof(int), 1, file) == 1 &&
+          fwrite(entries, sizeof(psrfits_indexentry), numentries, file) ==
+          (size_t) numentries);
+    if (fclose(file) != 0)
+        ok = 0;
+    if (!ok || rename(tmpname, idxname) != 0)
+        remove(tmpname);
+    free(tmpname);
+}
+
+
+static int same_PSRFITS_file(psrfits_indexentry * a, psrfits_indexentry * b)
+// Return 1 if 'a' and 'b' have the same name, size, mtime, and checksum
+{
+    return (a->size == b->size && a->mtime == b->mtime &&
+            a->checksum == b->checksum && strcmp(a->filename, b->filename) == 0);
+}
+
+
+static int find_PSRFITS_index_entry(psrfits_indexentry * entry,
+                                    psrfits_indexentry * entries,
+                                    int numentries, int guess)
+// Return the number of the index entry that matches 'entry', or -1.
+// Entry 'guess' is checked first since the file order rarely changes.
+{
+    int ii;
+
+    if (guess < numentries && same_PSRFITS_file(entry, entries + guess))
+        return guess;
+    for (ii = 0; ii < numentries; ii++)
+        if (same_PSRFITS_file(entry, entries + ii))
+            return ii;
+    return -1;
+}
+
+
+fitsfile *get_PSRFITS_fitsfile(struct spectra_info *s, int filenum)
+// Return the CFITSIO pointer for file 'filenum' of the observation.
+// Files are opened (and moved to the SUBINT HDU) when first needed.
+{
+    int status = 0;
+    char err_text[81];
+
+    if (s->fitsfiles[filenum] == NULL) {
+        fits_open_file(&(s->fitsfiles[filenum]), s->filenames[filenum],
+                       READONLY, &status);
+        fits_movnam_hdu(s->fitsfiles[filenum], BINARY_TBL, "SUBINT", 0, &status);
+        if (status) {
+            fits_get_errstatus(status, err_text);
+            s->fitsfiles[filenum] = NULL;
+            presto_error(PRESTO_ERR_IO,
+                         "Problem opening PSRFITS file '%s' : %s",
+                         s->filenames[filenum], err_text);
         }
+    }
+    return s->fitsfiles[filenum];
+}
 
-        // Compute the samples per file and the amount of padding
-        // that the _previous_ file has
-        s->num_pad[ii] = 0;
-        s->num_spec[ii] = s->spectra_per_subint * s->num_subint[ii];
-        if (ii > 0) {
-            if (s->start_spec[ii] > s->N) {     // Need padding
-                s->num_pad[ii - 1] = s->start_spec[ii] - s->N;
-                s->N += s->num_pad[ii - 1];
-            }
+
+void read_PSRFITS_files(struct spectra_info *s)
+// Read and convert PSRFITS information from a group of files
+// and place the resulting info into a spectra_info structure.
+//
+// The headers of the files are scanned in parallel (with OpenMP, if
+// CFITSIO is thread-safe), and their messages are printed in file
+// order.  The results are kept in an index file next to the first
+// file, so that the next program to read the same files only needs
+// to look at files that are new or have changed.
+// Set the environment variable PRESTO_PSRFITS_INDEX to 0 to turn the
+// index off.  Files that come from the index are opened when needed.
+{
+    int ii, numentries = 0, numscanned = 0, useindex = 1;
+    char *idxname, *envval, **scanmsgs;
+    psrfits_fileinfo *finfo;
+    psrfits_indexentry *entries, *newentries;
+    int *signedok;
+
+    s->datatype = PSRFITS;
+    s->fitsfiles = (fitsfile **) calloc(s->num_files, sizeof(fitsfile *));
+    s->start_subint = gen_ivect(s->num_files);
+    s->num_subint = gen_ivect(s->num_files);
+    s->start_spec = (long long *) malloc(sizeof(long long) * s->num_files);
+    s->num_spec = (long long *) malloc(sizeof(long long) * s->num_files);
+    s->num_pad = (long long *) malloc(sizeof(long long) * s->num_files);
+    s->start_MJD = (long double *) malloc(sizeof(long double) * s->num_files);
+    s->N = 0;
+    s->num_beams = 1;
+    s->get_rawblock = &get_PSRFITS_rawblock;
+    s->offset_to_spectra = &offset_to_PSRFITS_spectra;
+
+    // By default, don't flip the band.  But don't change
+    // the input value if it is aleady set to flip the band always
+    if (s->apply_flipband == -1)
+        s->apply_flipband = 0;
+
+    // Get what we can from the index
+    envval = getenv("PRESTO_PSRFITS_INDEX");
+    if (envval != NULL && atoi(envval) == 0)
+        useindex = 0;
+    idxname = (char *) malloc(strlen(s->filenames[0]) +
+                              strlen(PSRFITS_INDEX_SUFFIX) + 1);
+    sprintf(idxname, "%s%s", s->filenames[0], PSRFITS_INDEX_SUFFIX);
+    entries = (useindex) ? read_PSRFITS_index(idxname, &numentries) : NULL;
+    finfo = (psrfits_fileinfo *) malloc(sizeof(psrfits_fileinfo) * s->num_files);
+    newentries = (psrfits_indexentry *) calloc(s->num_files,
+                                               sizeof(psrfits_indexentry));
+    signedok = gen_ivect(s->num_files);
+    scanmsgs = (char **) calloc(s->num_files, sizeof(char *));
+
+    // Scan the headers of the files that aren't in the index
+#ifdef _OPENMP
+    int parallel = fits_is_reentrant();
+#pragma omp parallel for schedule(dynamic) if(parallel) reduction(+:numscanned) default(shared)
+#endif
+    for (ii = 0; ii < s->num_files; ii++) {
+        int jj = -1;
+
+        signedok[ii] = useindex &&
+            PSRFITS_file_signature(s->filenames[ii], newentries + ii);
+        if (signedok[ii] && entries != NULL)
+            jj = find_PSRFITS_index_entry(newentries + ii, entries,
+                                          numentries, ii);
+        if (jj >= 0) {
+            finfo[ii] = entries[jj].info;
+        } else {
+            s->fitsfiles[ii] = scan_PSRFITS_file(s->filenames[ii], finfo + ii,
+                                                 scanmsgs + ii);
+            numscanned++;
+        }
+    }
+
+    // Now combine the info from the files in order
+    for (ii = 0; ii < s->num_files; ii++) {
+        if (scanmsgs[ii]) {
+            printf("%s", scanmsgs[ii]);
+            free(scanmsgs[ii]);
+        }
+        merge_PSRFITS_fileinfo(s, ii, finfo + ii);
+    }
+
+    // Update the index if there were any changes
+    if (useindex && (numscanned || numentries != s->num_files)) {
+        for (ii = 0; ii < s->num_files; ii++) {
+            if (!signedok[ii])
+                break;
+            newentries[ii].info = finfo[ii];
         }
-        s->N += s->num_spec[ii];
+        if (ii == s->num_files)
+            write_PSRFITS_index(idxname, newentries, s->num_files);
     }
+    if (numscanned < s->num_files)
+        printf("Using the PSRFITS index '%s' for %d of %d files.\n",
+               idxname, s->num_files - numscanned, s->num_files);
+    free(idxname);
+    free(entries);
+    free(newentries);
+    free(finfo);
+    free(scanmsgs);
+    vect_free(signedok);
 
     // Convert the position strings into degrees
     {
@@ -686,9 +1134,8 @@ long long offset_to_PSRFITS_spectra(long long specnum, struct spectra_info *s)
     int filenum = 0;
 
     if (specnum > s->N) {
-        fprintf(stderr, "Error:  offset spectra %lld is > total spectra %lld\n\n",
-                specnum, s->N);
-        exit(1);
+        presto_error(PRESTO_ERR_VALUE,
+                     "offset spectra %lld is > total spectra %lld", specnum, s->N);
     }
     // Find which file we need
     while (filenum + 1 < s->num_files && specnum > s->start_spec[filenum + 1])
@@ -710,10 +1157,9 @@ long long offset_to_PSRFITS_spectra(long long specnum, struct spectra_info *s)
     // Otherwise, "seek" to the spectra (really a whole subint)
     // Check to make sure that specnum is the start of a subint
     if ((specnum - s->start_spec[cur_file]) % s->spectra_per_subint) {
-        fprintf(stderr,
-                "Error:  requested spectra %lld is not the start of a PSRFITS subint\n\n",
-                specnum);
-        exit(1);
+        presto_error(PRESTO_ERR_VALUE,
+                     "requested spectra %lld is not the start of a PSRFITS subint",
+                     specnum);
     }
     // Remember zero offset for CFITSIO...
     cur_subint = (specnum - s->start_spec[cur_file]) / s->spectra_per_subint + 1;
@@ -752,7 +1198,7 @@ int get_PSRFITS_rawblock(float *fdata, struct spectra_info *s, int *padding)
         double offs_sub = 0.0;
         if (!offs_sub_are_zero) {
             // Read the OFFS_SUB column value in case there were dropped blocks
-            fits_read_col(s->fitsfiles[cur_file], TDOUBLE,
+            fits_read_col(get_PSRFITS_fitsfile(s, cur_file), TDOUBLE,
                           s->offs_sub_col, cur_subint, 1L, 1L,
                           0, &offs_sub, &anynull, &status);
             // Set new_spec to proper value, accounting for possibly
@@ -803,11 +1249,11 @@ int get_PSRFITS_rawblock(float *fdata, struct spectra_info *s, int *padding)
   padding_block:
     if (new_spec < cur_spec) {
         // Files out of order?  Shouldn't get here.
-        fprintf(stderr, "Error!:  Current subint has earlier time than previous!\n\n"
-                "\tfilename = '%s', subint = %d\n"
-                "\tcur_spec = %lld  new_spec = %lld\n",
-                s->filenames[cur_file], cur_subint, cur_spec, new_spec);
-        exit(1);
+        presto_error(PRESTO_ERR_FORMAT,
+                     "Current subint has earlier time than previous!\n"
+                     "\tfilename = '%s', subint = %d\n"
+                     "\tcur_spec = %lld  new_spec = %lld",
+                     s->filenames[cur_file], cur_subint, cur_spec, new_spec);
     }
     numtopad = new_spec - cur_spec;
     // Don't add more than 1 block and if buffered, then realign the buffer
@@ -853,6 +1299,7 @@ void get_PSRFITS_subint(float *fdata, unsigned char *cdata, struct spectra_info
     unsigned char *ctmp = cdata;
     int ii, status = 0, anynull;
     int numtoread = s->samples_per_subint;
+    fitsfile *fptr = get_PSRFITS_fitsfile(s, cur_file);
 
     // The following allows us to read byte-packed data
     if (s->bits_per_sample < 8) {
@@ -865,26 +1312,26 @@ void get_PSRFITS_subint(float *fdata, unsigned char *cdata, struct spectra_info
 
     // Read the weights, offsets, and scales if required
     if (s->apply_weight)
-        fits_read_col(s->fitsfiles[cur_file], TFLOAT, s->dat_wts_col, cur_subint, 1L,
+        fits_read_col(fptr, TFLOAT, s->dat_wts_col, cur_subint, 1L,
                       s->num_channels, 0, weights, &anynull, &status);
     if (s->apply_offset)
-        fits_read_col(s->fitsfiles[cur_file], TFLOAT, s->dat_offs_col, cur_subint,
+        fits_read_col(fptr, TFLOAT, s->dat_offs_col, cur_subint,
                       1L, s->num_channels * s->num_polns, 0, offsets, &anynull,
                       &status);
     if (s->apply_scale)
-        fits_read_col(s->fitsfiles[cur_file], TFLOAT, s->dat_scl_col, cur_subint, 1L,
+        fits_read_col(fptr, TFLOAT, s->dat_scl_col, cur_subint, 1L,
                       s->num_channels * s->num_polns, 0, scales, &anynull, &status);
 
     // Now actually read the subint into the temporary buffer
-    fits_read_col(s->fitsfiles[cur_file], s->FITS_typecode,
+    fits_read_col(fptr, s->FITS_typecode,
                   s->data_col, cur_subint, 1L, numtoread,
                   0, ctmp, &anynull, &status);
 
     if (status) {
-        fprintf(stderr, "Error!:  Problem reading record from PSRFITS data file\n"
-                "\tfilename = '%s', subint = %d.  FITS status = %d.  Exiting.\n",
-                s->filenames[cur_file], cur_subint, status);
-        exit(1);
+        presto_error(PRESTO_ERR_IO,
+                     "Problem reading record from PSRFITS data file\n"
+                     "\tfilename = '%s', subint = %d.  FITS status = %d.",
+                     s->filenames[cur_file], cur_subint, status);
     }
     // The following converts that byte-packed data into bytes
     if (s->bits_per_sample == 4) {
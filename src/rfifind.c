@@ -11,7 +11,7 @@
 #include <omp.h>
 #endif
 
-#define RAWDATA (cmd->filterbankP || cmd->psrfitsP)
+#define RAWDATA (cmd->filterbankP || cmd->psrfitsP || cmd->basebandP || cmd->shmringP)
 
 /* Some function definitions */
 
@@ -102,6 +102,8 @@ int main(int argc, char *argv[])
     s.apply_scale = (cmd->noscalesP) ? 0 : -1;
     s.apply_offset = (cmd->nooffsetsP) ? 0 : -1;
     s.remove_zerodm = (cmd->zerodmP) ? 1 : 0;
+    s.tscrunch = cmd->tscrunch;
+    s.fscrunch = cmd->fscrunch;
     if (cmd->noclipP) {
         cmd->clip = 0.0;
         s.clip_sigma = 0.0;
@@ -157,12 +159,20 @@ int main(int argc, char *argv[])
             s.datatype = SIGPROCFB;
         else if (cmd->psrfitsP)
             s.datatype = PSRFITS;
+        else if (cmd->basebandP)
+            s.datatype = BASEBAND;
+        else if (cmd->shmringP)
+            s.datatype = SHMRING;
     } else {                    // Attempt to auto-identify the data
         identify_psrdatatype(&s, 1);
         if (s.datatype == SIGPROCFB)
             cmd->filterbankP = 1;
         else if (s.datatype == PSRFITS)
             cmd->psrfitsP = 1;
+        else if (s.datatype == BASEBAND)
+            cmd->basebandP = 1;
+        else if (s.datatype == SHMRING)
+            cmd->shmringP = 1;
         else if (s.datatype == SUBBAND)
             insubs = 1;
         else {
@@ -34,6 +34,10 @@ static Cmdline cmd = {
   /* filterbankP = */ 0,
   /***** -psrfits: Raw data in PSRFITS format */
   /* psrfitsP = */ 0,
+  /***** -baseband: Raw complex baseband data in DADA format */
+  /* basebandP = */ 0,
+  /***** -shmring: Raw SIGPROC filterbank data from a shared-memory ring */
+  /* shmringP = */ 0,
   /***** -noweights: Do not apply PSRFITS weights */
   /* noweightsP = */ 0,
   /***** -noscales: Do not apply PSRFITS scales */
@@ -62,6 +66,14 @@ static Cmdline cmd = {
   /* invertP = */ 0,
   /***** -zerodm: Subtract the mean of all channels from each sample (i.e. remove zero DM) */
   /* zerodmP = */ 0,
+  /***** -tscrunch: Number of neighboring spectra to sum (in time) as the raw data are read */
+  /* tscrunchP = */ 1,
+  /* tscrunch = */ 1,
+  /* tscrunchC = */ 1,
+  /***** -fscrunch: Number of neighboring channels to sum (in frequency) as the raw data are read */
+  /* fscrunchP = */ 1,
+  /* fscrunch = */ 1,
+  /* fscrunchC = */ 1,
   /***** -xwin: Draw plots to the screen as well as a PS file */
   /* xwinP = */ 0,
   /***** -nocompute: Just plot and remake the mask */
@@ -859,6 +871,20 @@ showOptionValues(void)
     printf("-psrfits found:\n");
   }
 
+  /***** -baseband: Raw complex baseband data in DADA format */
+  if( !cmd.basebandP ) {
+    printf("-baseband not found.\n");
+  } else {
+    printf("-baseband found:\n");
+  }
+
+  /***** -shmring: Raw SIGPROC filterbank data from a shared-memory ring */
+  if( !cmd.shmringP ) {
+    printf("-shmring not found.\n");
+  } else {
+    printf("-shmring found:\n");
+  }
+
   /***** -noweights: Do not apply PSRFITS weights */
   if( !cmd.noweightsP ) {
     printf("-noweights not found.\n");
@@ -951,6 +977,30 @@ showOptionValues(void)
     printf("-zerodm found:\n");
   }
 
+  /***** -tscrunch: Number of neighboring spectra to sum (in time) as the raw data are read */
+  if( !cmd.tscrunchP ) {
+    printf("-tscrunch not found.\n");
+  } else {
+    printf("-tscrunch found:\n");
+    if( !cmd.tscrunchC ) {
+      printf("  no values\n");
+    } else {
+      printf("  value = `%d'\n", cmd.tscrunch);
+    }
+  }
+
+  /***** -fscrunch: Number of neighboring channels to sum (in frequency) as the raw data are read */
+  if( !cmd.fscrunchP ) {
+    printf("-fscrunch not found.\n");
+  } else {
+    printf("-fscrunch found:\n");
+    if( !cmd.fscrunchC ) {
+      printf("  no values\n");
+    } else {
+      printf("  value = `%d'\n", cmd.fscrunch);
+    }
+  }
+
   /***** -xwin: Draw plots to the screen as well as a PS file */
   if( !cmd.xwinP ) {
     printf("-xwin not found.\n");
@@ -1113,7 +1163,7 @@ showOptionValues(void)
 void
 usage(void)
 {
-  fprintf(stderr,"%s","   [-ncpus ncpus] -o outfile [-filterbank] [-psrfits] [-noweights] [-noscales] [-nooffsets] [-wapp] [-window] [-numwapps numwapps] [-if ifs] [-clip clip] [-noclip] [-invert] [-zerodm] [-xwin] [-nocompute] [-rfixwin] [-rfips] [-time time] [-blocks blocks] [-timesig timesigma] [-freqsig freqsigma] [-chanfrac chantrigfrac] [-intfrac inttrigfrac] [-zapchan zapchanstr] [-zapints zapintsstr] [-mask maskfile] [-ignorechan ignorechanstr] [--] infile ...\n");
+  fprintf(stderr,"%s","   [-ncpus ncpus] -o outfile [-filterbank] [-psrfits] [-baseband] [-shmring] [-noweights] [-noscales] [-nooffsets] [-wapp] [-window] [-numwapps numwapps] [-if ifs] [-clip clip] [-noclip] [-invert] [-zerodm] [-tscrunch tscrunch] [-fscrunch fscrunch] [-xwin] [-nocompute] [-rfixwin] [-rfips] [-time time] [-blocks blocks] [-timesig timesigma] [-freqsig freqsigma] [-chanfrac chantrigfrac] [-intfrac inttrigfrac] [-zapchan zapchanstr] [-zapints zapintsstr] [-mask maskfile] [-ignorechan ignorechanstr] [--] infile ...\n");
   fprintf(stderr,"%s","      Examines radio data for narrow and wide band interference as well as problems with channels\n");
   fprintf(stderr,"%s","         -ncpus: Number of processors to use with OpenMP\n");
   fprintf(stderr,"%s","                 1 int value between 1 and oo\n");
@@ -1122,6 +1172,8 @@ usage(void)
   fprintf(stderr,"%s","                 1 char* value\n");
   fprintf(stderr,"%s","    -filterbank: Raw data in SIGPROC filterbank format\n");
   fprintf(stderr,"%s","       -psrfits: Raw data in PSRFITS format\n");
+  fprintf(stderr,"%s","      -baseband: Raw complex baseband data in DADA format\n");
+  fprintf(stderr,"%s","       -shmring: Raw SIGPROC filterbank data from a shared-memory ring\n");
   fprintf(stderr,"%s","     -noweights: Do not apply PSRFITS weights\n");
   fprintf(stderr,"%s","      -noscales: Do not apply PSRFITS scales\n");
   fprintf(stderr,"%s","     -nooffsets: Do not apply PSRFITS offsets\n");
@@ -1138,6 +1190,12 @@ usage(void)
   fprintf(stderr,"%s","        -noclip: Do not clip the data.  (The default is to _always_ clip!)\n");
   fprintf(stderr,"%s","        -invert: For rawdata, flip (or invert) the band\n");
   fprintf(stderr,"%s","        -zerodm: Subtract the mean of all channels from each sample (i.e. remove zero DM)\n");
+  fprintf(stderr,"%s","      -tscrunch: Number of neighboring spectra to sum (in time) as the raw data are read\n");
+  fprintf(stderr,"%s","                 1 int value between 1 and 1024\n");
+  fprintf(stderr,"%s","                 default: `1'\n");
+  fprintf(stderr,"%s","      -fscrunch: Number of neighboring channels to sum (in frequency) as the raw data are read\n");
+  fprintf(stderr,"%s","                 1 int value between 1 and 1024\n");
+  fprintf(stderr,"%s","                 default: `1'\n");
   fprintf(stderr,"%s","          -xwin: Draw plots to the screen as well as a PS file\n");
   fprintf(stderr,"%s","     -nocompute: Just plot and remake the mask\n");
   fprintf(stderr,"%s","       -rfixwin: Show the RFI instances on screen\n");
@@ -1215,6 +1273,16 @@ parseCmdline(int argc, char **argv)
       continue;
     }
 
+    if( 0==strcmp("-baseband", argv[i]) ) {
+      cmd.basebandP = 1;
+      continue;
+    }
+
+    if( 0==strcmp("-shmring", argv[i]) ) {
+      cmd.shmringP = 1;
+      continue;
+    }
+
     if( 0==strcmp("-noweights", argv[i]) ) {
       cmd.noweightsP = 1;
       continue;
@@ -1285,6 +1353,26 @@ parseCmdline(int argc, char **argv)
       continue;
     }
 
+    if( 0==strcmp("-tscrunch", argv[i]) ) {
+      int keep = i;
+      cmd.tscrunchP = 1;
+      i = getIntOpt(argc, argv, i, &cmd.tscrunch, 1);
+      cmd.tscrunchC = i-keep;
+      checkIntLower("-tscrunch", &cmd.tscrunch, cmd.tscrunchC, 1024);
+      checkIntHigher("-tscrunch", &cmd.tscrunch, cmd.tscrunchC, 1);
+      continue;
+    }
+
+    if( 0==strcmp("-fscrunch", argv[i]) ) {
+      int keep = i;
+      cmd.fscrunchP = 1;
+      i = getIntOpt(argc, argv, i, &cmd.fscrunch, 1);
+      cmd.fscrunchC = i-keep;
+      checkIntLower("-fscrunch", &cmd.fscrunch, cmd.fscrunchC, 1024);
+      checkIntHigher("-fscrunch", &cmd.fscrunch, cmd.fscrunchC, 1);
+      continue;
+    }
+
     if( 0==strcmp("-xwin", argv[i]) ) {
       cmd.xwinP = 1;
       continue;
@@ -174,55 +174,25 @@ void rfifind_plot(int numchan, int numint, int ptsperint,
                 for (jj = 0; jj < numint; jj++)
                     bytemask[jj][userchan[ii]] |= USERCHAN;
 
-    /* Compare each point in an interval (or channel) with   */
-    /* the interval's (or channel's) median and the overall  */
-    /* standard deviation.  If the channel/integration       */
-    /* medians are more than sigma different than the global */
-    /* value, set them to the global.                        */
+    /* Flag the bad points using the interval/channel medians */
     {
-        float int_med, chan_med;
-
-        for (ii = 0; ii < numint; ii++) {
-            for (jj = 0; jj < numchan; jj++) {
-                {               /* Powers */
-                    if (datapow[ii][jj] > pow_reject)
-                        if (!(bytemask[ii][jj] & PADDING))
-                            bytemask[ii][jj] |= BAD_POW;
-                }
-                {               /* Averages */
-                    if (fabs(avg_int_med[ii] - dataavg_med) >
-                        timesigma * dataavg_std)
-                        int_med = dataavg_med;
-                    else
-                        int_med = avg_int_med[ii];
-                    if (fabs(avg_chan_med[jj] - dataavg_med) >
-                        timesigma * dataavg_std)
-                        chan_med = dataavg_med;
-                    else
-                        chan_med = avg_chan_med[jj];
-                    if (fabs(dataavg[ii][jj] - int_med) > avg_reject ||
-                        fabs(dataavg[ii][jj] - chan_med) > avg_reject)
-                        if (!(bytemask[ii][jj] & PADDING))
-                            bytemask[ii][jj] |= BAD_AVG;
-                }
-                {               /* Standard Deviations */
-                    if (fabs(std_int_med[ii] - datastd_med) >
-                        timesigma * datastd_std)
-                        int_med = datastd_med;
-                    else
-                        int_med = std_int_med[ii];
-                    if (fabs(std_chan_med[jj] - datastd_med) >
-                        timesigma * datastd_std)
-                        chan_med = datastd_med;
-                    else
-                        chan_med = std_chan_med[jj];
-                    if (fabs(datastd[ii][jj] - int_med) > std_reject ||
-                        fabs(datastd[ii][jj] - chan_med) > std_reject)
-                        if (!(bytemask[ii][jj] & PADDING))
-                            bytemask[ii][jj] |= BAD_STD;
-                }
-            }
-        }
+        rfistats stats;
+
+        stats.numchan = numchan;
+        stats.numint = numint;
+        stats.ptsperint = ptsperint;
+        stats.datapow = datapow[0];
+        stats.dataavg = dataavg[0];
+        stats.datastd = datastd[0];
+        stats.dataavg_med = dataavg_med;
+        stats.dataavg_std = dataavg_std;
+        stats.datastd_med = datastd_med;
+        stats.datastd_std = datastd_std;
+        stats.avg_int_med = avg_int_med;
+        stats.std_int_med = std_int_med;
+        stats.avg_chan_med = avg_chan_med;
+        stats.std_chan_med = std_chan_med;
+        flag_rfistats(&stats, timesigma, freqsigma, bytemask[0]);
     }
 
     /* Step over the intervals and channels and count how many are set "bad". */
@@ -230,41 +200,10 @@ void rfifind_plot(int numchan, int numint, int ptsperint,
     /* chantrigfrac*numchan then reject the whole interval.                   */
     /* For a given channel, if the number of bad intervals is greater than    */
     /* inttrigfrac*numint then reject the whole channel.                      */
-    {
-        int badnum, trignum;
-
-        /* Loop over the intervals */
-        trignum = (int) (numchan * chantrigfrac);
-        for (ii = 0; ii < numint; ii++) {
-            if (!(bytemask[ii][0] & USERINTS)) {
-                badnum = 0;
-                for (jj = 0; jj < numchan; jj++)
-                    if (bytemask[ii][jj] & BADDATA)
-                        badnum++;
-                if (badnum > trignum) {
-                    userints[numuserints++] = ii;
-                    for (jj = 0; jj < numchan; jj++)
-                        bytemask[ii][jj] |= USERINTS;
-                }
-            }
-        }
-
-        /* Loop over the channels */
-        trignum = (int) (numint * inttrigfrac);
-        for (ii = 0; ii < numchan; ii++) {
-            if (!(bytemask[0][ii] & USERCHAN)) {
-                badnum = 0;
-                for (jj = 0; jj < numint; jj++)
-                    if (bytemask[jj][ii] & BADDATA)
-                        badnum++;
-                if (badnum > trignum) {
-                    userchan[numuserchan++] = ii;
-                    for (jj = 0; jj < numint; jj++)
-                        bytemask[jj][ii] |= USERCHAN;
-                }
-            }
-        }
-    }
+    numuserints = trim_rfi_ints(bytemask[0], numchan, numint, chantrigfrac,
+                                userints, numuserints);
+    numuserchan = trim_rfi_chans(bytemask[0], numchan, numint, inttrigfrac,
+                                 userchan, numuserchan);
 
     /* Generate the New Mask */
 
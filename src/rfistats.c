@@ -0,0 +1,358 @@
+#include "presto.h"
+#include "mask.h"
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+/*
+ * Routines to make rfifind masks (and bandpasses and channel
+ * weights) directly from the rfifind '.stats' file.  The statistics
+ * that do not depend on the masking thresholds are computed once per
+ * load, so that many different threshold configurations can be tried
+ * quickly (see sweep_rfistats()).
+ */
+
+extern int compare_floats(const void *a, const void *b);
+
+/* Size of the .stats file header (5 ints) */
+#define STATSHDRLEN (5 * sizeof(int))
+
+static void *map_file(char *filenm, size_t * filelen)
+/* mmap() a whole file read-only.  Return NULL if it can't be opened. */
+{
+    int fd;
+    struct stat buf;
+    void *map;
+
+    fd = open(filenm, O_RDONLY);
+    if (fd == -1)
+        return NULL;
+    if (fstat(fd, &buf) == -1) {
+        int err = errno;
+        close(fd);
+        errno = err;
+        presto_perror(PRESTO_ERR_IO, "Unable to stat '%s'", filenm);
+    }
+    *filelen = buf.st_size;
+    map = mmap(0, *filelen, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED)
+        presto_perror(PRESTO_ERR_IO, "Unable to mmap() '%s'", filenm);
+    return map;
+}
+
+
+void read_rfistats(char *statsfilenm, rfistats * stats)
+/* mmap() an rfifind '.stats' file and calculate the statistics  */
+/* needed to make masks.  If the matching '.bytemask' file       */
+/* exists, its PADDING bits are kept in stats->padmask.           */
+{
+    int *hdr;
+    char *root, *suffix, *bytemaskfilenm;
+    size_t numvals;
+
+    stats->filemap = map_file(statsfilenm, &stats->filelen);
+    if (stats->filemap == NULL)
+        presto_perror(PRESTO_ERR_IO, "Unable to open the stats file '%s'",
+                      statsfilenm);
+    if (stats->filelen < STATSHDRLEN) {
+        munmap(stats->filemap, stats->filelen);
+        presto_error(PRESTO_ERR_EOF, "The stats file '%s' is too short", statsfilenm);
+    }
+    hdr = (int *) stats->filemap;
+    stats->numchan = hdr[0];
+    stats->numint = hdr[1];
+    stats->ptsperint = hdr[2];
+    stats->lobin = hdr[3];
+    stats->numbetween = hdr[4];
+    if (stats->numchan <= 0 || stats->numint <= 0) {
+        munmap(stats->filemap, stats->filelen);
+        presto_error(PRESTO_ERR_FORMAT,
+                     "The stats file '%s' has a bad header (numchan = %d, numint = %d)",
+                     statsfilenm, stats->numchan, stats->numint);
+    }
+    numvals = (size_t) stats->numchan * stats->numint;
+    if (stats->filelen < STATSHDRLEN + 3 * numvals * sizeof(float)) {
+        munmap(stats->filemap, stats->filelen);
+        presto_error(PRESTO_ERR_EOF, "The stats file '%s' is too short", statsfilenm);
+    }
+    stats->datapow = (float *) ((char *) stats->filemap + STATSHDRLEN);
+    stats->dataavg = stats->datapow + numvals;
+    stats->datastd = stats->dataavg + numvals;
+
+    /* The padding from the bytemask (as in 'rfifind -nocompute') */
+    stats->padmask = NULL;
+    if (split_root_suffix(statsfilenm, &root, &suffix)) {
+        size_t bytemasklen;
+        unsigned char *bytemask;
+
+        bytemaskfilenm = (char *) calloc(strlen(root) + 10, 1);
+        sprintf(bytemaskfilenm, "%s.bytemask", root);
+        bytemask = (unsigned char *) map_file(bytemaskfilenm, &bytemasklen);
+        if (bytemask) {
+            if (bytemasklen == numvals) {
+                size_t ii;
+                stats->padmask = (unsigned char *) malloc(numvals);
+                for (ii = 0; ii < numvals; ii++)
+                    stats->padmask[ii] = bytemask[ii] & PADDING;
+            }
+            munmap(bytemask, bytemasklen);
+        }
+        free(bytemaskfilenm);
+        free(root);
+        free(suffix);
+    }
+    calc_rfistats(stats);
+}
+
+
+void free_rfistats(rfistats * stats)
+/* Free the contents of an rfistats structure */
+{
+    vect_free(stats->avg_int_med);
+    vect_free(stats->std_int_med);
+    vect_free(stats->avg_chan_med);
+    vect_free(stats->std_chan_med);
+    if (stats->padmask)
+        free(stats->padmask);
+    if (stats->filemap)
+        munmap(stats->filemap, stats->filelen);
+}
+
+
+void calc_rfistats(rfistats * stats)
+/* Calculate the global, per-interval, and per-channel medians  */
+/* and standard deviations of the averages and std devs in the  */
+/* same way as rfifind.  The vectors for the per-interval and   */
+/* per-channel medians are allocated here.                      */
+{
+    int ii, numchan = stats->numchan, numint = stats->numint;
+    float tmpavg, tmpstd;
+
+    stats->avg_int_med = gen_fvect(numint);
+    stats->std_int_med = gen_fvect(numint);
+    stats->avg_chan_med = gen_fvect(numchan);
+    stats->std_chan_med = gen_fvect(numchan);
+    calc_avgmedstd(stats->dataavg, numchan * numint, 0.8, 1,
+                   &tmpavg, &stats->dataavg_med, &stats->dataavg_std);
+    calc_avgmedstd(stats->datastd, numchan * numint, 0.8, 1,
+                   &tmpavg, &stats->datastd_med, &stats->datastd_std);
+#ifdef _OPENMP
+#pragma omp parallel for private(ii, tmpavg, tmpstd) shared(stats, numchan, numint)
+#endif
+    for (ii = 0; ii < numint; ii++) {
+        calc_avgmedstd(stats->dataavg + ii * numchan, numchan, 0.8, 1,
+                       &tmpavg, stats->avg_int_med + ii, &tmpstd);
+        calc_avgmedstd(stats->datastd + ii * numchan, numchan, 0.8, 1,
+                       &tmpavg, stats->std_int_med + ii, &tmpstd);
+    }
+#ifdef _OPENMP
+#pragma omp parallel for private(ii, tmpavg, tmpstd) shared(stats, numchan, numint)
+#endif
+    for (ii = 0; ii < numchan; ii++) {
+        calc_avgmedstd(stats->dataavg + ii, numint, 0.8, numchan,
+                       &tmpavg, stats->avg_chan_med + ii, &tmpstd);
+        calc_avgmedstd(stats->datastd + ii, numint, 0.8, numchan,
+                       &tmpavg, stats->std_chan_med + ii, &tmpstd);
+    }
+}
+
+
+void flag_rfistats(rfistats * stats, float timesigma, float freqsigma,
+                   unsigned char *bytemask)
+/* Set the BAD_POW, BAD_AVG, and BAD_STD bits in 'bytemask'    */
+/* (numint x numchan) using the rfifind thresholds.  Points     */
+/* that are already marked as PADDING are not flagged.          */
+{
+    int ii, numchan = stats->numchan, numint = stats->numint;
+    float avg_reject, std_reject, pow_reject;
+
+    avg_reject = timesigma * stats->dataavg_std;
+    std_reject = timesigma * stats->datastd_std;
+    pow_reject = power_for_sigma(freqsigma, 1, stats->ptsperint / 2);
+
+    /* Compare each point in an interval (or channel) with   */
+    /* the interval's (or channel's) median and the overall  */
+    /* standard deviation.  If the channel/integration       */
+    /* medians are more than sigma different than the global */
+    /* value, set them to the global.                        */
+#ifdef _OPENMP
+#pragma omp parallel for private(ii) shared(stats, bytemask, numchan, numint, avg_reject, std_reject, pow_reject)
+#endif
+    for (ii = 0; ii < numint; ii++) {
+        int jj;
+        long offset = (long) ii * numchan;
+        float avg_int_med, std_int_med, chan_med;
+        float *pow = stats->datapow + offset;
+        float *avg = stats->dataavg + offset;
+        float *std = stats->datastd + offset;
+        unsigned char *bytes = bytemask + offset;
+
+        if (fabs(stats->avg_int_med[ii] - stats->dataavg_med) > avg_reject)
+            avg_int_med = stats->dataavg_med;
+        else
+            avg_int_med = stats->avg_int_med[ii];
+        if (fabs(stats->std_int_med[ii] - stats->datastd_med) > std_reject)
+            std_int_med = stats->datastd_med;
+        else
+            std_int_med = stats->std_int_med[ii];
+        for (jj = 0; jj < numchan; jj++) {
+            if (bytes[jj] & PADDING)
+                continue;
+            /* Powers */
+            if (pow[jj] > pow_reject)
+                bytes[jj] |= BAD_POW;
+            /* Averages */
+            if (fabs(stats->avg_chan_med[jj] - stats->dataavg_med) > avg_reject)
+                chan_med = stats->dataavg_med;
+            else
+                chan_med = stats->avg_chan_med[jj];
+            if (fabs(avg[jj] - avg_int_med) > avg_reject ||
+                fabs(avg[jj] - chan_med) > avg_reject)
+                bytes[jj] |= BAD_AVG;
+            /* Standard Deviations */
+            if (fabs(stats->std_chan_med[jj] - stats->datastd_med) > std_reject)
+                chan_med = stats->datastd_med;
+            else
+                chan_med = stats->std_chan_med[jj];
+            if (fabs(std[jj] - std_int_med) > std_reject ||
+                fabs(std[jj] - chan_med) > std_reject)
+                bytes[jj] |= BAD_STD;
+        }
+    }
+}
+
+
+int trim_rfi_ints(unsigned char *bytemask, int numchan, int numint,
+                  float chantrigfrac, int *userints, int numuserints)
+/* If the number of bad channels in an interval is greater than */
+/* chantrigfrac*numchan then reject the whole interval.  The     */
+/* rejected intervals are added to 'userints' (which must have   */
+/* room for numint values) and the new number of them returned.  */
+{
+    int ii, jj, badnum, trignum;
+
+    trignum = (int) (numchan * chantrigfrac);
+    for (ii = 0; ii < numint; ii++) {
+        unsigned char *bytes = bytemask + (long) ii * numchan;
+        if (!(bytes[0] & USERINTS)) {
+            badnum = 0;
+            for (jj = 0; jj < numchan; jj++)
+                if (bytes[jj] & BADDATA)
+                    badnum++;
+            if (badnum > trignum) {
+                userints[numuserints++] = ii;
+                for (jj = 0; jj < numchan; jj++)
+                    bytes[jj] |= USERINTS;
+            }
+        }
+    }
+    return numuserints;
+}
+
+
+int trim_rfi_chans(unsigned char *bytemask, int numchan, int numint,
+                   float inttrigfrac, int *userchan, int numuserchan)
+/* If the number of bad intervals in a channel is greater than  */
+/* inttrigfrac*numint then reject the whole channel.  The        */
+/* rejected channels are added to 'userchan' (which must have    */
+/* room for numchan values) and the new number of them returned. */
+{
+    int ii, jj, trignum, *badnum;
+
+    /* Count the bad intervals in a single pass over the mask */
+    badnum = gen_ivect(numchan);
+    for (jj = 0; jj < numchan; jj++)
+        badnum[jj] = 0;
+    for (ii = 0; ii < numint; ii++) {
+        unsigned char *bytes = bytemask + (long) ii * numchan;
+        for (jj = 0; jj < numchan; jj++)
+            if (bytes[jj] & BADDATA)
+                badnum[jj]++;
+    }
+    trignum = (int) (numint * inttrigfrac);
+    for (jj = 0; jj < numchan; jj++) {
+        if (!(bytemask[jj] & USERCHAN) && badnum[jj] > trignum) {
+            userchan[numuserchan++] = jj;
+            for (ii = 0; ii < numint; ii++)
+                bytemask[(long) ii * numchan + jj] |= USERCHAN;
+        }
+    }
+    vect_free(badnum);
+    return numuserchan;
+}
+
+
+void sweep_rfistats(rfistats * stats, int numconfigs, float *timesigmas,
+                    float *freqsigmas, float *chantrigfracs,
+                    float *inttrigfracs, float *maskfracs,
+                    int *numzapchans, int *numzapints)
+/* Make the rfifind mask for each of 'numconfigs' sets of        */
+/* thresholds.  The fraction of the (non-padded) data that is    */
+/* masked, and the numbers of fully zapped channels and          */
+/* intervals are returned for each set.  The configurations      */
+/* are processed in parallel.                                    */
+{
+    int ii;
+    long numvals = (long) stats->numchan * stats->numint;
+
+#ifdef _OPENMP
+#pragma omp parallel for private(ii) shared(stats, numconfigs, numvals, timesigmas, freqsigmas, chantrigfracs, inttrigfracs, maskfracs, numzapchans, numzapints) schedule(dynamic)
+#endif
+    for (ii = 0; ii < numconfigs; ii++) {
+        long jj, numbad = 0, numpad = 0;
+        unsigned char *bytemask;
+        int *userints, *userchan;
+
+        bytemask = (unsigned char *) malloc(numvals);
+        if (stats->padmask)
+            memcpy(bytemask, stats->padmask, numvals);
+        else
+            memset(bytemask, 0, numvals);
+        userints = gen_ivect(stats->numint);
+        userchan = gen_ivect(stats->numchan);
+        flag_rfistats(stats, timesigmas[ii], freqsigmas[ii], bytemask);
+        numzapints[ii] = trim_rfi_ints(bytemask, stats->numchan, stats->numint,
+                                       chantrigfracs[ii], userints, 0);
+        numzapchans[ii] = trim_rfi_chans(bytemask, stats->numchan, stats->numint,
+                                         inttrigfracs[ii], userchan, 0);
+        for (jj = 0; jj < numvals; jj++) {
+            if (bytemask[jj] & PADDING)
+                numpad++;
+            else if (bytemask[jj] & (BADDATA | USERZAP))
+                numbad++;
+        }
+        maskfracs[ii] = (numvals > numpad) ?
+            (float) numbad / (float) (numvals - numpad) : 1.0;
+        vect_free(userints);
+        vect_free(userchan);
+        free(bytemask);
+    }
+}
+
+
+void median_filter(float *data, float *result, int numdata, int medlen)
+/* Running median of length 'medlen' (which must be odd) of 'data' */
+/* with zero padding at the ends (like scipy.signal.medfilt()).    */
+{
+    int ii, halflen = medlen / 2;
+    runmed *rm;
+
+    if (!(medlen & 1))
+        presto_error(PRESTO_ERR_VALUE,
+                     "medlen (%d) must be odd in median_filter()", medlen);
+    rm = runmed_alloc(medlen);
+    /* result[i] is the median once data[i + halflen] is in the window */
+    for (ii = -halflen; ii < numdata + halflen; ii++) {
+        float med = runmed_update(rm, (ii < 0 || ii >= numdata) ? 0.0 : data[ii]);
+        if (ii >= halflen)
+            result[ii - halflen] = med;
+    }
+    runmed_free(rm);
+}
@@ -19,14 +19,11 @@ int prune_powers(float *arr, int n, int numsumpows)
 /* solitary pulsars.                                       */
 {
     int ii, ct = 0;
-    float med, cutoff, *tmparr;
+    float med, cutoff;
 
     /* Determine the median power */
 
-    tmparr = gen_fvect(n);
-    memcpy(tmparr, arr, sizeof(float) * n);
-    med = median(tmparr, n);
-    vect_free(tmparr);
+    med = median_nocopy(arr, n);
 
     /* Throw away powers that are bigger that PRUNELEV * median */
 
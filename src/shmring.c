@@ -0,0 +1,246 @@
+#include <unistd.h>
+#include <fcntl.h>
+#include <stdalign.h>
+#include <time.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "presto.h"
+#include "shmring.h"
+
+/* The shared counters are accessed with the GCC/Clang atomic builtins.  */
+/* The writer marks a slot as busy (seq = -1) before changing its data,  */
+/* and only sets its block number and then write_seq afterwards.  A      */
+/* reader checks the slot's block number both before and after copying  */
+/* the data, so it can never use a slot that was being overwritten.      */
+#define ATOMIC_LOAD(ptr) __atomic_load_n((ptr), __ATOMIC_ACQUIRE)
+#define ATOMIC_STORE(ptr, val) __atomic_store_n((ptr), (val), __ATOMIC_RELEASE)
+
+/* How long to sleep (s) while waiting for the writer */
+#define SHMRING_POLL 0.001
+
+
+static shmringslot *slot_ptr(shmring * ring, long long blocknum)
+{
+    return (shmringslot *) (ring->slots +
+                            (blocknum % ring->hdr->numslots) * ring->hdr->slot_size);
+}
+
+
+static void sleep_secs(double secs)
+{
+    struct timespec ts;
+
+    ts.tv_sec = (time_t) secs;
+    ts.tv_nsec = (long) ((secs - ts.tv_sec) * 1e9);
+    nanosleep(&ts, NULL);
+}
+
+
+void shmring_name(char *outname, char *inname)
+/* Convert a ring name (possibly '/dev/shm/<name>') into the name */
+/* used by shm_open() (i.e. '/<name>')                            */
+{
+    char *base = strrchr(inname, '/');
+
+    base = (base == NULL) ? inname : base + 1;
+    if (strlen(base) == 0 || strlen(base) > 250)
+        presto_error(PRESTO_ERR_VALUE, "bad shared-memory ring name '%s'", inname);
+    sprintf(outname, "/%s", base);
+}
+
+
+shmring *shmring_create(char *name, sigprocfb * fb, int numslots, int spectra_per_slot)
+/* Create (or re-create) the ring 'name' to hold the data described */
+/* by the filterbank header 'fb'.                                   */
+{
+    int fd, ii;
+    long long bytes_per_spectra, slot_size;
+    shmring *ring;
+
+    ring = (shmring *) calloc(1, sizeof(shmring));
+    shmring_name(ring->name, name);
+    bytes_per_spectra = (long long) fb->nchans * fb->nbits / 8 * (fb->sumifs ? 1 : fb->nifs);
+    // Keep the shmringslot at the start of each slot aligned
+    slot_size = sizeof(shmringslot) + spectra_per_slot * bytes_per_spectra;
+    slot_size = (slot_size + alignof(long long) - 1) & ~((long long) alignof(long long) - 1);
+    ring->size = sizeof(shmringhdr) + (size_t) numslots * slot_size;
+    shm_unlink(ring->name);     // Remove any stale ring
+    fd = shm_open(ring->name, O_RDWR | O_CREAT | O_EXCL, 0644);
+    if (fd < 0)
+        presto_perror(PRESTO_ERR_IO, "cannot create shared-memory ring '%s'", ring->name);
+    if (ftruncate(fd, ring->size) < 0)
+        presto_perror(PRESTO_ERR_IO, "cannot size shared-memory ring '%s'", ring->name);
+    ring->hdr = (shmringhdr *) mmap(NULL, ring->size, PROT_READ | PROT_WRITE,
+                                    MAP_SHARED, fd, 0);
+    close(fd);
+    if (ring->hdr == MAP_FAILED)
+        presto_perror(PRESTO_ERR_IO, "cannot map shared-memory ring '%s'", ring->name);
+    ring->writer = 1;
+    ring->hdr->version = SHMRING_VERSION;
+    ring->hdr->hdr_size = sizeof(shmringhdr);
+    ring->hdr->slot_size = slot_size;
+    ring->hdr->numslots = numslots;
+    ring->hdr->spectra_per_slot = spectra_per_slot;
+    ring->hdr->bytes_per_spectra = bytes_per_spectra;
+    ring->hdr->fb = *fb;
+    ring->hdr->write_seq = 0;
+    ring->hdr->write_spec = 0;
+    ring->hdr->done = 0;
+    ring->hdr->numreaders = 0;
+    ring->slots = (unsigned char *) ring->hdr + ring->hdr->hdr_size;
+    for (ii = 0; ii < numslots; ii++)
+        slot_ptr(ring, ii)->seq = -1;
+    // Readers check this last
+    ATOMIC_STORE(&ring->hdr->magic, SHMRING_MAGIC);
+    return ring;
+}
+
+
+shmring *shmring_attach(char *name)
+/* Attach to the existing ring 'name' as a reader */
+{
+    int fd;
+    struct stat st;
+    shmring *ring;
+
+    ring = (shmring *) calloc(1, sizeof(shmring));
+    shmring_name(ring->name, name);
+    fd = shm_open(ring->name, O_RDWR, 0);
+    if (fd < 0)
+        presto_perror(PRESTO_ERR_IO, "cannot open shared-memory ring '%s'", ring->name);
+    if (fstat(fd, &st) < 0 || st.st_size < (off_t) sizeof(shmringhdr))
+        presto_error(PRESTO_ERR_FORMAT, "'%s' is not a shared-memory ring", ring->name);
+    ring->size = st.st_size;
+    // Read/write since readers register themselves in the header
+    ring->hdr = (shmringhdr *) mmap(NULL, ring->size, PROT_READ | PROT_WRITE,
+                                    MAP_SHARED, fd, 0);
+    close(fd);
+    if (ring->hdr == MAP_FAILED)
+        presto_perror(PRESTO_ERR_IO, "cannot map shared-memory ring '%s'", ring->name);
+    if (ATOMIC_LOAD(&ring->hdr->magic) != SHMRING_MAGIC)
+        presto_error(PRESTO_ERR_FORMAT, "'%s' is not a shared-memory ring", ring->name);
+    if (ring->hdr->version != SHMRING_VERSION)
+        presto_error(PRESTO_ERR_FORMAT, "ring '%s' is version %d (not %d)",
+                     ring->name, ring->hdr->version, SHMRING_VERSION);
+    if (ring->hdr->hdr_size + ring->hdr->numslots * ring->hdr->slot_size >
+        (long long) ring->size)
+        presto_error(PRESTO_ERR_FORMAT, "ring '%s' is truncated", ring->name);
+    ring->slots = (unsigned char *) ring->hdr + ring->hdr->hdr_size;
+    ring->writer = 0;
+    __atomic_add_fetch(&ring->hdr->numreaders, 1, __ATOMIC_RELAXED);
+    return ring;
+}
+
+
+void shmring_write_slot(shmring * ring, unsigned char *data, int numspectra)
+/* Write the next block of 'numspectra' spectra into the ring */
+{
+    long long blocknum = ring->hdr->write_seq;
+    shmringslot *slot = slot_ptr(ring, blocknum);
+
+    if (numspectra > ring->hdr->spectra_per_slot)
+        presto_error(PRESTO_ERR_VALUE, "%d spectra will not fit in a slot (max %d)",
+                     numspectra, ring->hdr->spectra_per_slot);
+    ATOMIC_STORE(&slot->seq, -1LL);
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    memcpy((unsigned char *) slot + sizeof(shmringslot), data,
+           (size_t) numspectra * ring->hdr->bytes_per_spectra);
+    slot->numspectra = numspectra;
+    slot->startspec = ring->hdr->write_spec;
+    ring->hdr->write_spec += numspectra;
+    ATOMIC_STORE(&slot->seq, blocknum);
+    ATOMIC_STORE(&ring->hdr->write_seq, blocknum + 1);
+}
+
+
+void shmring_finish(shmring * ring)
+/* Tell the readers that no more data are coming */
+{
+    ATOMIC_STORE(&ring->hdr->done, 1);
+}
+
+
+int shmring_read_slot(shmring * ring, long long blocknum, unsigned char *data,
+                      int *numspectra, double timeout)
+/* Copy block number 'blocknum' from the ring into 'data', waiting  */
+/* for the writer if needed.  If the writer makes no progress for  */
+/* 'timeout' seconds, it is assumed to have stopped.  Returns       */
+/* SHMRING_OK, SHMRING_OVERFLOW, or SHMRING_END.                    */
+{
+    long long seq, lastseq = -1;
+    double waited = 0.0;
+    shmringslot *slot = slot_ptr(ring, blocknum);
+
+    // Wait for the block
+    while ((seq = ATOMIC_LOAD(&ring->hdr->write_seq)) <= blocknum) {
+        if (ATOMIC_LOAD(&ring->hdr->done) && ATOMIC_LOAD(&ring->hdr->write_seq) <= blocknum)
+            return SHMRING_END;
+        if (seq != lastseq) {
+            lastseq = seq;
+            waited = 0.0;
+        } else if (waited > timeout) {
+            return SHMRING_END;
+        }
+        sleep_secs(SHMRING_POLL);
+        waited += SHMRING_POLL;
+    }
+    if (seq - blocknum > ring->hdr->numslots)
+        return SHMRING_OVERFLOW;
+    if (ATOMIC_LOAD(&slot->seq) != blocknum)
+        return SHMRING_OVERFLOW;
+    *numspectra = slot->numspectra;
+    if (*numspectra < 0 || *numspectra > ring->hdr->spectra_per_slot)
+        return SHMRING_OVERFLOW;
+    memcpy(data, (unsigned char *) slot + sizeof(shmringslot),
+           (size_t) * numspectra * ring->hdr->bytes_per_spectra);
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    // Was it overwritten while we were copying?
+    if (ATOMIC_LOAD(&slot->seq) != blocknum)
+        return SHMRING_OVERFLOW;
+    return SHMRING_OK;
+}
+
+
+long long shmring_lost_spectra(shmring * ring, long long blocknum,
+                               long long startspec, long long *nextblock)
+/* After an overflow while reading block 'blocknum' (whose first    */
+/* spectra is number 'startspec'), find the oldest later block that */
+/* is still in the ring.  Return the number of spectra that were    */
+/* lost before it, and its block number in *nextblock.              */
+{
+    long long seq, blk, spec;
+    shmringslot *slot;
+
+    while (1) {
+        seq = ATOMIC_LOAD(&ring->hdr->write_seq);
+        blk = seq - ring->hdr->numslots;
+        if (blk <= blocknum)
+            blk = blocknum + 1;
+        for (; blk < seq; blk++) {
+            slot = slot_ptr(ring, blk);
+            if (ATOMIC_LOAD(&slot->seq) != blk)
+                continue;
+            spec = slot->startspec;
+            __atomic_thread_fence(__ATOMIC_SEQ_CST);
+            if (ATOMIC_LOAD(&slot->seq) == blk) {
+                *nextblock = blk;
+                return spec - startspec;
+            }
+        }
+        // The writer is re-using the only slot (numslots = 1)
+        sleep_secs(SHMRING_POLL);
+    }
+}
+
+
+void shmring_close(shmring * ring)
+/* Unmap the ring.  The writer also removes it, although readers */
+/* that are still attached keep their mappings.                  */
+{
+    if (!ring->writer)
+        __atomic_sub_fetch(&ring->hdr->numreaders, 1, __ATOMIC_RELAXED);
+    munmap(ring->hdr, ring->size);
+    if (ring->writer)
+        shm_unlink(ring->name);
+    free(ring);
+}
@@ -0,0 +1,203 @@
+#include "presto.h"
+#include "shmring.h"
+
+/* Reads SIGPROC filterbank data from a shared-memory ring (see */
+/* shmring.h) as if they were coming from a filterbank file.    */
+
+static shmring *ring = NULL;
+static unsigned char *slotbuffer;
+static long long nextslot = 0;  // Next ring block to read
+static long long currentspec = 0;       // Number of spectra returned so far
+static int slotspectra = 0, slotpos = 0;        // Spectra in / used from slotbuffer
+static int slotpadding = 0;     // Is slotbuffer padding?
+static long long numoverflows = 0;
+static double ring_timeout = 60.0;
+
+extern void add_padding(float *fdata, float *padding, int numchan, int numtopad);
+
+
+void read_shmring_files(struct spectra_info *s)
+{
+    char *envval;
+    sigprocfb fb;
+
+    if (s->num_files != 1)
+        presto_error(PRESTO_ERR_VALUE,
+                     "can only read from a single shared-memory ring (not %d)",
+                     s->num_files);
+    s->datatype = SHMRING;
+    ring = shmring_attach(s->filenames[0]);
+    fb = ring->hdr->fb;
+    if (fb.N <= 0)
+        presto_error(PRESTO_ERR_FORMAT,
+                     "the ring '%s' must give the planned number of spectra",
+                     s->filenames[0]);
+    if ((envval = getenv("PRESTO_SHMRING_TIMEOUT")) != NULL)
+        ring_timeout = atof(envval);
+    // There are no real files, but the other arrays are used
+    s->files = NULL;
+    s->header_offset = gen_ivect(1);
+    s->header_offset[0] = 0;
+    s->start_subint = gen_ivect(1);
+    s->start_subint[0] = 0;
+    s->num_subint = gen_ivect(1);
+    s->num_subint[0] = 0;
+    s->start_spec = (long long *) malloc(sizeof(long long));
+    s->num_spec = (long long *) malloc(sizeof(long long));
+    s->num_pad = (long long *) malloc(sizeof(long long));
+    s->start_MJD = (long double *) malloc(sizeof(long double));
+    s->N = fb.N;
+    set_filterbank_spectra_info(&fb, s);
+    if (s->bytes_per_spectra != ring->hdr->bytes_per_spectra)
+        presto_error(PRESTO_ERR_FORMAT,
+                     "ring '%s' has %d bytes per spectra (expected %d)",
+                     s->filenames[0], ring->hdr->bytes_per_spectra,
+                     s->bytes_per_spectra);
+    slotbuffer = gen_bvect((long) ring->hdr->spectra_per_slot * s->bytes_per_spectra);
+    s->start_MJD[0] = fb.tstart;
+    mjd_to_datestr(s->start_MJD[0], s->date_obs);
+    s->start_spec[0] = 0L;
+    s->num_spec[0] = fb.N;
+    s->num_pad[0] = 0L;
+    s->get_rawblock = &get_shmring_rawblock;
+    s->offset_to_spectra = &offset_to_shmring_spectra;
+    nextslot = currentspec = 0;
+    slotspectra = slotpos = slotpadding = 0;
+    numoverflows = 0;
+}
+
+
+static void next_shmring_slot(struct spectra_info *s)
+// Get the next slot of spectra from the ring into slotbuffer.  If it
+// was lost (or never written) mark it as padding.
+{
+    int status, numspectra;
+
+    status = shmring_read_slot(ring, nextslot, slotbuffer, &numspectra, ring_timeout);
+    if (status == SHMRING_OK) {
+        slotspectra = numspectra;
+        slotpadding = 0;
+    } else if (status == SHMRING_OVERFLOW) {
+        long long numlost;
+
+        if (numoverflows == 0)
+            fprintf(stderr,
+                    "\nWarning:  fell behind the writer of ring '%s'.  Padding the lost data.\n",
+                    ring->name);
+        numoverflows++;
+        // Pad the spectra that were actually lost (up to the oldest
+        // block still in the ring) and continue from there
+        numlost = shmring_lost_spectra(ring, nextslot, currentspec, &nextslot);
+        if (numlost > s->N - currentspec)
+            numlost = s->N - currentspec;
+        slotspectra = (int) numlost;
+        slotpadding = 1;
+        slotpos = 0;
+        return;
+    } else {                    // SHMRING_END: pad to the end of the observation
+        if (currentspec < s->N)
+            fprintf(stderr,
+                    "\nWarning:  ring '%s' ended early.  Padding the last %lld spectra.\n",
+                    ring->name, s->N - currentspec);
+        slotspectra = (int) (s->N - currentspec);
+        slotpadding = 1;
+        // Don't wait on the ring again
+        nextslot = -1;
+        slotpos = 0;
+        return;
+    }
+    nextslot++;
+    slotpos = 0;
+}
+
+
+long long offset_to_shmring_spectra(long long specnum, struct spectra_info *s)
+// A ring can only be read in order, so skip (i.e. read and ignore)
+// spectra to get to 'specnum'.  It returns the current spectra number.
+{
+    int numtoskip;
+
+    if (specnum > s->N) {
+        presto_error(PRESTO_ERR_VALUE,
+                     "offset spectra %lld is > total spectra %lld", specnum, s->N);
+    }
+    if (specnum < currentspec) {
+        presto_error(PRESTO_ERR_VALUE,
+                     "cannot seek backwards (to spectra %lld from %lld) in ring '%s'",
+                     specnum, currentspec, ring->name);
+    }
+    while (currentspec < specnum) {
+        if (slotpos == slotspectra) {
+            if (nextslot < 0)
+                break;
+            next_shmring_slot(s);
+        }
+        numtoskip = slotspectra - slotpos;
+        if (numtoskip > specnum - currentspec)
+            numtoskip = specnum - currentspec;
+        slotpos += numtoskip;
+        currentspec += numtoskip;
+    }
+    return specnum;
+}
+
+
+int get_shmring_rawblock(float *fdata, struct spectra_info *s, int *padding)
+// This routine reads a single block (i.e subint) of SIGPROC
+// filterbank format data from a shared-memory ring.  If padding is
+// returned as 1, then padding was added (for data that were lost or
+// never written) and statistics should not be calculated.  Return 1
+// on success.
+{
+    int numbuffered = 0, numtocopy;
+
+    // Like the filterbank reader, don't return partial blocks
+    if (currentspec + s->spectra_per_subint > s->N)
+        return 0;
+    *padding = 0;
+    while (numbuffered < s->spectra_per_subint) {
+        if (slotpos == slotspectra) {
+            if (nextslot < 0)   // Shouldn't happen (since we pad to s->N)
+                return 0;
+            next_shmring_slot(s);
+        }
+        numtocopy = slotspectra - slotpos;
+        if (numtocopy > s->spectra_per_subint - numbuffered)
+            numtocopy = s->spectra_per_subint - numbuffered;
+        if (slotpadding) {
+            add_padding(fdata + numbuffered * s->num_channels, s->padvals,
+                        s->num_channels, numtocopy);
+            *padding = 1;
+        } else {
+            convert_filterbank_block(fdata + numbuffered * s->num_channels,
+                                     slotbuffer + (long) slotpos * s->bytes_per_spectra,
+                                     numtocopy, s);
+        }
+        slotpos += numtocopy;
+        numbuffered += numtocopy;
+        currentspec += numtocopy;
+    }
+
+    // Apply the corrections that need a full block
+
+    // Invert the band if requested
+    if (s->apply_flipband)
+        flip_band(fdata, s);
+
+    // Perform Zero-DMing if requested
+    if (s->remove_zerodm)
+        remove_zerodm(fdata, s);
+
+    return 1;
+}
+
+
+void close_shmring_files(struct spectra_info *s)
+{
+    if (numoverflows)
+        fprintf(stderr, "Lost %lld slots (of %d spectra) from ring '%s'.\n",
+                numoverflows, ring->hdr->spectra_per_slot, s->filenames[0]);
+    shmring_close(ring);
+    ring = NULL;
+    vect_free(slotbuffer);
+}
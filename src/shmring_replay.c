@@ -0,0 +1,105 @@
+#include <time.h>
+#include <sys/time.h>
+#include "presto.h"
+#include "shmring.h"
+
+/* Replay a SIGPROC filterbank file into a shared-memory ring so    */
+/* that rfifind, prepsubband, etc (using -shmring) can be tested    */
+/* as if the data were coming from a real-time backend.             */
+
+static void usage(void)
+{
+    printf("\nUsage:  shmring_replay [-slots numslots] [-spectra spectra_per_slot]\n"
+           "                       [-readers numreaders] [-realtime]\n"
+           "                       ringname.shmring file.fil\n\n"
+           "   -slots numslots          Number of slots in the ring (default 64)\n"
+           "   -spectra spectra_per_slot  Spectra per slot (default 1024)\n"
+           "   -readers numreaders      Wait for this many readers to attach\n"
+           "                            before writing (default 0)\n"
+           "   -realtime                Write the data at the sample rate\n\n");
+}
+
+
+static double wall_time(void)
+{
+    struct timeval tv;
+
+    gettimeofday(&tv, NULL);
+    return tv.tv_sec + 1e-6 * tv.tv_usec;
+}
+
+
+int main(int argc, char *argv[])
+{
+    FILE *infile;
+    sigprocfb fb;
+    shmring *ring;
+    unsigned char *buffer;
+    int ii, numslots = 64, spectra_per_slot = 1024, numreaders = 0, realtime = 0;
+    int numread;
+    long long bytes_per_spectra, numwritten = 0;
+    double starttime;
+
+    for (ii = 1; ii < argc - 2; ii++) {
+        if (strcmp(argv[ii], "-slots") == 0 && ii + 1 < argc - 2)
+            numslots = atoi(argv[++ii]);
+        else if (strcmp(argv[ii], "-spectra") == 0 && ii + 1 < argc - 2)
+            spectra_per_slot = atoi(argv[++ii]);
+        else if (strcmp(argv[ii], "-readers") == 0 && ii + 1 < argc - 2)
+            numreaders = atoi(argv[++ii]);
+        else if (strcmp(argv[ii], "-realtime") == 0)
+            realtime = 1;
+        else
+            break;
+    }
+    if (argc < 3 || ii != argc - 2 || numslots < 2 || spectra_per_slot < 1) {
+        usage();
+        exit(1);
+    }
+
+    infile = chkfopen(argv[argc - 1], "rb");
+    read_filterbank_header(&fb, infile);
+    if (fb.N <= 0)
+        presto_error(PRESTO_ERR_FORMAT, "no spectra in '%s'", argv[argc - 1]);
+    ring = shmring_create(argv[argc - 2], &fb, numslots, spectra_per_slot);
+    bytes_per_spectra = ring->hdr->bytes_per_spectra;
+    buffer = gen_bvect(spectra_per_slot * bytes_per_spectra);
+    printf("Replaying %lld spectra from '%s'\n  into the %d x %d spectra ring '%s'\n",
+           fb.N, argv[argc - 1], numslots, spectra_per_slot, ring->name);
+    if (numreaders) {
+        printf("Waiting for %d reader(s)...\n", numreaders);
+        while (__atomic_load_n(&ring->hdr->numreaders, __ATOMIC_ACQUIRE) < numreaders) {
+            struct timespec ts = { 0, 10000000 };
+            nanosleep(&ts, NULL);
+        }
+    }
+    fflush(stdout);
+
+    starttime = wall_time();
+    while (numwritten < fb.N) {
+        numread = chkfread(buffer, bytes_per_spectra, spectra_per_slot, infile);
+        if (numread == 0)
+            break;
+        if (realtime) {
+            // Don't get ahead of where a real backend would be
+            double waittime = (numwritten + numread) * fb.tsamp -
+                (wall_time() - starttime);
+            if (waittime > 0.0) {
+                struct timespec ts;
+                ts.tv_sec = (time_t) waittime;
+                ts.tv_nsec = (long) ((waittime - ts.tv_sec) * 1e9);
+                nanosleep(&ts, NULL);
+            }
+        }
+        shmring_write_slot(ring, buffer, numread);
+        numwritten += numread;
+    }
+    shmring_finish(ring);
+    printf("Wrote %lld spectra in %.2f s.\n", numwritten, wall_time() - starttime);
+
+    // Readers that are attached keep their mappings after this
+    shmring_close(ring);
+    fclose(infile);
+    vect_free(buffer);
+    exit(0);
+}
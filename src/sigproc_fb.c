@@ -26,7 +26,8 @@ static void get_string(FILE * inputfile, int *nbytes, char string[])
     strcpy(string, "ERROR");
     chkfread(&nchar, sizeof(int), 1, inputfile);
     *nbytes = sizeof(int);
-    if (feof(inputfile)) exit(0);
+    if (feof(inputfile))
+        presto_error(PRESTO_ERR_EOF, "Unexpected end of SIGPROC filterbank header");
     if (nchar > 80 || nchar < 1)
         return;
     chkfread(string, nchar, 1, inputfile);
@@ -252,7 +253,7 @@ void write_filterbank_header(sigprocfb * fb, FILE * outfile)
 /* attempt to read in the general header info from a pulsar data file */
 int read_filterbank_header(sigprocfb * fb, FILE * inputfile)
 {
-    char string[80], message[80];
+    char string[80];
     int itmp, nbytes = 0, totalbytes;
     int expecting_rawdatafile = 0, expecting_source_name = 0;
     int barycentric, pulsarcentric;
@@ -353,10 +354,8 @@ int read_filterbank_header(sigprocfb * fb, FILE * inputfile)
             strcpy(fb->source_name, string);
             expecting_source_name = 0;
         } else {
-            sprintf(message, "read_filterbank_header - unknown parameter: %s\n",
-                    string);
-            fprintf(stderr, "ERROR: %s\n", message);
-            exit(1);
+            presto_error(PRESTO_ERR_FORMAT,
+                         "read_filterbank_header - unknown parameter: %s", string);
         }
     }
     /* add on last header string */
@@ -375,92 +374,105 @@ int read_filterbank_header(sigprocfb * fb, FILE * inputfile)
 
 
 
-void read_filterbank_files(struct spectra_info *s)
+void set_filterbank_spectra_info(sigprocfb * fb, struct spectra_info *s)
+// Fill in the parts of the spectra_info structure that are described
+// by a SIGPROC filterbank header (everything except the files)
 {
-    sigprocfb fb;
     int ii;
 
-    // s->num_files and s->filenames are assumed to be set
-    s->datatype = SIGPROCFB;
-    s->files = (FILE **) malloc(sizeof(FILE *) * s->num_files);
-    s->header_offset = gen_ivect(s->num_files);
-    // The following two aren't used for filterbank data,
-    // but they should be initialized for mpiprepsubband
-    s->start_subint = gen_ivect(s->num_files);
-    for (ii = 0; ii < s->num_files; ii++)
-        s->start_subint[ii] = 0;
-    s->num_subint = gen_ivect(s->num_files);
-    for (ii = 0; ii < s->num_files; ii++)
-        s->start_subint[ii] = 0;
-    s->start_spec = (long long *) malloc(sizeof(long long) * s->num_files);
-    s->num_spec = (long long *) malloc(sizeof(long long) * s->num_files);
-    s->num_pad = (long long *) malloc(sizeof(long long) * s->num_files);
-    s->start_MJD = (long double *) malloc(sizeof(long double) * s->num_files);
-#if DEBUG_OUT
-    printf("Reading '%s'\n", s->filenames[0]);
-#endif
-    s->files[0] = chkfopen(s->filenames[0], "r");
-    // Read the filterbank header into a SIGPROCFB struct
-    s->header_offset[0] = read_filterbank_header(&fb, s->files[0]);
-    // Make an initial offset into the file
-    chkfseek(s->files[0], s->header_offset[0], SEEK_SET);
-    strncpy(s->source, fb.source_name, 80);
+    strncpy(s->source, fb->source_name, 80);
     s->source[80] = '\0'; // ensure null-terminated
-    if (fb.sumifs) {
+    if (fb->sumifs) {
         s->summed_polns = 1;
         s->num_polns = 1;
     } else {
-        s->num_polns = fb.nifs;
-        strncpy(s->poln_order, fb.ifstream, 8);
+        s->num_polns = fb->nifs;
+        strncpy(s->poln_order, fb->ifstream, 8);
     }
     // Position info
     {
         int d, h, m;
         double sec;
-        h = (int) floor(fb.src_raj / 10000.0);
-        m = (int) floor((fb.src_raj - h * 10000) / 100.0);
-        sec = fb.src_raj - h * 10000 - m * 100;
+        h = (int) floor(fb->src_raj / 10000.0);
+        m = (int) floor((fb->src_raj - h * 10000) / 100.0);
+        sec = fb->src_raj - h * 10000 - m * 100;
         ra_dec_to_string(s->ra_str, h, m, sec);
         s->ra2000 = hms2rad(h, m, sec) * RADTODEG;
-        d = (int) floor(fabs(fb.src_dej) / 10000.0);
-        m = (int) floor((fabs(fb.src_dej) - d * 10000) / 100.0);
-        sec = fabs(fb.src_dej) - d * 10000 - m * 100;
-        if (fb.src_dej < 0.0)
+        d = (int) floor(fabs(fb->src_dej) / 10000.0);
+        m = (int) floor((fabs(fb->src_dej) - d * 10000) / 100.0);
+        sec = fabs(fb->src_dej) - d * 10000 - m * 100;
+        if (fb->src_dej < 0.0)
             d = -d;
         ra_dec_to_string(s->dec_str, d, m, sec);
         s->dec2000 = dms2rad(d, m, sec) * RADTODEG;
     }
-    s->bits_per_sample = fb.nbits;
-    s->signedints = fb.signedints;
-    s->num_channels = fb.nchans;
+    s->bits_per_sample = fb->nbits;
+    s->signedints = fb->signedints;
+    s->num_channels = fb->nchans;
     s->samples_per_spectra = s->num_polns * s->num_channels;
     s->bytes_per_spectra = s->bits_per_sample * s->samples_per_spectra / 8;
     s->spectra_per_subint = 2400;        // use this as the blocksize
+    // which needs to be a multiple of any time scrunching
+    if (s->tscrunch > 1 && s->spectra_per_subint % s->tscrunch)
+        s->spectra_per_subint += s->tscrunch - s->spectra_per_subint % s->tscrunch;
     s->bytes_per_subint = s->bytes_per_spectra * s->spectra_per_subint;
     s->samples_per_subint = s->spectra_per_subint * s->samples_per_spectra;
     s->min_spect_per_read = 1;  // Can read a single spectra at a time
-    // allocate the raw data buffers
-    cdatabuffer = gen_bvect(s->bytes_per_subint);
-    fdatabuffer = gen_fvect(s->spectra_per_subint * s->num_channels);
     s->padvals = gen_fvect(s->num_channels);
     for (ii = 0; ii < s->num_channels; ii++)
         s->padvals[ii] = 0.0;
-    s->dt = fb.tsamp;
+    s->dt = fb->tsamp;
     s->time_per_subint = s->spectra_per_subint * s->dt;
     s->T = s->N * s->dt;
-    s->df = fabs(fb.foff);
-    if (fb.foff < 0.0 && s->apply_flipband == -1)
+    s->df = fabs(fb->foff);
+    if (fb->foff < 0.0 && s->apply_flipband == -1)
         s->apply_flipband = 0;  // we do this automatically
     s->BW = s->num_channels * s->df;
-    s->lo_freq = fb.fch1 - (s->num_channels - 1) * s->df;
-    s->hi_freq = fb.fch1;
+    s->lo_freq = fb->fch1 - (s->num_channels - 1) * s->df;
+    s->hi_freq = fb->fch1;
     s->fctr = s->lo_freq - 0.5 * s->df + 0.5 * s->BW;
-    s->azimuth = fb.az_start;
-    s->zenith_ang = fb.za_start;
+    s->azimuth = fb->az_start;
+    s->zenith_ang = fb->za_start;
     s->num_beams = 1;
-    s->beamnum = fb.ibeam;
-    get_telescope_name(fb.telescope_id, s);
-    get_backend_name(fb.machine_id, s);
+    s->beamnum = fb->ibeam;
+    get_telescope_name(fb->telescope_id, s);
+    get_backend_name(fb->machine_id, s);
+}
+
+
+void read_filterbank_files(struct spectra_info *s)
+{
+    sigprocfb fb, *fbs;
+    int ii;
+
+    // s->num_files and s->filenames are assumed to be set
+    s->datatype = SIGPROCFB;
+    s->files = (FILE **) malloc(sizeof(FILE *) * s->num_files);
+    s->header_offset = gen_ivect(s->num_files);
+    // The following two aren't used for filterbank data,
+    // but they should be initialized for mpiprepsubband
+    s->start_subint = gen_ivect(s->num_files);
+    for (ii = 0; ii < s->num_files; ii++)
+        s->start_subint[ii] = 0;
+    s->num_subint = gen_ivect(s->num_files);
+    for (ii = 0; ii < s->num_files; ii++)
+        s->start_subint[ii] = 0;
+    s->start_spec = (long long *) malloc(sizeof(long long) * s->num_files);
+    s->num_spec = (long long *) malloc(sizeof(long long) * s->num_files);
+    s->num_pad = (long long *) malloc(sizeof(long long) * s->num_files);
+    s->start_MJD = (long double *) malloc(sizeof(long double) * s->num_files);
+#if DEBUG_OUT
+    printf("Reading '%s'\n", s->filenames[0]);
+#endif
+    s->files[0] = chkfopen(s->filenames[0], "r");
+    // Read the filterbank header into a SIGPROCFB struct
+    s->header_offset[0] = read_filterbank_header(&fb, s->files[0]);
+    // Make an initial offset into the file
+    chkfseek(s->files[0], s->header_offset[0], SEEK_SET);
+    set_filterbank_spectra_info(&fb, s);
+    // allocate the raw data buffers
+    cdatabuffer = gen_bvect(s->bytes_per_subint);
+    fdatabuffer = gen_fvect(s->spectra_per_subint * s->num_channels);
     s->start_MJD[0] = fb.tstart;
     mjd_to_datestr(s->start_MJD[0], s->date_obs);
     s->start_spec[0] = 0L;
@@ -469,46 +481,51 @@ void read_filterbank_files(struct spectra_info *s)
     s->get_rawblock = &get_filterbank_rawblock;
     s->offset_to_spectra = &offset_to_filterbank_spectra;
 
+    // Read the headers of the other files (in parallel, since for
+    // large sets of files this is mostly waiting on the file system)
+    fbs = (sigprocfb *) malloc(sizeof(sigprocfb) * s->num_files);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) default(shared)
+#endif
+    for (ii = 1; ii < s->num_files; ii++) {
+        s->files[ii] = chkfopen(s->filenames[ii], "r");
+        s->header_offset[ii] = read_filterbank_header(fbs + ii, s->files[ii]);
+        // Make an initial offset into each file to the spactra
+        chkfseek(s->files[ii], s->header_offset[ii], SEEK_SET);
+    }
+
     // Step through the other files
     for (ii = 1; ii < s->num_files; ii++) {
 
 #if DEBUG_OUT
         printf("Reading '%s'\n", s->filenames[ii]);
 #endif
-        s->files[ii] = chkfopen(s->filenames[ii], "r");
-        s->header_offset[ii] = read_filterbank_header(&fb, s->files[ii]);
-        // Make an initial offset into each file to the spactra
-        chkfseek(s->files[ii], s->header_offset[ii], SEEK_SET);
+        fb = fbs[ii];
         // Compare key values with s->XXX[0] to see if things are the same
         if (s->num_channels != fb.nchans) {
-            fprintf(stderr,
-                    "Error:  num chans %d in file #%d does not match original num chans %d!!\n",
-                    fb.nchans, ii + 1, s->num_channels);
-            exit(1);
+            presto_error(PRESTO_ERR_FORMAT,
+                         "num chans %d in file #%d does not match original num chans %d!!",
+                         fb.nchans, ii + 1, s->num_channels);
         }
         if (s->bits_per_sample != fb.nbits) {
-            fprintf(stderr,
-                    "Error:  bits per sample %d in file #%d does not match original bits per sample %d!!\n",
-                    fb.nbits, ii + 1, s->bits_per_sample);
-            exit(1);
+            presto_error(PRESTO_ERR_FORMAT,
+                         "bits per sample %d in file #%d does not match original bits per sample %d!!",
+                         fb.nbits, ii + 1, s->bits_per_sample);
         }
         if (s->dt != fb.tsamp) {
-            fprintf(stderr,
-                    "Error:  sample time %f in file #%d does not match original sample time %f!!\n",
-                    fb.tsamp, ii + 1, s->dt);
-            exit(1);
+            presto_error(PRESTO_ERR_FORMAT,
+                         "sample time %f in file #%d does not match original sample time %f!!",
+                         fb.tsamp, ii + 1, s->dt);
         }
         if (s->df != fabs(fb.foff)) {
-            fprintf(stderr,
-                    "Error:  channel width %f in file #%d does not match original channel width %f!!\n",
-                    fabs(fb.foff), ii + 1, s->df);
-            exit(1);
+            presto_error(PRESTO_ERR_FORMAT,
+                         "channel width %f in file #%d does not match original channel width %f!!",
+                         fabs(fb.foff), ii + 1, s->df);
         }
         if (s->hi_freq != fb.fch1) {
-            fprintf(stderr,
-                    "Error:  high chan freq %f in file #%d does not match original high chan freq %f!!\n",
-                    fb.fch1, ii + 1, s->hi_freq);
-            exit(1);
+            presto_error(PRESTO_ERR_FORMAT,
+                         "high chan freq %f in file #%d does not match original high chan freq %f!!",
+                         fb.fch1, ii + 1, s->hi_freq);
         }
         s->start_MJD[ii] = fb.tstart;
         s->start_spec[ii] =
@@ -518,6 +535,7 @@ void read_filterbank_files(struct spectra_info *s)
         s->num_spec[ii] = fb.N;
         s->N += s->num_spec[ii] + s->num_pad[ii - 1];
     }
+    free(fbs);
     s->T = s->N * s->dt;
     s->num_pad[s->num_files - 1] = 0L;
 }
@@ -531,9 +549,8 @@ long long offset_to_filterbank_spectra(long long specnum, struct spectra_info *s
     int filenum = 0;
 
     if (specnum > s->N) {
-        fprintf(stderr, "Error:  offset spectra %lld is > total spectra %lld\n\n",
-                specnum, s->N);
-        exit(1);
+        presto_error(PRESTO_ERR_VALUE,
+                     "offset spectra %lld is > total spectra %lld", specnum, s->N);
     }
     // Find which file we need
     while (filenum + 1 < s->num_files && specnum > s->start_spec[filenum + 1])
@@ -626,11 +643,10 @@ int get_filterbank_rawblock(float *fdata, struct spectra_info *s, int *padding)
                 }
             }
         } else {
-            fprintf(stderr,
-                    "Error: Problem reading record from filterbank data file:\n");
-            fprintf(stderr, "   currentfile = %d, currentblock = %d.  Exiting.\n",
-                    currentfile, currentblock);
-            exit(1);
+            presto_error(PRESTO_ERR_IO,
+                         "Problem reading record from filterbank data file:\n"
+                         "   currentfile = %d, currentblock = %d.",
+                         currentfile, currentblock);
         }
     }
 
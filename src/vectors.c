@@ -1,25 +1,45 @@
 #include "vectors.h"
+#include <string.h>
+#ifdef __linux__
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#endif
 
 // following is in bytes and must be
 // 1) a power of 2 and
 // 2) a multiple of the size of (void *), 8 bytes on 64 bit Linux 
 #define ALIGNSIZE 64
 
+presto_status try_gen_fvect(long length, float ** v)
+{
+#ifdef USE_FFTW_MALLOC
+    *v = (float *) fftwf_malloc((size_t) (sizeof(float) * length));
+#else
+    *v = (float *) aligned_alloc(ALIGNSIZE, (size_t) (sizeof(float) * length));
+#endif
+    return (*v) ? PRESTO_OK : PRESTO_ERR_NOMEM;
+}
+
+
 float *gen_fvect(long length)
 {
     float *v;
 
+    if (try_gen_fvect(length, &v) != PRESTO_OK)
+        presto_perror(PRESTO_ERR_NOMEM, "gen_fvect() failed");
+    return v;
+}
+
+
+presto_status try_gen_dvect(long length, double ** v)
+{
 #ifdef USE_FFTW_MALLOC
-    v = (float *) fftwf_malloc((size_t) (sizeof(float) * length));
+    *v = (double *) fftwf_malloc((size_t) (sizeof(double) * length));
 #else
-    v = (float *) aligned_alloc(ALIGNSIZE, (size_t) (sizeof(float) * length));
+    *v = (double *) aligned_alloc(ALIGNSIZE, (size_t) (sizeof(double) * length));
 #endif
-    if (!v) {
-        perror("\nError in gen_fvect()");
-        printf("\n");
-        exit(-1);
-    }
-    return v;
+    return (*v) ? PRESTO_OK : PRESTO_ERR_NOMEM;
 }
 
 
@@ -27,17 +47,20 @@ double *gen_dvect(long length)
 {
     double *v;
 
+    if (try_gen_dvect(length, &v) != PRESTO_OK)
+        presto_perror(PRESTO_ERR_NOMEM, "gen_dvect() failed");
+    return v;
+}
+
+
+presto_status try_gen_cvect(long length, fcomplex ** v)
+{
 #ifdef USE_FFTW_MALLOC
-    v = (double *) fftwf_malloc((size_t) (sizeof(double) * length));
+    *v = (fcomplex *) fftwf_malloc((size_t) (sizeof(fcomplex) * length));
 #else
-    v = (double *) aligned_alloc(ALIGNSIZE, (size_t) (sizeof(double) * length));
+    *v = (fcomplex *) aligned_alloc(ALIGNSIZE, (size_t) (sizeof(fcomplex) * length));
 #endif
-    if (!v) {
-        perror("\nError in gen_dvect()");
-        printf("\n");
-        exit(-1);
-    }
-    return v;
+    return (*v) ? PRESTO_OK : PRESTO_ERR_NOMEM;
 }
 
 
@@ -45,16 +68,8 @@ fcomplex *gen_cvect(long length)
 {
     fcomplex *v;
 
-#ifdef USE_FFTW_MALLOC
-    v = (fcomplex *) fftwf_malloc((size_t) (sizeof(fcomplex) * length));
-#else
-    v = (fcomplex *) aligned_alloc(ALIGNSIZE, (size_t) (sizeof(fcomplex) * length));
-#endif
-    if (!v) {
-        perror("\nError in gen_cvect()");
-        printf("\n");
-        exit(-1);
-    }
+    if (try_gen_cvect(length, &v) != PRESTO_OK)
+        presto_perror(PRESTO_ERR_NOMEM, "gen_cvect() failed");
     return v;
 }
 
@@ -69,9 +84,7 @@ short *gen_svect(long length)
     v = (short *) aligned_alloc(ALIGNSIZE, (size_t) (sizeof(short) * length));
 #endif
     if (!v) {
-        perror("\nError in gen_svect()");
-        printf("\n");
-        exit(-1);
+        presto_perror(PRESTO_ERR_NOMEM, "gen_svect() failed");
     }
     return v;
 }
@@ -87,9 +100,7 @@ int *gen_ivect(long length)
     v = (int *) aligned_alloc(ALIGNSIZE, (size_t) (sizeof(int) * length));
 #endif
     if (!v) {
-        perror("\nError in gen_ivect()");
-        printf("\n");
-        exit(-1);
+        presto_perror(PRESTO_ERR_NOMEM, "gen_ivect() failed");
     }
     return v;
 }
@@ -105,9 +116,7 @@ long *gen_lvect(long length)
     v = (long *) aligned_alloc(ALIGNSIZE, (size_t) (sizeof(long) * length));
 #endif
     if (!v) {
-        perror("\nError in gen_lvect()");
-        printf("\n");
-        exit(-1);
+        presto_perror(PRESTO_ERR_NOMEM, "gen_lvect() failed");
     }
     return v;
 }
@@ -123,9 +132,7 @@ unsigned char *gen_bvect(long length)
     v = (unsigned char *) aligned_alloc(ALIGNSIZE, (size_t) (sizeof(unsigned char) * length));
 #endif
     if (!v) {
-        perror("\nError in gen_bvect()");
-        printf("\n");
-        exit(-1);
+        presto_perror(PRESTO_ERR_NOMEM, "gen_bvect() failed");
     }
     return v;
 }
@@ -142,9 +149,7 @@ rawtype *gen_rawvect(long length)
     v = (rawtype *) aligned_alloc(ALIGNSIZE, (size_t) (sizeof(rawtype) * length));
 #endif
     if (!v) {
-        perror("\nError in gen_rawvect()");
-        printf("\n");
-        exit(-1);
+        presto_perror(PRESTO_ERR_NOMEM, "gen_rawvect() failed");
     }
     return v;
 }
@@ -167,9 +172,7 @@ unsigned char **gen_bmatrix(long nrows, long ncols)
     m = (unsigned char **) aligned_alloc(ALIGNSIZE, (size_t) (nrows * sizeof(unsigned char *)));
 #endif
     if (!m) {
-        perror("\nError in 1st malloc() in gen_bmatrix()");
-        printf("\n");
-        exit(-1);
+        presto_perror(PRESTO_ERR_NOMEM, "1st malloc() in gen_bmatrix() failed");
     }
 #ifdef USE_FFTW_MALLOC
     m[0] = (unsigned char *) fftwf_malloc((size_t) ((nrows * ncols) * sizeof(unsigned char)));
@@ -177,9 +180,7 @@ unsigned char **gen_bmatrix(long nrows, long ncols)
     m[0] = (unsigned char *) aligned_alloc(ALIGNSIZE, (size_t) ((nrows * ncols) * sizeof(unsigned char)));
 #endif
     if (!m[0]) {
-        perror("\nError in 2nd malloc() in gen_bmatrix()");
-        printf("\n");
-        exit(-1);
+        presto_perror(PRESTO_ERR_NOMEM, "2nd malloc() in gen_bmatrix() failed");
     }
     for (i = 1; i < nrows; i++)
         m[i] = m[i - 1] + ncols;
@@ -204,9 +205,7 @@ short **gen_smatrix(long nrows, long ncols)
     m = (short **) aligned_alloc(ALIGNSIZE, (size_t) (nrows * sizeof(short *)));
 #endif
     if (!m) {
-        perror("\nError in 1st malloc() in gen_smatrix()");
-        printf("\n");
-        exit(-1);
+        presto_perror(PRESTO_ERR_NOMEM, "1st malloc() in gen_smatrix() failed");
     }
 #ifdef USE_FFTW_MALLOC
     m[0] = (short *) fftwf_malloc((size_t) ((nrows * ncols) * sizeof(short)));
@@ -214,9 +213,7 @@ short **gen_smatrix(long nrows, long ncols)
     m[0] = (short *) aligned_alloc(ALIGNSIZE, (size_t) ((nrows * ncols) * sizeof(short)));
 #endif
     if (!m[0]) {
-        perror("\nError in 2nd malloc() in gen_smatrix()");
-        printf("\n");
-        exit(-1);
+        presto_perror(PRESTO_ERR_NOMEM, "2nd malloc() in gen_smatrix() failed");
     }
     for (i = 1; i < nrows; i++)
         m[i] = m[i - 1] + ncols;
@@ -241,9 +238,7 @@ int **gen_imatrix(long nrows, long ncols)
     m = (int **) aligned_alloc(ALIGNSIZE, (size_t) (nrows * sizeof(int *)));
 #endif
     if (!m) {
-        perror("\nError in 1st malloc() in gen_imatrix()");
-        printf("\n");
-        exit(-1);
+        presto_perror(PRESTO_ERR_NOMEM, "1st malloc() in gen_imatrix() failed");
     }
 #ifdef USE_FFTW_MALLOC
     m[0] = (int *) fftwf_malloc((size_t) ((nrows * ncols) * sizeof(int)));
@@ -251,9 +246,7 @@ int **gen_imatrix(long nrows, long ncols)
     m[0] = (int *) aligned_alloc(ALIGNSIZE, (size_t) ((nrows * ncols) * sizeof(int)));
 #endif
     if (!m[0]) {
-        perror("\nError in 2nd malloc() in gen_imatrix()");
-        printf("\n");
-        exit(-1);
+        presto_perror(PRESTO_ERR_NOMEM, "2nd malloc() in gen_imatrix() failed");
     }
     for (i = 1; i < nrows; i++)
         m[i] = m[i - 1] + ncols;
@@ -278,9 +271,7 @@ float **gen_fmatrix(long nrows, long ncols)
     m = (float **) aligned_alloc(ALIGNSIZE, (size_t) (nrows * sizeof(float *)));
 #endif
     if (!m) {
-        perror("\nError in 1st malloc() in gen_fmatrix()");
-        printf("\n");
-        exit(-1);
+        presto_perror(PRESTO_ERR_NOMEM, "1st malloc() in gen_fmatrix() failed");
     }
 #ifdef USE_FFTW_MALLOC
     m[0] = (float *) fftwf_malloc((size_t) ((nrows * ncols) * sizeof(float)));
@@ -288,9 +279,7 @@ float **gen_fmatrix(long nrows, long ncols)
     m[0] = (float *) aligned_alloc(ALIGNSIZE, (size_t) ((nrows * ncols) * sizeof(float)));
 #endif
     if (!m[0]) {
-        perror("\nError in 2nd malloc() in gen_fmatrix()");
-        printf("\n");
-        exit(-1);
+        presto_perror(PRESTO_ERR_NOMEM, "2nd malloc() in gen_fmatrix() failed");
     }
     for (i = 1; i < nrows; i++)
         m[i] = m[i - 1] + ncols;
@@ -315,9 +304,7 @@ double **gen_dmatrix(long nrows, long ncols)
     m = (double **) aligned_alloc(ALIGNSIZE, (size_t) (nrows * sizeof(double *)));
 #endif
     if (!m) {
-        perror("\nError in 1st malloc() in gen_dmatrix()");
-        printf("\n");
-        exit(-1);
+        presto_perror(PRESTO_ERR_NOMEM, "1st malloc() in gen_dmatrix() failed");
     }
 #ifdef USE_FFTW_MALLOC
     m[0] = (double *) fftwf_malloc((size_t) ((nrows * ncols) * sizeof(double)));
@@ -325,9 +312,7 @@ double **gen_dmatrix(long nrows, long ncols)
     m[0] = (double *) aligned_alloc(ALIGNSIZE, (size_t) ((nrows * ncols) * sizeof(double)));
 #endif
     if (!m[0]) {
-        perror("\nError in 2nd malloc() in gen_dmatrix()");
-        printf("\n");
-        exit(-1);
+        presto_perror(PRESTO_ERR_NOMEM, "2nd malloc() in gen_dmatrix() failed");
     }
     for (i = 1; i < nrows; i++)
         m[i] = m[i - 1] + ncols;
@@ -354,9 +339,7 @@ fcomplex **gen_cmatrix(long nrows, long ncols)
     m = (fcomplex **) aligned_alloc(ALIGNSIZE, (size_t) (nrows * sizeof(fcomplex *)));
 #endif
     if (!m) {
-        perror("\nError in 1st malloc() in gen_cmatrix()");
-        printf("\n");
-        exit(-1);
+        presto_perror(PRESTO_ERR_NOMEM, "1st malloc() in gen_cmatrix() failed");
     }
     /* allocate rows and set pointers to them */
 
@@ -366,9 +349,7 @@ fcomplex **gen_cmatrix(long nrows, long ncols)
     m[0] = (fcomplex *) aligned_alloc(ALIGNSIZE, (size_t) ((nrows * ncols) * sizeof(fcomplex)));
 #endif
     if (!m[0]) {
-        perror("\nError in 2nd malloc() in gen_cmatrix()");
-        printf("\n");
-        exit(-1);
+        presto_perror(PRESTO_ERR_NOMEM, "2nd malloc() in gen_cmatrix() failed");
     }
     for (i = 1; i < nrows; i++)
         m[i] = m[i - 1] + ncols;
@@ -395,9 +376,7 @@ float ***gen_f3Darr(long nhgts, long nrows, long ncols)
     c = (float ***) aligned_alloc(ALIGNSIZE, (size_t) (nhgts * sizeof(float **)));
 #endif
     if (!c) {
-        perror("\nError in 1st malloc() in gen_f3Darr()");
-        printf("\n");
-        exit(-1);
+        presto_perror(PRESTO_ERR_NOMEM, "1st malloc() in gen_f3Darr() failed");
     }
 #ifdef USE_FFTW_MALLOC
     c[0] = (float **) fftwf_malloc((size_t) ((nhgts * nrows) * sizeof(float *)));
@@ -405,9 +384,7 @@ float ***gen_f3Darr(long nhgts, long nrows, long ncols)
     c[0] = (float **) aligned_alloc(ALIGNSIZE, (size_t) ((nhgts * nrows) * sizeof(float *)));
 #endif
     if (!c[0]) {
-        perror("\nError in 2nd malloc() in gen_f3Darr()");
-        printf("\n");
-        exit(-1);
+        presto_perror(PRESTO_ERR_NOMEM, "2nd malloc() in gen_f3Darr() failed");
     }
 #ifdef USE_FFTW_MALLOC
     c[0][0] = (float *) fftwf_malloc((size_t) ((nhgts * nrows * ncols) * sizeof(float)));
@@ -415,9 +392,7 @@ float ***gen_f3Darr(long nhgts, long nrows, long ncols)
     c[0][0] = (float *) aligned_alloc(ALIGNSIZE, (size_t) ((nhgts * nrows * ncols) * sizeof(float)));
 #endif
     if (!c[0][0]) {
-        perror("\nError in 3rd malloc() in gen_f3Darr()");
-        printf("\n");
-        exit(-1);
+        presto_perror(PRESTO_ERR_NOMEM, "3rd malloc() in gen_f3Darr() failed");
     }
 
     for (j = 1; j < nrows; j++)
@@ -450,9 +425,7 @@ fcomplex ***gen_c3Darr(long nhgts, long nrows, long ncols)
     c = (fcomplex ***) aligned_alloc(ALIGNSIZE, (size_t) (nhgts * sizeof(fcomplex **)));
 #endif
     if (!c) {
-        perror("\nError in 1st malloc() in gen_c3Darr()");
-        printf("\n");
-        exit(-1);
+        presto_perror(PRESTO_ERR_NOMEM, "1st malloc() in gen_c3Darr() failed");
     }
 #ifdef USE_FFTW_MALLOC
     c[0] = (fcomplex **) fftwf_malloc((size_t) ((nhgts * nrows) * sizeof(fcomplex *)));
@@ -460,9 +433,7 @@ fcomplex ***gen_c3Darr(long nhgts, long nrows, long ncols)
     c[0] = (fcomplex **) aligned_alloc(ALIGNSIZE, (size_t) ((nhgts * nrows) * sizeof(fcomplex *)));
 #endif
     if (!c[0]) {
-        perror("\nError in 2nd malloc() in gen_c3Darr()");
-        printf("\n");
-        exit(-1);
+        presto_perror(PRESTO_ERR_NOMEM, "2nd malloc() in gen_c3Darr() failed");
     }
 #ifdef USE_FFTW_MALLOC
     c[0][0] = (fcomplex *) fftwf_malloc((size_t) ((nhgts * nrows * ncols) * sizeof(fcomplex)));
@@ -470,9 +441,7 @@ fcomplex ***gen_c3Darr(long nhgts, long nrows, long ncols)
     c[0][0] = (fcomplex *) aligned_alloc(ALIGNSIZE, (size_t) ((nhgts * nrows * ncols) * sizeof(fcomplex)));
 #endif
     if (!c[0][0]) {
-        perror("\nError in 3rd malloc() in gen_c3Darr()");
-        printf("\n");
-        exit(-1);
+        presto_perror(PRESTO_ERR_NOMEM, "3rd malloc() in gen_c3Darr() failed");
     }
 
     for (j = 1; j < nrows; j++)
@@ -488,8 +457,200 @@ fcomplex ***gen_c3Darr(long nhgts, long nrows, long ncols)
     return c;
 }
 
+/* The large vectors allocated by gen_bigvect() (which need munmap()) */
+#define MAXBIGVECTS 1024
+static struct {
+    void *addr;
+    size_t len;
+} bigvects[MAXBIGVECTS];
+static int numbigvects = 0;
+static int bigvect_hugepages = -1, bigvect_interleave = -1;
+
+void set_bigvect_policy(int hugepages, int interleave)
+{
+    bigvect_hugepages = hugepages;
+    bigvect_interleave = interleave;
+}
+
+
+#ifdef __linux__
+
+static void get_bigvect_policy(void)
+/* Set the default policy from the environment if it hasn't been set */
+{
+    char *env;
+
+    if (bigvect_hugepages < 0) {
+        env = getenv("PRESTO_HUGEPAGES");
+        bigvect_hugepages = (env) ? atoi(env) : 1;
+    }
+    if (bigvect_interleave < 0) {
+        env = getenv("PRESTO_NUMA_INTERLEAVE");
+        bigvect_interleave = (env) ? atoi(env) : 0;
+    }
+}
+
+
+static int numa_nodemask(unsigned long *mask)
+/* Set 'mask' to the online NUMA nodes (up to 64) and return how many */
+{
+    FILE *file;
+    char line[256], *ptr;
+    int lo, hi, ii, numnodes = 0;
+
+    *mask = 0;
+    if ((file = fopen("/sys/devices/system/node/online", "r")) == NULL)
+        return 0;
+    if (fgets(line, sizeof(line), file) != NULL) {
+        ptr = line;
+        while (sscanf(ptr, "%d", &lo) == 1) {
+            hi = lo;
+            while (*ptr >= '0' && *ptr <= '9')
+                ptr++;
+            if (*ptr == '-')
+                hi = (int) strtol(ptr + 1, &ptr, 10);
+            for (ii = lo; ii <= hi && ii < 64; ii++, numnodes++)
+                *mask |= 1UL << ii;
+            if (*ptr != ',')
+                break;
+            ptr++;
+        }
+    }
+    fclose(file);
+    return numnodes;
+}
+
+
+static void *map_bigvect(size_t len)
+/* mmap() 'len' bytes (a multiple of HUGEPAGESIZE) using huge pages */
+/* if possible.  Returns NULL on failure.                            */
+{
+    char *addr = MAP_FAILED, *aligned;
+    size_t head;
+
+#ifdef MAP_HUGETLB
+    /* Explicit huge pages (these must be reserved by the sysadmin) */
+    if (bigvect_hugepages > 1)
+        addr = mmap(NULL, len, PROT_READ | PROT_WRITE,
+                    MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    if (addr != MAP_FAILED)
+        return addr;
+#endif
+    /* Regular pages, aligned to a huge page so that the kernel */
+    /* can use transparent huge pages for all of it.            */
+    addr = mmap(NULL, len + HUGEPAGESIZE, PROT_READ | PROT_WRITE,
+                MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (addr == MAP_FAILED)
+        return NULL;
+    head = (HUGEPAGESIZE - ((size_t) addr % HUGEPAGESIZE)) % HUGEPAGESIZE;
+    aligned = addr + head;
+    if (head)
+        munmap(addr, head);
+    munmap(aligned + len, HUGEPAGESIZE - head);
+#ifdef MADV_HUGEPAGE
+    if (bigvect_hugepages > 0)
+        madvise(aligned, len, MADV_HUGEPAGE);
+#endif
+    return aligned;
+}
+
+#endif
+
+
+void *gen_bigvect(size_t nbytes)
+{
+#ifdef __linux__
+    char *v;
+    size_t len;
+    long ii, numpages;
+    int stored = 0;
+
+    get_bigvect_policy();
+    if (nbytes < BIGVECT_MINBYTES) {
+        v = (char *) gen_bvect(nbytes);
+        memset(v, 0, nbytes);
+        return (void *) v;
+    }
+    len = ((nbytes + HUGEPAGESIZE - 1) / HUGEPAGESIZE) * HUGEPAGESIZE;
+    if ((v = map_bigvect(len)) == NULL)
+        presto_perror(PRESTO_ERR_NOMEM, "mmap() in gen_bigvect() failed");
+
+    if (bigvect_interleave) {
+        /* Spread the pages round-robin over all of the NUMA nodes */
+        unsigned long mask;
+        if (numa_nodemask(&mask) > 1)
+            syscall(SYS_mbind, v, len, 3 /* MPOL_INTERLEAVE */ , &mask, 65, 0);
+    } else {
+        /* Touch the pages from the threads that will (most likely) */
+        /* use them, in the same order as an OpenMP static schedule */
+        /* over the vector.  The pages are then on their NUMA nodes. */
+        numpages = len / HUGEPAGESIZE;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) default(none) shared(v,numpages)
+#endif
+        for (ii = 0; ii < numpages; ii++)
+            memset(v + ii * HUGEPAGESIZE, 0, HUGEPAGESIZE);
+    }
+
+#ifdef _OPENMP
+#pragma omp critical (bigvects)
+#endif
+    if (numbigvects < MAXBIGVECTS) {
+        bigvects[numbigvects].addr = v;
+        bigvects[numbigvects].len = len;
+        numbigvects++;
+        stored = 1;
+    }
+    if (!stored) {
+        /* Too many of them to track, use a normal allocation */
+        munmap(v, len);
+        v = (char *) gen_bvect(nbytes);
+        memset(v, 0, nbytes);
+    }
+    return (void *) v;
+#else
+    unsigned char *v = gen_bvect(nbytes);
+    memset(v, 0, nbytes);
+    return (void *) v;
+#endif
+}
+
+
+float *gen_big_fvect(long length)
+{
+    return (float *) gen_bigvect(sizeof(float) * (size_t) length);
+}
+
+
+fcomplex *gen_big_cvect(long length)
+{
+    return (fcomplex *) gen_bigvect(sizeof(fcomplex) * (size_t) length);
+}
+
+
 void vect_free(void *vect)
 {
+#ifdef __linux__
+    if (numbigvects) {
+        int ii, found = 0;
+        size_t len = 0;
+#ifdef _OPENMP
+#pragma omp critical (bigvects)
+#endif
+        for (ii = 0; ii < numbigvects; ii++) {
+            if (bigvects[ii].addr == vect) {
+                len = bigvects[ii].len;
+                bigvects[ii] = bigvects[--numbigvects];
+                found = 1;
+                break;
+            }
+        }
+        if (found) {
+            munmap(vect, len);
+            return;
+        }
+    }
+#endif
 #ifdef USE_FFTW_MALLOC
     fftwf_free(vect);
 #else
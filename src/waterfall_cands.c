@@ -0,0 +1,971 @@
+#include <limits.h>
+#include <ctype.h>
+#include "presto.h"
+#include "waterfall_cands_cmd.h"
+#include "mask.h"
+#include "backend_common.h"
+
+// Use OpenMP
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#ifdef USEDMALLOC
+#include "dmalloc.h"
+#endif
+
+/*
+ * A compiled version of bin/make_spd.py.  For each single-pulse
+ * candidate the raw data around the pulse are masked, subbanded,
+ * de-dispersed (or left swept), downsampled and scaled exactly as
+ * waterfaller.py does, and the four waterfalls are written to a
+ * '.spd' file that the python single pulse tools (read_spd.py and
+ * plot_spd.py) can read.  The candidates are sorted by their start
+ * times so that the raw data are read in a single forward pass, and
+ * the candidates sharing a read are waterfalled in parallel.
+ */
+
+#define RAWDATA (cmd->filterbankP || cmd->psrfitsP)
+
+/* Dispersion constant used by the python single pulse tools */
+#define DMCONST 4.15e3
+
+/* Maximum number of raw data floats to hold for a batch of candidates */
+#define MAXBATCHFLOATS (1L << 28)
+
+/* Number of strings in the .spd 'text_array' */
+#define NUMSPDTEXT 26
+
+typedef struct SPDCAND {
+    double dm;                  /* DM from the .singlepulse file */
+    double sigma;               /* Sigma from the .singlepulse file */
+    double time;                /* Topocentric time of the pulse (s) */
+    long long sample;           /* Sample number in the de-dispersed data */
+    int downfact;               /* Boxcar width in (downsampled) samples */
+    int downsamp;               /* Downsampling of the de-dispersed data */
+    int nsub;                   /* Number of subbands for the waterfalls */
+    double duration;            /* Length of the de-dispersed window (s) */
+    double pulse_width;         /* Width of the pulse (s) */
+    double sweep_duration;      /* Dispersive delay across the band (s) */
+    long long dd_startbin;      /* First raw spectra of the de-dispersed window */
+    long long dd_nbins;         /* Number of raw spectra in the plotted window */
+    long long dd_nbinsextra;    /* Number of raw spectra needed to de-disperse */
+    long long sw_startbin;      /* First raw spectra of the swept window */
+    long long sw_nbins;         /* Number of raw spectra in the swept window */
+    long long lobin;            /* First raw spectra covering both windows */
+    long long numbins;          /* Number of raw spectra covering both windows */
+    float *rawdata;             /* The raw spectra (numbins x num_channels) */
+} spdcand;
+
+typedef struct NPYARRAY {
+    char name[40];              /* Name of the array in the .npz file */
+    char descr[16];             /* Numpy dtype descriptor (i.e. '<f2') */
+    int ndim;                   /* Number of dimensions (1 or 2) */
+    long shape[2];              /* Length of each dimension */
+    void *data;                 /* The raw array data */
+    long nbytes;                /* Number of bytes in data */
+} npyarray;
+
+static int read_singlepulse_cands(char *filenm, spdcand ** cands);
+static int compare_cands_sigma(const void *ca, const void *cb);
+static int compare_cands_lobin(const void *ca, const void *cb);
+static int default_numsub(int numchan, double sigma);
+static int setup_cand(spdcand * cand, struct spectra_info *s);
+static void read_window(spdcand * cand, struct spectra_info *s,
+                        mask * obsmask, int *maskchans);
+static unsigned short *make_waterfall(spdcand * cand, struct spectra_info *s,
+                                      int dedisp, int zerodm, long *numcols,
+                                      long *numspectra, double *subfreqs);
+static void write_spd(spdcand * cand, struct spectra_info *s, char *outroot);
+static void write_npz(char *filenm, npyarray * arrays, int numarrays);
+static unsigned short float_to_half(float f);
+static void make_crc_table(void);
+
+/* From CLIG */
+static Cmdline *cmd;
+
+/* For the ZIP file CRCs */
+static unsigned int crc_table[256];
+
+int main(int argc, char *argv[])
+{
+    int ii, jj, numcands, numgood = 0, numdone = 0, numbatch = 0;
+    int *maskchans = NULL, maxbatch = 1;
+    long long batchfloats;
+    char *outroot;
+    spdcand *cands;
+    struct spectra_info s;
+    infodata idata;
+    mask obsmask;
+
+    /* Call usage() if we have no command line arguments */
+
+    if (argc == 1) {
+        Program = argv[0];
+        printf("\n");
+        usage();
+        exit(0);
+    }
+
+    /* Parse the command line using the excellent program Clig */
+
+    cmd = parseCmdline(argc, argv);
+    spectra_info_set_defaults(&s);
+    s.filenames = cmd->argv;
+    s.num_files = cmd->argc;
+    // The waterfalls are neither clipped nor zero-DMed by the readers
+    s.clip_sigma = 0.0;
+    s.remove_zerodm = 0;
+    // -1 causes the data to determine if we use weights, scales, &
+    // offsets for PSRFITS or flip the band for any data type where
+    // we can figure that out with the data
+    s.apply_flipband = (cmd->invertP) ? 1 : -1;
+    s.apply_weight = (cmd->noweightsP) ? 0 : -1;
+    s.apply_scale = (cmd->noscalesP) ? 0 : -1;
+    s.apply_offset = (cmd->nooffsetsP) ? 0 : -1;
+
+    if (cmd->ncpus > 1) {
+#ifdef _OPENMP
+        int maxcpus = omp_get_num_procs();
+        int openmp_numthreads = (cmd->ncpus <= maxcpus) ? cmd->ncpus : maxcpus;
+        // Make sure we are not dynamically setting the number of threads
+        omp_set_dynamic(0);
+        omp_set_num_threads(openmp_numthreads);
+        maxbatch = 2 * openmp_numthreads;
+        printf("Using %d threads with OpenMP\n\n", openmp_numthreads);
+#endif
+    } else {
+#ifdef _OPENMP
+        omp_set_num_threads(1); // Explicitly turn off OpenMP
+#endif
+    }
+
+#ifdef DEBUG
+    showOptionValues();
+#endif
+
+    printf("\n\n");
+    printf("       Single Pulse Candidate Waterfall Routine\n");
+    printf("             (a compiled make_spd.py)\n\n");
+
+    if (RAWDATA) {
+        if (cmd->filterbankP)
+            s.datatype = SIGPROCFB;
+        else if (cmd->psrfitsP)
+            s.datatype = PSRFITS;
+    } else {                    // Attempt to auto-identify the data
+        identify_psrdatatype(&s, 1);
+        if (s.datatype == SIGPROCFB)
+            cmd->filterbankP = 1;
+        else if (s.datatype == PSRFITS)
+            cmd->psrfitsP = 1;
+        else {
+            printf
+                ("Error:  Unable to identify input raw data files.  Please specify type.\n\n");
+            exit(1);
+        }
+    }
+
+    {
+        char description[40];
+        psrdatatype_description(description, s.datatype);
+        if (s.num_files > 1)
+            printf("Reading %s data from %d files:\n", description, s.num_files);
+        else
+            printf("Reading %s data from 1 file:\n", description);
+        for (ii = 0; ii < s.num_files; ii++)
+            printf("  '%s'\n", cmd->argv[ii]);
+        printf("\n");
+    }
+    read_rawdata_files(&s);
+    print_spectra_info_summary(&s);
+    spectra_info_to_inf(&s, &idata);
+
+    /* Read an input mask if wanted */
+    if (cmd->maskfileP) {
+        read_mask(cmd->maskfile, &obsmask);
+        printf("Read mask information from '%s'\n\n", cmd->maskfile);
+        if ((obsmask.numchan != idata.num_chan) ||
+            (fabs(obsmask.mjd - (idata.mjd_i + idata.mjd_f)) > 1e-9)) {
+            printf("WARNING!: maskfile has different number of channels or start MJD than raw data! Exiting.\n\n");
+            exit(1);
+        }
+        determine_padvals(cmd->maskfile, &obsmask, s.padvals);
+        maskchans = gen_ivect(s.num_channels);
+    } else {
+        obsmask.numchan = obsmask.numint = 0;
+    }
+
+    if (cmd->nsubP && (s.num_channels % cmd->nsub)) {
+        printf("Error:  The number of subbands (-nsub %d) must divide into the\n"
+               "        number of channels (%d)\n\n", cmd->nsub, s.num_channels);
+        exit(1);
+    }
+
+    /* The root of the output file names */
+    if (cmd->outfileP) {
+        outroot = cmd->outfile;
+    } else {
+        char *suffix;
+        if (split_root_suffix(s.filenames[0], &outroot, &suffix))
+            free(suffix);
+    }
+
+    /* Read the candidates and set up their windows */
+    numcands = read_singlepulse_cands(cmd->candfile, &cands);
+    printf("Read %d candidates from '%s'.\n", numcands, cmd->candfile);
+    qsort(cands, numcands, sizeof(spdcand), compare_cands_sigma);
+    for (ii = 0; ii < numcands; ii++) {
+        if (cands[ii].sigma < cmd->minsigma)
+            break;
+        if (cmd->numcandsP && numgood >= cmd->numcands)
+            break;
+        if (setup_cand(cands + ii, &s))
+            cands[numgood++] = cands[ii];
+        else
+            printf("  Skipping the candidate at %.6f s (DM = %.2f):  outside of the data.\n",
+                   cands[ii].time, cands[ii].dm);
+    }
+    if (numgood == 0) {
+        printf("\nNo candidates to waterfall.  Exiting.\n\n");
+        exit(0);
+    }
+    printf("Waterfalling %d candidates.\n\n", numgood);
+
+    /* Sort by the start of the raw data needed so we read forward */
+    qsort(cands, numgood, sizeof(spdcand), compare_cands_lobin);
+    make_crc_table();
+
+    ii = 0;
+    while (ii < numgood) {
+        /* Read the raw data for a batch of candidates */
+        numbatch = 0;
+        batchfloats = 0;
+        while (ii + numbatch < numgood && numbatch < maxbatch) {
+            spdcand *cand = cands + ii + numbatch;
+            long long numfloats = cand->numbins * s.num_channels;
+            if (numbatch && batchfloats + numfloats > MAXBATCHFLOATS)
+                break;
+            cand->rawdata = gen_fvect(numfloats);
+            read_window(cand, &s, &obsmask, maskchans);
+            batchfloats += numfloats;
+            numbatch++;
+        }
+
+        /* Waterfall and write the batch in parallel */
+#ifdef _OPENMP
+#pragma omp parallel for default(none) private(jj) shared(cands,ii,numbatch,s,outroot) schedule(dynamic)
+#endif
+        for (jj = 0; jj < numbatch; jj++) {
+            write_spd(cands + ii + jj, &s, outroot);
+            vect_free(cands[ii + jj].rawdata);
+            cands[ii + jj].rawdata = NULL;
+        }
+        ii += numbatch;
+        numdone += numbatch;
+        printf("\rAmount complete = %3d%%", (int) (100.0 * numdone / numgood));
+        fflush(stdout);
+    }
+    printf("\n\nWrote %d '.spd' files.\n\n", numdone);
+
+    /* Cleanup */
+    if (cmd->maskfileP) {
+        free_mask(obsmask);
+        vect_free(maskchans);
+    }
+    close_rawfiles(&s);
+    free(cands);
+    return (0);
+}
+
+
+static int read_singlepulse_cands(char *filenm, spdcand ** cands)
+/* Read the candidates from a '.singlepulse' format file.  The   */
+/* number of candidates read is returned and the candidates are  */
+/* returned in a malloc'd array.                                 */
+{
+    FILE *infile;
+    char line[200], *sptr;
+    int numcands = 0, maxcands = 1000;
+    spdcand *cs;
+
+    infile = chkfopen(filenm, "r");
+    cs = (spdcand *) malloc(maxcands * sizeof(spdcand));
+    while (fgets(line, 200, infile)) {
+        sptr = line;
+        while (isspace(*sptr))
+            sptr++;
+        if (*sptr == '#' || *sptr == '\0')
+            continue;
+        if (numcands == maxcands) {
+            maxcands *= 2;
+            cs = (spdcand *) realloc(cs, maxcands * sizeof(spdcand));
+        }
+        memset(cs + numcands, 0, sizeof(spdcand));
+        if (sscanf(sptr, "%lf %lf %lf %lld %d", &cs[numcands].dm,
+                   &cs[numcands].sigma, &cs[numcands].time,
+                   &cs[numcands].sample, &cs[numcands].downfact) != 5) {
+            fprintf(stderr, "Error:  Could not parse the candidate line:\n  %s\n",
+                    line);
+            exit(1);
+        }
+        numcands++;
+    }
+    fclose(infile);
+    *cands = cs;
+    return numcands;
+}
+
+
+static int compare_cands_sigma(const void *ca, const void *cb)
+/* Sort candidates by decreasing sigma */
+{
+    const spdcand *a = (const spdcand *) ca, *b = (const spdcand *) cb;
+    if (b->sigma > a->sigma)
+        return 1;
+    if (b->sigma < a->sigma)
+        return -1;
+    return 0;
+}
+
+
+static int compare_cands_lobin(const void *ca, const void *cb)
+/* Sort candidates by increasing start of the raw data needed */
+{
+    const spdcand *a = (const spdcand *) ca, *b = (const spdcand *) cb;
+    if (a->lobin < b->lobin)
+        return -1;
+    if (a->lobin > b->lobin)
+        return 1;
+    return 0;
+}
+
+
+static int default_numsub(int numchan, double sigma)
+/* The number of subbands that make_spd.py uses for a candidate */
+{
+    if (numchan == 960) {       // PALFA
+        if (sigma < 10.0)
+            return 32;
+        else if (sigma < 15.0)
+            return 64;
+        return 96;
+    } else if ((numchan & (numchan - 1)) == 0) {
+        if (sigma < 10.0)
+            return 32;
+        else if (sigma < 15.0)
+            return 64;
+        return 128;
+    }
+    return numchan;
+}
+
+
+static int setup_cand(spdcand * cand, struct spectra_info *s)
+/* Determine the raw data windows for the de-dispersed and the swept */
+/* waterfalls of a candidate in the same way as spcand.py and        */
+/* waterfaller.py.  Returns 0 if the candidate is not in the data.   */
+{
+    double dt = s->dt, start, dmfac, topctrfreq, loedge;
+    long long hibin;
+
+    cand->downsamp = 1;
+    if (cand->sample > 0)
+        cand->downsamp = (int) rint(cand->time / cand->sample / dt);
+    if (cand->downsamp < 1)
+        cand->downsamp = 1;
+    if (cand->downfact < 1)
+        cand->downfact = 1;
+    cand->nsub = (cmd->nsubP) ? cmd->nsub : default_numsub(s->num_channels,
+                                                           cand->sigma);
+    if (s->num_channels % cand->nsub)
+        cand->nsub = s->num_channels;
+    cand->duration = cmd->binratio * cand->downfact * dt * cand->downsamp;
+    cand->pulse_width = cand->downfact * cand->downsamp * dt;
+    dmfac = DMCONST * fabs(1.0 / (s->lo_freq * s->lo_freq) -
+                           1.0 / (s->hi_freq * s->hi_freq));
+    start = cand->time - cmd->loc * cand->duration;
+    if (start < 0.0)
+        start = 0.0;
+
+    /* The de-dispersed window (referenced to the top subband) */
+    loedge = start;
+    cand->dd_nbins = (long long) rint(cand->duration / dt);
+    cand->dd_nbinsextra = cand->dd_nbins;
+    if (cand->dm > 0.0) {
+        topctrfreq = s->hi_freq -
+            0.5 * (s->num_channels / cand->nsub) * fabs(s->df);
+        loedge += DMCONST * fabs(1.0 / (s->hi_freq * s->hi_freq) -
+                                 1.0 / (topctrfreq * topctrfreq)) * cand->dm;
+        cand->dd_nbinsextra = (long long) rint((cand->duration +
+                                                dmfac * cand->dm) / dt);
+    }
+    cand->dd_startbin = (long long) rint(loedge / dt);
+    if (cand->dd_startbin + cand->dd_nbinsextra > s->N - 1)
+        cand->dd_nbinsextra = s->N - 1 - cand->dd_startbin;
+
+    /* The swept window (starting at the pulse) */
+    cand->sweep_duration = dmfac * cand->dm;
+    cand->sw_startbin = (long long) rint((start + cmd->loc * cand->duration) / dt);
+    cand->sw_nbins = (long long) rint(cand->sweep_duration / dt);
+    if (cand->sw_nbins < cand->downsamp)
+        cand->sw_nbins = cand->downsamp;
+    if (cand->sw_startbin + cand->sw_nbins > s->N - 1)
+        cand->sw_nbins = s->N - 1 - cand->sw_startbin;
+
+    if (cand->dd_nbinsextra < cand->downsamp || cand->sw_nbins < cand->downsamp)
+        return 0;
+
+    cand->lobin = (cand->dd_startbin < cand->sw_startbin) ?
+        cand->dd_startbin : cand->sw_startbin;
+    hibin = cand->dd_startbin + cand->dd_nbinsextra;
+    if (cand->sw_startbin + cand->sw_nbins > hibin)
+        hibin = cand->sw_startbin + cand->sw_nbins;
+    cand->numbins = hibin - cand->lobin;
+    return 1;
+}
+
+
+static void read_window(spdcand * cand, struct spectra_info *s,
+                        mask * obsmask, int *maskchans)
+/* Copy the masked raw spectra needed by 'cand' into cand->rawdata.   */
+/* The raw data are kept in a buffer of full subints so that          */
+/* overlapping windows of time-sorted candidates are only read once,  */
+/* and the files are only re-positioned when the candidates skip      */
+/* over some of the data.                                             */
+{
+    static float *rawbuf = NULL;
+    static long long firstsub = 0, numsubs = 0, maxsubs = 0, nextsub = -1;
+    long long losub, hisub, needsubs, numvals, ii;
+    int padding, nummasked, jj;
+
+    numvals = (long long) s->spectra_per_subint * s->num_channels;
+    losub = cand->lobin / s->spectra_per_subint;
+    hisub = (cand->lobin + cand->numbins - 1) / s->spectra_per_subint + 1;
+    needsubs = hisub - losub;
+
+    /* Drop the subints that we no longer need */
+    if (losub >= firstsub && losub < firstsub + numsubs && needsubs <= maxsubs) {
+        long long numdrop = losub - firstsub;
+        if (numdrop) {
+            memmove(rawbuf, rawbuf + numdrop * numvals,
+                    (numsubs - numdrop) * numvals * sizeof(float));
+            numsubs -= numdrop;
+            firstsub = losub;
+        }
+    } else {
+        firstsub = losub;
+        numsubs = 0;
+    }
+    if (needsubs > maxsubs) {
+        if (rawbuf)
+            vect_free(rawbuf);
+        maxsubs = needsubs;
+        rawbuf = gen_fvect(maxsubs * numvals);
+    }
+
+    /* Read and mask the new subints */
+    if (numsubs < needsubs) {
+        long long sub = firstsub + numsubs;
+        if (sub != nextsub)
+            offset_to_spectra(sub * s->spectra_per_subint, s);
+        nextsub = sub + read_rawblocks(rawbuf + numsubs * numvals,
+                                       needsubs - numsubs, s, &padding);
+        if (obsmask->numchan) {
+            for (ii = numsubs; ii < needsubs; ii++) {
+                float *spectra = rawbuf + ii * numvals;
+                long long kk;
+                nummasked = check_mask((firstsub + ii) * s->time_per_subint,
+                                       s->time_per_subint, obsmask, maskchans);
+                if (nummasked == -1) {
+                    for (kk = 0; kk < s->spectra_per_subint; kk++)
+                        memcpy(spectra + kk * s->num_channels, s->padvals,
+                               s->num_channels * sizeof(float));
+                } else if (nummasked > 0) {
+                    for (kk = 0; kk < s->spectra_per_subint; kk++)
+                        for (jj = 0; jj < nummasked; jj++)
+                            spectra[kk * s->num_channels + maskchans[jj]] =
+                                s->padvals[maskchans[jj]];
+                }
+            }
+        }
+        numsubs = needsubs;
+    }
+
+    memcpy(cand->rawdata,
+           rawbuf + (cand->lobin - firstsub * s->spectra_per_subint) * s->num_channels,
+           cand->numbins * s->num_channels * sizeof(float));
+}
+
+
+static void shift_and_pad(float *chan, long numpts, long bins)
+/* Rotate 'chan' to the left by 'bins' (like psr_utils.rotate()) */
+/* and replace the wrapped-around values with the channel mean   */
+/* (i.e. Spectra.shift_channels() with padval='mean').           */
+{
+    long ii;
+    double mean = 0.0;
+
+    if (bins == 0)
+        return;
+    for (ii = 0; ii < numpts; ii++)
+        mean += chan[ii];
+    mean /= numpts;
+    if (labs(bins) >= numpts) {
+        for (ii = 0; ii < numpts; ii++)
+            chan[ii] = mean;
+    } else if (bins > 0) {
+        memmove(chan, chan + bins, (numpts - bins) * sizeof(float));
+        for (ii = numpts - bins; ii < numpts; ii++)
+            chan[ii] = mean;
+    } else {
+        memmove(chan - bins, chan, (numpts + bins) * sizeof(float));
+        for (ii = 0; ii < -bins; ii++)
+            chan[ii] = mean;
+    }
+}
+
+
+static unsigned short *make_waterfall(spdcand * cand, struct spectra_info *s,
+                                      int dedisp, int zerodm, long *numcols,
+                                      long *numspectra, double *subfreqs)
+/* Make a waterfall for 'cand' in the same way as waterfaller.py.    */
+/* If 'dedisp' is true, the de-dispersed window is used, otherwise   */
+/* the swept window is used.  If 'zerodm' is true, the mean of each  */
+/* spectra is removed first.  The float16 waterfall (cand->nsub rows */
+/* with the lowest frequency first) is returned and has 'numcols'    */
+/* columns.  'numspectra' is the number of downsampled spectra       */
+/* before the window was trimmed and 'subfreqs' (length cand->nsub)  */
+/* returns the subband center frequencies.                           */
+{
+    int ii, jj, chanpersub = s->num_channels / cand->nsub;
+    long numpts, numout, kk, width = cand->downfact;
+    long long startbin;
+    float *chandata, *subdata, *outdata, *tmp;
+    double maxfreq, refdelay, std = 1.0;
+    unsigned short *result;
+
+    startbin = (dedisp) ? cand->dd_startbin : cand->sw_startbin;
+    numpts = (dedisp) ? cand->dd_nbinsextra : cand->sw_nbins;
+
+    /* Transpose into channels (lowest frequency first) */
+    chandata = gen_fvect((long) s->num_channels * numpts);
+    for (kk = 0; kk < numpts; kk++) {
+        float *spectra = cand->rawdata +
+            (startbin - cand->lobin + kk) * s->num_channels;
+        for (ii = 0; ii < s->num_channels; ii++)
+            chandata[ii * numpts + kk] = spectra[ii];
+    }
+
+    /* Zero-DM filtering */
+    if (zerodm) {
+        for (kk = 0; kk < numpts; kk++) {
+            double mean = 0.0;
+            for (ii = 0; ii < s->num_channels; ii++)
+                mean += chandata[ii * numpts + kk];
+            mean /= s->num_channels;
+            for (ii = 0; ii < s->num_channels; ii++)
+                chandata[ii * numpts + kk] -= mean;
+        }
+    }
+
+    /* Subband at the candidate DM */
+    subdata = gen_fvect((long) cand->nsub * numpts);
+    for (ii = 0; ii < cand->nsub; ii++) {
+        double lofreq = s->lo_freq + ii * chanpersub * s->df;
+        double hifreq = lofreq + (chanpersub - 1) * s->df;
+        float *sub = subdata + ii * numpts;
+        subfreqs[ii] = 0.5 * (lofreq + hifreq);
+        refdelay = delay_from_dm(cand->dm, subfreqs[ii]);
+        for (kk = 0; kk < numpts; kk++)
+            sub[kk] = 0.0;
+        for (jj = 0; jj < chanpersub; jj++) {
+            int chan = ii * chanpersub + jj;
+            float *chanptr = chandata + (long) chan * numpts;
+            double freq = s->lo_freq + chan * s->df;
+            shift_and_pad(chanptr, numpts,
+                          (long) rint((delay_from_dm(cand->dm, freq) -
+                                       refdelay) / s->dt));
+            for (kk = 0; kk < numpts; kk++)
+                sub[kk] += chanptr[kk];
+        }
+    }
+    vect_free(chandata);
+
+    /* De-disperse the subbands to the highest subband frequency */
+    if (dedisp && cand->dm > 0.0) {
+        maxfreq = subfreqs[0];
+        for (ii = 1; ii < cand->nsub; ii++)
+            if (subfreqs[ii] > maxfreq)
+                maxfreq = subfreqs[ii];
+        refdelay = delay_from_dm(cand->dm, maxfreq);
+        for (ii = 0; ii < cand->nsub; ii++)
+            shift_and_pad(subdata + ii * numpts, numpts,
+                          (long) rint((delay_from_dm(cand->dm, subfreqs[ii]) -
+                                       refdelay) / s->dt));
+    }
+
+    /* Downsample (summing and trimming the end) */
+    numout = numpts / cand->downsamp;
+    outdata = gen_fvect((long) cand->nsub * numout);
+    for (ii = 0; ii < cand->nsub; ii++) {
+        float *sub = subdata + ii * numpts, *out = outdata + ii * numout;
+        for (kk = 0; kk < numout; kk++) {
+            double sum = 0.0;
+            for (jj = 0; jj < cand->downsamp; jj++)
+                sum += sub[kk * cand->downsamp + jj];
+            out[kk] = sum;
+        }
+    }
+    vect_free(subdata);
+    *numspectra = numout;
+
+    /* Scale each subband (median subtracted, divided by the std dev) */
+    tmp = gen_fvect(numout + 2 * width);
+    if (!cmd->scaleindepP) {
+        double avg = 0.0, var = 0.0;
+        long numvals = (long) cand->nsub * numout;
+        for (kk = 0; kk < numvals; kk++)
+            avg += outdata[kk];
+        avg /= numvals;
+        for (kk = 0; kk < numvals; kk++)
+            var += (outdata[kk] - avg) * (outdata[kk] - avg);
+        std = sqrt(var / numvals);
+    }
+    for (ii = 0; ii < cand->nsub; ii++) {
+        float *out = outdata + ii * numout, med;
+        med = median_nocopy(out, numout);
+        if (cmd->scaleindepP) {
+            double avg = 0.0, var = 0.0;
+            for (kk = 0; kk < numout; kk++)
+                avg += out[kk];
+            avg /= numout;
+            for (kk = 0; kk < numout; kk++)
+                var += (out[kk] - avg) * (out[kk] - avg);
+            std = sqrt(var / numout);
+        }
+        if (std == 0.0)
+            std = 1.0;
+        for (kk = 0; kk < numout; kk++)
+            out[kk] = (out[kk] - med) / std;
+    }
+
+    /* Smooth with a boxcar of the pulse width (padded with the mean) */
+    if (width > 1) {
+        double norm = 1.0 / sqrt((double) width);
+        for (ii = 0; ii < cand->nsub; ii++) {
+            float *out = outdata + ii * numout;
+            double mean = 0.0;
+            for (kk = 0; kk < numout; kk++)
+                mean += out[kk];
+            mean /= numout;
+            for (kk = 0; kk < width; kk++) {
+                tmp[kk] = mean;
+                tmp[numout + width + kk] = mean;
+            }
+            memcpy(tmp + width, out, numout * sizeof(float));
+            for (kk = 0; kk < numout; kk++) {
+                double sum = 0.0;
+                long ll, lo = kk + width - width / 2;
+                for (ll = lo; ll < lo + width; ll++)
+                    sum += tmp[ll];
+                out[kk] = sum * norm;
+            }
+        }
+    }
+    vect_free(tmp);
+
+    /* Trim off the extra bins needed for the de-dispersion */
+    *numcols = numout;
+    if (dedisp) {
+        long nbinlim = (long) (numout * ((double) cand->dd_nbins /
+                                         cand->dd_nbinsextra));
+        if (nbinlim < numout)
+            *numcols = nbinlim;
+    }
+    result = (unsigned short *) malloc(sizeof(unsigned short) *
+                                       cand->nsub * (*numcols > 0 ? *numcols : 1));
+    for (ii = 0; ii < cand->nsub; ii++)
+        for (kk = 0; kk < *numcols; kk++)
+            result[ii * *numcols + kk] = float_to_half(outdata[ii * numout + kk]);
+    vect_free(outdata);
+    return result;
+}
+
+
+static void write_spd(spdcand * cand, struct spectra_info *s, char *outroot)
+/* Make the four waterfalls for a candidate and write its '.spd' file */
+{
+    int ii, textlen = 0;
+    long cols[4], numspectra[4];
+    unsigned short *waterfalls[4];
+    double *subfreqs, *freqs, *delays, mindelay;
+    char text[NUMSPDTEXT][100], *filenm;
+    unsigned int *textarray;
+    npyarray arrays[7];
+    static const char *names[4] = { "Data_dedisp_nozerodm", "Data_dedisp_zerodm",
+        "Data_nozerodm", "Data_zerodm"
+    };
+
+    subfreqs = gen_dvect(cand->nsub);
+    for (ii = 0; ii < 4; ii++)
+        waterfalls[ii] = make_waterfall(cand, s, ii < 2, ii % 2, cols + ii,
+                                        numspectra + ii, subfreqs);
+
+    /* The sweep (highest frequency first as in the python) */
+    freqs = gen_dvect(cand->nsub);
+    delays = gen_dvect(cand->nsub);
+    mindelay = delay_from_dm(cand->dm, subfreqs[cand->nsub - 1]);
+    for (ii = 0; ii < cand->nsub; ii++) {
+        freqs[ii] = subfreqs[cand->nsub - 1 - ii];
+        delays[ii] = delay_from_dm(cand->dm, freqs[ii]) - mindelay;
+    }
+
+    /* The header information (see read_spd.py) */
+    snprintf(text[0], 100, "%s", s->filenames[0]);
+    snprintf(text[1], 100, "%s", s->telescope);
+    snprintf(text[2], 100, "%s", s->ra_str);
+    snprintf(text[3], 100, "%s", s->dec_str);
+    snprintf(text[4], 100, "%.15Lg", s->start_MJD[0]);
+    text[5][0] = '\0';          // No rank for these candidates
+    snprintf(text[6], 100, "%d", cand->nsub);
+    snprintf(text[7], 100, "%lld", cand->dd_nbins);
+    snprintf(text[8], 100, "%.12g", cand->dm);
+    snprintf(text[9], 100, "%.12g", cand->sigma);
+    snprintf(text[10], 100, "%lld", cand->sample);
+    snprintf(text[11], 100, "%.12g", cand->duration);
+    snprintf(text[12], 100, "%d", cand->downfact);
+    snprintf(text[13], 100, "%.12g", cand->pulse_width);
+    snprintf(text[14], 100, "%.12g", s->dt);
+    snprintf(text[15], 100, "%.12g", s->T);
+    snprintf(text[16], 100, "%.12g", cand->time);
+    snprintf(text[17], 100, "%.12g", cand->dd_startbin * s->dt);
+    snprintf(text[18], 100, "%.12g", s->dt * cand->downsamp);
+    snprintf(text[19], 100, "%ld", numspectra[0]);
+    snprintf(text[20], 100, "%.12g", subfreqs[0]);
+    snprintf(text[21], 100, "%.12g", subfreqs[cand->nsub - 1]);
+    snprintf(text[22], 100, "%.12g", cand->sweep_duration);
+    snprintf(text[23], 100, "%.12g", cand->sw_startbin * s->dt);
+    // We have no barycentric times, so use the topocentric time
+    snprintf(text[24], 100, "%.12g", cand->time);
+    // Like make_spd_from_man_params(), there are no rank group arrays
+    snprintf(text[25], 100, "True");
+    for (ii = 0; ii < NUMSPDTEXT; ii++)
+        if (strlen(text[ii]) > textlen)
+            textlen = strlen(text[ii]);
+    if (textlen == 0)
+        textlen = 1;
+    /* Numpy unicode strings are fixed-length UTF-32 */
+    textarray = (unsigned int *) calloc(NUMSPDTEXT * textlen, sizeof(unsigned int));
+    for (ii = 0; ii < NUMSPDTEXT; ii++) {
+        int jj;
+        for (jj = 0; text[ii][jj]; jj++)
+            textarray[ii * textlen + jj] = (unsigned char) text[ii][jj];
+    }
+
+    for (ii = 0; ii < 4; ii++) {
+        strcpy(arrays[ii].name, names[ii]);
+        strcpy(arrays[ii].descr, "<f2");
+        arrays[ii].ndim = 2;
+        arrays[ii].shape[0] = cand->nsub;
+        arrays[ii].shape[1] = cols[ii];
+        arrays[ii].data = waterfalls[ii];
+        arrays[ii].nbytes = sizeof(unsigned short) * cand->nsub * cols[ii];
+    }
+    strcpy(arrays[4].name, "delays_nozerodm");
+    strcpy(arrays[5].name, "freqs_nozerodm");
+    for (ii = 4; ii < 6; ii++) {
+        strcpy(arrays[ii].descr, "<f8");
+        arrays[ii].ndim = 1;
+        arrays[ii].shape[0] = cand->nsub;
+        arrays[ii].nbytes = sizeof(double) * cand->nsub;
+    }
+    arrays[4].data = delays;
+    arrays[5].data = freqs;
+    strcpy(arrays[6].name, "text_array");
+    sprintf(arrays[6].descr, "<U%d", textlen);
+    arrays[6].ndim = 1;
+    arrays[6].shape[0] = NUMSPDTEXT;
+    arrays[6].data = textarray;
+    arrays[6].nbytes = sizeof(unsigned int) * NUMSPDTEXT * textlen;
+
+    filenm = (char *) calloc(strlen(outroot) + 60, 1);
+    sprintf(filenm, "%s_DM%.1f_%.1fs.spd", outroot, cand->dm, cand->time);
+    write_npz(filenm, arrays, 7);
+
+    free(filenm);
+    free(textarray);
+    for (ii = 0; ii < 4; ii++)
+        free(waterfalls[ii]);
+    vect_free(subfreqs);
+    vect_free(freqs);
+    vect_free(delays);
+}
+
+
+static void make_crc_table(void)
+/* Make the table for the CRC-32 used by ZIP files */
+{
+    unsigned int ii, jj, c;
+
+    for (ii = 0; ii < 256; ii++) {
+        c = ii;
+        for (jj = 0; jj < 8; jj++)
+            c = (c & 1) ? 0xedb88320U ^ (c >> 1) : c >> 1;
+        crc_table[ii] = c;
+    }
+}
+
+
+static unsigned int update_crc(unsigned int crc, unsigned char *buf, long len)
+/* Update a running CRC-32 with 'len' bytes from 'buf' */
+{
+    long ii;
+
+    crc = crc ^ 0xffffffffU;
+    for (ii = 0; ii < len; ii++)
+        crc = crc_table[(crc ^ buf[ii]) & 0xff] ^ (crc >> 8);
+    return crc ^ 0xffffffffU;
+}
+
+
+static void put_le(unsigned char *buf, unsigned int val, int numbytes)
+/* Store 'val' in 'numbytes' little-endian bytes */
+{
+    int ii;
+
+    for (ii = 0; ii < numbytes; ii++)
+        buf[ii] = (val >> (8 * ii)) & 0xff;
+}
+
+
+static void write_npz(char *filenm, npyarray * arrays, int numarrays)
+/* Write the arrays as an uncompressed numpy '.npz' file (i.e. a   */
+/* ZIP file of '.npy' files) that can be read with numpy.load().   */
+/* The array data must be in the host (little-endian) byte order.  */
+{
+    FILE *outfile;
+    int ii, hdrlen;
+    unsigned int crc, *crcs, *offsets, *sizes, offset = 0, cdsize = 0;
+    unsigned char zhdr[46];
+    char npyhdr[256], shape[80];
+
+    crcs = (unsigned int *) malloc(sizeof(unsigned int) * numarrays);
+    offsets = (unsigned int *) malloc(sizeof(unsigned int) * numarrays);
+    sizes = (unsigned int *) malloc(sizeof(unsigned int) * numarrays);
+    outfile = chkfopen(filenm, "wb");
+    for (ii = 0; ii < numarrays; ii++) {
+        int namelen = strlen(arrays[ii].name) + 4;
+        char name[50];
+
+        /* The .npy version 1.0 header, padded to a multiple of 64 bytes */
+        if (arrays[ii].ndim == 1)
+            sprintf(shape, "(%ld,)", arrays[ii].shape[0]);
+        else
+            sprintf(shape, "(%ld, %ld)", arrays[ii].shape[0], arrays[ii].shape[1]);
+        memcpy(npyhdr, "\x93NUMPY\x01\x00", 8);
+        sprintf(npyhdr + 10, "{'descr': '%s', 'fortran_order': False, 'shape': %s, }",
+                arrays[ii].descr, shape);
+        hdrlen = strlen(npyhdr + 10);
+        while ((10 + hdrlen + 1) % 64)
+            npyhdr[10 + hdrlen++] = ' ';
+        npyhdr[10 + hdrlen++] = '\n';
+        put_le((unsigned char *) npyhdr + 8, hdrlen, 2);
+        hdrlen += 10;
+        crc = update_crc(0, (unsigned char *) npyhdr, hdrlen);
+        crc = update_crc(crc, (unsigned char *) arrays[ii].data, arrays[ii].nbytes);
+        crcs[ii] = crc;
+        sizes[ii] = hdrlen + arrays[ii].nbytes;
+        offsets[ii] = offset;
+
+        /* The ZIP local file header (stored, no compression) */
+        sprintf(name, "%s.npy", arrays[ii].name);
+        memset(zhdr, 0, 30);
+        put_le(zhdr, 0x04034b50U, 4);
+        put_le(zhdr + 4, 20, 2);        // Version needed to extract
+        put_le(zhdr + 12, 0x21, 2);     // Date (1980-01-01)
+        put_le(zhdr + 14, crcs[ii], 4);
+        put_le(zhdr + 18, sizes[ii], 4);
+        put_le(zhdr + 22, sizes[ii], 4);
+        put_le(zhdr + 26, namelen, 2);
+        chkfwrite(zhdr, 1, 30, outfile);
+        chkfwrite(name, 1, namelen, outfile);
+        chkfwrite(npyhdr, 1, hdrlen, outfile);
+        if (arrays[ii].nbytes)
+            chkfwrite(arrays[ii].data, 1, arrays[ii].nbytes, outfile);
+        offset += 30 + namelen + sizes[ii];
+    }
+
+    /* The ZIP central directory */
+    for (ii = 0; ii < numarrays; ii++) {
+        int namelen = strlen(arrays[ii].name) + 4;
+        char name[50];
+
+        sprintf(name, "%s.npy", arrays[ii].name);
+        memset(zhdr, 0, 46);
+        put_le(zhdr, 0x02014b50U, 4);
+        put_le(zhdr + 4, 20, 2);        // Version made by
+        put_le(zhdr + 6, 20, 2);        // Version needed to extract
+        put_le(zhdr + 14, 0x21, 2);     // Date (1980-01-01)
+        put_le(zhdr + 16, crcs[ii], 4);
+        put_le(zhdr + 20, sizes[ii], 4);
+        put_le(zhdr + 24, sizes[ii], 4);
+        put_le(zhdr + 28, namelen, 2);
+        put_le(zhdr + 42, offsets[ii], 4);
+        chkfwrite(zhdr, 1, 46, outfile);
+        chkfwrite(name, 1, namelen, outfile);
+        cdsize += 46 + namelen;
+    }
+
+    /* The end of central directory record */
+    memset(zhdr, 0, 22);
+    put_le(zhdr, 0x06054b50U, 4);
+    put_le(zhdr + 8, numarrays, 2);
+    put_le(zhdr + 10, numarrays, 2);
+    put_le(zhdr + 12, cdsize, 4);
+    put_le(zhdr + 16, offset, 4);
+    chkfwrite(zhdr, 1, 22, outfile);
+    fclose(outfile);
+    free(crcs);
+    free(offsets);
+    free(sizes);
+}
+
+
+static unsigned short float_to_half(float f)
+/* Convert a float to an IEEE 754 half-precision float (as numpy's */
+/* float16) using round-to-nearest-even.                           */
+{
+    union {
+        float f;
+        unsigned int u;
+    } in;
+    unsigned int sign, absval, mant, half, rem, halfway;
+    int exp, shift;
+
+    in.f = f;
+    sign = (in.u >> 16) & 0x8000;
+    absval = in.u & 0x7fffffff;
+    if (absval >= 0x7f800000)   // Inf or NaN
+        return sign | 0x7c00 | ((absval > 0x7f800000) ? 0x200 : 0);
+    if (absval >= 0x477ff000)   // Too large, so becomes Inf
+        return sign | 0x7c00;
+    if (absval < 0x38800000) {  // Subnormal half or zero
+        exp = absval >> 23;
+        if (exp < 102)
+            return sign;
+        mant = (absval & 0x7fffff) | 0x800000;
+        shift = 126 - exp;
+        half = mant >> shift;
+        rem = mant & ((1U << shift) - 1);
+        halfway = 1U << (shift - 1);
+        if (rem > halfway || (rem == halfway && (half & 1)))
+            half++;
+        return sign | half;
+    }
+    half = (absval - 0x38000000) >> 13;
+    rem = absval & 0x1fff;
+    if (rem > 0x1000 || (rem == 0x1000 && (half & 1)))
+        half++;
+    return sign | half;
+}
@@ -0,0 +1 @@
+gcc -g -O3 -Wall -W -fopenmp -I../include/ `pkg-config --cflags glib-2.0` -o test_accel_hier test_accel_hier.c ../src/accel_utils.o ../src/accel_hier.o ../src/accel_windows.o ../src/accel_search.o ../src/accel_stackslide.o ../src/accelsearch_cmd.o ../src/zapping.o -L../lib -lpresto `pkg-config --libs glib-2.0` -lfftw3f -lm
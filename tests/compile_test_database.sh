@@ -0,0 +1 @@
+gcc -g -O3 -Wall -W -I../include/ `pkg-config --cflags glib-2.0` -o test_database test_database.c -L../lib -lpresto `pkg-config --libs glib-2.0` -lfftw3f -lm
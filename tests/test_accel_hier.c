@@ -0,0 +1,289 @@
+#include "accel.h"
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+/* Calibrate the coarse pass of the hierarchical acceleration search */
+/* (accelsearch -hier, see src/accel_hier.c) with injected signals.  */
+/*                                                                   */
+/* 1.  Strong signals with random r, z, and w measure the fraction   */
+/*     of the full-resolution power that the coarse grid recovers.   */
+/* 2.  Signals near the power cutoff of a search with the given      */
+/*     'sigma' measure the false-dismissal rate (the fraction of the */
+/*     signals found by the full search that the coarse pass misses) */
+/*     for a range of '-hierfrac' values.                            */
+/* 3.  Noise-only blocks measure the fraction of the blocks that are */
+/*     refined, and the timing gives the speedup of the coarse pass. */
+/*                                                                   */
+/* Only the fundamental is tested (i.e. -numharm 1).                 */
+/*                                                                   */
+/* Usage:  test_accel_hier [zmax] [wmax] [sigma] [numsignals]        */
+
+#define NUMPTS     (1 << 19)
+#define PERSERIES  16
+#define NUMFRACS   7
+
+static const float fracs[NUMFRACS] = { 0.3, 0.4, 0.5, 0.6, 0.7, 0.8, 0.9 };
+
+static double wtime(void)
+{
+#ifdef _OPENMP
+    return omp_get_wtime();
+#else
+    return (double) clock() / CLOCKS_PER_SEC;
+#endif
+}
+
+
+static double normal_deviate(void)
+/* A normal deviate (Box-Muller) */
+{
+    double u1 = (random() + 1.0) / (RAND_MAX + 2.0);
+    double u2 = (random() + 1.0) / (RAND_MAX + 2.0);
+    return sqrt(-2.0 * log(u1)) * cos(2.0 * PI * u2);
+}
+
+
+static void init_obs(accelobs * obs, int zmax, int wmax, float sigma)
+/* The parts of create_accelobs() that the correlations need */
+{
+    memset(obs, 0, sizeof(accelobs));
+    obs->N = NUMPTS;
+    obs->numbins = NUMPTS / 2;
+    obs->highestbin = obs->numbins - 1;
+    obs->dat_input = 1;
+    obs->numharmstages = 1;
+    obs->zhi = zmax;
+    obs->zlo = -zmax;
+    obs->dz = ACCEL_DZ;
+    obs->numz = (zmax / ACCEL_DZ) * 2 + 1;
+    obs->whi = wmax;
+    obs->wlo = -wmax;
+    obs->dw = ACCEL_DW;
+    obs->numw = (wmax) ? (wmax / ACCEL_DW) * 2 + 1 : 0;
+    obs->rlo = 1.0;
+    obs->rhi = obs->highestbin;
+    obs->sigma = sigma;
+    obs->hierfrac = 0.5;
+    obs->powcut = (float *) malloc(sizeof(float));
+    obs->numindep = (long long *) malloc(sizeof(long long));
+    obs->numindep[0] = (obs->rhi - obs->rlo) * (obs->numz + 1) * (obs->dz / 6.95);
+    if (obs->numw)
+        obs->numindep[0] *= (obs->numw + 1) * (obs->dw / 44.2);
+    obs->powcut[0] = power_for_sigma(sigma, 1, obs->numindep[0]);
+    obs->maxkernlen = 2 * ACCEL_NUMBETWEEN * w_resp_halfwidth(obs->zhi, obs->whi, LOWACC);
+    obs->fftlen = fftlen_from_kernwidth(obs->maxkernlen);
+    if (obs->fftlen < 2048)
+        obs->fftlen = 2048;
+    obs->corr_uselen = obs->fftlen - obs->maxkernlen;
+    if (obs->corr_uselen % ACCEL_RDR)
+        obs->corr_uselen = obs->corr_uselen / ACCEL_RDR * ACCEL_RDR;
+}
+
+
+static void make_fft(accelobs * obs, int numsig, double *rs, double *zs,
+                     double *ws, double amp)
+/* Put the FFT of noise plus 'numsig' signals in obs->fft.  The   */
+/* signals have mean Fourier freqs 'rs', mean f-dots 'zs', and    */
+/* f-dot-dots 'ws' (all in bins).                                 */
+{
+    int ii, jj;
+    float *data = gen_fvect(NUMPTS + 2 * ACCEL_PADDING);
+
+    memset(data, 0, sizeof(float) * (NUMPTS + 2 * ACCEL_PADDING));
+    data += ACCEL_PADDING;
+    for (ii = 0; ii < NUMPTS; ii++)
+        data[ii] = normal_deviate();
+    for (jj = 0; jj < numsig; jj++) {
+        /* The initial r and z as in gen_w_response() */
+        double f = rs[jj] - 0.5 * zs[jj] + ws[jj] / 12.0;
+        double fd = (zs[jj] - 0.5 * ws[jj]) / 2.0, fdd = ws[jj] / 6.0;
+        double phs0 = random() / (RAND_MAX + 1.0);
+        for (ii = 0; ii < NUMPTS; ii++) {
+            double t = (double) ii / NUMPTS;
+            double phs = t * (t * (t * fdd + fd) + f) + phs0;
+            data[ii] += amp * cos(2.0 * PI * (phs - floor(phs)));
+        }
+    }
+    realfft(data, NUMPTS, -1);
+    obs->fft = (fcomplex *) data;
+    obs->fft[0].r = 1.0;
+    obs->fft[0].i = 1.0;
+}
+
+
+static float max_near(ffdotpows * ffd, int dz, int dw, double rr, double zz,
+                      double ww)
+/* The maximum power in 'ffd' (with z steps 'dz' and w steps 'dw') */
+/* near rr, zz, and ww.                                            */
+{
+    int ii, jj, kk;
+    float maxpow = 0.0;
+
+    for (ii = 0; ii < ffd->numws; ii++) {
+        if (fabs(ffd->wlo + ii * dw - ww) > 1.5 * (dw ? dw : 1))
+            continue;
+        for (jj = 0; jj < ffd->numzs; jj++) {
+            if (fabs(ffd->zlo + jj * dz - zz) > 1.5 * dz)
+                continue;
+            for (kk = 0; kk < ffd->numrs; kk++) {
+                if (fabs(ffd->rlo + kk * ACCEL_DR - rr) > 1.5)
+                    continue;
+                if (ffd->powers[ii][jj][kk] > maxpow)
+                    maxpow = ffd->powers[ii][jj][kk];
+            }
+        }
+    }
+    return maxpow;
+}
+
+
+static void measure(accelobs * obs, subharminfo ** shis, subharminfo ** cshis,
+                    int numsig, double power, float *fullpows, float *coarsepows,
+                    double *tfull, double *tcoarse)
+/* Inject 'numsig' signals with (noise-free) normalized power 'power'  */
+/* and return the full and coarse powers found near each of them.     */
+{
+    int ii, jj, numdone = 0, rstep = obs->corr_uselen * ACCEL_DR;
+    double rs[PERSERIES], zs[PERSERIES], ws[PERSERIES], amp, t0;
+    double spacing = (obs->numbins - 4.0 * rstep) / PERSERIES;
+    ffdotpows *full, *coarse;
+
+    amp = sqrt(4.0 * power / NUMPTS);
+    while (numdone < numsig) {
+        int num = (numsig - numdone < PERSERIES) ? numsig - numdone : PERSERIES;
+        for (ii = 0; ii < num; ii++) {
+            rs[ii] = 2 * rstep + (ii + random() / (RAND_MAX + 1.0)) * spacing;
+            zs[ii] = obs->zhi * (2.0 * random() / (RAND_MAX + 1.0) - 1.0);
+            ws[ii] = obs->whi * (2.0 * random() / (RAND_MAX + 1.0) - 1.0);
+        }
+        make_fft(obs, num, rs, zs, ws, amp);
+        for (ii = 0; ii < num; ii++) {
+            double startr = floor(rs[ii]) - rstep / 2;
+            t0 = wtime();
+            full = subharm_fderivs_vol(1, 1, startr, startr + rstep - ACCEL_DR,
+                                       &shis[0][0], obs);
+            *tfull += wtime() - t0;
+            t0 = wtime();
+            coarse = coarse_fderivs_vol(1, 1, startr, startr + rstep - ACCEL_DR,
+                                        &shis[0][0], &cshis[0][0], obs);
+            *tcoarse += wtime() - t0;
+            jj = numdone + ii;
+            fullpows[jj] = max_near(full, ACCEL_DZ, ACCEL_DW, rs[ii], zs[ii], ws[ii]);
+            coarsepows[jj] = max_near(coarse, HIER_DZ, HIER_DW, rs[ii], zs[ii], ws[ii]);
+            free_ffdotpows(full);
+            free_ffdotpows(coarse);
+        }
+        vect_free((float *) obs->fft - ACCEL_PADDING);
+        numdone += num;
+    }
+}
+
+
+static int compare_floats(const void *a, const void *b)
+{
+    float fa = *(const float *) a, fb = *(const float *) b;
+    return (fa > fb) - (fa < fb);
+}
+
+
+int main(int argc, char *argv[])
+{
+    int ii, jj, zmax = 100, wmax = 0, numsig = 200, numblocks = 8;
+    float sigma = 5.0, *fullpows, *coarsepows, *ratios;
+    double tfull = 0.0, tcoarse = 0.0;
+    accelobs obs;
+    subharminfo **shis, **cshis;
+
+    if (argc > 1)
+        zmax = atoi(argv[1]);
+    if (argc > 2)
+        wmax = atoi(argv[2]);
+    if (argc > 3)
+        sigma = atof(argv[3]);
+    if (argc > 4)
+        numsig = atoi(argv[4]);
+    zmax = (zmax / ACCEL_DZ) * ACCEL_DZ;
+    wmax = (wmax / ACCEL_DW) * ACCEL_DW;
+    srandom(12345);
+    init_obs(&obs, zmax, wmax, sigma);
+    printf("zmax = %d, wmax = %d, sigma = %.1f:  power cutoff = %.2f\n\n",
+           zmax, wmax, sigma, obs.powcut[0]);
+    shis = create_subharminfos(&obs);
+    cshis = create_coarse_subharminfos(&obs, shis);
+    printf("\n");
+    fullpows = gen_fvect(numsig);
+    coarsepows = gen_fvect(numsig);
+    ratios = gen_fvect(numsig);
+
+    /* 1.  The power lost to the coarse grid */
+    measure(&obs, shis, cshis, numsig, 2000.0, fullpows, coarsepows,
+            &tfull, &tcoarse);
+    for (ii = 0; ii < numsig; ii++)
+        ratios[ii] = coarsepows[ii] / fullpows[ii];
+    qsort(ratios, numsig, sizeof(float), compare_floats);
+    printf("Coarse / full power for %d strong signals:\n", numsig);
+    printf("  min = %.3f  1%% = %.3f  5%% = %.3f  median = %.3f  max = %.3f\n\n",
+           ratios[0], ratios[numsig / 100], ratios[numsig / 20],
+           ratios[numsig / 2], ratios[numsig - 1]);
+
+    /* 2.  False dismissals for signals near the cutoff */
+    measure(&obs, shis, cshis, numsig, obs.powcut[0], fullpows, coarsepows,
+            &tfull, &tcoarse);
+    {
+        int numfound = 0;
+        for (ii = 0; ii < numsig; ii++)
+            numfound += (fullpows[ii] > obs.powcut[0]);
+        printf("%d of %d signals near the cutoff were found at full resolution.\n",
+               numfound, numsig);
+        printf("  hierfrac   false dismissals\n");
+        for (jj = 0; jj < NUMFRACS; jj++) {
+            int nummissed = 0;
+            for (ii = 0; ii < numsig; ii++)
+                if (fullpows[ii] > obs.powcut[0] &&
+                    coarsepows[ii] <= 1.0 + fracs[jj] * (obs.powcut[0] - 1.0))
+                    nummissed++;
+            printf("    %.2f      %6.2f%%\n", fracs[jj],
+                   numfound ? 100.0 * nummissed / numfound : 0.0);
+        }
+        printf("\n");
+    }
+
+    /* 3.  Noise-only blocks that would be refined */
+    {
+        int rstep = obs.corr_uselen * ACCEL_DR, refined[NUMFRACS];
+        make_fft(&obs, 0, NULL, NULL, NULL, 0.0);
+        memset(refined, 0, sizeof(refined));
+        for (ii = 0; ii < numblocks; ii++) {
+            double startr = 2 * rstep + ii * rstep, rmax = 0.0;
+            ffdotpows *coarse = coarse_fderivs_vol(1, 1, startr,
+                                                   startr + rstep - ACCEL_DR,
+                                                   &shis[0][0], &cshis[0][0], &obs);
+            for (jj = 0; jj < coarse->numws * coarse->numzs * coarse->numrs; jj++)
+                if (coarse->powers[0][0][jj] > rmax)
+                    rmax = coarse->powers[0][0][jj];
+            for (jj = 0; jj < NUMFRACS; jj++)
+                refined[jj] += (rmax > 1.0 + fracs[jj] * (obs.powcut[0] - 1.0));
+            free_ffdotpows(coarse);
+        }
+        vect_free((float *) obs.fft - ACCEL_PADDING);
+        printf("Noise-only blocks refined (of %d):\n", numblocks);
+        printf("  hierfrac   refined\n");
+        for (jj = 0; jj < NUMFRACS; jj++)
+            printf("    %.2f      %3d\n", fracs[jj], refined[jj]);
+        printf("\n");
+    }
+
+    printf("Time for full resolution blocks:  %.3f s\n", tfull / (2 * numsig));
+    printf("Time for coarse blocks:           %.3f s  (%.1fx faster)\n\n",
+           tcoarse / (2 * numsig), tfull / tcoarse);
+
+    vect_free(fullpows);
+    vect_free(coarsepows);
+    vect_free(ratios);
+    free_subharminfos(&obs, cshis);
+    free_subharminfos(&obs, shis);
+    free(obs.powcut);
+    free(obs.numindep);
+    return 0;
+}
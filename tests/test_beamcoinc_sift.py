@@ -0,0 +1,54 @@
+import os
+import shutil
+import tempfile
+import importlib.util
+from os import path
+
+# Check the single pulse coincidence filter of bin/beamcoinc_sift.py
+# with synthetic events in 3 beams (rejecting events seen in >= 2)
+
+here = path.dirname(path.abspath(__file__))
+spec = importlib.util.spec_from_file_location(
+    "beamcoinc_sift", path.join(here, "..", "bin", "beamcoinc_sift.py"))
+beamcoinc_sift = importlib.util.module_from_spec(spec)
+spec.loader.exec_module(beamcoinc_sift)
+
+# (DM, sigma, time) of the events in each beam
+events = {
+    "A": [(50.0, 10.0, 1.0),    # B has it (DM within dmtol):  RFI
+          (50.0, 10.0, 2.0),    # B's event is at a very different DM
+          (1.0, 10.0, 3.0),     # Both near DM 0:  RFI
+          (80.0, 10.0, 4.0),    # B's event is too weak
+          (30.0, 10.0, 5.0)],   # B's event is too late
+    "B": [(51.0, 8.0, 1.002),
+          (120.0, 8.0, 2.0),
+          (4.0, 8.0, 3.0),
+          (80.0, 5.5, 4.0),     # A's event is strong, so this is RFI
+          (30.0, 8.0, 5.5)],
+    "C": [(200.0, 10.0, 2.0)],  # Same time as A and B, but a different DM
+}
+expected = {"A": [50.0, 80.0, 30.0], "B": [120.0, 30.0], "C": [200.0]}
+
+print("Testing multibeam single pulse sifting...", end=' ')
+workdir = tempfile.mkdtemp()
+try:
+    beamdirs, outdirs = [], []
+    for beam in sorted(events):
+        beamdirs.append(path.join(workdir, beam))
+        outdirs.append(path.join(workdir, "multibeam", beam))
+        os.makedirs(beamdirs[-1])
+        os.makedirs(outdirs[-1])
+        with open(path.join(beamdirs[-1], "%s_DM0.00.singlepulse" % beam), "w") as f:
+            f.write("# DM      Sigma      Time (s)     Sample    Downfact\n")
+            for dm, sigma, time in events[beam]:
+                f.write("%7.2f %7.2f %13.6f %10d     %3d\n" %
+                        (dm, sigma, time, int(time / 1e-4), 1))
+    beamcoinc_sift.sift_singlepulse(beamdirs, outdirs, 2, 0.01,
+                                    dmtol=2.0, zerodm=5.0, sigmin=6.0)
+    for beam, outdir in zip(sorted(events), outdirs):
+        with open(path.join(outdir, "%s_DM0.00.singlepulse" % beam)) as f:
+            dms = [float(line.split()[0]) for line in f if not line.startswith("#")]
+        assert(dms == expected[beam])
+finally:
+    shutil.rmtree(workdir)
+print("success")
@@ -0,0 +1,152 @@
+#include "accel.h"
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+/* Benchmark the huge page / NUMA aware large vectors (gen_bigvect())  */
+/* against normal vectors for the in-memory harmonic summing of        */
+/* accelsearch (inmem_add_ffdotpows()) and for dedispersion            */
+/* (float_dedisp()) as done by prepsubband.                            */
+/*                                                                     */
+/* Usage:  test_bigvect [plane_MB] [numdms] [#times]                   */
+
+#define ZMAX    200
+#define USELEN  7470
+
+static double wtime(void)
+{
+#ifdef _OPENMP
+    return omp_get_wtime();
+#else
+    return (double) clock() / CLOCKS_PER_SEC;
+#endif
+}
+
+
+static double time_inmem_add(float *plane, long long highestbin, int numtimes)
+/* Return the time for 'numtimes' full 16-harmonic summing passes */
+{
+    int ii, harm;
+    long long rlo;
+    double t0;
+    accelobs obs;
+    ffdotpows fund;
+
+    memset(&obs, 0, sizeof(accelobs));
+    memset(&fund, 0, sizeof(ffdotpows));
+    obs.highestbin = highestbin;
+    obs.corr_uselen = USELEN;
+    obs.ffdotplane = plane;
+    fund.zlo = -ZMAX;
+    fund.numzs = 2 * ZMAX / ACCEL_DZ + 1;
+    fund.numrs = USELEN * ACCEL_RDR;
+    fund.numws = 1;
+    fund.powers = gen_f3Darr(1, fund.numzs, fund.numrs);
+
+    t0 = wtime();
+    for (ii = 0; ii < numtimes; ii++) {
+        for (rlo = highestbin / 16; rlo + USELEN < highestbin; rlo += USELEN) {
+            fund.rlo = rlo;
+            for (harm = 1; harm < 16; harm++)
+                inmem_add_ffdotpows(&fund, &obs, 16, harm);
+        }
+    }
+    t0 = wtime() - t0;
+    vect_free(fund.powers[0][0]);
+    vect_free(fund.powers[0]);
+    vect_free(fund.powers);
+    return t0;
+}
+
+
+static double time_dedisp(float **outdata, int numdms, int numtimes)
+/* Return the time for 'numtimes' dedispersions of 'numdms' DMs */
+{
+    const int nsub = 128, worklen = 16384;
+    int ii, jj, **offsets;
+    float *data, *lastdata;
+    double t0;
+
+    data = gen_fvect(nsub * worklen);
+    lastdata = gen_fvect(nsub * worklen);
+    for (ii = 0; ii < nsub * worklen; ii++)
+        data[ii] = lastdata[ii] = (float) (ii % 97);
+    offsets = gen_imatrix(numdms, nsub);
+    for (ii = 0; ii < numdms; ii++)
+        for (jj = 0; jj < nsub; jj++)
+            offsets[ii][jj] = (ii * (nsub - jj)) % worklen;
+
+    t0 = wtime();
+    for (jj = 0; jj < numtimes; jj++) {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) default(shared)
+#endif
+        for (ii = 0; ii < numdms; ii++)
+            float_dedisp(data, lastdata, worklen, nsub, offsets[ii], 0.0,
+                         outdata[ii]);
+    }
+    t0 = wtime() - t0;
+    vect_free(data);
+    vect_free(lastdata);
+    vect_free(offsets[0]);
+    vect_free(offsets);
+    return t0;
+}
+
+
+int main(int argc, char *argv[])
+{
+    int ii, numdms = 1000, numtimes = 3, method;
+    long long planelen, highestbin, jj;
+    double mb = 2048.0, t_add, t_dedisp;
+    float *plane, **outdata;
+    char *names[4] = { "gen_fvect() (serial first touch)",
+        "gen_bigvect() no huge pages",
+        "gen_bigvect() huge pages",
+        "gen_bigvect() huge pages + NUMA interleave"
+    };
+
+    if (argc > 1)
+        mb = atof(argv[1]);
+    if (argc > 2)
+        numdms = atoi(argv[2]);
+    if (argc > 3)
+        numtimes = atoi(argv[3]);
+    highestbin = (long long) (mb * 1048576.0 / sizeof(float)
+                              / ACCEL_RDR / (2 * ZMAX / ACCEL_DZ + 1)) - USELEN;
+    planelen = (highestbin + USELEN) * ACCEL_RDR * (2 * ZMAX / ACCEL_DZ + 1);
+#ifdef _OPENMP
+    printf("\nUsing %d OpenMP threads.\n", omp_get_max_threads());
+#endif
+    printf("f-fdot plane of %.0f MB (zmax = %d), %d DMs, %d passes each.\n\n",
+           planelen * sizeof(float) / 1048576.0, ZMAX, numdms, numtimes);
+    printf("%-45s  %14s  %14s\n", "Allocation", "inmem_add (s)", "dedisp (s)");
+
+    for (method = 0; method < 4; method++) {
+        if (method == 0) {
+            plane = gen_fvect(planelen);
+            outdata = gen_fmatrix(numdms, 16384);
+        } else {
+            set_bigvect_policy(method > 1, method > 2);
+            plane = gen_big_fvect(planelen);
+            outdata = (float **) malloc(numdms * sizeof(float *));
+            outdata[0] = gen_big_fvect((long) numdms * 16384);
+            for (ii = 1; ii < numdms; ii++)
+                outdata[ii] = outdata[ii - 1] + 16384;
+        }
+        /* Fill the plane from one thread like fund_to_ffdotplane() */
+        for (jj = 0; jj < planelen; jj++)
+            plane[jj] = (float) (jj % 1013);
+        t_add = time_inmem_add(plane, highestbin, numtimes);
+        t_dedisp = time_dedisp(outdata, numdms, numtimes);
+        printf("%-45s  %14.3f  %14.3f\n", names[method], t_add, t_dedisp);
+        vect_free(plane);
+        vect_free(outdata[0]);
+        if (method == 0)
+            vect_free(outdata);
+        else
+            free(outdata);
+    }
+    printf("\n");
+    return 0;
+}
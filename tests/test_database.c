@@ -0,0 +1,150 @@
+#include "presto.h"
+
+/* Check that the indexed pulsar database lookup of comp_psr_to_cand() */
+/* gives exactly the same results (pulsar numbers and descriptions)    */
+/* as a scan of the full database (comp_psr_to_cand_scan()) for many   */
+/* random candidates.  Most candidates are put near (in position and   */
+/* frequency) a random database pulsar or one of its harmonics, and   */
+/* some are near the poles and RA = 0.  Then time both lookups.        */
+/*                                                                     */
+/* Usage:  test_database [#cands] [seed]     (needs $PRESTO/lib)      */
+
+static double wtime(void)
+{
+    return (double) clock() / CLOCKS_PER_SEC;
+}
+
+
+static double urand(double lo, double hi)
+{
+    return lo + (hi - lo) * (rand() / (RAND_MAX + 1.0));
+}
+
+
+static void set_position(infodata * idata, double ra, double dec)
+/* Put the J2000 position (radians) into *idata */
+{
+    int sign = (dec < 0.0) ? -1 : 1;
+
+    ra = fmod(ra, TWOPI);
+    if (ra < 0.0)
+        ra += TWOPI;
+    if (dec > 0.5 * PI)
+        dec = 0.5 * PI;
+    if (dec < -0.5 * PI)
+        dec = -0.5 * PI;
+    hours2hms(ra * RADTODEG / 15.0, &idata->ra_h, &idata->ra_m, &idata->ra_s);
+    deg2dms(fabs(dec) * RADTODEG, &idata->dec_d, &idata->dec_m, &idata->dec_s);
+    /* dms2rad() takes the sign from the first non-zero field */
+    if (sign < 0) {
+        if (idata->dec_d)
+            idata->dec_d = -idata->dec_d;
+        else if (idata->dec_m)
+            idata->dec_m = -idata->dec_m;
+        else
+            idata->dec_s = -idata->dec_s;
+    }
+}
+
+
+static void random_cand(int numpsrs, infodata * idata, fourierprops * cand)
+/* A random candidate and observation */
+{
+    double T, ra, dec, beam, f;
+    psrparams psr;
+
+    memset(idata, 0, sizeof(infodata));
+    memset(cand, 0, sizeof(fourierprops));
+    idata->dt = 1e-4;
+    T = pow(10.0, urand(1.0, 4.5));
+    idata->N = T / idata->dt;
+    T = idata->N * idata->dt;
+    idata->mjd_i = (int) urand(44000.0, 62000.0);
+    idata->mjd_f = urand(0.0, 1.0);
+    idata->fov = pow(10.0, urand(0.5, 4.0));
+    beam = idata->fov * ARCSEC2RAD;
+    if (rand() % 10 == 0) {
+        /* Near a pole or RA = 0 */
+        ra = urand(-0.05, 0.05);
+        dec = (rand() % 2 ? 1 : -1) * urand(0.5 * PI - 0.05, 0.5 * PI);
+        f = pow(10.0, urand(-1.0, 3.0));
+    } else {
+        get_psr(rand() % numpsrs, &psr);
+        ra = psr.ra2000 + urand(-12.0, 12.0) * beam / cos(psr.dec2000);
+        dec = psr.dec2000 + urand(-12.0, 12.0) * beam;
+        f = psr.f;
+        if (rand() % 3 == 0)
+            f *= (int) urand(1.0, 42.0);
+        else if (rand() % 3 == 0)
+            f /= (int) urand(1.0, 6.0);
+    }
+    set_position(idata, ra, dec);
+    cand->r = f * T + urand(-30.0, 30.0);
+    if (cand->r < 1.0)
+        cand->r = urand(1.0, 100.0);
+    cand->z = urand(-100.0, 100.0);
+}
+
+
+int main(int argc, char *argv[])
+{
+    int ii, jj, numpsrs, numcands = 100000, seed = 1, bad = 0, nummatch = 0;
+    int *res1, *res2;
+    double t1, t2;
+    char out1[400], out2[400];
+    infodata *idatas;
+    fourierprops *cands;
+
+    if (argc > 1)
+        numcands = atoi(argv[1]);
+    if (argc > 2)
+        seed = atoi(argv[2]);
+    srand(seed);
+    numpsrs = read_database();
+    printf("Read %d pulsars from the database.\n", numpsrs);
+    idatas = (infodata *) malloc(sizeof(infodata) * numcands);
+    cands = (fourierprops *) malloc(sizeof(fourierprops) * numcands);
+    res1 = gen_ivect(numcands);
+    res2 = gen_ivect(numcands);
+    for (ii = 0; ii < numcands; ii++)
+        random_cand(numpsrs, idatas + ii, cands + ii);
+
+    /* The descriptions must agree too */
+    for (ii = 0; ii < numcands; ii++) {
+        for (jj = 0; jj < 2; jj++) {
+            int r1 = comp_psr_to_cand(cands + ii, idatas + ii, out1, jj);
+            int r2 = comp_psr_to_cand_scan(cands + ii, idatas + ii, out2, jj);
+            if (r1 != r2 || strcmp(out1, out2)) {
+                if (bad < 10)
+                    printf("Error:  cand %d (full = %d):  index = %d '%s', scan = %d '%s'\n",
+                           ii, jj, r1, out1, r2, out2);
+                bad++;
+            }
+            if (jj == 0 && r2)
+                nummatch++;
+        }
+    }
+    printf("%d of %d candidates matched database pulsars.\n", nummatch, numcands);
+
+    /* Time them */
+    t1 = wtime();
+    for (ii = 0; ii < numcands; ii++)
+        res1[ii] = comp_psr_to_cand(cands + ii, idatas + ii, out1, 0);
+    t1 = wtime() - t1;
+    t2 = wtime();
+    for (ii = 0; ii < numcands; ii++)
+        res2[ii] = comp_psr_to_cand_scan(cands + ii, idatas + ii, out2, 0);
+    t2 = wtime() - t2;
+    for (ii = 0; ii < numcands; ii++)
+        if (res1[ii] != res2[ii])
+            bad++;
+    printf("   index:  %8.3f s\n", t1);
+    printf("    scan:  %8.3f s\n", t2);
+
+    free(idatas);
+    free(cands);
+    vect_free(res1);
+    vect_free(res2);
+    printf("\n%s\n", bad ? "FAILED" : "All tests passed.");
+    return bad ? 1 : 0;
+}
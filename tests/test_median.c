@@ -0,0 +1,180 @@
+#include "presto.h"
+#include "mask.h"
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+/* Check and benchmark the order statistic routines in median.c: */
+/* a full quickselect (select_kth()) against median(), the       */
+/* copy-free median_nocopy() and the approximate hist_median(),  */
+/* and the running median (runmed_*() via median_filter())       */
+/* against medians of each window.                               */
+/*                                                               */
+/* Usage:  test_median [numpts] [medlen] [#times]                */
+
+static double wtime(void)
+{
+#ifdef _OPENMP
+    return omp_get_wtime();
+#else
+    return (double) clock() / CLOCKS_PER_SEC;
+#endif
+}
+
+
+static int compare_fl(const void *a, const void *b)
+{
+    float fa = *(float *) a, fb = *(float *) b;
+
+    return (fa > fb) - (fa < fb);
+}
+
+
+static void fill_powers(float *data, int numpts, int seed)
+/* Exponentially distributed "powers" with some very strong outliers */
+{
+    int ii;
+
+    srand(seed);
+    for (ii = 0; ii < numpts; ii++)
+        data[ii] = -log((rand() + 1.0) / (RAND_MAX + 2.0));
+    for (ii = 0; ii < numpts; ii += 997)
+        data[ii] = 1e6 * (ii % 5 + 1);
+}
+
+
+static void naive_filter(float *data, float *result, int numdata, int medlen)
+/* The window-by-window running median of median_filter() */
+{
+    int ii, jj, halflen = medlen / 2;
+    float *window = gen_fvect(medlen);
+
+    for (ii = 0; ii < numdata; ii++) {
+        for (jj = 0; jj < medlen; jj++) {
+            int index = ii - halflen + jj;
+            window[jj] = (index < 0 || index >= numdata) ? 0.0 : data[index];
+        }
+        result[ii] = median(window, medlen);
+    }
+    vect_free(window);
+}
+
+
+int main(int argc, char *argv[])
+{
+    int ii, jj, numpts = 1 << 20, medlen = 101, numtimes = 20, bad = 0;
+    float *data, *tmp, *res1, *res2, med0 = 0.0, med1 = 0.0, med2 = 0.0, med3 = 0.0;
+    float maxerr = 0.0;
+    double t0, t1, t2, t3;
+    int lens[] = { 1, 2, 3, 10, 4096, 4097, 10000, 65537, 50000, 50001, 65537 };
+
+    if (argc > 1)
+        numpts = atoi(argv[1]);
+    if (argc > 2)
+        medlen = atoi(argv[2]);
+    if (argc > 3)
+        numtimes = atoi(argv[3]);
+    data = gen_fvect(numpts);
+    tmp = gen_fvect(numpts);
+    res1 = gen_fvect(numpts);
+    res2 = gen_fvect(numpts);
+
+    /* Correctness of the medians (including ties and short arrays) */
+    for (ii = 0; ii < sizeof(lens) / sizeof(lens[0]); ii++) {
+        int len = (lens[ii] < numpts) ? lens[ii] : numpts;
+        fill_powers(data, len, ii + 1);
+        if (ii & 1)             /* Lots of identical values */
+            for (jj = 0; jj < len; jj++)
+                data[jj] = (float) (int) (4.0 * data[jj]);
+        if (ii == 8)            /* Sorted values */
+            qsort(data, len, sizeof(float), compare_fl);
+        if (ii == 9)            /* Mostly zeros */
+            for (jj = 0; jj < 0.7 * len; jj++)
+                data[jj] = 0.0;
+        if (ii == 10) {         /* Zeros only where sample_bracket() looks */
+            double stride = (double) len / 4096;
+            for (jj = 0; jj < len; jj++)
+                data[jj] = 1.0;
+            for (jj = 0; jj < 4096; jj++)
+                data[(long) (jj * stride)] = 0.0;
+        }
+        memcpy(tmp, data, sizeof(float) * len);
+        qsort(tmp, len, sizeof(float), compare_fl);
+        med1 = tmp[(len - 1) / 2];
+        memcpy(tmp, data, sizeof(float) * len);
+        if (median(tmp, len) != med1 || median_nocopy(data, len) != med1) {
+            printf("Error:  median(%d) != %g\n", len, med1);
+            bad++;
+        }
+        memcpy(tmp, data, sizeof(float) * len);
+        if (select_kth(tmp, len, len - 1) != tmp[len - 1]) {
+            printf("Error:  select_kth(%d)\n", len);
+            bad++;
+        }
+        med3 = hist_median(data, len, &maxerr);
+        if (fabs(med3 - med1) > maxerr) {
+            printf("Error:  hist_median(%d) = %g +/- %g != %g\n",
+                   len, med3, maxerr, med1);
+            bad++;
+        }
+    }
+
+    /* Time the full-array medians */
+    fill_powers(data, numpts, 42);
+    t0 = wtime();
+    for (ii = 0; ii < numtimes; ii++) {
+        memcpy(tmp, data, sizeof(float) * numpts);
+        med0 = select_kth(tmp, numpts, (numpts - 1) / 2);
+    }
+    t0 = wtime() - t0;
+    t1 = wtime();
+    for (ii = 0; ii < numtimes; ii++) {
+        memcpy(tmp, data, sizeof(float) * numpts);
+        med1 = median(tmp, numpts);
+    }
+    t1 = wtime() - t1;
+    t2 = wtime();
+    for (ii = 0; ii < numtimes; ii++)
+        med2 = median_nocopy(data, numpts);
+    t2 = wtime() - t2;
+    t3 = wtime();
+    for (ii = 0; ii < numtimes; ii++)
+        med3 = hist_median(data, numpts, &maxerr);
+    t3 = wtime() - t3;
+    if (med1 != med0 || med2 != med0 || fabs(med3 - med0) > maxerr) {
+        printf("Error:  medians (%g, %g, %g) != %g\n", med1, med2, med3, med0);
+        bad++;
+    }
+    printf("Median of %d points (%d times):\n", numpts, numtimes);
+    printf(" copy + select_kth():  %8.4f s  (%g)\n", t0, med0);
+    printf("     copy + median():  %8.4f s  (%g)\n", t1, med1);
+    printf("     median_nocopy():  %8.4f s  (%g)\n", t2, med2);
+    printf("       hist_median():  %8.4f s  (%g +/- %g)\n", t3, med3, maxerr);
+
+    /* The running medians */
+    if (!(medlen & 1))
+        medlen++;
+    t1 = wtime();
+    naive_filter(data, res1, numpts, medlen);
+    t1 = wtime() - t1;
+    t2 = wtime();
+    median_filter(data, res2, numpts, medlen);
+    t2 = wtime() - t2;
+    for (ii = 0; ii < numpts; ii++) {
+        if (res1[ii] != res2[ii]) {
+            printf("Error:  median_filter()[%d] = %g != %g\n", ii, res2[ii], res1[ii]);
+            bad++;
+            break;
+        }
+    }
+    printf("Running median of length %d:\n", medlen);
+    printf("    window by window:  %8.4f s\n", t1);
+    printf("     median_filter():  %8.4f s\n", t2);
+
+    vect_free(data);
+    vect_free(tmp);
+    vect_free(res1);
+    vect_free(res2);
+    printf("\n%s\n", bad ? "FAILED" : "All tests passed.");
+    return bad ? 1 : 0;
+}
@@ -51,6 +51,22 @@ assert(y.dt==0.125)
 os.remove("xxx.inf")
 print("success")
 
+print("Testing library errors as exceptions...", end=' ')
+try:
+    presto.read_inffile("no_such_file", verbose=False)
+    assert(False)
+except IOError as e:
+    assert("no_such_file.inf" in str(e))
+try:
+    presto.gen_fvect(-1)
+    assert(False)
+except MemoryError:
+    pass
+# The interpreter must still be usable afterwards
+x = presto.read_inffile(path.join(here, "1937_DM71.02_zerodm.inf"), verbose=False)
+assert(x.telescope=="GBT")
+print("success")
+
 print("""Note: If the following fails, edit $PRESTO/meson.build and remove
         '-DUSE_FFTW_MALLOC' from the `_global_c_args` definition, and re-build.""")
 print("Testing allocation and freeing of memory...", end=' ')